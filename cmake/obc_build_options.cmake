@@ -17,6 +17,10 @@ if (NOT DEFINED LOG_DEFAULT_LEVEL)
     set(LOG_DEFAULT_LEVEL LOG_TRACE)
 endif()
 
+if (NOT DEFINED LOG_DEFAULT_FORMAT)
+    set(LOG_DEFAULT_FORMAT LOG_FORMAT_TEXT)
+endif()
+
 if(NOT DEFINED ENABLE_BL_BYPASS)
     set(ENABLE_BL_BYPASS 1)
 endif()
@@ -40,3 +44,8 @@ endif()
 if (NOT DEFINED ENABLE_TASK_STATS_COLLECTOR)
     set(ENABLE_TASK_STATS_COLLECTOR 1)
 endif()
+
+# Run the single-precision GNC models; 0 runs the double-precision reference models
+if (NOT DEFINED GNC_SINGLE_PRECISION)
+    set(GNC_SINGLE_PRECISION 1)
+endif()
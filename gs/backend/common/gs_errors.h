@@ -4,5 +4,10 @@ typedef enum {
   GS_ERR_CODE_SUCCESS,
   GS_ERR_CODE_CORRUPTED_MSG,
   GS_ERR_CODE_AX25_DECODE_FAILURE,
+  GS_ERR_CODE_INVALID_ARG,
+  GS_ERR_CODE_MALLOC_FAILED,
+  GS_ERR_CODE_THREAD_CREATE_FAILURE,
+  GS_ERR_CODE_INVALID_AX25_FRAME,
+  GS_ERR_CODE_TELEMETRY_UNPACK_FAILURE,
 
 } gs_error_code_t;
@@ -0,0 +1,176 @@
+#include "gs_decode_service.h"
+#include "gs_errors.h"
+
+#include "obc_gs_aes128.h"
+
+#include <cserialport.h>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Decodes downlink frames from a serial port, or from a file, FIFO or pty standing in for one, and prints what each
+ * frame holds.
+ *
+ *   gs-decode.out [-w workers] [-a] [-q] (-p serial_port | -f path)
+ *
+ *   -w  number of decode threads, 1 by default
+ *   -a  the payload is AES-128 encrypted with the ground station key and IV
+ *   -q  print only the totals, not every frame
+ */
+
+#define READ_CHUNK_BYTES 4096U
+
+static const uint8_t TEMP_STATIC_KEY[AES_KEY_SIZE] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                                      0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+// The fixed IV uplink_decoder uses until IVs are exchanged
+static const uint8_t TEMP_STATIC_IV[AES_IV_SIZE] = {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+                                                    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01};
+
+static volatile sig_atomic_t stopRequested;
+static gs_decode_service_t *decodeService;
+
+static void onSignal(int signum) { stopRequested = 1; }
+
+static void printFrame(const gs_decoded_frame_t *frame, void *context) {
+  bool quiet = *(const bool *)context;
+  if (quiet) {
+    return;
+  }
+
+  if (frame->status != GS_ERR_CODE_SUCCESS) {
+    printf("%llu: failed to decode (%d)\n", (unsigned long long)frame->seq, frame->status);
+    return;
+  }
+
+  if (!frame->isInfoFrame) {
+    printf("%llu: link control frame\n", (unsigned long long)frame->seq);
+    return;
+  }
+
+  printf("%llu: %u telemetry points\n", (unsigned long long)frame->seq, frame->numTelemetry);
+  for (uint32_t i = 0; i < frame->numTelemetry; i++) {
+    printf("  id %u at %u\n", frame->telemetry[i].id, frame->telemetry[i].timestamp);
+  }
+}
+
+static void onReadSpan(void *pSerialPort, const char *portName, const char *data, unsigned int size) {
+  gsDecodeServicePush(decodeService, (const uint8_t *)data, size);
+}
+
+static int decodeSerialPort(const char *portName) {
+  void *pSerialPort = CSerialPortMalloc();
+  CSerialPortInit(pSerialPort, portName, 115200, ParityNone, DataBits8, StopTwo, FlowNone, READ_CHUNK_BYTES);
+  CSerialPortSetOperateMode(pSerialPort, AsynchronousOperate);
+  CSerialPortSetReadIntervalTimeout(pSerialPort, 0);
+  CSerialPortConnectReadSpanEvent(pSerialPort, onReadSpan);
+
+  if (!CSerialPortOpen(pSerialPort)) {
+    printf("Failed to open %s: %s\n", portName, CSerialPortGetLastErrorMsg(pSerialPort));
+    CSerialPortFree(pSerialPort);
+    return 1;
+  }
+
+  // Frames are pushed from the serial port's read thread until interrupted
+  while (!stopRequested) {
+    pause();
+  }
+
+  CSerialPortClose(pSerialPort);
+  CSerialPortFree(pSerialPort);
+  return 0;
+}
+
+static int decodeFile(const char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    printf("Failed to open %s\n", path);
+    return 1;
+  }
+
+  uint8_t chunk[READ_CHUNK_BYTES];
+  ssize_t len;
+  while (!stopRequested && (len = read(fd, chunk, sizeof(chunk))) > 0) {
+    gsDecodeServicePush(decodeService, chunk, (uint32_t)len);
+  }
+
+  close(fd);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  const char *portName = NULL;
+  const char *path = NULL;
+  bool quiet = false;
+
+  gs_decode_config_t config = {0};
+  config.numWorkers = 1;
+  config.unpackTelemetry = true;
+  config.callback = printFrame;
+  config.context = &quiet;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "w:ap:f:q")) != -1) {
+    switch (opt) {
+      case 'w':
+        config.numWorkers = (uint32_t)strtoul(optarg, NULL, 10);
+        break;
+      case 'a':
+        config.aesKey = TEMP_STATIC_KEY;
+        config.aesIv = TEMP_STATIC_IV;
+        break;
+      case 'p':
+        portName = optarg;
+        break;
+      case 'f':
+        path = optarg;
+        break;
+      case 'q':
+        quiet = true;
+        break;
+      default:
+        printf("Usage: %s [-w workers] [-a] [-q] (-p serial_port | -f path)\n", argv[0]);
+        return 1;
+    }
+  }
+
+  if ((portName == NULL) == (path == NULL)) {
+    printf("Give either a serial port or a file\n");
+    return 1;
+  }
+
+  gs_error_code_t gsErrCode = gsDecodeServiceCreate(&config, &decodeService);
+  if (gsErrCode != GS_ERR_CODE_SUCCESS) {
+    printf("Failed to start the decode service (%d)\n", gsErrCode);
+    return 1;
+  }
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  int ret = (portName != NULL) ? decodeSerialPort(portName) : decodeFile(path);
+  gsDecodeServiceFlush(decodeService);
+
+  struct timespec end;
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+
+  gs_decode_stats_t stats;
+  gsDecodeServiceGetStats(decodeService, &stats);
+  gsDecodeServiceDestroy(decodeService);
+
+  printf("%llu frames, %llu decoded, %llu failed, %u too long, %.0f frames/s\n", (unsigned long long)stats.frames,
+         (unsigned long long)stats.decoded, (unsigned long long)stats.failed, stats.extractorOverflows,
+         seconds > 0 ? (double)stats.frames / seconds : 0.0);
+
+  return ret;
+}
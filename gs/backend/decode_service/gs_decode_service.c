@@ -0,0 +1,307 @@
+#include "gs_decode_service.h"
+#include "gs_errors.h"
+
+#include "obc_gs_aes128.h"
+#include "obc_gs_ax25.h"
+#include "obc_gs_ax25_frame_extractor.h"
+#include "obc_gs_erasure_hints.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+#include "obc_gs_telemetry_unpack.h"
+
+#include <aes.h>
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Frames in flight live in a ring of window slots; frame seq uses slot seq % window. Three counters walk the ring
+ * under the lock, never passing each other:
+ *   nextDeliverSeq <= nextJobSeq <= nextSubmitSeq <= nextDeliverSeq + window
+ * A slot between nextDeliverSeq and nextJobSeq belongs to the worker that took it until it is marked done, so the
+ * decoding itself runs without the lock.
+ */
+typedef struct {
+  uint8_t frame[AX25_MAXIMUM_PKT_LEN];
+  uint16_t frameLen;
+  bool done;
+  gs_decoded_frame_t result;
+} gs_decode_slot_t;
+
+struct gs_decode_service {
+  gs_decode_config_t config;
+  bool decrypt;
+  struct AES_ctx aesCtx;  // Expanded key; each worker copies it since CTR mode writes the counter into it
+
+  pthread_mutex_t lock;
+  pthread_cond_t jobReady;       // Signalled when nextSubmitSeq moves or the service stops
+  pthread_cond_t slotDelivered;  // Signalled when nextDeliverSeq moves
+
+  gs_decode_slot_t *slots;
+  uint64_t nextSubmitSeq;   // Next frame the extractor finds
+  uint64_t nextJobSeq;      // Next frame a worker takes
+  uint64_t nextDeliverSeq;  // Next frame handed to the callback
+  bool delivering;          // A worker is running the callback
+  bool stopping;
+
+  gs_decode_stats_t stats;
+
+  ax25_frame_extractor_t extractor;  // Only used by the pushing thread
+
+  pthread_t workers[GS_DECODE_MAX_WORKERS];
+  uint32_t numWorkersStarted;
+};
+
+static void *decodeWorker(void *arg);
+static void decodeFrame(const gs_decode_service_t *service, const gs_decode_slot_t *slot, gs_decoded_frame_t *result);
+static void submitFrame(const uint8_t *frame, uint16_t frameLen, void *context);
+static void stopWorkers(gs_decode_service_t *service);
+
+gs_error_code_t gsDecodeServiceCreate(const gs_decode_config_t *config, gs_decode_service_t **service) {
+  if (config == NULL || service == NULL || config->callback == NULL) {
+    return GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (config->numWorkers == 0 || config->numWorkers > GS_DECODE_MAX_WORKERS) {
+    return GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (config->aesKey != NULL && config->aesIv == NULL) {
+    return GS_ERR_CODE_INVALID_ARG;
+  }
+
+  gs_decode_service_t *newService = calloc(1, sizeof(*newService));
+  if (newService == NULL) {
+    return GS_ERR_CODE_MALLOC_FAILED;
+  }
+
+  newService->config = *config;
+  if (newService->config.window == 0) {
+    newService->config.window = GS_DECODE_DEFAULT_WINDOW;
+  }
+
+  if (config->aesKey != NULL) {
+    // The caller's key and IV may not outlive the service, so only the expanded copy is kept
+    AES_init_ctx_iv(&newService->aesCtx, config->aesKey, config->aesIv);
+    newService->decrypt = true;
+    newService->config.aesKey = NULL;
+    newService->config.aesIv = NULL;
+  }
+
+  newService->slots = calloc(newService->config.window, sizeof(gs_decode_slot_t));
+  if (newService->slots == NULL) {
+    free(newService);
+    return GS_ERR_CODE_MALLOC_FAILED;
+  }
+
+  pthread_mutex_init(&newService->lock, NULL);
+  pthread_cond_init(&newService->jobReady, NULL);
+  pthread_cond_init(&newService->slotDelivered, NULL);
+  ax25FrameExtractorInit(&newService->extractor);
+
+  for (uint32_t i = 0; i < config->numWorkers; i++) {
+    if (pthread_create(&newService->workers[i], NULL, decodeWorker, newService) != 0) {
+      gsDecodeServiceDestroy(newService);
+      return GS_ERR_CODE_THREAD_CREATE_FAILURE;
+    }
+    newService->numWorkersStarted++;
+  }
+
+  *service = newService;
+  return GS_ERR_CODE_SUCCESS;
+}
+
+gs_error_code_t gsDecodeServicePush(gs_decode_service_t *service, const uint8_t *data, uint32_t dataLen) {
+  if (service == NULL || data == NULL) {
+    return GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (ax25FrameExtractorPush(&service->extractor, data, dataLen, submitFrame, service) != OBC_GS_ERR_CODE_SUCCESS) {
+    return GS_ERR_CODE_INVALID_ARG;
+  }
+
+  pthread_mutex_lock(&service->lock);
+  service->stats.extractorOverflows = service->extractor.overflows;
+  pthread_mutex_unlock(&service->lock);
+
+  return GS_ERR_CODE_SUCCESS;
+}
+
+void gsDecodeServiceFlush(gs_decode_service_t *service) {
+  if (service == NULL) {
+    return;
+  }
+
+  pthread_mutex_lock(&service->lock);
+  while (service->nextDeliverSeq != service->nextSubmitSeq) {
+    pthread_cond_wait(&service->slotDelivered, &service->lock);
+  }
+  pthread_mutex_unlock(&service->lock);
+}
+
+void gsDecodeServiceGetStats(gs_decode_service_t *service, gs_decode_stats_t *stats) {
+  if (service == NULL || stats == NULL) {
+    return;
+  }
+
+  pthread_mutex_lock(&service->lock);
+  *stats = service->stats;
+  pthread_mutex_unlock(&service->lock);
+}
+
+void gsDecodeServiceDestroy(gs_decode_service_t *service) {
+  if (service == NULL) {
+    return;
+  }
+
+  // Workers only exit once no frames are left to take, and the last of them delivers what is still in order
+  stopWorkers(service);
+
+  pthread_cond_destroy(&service->slotDelivered);
+  pthread_cond_destroy(&service->jobReady);
+  pthread_mutex_destroy(&service->lock);
+  free(service->slots);
+  free(service);
+}
+
+static void stopWorkers(gs_decode_service_t *service) {
+  pthread_mutex_lock(&service->lock);
+  service->stopping = true;
+  pthread_cond_broadcast(&service->jobReady);
+  pthread_mutex_unlock(&service->lock);
+
+  for (uint32_t i = 0; i < service->numWorkersStarted; i++) {
+    pthread_join(service->workers[i], NULL);
+  }
+  service->numWorkersStarted = 0;
+}
+
+static void submitFrame(const uint8_t *frame, uint16_t frameLen, void *context) {
+  gs_decode_service_t *service = (gs_decode_service_t *)context;
+
+  pthread_mutex_lock(&service->lock);
+  while (service->nextSubmitSeq - service->nextDeliverSeq >= service->config.window) {
+    pthread_cond_wait(&service->slotDelivered, &service->lock);
+  }
+  uint64_t seq = service->nextSubmitSeq;
+  pthread_mutex_unlock(&service->lock);
+
+  // The slot is free and no worker looks at it until nextSubmitSeq passes it
+  gs_decode_slot_t *slot = &service->slots[seq % service->config.window];
+  memcpy(slot->frame, frame, frameLen);
+  slot->frameLen = frameLen;
+  slot->done = false;
+
+  pthread_mutex_lock(&service->lock);
+  service->nextSubmitSeq++;
+  service->stats.frames++;
+  pthread_cond_signal(&service->jobReady);
+  pthread_mutex_unlock(&service->lock);
+}
+
+static void *decodeWorker(void *arg) {
+  gs_decode_service_t *service = (gs_decode_service_t *)arg;
+  const uint32_t window = service->config.window;
+
+  pthread_mutex_lock(&service->lock);
+  while (true) {
+    while (service->nextJobSeq == service->nextSubmitSeq && !service->stopping) {
+      pthread_cond_wait(&service->jobReady, &service->lock);
+    }
+    if (service->nextJobSeq == service->nextSubmitSeq) {
+      break;
+    }
+
+    uint64_t seq = service->nextJobSeq++;
+    gs_decode_slot_t *slot = &service->slots[seq % window];
+    pthread_mutex_unlock(&service->lock);
+
+    slot->result.seq = seq;
+    decodeFrame(service, slot, &slot->result);
+
+    pthread_mutex_lock(&service->lock);
+    slot->done = true;
+
+    // Whoever completes the oldest outstanding frame delivers the run of done frames behind it. The callback runs
+    // without the lock so the other workers keep decoding meanwhile.
+    if (service->delivering) {
+      continue;
+    }
+    service->delivering = true;
+    while (service->nextDeliverSeq != service->nextSubmitSeq && service->slots[service->nextDeliverSeq % window].done) {
+      gs_decode_slot_t *next = &service->slots[service->nextDeliverSeq % window];
+      pthread_mutex_unlock(&service->lock);
+
+      service->config.callback(&next->result, service->config.context);
+
+      pthread_mutex_lock(&service->lock);
+      if (next->result.status == GS_ERR_CODE_SUCCESS) {
+        service->stats.decoded++;
+      } else {
+        service->stats.failed++;
+      }
+      next->done = false;
+      service->nextDeliverSeq++;
+      pthread_cond_broadcast(&service->slotDelivered);
+    }
+    service->delivering = false;
+  }
+  pthread_mutex_unlock(&service->lock);
+
+  return NULL;
+}
+
+static void decodeFrame(const gs_decode_service_t *service, const gs_decode_slot_t *slot, gs_decoded_frame_t *result) {
+  result->status = GS_ERR_CODE_SUCCESS;
+  result->isInfoFrame = false;
+  result->payloadLen = 0;
+  result->numTelemetry = 0;
+
+  unstuffed_ax25_i_frame_t unstuffedPacket;
+  rs_erasure_hints_t erasureHints;
+  if (ax25UnstuffWithErasureHints(slot->frame, slot->frameLen, NULL, 0, &unstuffedPacket, &erasureHints) !=
+      OBC_GS_ERR_CODE_SUCCESS) {
+    result->status = GS_ERR_CODE_AX25_DECODE_FAILURE;
+    return;
+  }
+
+  uint8_t decoded[RS_DECODED_SIZE];
+  if (unstuffedPacket.length == AX25_MINIMUM_I_FRAME_LEN) {
+    result->isInfoFrame = true;
+
+    packed_rs_packet_t rsData;
+    memcpy(rsData.data, unstuffedPacket.data + AX25_INFO_FIELD_POSITION, RS_ENCODED_SIZE);
+    if (rsDecodeWithErasureHints(&rsData, &erasureHints, decoded, RS_DECODED_SIZE, NULL) != OBC_GS_ERR_CODE_SUCCESS) {
+      result->status = GS_ERR_CODE_CORRUPTED_MSG;
+      return;
+    }
+    // The FCS covers the corrected codeword, parity included
+    memcpy(unstuffedPacket.data + AX25_INFO_FIELD_POSITION, rsData.data, RS_ENCODED_SIZE);
+  }
+
+  if (ax25CheckFrame(&unstuffedPacket) != OBC_GS_ERR_CODE_SUCCESS) {
+    result->status = GS_ERR_CODE_INVALID_AX25_FRAME;
+    return;
+  }
+
+  if (!result->isInfoFrame) {
+    return;
+  }
+
+  result->payloadLen = RS_DECODED_SIZE;
+  memcpy(result->payload, decoded, RS_DECODED_SIZE);
+  if (service->decrypt) {
+    // As in uplink_decoder, all of the decoded bytes are CTR mode ciphertext under the configured IV
+    struct AES_ctx ctx = service->aesCtx;
+    AES_CTR_xcrypt_buffer(&ctx, result->payload, RS_DECODED_SIZE);
+  }
+
+  if (service->config.unpackTelemetry &&
+      unpackTelemetryPacket(result->payload, result->payloadLen, result->telemetry, GS_DECODE_MAX_TELEMETRY,
+                            &result->numTelemetry) != OBC_GS_ERR_CODE_SUCCESS) {
+    result->status = GS_ERR_CODE_TELEMETRY_UNPACK_FAILURE;
+  }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "gs_errors.h"
+
+#include "obc_gs_aes128.h"
+#include "obc_gs_fec.h"
+#include "obc_gs_telemetry_data.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Decodes a received byte stream on a pool of worker threads. The caller pushes bytes as they arrive; the service
+ * splits them into AX.25 frames and hands each frame to a worker, which runs
+ *   unstuff -> RS decode -> FCS check -> AES decrypt (only if a key is configured) -> telemetry unpack
+ * Frames are numbered in the order they appear in the stream and results are delivered strictly in that order, one at
+ * a time, whichever worker finishes them.
+ */
+
+#define GS_DECODE_MAX_WORKERS 16U
+#define GS_DECODE_DEFAULT_WINDOW 64U
+
+// Every item of a telemetry packet takes at least two bytes
+#define GS_DECODE_MAX_TELEMETRY (RS_DECODED_SIZE / 2U)
+
+typedef struct {
+  uint64_t seq;            // Position of the frame in the stream, counting from 0
+  gs_error_code_t status;  // GS_ERR_CODE_SUCCESS, or the stage that rejected the frame
+  bool isInfoFrame;        // False for U and S frames, which carry no payload
+  uint8_t payload[RS_DECODED_SIZE];
+  uint8_t payloadLen;  // RS_DECODED_SIZE for I frames, 0 otherwise
+  telemetry_data_t telemetry[GS_DECODE_MAX_TELEMETRY];
+  uint32_t numTelemetry;
+} gs_decoded_frame_t;
+
+/**
+ * @brief called once per frame, in stream order; never called by two threads at once
+ *
+ * @param frame the decoded frame; only valid for the duration of the call
+ * @param context the context pointer from the config
+ */
+typedef void (*gs_decode_callback_t)(const gs_decoded_frame_t *frame, void *context);
+
+typedef struct {
+  uint32_t numWorkers;    // 1 to GS_DECODE_MAX_WORKERS
+  uint32_t window;        // Frames in flight before gsDecodeServicePush blocks; 0 for GS_DECODE_DEFAULT_WINDOW
+  const uint8_t *aesKey;  // AES_KEY_SIZE bytes, or NULL if the payload is not encrypted
+  const uint8_t *aesIv;   // CTR mode IV, the same for every frame; required with aesKey
+  bool unpackTelemetry;   // Unpack the payload of I frames as a telemetry packet
+  gs_decode_callback_t callback;
+  void *context;
+} gs_decode_config_t;
+
+typedef struct {
+  uint64_t frames;              // Frames found in the stream
+  uint64_t decoded;             // Frames delivered with GS_ERR_CODE_SUCCESS
+  uint64_t failed;              // Frames delivered with any other status
+  uint32_t extractorOverflows;  // Frames dropped for being too long to be AX.25
+} gs_decode_stats_t;
+
+typedef struct gs_decode_service gs_decode_service_t;
+
+/**
+ * @brief starts the worker threads
+ *
+ * @param config the service configuration; the key is copied
+ * @param service set to the new service
+ * @return gs_error_code_t - GS_ERR_CODE_INVALID_ARG for a bad config, GS_ERR_CODE_MALLOC_FAILED or
+ * GS_ERR_CODE_THREAD_CREATE_FAILURE if the service could not be set up
+ */
+gs_error_code_t gsDecodeServiceCreate(const gs_decode_config_t *config, gs_decode_service_t **service);
+
+/**
+ * @brief splits received bytes into frames and queues them for the workers
+ *
+ * Only one thread may push at a time. Blocks while the window is full, so a slow callback slows the reader down
+ * rather than dropping frames.
+ *
+ * @param service the service
+ * @param data the received bytes
+ * @param dataLen number of bytes in data
+ * @return gs_error_code_t - GS_ERR_CODE_INVALID_ARG if a pointer is NULL
+ */
+gs_error_code_t gsDecodeServicePush(gs_decode_service_t *service, const uint8_t *data, uint32_t dataLen);
+
+/**
+ * @brief waits until every frame found so far has been delivered
+ *
+ * @param service the service
+ */
+void gsDecodeServiceFlush(gs_decode_service_t *service);
+
+/**
+ * @brief gets the frame counts so far
+ *
+ * @param service the service
+ * @param stats set to the counts
+ */
+void gsDecodeServiceGetStats(gs_decode_service_t *service, gs_decode_stats_t *stats);
+
+/**
+ * @brief delivers the frames still in flight, then stops the workers and frees the service
+ *
+ * @param service the service; may be NULL
+ */
+void gsDecodeServiceDestroy(gs_decode_service_t *service);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,6 +7,7 @@
 
 #include "obc_gs_aes128.h"
 #include "obc_gs_ax25.h"
+#include "obc_gs_erasure_hints.h"
 #include "obc_gs_fec.h"
 
 #include <aes.h>
@@ -161,6 +162,7 @@ int main(void) {
   AES_ctx_set_iv(&ctx, iv);
 
   rsGs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  initRs();
 
   uint32_t cmdPacketOffset = 0;
 
@@ -281,9 +283,10 @@ int main(void) {
 static gs_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_packet_t *rsData) {
   obc_gs_error_code_t interfaceErr;
 
-  // perform bit unstuffing
+  // perform bit unstuffing, noting which bytes of the info field broke the stuffing rules
   unstuffed_ax25_i_frame_t unstuffedPacket = {0};
-  interfaceErr = ax25Unstuff(ax25Data->data, ax25Data->length, unstuffedPacket.data, &unstuffedPacket.length);
+  rs_erasure_hints_t erasureHints;
+  interfaceErr = ax25UnstuffWithErasureHints(ax25Data->data, ax25Data->length, NULL, 0, &unstuffedPacket, &erasureHints);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
     return GS_ERR_CODE_AX25_DECODE_FAILURE;
   }
@@ -294,12 +297,14 @@ static gs_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_p
     // clear the info field of the unstuffed packet
     memset(unstuffedPacket.data + AX25_INFO_FIELD_POSITION, 0, RS_ENCODED_SIZE);
     // decode the info field and store it in the unstuffed packet
-    uint8_t decodedLength = correct_reed_solomon_decode(rsGs, rsData->data, RS_ENCODED_SIZE,
-                                                        unstuffedPacket.data + AX25_INFO_FIELD_POSITION);
-
-    if (decodedLength == -1) {
+    interfaceErr = rsDecodeWithErasureHints(rsData, &erasureHints, unstuffedPacket.data + AX25_INFO_FIELD_POSITION,
+                                            RS_DECODED_SIZE, NULL);
+    if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
       return GS_ERR_CODE_CORRUPTED_MSG;
     }
+    // restore the corrected parity bytes too so the FCS check sees the frame that was sent
+    memcpy(unstuffedPacket.data + AX25_INFO_FIELD_POSITION + RS_DECODED_SIZE, rsData->data + RS_DECODED_SIZE,
+           RS_ENCODED_SIZE - RS_DECODED_SIZE);
   }
 
   // check for a valid ax25 frame and perform the command response if necessary
@@ -22,6 +22,7 @@ from interfaces.obc_gs_interface.commands import (
     create_cmd_end_of_frame,
     create_cmd_erase_app,
     create_cmd_exec_obc_reset,
+    create_cmd_gnc_timing_stats,
     create_cmd_i2c_probe,
     create_cmd_mirco_sd_format,
     create_cmd_ping,
@@ -30,7 +31,10 @@ from interfaces.obc_gs_interface.commands import (
     create_cmd_uplink_disc,
     create_cmd_verify_crc,
 )
-from interfaces.obc_gs_interface.commands.command_response_callbacks import parse_command_response
+from interfaces.obc_gs_interface.commands.command_response_callbacks import (
+    parse_command_response,
+    parse_command_responses,
+)
 from interfaces.obc_gs_interface.commands.command_response_classes import CmdRes
 
 # This is a constant value set in the python and OBC side as to what length of I Frame the OBC will be waiting to
@@ -257,6 +261,7 @@ def generate_command(args: str) -> tuple[CmdMsg | None, bool]:
         create_cmd_download_data,
         create_cmd_verify_crc,
         create_cmd_i2c_probe,
+        create_cmd_gnc_timing_stats,
     ]
 
     # Loop through each of the specific parses and see if we get a valid parse on any of them
@@ -364,7 +369,8 @@ def poll(
                 rcv_frame = comms.decode_frame(rcv_frame_bytes)
                 # TODO: Handle these return frames
                 if rcv_frame is not None and rcv_frame.data is not None:
-                    command_res = parse_command_response(bytes(rcv_frame.data[:RS_DECODED_DATA_SIZE]))
+                    # Responses to alarms that fire together may share one frame
+                    command_res = parse_command_responses(bytes(rcv_frame.data[:RS_DECODED_DATA_SIZE]))
 
                 data_string = outer_bytes_left.decode("utf-8") + str(command_res) + outer_bytes_right.decode("utf-8")
                 print("Time Tagged Command Response:")
@@ -1,99 +1,365 @@
 #include "logsink.h"
 #include <errno.h>
-#include <wiringPi.h>
-#include <wiringSerial.h>
+#include <fcntl.h>
 #include <poll.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
 #include <iostream>
-#include <ctime>
-#include <stdexcept>
 
-LogSink::LogSink(std::string uartPort, int baudRate, std::string outputFile) {
-  m_fileName = outputFile;
-  m_outputFile.open(m_fileName);
-  if (!m_outputFile.is_open()) {
+#define ARENA_MASK (LOGSINK_ARENA_SIZE - 1U)
+#define SLICE_MASK (LOGSINK_NUM_SLICES - 1U)
+#define NS_PER_SEC 1000000000LL
+
+static_assert((LOGSINK_ARENA_SIZE & ARENA_MASK) == 0, "LOGSINK_ARENA_SIZE must be a power of two");
+static_assert((LOGSINK_NUM_SLICES & SLICE_MASK) == 0, "LOGSINK_NUM_SLICES must be a power of two");
+static_assert(LOGSINK_ARENA_SIZE > 2 * (LOGSINK_PREFIX_LENGTH + LOGSINK_MAX_LINE_LENGTH + 1),
+              "The arena must hold at least two of the longest lines");
+
+static int64_t clockNs(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return (int64_t)ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+}
+
+static void putTwoDigits(char *out, int value) {
+  out[0] = '0' + value / 10;
+  out[1] = '0' + value % 10;
+}
+
+static speed_t baudToSpeed(int baudRate) {
+  switch (baudRate) {
+    case 9600:
+      return B9600;
+    case 19200:
+      return B19200;
+    case 38400:
+      return B38400;
+    case 57600:
+      return B57600;
+    case 115200:
+      return B115200;
+    case 230400:
+      return B230400;
+    case 460800:
+      return B460800;
+    case 921600:
+      return B921600;
+    default:
+      return B0;
+  }
+}
+
+// Raw 8N1, the same settings wiringPi's serialOpen uses
+static int openSerial(const std::string &uartPort, int baudRate) {
+  speed_t speed = baudToSpeed(baudRate);
+  if (speed == B0) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  int fd = open(uartPort.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0) {
+    return -1;
+  }
+
+  struct termios options;
+  if (tcgetattr(fd, &options) != 0) {
+    close(fd);
+    return -1;
+  }
+  cfmakeraw(&options);
+  cfsetispeed(&options, speed);
+  cfsetospeed(&options, speed);
+  options.c_cflag |= CLOCAL | CREAD;
+  if (tcsetattr(fd, TCSANOW, &options) != 0) {
+    close(fd);
+    return -1;
+  }
+  tcflush(fd, TCIOFLUSH);
+
+  return fd;
+}
+
+LogSink::LogSink(std::string uartPort, int baudRate, std::string outputFile)
+    : m_arena(LOGSINK_ARENA_SIZE), m_slices(LOGSINK_NUM_SLICES), m_fileName(outputFile) {
+  int outputFd = open(m_fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (outputFd < 0) {
     std::cerr << "Could Not Open File. Errno " << errno << std::endl;
     return;
   }
-  m_outputFile.close();
-  m_serialFd = serialOpen(uartPort.c_str(), baudRate);
+  close(outputFd);
+
+  m_serialFd = openSerial(uartPort, baudRate);
   if (m_serialFd == -1) {
     std::cerr << "Could not open UART Port. Errno " << errno << std::endl;
     return;
   }
-  m_isRunning = false;
 }
+
 LogSink::~LogSink() {
-  if (m_isRunning) {
-    stop();
+  stop();
+  if (m_serialFd >= 0) {
+    close(m_serialFd);
+  }
+}
+
+/*
+ * The prefix is derived from the monotonic clock, read once per read(), so lines stay in order if the wall clock is
+ * stepped while logging (e.g. NTP on a Pi without an RTC). It is only reformatted when the second changes.
+ */
+void LogSink::updatePrefix(int64_t monoNs) {
+  int64_t second = (m_wallStartNs + (monoNs - m_monoStartNs)) / NS_PER_SEC;
+  if (second == m_prefixSecond) {
+    return;
+  }
+  m_prefixSecond = second;
+
+  time_t rawTime = (time_t)second;
+  struct tm timeInfo;
+  localtime_r(&rawTime, &timeInfo);
+  int hour = timeInfo.tm_hour % 12;
+  memcpy(m_prefix, "[00:00:00 AM] ", sizeof(m_prefix));
+  putTwoDigits(&m_prefix[1], (hour == 0) ? 12 : hour);
+  putTwoDigits(&m_prefix[4], timeInfo.tm_min);
+  putTwoDigits(&m_prefix[7], timeInfo.tm_sec);
+  m_prefix[10] = (timeInfo.tm_hour < 12) ? 'A' : 'P';
+}
+
+void LogSink::copyToArena(const char *data, uint32_t len) {
+  uint32_t offset = m_arenaHead & ARENA_MASK;
+  uint32_t first = (len < LOGSINK_ARENA_SIZE - offset) ? len : LOGSINK_ARENA_SIZE - offset;
+  memcpy(&m_arena[offset], data, first);
+  memcpy(&m_arena[0], data + first, len - first);
+  m_arenaHead += len;
+}
+
+void LogSink::pushSlice(uint32_t start, uint32_t length) {
+  m_slices[m_pendingSliceHead & SLICE_MASK] = {start, length};
+  m_pendingSliceHead++;
+  if (length != 0) {
+    m_lines.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void LogSink::publishSlices() {
+  if (m_pendingSliceHead == m_sliceHead.load(std::memory_order_relaxed)) {
+    return;
   }
-  serialClose(m_serialFd);
-  m_outputFile.close();
+  m_sliceHead.store(m_pendingSliceHead, std::memory_order_release);
+  m_sliceHead.notify_one();
 }
+
+// Waits until the ring has a free slice and the arena has arenaBytes free
+void LogSink::waitForSpace(uint32_t arenaBytes) {
+  while (true) {
+    uint32_t sliceTail = m_sliceTail.load(std::memory_order_acquire);
+    uint32_t arenaTail = m_arenaTail.load(std::memory_order_relaxed);
+    if (m_pendingSliceHead - sliceTail < LOGSINK_NUM_SLICES &&
+        LOGSINK_ARENA_SIZE - (m_arenaHead - arenaTail) >= arenaBytes) {
+      return;
+    }
+
+    // The writer can only free space once it has seen the slices held back so far
+    m_readWaits.fetch_add(1, std::memory_order_relaxed);
+    publishSlices();
+    m_sliceTail.wait(sliceTail, std::memory_order_acquire);
+  }
+}
+
+void LogSink::appendBytes(const char *data, uint32_t len) {
+  while (len > 0) {
+    if (m_lineLength == 0) {
+      // Room for the whole line up front, so the bytes below never have to wait
+      waitForSpace(LOGSINK_PREFIX_LENGTH + LOGSINK_MAX_LINE_LENGTH + 1);
+      m_lineStart = m_arenaHead;
+      copyToArena(m_prefix, LOGSINK_PREFIX_LENGTH);
+    }
+
+    uint32_t room = LOGSINK_MAX_LINE_LENGTH - m_lineLength;
+    uint32_t take = (len < room) ? len : room;
+    const char *newline = static_cast<const char *>(memchr(data, '\n', take));
+    if (newline != NULL) {
+      take = newline - data + 1;
+    }
+
+    copyToArena(data, take);
+    m_lineLength += take;
+    data += take;
+    len -= take;
+
+    if (newline != NULL || m_lineLength == LOGSINK_MAX_LINE_LENGTH) {
+      if (newline == NULL) {
+        copyToArena("\n", 1);
+      }
+      pushSlice(m_lineStart, m_arenaHead - m_lineStart);
+      m_lineLength = 0;
+    }
+  }
+}
+
 void LogSink::uartReadThread() {
-  std::string buffer = "";
-  struct pollfd uartWait;
-  uartWait.fd = m_serialFd;
-  uartWait.events = POLLIN;
-  time_t rawTime;
-  struct tm* timeInfo;
-  char timer[80];
-  std::string times;
-
-  while (m_isRunning) {
-    int ret = poll(&uartWait, 1, -1);
-    if (ret != 1) continue;
-    int bytesAvailable = serialDataAvail(m_serialFd);
-    if (bytesAvailable < 0) {
-      throw std::runtime_error("Couldn't Read Data, Errno " + std::to_string(errno));
+  struct pollfd fds[2] = {{m_serialFd, POLLIN, 0}, {m_wakePipe[0], POLLIN, 0}};
+
+  while (m_isRunning.load(std::memory_order_relaxed)) {
+    if (poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) continue;
+      std::cerr << "Couldn't Poll UART Port, Errno " << errno << std::endl;
+      break;
+    }
+    if (fds[1].revents != 0) break;
+
+    ssize_t len = read(m_serialFd, m_readBuffer, sizeof(m_readBuffer));
+    if (len < 0 && (errno == EAGAIN || errno == EINTR)) continue;
+    if (len <= 0) {
+      std::cerr << "Couldn't Read Data, Errno " << errno << std::endl;
+      break;
     }
-    for (int i = 0; i < bytesAvailable; i++) {
-      char character = serialGetchar(m_serialFd);
-      buffer += character;
-      if (character != '\n') continue;
-      time(&rawTime);
-      timeInfo = localtime(&rawTime);
-      strftime(timer, 80, "[%r]", timeInfo);
-      times = timer;
-      buffer = times + " " + buffer;
-
-      m_queueLock.lock();
-      m_logQueue.push(buffer);
-      m_queueLock.unlock();
-      buffer = "";
-      m_queueSemaphore.release();
+
+    m_reads.fetch_add(1, std::memory_order_relaxed);
+    updatePrefix(clockNs(CLOCK_MONOTONIC));
+    appendBytes(m_readBuffer, static_cast<uint32_t>(len));
+    publishSlices();
+  }
+
+  // Keep a line that was cut off by stop() rather than dropping it
+  if (m_lineLength != 0) {
+    copyToArena("\n", 1);
+    pushSlice(m_lineStart, m_arenaHead - m_lineStart);
+    m_lineLength = 0;
+  }
+
+  waitForSpace(0);
+  pushSlice(m_arenaHead, 0);
+  publishSlices();
+
+  // Also reached on a poll or read error, which ends the log without a call to stop()
+  m_isRunning = false;
+}
+
+// Writes arena bytes [start, start + len), which may wrap around the end of the arena
+bool LogSink::writeArena(uint32_t start, uint32_t len) {
+  while (len > 0) {
+    uint32_t offset = start & ARENA_MASK;
+    uint32_t first = (len < LOGSINK_ARENA_SIZE - offset) ? len : LOGSINK_ARENA_SIZE - offset;
+    struct iovec iov[2] = {{&m_arena[offset], first}, {&m_arena[0], len - first}};
+
+    ssize_t written = writev(m_outputFd, iov, (first < len) ? 2 : 1);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      std::cerr << "Couldn't Write Logs, Errno " << errno << std::endl;
+      return false;
     }
-    m_queueSemaphore.release();
+
+    m_writes.fetch_add(1, std::memory_order_relaxed);
+    m_bytes.fetch_add(written, std::memory_order_relaxed);
+    start += written;
+    len -= written;
   }
+  return true;
 }
 
 void LogSink::writeFileThread() {
-  while (m_isRunning) {
-    m_queueSemaphore.acquire();
-
-    if (!m_logQueue.empty()) {
-      m_queueLock.lock();
-      std::string temp = m_logQueue.front();
-      m_logQueue.pop();
-      m_queueLock.unlock();
-      // std::cout<<temp;
-      m_outputFile << temp;
+  uint32_t tail = m_sliceTail.load(std::memory_order_relaxed);
+  bool done = false;
+
+  while (!done) {
+    uint32_t head = m_sliceHead.load(std::memory_order_acquire);
+    if (head == tail) {
+      m_sliceHead.wait(tail, std::memory_order_acquire);
+      continue;
     }
+
+    // Slices are contiguous in the arena, so everything published so far goes out in one write
+    uint32_t start = m_slices[tail & SLICE_MASK].start;
+    uint32_t end = start;
+    for (; tail != head && !done; tail++) {
+      const LogSlice &slice = m_slices[tail & SLICE_MASK];
+      end = slice.start + slice.length;
+      done = (slice.length == 0);
+    }
+
+    // Lines that cannot be written are dropped so the read thread never waits on a broken file
+    writeArena(start, end - start);
+
+    m_arenaTail.store(end, std::memory_order_relaxed);
+    m_sliceTail.store(tail, std::memory_order_release);
+    m_sliceTail.notify_one();
   }
 }
+
 int LogSink::start() {
-  m_outputFile.open(m_fileName);
+  if (m_isRunning || m_serialFd < 0) {
+    return -1;
+  }
+
+  // Reaps the threads of a log that ended on a UART error
+  stop();
+
+  m_outputFd = open(m_fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (m_outputFd < 0) {
+    std::cerr << "Could Not Open File. Errno " << errno << std::endl;
+    return -1;
+  }
+  if (pipe(m_wakePipe) != 0) {
+    std::cerr << "Could Not Create Pipe. Errno " << errno << std::endl;
+    close(m_outputFd);
+    m_outputFd = -1;
+    return -1;
+  }
+
+  m_sliceHead = 0;
+  m_sliceTail = 0;
+  m_arenaTail = 0;
+  m_pendingSliceHead = 0;
+  m_arenaHead = 0;
+  m_lineLength = 0;
+  m_prefixSecond = -1;
+  m_lines = 0;
+  m_bytes = 0;
+  m_reads = 0;
+  m_writes = 0;
+  m_readWaits = 0;
+
+  m_wallStartNs = clockNs(CLOCK_REALTIME);
+  m_monoStartNs = clockNs(CLOCK_MONOTONIC);
+
   m_isRunning = true;
   m_readThread = std::thread(&LogSink::uartReadThread, this);
   m_writeThread = std::thread(&LogSink::writeFileThread, this);
 
   return 0;
 }
+
 int LogSink::stop() {
+  // The threads are only joined here, even if the read thread has already stopped on its own
+  if (!m_readThread.joinable()) {
+    return 0;
+  }
+
   m_isRunning = false;
+  char wake = 0;
+  if (write(m_wakePipe[1], &wake, 1) != 1) {
+    std::cerr << "Couldn't Wake Read Thread, Errno " << errno << std::endl;
+  }
+
+  // The read thread hands the writer an end of log slice on the way out
   m_readThread.join();
   m_writeThread.join();
-  m_outputFile.close();
+
+  close(m_wakePipe[0]);
+  close(m_wakePipe[1]);
+  close(m_outputFd);
+  m_wakePipe[0] = m_wakePipe[1] = m_outputFd = -1;
   return 0;
 }
 
 bool LogSink::isRunning() const { return m_isRunning; }
+
+LogSinkStats LogSink::getStats() const {
+  return {m_lines.load(std::memory_order_relaxed), m_bytes.load(std::memory_order_relaxed),
+          m_reads.load(std::memory_order_relaxed), m_writes.load(std::memory_order_relaxed),
+          m_readWaits.load(std::memory_order_relaxed)};
+}
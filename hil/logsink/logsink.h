@@ -1,30 +1,91 @@
-#include <semaphore>
-#include <queue>
-#include <thread>
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
 #include <string>
-#include <fstream>
-#include <wiringPi.h>
-#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Copies every line a UART prints into a file, prefixed with the time it started to arrive, e.g.
+ * "[03:14:15 PM] obc/app/drivers/sdcard/sdc_bdev.c:416 - 108".
+ *
+ * The read thread drains the port with bulk reads into a fixed buffer and copies each line, prefix included, into a
+ * byte arena. Finished lines are handed to the write thread through a single producer, single consumer ring of slices
+ * into that arena, and the write thread writes every slice that is ready with one writev. When the arena or the ring is
+ * full the read thread waits for the writer rather than dropping lines; the kernel keeps buffering the UART meanwhile.
+ */
+
+#define LOGSINK_READ_BUFFER_SIZE 4096U
+#define LOGSINK_ARENA_SIZE (1U << 18)  // Power of two
+#define LOGSINK_NUM_SLICES 4096U       // Power of two
+#define LOGSINK_MAX_LINE_LENGTH 1024U  // Longer lines are split
+#define LOGSINK_PREFIX_LENGTH 14U      // "[hh:mm:ss AM] "
+
+struct LogSinkStats {
+  uint64_t lines;      // Lines handed to the write thread
+  uint64_t bytes;      // Bytes written to the file, prefixes included
+  uint64_t reads;      // read() calls that returned data
+  uint64_t writes;     // writev() calls
+  uint64_t readWaits;  // Times the read thread had to wait for the arena or the ring to drain
+};
 
 class LogSink {
  private:
-  int m_serialFd;
-  std::ofstream m_outputFile;
-  std::queue<std::string> m_logQueue;
-  std::mutex m_queueLock;
-  bool m_isRunning;
-  std::counting_semaphore<255> m_queueSemaphore{0};
+  struct LogSlice {
+    uint32_t start;   // Free running arena position
+    uint32_t length;  // 0 marks the end of the log
+  };
+
+  int m_serialFd = -1;
+  int m_outputFd = -1;
+  int m_wakePipe[2] = {-1, -1};
+  std::atomic<bool> m_isRunning{false};
   std::thread m_readThread;
   std::thread m_writeThread;
 
+  std::vector<char> m_arena;
+  std::vector<LogSlice> m_slices;
+  std::atomic<uint32_t> m_sliceHead{0};  // Published by the read thread
+  std::atomic<uint32_t> m_sliceTail{0};  // Published by the write thread
+  std::atomic<uint32_t> m_arenaTail{0};  // End of the last slice written, stored before m_sliceTail
+
+  // Only touched by the read thread
+  char m_readBuffer[LOGSINK_READ_BUFFER_SIZE];
+  uint32_t m_pendingSliceHead = 0;
+  uint32_t m_arenaHead = 0;
+  uint32_t m_lineStart = 0;
+  uint32_t m_lineLength = 0;  // Bytes of the current line after its prefix; 0 when between lines
+  int64_t m_prefixSecond = -1;
+  char m_prefix[LOGSINK_PREFIX_LENGTH + 1];
+
+  // Wall clock time at start(), paired with the monotonic time taken right after it
+  int64_t m_wallStartNs = 0;
+  int64_t m_monoStartNs = 0;
+
+  std::atomic<uint64_t> m_lines{0};
+  std::atomic<uint64_t> m_bytes{0};
+  std::atomic<uint64_t> m_reads{0};
+  std::atomic<uint64_t> m_writes{0};
+  std::atomic<uint64_t> m_readWaits{0};
+
   void uartReadThread();
   void writeFileThread();
 
+  void updatePrefix(int64_t monoNs);
+  void appendBytes(const char *data, uint32_t len);
+  void copyToArena(const char *data, uint32_t len);
+  void pushSlice(uint32_t start, uint32_t length);
+  void publishSlices();
+  void waitForSpace(uint32_t arenaBytes);
+  bool writeArena(uint32_t start, uint32_t len);
+
  public:
   std::string m_fileName;
   LogSink(std::string uartPort, int baudRate, std::string outputFile);
-  bool isRunning() const;
+  bool isRunning() const;  // False after stop() or once a UART error ends the log
   ~LogSink();
   int start();
   int stop();
+  LogSinkStats getStats() const;
 };
@@ -48,3 +48,17 @@ void packFloat(float value, uint8_t* buffer, uint32_t* offset) {
   memcpy(&tmp, &value, sizeof(tmp));
   packUint32(tmp, buffer, offset);
 }
+
+void packVarUint64(uint64_t value, uint8_t* buffer, uint32_t* offset) {
+  while (value >= 0x80U) {
+    buffer[(*offset)++] = (uint8_t)(value | 0x80U);
+    value >>= 7;
+  }
+  buffer[(*offset)++] = (uint8_t)value;
+}
+
+void packVarInt64(int64_t value, uint8_t* buffer, uint32_t* offset) {
+  // Zigzag: 0, -1, 1, -2, ... map to 0, 1, 2, 3, ...
+  uint64_t zigzag = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+  packVarUint64(zigzag, buffer, offset);
+}
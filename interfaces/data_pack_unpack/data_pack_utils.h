@@ -70,6 +70,28 @@ void packInt32(int32_t value, uint8_t* buffer, uint32_t* offset);
  */
 void packFloat(float value, uint8_t* buffer, uint32_t* offset);
 
+/* Largest packed size of a 64-bit varint */
+#define VARINT_MAX_SIZE 10U
+
+/**
+ * Packs an unsigned integer as a varint: 7 bits per byte, least significant group first, with the top bit of every
+ * byte but the last set. Values below 128 take one byte.
+ *
+ * @param value   The value to pack.
+ * @param buffer  The buffer to pack the value into; needs room for VARINT_MAX_SIZE bytes in the worst case.
+ * @param offset  A pointer to the offset within the buffer to pack the value at.
+ */
+void packVarUint64(uint64_t value, uint8_t* buffer, uint32_t* offset);
+
+/**
+ * Packs a signed integer as a zigzag varint, so values close to zero take few bytes whatever their sign.
+ *
+ * @param value   The value to pack.
+ * @param buffer  The buffer to pack the value into; needs room for VARINT_MAX_SIZE bytes in the worst case.
+ * @param offset  A pointer to the offset within the buffer to pack the value at.
+ */
+void packVarInt64(int64_t value, uint8_t* buffer, uint32_t* offset);
+
 #ifdef __cplusplus
 }
 #endif
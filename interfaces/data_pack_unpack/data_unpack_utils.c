@@ -36,3 +36,32 @@ float unpackFloat(const uint8_t* buffer, uint32_t* offset) {
 
   return val;
 }
+
+bool unpackVarUint64(const uint8_t* buffer, uint32_t bufferLen, uint32_t* offset, uint64_t* value) {
+  uint64_t result = 0;
+
+  for (uint32_t shift = 0; shift < 64; shift += 7) {
+    if (*offset >= bufferLen) {
+      return false;
+    }
+
+    uint8_t byte = buffer[(*offset)++];
+    result |= (uint64_t)(byte & 0x7FU) << shift;
+    if ((byte & 0x80U) == 0) {
+      *value = result;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool unpackVarInt64(const uint8_t* buffer, uint32_t bufferLen, uint32_t* offset, int64_t* value) {
+  uint64_t zigzag = 0;
+  if (!unpackVarUint64(buffer, bufferLen, offset, &zigzag)) {
+    return false;
+  }
+
+  *value = (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1U);
+  return true;
+}
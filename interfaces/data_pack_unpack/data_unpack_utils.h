@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -20,6 +21,12 @@ int32_t unpackInt32(const uint8_t* buffer, uint32_t* offset);
 
 float unpackFloat(const uint8_t* buffer, uint32_t* offset);
 
+/* Varints come from variable length data, so these check the end of the buffer and return false if the varint is
+ * cut off or too long for 64 bits */
+bool unpackVarUint64(const uint8_t* buffer, uint32_t bufferLen, uint32_t* offset, uint64_t* value);
+
+bool unpackVarInt64(const uint8_t* buffer, uint32_t bufferLen, uint32_t* offset, int64_t* value);
+
 #ifdef __cplusplus
 }
 #endif
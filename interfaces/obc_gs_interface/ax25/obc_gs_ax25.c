@@ -18,6 +18,16 @@
 #define AX25_ADDRESS_RESERVE_BIT_MASK 0b01100000
 #define AX25_ADDRESS_END_FLAG 0x01
 
+#define AX25_STUFF_TABLE_STATES 5U
+#define AX25_STUFF_ENTRY_BITS(entry) ((entry) & 0x3FFU)
+#define AX25_STUFF_ENTRY_BIT_COUNT(entry) ((((entry) >> 10) & 0x3U) + 8U)
+#define AX25_STUFF_ENTRY_STATE(entry) (((entry) >> 12) & 0x7U)
+
+#define AX25_UNSTUFF_TABLE_STATES 6U
+#define AX25_UNSTUFF_ENTRY_BITS(entry) ((entry) & 0xFFU)
+#define AX25_UNSTUFF_ENTRY_BIT_COUNT(entry) (((entry) >> 8) & 0xFU)
+#define AX25_UNSTUFF_ENTRY_STATE(entry) (((entry) >> 12) & 0x7U)
+
 static uint8_t pktSentNum = 0;
 static uint8_t pktReceiveNum = 0;
 
@@ -86,6 +96,28 @@ static void fcsCalculate(const uint8_t *data, uint16_t dataLen, uint16_t *calcul
  */
 static obc_gs_error_code_t fcsCheck(const uint8_t *data, uint16_t dataLen, uint16_t fcs);
 
+/**
+ * @brief table-driven unstuffing shared by ax25Unstuff and ax25UnstuffWithAnomalies
+ *
+ * @param unstuffedPacketCapacity size of unstuffedPacket, end flag included
+ * @param numAnomalies NULL to skip the stuffing rule check
+ *
+ * @return bool - false if the unstuffed frame would not fit in unstuffedPacketCapacity bytes
+ */
+static bool unstuffFrame(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+                         uint16_t unstuffedPacketCapacity, uint16_t *unstuffedPacketLen, uint16_t *anomalies,
+                         uint8_t maxAnomalies, uint8_t *numAnomalies);
+
+/**
+ * @brief checks whether a run of six or more 1s ends in a stuffed byte
+ *
+ * @param previousByte the stuffed byte received before byte
+ * @param byte the stuffed byte to check
+ *
+ * @return bool - true if the sender's stuffing rule was broken
+ */
+static bool hasStuffingViolation(uint8_t previousByte, uint8_t byte);
+
 obc_gs_error_code_t ax25SendIFrameWithFlagSharing(uint8_t *telemData, uint32_t telemDataLen, uint8_t *ax25Data,
                                                   uint32_t ax25DataLen, const ax25_addr_t *destAddress) {
   if (telemData == NULL) {
@@ -174,22 +206,44 @@ obc_gs_error_code_t ax25SendIFrame(uint8_t *telemData, uint8_t telemDataLen, uns
     pktReceiveNum = 0;
   }
 
+  obc_gs_error_code_t errCode = ax25BuildIFrame(telemData, telemDataLen, &currentLinkDestAddr, pktSentNum,
+                                                pktReceiveNum, ax25Data);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  pktSentNum++;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t ax25BuildIFrame(const uint8_t *telemData, uint8_t telemDataLen, const ax25_addr_t *destAddress,
+                                    uint8_t sendSeq, uint8_t receiveSeq, unstuffed_ax25_i_frame_t *ax25Data) {
+  if (telemData == NULL || destAddress == NULL || ax25Data == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (destAddress->length != AX25_DEST_ADDR_BYTES) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (sendSeq >= MAX_CONTINUOUS_PACKETS_ALLOWED || receiveSeq >= MAX_CONTINUOUS_PACKETS_ALLOWED) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
   memset(ax25Data->data, 0, AX25_MINIMUM_I_FRAME_LEN);
   ax25Data->length = AX25_MINIMUM_I_FRAME_LEN;
 
-  ax25Data->data[0] = AX25_FLAG;
-  // ax25Data->data[AX25_MINIMUM_I_FRAME_LEN - 1] = AX25_FLAG;
   ax25_addr_t srcAddr = {0};
   ax25GetSourceAddress(&srcAddr, GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID, DEFAULT_CONTROL_BIT);
-  memcpy(ax25Data->data + AX25_DEST_ADDR_POSITION, currentLinkDestAddr.data, AX25_DEST_ADDR_BYTES);
+  memcpy(ax25Data->data + AX25_DEST_ADDR_POSITION, destAddress->data, AX25_DEST_ADDR_BYTES);
   memcpy(ax25Data->data + AX25_SRC_ADDR_POSITION, srcAddr.data, AX25_SRC_ADDR_BYTES);
 
   // NOTE: We assume that the P bit is 0
-  ax25Data->data[AX25_CONTROL_BYTES_POSITION] = (pktReceiveNum << 5) | (pktSentNum << 1);
+  ax25Data->data[AX25_CONTROL_BYTES_POSITION] = (receiveSeq << 5) | (sendSeq << 1);
   ax25Data->data[AX25_MOD8_PID_POSITION] = AX25_PID;
 
   // NOTE: This is for the MOD128 Implementation
-  // ax25Data->data[AX25_CONTROL_BYTES_POSITION + 1] = (pktSentNum << 1);
+  // ax25Data->data[AX25_CONTROL_BYTES_POSITION + 1] = (sendSeq << 1);
   // ax25Data->data[AX25_MOD128_PID_POSITION] = AX25_PID;
   memcpy(ax25Data->data + AX25_INFO_FIELD_POSITION, telemData, telemDataLen);
 
@@ -201,20 +255,24 @@ obc_gs_error_code_t ax25SendIFrame(uint8_t *telemData, uint8_t telemDataLen, uns
   ax25Data->data[ax25Data->length - 1] = AX25_FLAG;
   ax25Data->data[0] = AX25_FLAG;
 
-  pktSentNum++;
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
 obc_gs_error_code_t ax25SendUFrame(packed_ax25_u_frame_t *ax25Data, uint8_t cmd, uint8_t pollFinalBit) {
+  return ax25BuildUFrame(ax25Data, &currentLinkDestAddr, cmd, pollFinalBit);
+}
+
+obc_gs_error_code_t ax25BuildUFrame(packed_ax25_u_frame_t *ax25Data, const ax25_addr_t *destAddress, uint8_t cmd,
+                                    uint8_t pollFinalBit) {
   if (cmd > MAX_U_FRAME_CMD_VALUE) {
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
 
-  if (ax25Data == NULL) {
+  if (ax25Data == NULL || destAddress == NULL) {
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
 
-  if (currentLinkDestAddr.length != AX25_DEST_ADDR_BYTES) {
+  if (destAddress->length != AX25_DEST_ADDR_BYTES) {
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
 
@@ -232,7 +290,7 @@ obc_gs_error_code_t ax25SendUFrame(packed_ax25_u_frame_t *ax25Data, uint8_t cmd,
 
   ax25_addr_t srcAddr = {0};
   ax25GetSourceAddress(&srcAddr, GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID, DEFAULT_CONTROL_BIT);
-  memcpy(ax25PacketUnstuffed + AX25_DEST_ADDR_POSITION, currentLinkDestAddr.data, AX25_DEST_ADDR_BYTES);
+  memcpy(ax25PacketUnstuffed + AX25_DEST_ADDR_POSITION, destAddress->data, AX25_DEST_ADDR_BYTES);
 
   memcpy(ax25PacketUnstuffed + AX25_SRC_ADDR_POSITION, srcAddr.data, AX25_SRC_ADDR_BYTES);
 
@@ -262,7 +320,7 @@ obc_gs_error_code_t ax25SendUFrame(packed_ax25_u_frame_t *ax25Data, uint8_t cmd,
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
-obc_gs_error_code_t ax25Recv(unstuffed_ax25_i_frame_t *unstuffedPacket, u_frame_cmd_t *command) {
+obc_gs_error_code_t ax25CheckFrame(const unstuffed_ax25_i_frame_t *unstuffedPacket) {
   if (unstuffedPacket == NULL) {
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
@@ -280,12 +338,14 @@ obc_gs_error_code_t ax25Recv(unstuffed_ax25_i_frame_t *unstuffedPacket, u_frame_
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
 
-  obc_gs_error_code_t errCode;
-
   // Check FCS
   uint16_t fcs = unstuffedPacket->data[unstuffedPacket->length - AX25_END_FLAG_BYTES - AX25_FCS_BYTES] << 8;
   fcs |= unstuffedPacket->data[unstuffedPacket->length - AX25_END_FLAG_BYTES - AX25_FCS_BYTES + 1];
-  errCode = fcsCheck(unstuffedPacket->data + 1, unstuffedPacket->length, fcs);
+  return fcsCheck(unstuffedPacket->data + 1, unstuffedPacket->length, fcs);
+}
+
+obc_gs_error_code_t ax25Recv(unstuffed_ax25_i_frame_t *unstuffedPacket, u_frame_cmd_t *command) {
+  obc_gs_error_code_t errCode = ax25CheckFrame(unstuffedPacket);
   if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
     return errCode;
   }
@@ -304,64 +364,237 @@ obc_gs_error_code_t ax25Recv(unstuffed_ax25_i_frame_t *unstuffedPacket, u_frame_
   return errCode;
 }
 
-obc_gs_error_code_t ax25Unstuff(uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+/*
+ * Byte-at-a-time bit unstuffing table, indexed by [state][stuffed byte].
+ * States 0-4 are the number of consecutive 1s carried in from the previous byte and state 5 means the first bit of
+ * the byte is a stuffed 0 that must be dropped. Each entry holds the unstuffed bits right aligned in bits 0-7, the
+ * number of unstuffed bits (6-8) in bits 8-11 and the state for the next byte in bits 12-14.
+ */
+static const uint16_t ax25UnstuffTable[AX25_UNSTUFF_TABLE_STATES][256] = {
+    {
+        0x0800U, 0x1801U, 0x0802U, 0x2803U, 0x0804U, 0x1805U, 0x0806U, 0x3807U, 0x0808U, 0x1809U, 0x080AU, 0x280BU,
+        0x080CU, 0x180DU, 0x080EU, 0x480FU, 0x0810U, 0x1811U, 0x0812U, 0x2813U, 0x0814U, 0x1815U, 0x0816U, 0x3817U,
+        0x0818U, 0x1819U, 0x081AU, 0x281BU, 0x081CU, 0x181DU, 0x081EU, 0x581FU, 0x0820U, 0x1821U, 0x0822U, 0x2823U,
+        0x0824U, 0x1825U, 0x0826U, 0x3827U, 0x0828U, 0x1829U, 0x082AU, 0x282BU, 0x082CU, 0x182DU, 0x082EU, 0x482FU,
+        0x0830U, 0x1831U, 0x0832U, 0x2833U, 0x0834U, 0x1835U, 0x0836U, 0x3837U, 0x0838U, 0x1839U, 0x083AU, 0x283BU,
+        0x083CU, 0x183DU, 0x071FU, 0x071FU, 0x0840U, 0x1841U, 0x0842U, 0x2843U, 0x0844U, 0x1845U, 0x0846U, 0x3847U,
+        0x0848U, 0x1849U, 0x084AU, 0x284BU, 0x084CU, 0x184DU, 0x084EU, 0x484FU, 0x0850U, 0x1851U, 0x0852U, 0x2853U,
+        0x0854U, 0x1855U, 0x0856U, 0x3857U, 0x0858U, 0x1859U, 0x085AU, 0x285BU, 0x085CU, 0x185DU, 0x085EU, 0x585FU,
+        0x0860U, 0x1861U, 0x0862U, 0x2863U, 0x0864U, 0x1865U, 0x0866U, 0x3867U, 0x0868U, 0x1869U, 0x086AU, 0x286BU,
+        0x086CU, 0x186DU, 0x086EU, 0x486FU, 0x0870U, 0x1871U, 0x0872U, 0x2873U, 0x0874U, 0x1875U, 0x0876U, 0x3877U,
+        0x0878U, 0x1879U, 0x087AU, 0x287BU, 0x073EU, 0x173FU, 0x073EU, 0x173FU, 0x0880U, 0x1881U, 0x0882U, 0x2883U,
+        0x0884U, 0x1885U, 0x0886U, 0x3887U, 0x0888U, 0x1889U, 0x088AU, 0x288BU, 0x088CU, 0x188DU, 0x088EU, 0x488FU,
+        0x0890U, 0x1891U, 0x0892U, 0x2893U, 0x0894U, 0x1895U, 0x0896U, 0x3897U, 0x0898U, 0x1899U, 0x089AU, 0x289BU,
+        0x089CU, 0x189DU, 0x089EU, 0x589FU, 0x08A0U, 0x18A1U, 0x08A2U, 0x28A3U, 0x08A4U, 0x18A5U, 0x08A6U, 0x38A7U,
+        0x08A8U, 0x18A9U, 0x08AAU, 0x28ABU, 0x08ACU, 0x18ADU, 0x08AEU, 0x48AFU, 0x08B0U, 0x18B1U, 0x08B2U, 0x28B3U,
+        0x08B4U, 0x18B5U, 0x08B6U, 0x38B7U, 0x08B8U, 0x18B9U, 0x08BAU, 0x28BBU, 0x08BCU, 0x18BDU, 0x075FU, 0x075FU,
+        0x08C0U, 0x18C1U, 0x08C2U, 0x28C3U, 0x08C4U, 0x18C5U, 0x08C6U, 0x38C7U, 0x08C8U, 0x18C9U, 0x08CAU, 0x28CBU,
+        0x08CCU, 0x18CDU, 0x08CEU, 0x48CFU, 0x08D0U, 0x18D1U, 0x08D2U, 0x28D3U, 0x08D4U, 0x18D5U, 0x08D6U, 0x38D7U,
+        0x08D8U, 0x18D9U, 0x08DAU, 0x28DBU, 0x08DCU, 0x18DDU, 0x08DEU, 0x58DFU, 0x08E0U, 0x18E1U, 0x08E2U, 0x28E3U,
+        0x08E4U, 0x18E5U, 0x08E6U, 0x38E7U, 0x08E8U, 0x18E9U, 0x08EAU, 0x28EBU, 0x08ECU, 0x18EDU, 0x08EEU, 0x48EFU,
+        0x08F0U, 0x18F1U, 0x08F2U, 0x28F3U, 0x08F4U, 0x18F5U, 0x08F6U, 0x38F7U, 0x077CU, 0x177DU, 0x077EU, 0x277FU,
+        0x077CU, 0x177DU, 0x077EU, 0x277FU,
+    },
+    {
+        0x0800U, 0x1801U, 0x0802U, 0x2803U, 0x0804U, 0x1805U, 0x0806U, 0x3807U, 0x0808U, 0x1809U, 0x080AU, 0x280BU,
+        0x080CU, 0x180DU, 0x080EU, 0x480FU, 0x0810U, 0x1811U, 0x0812U, 0x2813U, 0x0814U, 0x1815U, 0x0816U, 0x3817U,
+        0x0818U, 0x1819U, 0x081AU, 0x281BU, 0x081CU, 0x181DU, 0x081EU, 0x581FU, 0x0820U, 0x1821U, 0x0822U, 0x2823U,
+        0x0824U, 0x1825U, 0x0826U, 0x3827U, 0x0828U, 0x1829U, 0x082AU, 0x282BU, 0x082CU, 0x182DU, 0x082EU, 0x482FU,
+        0x0830U, 0x1831U, 0x0832U, 0x2833U, 0x0834U, 0x1835U, 0x0836U, 0x3837U, 0x0838U, 0x1839U, 0x083AU, 0x283BU,
+        0x083CU, 0x183DU, 0x071FU, 0x071FU, 0x0840U, 0x1841U, 0x0842U, 0x2843U, 0x0844U, 0x1845U, 0x0846U, 0x3847U,
+        0x0848U, 0x1849U, 0x084AU, 0x284BU, 0x084CU, 0x184DU, 0x084EU, 0x484FU, 0x0850U, 0x1851U, 0x0852U, 0x2853U,
+        0x0854U, 0x1855U, 0x0856U, 0x3857U, 0x0858U, 0x1859U, 0x085AU, 0x285BU, 0x085CU, 0x185DU, 0x085EU, 0x585FU,
+        0x0860U, 0x1861U, 0x0862U, 0x2863U, 0x0864U, 0x1865U, 0x0866U, 0x3867U, 0x0868U, 0x1869U, 0x086AU, 0x286BU,
+        0x086CU, 0x186DU, 0x086EU, 0x486FU, 0x0870U, 0x1871U, 0x0872U, 0x2873U, 0x0874U, 0x1875U, 0x0876U, 0x3877U,
+        0x0878U, 0x1879U, 0x087AU, 0x287BU, 0x073EU, 0x173FU, 0x073EU, 0x173FU, 0x0880U, 0x1881U, 0x0882U, 0x2883U,
+        0x0884U, 0x1885U, 0x0886U, 0x3887U, 0x0888U, 0x1889U, 0x088AU, 0x288BU, 0x088CU, 0x188DU, 0x088EU, 0x488FU,
+        0x0890U, 0x1891U, 0x0892U, 0x2893U, 0x0894U, 0x1895U, 0x0896U, 0x3897U, 0x0898U, 0x1899U, 0x089AU, 0x289BU,
+        0x089CU, 0x189DU, 0x089EU, 0x589FU, 0x08A0U, 0x18A1U, 0x08A2U, 0x28A3U, 0x08A4U, 0x18A5U, 0x08A6U, 0x38A7U,
+        0x08A8U, 0x18A9U, 0x08AAU, 0x28ABU, 0x08ACU, 0x18ADU, 0x08AEU, 0x48AFU, 0x08B0U, 0x18B1U, 0x08B2U, 0x28B3U,
+        0x08B4U, 0x18B5U, 0x08B6U, 0x38B7U, 0x08B8U, 0x18B9U, 0x08BAU, 0x28BBU, 0x08BCU, 0x18BDU, 0x075FU, 0x075FU,
+        0x08C0U, 0x18C1U, 0x08C2U, 0x28C3U, 0x08C4U, 0x18C5U, 0x08C6U, 0x38C7U, 0x08C8U, 0x18C9U, 0x08CAU, 0x28CBU,
+        0x08CCU, 0x18CDU, 0x08CEU, 0x48CFU, 0x08D0U, 0x18D1U, 0x08D2U, 0x28D3U, 0x08D4U, 0x18D5U, 0x08D6U, 0x38D7U,
+        0x08D8U, 0x18D9U, 0x08DAU, 0x28DBU, 0x08DCU, 0x18DDU, 0x08DEU, 0x58DFU, 0x08E0U, 0x18E1U, 0x08E2U, 0x28E3U,
+        0x08E4U, 0x18E5U, 0x08E6U, 0x38E7U, 0x08E8U, 0x18E9U, 0x08EAU, 0x28EBU, 0x08ECU, 0x18EDU, 0x08EEU, 0x48EFU,
+        0x0778U, 0x1779U, 0x077AU, 0x277BU, 0x077CU, 0x177DU, 0x077EU, 0x377FU, 0x0778U, 0x1779U, 0x077AU, 0x277BU,
+        0x077CU, 0x177DU, 0x077EU, 0x377FU,
+    },
+    {
+        0x0800U, 0x1801U, 0x0802U, 0x2803U, 0x0804U, 0x1805U, 0x0806U, 0x3807U, 0x0808U, 0x1809U, 0x080AU, 0x280BU,
+        0x080CU, 0x180DU, 0x080EU, 0x480FU, 0x0810U, 0x1811U, 0x0812U, 0x2813U, 0x0814U, 0x1815U, 0x0816U, 0x3817U,
+        0x0818U, 0x1819U, 0x081AU, 0x281BU, 0x081CU, 0x181DU, 0x081EU, 0x581FU, 0x0820U, 0x1821U, 0x0822U, 0x2823U,
+        0x0824U, 0x1825U, 0x0826U, 0x3827U, 0x0828U, 0x1829U, 0x082AU, 0x282BU, 0x082CU, 0x182DU, 0x082EU, 0x482FU,
+        0x0830U, 0x1831U, 0x0832U, 0x2833U, 0x0834U, 0x1835U, 0x0836U, 0x3837U, 0x0838U, 0x1839U, 0x083AU, 0x283BU,
+        0x083CU, 0x183DU, 0x071FU, 0x071FU, 0x0840U, 0x1841U, 0x0842U, 0x2843U, 0x0844U, 0x1845U, 0x0846U, 0x3847U,
+        0x0848U, 0x1849U, 0x084AU, 0x284BU, 0x084CU, 0x184DU, 0x084EU, 0x484FU, 0x0850U, 0x1851U, 0x0852U, 0x2853U,
+        0x0854U, 0x1855U, 0x0856U, 0x3857U, 0x0858U, 0x1859U, 0x085AU, 0x285BU, 0x085CU, 0x185DU, 0x085EU, 0x585FU,
+        0x0860U, 0x1861U, 0x0862U, 0x2863U, 0x0864U, 0x1865U, 0x0866U, 0x3867U, 0x0868U, 0x1869U, 0x086AU, 0x286BU,
+        0x086CU, 0x186DU, 0x086EU, 0x486FU, 0x0870U, 0x1871U, 0x0872U, 0x2873U, 0x0874U, 0x1875U, 0x0876U, 0x3877U,
+        0x0878U, 0x1879U, 0x087AU, 0x287BU, 0x073EU, 0x173FU, 0x073EU, 0x173FU, 0x0880U, 0x1881U, 0x0882U, 0x2883U,
+        0x0884U, 0x1885U, 0x0886U, 0x3887U, 0x0888U, 0x1889U, 0x088AU, 0x288BU, 0x088CU, 0x188DU, 0x088EU, 0x488FU,
+        0x0890U, 0x1891U, 0x0892U, 0x2893U, 0x0894U, 0x1895U, 0x0896U, 0x3897U, 0x0898U, 0x1899U, 0x089AU, 0x289BU,
+        0x089CU, 0x189DU, 0x089EU, 0x589FU, 0x08A0U, 0x18A1U, 0x08A2U, 0x28A3U, 0x08A4U, 0x18A5U, 0x08A6U, 0x38A7U,
+        0x08A8U, 0x18A9U, 0x08AAU, 0x28ABU, 0x08ACU, 0x18ADU, 0x08AEU, 0x48AFU, 0x08B0U, 0x18B1U, 0x08B2U, 0x28B3U,
+        0x08B4U, 0x18B5U, 0x08B6U, 0x38B7U, 0x08B8U, 0x18B9U, 0x08BAU, 0x28BBU, 0x08BCU, 0x18BDU, 0x075FU, 0x075FU,
+        0x08C0U, 0x18C1U, 0x08C2U, 0x28C3U, 0x08C4U, 0x18C5U, 0x08C6U, 0x38C7U, 0x08C8U, 0x18C9U, 0x08CAU, 0x28CBU,
+        0x08CCU, 0x18CDU, 0x08CEU, 0x48CFU, 0x08D0U, 0x18D1U, 0x08D2U, 0x28D3U, 0x08D4U, 0x18D5U, 0x08D6U, 0x38D7U,
+        0x08D8U, 0x18D9U, 0x08DAU, 0x28DBU, 0x08DCU, 0x18DDU, 0x08DEU, 0x58DFU, 0x0770U, 0x1771U, 0x0772U, 0x2773U,
+        0x0774U, 0x1775U, 0x0776U, 0x3777U, 0x0778U, 0x1779U, 0x077AU, 0x277BU, 0x077CU, 0x177DU, 0x077EU, 0x477FU,
+        0x0770U, 0x1771U, 0x0772U, 0x2773U, 0x0774U, 0x1775U, 0x0776U, 0x3777U, 0x0778U, 0x1779U, 0x077AU, 0x277BU,
+        0x077CU, 0x177DU, 0x077EU, 0x477FU,
+    },
+    {
+        0x0800U, 0x1801U, 0x0802U, 0x2803U, 0x0804U, 0x1805U, 0x0806U, 0x3807U, 0x0808U, 0x1809U, 0x080AU, 0x280BU,
+        0x080CU, 0x180DU, 0x080EU, 0x480FU, 0x0810U, 0x1811U, 0x0812U, 0x2813U, 0x0814U, 0x1815U, 0x0816U, 0x3817U,
+        0x0818U, 0x1819U, 0x081AU, 0x281BU, 0x081CU, 0x181DU, 0x081EU, 0x581FU, 0x0820U, 0x1821U, 0x0822U, 0x2823U,
+        0x0824U, 0x1825U, 0x0826U, 0x3827U, 0x0828U, 0x1829U, 0x082AU, 0x282BU, 0x082CU, 0x182DU, 0x082EU, 0x482FU,
+        0x0830U, 0x1831U, 0x0832U, 0x2833U, 0x0834U, 0x1835U, 0x0836U, 0x3837U, 0x0838U, 0x1839U, 0x083AU, 0x283BU,
+        0x083CU, 0x183DU, 0x071FU, 0x071FU, 0x0840U, 0x1841U, 0x0842U, 0x2843U, 0x0844U, 0x1845U, 0x0846U, 0x3847U,
+        0x0848U, 0x1849U, 0x084AU, 0x284BU, 0x084CU, 0x184DU, 0x084EU, 0x484FU, 0x0850U, 0x1851U, 0x0852U, 0x2853U,
+        0x0854U, 0x1855U, 0x0856U, 0x3857U, 0x0858U, 0x1859U, 0x085AU, 0x285BU, 0x085CU, 0x185DU, 0x085EU, 0x585FU,
+        0x0860U, 0x1861U, 0x0862U, 0x2863U, 0x0864U, 0x1865U, 0x0866U, 0x3867U, 0x0868U, 0x1869U, 0x086AU, 0x286BU,
+        0x086CU, 0x186DU, 0x086EU, 0x486FU, 0x0870U, 0x1871U, 0x0872U, 0x2873U, 0x0874U, 0x1875U, 0x0876U, 0x3877U,
+        0x0878U, 0x1879U, 0x087AU, 0x287BU, 0x073EU, 0x173FU, 0x073EU, 0x173FU, 0x0880U, 0x1881U, 0x0882U, 0x2883U,
+        0x0884U, 0x1885U, 0x0886U, 0x3887U, 0x0888U, 0x1889U, 0x088AU, 0x288BU, 0x088CU, 0x188DU, 0x088EU, 0x488FU,
+        0x0890U, 0x1891U, 0x0892U, 0x2893U, 0x0894U, 0x1895U, 0x0896U, 0x3897U, 0x0898U, 0x1899U, 0x089AU, 0x289BU,
+        0x089CU, 0x189DU, 0x089EU, 0x589FU, 0x08A0U, 0x18A1U, 0x08A2U, 0x28A3U, 0x08A4U, 0x18A5U, 0x08A6U, 0x38A7U,
+        0x08A8U, 0x18A9U, 0x08AAU, 0x28ABU, 0x08ACU, 0x18ADU, 0x08AEU, 0x48AFU, 0x08B0U, 0x18B1U, 0x08B2U, 0x28B3U,
+        0x08B4U, 0x18B5U, 0x08B6U, 0x38B7U, 0x08B8U, 0x18B9U, 0x08BAU, 0x28BBU, 0x08BCU, 0x18BDU, 0x075FU, 0x075FU,
+        0x0760U, 0x1761U, 0x0762U, 0x2763U, 0x0764U, 0x1765U, 0x0766U, 0x3767U, 0x0768U, 0x1769U, 0x076AU, 0x276BU,
+        0x076CU, 0x176DU, 0x076EU, 0x476FU, 0x0770U, 0x1771U, 0x0772U, 0x2773U, 0x0774U, 0x1775U, 0x0776U, 0x3777U,
+        0x0778U, 0x1779U, 0x077AU, 0x277BU, 0x077CU, 0x177DU, 0x077EU, 0x577FU, 0x0760U, 0x1761U, 0x0762U, 0x2763U,
+        0x0764U, 0x1765U, 0x0766U, 0x3767U, 0x0768U, 0x1769U, 0x076AU, 0x276BU, 0x076CU, 0x176DU, 0x076EU, 0x476FU,
+        0x0770U, 0x1771U, 0x0772U, 0x2773U, 0x0774U, 0x1775U, 0x0776U, 0x3777U, 0x0778U, 0x1779U, 0x077AU, 0x277BU,
+        0x077CU, 0x177DU, 0x077EU, 0x577FU,
+    },
+    {
+        0x0800U, 0x1801U, 0x0802U, 0x2803U, 0x0804U, 0x1805U, 0x0806U, 0x3807U, 0x0808U, 0x1809U, 0x080AU, 0x280BU,
+        0x080CU, 0x180DU, 0x080EU, 0x480FU, 0x0810U, 0x1811U, 0x0812U, 0x2813U, 0x0814U, 0x1815U, 0x0816U, 0x3817U,
+        0x0818U, 0x1819U, 0x081AU, 0x281BU, 0x081CU, 0x181DU, 0x081EU, 0x581FU, 0x0820U, 0x1821U, 0x0822U, 0x2823U,
+        0x0824U, 0x1825U, 0x0826U, 0x3827U, 0x0828U, 0x1829U, 0x082AU, 0x282BU, 0x082CU, 0x182DU, 0x082EU, 0x482FU,
+        0x0830U, 0x1831U, 0x0832U, 0x2833U, 0x0834U, 0x1835U, 0x0836U, 0x3837U, 0x0838U, 0x1839U, 0x083AU, 0x283BU,
+        0x083CU, 0x183DU, 0x071FU, 0x071FU, 0x0840U, 0x1841U, 0x0842U, 0x2843U, 0x0844U, 0x1845U, 0x0846U, 0x3847U,
+        0x0848U, 0x1849U, 0x084AU, 0x284BU, 0x084CU, 0x184DU, 0x084EU, 0x484FU, 0x0850U, 0x1851U, 0x0852U, 0x2853U,
+        0x0854U, 0x1855U, 0x0856U, 0x3857U, 0x0858U, 0x1859U, 0x085AU, 0x285BU, 0x085CU, 0x185DU, 0x085EU, 0x585FU,
+        0x0860U, 0x1861U, 0x0862U, 0x2863U, 0x0864U, 0x1865U, 0x0866U, 0x3867U, 0x0868U, 0x1869U, 0x086AU, 0x286BU,
+        0x086CU, 0x186DU, 0x086EU, 0x486FU, 0x0870U, 0x1871U, 0x0872U, 0x2873U, 0x0874U, 0x1875U, 0x0876U, 0x3877U,
+        0x0878U, 0x1879U, 0x087AU, 0x287BU, 0x073EU, 0x173FU, 0x073EU, 0x173FU, 0x0740U, 0x1741U, 0x0742U, 0x2743U,
+        0x0744U, 0x1745U, 0x0746U, 0x3747U, 0x0748U, 0x1749U, 0x074AU, 0x274BU, 0x074CU, 0x174DU, 0x074EU, 0x474FU,
+        0x0750U, 0x1751U, 0x0752U, 0x2753U, 0x0754U, 0x1755U, 0x0756U, 0x3757U, 0x0758U, 0x1759U, 0x075AU, 0x275BU,
+        0x075CU, 0x175DU, 0x075EU, 0x575FU, 0x0760U, 0x1761U, 0x0762U, 0x2763U, 0x0764U, 0x1765U, 0x0766U, 0x3767U,
+        0x0768U, 0x1769U, 0x076AU, 0x276BU, 0x076CU, 0x176DU, 0x076EU, 0x476FU, 0x0770U, 0x1771U, 0x0772U, 0x2773U,
+        0x0774U, 0x1775U, 0x0776U, 0x3777U, 0x0778U, 0x1779U, 0x077AU, 0x277BU, 0x077CU, 0x177DU, 0x063FU, 0x063FU,
+        0x0740U, 0x1741U, 0x0742U, 0x2743U, 0x0744U, 0x1745U, 0x0746U, 0x3747U, 0x0748U, 0x1749U, 0x074AU, 0x274BU,
+        0x074CU, 0x174DU, 0x074EU, 0x474FU, 0x0750U, 0x1751U, 0x0752U, 0x2753U, 0x0754U, 0x1755U, 0x0756U, 0x3757U,
+        0x0758U, 0x1759U, 0x075AU, 0x275BU, 0x075CU, 0x175DU, 0x075EU, 0x575FU, 0x0760U, 0x1761U, 0x0762U, 0x2763U,
+        0x0764U, 0x1765U, 0x0766U, 0x3767U, 0x0768U, 0x1769U, 0x076AU, 0x276BU, 0x076CU, 0x176DU, 0x076EU, 0x476FU,
+        0x0770U, 0x1771U, 0x0772U, 0x2773U, 0x0774U, 0x1775U, 0x0776U, 0x3777U, 0x0778U, 0x1779U, 0x077AU, 0x277BU,
+        0x077CU, 0x177DU, 0x063FU, 0x063FU,
+    },
+    {
+        0x0700U, 0x1701U, 0x0702U, 0x2703U, 0x0704U, 0x1705U, 0x0706U, 0x3707U, 0x0708U, 0x1709U, 0x070AU, 0x270BU,
+        0x070CU, 0x170DU, 0x070EU, 0x470FU, 0x0710U, 0x1711U, 0x0712U, 0x2713U, 0x0714U, 0x1715U, 0x0716U, 0x3717U,
+        0x0718U, 0x1719U, 0x071AU, 0x271BU, 0x071CU, 0x171DU, 0x071EU, 0x571FU, 0x0720U, 0x1721U, 0x0722U, 0x2723U,
+        0x0724U, 0x1725U, 0x0726U, 0x3727U, 0x0728U, 0x1729U, 0x072AU, 0x272BU, 0x072CU, 0x172DU, 0x072EU, 0x472FU,
+        0x0730U, 0x1731U, 0x0732U, 0x2733U, 0x0734U, 0x1735U, 0x0736U, 0x3737U, 0x0738U, 0x1739U, 0x073AU, 0x273BU,
+        0x073CU, 0x173DU, 0x061FU, 0x061FU, 0x0740U, 0x1741U, 0x0742U, 0x2743U, 0x0744U, 0x1745U, 0x0746U, 0x3747U,
+        0x0748U, 0x1749U, 0x074AU, 0x274BU, 0x074CU, 0x174DU, 0x074EU, 0x474FU, 0x0750U, 0x1751U, 0x0752U, 0x2753U,
+        0x0754U, 0x1755U, 0x0756U, 0x3757U, 0x0758U, 0x1759U, 0x075AU, 0x275BU, 0x075CU, 0x175DU, 0x075EU, 0x575FU,
+        0x0760U, 0x1761U, 0x0762U, 0x2763U, 0x0764U, 0x1765U, 0x0766U, 0x3767U, 0x0768U, 0x1769U, 0x076AU, 0x276BU,
+        0x076CU, 0x176DU, 0x076EU, 0x476FU, 0x0770U, 0x1771U, 0x0772U, 0x2773U, 0x0774U, 0x1775U, 0x0776U, 0x3777U,
+        0x0778U, 0x1779U, 0x077AU, 0x277BU, 0x063EU, 0x163FU, 0x063EU, 0x163FU, 0x0700U, 0x1701U, 0x0702U, 0x2703U,
+        0x0704U, 0x1705U, 0x0706U, 0x3707U, 0x0708U, 0x1709U, 0x070AU, 0x270BU, 0x070CU, 0x170DU, 0x070EU, 0x470FU,
+        0x0710U, 0x1711U, 0x0712U, 0x2713U, 0x0714U, 0x1715U, 0x0716U, 0x3717U, 0x0718U, 0x1719U, 0x071AU, 0x271BU,
+        0x071CU, 0x171DU, 0x071EU, 0x571FU, 0x0720U, 0x1721U, 0x0722U, 0x2723U, 0x0724U, 0x1725U, 0x0726U, 0x3727U,
+        0x0728U, 0x1729U, 0x072AU, 0x272BU, 0x072CU, 0x172DU, 0x072EU, 0x472FU, 0x0730U, 0x1731U, 0x0732U, 0x2733U,
+        0x0734U, 0x1735U, 0x0736U, 0x3737U, 0x0738U, 0x1739U, 0x073AU, 0x273BU, 0x073CU, 0x173DU, 0x061FU, 0x061FU,
+        0x0740U, 0x1741U, 0x0742U, 0x2743U, 0x0744U, 0x1745U, 0x0746U, 0x3747U, 0x0748U, 0x1749U, 0x074AU, 0x274BU,
+        0x074CU, 0x174DU, 0x074EU, 0x474FU, 0x0750U, 0x1751U, 0x0752U, 0x2753U, 0x0754U, 0x1755U, 0x0756U, 0x3757U,
+        0x0758U, 0x1759U, 0x075AU, 0x275BU, 0x075CU, 0x175DU, 0x075EU, 0x575FU, 0x0760U, 0x1761U, 0x0762U, 0x2763U,
+        0x0764U, 0x1765U, 0x0766U, 0x3767U, 0x0768U, 0x1769U, 0x076AU, 0x276BU, 0x076CU, 0x176DU, 0x076EU, 0x476FU,
+        0x0770U, 0x1771U, 0x0772U, 0x2773U, 0x0774U, 0x1775U, 0x0776U, 0x3777U, 0x0778U, 0x1779U, 0x077AU, 0x277BU,
+        0x063EU, 0x163FU, 0x063EU, 0x163FU,
+    },
+};
+
+obc_gs_error_code_t ax25Unstuff(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
                                 uint16_t *unstuffedPacketLen) {
-  uint8_t bitCount = 0;
-  uint8_t stuffingFlag = 0;
-  uint16_t unstuffedBitLength = 0;  // count as bits
+  if (packet == NULL || unstuffedPacket == NULL || unstuffedPacketLen == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  unstuffFrame(packet, packetLen, unstuffedPacket, UINT16_MAX, unstuffedPacketLen, NULL, 0, NULL);
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t ax25UnstuffWithAnomalies(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+                                             uint16_t *unstuffedPacketLen, uint16_t *anomalies, uint8_t maxAnomalies,
+                                             uint8_t *numAnomalies) {
+  if (packet == NULL || unstuffedPacket == NULL || unstuffedPacketLen == NULL || numAnomalies == NULL ||
+      (anomalies == NULL && maxAnomalies > 0)) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  *numAnomalies = 0;
+  if (!unstuffFrame(packet, packetLen, unstuffedPacket, AX25_MINIMUM_I_FRAME_LEN, unstuffedPacketLen, anomalies,
+                    maxAnomalies, numAnomalies)) {
+    return OBC_GS_ERR_CODE_INVALID_AX25_PACKET;
+  }
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+static bool unstuffFrame(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+                         uint16_t unstuffedPacketCapacity, uint16_t *unstuffedPacketLen, uint16_t *anomalies,
+                         uint8_t maxAnomalies, uint8_t *numAnomalies) {
+  uint16_t unstuffedIndex = AX25_START_FLAG_BYTES;
+  uint32_t bitAccumulator = 0;
+  uint8_t accumulatedBits = 0;
+  uint8_t state = 0;
 
   // Set the first flag
   unstuffedPacket[0] = AX25_FLAG;
-  unstuffedBitLength += 8;
 
   // loop from second byte to second last byte since first and last are the
   // flags
-  for (uint16_t stuffedPacketIndex = 1; stuffedPacketIndex < packetLen - 1; ++stuffedPacketIndex) {
-    uint8_t current_byte = packet[stuffedPacketIndex];
-
-    for (uint8_t offset = 0; offset < 8; ++offset) {
-      uint8_t bit = (current_byte >> (7 - offset)) & 0x01;
-
-      if (stuffingFlag) {
-        bitCount = 0;
-        stuffingFlag = 0;
-        continue;  // Skip adding the stuffed bit
+  for (uint16_t stuffedPacketIndex = 1; stuffedPacketIndex + 1 < packetLen; ++stuffedPacketIndex) {
+    if (numAnomalies != NULL && hasStuffingViolation(packet[stuffedPacketIndex - 1], packet[stuffedPacketIndex])) {
+      if (*numAnomalies < maxAnomalies) {
+        anomalies[*numAnomalies] = unstuffedIndex;
       }
-
-      if (bit == 1) {
-        bitCount++;
-        if (bitCount == 5) {
-          bitCount = 0;
-          stuffingFlag = 1;
-        }
-      } else {
-        bitCount = 0;
+      if (*numAnomalies < UINT8_MAX) {
+        (*numAnomalies)++;
       }
-      unstuffedPacket[unstuffedBitLength / 8] |= bit << (7 - (unstuffedBitLength % 8));
-      unstuffedBitLength++;
     }
-  }
 
-  // Let these bits at the end that are 0 and are a result of the unstuffing
-  // process
-  uint8_t tailBytes = 0;
+    uint16_t entry = ax25UnstuffTable[state][packet[stuffedPacketIndex]];
+    uint8_t entryBitCount = AX25_UNSTUFF_ENTRY_BIT_COUNT(entry);
 
-  while (unstuffedPacket[(unstuffedBitLength / 8) - tailBytes] == 0x00 && tailBytes < AX25_INFO_BYTES) {
-    tailBytes++;
-  }
-  // Add last flag to end of the packet, rounding up and removing any 0
-  // bytes at the end as a result of unstuffing
-  if (tailBytes == 0) {
-    unstuffedPacket[(unstuffedBitLength + 7) / 8] = AX25_FLAG;
-    *unstuffedPacketLen = ((unstuffedBitLength + 7) / 8) + 1;
-  } else {
-    unstuffedPacket[(unstuffedBitLength / 8) - tailBytes + 1] = AX25_FLAG;
-    *unstuffedPacketLen = unstuffedBitLength / 8 - tailBytes + 2;
+    bitAccumulator = (bitAccumulator << entryBitCount) | AX25_UNSTUFF_ENTRY_BITS(entry);
+    accumulatedBits += entryBitCount;
+    state = AX25_UNSTUFF_ENTRY_STATE(entry);
+
+    if (accumulatedBits >= 8) {
+      if (unstuffedIndex + AX25_END_FLAG_BYTES >= unstuffedPacketCapacity) {
+        return false;
+      }
+      accumulatedBits -= 8;
+      unstuffedPacket[unstuffedIndex++] = (uint8_t)(bitAccumulator >> accumulatedBits);
+    }
   }
 
-  // convert bits to bytes
+  // The stuffer pads the last byte with fewer than 8 zero bits; drop them. Whole zero bytes are frame content (an FCS
+  // byte can be 0x00), so they are kept.
+  unstuffedPacket[unstuffedIndex] = AX25_FLAG;
+  *unstuffedPacketLen = unstuffedIndex + AX25_END_FLAG_BYTES;
+  return true;
+}
 
-  return OBC_GS_ERR_CODE_SUCCESS;
+static bool hasStuffingViolation(uint8_t previousByte, uint8_t byte) {
+  // Bits are sent most significant first, so the previous byte sits above this one. A set bit k in runs marks six
+  // 1s at bits k to k + 5; only runs that end in this byte (k <= 7) are counted so each run is reported once.
+  uint16_t window = (uint16_t)((previousByte << 8) | byte);
+  uint16_t runs = window & (window >> 1) & (window >> 2) & (window >> 3) & (window >> 4) & (window >> 5);
+  return (runs & 0xFFU) != 0;
 }
 
 static obc_gs_error_code_t sFrameRecv(unstuffed_ax25_i_frame_t *unstuffedPacket) {
@@ -517,33 +750,166 @@ static obc_gs_error_code_t fcsCheck(const uint8_t *data, uint16_t dataLen, uint1
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
+/*
+ * Byte-at-a-time bit stuffing table, indexed by [number of consecutive 1s carried in][raw byte].
+ * Each entry holds the stuffed bits right aligned in bits 0-9, the number of stuffed bits minus 8 in bits 10-11 and
+ * the number of consecutive 1s to carry into the next byte in bits 12-14.
+ */
+static const uint16_t ax25StuffTable[AX25_STUFF_TABLE_STATES][256] = {
+    {
+        0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U, 0x0008U, 0x1009U, 0x000AU, 0x200BU,
+        0x000CU, 0x100DU, 0x000EU, 0x400FU, 0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+        0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU, 0x0020U, 0x1021U, 0x0022U, 0x2023U,
+        0x0024U, 0x1025U, 0x0026U, 0x3027U, 0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+        0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U, 0x0038U, 0x1039U, 0x003AU, 0x203BU,
+        0x003CU, 0x103DU, 0x047CU, 0x147DU, 0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+        0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU, 0x0050U, 0x1051U, 0x0052U, 0x2053U,
+        0x0054U, 0x1055U, 0x0056U, 0x3057U, 0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+        0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U, 0x0068U, 0x1069U, 0x006AU, 0x206BU,
+        0x006CU, 0x106DU, 0x006EU, 0x406FU, 0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+        0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU, 0x0080U, 0x1081U, 0x0082U, 0x2083U,
+        0x0084U, 0x1085U, 0x0086U, 0x3087U, 0x0088U, 0x1089U, 0x008AU, 0x208BU, 0x008CU, 0x108DU, 0x008EU, 0x408FU,
+        0x0090U, 0x1091U, 0x0092U, 0x2093U, 0x0094U, 0x1095U, 0x0096U, 0x3097U, 0x0098U, 0x1099U, 0x009AU, 0x209BU,
+        0x009CU, 0x109DU, 0x009EU, 0x053EU, 0x00A0U, 0x10A1U, 0x00A2U, 0x20A3U, 0x00A4U, 0x10A5U, 0x00A6U, 0x30A7U,
+        0x00A8U, 0x10A9U, 0x00AAU, 0x20ABU, 0x00ACU, 0x10ADU, 0x00AEU, 0x40AFU, 0x00B0U, 0x10B1U, 0x00B2U, 0x20B3U,
+        0x00B4U, 0x10B5U, 0x00B6U, 0x30B7U, 0x00B8U, 0x10B9U, 0x00BAU, 0x20BBU, 0x00BCU, 0x10BDU, 0x057CU, 0x157DU,
+        0x00C0U, 0x10C1U, 0x00C2U, 0x20C3U, 0x00C4U, 0x10C5U, 0x00C6U, 0x30C7U, 0x00C8U, 0x10C9U, 0x00CAU, 0x20CBU,
+        0x00CCU, 0x10CDU, 0x00CEU, 0x40CFU, 0x00D0U, 0x10D1U, 0x00D2U, 0x20D3U, 0x00D4U, 0x10D5U, 0x00D6U, 0x30D7U,
+        0x00D8U, 0x10D9U, 0x00DAU, 0x20DBU, 0x00DCU, 0x10DDU, 0x00DEU, 0x05BEU, 0x00E0U, 0x10E1U, 0x00E2U, 0x20E3U,
+        0x00E4U, 0x10E5U, 0x00E6U, 0x30E7U, 0x00E8U, 0x10E9U, 0x00EAU, 0x20EBU, 0x00ECU, 0x10EDU, 0x00EEU, 0x40EFU,
+        0x00F0U, 0x10F1U, 0x00F2U, 0x20F3U, 0x00F4U, 0x10F5U, 0x00F6U, 0x30F7U, 0x05F0U, 0x15F1U, 0x05F2U, 0x25F3U,
+        0x05F4U, 0x15F5U, 0x05F6U, 0x35F7U,
+    },
+    {
+        0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U, 0x0008U, 0x1009U, 0x000AU, 0x200BU,
+        0x000CU, 0x100DU, 0x000EU, 0x400FU, 0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+        0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU, 0x0020U, 0x1021U, 0x0022U, 0x2023U,
+        0x0024U, 0x1025U, 0x0026U, 0x3027U, 0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+        0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U, 0x0038U, 0x1039U, 0x003AU, 0x203BU,
+        0x003CU, 0x103DU, 0x047CU, 0x147DU, 0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+        0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU, 0x0050U, 0x1051U, 0x0052U, 0x2053U,
+        0x0054U, 0x1055U, 0x0056U, 0x3057U, 0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+        0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U, 0x0068U, 0x1069U, 0x006AU, 0x206BU,
+        0x006CU, 0x106DU, 0x006EU, 0x406FU, 0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+        0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU, 0x0080U, 0x1081U, 0x0082U, 0x2083U,
+        0x0084U, 0x1085U, 0x0086U, 0x3087U, 0x0088U, 0x1089U, 0x008AU, 0x208BU, 0x008CU, 0x108DU, 0x008EU, 0x408FU,
+        0x0090U, 0x1091U, 0x0092U, 0x2093U, 0x0094U, 0x1095U, 0x0096U, 0x3097U, 0x0098U, 0x1099U, 0x009AU, 0x209BU,
+        0x009CU, 0x109DU, 0x009EU, 0x053EU, 0x00A0U, 0x10A1U, 0x00A2U, 0x20A3U, 0x00A4U, 0x10A5U, 0x00A6U, 0x30A7U,
+        0x00A8U, 0x10A9U, 0x00AAU, 0x20ABU, 0x00ACU, 0x10ADU, 0x00AEU, 0x40AFU, 0x00B0U, 0x10B1U, 0x00B2U, 0x20B3U,
+        0x00B4U, 0x10B5U, 0x00B6U, 0x30B7U, 0x00B8U, 0x10B9U, 0x00BAU, 0x20BBU, 0x00BCU, 0x10BDU, 0x057CU, 0x157DU,
+        0x00C0U, 0x10C1U, 0x00C2U, 0x20C3U, 0x00C4U, 0x10C5U, 0x00C6U, 0x30C7U, 0x00C8U, 0x10C9U, 0x00CAU, 0x20CBU,
+        0x00CCU, 0x10CDU, 0x00CEU, 0x40CFU, 0x00D0U, 0x10D1U, 0x00D2U, 0x20D3U, 0x00D4U, 0x10D5U, 0x00D6U, 0x30D7U,
+        0x00D8U, 0x10D9U, 0x00DAU, 0x20DBU, 0x00DCU, 0x10DDU, 0x00DEU, 0x05BEU, 0x00E0U, 0x10E1U, 0x00E2U, 0x20E3U,
+        0x00E4U, 0x10E5U, 0x00E6U, 0x30E7U, 0x00E8U, 0x10E9U, 0x00EAU, 0x20EBU, 0x00ECU, 0x10EDU, 0x00EEU, 0x40EFU,
+        0x05E0U, 0x15E1U, 0x05E2U, 0x25E3U, 0x05E4U, 0x15E5U, 0x05E6U, 0x35E7U, 0x05E8U, 0x15E9U, 0x05EAU, 0x25EBU,
+        0x05ECU, 0x15EDU, 0x05EEU, 0x45EFU,
+    },
+    {
+        0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U, 0x0008U, 0x1009U, 0x000AU, 0x200BU,
+        0x000CU, 0x100DU, 0x000EU, 0x400FU, 0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+        0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU, 0x0020U, 0x1021U, 0x0022U, 0x2023U,
+        0x0024U, 0x1025U, 0x0026U, 0x3027U, 0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+        0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U, 0x0038U, 0x1039U, 0x003AU, 0x203BU,
+        0x003CU, 0x103DU, 0x047CU, 0x147DU, 0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+        0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU, 0x0050U, 0x1051U, 0x0052U, 0x2053U,
+        0x0054U, 0x1055U, 0x0056U, 0x3057U, 0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+        0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U, 0x0068U, 0x1069U, 0x006AU, 0x206BU,
+        0x006CU, 0x106DU, 0x006EU, 0x406FU, 0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+        0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU, 0x0080U, 0x1081U, 0x0082U, 0x2083U,
+        0x0084U, 0x1085U, 0x0086U, 0x3087U, 0x0088U, 0x1089U, 0x008AU, 0x208BU, 0x008CU, 0x108DU, 0x008EU, 0x408FU,
+        0x0090U, 0x1091U, 0x0092U, 0x2093U, 0x0094U, 0x1095U, 0x0096U, 0x3097U, 0x0098U, 0x1099U, 0x009AU, 0x209BU,
+        0x009CU, 0x109DU, 0x009EU, 0x053EU, 0x00A0U, 0x10A1U, 0x00A2U, 0x20A3U, 0x00A4U, 0x10A5U, 0x00A6U, 0x30A7U,
+        0x00A8U, 0x10A9U, 0x00AAU, 0x20ABU, 0x00ACU, 0x10ADU, 0x00AEU, 0x40AFU, 0x00B0U, 0x10B1U, 0x00B2U, 0x20B3U,
+        0x00B4U, 0x10B5U, 0x00B6U, 0x30B7U, 0x00B8U, 0x10B9U, 0x00BAU, 0x20BBU, 0x00BCU, 0x10BDU, 0x057CU, 0x157DU,
+        0x00C0U, 0x10C1U, 0x00C2U, 0x20C3U, 0x00C4U, 0x10C5U, 0x00C6U, 0x30C7U, 0x00C8U, 0x10C9U, 0x00CAU, 0x20CBU,
+        0x00CCU, 0x10CDU, 0x00CEU, 0x40CFU, 0x00D0U, 0x10D1U, 0x00D2U, 0x20D3U, 0x00D4U, 0x10D5U, 0x00D6U, 0x30D7U,
+        0x00D8U, 0x10D9U, 0x00DAU, 0x20DBU, 0x00DCU, 0x10DDU, 0x00DEU, 0x05BEU, 0x05C0U, 0x15C1U, 0x05C2U, 0x25C3U,
+        0x05C4U, 0x15C5U, 0x05C6U, 0x35C7U, 0x05C8U, 0x15C9U, 0x05CAU, 0x25CBU, 0x05CCU, 0x15CDU, 0x05CEU, 0x45CFU,
+        0x05D0U, 0x15D1U, 0x05D2U, 0x25D3U, 0x05D4U, 0x15D5U, 0x05D6U, 0x35D7U, 0x05D8U, 0x15D9U, 0x05DAU, 0x25DBU,
+        0x05DCU, 0x15DDU, 0x05DEU, 0x0BBEU,
+    },
+    {
+        0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U, 0x0008U, 0x1009U, 0x000AU, 0x200BU,
+        0x000CU, 0x100DU, 0x000EU, 0x400FU, 0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+        0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU, 0x0020U, 0x1021U, 0x0022U, 0x2023U,
+        0x0024U, 0x1025U, 0x0026U, 0x3027U, 0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+        0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U, 0x0038U, 0x1039U, 0x003AU, 0x203BU,
+        0x003CU, 0x103DU, 0x047CU, 0x147DU, 0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+        0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU, 0x0050U, 0x1051U, 0x0052U, 0x2053U,
+        0x0054U, 0x1055U, 0x0056U, 0x3057U, 0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+        0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U, 0x0068U, 0x1069U, 0x006AU, 0x206BU,
+        0x006CU, 0x106DU, 0x006EU, 0x406FU, 0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+        0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU, 0x0080U, 0x1081U, 0x0082U, 0x2083U,
+        0x0084U, 0x1085U, 0x0086U, 0x3087U, 0x0088U, 0x1089U, 0x008AU, 0x208BU, 0x008CU, 0x108DU, 0x008EU, 0x408FU,
+        0x0090U, 0x1091U, 0x0092U, 0x2093U, 0x0094U, 0x1095U, 0x0096U, 0x3097U, 0x0098U, 0x1099U, 0x009AU, 0x209BU,
+        0x009CU, 0x109DU, 0x009EU, 0x053EU, 0x00A0U, 0x10A1U, 0x00A2U, 0x20A3U, 0x00A4U, 0x10A5U, 0x00A6U, 0x30A7U,
+        0x00A8U, 0x10A9U, 0x00AAU, 0x20ABU, 0x00ACU, 0x10ADU, 0x00AEU, 0x40AFU, 0x00B0U, 0x10B1U, 0x00B2U, 0x20B3U,
+        0x00B4U, 0x10B5U, 0x00B6U, 0x30B7U, 0x00B8U, 0x10B9U, 0x00BAU, 0x20BBU, 0x00BCU, 0x10BDU, 0x057CU, 0x157DU,
+        0x0580U, 0x1581U, 0x0582U, 0x2583U, 0x0584U, 0x1585U, 0x0586U, 0x3587U, 0x0588U, 0x1589U, 0x058AU, 0x258BU,
+        0x058CU, 0x158DU, 0x058EU, 0x458FU, 0x0590U, 0x1591U, 0x0592U, 0x2593U, 0x0594U, 0x1595U, 0x0596U, 0x3597U,
+        0x0598U, 0x1599U, 0x059AU, 0x259BU, 0x059CU, 0x159DU, 0x059EU, 0x0B3EU, 0x05A0U, 0x15A1U, 0x05A2U, 0x25A3U,
+        0x05A4U, 0x15A5U, 0x05A6U, 0x35A7U, 0x05A8U, 0x15A9U, 0x05AAU, 0x25ABU, 0x05ACU, 0x15ADU, 0x05AEU, 0x45AFU,
+        0x05B0U, 0x15B1U, 0x05B2U, 0x25B3U, 0x05B4U, 0x15B5U, 0x05B6U, 0x35B7U, 0x05B8U, 0x15B9U, 0x05BAU, 0x25BBU,
+        0x05BCU, 0x15BDU, 0x0B7CU, 0x1B7DU,
+    },
+    {
+        0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U, 0x0008U, 0x1009U, 0x000AU, 0x200BU,
+        0x000CU, 0x100DU, 0x000EU, 0x400FU, 0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+        0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU, 0x0020U, 0x1021U, 0x0022U, 0x2023U,
+        0x0024U, 0x1025U, 0x0026U, 0x3027U, 0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+        0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U, 0x0038U, 0x1039U, 0x003AU, 0x203BU,
+        0x003CU, 0x103DU, 0x047CU, 0x147DU, 0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+        0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU, 0x0050U, 0x1051U, 0x0052U, 0x2053U,
+        0x0054U, 0x1055U, 0x0056U, 0x3057U, 0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+        0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U, 0x0068U, 0x1069U, 0x006AU, 0x206BU,
+        0x006CU, 0x106DU, 0x006EU, 0x406FU, 0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+        0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU, 0x0500U, 0x1501U, 0x0502U, 0x2503U,
+        0x0504U, 0x1505U, 0x0506U, 0x3507U, 0x0508U, 0x1509U, 0x050AU, 0x250BU, 0x050CU, 0x150DU, 0x050EU, 0x450FU,
+        0x0510U, 0x1511U, 0x0512U, 0x2513U, 0x0514U, 0x1515U, 0x0516U, 0x3517U, 0x0518U, 0x1519U, 0x051AU, 0x251BU,
+        0x051CU, 0x151DU, 0x051EU, 0x0A3EU, 0x0520U, 0x1521U, 0x0522U, 0x2523U, 0x0524U, 0x1525U, 0x0526U, 0x3527U,
+        0x0528U, 0x1529U, 0x052AU, 0x252BU, 0x052CU, 0x152DU, 0x052EU, 0x452FU, 0x0530U, 0x1531U, 0x0532U, 0x2533U,
+        0x0534U, 0x1535U, 0x0536U, 0x3537U, 0x0538U, 0x1539U, 0x053AU, 0x253BU, 0x053CU, 0x153DU, 0x0A7CU, 0x1A7DU,
+        0x0540U, 0x1541U, 0x0542U, 0x2543U, 0x0544U, 0x1545U, 0x0546U, 0x3547U, 0x0548U, 0x1549U, 0x054AU, 0x254BU,
+        0x054CU, 0x154DU, 0x054EU, 0x454FU, 0x0550U, 0x1551U, 0x0552U, 0x2553U, 0x0554U, 0x1555U, 0x0556U, 0x3557U,
+        0x0558U, 0x1559U, 0x055AU, 0x255BU, 0x055CU, 0x155DU, 0x055EU, 0x0ABEU, 0x0560U, 0x1561U, 0x0562U, 0x2563U,
+        0x0564U, 0x1565U, 0x0566U, 0x3567U, 0x0568U, 0x1569U, 0x056AU, 0x256BU, 0x056CU, 0x156DU, 0x056EU, 0x456FU,
+        0x0570U, 0x1571U, 0x0572U, 0x2573U, 0x0574U, 0x1575U, 0x0576U, 0x3577U, 0x0578U, 0x1579U, 0x057AU, 0x257BU,
+        0x0AF8U, 0x1AF9U, 0x0AFAU, 0x2AFBU,
+    },
+};
+
 obc_gs_error_code_t ax25Stuff(uint8_t *rawData, uint16_t rawDataLen, uint8_t *stuffedData, uint16_t *stuffedDataLen) {
   if (rawData == NULL || stuffedData == NULL || stuffedDataLen == NULL) {
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
 
-  uint16_t rawOffset = 0, stuffedOffset = 8, oneCount = 0;
-  uint8_t currentBit;
+  uint16_t stuffedIndex = AX25_START_FLAG_BYTES;
+  uint32_t bitAccumulator = 0;
+  uint8_t accumulatedBits = 0;
+  uint8_t oneCount = 0;
 
-  // Cycle through raw data to find 1s
-  for (rawOffset = 8; rawOffset < (rawDataLen - 1) * 8; ++rawOffset) {
-    currentBit = (rawData[rawOffset / 8] >> (7 - (rawOffset % 8))) & 1;
-    stuffedData[stuffedOffset / 8] |= (currentBit << (7 - (stuffedOffset % 8)));
-    stuffedOffset++;
+  // Skip the first and last raw bytes since they are the flags
+  for (uint16_t rawIndex = 1; rawIndex + 1 < rawDataLen; ++rawIndex) {
+    uint16_t entry = ax25StuffTable[oneCount][rawData[rawIndex]];
+    uint8_t entryBitCount = AX25_STUFF_ENTRY_BIT_COUNT(entry);
 
-    if (currentBit == 1) {
-      oneCount++;
-      if (oneCount == 5) {
-        oneCount = 0;
-        stuffedData[stuffedOffset / 8] |= 0;
-        stuffedOffset++;
-      }
-    } else {
-      oneCount = 0;
+    bitAccumulator = (bitAccumulator << entryBitCount) | AX25_STUFF_ENTRY_BITS(entry);
+    accumulatedBits += entryBitCount;
+    oneCount = AX25_STUFF_ENTRY_STATE(entry);
+
+    // A raw byte can stuff out to 10 bits, so up to two full bytes may be ready
+    while (accumulatedBits >= 8) {
+      accumulatedBits -= 8;
+      stuffedData[stuffedIndex++] = (uint8_t)(bitAccumulator >> accumulatedBits);
     }
   }
 
-  *stuffedDataLen = ((stuffedOffset + 7) / 8) + 1;
+  // Pad the last partial byte with 0s
+  if (accumulatedBits > 0) {
+    stuffedData[stuffedIndex++] = (uint8_t)(bitAccumulator << (8 - accumulatedBits));
+  }
+
+  *stuffedDataLen = stuffedIndex + AX25_END_FLAG_BYTES;
   stuffedData[0] = AX25_FLAG;
   stuffedData[*stuffedDataLen - 1] = AX25_FLAG;
   return OBC_GS_ERR_CODE_SUCCESS;
@@ -151,6 +151,22 @@ obc_gs_error_code_t ax25SendIFrameWithFlagSharing(uint8_t *telemData, uint32_t t
  */
 obc_gs_error_code_t ax25SendIFrame(uint8_t *telemData, uint8_t telemDataLen, unstuffed_ax25_i_frame_t *ax25Data);
 
+/**
+ * @brief builds an I frame for an explicit destination and sequence numbers without touching the link state
+ *
+ * ax25SendIFrame calls this with the current link's destination and packet counts. Calling it directly lets frames be
+ * built on any thread and in any order.
+ *
+ * @param telemData data to send that needs ax.25 headers added onto it
+ * @param telemDataLen length of the telemData array
+ * @param destAddress address of the destination for the ax25 packet
+ * @param sendSeq N(S) of the frame, less than MAX_CONTINUOUS_PACKETS_ALLOWED
+ * @param receiveSeq N(R) of the frame, less than MAX_CONTINUOUS_PACKETS_ALLOWED
+ * @param ax25Data array to store the ax.25 frame
+ */
+obc_gs_error_code_t ax25BuildIFrame(const uint8_t *telemData, uint8_t telemDataLen, const ax25_addr_t *destAddress,
+                                    uint8_t sendSeq, uint8_t receiveSeq, unstuffed_ax25_i_frame_t *ax25Data);
+
 /**
  * @brief format a buffer into a U frame command such as connect, disconnect, or acknowledge
  *
@@ -162,6 +178,32 @@ obc_gs_error_code_t ax25SendIFrame(uint8_t *telemData, uint8_t telemDataLen, uns
  */
 obc_gs_error_code_t ax25SendUFrame(packed_ax25_u_frame_t *ax25Data, uint8_t cmd, uint8_t pollFinalBit);
 
+/**
+ * @brief builds a U frame for an explicit destination without touching the link state
+ *
+ * ax25SendUFrame calls this with the current link's destination.
+ *
+ * @param ax25Data buffer to store the U frame to be sent
+ * @param destAddress address of the destination for the ax25 packet
+ * @param cmd the U frame command you want to send
+ * @param pollFinalBit what to set the poll/final bit to in the U frame (either 1 or 0)
+ *
+ * @return obc_gs_error_code_t - whether or not the buffer was correctly formatted
+ */
+obc_gs_error_code_t ax25BuildUFrame(packed_ax25_u_frame_t *ax25Data, const ax25_addr_t *destAddress, uint8_t cmd,
+                                    uint8_t pollFinalBit);
+
+/**
+ * @brief checks the length, destination address and FCS of a received frame without touching the link state
+ *
+ * Unlike ax25Recv this neither counts the frame nor acts on it, so frames can be checked on any thread and in any
+ * order.
+ *
+ * @param unstuffedPacket the received unstuffed ax.25 frame
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_SUCCESS if the frame is addressed to us and its FCS matches
+ */
+obc_gs_error_code_t ax25CheckFrame(const unstuffed_ax25_i_frame_t *unstuffedPacket);
+
 /**
  * @brief checks for a valid ax25 frame and performs command handling if necessary
  *
@@ -179,9 +221,30 @@ obc_gs_error_code_t ax25Recv(unstuffed_ax25_i_frame_t *unstuffedPacket, u_frame_
  * @param unstuffedPacket pointer to a buffer to hold the unstuffed ax.25 packet
  * @param unstuffedPacketLen stores the number of bytes written to unstuffedPacket
  */
-obc_gs_error_code_t ax25Unstuff(uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+obc_gs_error_code_t ax25Unstuff(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
                                 uint16_t *unstuffedPacketLen);
 
+/**
+ * @brief performs bit unstuffing and reports where the stuffing rule was broken
+ *
+ * Inside a frame the sender never lets six 1s in a row through, so a run of six or more can only come from bit
+ * errors (or an abort). The byte being unstuffed when such a run ends is reported so the FEC can treat it as an
+ * erasure.
+ *
+ * @param packet pointer to a buffer with the received stuffed ax.25 data
+ * @param packetLen length of the packetLen buffer
+ * @param unstuffedPacket pointer to a buffer of AX25_MINIMUM_I_FRAME_LEN bytes to hold the unstuffed ax.25 packet
+ * @param unstuffedPacketLen stores the number of bytes written to unstuffedPacket
+ * @param anomalies stores the unstuffedPacket offsets of the violations, in increasing order
+ * @param maxAnomalies capacity of anomalies; further violations are counted but not stored
+ * @param numAnomalies stores the number of violations found
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_AX25_PACKET if the unstuffed packet is longer than an I frame
+ */
+obc_gs_error_code_t ax25UnstuffWithAnomalies(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+                                             uint16_t *unstuffedPacketLen, uint16_t *anomalies, uint8_t maxAnomalies,
+                                             uint8_t *numAnomalies);
+
 /**
  * @brief performs bit unstuffing on a receive ax.25 packet
  *
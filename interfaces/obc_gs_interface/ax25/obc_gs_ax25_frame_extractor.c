@@ -0,0 +1,90 @@
+#include "obc_gs_ax25_frame_extractor.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// A start flag, at least one byte of data and an end flag
+#define AX25_MIN_EXTRACTED_FRAME_LEN 3U
+
+static bool appendToFrame(ax25_frame_extractor_t *extractor, const uint8_t *data, uint32_t dataLen);
+
+void ax25FrameExtractorInit(ax25_frame_extractor_t *extractor) {
+  if (extractor == NULL) {
+    return;
+  }
+
+  extractor->frameLen = 0;
+  extractor->inFrame = false;
+  extractor->overflows = 0;
+}
+
+obc_gs_error_code_t ax25FrameExtractorPush(ax25_frame_extractor_t *extractor, const uint8_t *data, uint32_t dataLen,
+                                           ax25_frame_callback_t callback, void *context) {
+  if (extractor == NULL || data == NULL || callback == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  const uint8_t *cursor = data;
+  const uint8_t *end = data + dataLen;
+
+  // Start flag of the current frame if it is inside this span, NULL if it arrived in an earlier push
+  const uint8_t *spanFrameStart = NULL;
+
+  while (cursor < end) {
+    const uint8_t *flag = memchr(cursor, AX25_FLAG, (size_t)(end - cursor));
+    if (flag == NULL) {
+      break;
+    }
+
+    if (extractor->inFrame) {
+      if (spanFrameStart != NULL) {
+        uint32_t frameLen = (uint32_t)(flag - spanFrameStart) + 1;
+        if (frameLen > AX25_MAXIMUM_PKT_LEN) {
+          extractor->overflows++;
+        } else if (frameLen >= AX25_MIN_EXTRACTED_FRAME_LEN) {
+          callback(spanFrameStart, (uint16_t)frameLen, context);
+        }
+      } else if (appendToFrame(extractor, cursor, (uint32_t)(flag - cursor) + 1)) {
+        if (extractor->frameLen >= AX25_MIN_EXTRACTED_FRAME_LEN) {
+          callback(extractor->frame, extractor->frameLen, context);
+        }
+      }
+    }
+
+    // The flag that ends one frame also starts the next one
+    extractor->inFrame = true;
+    extractor->frameLen = 0;
+    spanFrameStart = flag;
+    cursor = flag + 1;
+  }
+
+  // Keep the unfinished frame for the next push
+  if (extractor->inFrame) {
+    if (spanFrameStart != NULL) {
+      appendToFrame(extractor, spanFrameStart, (uint32_t)(end - spanFrameStart));
+    } else {
+      appendToFrame(extractor, cursor, (uint32_t)(end - cursor));
+    }
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief appends bytes to the assembly buffer, dropping the frame if it no longer fits
+ *
+ * @return true if the bytes were appended, false if the frame was dropped
+ */
+static bool appendToFrame(ax25_frame_extractor_t *extractor, const uint8_t *data, uint32_t dataLen) {
+  if (dataLen > sizeof(extractor->frame) - extractor->frameLen) {
+    // Wait for the next flag and treat it as a start flag
+    extractor->overflows++;
+    extractor->inFrame = false;
+    extractor->frameLen = 0;
+    return false;
+  }
+
+  memcpy(extractor->frame + extractor->frameLen, data, dataLen);
+  extractor->frameLen += dataLen;
+  return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "obc_gs_ax25.h"
+#include "obc_gs_errors.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief called for each complete frame found by the extractor
+ *
+ * @param frame the stuffed frame including its start and end flags; only valid for the duration of the call
+ * @param frameLen number of bytes in frame
+ * @param context the context pointer passed to ax25FrameExtractorPush
+ */
+typedef void (*ax25_frame_callback_t)(const uint8_t *frame, uint16_t frameLen, void *context);
+
+/**
+ * @brief splits a stream of received bytes into flag-delimited AX.25 frames
+ *
+ * A frame that lies entirely within one pushed span is handed to the callback in place. Only a frame that straddles
+ * two pushes is copied, into the assembly buffer below.
+ */
+typedef struct {
+  uint8_t frame[AX25_MAXIMUM_PKT_LEN];  // Partial frame carried over from earlier pushes
+  uint16_t frameLen;                    // Number of bytes in frame
+  bool inFrame;                         // Whether a start flag has been seen
+  uint32_t overflows;                   // Frames dropped for being longer than AX25_MAXIMUM_PKT_LEN
+} ax25_frame_extractor_t;
+
+/**
+ * @brief resets the extractor so it waits for a start flag
+ *
+ * @param extractor the extractor to reset
+ */
+void ax25FrameExtractorInit(ax25_frame_extractor_t *extractor);
+
+/**
+ * @brief scans a span of received bytes and reports every frame it completes
+ *
+ * Back-to-back flags (idle fill) are skipped and a frame's end flag is also the start flag of the next one. A frame
+ * longer than AX25_MAXIMUM_PKT_LEN is dropped and counted in overflows.
+ *
+ * @param extractor the extractor holding state between pushes
+ * @param data the received bytes
+ * @param dataLen number of bytes in data
+ * @param callback called once per complete frame
+ * @param context passed through to callback
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if a pointer is NULL
+ */
+obc_gs_error_code_t ax25FrameExtractorPush(ax25_frame_extractor_t *extractor, const uint8_t *data, uint32_t dataLen,
+                                           ax25_frame_callback_t callback, void *context);
+
+#ifdef __cplusplus
+}
+#endif
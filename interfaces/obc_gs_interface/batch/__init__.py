@@ -0,0 +1,285 @@
+from array import array
+from collections.abc import Callable, Iterable, Sequence
+from ctypes import POINTER, Array, Structure, c_uint, c_uint8, c_uint32, cast, pointer
+from dataclasses import dataclass
+from typing import Final
+
+from interfaces import CUBE_SAT_CALLSIGN
+from interfaces.obc_gs_interface import interface
+
+# ######################################################################
+# ||                                                                  ||
+# ||              Ctype Declerations for Batch Encoding               ||
+# ||                                                                  ||
+# ######################################################################
+
+# Path to File: interfaces/obc_gs_interface/batch/obc_gs_batch.h
+# Read from the library so they cannot drift from the C macros
+BATCH_ENCODED_FRAME_MAX_LEN: Final[int] = c_uint32.in_dll(interface, "batchEncodedFrameMaxLen").value
+BATCH_DECODED_FRAME_LEN: Final[int] = c_uint32.in_dll(interface, "batchDecodedFrameLen").value
+
+_AES_KEY_SIZE: Final[int] = 16
+_AES_IV_SIZE: Final[int] = 16
+
+
+class BatchConfig(Structure):
+    """
+    The python equivalent class for the batch_config_t structure in the C implementation
+    """
+
+    _fields_ = [
+        ("aesKey", POINTER(c_uint8)),
+        ("aesIv", POINTER(c_uint8)),
+        ("destCallSign", POINTER(c_uint8)),
+        ("destCallSignLength", c_uint8),
+        ("firstSendSeq", c_uint8),
+    ]
+
+
+class FrameBatch(Structure):
+    """
+    The python equivalent class for the frame_batch_t structure in the C implementation
+    """
+
+    _fields_ = [
+        ("data", POINTER(c_uint8)),
+        ("dataLen", c_uint32),
+        ("offsets", POINTER(c_uint32)),
+        ("lengths", POINTER(c_uint32)),
+        ("numFrames", c_uint32),
+    ]
+
+
+# batchEncodeFrames()
+interface.batchEncodeFrames.argtypes = [
+    POINTER(BatchConfig),
+    POINTER(FrameBatch),
+    POINTER(FrameBatch),
+    POINTER(c_uint),
+]
+interface.batchEncodeFrames.restype = c_uint
+
+# batchDecodeFrames()
+interface.batchDecodeFrames.argtypes = [
+    POINTER(BatchConfig),
+    POINTER(FrameBatch),
+    POINTER(FrameBatch),
+    POINTER(c_uint),
+]
+interface.batchDecodeFrames.restype = c_uint
+
+
+@dataclass
+class BatchResult:
+    """
+    Frames produced by one batch call. The buffers support the buffer protocol, so numpy.frombuffer can view them
+    without a copy
+
+    :param data: Every output frame, back to back; may be longer than the frames in it
+    :param offsets: Index in data of each frame (uint32)
+    :param lengths: Length of each frame, 0 if it failed (uint32)
+    :param statuses: OBC GS error code of each frame, 0 for success (uint32)
+    """
+
+    data: bytearray
+    offsets: "array[int]"
+    lengths: "array[int]"
+    statuses: "array[int]"
+
+    def __len__(self) -> int:
+        return len(self.statuses)
+
+    def frame(self, index: int) -> bytes | None:
+        """
+        :param index: Index of the frame in the batch
+        :return: The bytes of the frame, or None if it failed
+        """
+        if self.statuses[index] != 0:
+            return None
+        return bytes(self.data[self.offsets[index] : self.offsets[index] + self.lengths[index]])
+
+    def frames(self) -> list[bytes | None]:
+        """
+        :return: The bytes of every frame, with None for the frames that failed
+        """
+        return [self.frame(i) for i in range(len(self))]
+
+
+class BatchPipeline:
+    """
+    Runs the comms pipeline (AES-128, reed solomon, ax25 framing and bit stuffing) over many frames with one call into
+    the C implementation per batch. Per frame calls through ctypes cost more than the encoding itself, so this is the
+    way to encode or decode a recorded pass
+
+    NOTE: Unlike CommsPipeline, a payload is padded to 223 bytes before it is encrypted, so decoding gives back the
+    padding as zeros
+    """
+
+    def __init__(
+        self,
+        dst: str = CUBE_SAT_CALLSIGN,
+        aes_key: bytes | None = b"\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f",
+        aes_iv: bytes = b"\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01",
+        first_send_seq: int = 0,
+    ) -> None:
+        """
+        :param dst: Destination Address Callsign of encoded frames (Should be a maximum of 6 characters long)
+        :param aes_key: The AES-128 key, or None to leave payloads unencrypted
+        :param aes_iv: The CTR mode initialization vector, used for every frame
+        :param first_send_seq: Send sequence number of the first encoded frame; later frames count up from it
+        """
+        if aes_key is not None and (len(aes_key) != _AES_KEY_SIZE or len(aes_iv) != _AES_IV_SIZE):
+            raise ValueError("The AES key and iv must be 16 bytes each")
+
+        # The config points into these arrays, so they are kept for as long as the config
+        self._dst = (c_uint8 * len(dst))(*dst.encode("ascii"))
+        self._aes_key = None if aes_key is None else (c_uint8 * _AES_KEY_SIZE)(*aes_key)
+        self._aes_iv = None if aes_key is None else (c_uint8 * _AES_IV_SIZE)(*aes_iv)
+        self._config = BatchConfig(
+            aesKey=None if self._aes_key is None else cast(self._aes_key, POINTER(c_uint8)),
+            aesIv=None if self._aes_iv is None else cast(self._aes_iv, POINTER(c_uint8)),
+            destCallSign=cast(self._dst, POINTER(c_uint8)),
+            destCallSignLength=len(dst),
+            firstSendSeq=first_send_seq,
+        )
+
+    def encode(self, data: bytes, offsets: Sequence[int], lengths: Sequence[int]) -> BatchResult:
+        """
+        Encodes payloads that share one buffer into stuffed ax25 I frames
+
+        :param data: A bytes-like object holding the payloads (bytes, bytearray, memoryview or a uint8 numpy array)
+        :param offsets: Index in data of each payload (a list, array("I") or uint32 numpy array)
+        :param lengths: Length of each payload, at most 223 bytes
+        :return: The stuffed frames
+        """
+        return self._run(interface.batchEncodeFrames, data, offsets, lengths, BATCH_ENCODED_FRAME_MAX_LEN)
+
+    def decode(self, data: bytes, offsets: Sequence[int], lengths: Sequence[int]) -> BatchResult:
+        """
+        Decodes stuffed ax25 frames that share one buffer. An I frame decodes to its 223 byte payload and a frame
+        without an info field, such as a U frame, decodes to no bytes
+
+        :param data: A bytes-like object holding the frames (bytes, bytearray, memoryview or a uint8 numpy array)
+        :param offsets: Index in data of each frame, including the start flag (a list, array("I") or uint32 numpy array)
+        :param lengths: Length of each frame, including both flags
+        :return: The decoded payloads
+        """
+        return self._run(interface.batchDecodeFrames, data, offsets, lengths, BATCH_DECODED_FRAME_LEN)
+
+    def encode_frames(self, payloads: Iterable[bytes]) -> list[bytes | None]:
+        """
+        Encodes payloads into stuffed ax25 I frames
+
+        :param payloads: Payloads of at most 223 bytes
+        :return: The stuffed frames, with None for the payloads that could not be encoded
+        """
+        return self.encode(*_join(payloads)).frames()
+
+    def decode_frames(self, frames: Iterable[bytes]) -> list[bytes | None]:
+        """
+        Decodes stuffed ax25 frames
+
+        :param frames: Stuffed frames including both flags
+        :return: The payloads, with None for the frames that could not be decoded
+        """
+        return self.decode(*_join(frames)).frames()
+
+    def _run(
+        self,
+        function: Callable[..., int],
+        data: bytes,
+        offsets: Sequence[int],
+        lengths: Sequence[int],
+        frame_capacity: int,
+    ) -> BatchResult:
+        """
+        Calls a batch function of the C implementation with output space for every frame
+        """
+        if len(offsets) != len(lengths):
+            raise ValueError("There must be as many lengths as offsets")
+        num_frames = len(offsets)
+
+        in_data = _uint8_array(data)
+        in_offsets = _uint32_array(offsets)
+        in_lengths = _uint32_array(lengths)
+        input_batch = FrameBatch(
+            cast(in_data, POINTER(c_uint8)),
+            len(in_data),
+            cast(in_offsets, POINTER(c_uint32)),
+            cast(in_lengths, POINTER(c_uint32)),
+            num_frames,
+        )
+
+        result = BatchResult(
+            bytearray(num_frames * frame_capacity),
+            _zeroed_uint32(num_frames),
+            _zeroed_uint32(num_frames),
+            _zeroed_uint32(num_frames),
+        )
+        out_data = (c_uint8 * len(result.data)).from_buffer(result.data)
+        output_batch = FrameBatch(
+            cast(out_data, POINTER(c_uint8)),
+            len(result.data),
+            cast((c_uint32 * num_frames).from_buffer(result.offsets), POINTER(c_uint32)),
+            cast((c_uint32 * num_frames).from_buffer(result.lengths), POINTER(c_uint32)),
+            0,
+        )
+        statuses = (c_uint * num_frames).from_buffer(result.statuses)
+
+        res = function(pointer(self._config), pointer(input_batch), pointer(output_batch), statuses)
+        if res != 0:
+            raise ValueError("Could not run the batch. OBC GS Error Code: " + str(res))
+
+        return result
+
+
+def _join(frames: Iterable[bytes]) -> tuple[bytes, list[int], list[int]]:
+    """
+    Joins frames into one buffer
+
+    :param frames: The frames to join
+    :return: The buffer, the offset of each frame and the length of each frame
+    """
+    frame_list = list(frames)
+    lengths = [len(frame) for frame in frame_list]
+    offsets = []
+    offset = 0
+    for length in lengths:
+        offsets.append(offset)
+        offset += length
+    return b"".join(frame_list), offsets, lengths
+
+
+def _uint8_array(data: bytes) -> Array[c_uint8]:
+    """
+    Views a bytes-like object as a ctypes array, copying it only if it is read only
+    """
+    view = memoryview(data).cast("B")
+    if view.readonly:
+        return (c_uint8 * len(view)).from_buffer_copy(view)
+    return (c_uint8 * len(view)).from_buffer(view)
+
+
+def _uint32_array(values: Sequence[int]) -> Array[c_uint32]:
+    """
+    Views a buffer of uint32 (an array("I") or uint32 numpy array) as a ctypes array, or copies any other sequence of
+    ints into one
+    """
+    try:
+        view = memoryview(values)  # type: ignore
+    except TypeError:
+        return (c_uint32 * len(values))(*values)
+
+    if view.format == "I" and view.itemsize == 4 and view.c_contiguous and not view.readonly:
+        return (c_uint32 * len(view)).from_buffer(view)
+    return (c_uint32 * len(view))(*view.tolist())
+
+
+def _zeroed_uint32(count: int) -> "array[int]":
+    """
+    :return: An array("I") of count zeros
+    """
+    values = array("I", bytes(4 * count))
+    if values.itemsize != 4:
+        raise RuntimeError("array('I') must hold 32 bit values for the C implementation")
+    return values
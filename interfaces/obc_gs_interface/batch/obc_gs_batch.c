@@ -0,0 +1,239 @@
+#include "obc_gs_batch.h"
+#include "obc_gs_aes128.h"
+#include "obc_gs_ax25.h"
+#include "obc_gs_erasure_hints.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <aes.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+const uint32_t batchEncodedFrameMaxLen = BATCH_ENCODED_FRAME_MAX_LEN;
+const uint32_t batchDecodedFrameLen = BATCH_DECODED_FRAME_LEN;
+
+/**
+ * @brief checks that every frame of a batch lies inside its buffer and that the output arrays exist
+ */
+static bool isBatchUsable(const frame_batch_t *input, const frame_batch_t *output, const obc_gs_error_code_t *statuses);
+
+/**
+ * @brief finds the frame of a batch, or returns NULL if it does not lie inside the batch's buffer
+ */
+static const uint8_t *getFrame(const frame_batch_t *batch, uint32_t index);
+
+/**
+ * @brief encodes one payload into outputFrame and sets outputFrameLen to its length
+ */
+static obc_gs_error_code_t encodeFrame(const struct AES_ctx *aesCtx, const ax25_addr_t *destAddress, uint8_t sendSeq,
+                                       const uint8_t *payload, uint32_t payloadLen, uint8_t *outputFrame,
+                                       uint32_t outputCapacity, uint32_t *outputFrameLen);
+
+/**
+ * @brief decodes one stuffed frame into outputPayload and sets outputPayloadLen to its length
+ */
+static obc_gs_error_code_t decodeFrame(const struct AES_ctx *aesCtx, const uint8_t *frame, uint32_t frameLen,
+                                       uint8_t *outputPayload, uint32_t outputCapacity, uint32_t *outputPayloadLen);
+
+obc_gs_error_code_t batchEncodeFrames(const batch_config_t *config, const frame_batch_t *input, frame_batch_t *output,
+                                      obc_gs_error_code_t *statuses) {
+  if (config == NULL || !isBatchUsable(input, output, statuses)) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (config->destCallSign == NULL || (config->aesKey != NULL && config->aesIv == NULL)) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (config->firstSendSeq >= MAX_CONTINUOUS_PACKETS_ALLOWED) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  ax25_addr_t destAddress = {0};
+  obc_gs_error_code_t errCode = ax25GetDestAddress(&destAddress, (uint8_t *)config->destCallSign,
+                                                   config->destCallSignLength, DEFAULT_SSID, DEFAULT_CONTROL_BIT);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  // The key is expanded once for the whole batch; each frame restarts the counter from the IV
+  struct AES_ctx aesCtx;
+  if (config->aesKey != NULL) {
+    AES_init_ctx_iv(&aesCtx, config->aesKey, config->aesIv);
+  }
+
+  uint32_t outputIndex = 0;
+  uint8_t sendSeq = config->firstSendSeq;
+  for (uint32_t i = 0; i < input->numFrames; ++i) {
+    const uint8_t *payload = getFrame(input, i);
+    uint32_t frameLen = 0;
+
+    statuses[i] = (payload == NULL) ? OBC_GS_ERR_CODE_INVALID_ARG
+                                    : encodeFrame((config->aesKey != NULL) ? &aesCtx : NULL, &destAddress, sendSeq,
+                                                  payload, input->lengths[i], output->data + outputIndex,
+                                                  output->dataLen - outputIndex, &frameLen);
+
+    output->offsets[i] = outputIndex;
+    output->lengths[i] = frameLen;
+    outputIndex += frameLen;
+
+    if (statuses[i] == OBC_GS_ERR_CODE_SUCCESS) {
+      sendSeq = (sendSeq + 1) % MAX_CONTINUOUS_PACKETS_ALLOWED;
+    }
+  }
+
+  output->numFrames = input->numFrames;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t batchDecodeFrames(const batch_config_t *config, const frame_batch_t *input, frame_batch_t *output,
+                                      obc_gs_error_code_t *statuses) {
+  if (config == NULL || !isBatchUsable(input, output, statuses)) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (config->aesKey != NULL && config->aesIv == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  struct AES_ctx aesCtx;
+  if (config->aesKey != NULL) {
+    AES_init_ctx_iv(&aesCtx, config->aesKey, config->aesIv);
+  }
+
+  uint32_t outputIndex = 0;
+  for (uint32_t i = 0; i < input->numFrames; ++i) {
+    const uint8_t *frame = getFrame(input, i);
+    uint32_t payloadLen = 0;
+
+    statuses[i] = (frame == NULL) ? OBC_GS_ERR_CODE_INVALID_ARG
+                                  : decodeFrame((config->aesKey != NULL) ? &aesCtx : NULL, frame, input->lengths[i],
+                                                output->data + outputIndex, output->dataLen - outputIndex,
+                                                &payloadLen);
+
+    output->offsets[i] = outputIndex;
+    output->lengths[i] = payloadLen;
+    outputIndex += payloadLen;
+  }
+
+  output->numFrames = input->numFrames;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+static bool isBatchUsable(const frame_batch_t *input, const frame_batch_t *output, const obc_gs_error_code_t *statuses) {
+  if (input == NULL || output == NULL || statuses == NULL) {
+    return false;
+  }
+
+  if (input->numFrames == 0) {
+    return true;
+  }
+
+  return input->data != NULL && input->offsets != NULL && input->lengths != NULL && output->data != NULL &&
+         output->offsets != NULL && output->lengths != NULL;
+}
+
+static const uint8_t *getFrame(const frame_batch_t *batch, uint32_t index) {
+  // Done in 64 bits so a bad offset cannot wrap around into the buffer
+  if ((uint64_t)batch->offsets[index] + batch->lengths[index] > batch->dataLen) {
+    return NULL;
+  }
+
+  return batch->data + batch->offsets[index];
+}
+
+static obc_gs_error_code_t encodeFrame(const struct AES_ctx *aesCtx, const ax25_addr_t *destAddress, uint8_t sendSeq,
+                                       const uint8_t *payload, uint32_t payloadLen, uint8_t *outputFrame,
+                                       uint32_t outputCapacity, uint32_t *outputFrameLen) {
+  if (payloadLen > RS_DECODED_SIZE) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint8_t plaintext[RS_DECODED_SIZE] = {0};
+  memcpy(plaintext, payload, payloadLen);
+
+  if (aesCtx != NULL) {
+    // CTR mode writes the counter into the context, so each frame works on a copy
+    struct AES_ctx ctx = *aesCtx;
+    AES_CTR_xcrypt_buffer(&ctx, plaintext, RS_DECODED_SIZE);
+  }
+
+  packed_rs_packet_t rsData;
+  obc_gs_error_code_t errCode = rsEncode(plaintext, &rsData);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  unstuffed_ax25_i_frame_t unstuffedPacket;
+  errCode = ax25BuildIFrame(rsData.data, RS_ENCODED_SIZE, destAddress, sendSeq, 0, &unstuffedPacket);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  packed_ax25_i_frame_t stuffedPacket;
+  errCode = ax25Stuff(unstuffedPacket.data, unstuffedPacket.length, stuffedPacket.data, &stuffedPacket.length);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  if (stuffedPacket.length > outputCapacity) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  memcpy(outputFrame, stuffedPacket.data, stuffedPacket.length);
+  *outputFrameLen = stuffedPacket.length;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+static obc_gs_error_code_t decodeFrame(const struct AES_ctx *aesCtx, const uint8_t *frame, uint32_t frameLen,
+                                       uint8_t *outputPayload, uint32_t outputCapacity, uint32_t *outputPayloadLen) {
+  if (frameLen > AX25_MAXIMUM_PKT_LEN) {
+    return OBC_GS_ERR_CODE_INVALID_AX25_PACKET;
+  }
+
+  unstuffed_ax25_i_frame_t unstuffedPacket;
+  rs_erasure_hints_t erasureHints;
+  obc_gs_error_code_t errCode =
+      ax25UnstuffWithErasureHints(frame, (uint16_t)frameLen, NULL, 0, &unstuffedPacket, &erasureHints);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  bool isInfoFrame = (unstuffedPacket.length == AX25_MINIMUM_I_FRAME_LEN);
+  uint8_t decoded[RS_DECODED_SIZE];
+  if (isInfoFrame) {
+    packed_rs_packet_t rsData;
+    memcpy(rsData.data, unstuffedPacket.data + AX25_INFO_FIELD_POSITION, RS_ENCODED_SIZE);
+    errCode = rsDecodeWithErasureHints(&rsData, &erasureHints, decoded, RS_DECODED_SIZE, NULL);
+    if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+      return errCode;
+    }
+    // The FCS covers the corrected codeword, parity included
+    memcpy(unstuffedPacket.data + AX25_INFO_FIELD_POSITION, rsData.data, RS_ENCODED_SIZE);
+  }
+
+  errCode = ax25CheckFrame(&unstuffedPacket);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  if (!isInfoFrame) {
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  if (outputCapacity < RS_DECODED_SIZE) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  if (aesCtx != NULL) {
+    struct AES_ctx ctx = *aesCtx;
+    AES_CTR_xcrypt_buffer(&ctx, decoded, RS_DECODED_SIZE);
+  }
+
+  memcpy(outputPayload, decoded, RS_DECODED_SIZE);
+  *outputPayloadLen = RS_DECODED_SIZE;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
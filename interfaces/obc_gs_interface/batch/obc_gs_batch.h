@@ -0,0 +1,86 @@
+#pragma once
+
+#include "obc_gs_ax25.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <stdint.h>
+
+/*
+ * Runs the whole comms pipeline over many frames in one call, for callers such as the Python bindings where crossing
+ * into C costs more than the work done per frame:
+ *   encode: pad to 223 bytes -> AES-128 CTR (optional) -> Reed-Solomon -> AX.25 I frame -> bit stuffing
+ *   decode: bit unstuffing -> Reed-Solomon with erasure hints -> AX.25 address and FCS check -> AES-128 CTR (optional)
+ *
+ * Frames are passed in one buffer and located by offset and length, so a recorded pass can be handed over as it was
+ * read without copying each frame out first. Neither function touches the AX.25 link state.
+ */
+
+/* Space to reserve per frame in the output of batchEncodeFrames and batchDecodeFrames */
+#define BATCH_ENCODED_FRAME_MAX_LEN (AX25_MAXIMUM_PKT_LEN)
+#define BATCH_DECODED_FRAME_LEN RS_DECODED_SIZE
+
+typedef struct {
+  const uint8_t *aesKey;        // AES-128 key; NULL leaves the payload unencrypted
+  const uint8_t *aesIv;         // CTR mode IV, the same for every frame; required with aesKey
+  const uint8_t *destCallSign;  // Destination of encoded frames; not used when decoding
+  uint8_t destCallSignLength;   // Number of characters in destCallSign
+  uint8_t firstSendSeq;         // N(S) of the first encoded frame; later frames count up as with ax25SendIFrame
+} batch_config_t;
+
+typedef struct {
+  uint8_t *data;      // Frames, back to back or anywhere in the buffer
+  uint32_t dataLen;   // Bytes in data; for an output batch, the space available
+  uint32_t *offsets;  // Index in data of the first byte of each frame
+  uint32_t *lengths;  // Number of bytes in each frame
+  uint32_t numFrames;
+} frame_batch_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* BATCH_ENCODED_FRAME_MAX_LEN and BATCH_DECODED_FRAME_LEN, for bindings that cannot see the macros */
+extern const uint32_t batchEncodedFrameMaxLen;
+extern const uint32_t batchDecodedFrameLen;
+
+/**
+ * @brief encodes a batch of payloads into stuffed AX.25 I frames
+ *
+ * A payload shorter than 223 bytes is padded with zeros. Each payload gets a status in statuses; a payload that is too
+ * long, falls outside input->data or would not fit in output->data is skipped and gets a length of 0.
+ *
+ * @param config encryption and addressing of the frames
+ * @param input payloads of at most 223 bytes
+ * @param output frames are written back to back into output->data, and their offsets and lengths into output->offsets
+ * and output->lengths, which must hold input->numFrames entries; output->numFrames is set to input->numFrames
+ * @param statuses set to the result of each frame; must hold input->numFrames entries
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if the arguments are unusable, otherwise
+ * OBC_GS_ERR_CODE_SUCCESS even if some frames failed
+ */
+obc_gs_error_code_t batchEncodeFrames(const batch_config_t *config, const frame_batch_t *input, frame_batch_t *output,
+                                      obc_gs_error_code_t *statuses);
+
+/**
+ * @brief decodes a batch of stuffed AX.25 frames
+ *
+ * An I frame decodes to its 223 byte payload. A frame without an info field, such as a U frame, is checked and then
+ * decodes to 0 bytes. A frame that fails any step gets its error in statuses and a length of 0.
+ *
+ * @param config decryption of the frames
+ * @param input stuffed frames including both flags
+ * @param output payloads are written back to back into output->data, and their offsets and lengths into
+ * output->offsets and output->lengths, which must hold input->numFrames entries; output->numFrames is set to
+ * input->numFrames
+ * @param statuses set to the result of each frame; must hold input->numFrames entries
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if the arguments are unusable, otherwise
+ * OBC_GS_ERR_CODE_SUCCESS even if some frames failed
+ */
+obc_gs_error_code_t batchDecodeFrames(const batch_config_t *config, const frame_batch_t *input, frame_batch_t *output,
+                                      obc_gs_error_code_t *statuses);
+
+#ifdef __cplusplus
+}
+#endif
@@ -131,6 +131,15 @@ interface.unpackCmdResponse.argtypes = (
 )
 interface.unpackCmdResponse.restype = c_uint
 
+interface.unpackNextCmdResponse.argtypes = (
+    POINTER(c_uint8 * RS_DECODED_DATA_SIZE),
+    c_uint32,
+    POINTER(c_uint32),
+    POINTER(CmdResponseHeader),
+    POINTER(c_uint8 * RS_DECODED_DATA_SIZE),
+)
+interface.unpackNextCmdResponse.restype = c_uint
+
 
 # ######################################################################
 # ||                                                                  ||
@@ -159,7 +168,8 @@ class CmdCallbackId(IntEnum):
     CMD_DOWNLOAD_DATA = 10
     CMD_VERIFY_CRC = 11
     CMD_I2C_PROBE = 12
-    NUM_CMD_CALLBACKS = 13
+    CMD_GNC_TIMING_STATS = 13
+    NUM_CMD_CALLBACKS = 14
 
 
 # Path to File: interfaces/obc_gs_interface/commands/obc_gs_commands_response.h
@@ -393,6 +403,20 @@ def create_cmd_i2c_probe(unixtime_of_execution: int | None = None) -> CmdMsg:
     return cmd_msg
 
 
+def create_cmd_gnc_timing_stats(unixtime_of_execution: int | None = None) -> CmdMsg:
+    """
+    Function to create a CmdMsg structure for CMD_GNC_TIMING_STATS
+
+    :param unixtime_of_execution: A time of when to execute a certain event,
+                                  by default, it is set to None (i.e. a specific
+                                  time is not needed)
+    :return: CmdMsg structure for CMD_GNC_TIMING_STATS
+    """
+    cmd_msg = CmdMsg(unixtime_of_execution)
+    cmd_msg.id = CmdCallbackId.CMD_GNC_TIMING_STATS
+    return cmd_msg
+
+
 # ######################################################################
 # ||                                                                  ||
 # ||             Command Pack and Unpack Implementations              ||
@@ -513,3 +537,35 @@ def unpack_command_response(cmd_msg_packed: bytes) -> tuple[CmdResponseHeader, b
         raise ValueError("Could not unpack command response. OBC Error Code: " + str(res))
 
     return cmd_msg_response, data_bytes
+
+
+def unpack_command_responses(cmd_msg_packed: bytes) -> list[tuple[CmdResponseHeader, bytes]]:
+    """
+    This takes in a block of data that may hold several command responses coalesced by the OBC and unpacks each of
+    them (see unpackNextCmdResponse in the C implementation)
+
+    :param cmd_msg_packed: Bytes of an already encoded block of responses
+    :return: A list of the unpacked command responses and their data
+    """
+    if len(cmd_msg_packed) > RS_DECODED_DATA_SIZE:
+        raise ValueError("The encoded command reponse data to unpack is too long")
+
+    buffer_elements = list(cmd_msg_packed)
+    buff = (c_uint8 * RS_DECODED_DATA_SIZE)(*buffer_elements)
+    offset = c_uint32(0)
+    responses: list[tuple[CmdResponseHeader, bytes]] = []
+
+    while True:
+        data_buffer = (c_uint8 * RS_DECODED_DATA_SIZE)()
+        cmd_msg_response = CmdResponseHeader()
+        res = interface.unpackNextCmdResponse(
+            pointer(buff), len(cmd_msg_packed), pointer(offset), pointer(cmd_msg_response), pointer(data_buffer)
+        )
+
+        if res != 0:
+            raise ValueError("Could not unpack command response. OBC Error Code: " + str(res))
+
+        if cmd_msg_response.cmdId == CmdCallbackId.CMD_END_OF_FRAME:
+            return responses
+
+        responses.append((cmd_msg_response, bytes(data_buffer)))
@@ -1,8 +1,10 @@
 from collections import defaultdict
 from collections.abc import Callable
 
-from interfaces.obc_gs_interface.commands import CmdCallbackId, unpack_command_response
+from interfaces.obc_gs_interface.commands import CmdCallbackId, unpack_command_response, unpack_command_responses
+from interfaces.obc_gs_interface.telemetry import TELEM_GNC_HIST_NUM_BINS
 from interfaces.obc_gs_interface.commands.command_response_classes import (
+    CmdGncTimingStatsRes,
     CmdI2CProbeRes,
     CmdRes,
     CmdRtcSyncRes,
@@ -73,12 +75,42 @@ def parse_cmd_i2c_probe(cmd_response: CmdRes, data: bytes) -> CmdI2CProbeRes:
     return CmdI2CProbeRes(cmd_response.cmd_id, cmd_response.error_code, cmd_response.response_length, valid_addresses)
 
 
+def parse_cmd_gnc_timing_stats(cmd_response: CmdRes, data: bytes) -> CmdGncTimingStatsRes:
+    """
+    A function to parse the raw data from the response of CMD_GNC_TIMING_STATS
+
+    :param cmd_response: Basic command response
+    :param data: The raw bytes containing the data that needs to be parsed
+    :return: CmdGncTimingStatsRes (i.e. The command response for CMD_GNC_TIMING_STATS)
+    """
+    if cmd_response.cmd_id != CmdCallbackId.CMD_GNC_TIMING_STATS:
+        raise ValueError("Wrong command id for parsing the gnc timing stats command")
+
+    # Four counters followed by the two histograms, all 4 byte words
+    words = [int.from_bytes(data[i : i + 4], "little") for i in range(0, 4 * (4 + 2 * TELEM_GNC_HIST_NUM_BINS), 4)]
+    start_latency_hist = words[4 : 4 + TELEM_GNC_HIST_NUM_BINS]
+    exec_time_hist = words[4 + TELEM_GNC_HIST_NUM_BINS :]
+
+    return CmdGncTimingStatsRes(
+        cmd_response.cmd_id,
+        cmd_response.error_code,
+        cmd_response.response_length,
+        words[0],
+        words[1],
+        words[2],
+        words[3],
+        start_latency_hist,
+        exec_time_hist,
+    )
+
+
 # Function array where each index corresponds to the command enum value + 1
 
 parse_func_dict: dict[CmdCallbackId, Callable[..., CmdRes]] = defaultdict(lambda: parse_cmd_with_no_data)
 parse_func_dict[CmdCallbackId.CMD_VERIFY_CRC] = parse_cmd_verify_crc
 parse_func_dict[CmdCallbackId.CMD_RTC_SYNC] = parse_cmd_rtc_sync
 parse_func_dict[CmdCallbackId.CMD_I2C_PROBE] = parse_cmd_i2c_probe
+parse_func_dict[CmdCallbackId.CMD_GNC_TIMING_STATS] = parse_cmd_gnc_timing_stats
 
 
 def parse_command_response(data: bytes) -> CmdRes:
@@ -94,6 +126,21 @@ def parse_command_response(data: bytes) -> CmdRes:
     return cmd_parsed
 
 
+def parse_command_responses(data: bytes) -> list[CmdRes]:
+    """
+    A function that unpacks every command response in a block and returns their response structures. The OBC
+    coalesces the responses of consecutive commands into one block when they fit.
+
+    :param data: The bytes of data the commands are packed in
+    """
+    cmd_responses = []
+    for cmd_response_raw, data_bytes in unpack_command_responses(data):
+        cmd_response = CmdRes(CmdCallbackId(cmd_response_raw.cmdId), cmd_response_raw.errCode, cmd_response_raw.dataLen)
+        cmd_responses.append(parse_func_dict[cmd_response.cmd_id](cmd_response, data_bytes))
+
+    return cmd_responses
+
+
 if __name__ == "__main__":
     data_bytes = b"\x0b\x01\x04\x78\x56\x34\x12\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
     print(parse_command_response(data_bytes))
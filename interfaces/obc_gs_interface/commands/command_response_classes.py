@@ -100,6 +100,47 @@ class CmdI2CProbeRes(CmdRes):
         return formatted_string
 
 
+@dataclass
+class CmdGncTimingStatsRes(CmdRes):
+    """
+    Class for storing the response to CMD_GNC_TIMING_STATS
+
+    :param cycles: The number of GNC cycles run since boot
+    :type cycles: int
+    :param deadline_misses: The number of cycles that finished after the next cycle was due
+    :type deadline_misses: int
+    :param max_start_latency_us: The latest a cycle started after it was due, in microseconds
+    :type max_start_latency_us: int
+    :param max_exec_time_us: The longest the model steps of a cycle took, in microseconds
+    :type max_exec_time_us: int
+    :param start_latency_hist: Cycles per start latency bin (see TELEM_GNC_HIST_NUM_BINS for the bin edges)
+    :type start_latency_hist: list[int]
+    :param exec_time_hist: Cycles per execution time bin
+    :type exec_time_hist: list[int]
+    """
+
+    cycles: int
+    deadline_misses: int
+    max_start_latency_us: int
+    max_exec_time_us: int
+    start_latency_hist: list[int]
+    exec_time_hist: list[int]
+
+    def __str__(self) -> str:
+        """
+        Overriding the str method for a better representation of what's happening
+        """
+        formatted_string = super().__str__()
+        formatted_string += "GNC Cycles: " + str(self.cycles) + "\n"
+        formatted_string += "Deadline Misses: " + str(self.deadline_misses) + "\n"
+        formatted_string += "Max Start Latency (us): " + str(self.max_start_latency_us) + "\n"
+        formatted_string += "Max Execution Time (us): " + str(self.max_exec_time_us) + "\n"
+        formatted_string += "Start Latency Histogram: " + str(self.start_latency_hist) + "\n"
+        formatted_string += "Execution Time Histogram: " + str(self.exec_time_hist) + "\n"
+
+        return formatted_string
+
+
 if __name__ == "__main__":
     cmd = CmdVerifyCrcRes(CmdCallbackId.CMD_VERIFY_CRC, CmdResponseErrorCode.CMD_RESPONSE_ERROR, 4, 0x12345678)
     print(cmd)
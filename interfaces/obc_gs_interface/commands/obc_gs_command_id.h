@@ -49,5 +49,6 @@ typedef enum {
   CMD_DOWNLOAD_DATA,
   CMD_VERIFY_CRC,
   CMD_I2C_PROBE,
+  CMD_GNC_TIMING_STATS,
   NUM_CMD_CALLBACKS
 } cmd_callback_id_t;
@@ -46,6 +46,9 @@ static void packVerifyCrcCmdData(uint8_t* buffer, uint32_t* offset, const cmd_ms
 // CMD_I2C_PROBE
 static void packI2CProbeCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t* msg);
 
+// CMD_GNC_TIMING_STATS
+static void packGncTimingStatsCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t* msg);
+
 typedef void (*pack_func_t)(uint8_t*, uint32_t*, const cmd_msg_t*);
 
 static const pack_func_t packFns[] = {
@@ -61,6 +64,7 @@ static const pack_func_t packFns[] = {
     [CMD_ERASE_APP] = packEraseAppCmdData,
     [CMD_VERIFY_CRC] = packVerifyCrcCmdData,
     [CMD_I2C_PROBE] = packI2CProbeCmdData,
+    [CMD_GNC_TIMING_STATS] = packGncTimingStatsCmdData,
     // Add more functions for other commands as needed
 };
 
@@ -153,3 +157,8 @@ static void packVerifyCrcCmdData(uint8_t* buffer, uint32_t* offset, const cmd_ms
 static void packI2CProbeCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t* msg) {
   // No data to pack
 }
+
+// CMD_GNC_TIMING_STATS
+static void packGncTimingStatsCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t* msg) {
+  // No data to pack
+}
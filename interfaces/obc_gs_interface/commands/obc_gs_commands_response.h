@@ -8,6 +8,7 @@
 
 #define CMD_RESPONSE_SUCCESS_MASK 0x01
 #define CMD_RESPONSE_DATA_MAX_SIZE 220
+#define CMD_RESPONSE_HEADER_SIZE 3  // cmdId, errCode and dataLen, one byte each
 
 // NOTE: Update python error codes as well when these are updated
 typedef enum { CMD_RESPONSE_SUCCESS = 0x01, CMD_RESPONSE_ERROR = 0x7F } cmd_response_error_code_t;
@@ -23,3 +23,28 @@ obc_gs_error_code_t packCmdResponse(cmd_response_header_t* cmdResHeader, uint8_t
 
   return OBC_GS_ERR_CODE_SUCCESS;
 }
+
+obc_gs_error_code_t appendCmdResponse(const cmd_response_header_t* cmdResHeader, const uint8_t* responseData,
+                                      uint8_t* buffer, uint32_t bufferLen, uint32_t* offset) {
+  if (cmdResHeader == NULL || buffer == NULL || offset == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+  if (responseData == NULL && cmdResHeader->dataLen > 0) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (cmdResHeader->cmdId == CMD_END_OF_FRAME || cmdResHeader->cmdId >= NUM_CMD_CALLBACKS ||
+      cmdResHeader->dataLen > CMD_RESPONSE_DATA_MAX_SIZE) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (*offset > bufferLen || bufferLen - *offset < CMD_RESPONSE_HEADER_SIZE + (uint32_t)cmdResHeader->dataLen) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  packUint8((uint8_t)cmdResHeader->cmdId, buffer, offset);
+  packUint8((uint8_t)cmdResHeader->errCode, buffer, offset);
+  packUint8((uint8_t)cmdResHeader->dataLen, buffer, offset);
+  if (cmdResHeader->dataLen > 0) {
+    memcpy(&buffer[*offset], responseData, cmdResHeader->dataLen);
+    *offset += cmdResHeader->dataLen;
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
@@ -21,6 +21,24 @@ extern "C" {
  */
 obc_gs_error_code_t packCmdResponse(cmd_response_header_t* cmdResHeader, uint8_t* buffer, uint8_t* responseData);
 
+/**
+ * @brief Append a command response to a buffer that may already hold other responses.
+ *
+ * Only the header and the first dataLen bytes of responseData are written, so several responses can share one RS
+ * block. The unused tail of the block must be left zeroed; a cmdId of CMD_END_OF_FRAME marks the end of the
+ * responses. A block holding one response is laid out the same as the output of packCmdResponse.
+ *
+ * @param cmdResHeader The header of the response to append
+ * @param responseData The response data; may be NULL if dataLen is 0
+ * @param buffer The buffer to append to
+ * @param bufferLen Size of buffer in bytes
+ * @param offset Offset in buffer to write at; advanced past the response on success
+ * @return Error code indicating if the packing operation was successful. OBC_GS_ERR_CODE_BUFF_TOO_SMALL if the
+ * response does not fit in the rest of the buffer, in which case nothing is written.
+ */
+obc_gs_error_code_t appendCmdResponse(const cmd_response_header_t* cmdResHeader, const uint8_t* responseData,
+                                      uint8_t* buffer, uint32_t bufferLen, uint32_t* offset);
+
 #ifdef __cplusplus
 }
 #endif
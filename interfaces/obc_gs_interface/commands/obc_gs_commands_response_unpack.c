@@ -23,3 +23,36 @@ obc_gs_error_code_t unpackCmdResponse(uint8_t* buffer, cmd_response_header_t* re
   memcpy(responseDataBuffer, &buffer[offset], CMD_RESPONSE_DATA_MAX_SIZE);
   return errCode;
 }
+
+obc_gs_error_code_t unpackNextCmdResponse(const uint8_t* buffer, uint32_t bufferLen, uint32_t* offset,
+                                          cmd_response_header_t* response, uint8_t* responseDataBuffer) {
+  if (buffer == NULL || offset == NULL || response == NULL || responseDataBuffer == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  memset(responseDataBuffer, 0, CMD_RESPONSE_DATA_MAX_SIZE);
+
+  // A zero cmdId or a tail too short for a header ends the responses in the block
+  if (*offset >= bufferLen || bufferLen - *offset < CMD_RESPONSE_HEADER_SIZE || buffer[*offset] == CMD_END_OF_FRAME) {
+    response->cmdId = CMD_END_OF_FRAME;
+    response->errCode = CMD_RESPONSE_SUCCESS;
+    response->dataLen = 0;
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  uint32_t readOffset = *offset;
+  uint8_t cmdId = unpackUint8(buffer, &readOffset);
+  if (cmdId >= NUM_CMD_CALLBACKS) return OBC_GS_ERR_CODE_UNSUPPORTED_CMD;
+
+  cmd_response_error_code_t errCode = (cmd_response_error_code_t)unpackUint8(buffer, &readOffset);
+  uint8_t dataLen = unpackUint8(buffer, &readOffset);
+  if (dataLen > CMD_RESPONSE_DATA_MAX_SIZE || bufferLen - readOffset < dataLen) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  response->cmdId = (cmd_callback_id_t)cmdId;
+  response->errCode = errCode;
+  response->dataLen = dataLen;
+  memcpy(responseDataBuffer, &buffer[readOffset], dataLen);
+  *offset = readOffset + dataLen;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
@@ -22,6 +22,21 @@ extern "C" {
  */
 obc_gs_error_code_t unpackCmdResponse(uint8_t* buffer, cmd_response_header_t* response, uint8_t* responseDataBuffer);
 
+/**
+ * @brief Unpack the next response from a buffer of responses packed with appendCmdResponse.
+ * @param buffer A buffer of bytes from which to read the packed data
+ * @param bufferLen Size of buffer in bytes
+ * @param offset Offset in buffer of the next response; advanced past it on success
+ * @param response Set to the header of the unpacked response. cmdId is CMD_END_OF_FRAME if there are no responses
+ * left, in which case offset is not moved.
+ * @param responseDataBuffer Buffer of at least CMD_RESPONSE_DATA_MAX_SIZE bytes. Set to the response data followed by
+ * zeros.
+ * @return Error code indicating if the unpacking was successful. OBC_GS_ERR_CODE_UNSUPPORTED_CMD if the unpacked cmd
+ * was not valid and OBC_GS_ERR_CODE_INVALID_ARG if the response runs past the end of the buffer.
+ */
+obc_gs_error_code_t unpackNextCmdResponse(const uint8_t* buffer, uint32_t bufferLen, uint32_t* offset,
+                                          cmd_response_header_t* response, uint8_t* responseDataBuffer);
+
 #ifdef __cplusplus
 }
 #endif
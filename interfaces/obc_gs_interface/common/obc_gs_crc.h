@@ -2,6 +2,28 @@
 
 #include <stdint.h>
 
+/*
+ * CRC algorithms. OBC_GS_CRC_ALGORITHM selects the implementation used by calculateCrc16Ccitt, crc16CcittUpdate and
+ * crc32 at build time; every algorithm up to and including the selected one is also available through its own entry
+ * point. Larger table sets trade flash for throughput:
+ *   - OBC_GS_CRC_BITWISE: no tables, one bit per iteration
+ *   - OBC_GS_CRC_SARWATE: one 256-entry table per CRC (1.5 KB), one byte per lookup
+ *   - OBC_GS_CRC_SLICE_BY_4: four tables per CRC (6 KB), four bytes per iteration
+ *   - OBC_GS_CRC_SLICE_BY_8: eight tables per CRC (12 KB), eight bytes per iteration
+ */
+#define OBC_GS_CRC_BITWISE 0U
+#define OBC_GS_CRC_SARWATE 1U
+#define OBC_GS_CRC_SLICE_BY_4 2U
+#define OBC_GS_CRC_SLICE_BY_8 3U
+
+#ifndef OBC_GS_CRC_ALGORITHM
+#define OBC_GS_CRC_ALGORITHM OBC_GS_CRC_SARWATE
+#endif
+
+#if OBC_GS_CRC_ALGORITHM > OBC_GS_CRC_SLICE_BY_8
+#error "Invalid OBC_GS_CRC_ALGORITHM"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -16,7 +38,46 @@ extern "C" {
  */
 uint16_t calculateCrc16Ccitt(const uint8_t *data, uint16_t dataLen);
 
-uint32_t crc32(uint32_t crc, uint8_t *data, uint32_t dataLen);
+/**
+ * @brief continues a CRC16-CCITT computation over another chunk of data
+ *
+ * @param crc: the value returned for the previous chunk, or 0 to start a new checksum
+ * @param data: the data to add to the checksum
+ * @param dataLen: length of the data
+ *
+ * @return updated checksum; calculateCrc16Ccitt(data, len) == crc16CcittUpdate(0, data, len)
+ */
+uint16_t crc16CcittUpdate(uint16_t crc, const uint8_t *data, uint32_t dataLen);
+
+/**
+ * @brief computes the CRC32 (IEEE 802.3, same as zlib) of a buffer
+ *
+ * @param crc: the value returned for the previous chunk, or 0 to start a new checksum
+ * @param data: the data to add to the checksum
+ * @param dataLen: length of the data
+ *
+ * @return updated checksum
+ */
+uint32_t crc32(uint32_t crc, const uint8_t *data, uint32_t dataLen);
+
+/* Per-algorithm entry points with the same semantics as crc16CcittUpdate and crc32 */
+uint16_t crc16CcittUpdateBitwise(uint16_t crc, const uint8_t *data, uint32_t dataLen);
+uint32_t crc32Bitwise(uint32_t crc, const uint8_t *data, uint32_t dataLen);
+
+#if OBC_GS_CRC_ALGORITHM >= OBC_GS_CRC_SARWATE
+uint16_t crc16CcittUpdateSarwate(uint16_t crc, const uint8_t *data, uint32_t dataLen);
+uint32_t crc32Sarwate(uint32_t crc, const uint8_t *data, uint32_t dataLen);
+#endif
+
+#if OBC_GS_CRC_ALGORITHM >= OBC_GS_CRC_SLICE_BY_4
+uint16_t crc16CcittUpdateSliceBy4(uint16_t crc, const uint8_t *data, uint32_t dataLen);
+uint32_t crc32SliceBy4(uint32_t crc, const uint8_t *data, uint32_t dataLen);
+#endif
+
+#if OBC_GS_CRC_ALGORITHM >= OBC_GS_CRC_SLICE_BY_8
+uint16_t crc16CcittUpdateSliceBy8(uint16_t crc, const uint8_t *data, uint32_t dataLen);
+uint32_t crc32SliceBy8(uint32_t crc, const uint8_t *data, uint32_t dataLen);
+#endif
 
 #ifdef __cplusplus
 }
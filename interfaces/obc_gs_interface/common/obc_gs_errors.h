@@ -8,6 +8,7 @@ typedef enum {
 
   /* Pack/Unpack error codes 100-200 */
   OBC_GS_ERR_CODE_UNSUPPORTED_CMD = 2,
+  OBC_GS_ERR_CODE_INVALID_TELEM_RECORD = 100,
 
   /* AES error codes 200-300 */
 
@@ -26,6 +26,16 @@ interface.rsEncode.restype = c_uint
 interface.rsDecode.argtypes = [POINTER(PackedRsPacket), POINTER(c_uint8 * RS_DECODED_DATA_SIZE), c_uint8]
 interface.rsDecode.restype = c_uint
 
+# rsDecodeWithErasures()
+interface.rsDecodeWithErasures.argtypes = [
+    POINTER(PackedRsPacket),
+    POINTER(c_uint8),
+    c_uint8,
+    POINTER(c_uint8 * RS_DECODED_DATA_SIZE),
+    c_uint8,
+]
+interface.rsDecodeWithErasures.restype = c_uint
+
 # destroyRs()
 interface.destroyRs.argtypes = ()
 interface.destroyRs.restype = None
@@ -67,16 +77,20 @@ class FEC:
 
         return bytes(rs_data.contents.data)
 
-    def decode(self, data_to_decode: bytes) -> bytes:
+    def decode(self, data_to_decode: bytes, erasures: list[int] | None = None) -> bytes:
         """
         A function that decodes data via reed solomon for forward error correction
 
         :param data_to_decode: An array of type c_uint8 with the 255 of encoded information (must be a 255 in size to
                                avoid issues)
+        :param erasures: Optional positions of bytes known to be unreliable; up to 32 erasures can be corrected
+                         instead of 16 unknown errors
         :return: 0 for success or a number representing the obc_gs error code
         """
         if len(data_to_decode) > self._MAX_ENCODED_DATA_LEN:
             raise ValueError("Data to Decode is too long")
+        if erasures is not None and len(erasures) > self._MAX_ENCODED_DATA_LEN - self._MAX_DECODED_DATA_LEN:
+            raise ValueError("Too many erasures")
 
         rs_info = data_to_decode[-32:]
         uint_list = []
@@ -84,7 +98,13 @@ class FEC:
             uint_list.append(c_uint8(byte))
         rs_data = pointer(PackedRsPacket((c_uint8 * self._MAX_ENCODED_DATA_LEN)(*uint_list)))
         decoded_data = pointer((c_uint8 * self._MAX_DECODED_DATA_LEN)())
-        result = interface.rsDecode(rs_data, decoded_data, c_uint8(self._MAX_DECODED_DATA_LEN))
+        if erasures:
+            erasure_positions = (c_uint8 * len(erasures))(*erasures)
+            result = interface.rsDecodeWithErasures(
+                rs_data, erasure_positions, c_uint8(len(erasures)), decoded_data, c_uint8(self._MAX_DECODED_DATA_LEN)
+            )
+        else:
+            result = interface.rsDecode(rs_data, decoded_data, c_uint8(self._MAX_DECODED_DATA_LEN))
 
         if result != 0:
             raise ValueError("Could not decode object. OBC GS Error Code: " + str(result))
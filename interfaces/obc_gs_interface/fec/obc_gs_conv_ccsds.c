@@ -0,0 +1,182 @@
+#include "obc_gs_conv_ccsds.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#define CONV_CCSDS_REGISTER_MASK ((1U << CONV_CCSDS_CONSTRAINT_LENGTH) - 1U)
+#define CONV_CCSDS_STATE_MASK (CONV_CCSDS_NUM_STATES - 1U)
+#define CONV_CCSDS_HALF_STATES (CONV_CCSDS_NUM_STATES / 2U)
+
+// Start metric of states the encoder cannot be in; far above any real path, far below overflow
+#define CONV_CCSDS_UNREACHABLE_METRIC (1UL << 24)
+
+#define CONV_CCSDS_SYMBOL_MAX 255U
+
+/*
+ * convOutputs[r] is the pair of encoded bits for shift register r, whose bit 0 is the newest data bit: the 0171 output
+ * in bit 1 and the inverted 0133 output in bit 0.
+ *
+ * Both polynomials tap the newest and the oldest bit, so flipping either one flips both outputs. That gives the
+ * butterfly structure the decoder relies on: convOutputs[r ^ 1] == convOutputs[r ^ 0x40] == convOutputs[r] ^ 3.
+ */
+static const uint8_t convOutputs[1U << CONV_CCSDS_CONSTRAINT_LENGTH] = {
+    1U, 2U, 3U, 0U, 2U, 1U, 0U, 3U, 2U, 1U, 0U, 3U, 1U, 2U, 3U, 0U, 1U, 2U, 3U, 0U, 2U, 1U, 0U, 3U, 2U, 1U,
+    0U, 3U, 1U, 2U, 3U, 0U, 0U, 3U, 2U, 1U, 3U, 0U, 1U, 2U, 3U, 0U, 1U, 2U, 0U, 3U, 2U, 1U, 0U, 3U, 2U, 1U,
+    3U, 0U, 1U, 2U, 3U, 0U, 1U, 2U, 0U, 3U, 2U, 1U, 2U, 1U, 0U, 3U, 1U, 2U, 3U, 0U, 1U, 2U, 3U, 0U, 2U, 1U,
+    0U, 3U, 2U, 1U, 0U, 3U, 1U, 2U, 3U, 0U, 1U, 2U, 3U, 0U, 2U, 1U, 0U, 3U, 3U, 0U, 1U, 2U, 0U, 3U, 2U, 1U,
+    0U, 3U, 2U, 1U, 3U, 0U, 1U, 2U, 3U, 0U, 1U, 2U, 0U, 3U, 2U, 1U, 0U, 3U, 2U, 1U, 3U, 0U, 1U, 2U,
+};
+
+static void initPathMetrics(uint32_t *pathMetrics);
+static uint64_t addCompareSelect(const uint32_t *oldMetrics, uint32_t *newMetrics, uint8_t symbol0, uint8_t symbol1);
+static void traceback(const conv_ccsds_decoder_t *decoder, uint16_t dataLen, uint8_t *data);
+
+obc_gs_error_code_t convCcsdsEncode(const uint8_t *data, uint16_t dataLen, uint8_t *encoded, uint16_t encodedLen) {
+  if (data == NULL || encoded == NULL || dataLen > CONV_CCSDS_MAX_DATA_SIZE) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (encodedLen < CONV_CCSDS_ENCODED_SIZE(dataLen)) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  uint32_t shiftRegister = 0;
+  uint16_t encodedIndex = 0;
+
+  // Each data byte becomes exactly two encoded bytes
+  for (uint16_t i = 0; i < dataLen; ++i) {
+    uint16_t pairs = 0;
+    for (int8_t bit = 7; bit >= 0; --bit) {
+      shiftRegister = ((shiftRegister << 1) | ((data[i] >> bit) & 1U)) & CONV_CCSDS_REGISTER_MASK;
+      pairs = (uint16_t)((pairs << 2) | convOutputs[shiftRegister]);
+    }
+    encoded[encodedIndex++] = (uint8_t)(pairs >> 8);
+    encoded[encodedIndex++] = (uint8_t)pairs;
+  }
+
+  // Flush with zeros; the 12 tail bits fill one and a half bytes
+  uint16_t tail = 0;
+  for (uint8_t i = 0; i < CONV_CCSDS_TAIL_BITS; ++i) {
+    shiftRegister = (shiftRegister << 1) & CONV_CCSDS_REGISTER_MASK;
+    tail = (uint16_t)((tail << 2) | convOutputs[shiftRegister]);
+  }
+  tail <<= 16U - CONV_CCSDS_TAIL_BITS * CONV_CCSDS_SYMBOLS_PER_BIT;
+  encoded[encodedIndex++] = (uint8_t)(tail >> 8);
+  encoded[encodedIndex] = (uint8_t)tail;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t convCcsdsDecodeSoft(conv_ccsds_decoder_t *decoder, const uint8_t *symbols, uint16_t dataLen,
+                                        uint8_t *data) {
+  if (decoder == NULL || symbols == NULL || data == NULL || dataLen > CONV_CCSDS_MAX_DATA_SIZE) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  initPathMetrics(decoder->pathMetrics[0]);
+
+  uint32_t numSteps = CONV_CCSDS_NUM_STEPS(dataLen);
+  for (uint32_t step = 0; step < numSteps; ++step) {
+    decoder->decisions[step] = addCompareSelect(decoder->pathMetrics[step & 1U], decoder->pathMetrics[(step + 1) & 1U],
+                                                symbols[2 * step], symbols[2 * step + 1]);
+  }
+
+  traceback(decoder, dataLen, data);
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t convCcsdsDecodeHard(conv_ccsds_decoder_t *decoder, const uint8_t *encoded, uint16_t dataLen,
+                                        uint8_t *data) {
+  if (decoder == NULL || encoded == NULL || data == NULL || dataLen > CONV_CCSDS_MAX_DATA_SIZE) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  initPathMetrics(decoder->pathMetrics[0]);
+
+  uint32_t numSteps = CONV_CCSDS_NUM_STEPS(dataLen);
+  for (uint32_t step = 0; step < numSteps; ++step) {
+    // Each step takes two bits, so a pair never straddles a byte
+    uint8_t pair = (uint8_t)((encoded[step / 4U] >> (6U - 2U * (step % 4U))) & 3U);
+    uint8_t symbol0 = (pair & 2U) ? CONV_CCSDS_SYMBOL_MAX : 0U;
+    uint8_t symbol1 = (pair & 1U) ? CONV_CCSDS_SYMBOL_MAX : 0U;
+    decoder->decisions[step] =
+        addCompareSelect(decoder->pathMetrics[step & 1U], decoder->pathMetrics[(step + 1) & 1U], symbol0, symbol1);
+  }
+
+  traceback(decoder, dataLen, data);
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief starts every path in the all-zero state
+ *
+ * @param pathMetrics CONV_CCSDS_NUM_STATES metrics to reset
+ */
+static void initPathMetrics(uint32_t *pathMetrics) {
+  pathMetrics[0] = 0;
+  for (uint8_t state = 1; state < CONV_CCSDS_NUM_STATES; ++state) {
+    pathMetrics[state] = CONV_CCSDS_UNREACHABLE_METRIC;
+  }
+}
+
+/**
+ * @brief advances every survivor path by one data bit
+ *
+ * State s is the last six data bits with the newest in bit 0. New states 2i and 2i + 1 both come from states i and
+ * i + 32, and by the symmetry of convOutputs their four branches only need two branch metrics.
+ *
+ * @param oldMetrics path metrics before the step
+ * @param newMetrics set to the path metrics after the step
+ * @param symbol0 soft symbol of the 0171 output
+ * @param symbol1 soft symbol of the 0133 output
+ *
+ * @return uint64_t - bit s is set if state s was reached from the predecessor with bit 5 set
+ */
+static uint64_t addCompareSelect(const uint32_t *oldMetrics, uint32_t *newMetrics, uint8_t symbol0, uint8_t symbol1) {
+  // branchMetrics[e] is the distance between the symbols and the expected pair e
+  uint32_t branchMetrics[4];
+  branchMetrics[0] = (uint32_t)symbol0 + symbol1;
+  branchMetrics[1] = (uint32_t)symbol0 + (CONV_CCSDS_SYMBOL_MAX - symbol1);
+  branchMetrics[2] = (uint32_t)(CONV_CCSDS_SYMBOL_MAX - symbol0) + symbol1;
+  branchMetrics[3] = 2U * CONV_CCSDS_SYMBOL_MAX - branchMetrics[0];
+
+  uint64_t decisions = 0;
+  for (uint8_t i = 0; i < CONV_CCSDS_HALF_STATES; ++i) {
+    uint32_t metric = branchMetrics[convOutputs[2U * i]];
+    uint32_t inverseMetric = 2U * CONV_CCSDS_SYMBOL_MAX - metric;
+
+    uint32_t zeroFromLow = oldMetrics[i] + metric;
+    uint32_t zeroFromHigh = oldMetrics[i + CONV_CCSDS_HALF_STATES] + inverseMetric;
+    uint32_t oneFromLow = oldMetrics[i] + inverseMetric;
+    uint32_t oneFromHigh = oldMetrics[i + CONV_CCSDS_HALF_STATES] + metric;
+
+    uint64_t zeroDecision = zeroFromHigh < zeroFromLow;
+    uint64_t oneDecision = oneFromHigh < oneFromLow;
+    newMetrics[2U * i] = zeroDecision ? zeroFromHigh : zeroFromLow;
+    newMetrics[2U * i + 1U] = oneDecision ? oneFromHigh : oneFromLow;
+    decisions |= (zeroDecision | (oneDecision << 1)) << (2U * i);
+  }
+
+  return decisions;
+}
+
+/**
+ * @brief follows the survivor decisions back from the all-zero end state
+ *
+ * @param decoder holds the decisions of every step
+ * @param dataLen number of bytes in the block
+ * @param data set to the decoded block
+ */
+static void traceback(const conv_ccsds_decoder_t *decoder, uint16_t dataLen, uint8_t *data) {
+  memset(data, 0, dataLen);
+
+  uint32_t dataBits = (uint32_t)dataLen * 8U;
+  uint8_t state = 0;
+  for (uint32_t step = CONV_CCSDS_NUM_STEPS(dataLen); step-- > 0;) {
+    uint8_t decision = (uint8_t)((decoder->decisions[step] >> state) & 1U);
+    if (step < dataBits) {
+      data[step / 8U] |= (uint8_t)((state & 1U) << (7U - step % 8U));
+    }
+    state = (uint8_t)((state >> 1) | (decision << (CONV_CCSDS_CONSTRAINT_LENGTH - 2U)));
+  }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "obc_gs_errors.h"
+
+#include <stdint.h>
+
+/*
+ * CCSDS rate 1/2, constraint length 7 convolutional code: generator polynomials 0171 and 0133 (octal), with the 0133
+ * output inverted. Each block starts in the all-zero state and is flushed back to it with CONV_CCSDS_TAIL_BITS zero
+ * bits, so the decoder knows both ends of the trellis.
+ *
+ * Encoded bits are packed MSB first, the 0171 output of each data bit followed by its 0133 output. Soft symbols are
+ * one byte per encoded bit: 0 is a confident 0, 255 a confident 1 and 128 carries no information (an erasure).
+ */
+#define CONV_CCSDS_CONSTRAINT_LENGTH 7U
+#define CONV_CCSDS_NUM_STATES (1U << (CONV_CCSDS_CONSTRAINT_LENGTH - 1U))
+#define CONV_CCSDS_TAIL_BITS (CONV_CCSDS_CONSTRAINT_LENGTH - 1U)
+#define CONV_CCSDS_SYMBOLS_PER_BIT 2U
+
+// Largest block the decoder keeps decisions for; one RS(255,223) codeword
+#define CONV_CCSDS_MAX_DATA_SIZE 255U
+
+#define CONV_CCSDS_NUM_STEPS(dataLen) ((uint32_t)(dataLen) * 8U + CONV_CCSDS_TAIL_BITS)
+#define CONV_CCSDS_ENCODED_BITS(dataLen) (CONV_CCSDS_NUM_STEPS(dataLen) * CONV_CCSDS_SYMBOLS_PER_BIT)
+#define CONV_CCSDS_ENCODED_SIZE(dataLen) ((CONV_CCSDS_ENCODED_BITS(dataLen) + 7U) / 8U)
+
+/*
+ * Working memory of the Viterbi decoder. One survivor decision bit per state per trellis step is kept for the
+ * traceback, about 16 KiB for a full block, so callers choose where it lives instead of it being a hidden static.
+ */
+typedef struct {
+  uint64_t decisions[CONV_CCSDS_NUM_STEPS(CONV_CCSDS_MAX_DATA_SIZE)];
+  uint32_t pathMetrics[2][CONV_CCSDS_NUM_STATES];
+} conv_ccsds_decoder_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief encodes a block, including the tail bits that return the encoder to the all-zero state
+ *
+ * @param data bytes to encode
+ * @param dataLen number of bytes in data, at most CONV_CCSDS_MAX_DATA_SIZE
+ * @param encoded buffer for the packed encoded bits; unused bits of the last byte are set to 0
+ * @param encodedLen size of encoded, at least CONV_CCSDS_ENCODED_SIZE(dataLen)
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_BUFF_TOO_SMALL if encoded cannot hold the block
+ */
+obc_gs_error_code_t convCcsdsEncode(const uint8_t *data, uint16_t dataLen, uint8_t *encoded, uint16_t encodedLen);
+
+/**
+ * @brief finds the most likely block given one soft symbol per encoded bit
+ *
+ * @param decoder working memory
+ * @param symbols CONV_CCSDS_ENCODED_BITS(dataLen) soft symbols
+ * @param dataLen number of bytes in the block, at most CONV_CCSDS_MAX_DATA_SIZE
+ * @param data buffer of dataLen bytes for the decoded block
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if a pointer is NULL or dataLen is too large
+ */
+obc_gs_error_code_t convCcsdsDecodeSoft(conv_ccsds_decoder_t *decoder, const uint8_t *symbols, uint16_t dataLen,
+                                        uint8_t *data);
+
+/**
+ * @brief finds the most likely block given the packed encoded bits from a hard-decision receiver
+ *
+ * @param decoder working memory
+ * @param encoded CONV_CCSDS_ENCODED_SIZE(dataLen) bytes as produced by convCcsdsEncode
+ * @param dataLen number of bytes in the block, at most CONV_CCSDS_MAX_DATA_SIZE
+ * @param data buffer of dataLen bytes for the decoded block
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if a pointer is NULL or dataLen is too large
+ */
+obc_gs_error_code_t convCcsdsDecodeHard(conv_ccsds_decoder_t *decoder, const uint8_t *encoded, uint16_t dataLen,
+                                        uint8_t *data);
+
+#ifdef __cplusplus
+}
+#endif
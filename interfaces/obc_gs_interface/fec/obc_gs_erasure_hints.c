@@ -0,0 +1,181 @@
+#include "obc_gs_erasure_hints.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// Most violations come from a single burst, so only the first few are worth locating
+#define MAX_TRACKED_STUFFING_VIOLATIONS 16U
+
+// A violation's run of 1s can reach into the unstuffed bytes on either side of the one being assembled
+#define STUFFING_VIOLATION_MARGIN 1
+
+// Stuffing adds a few percent of bits, so a scaled offset can be off by a couple of bytes
+#define POOR_RANGE_MARGIN 2
+
+// When more bytes are hinted than can be erased, windows of this many hinted bytes are erased in turn. The rest of
+// the parity corrects up to 8 more errors and keeps the chance of decoding to the wrong codeword around 1e-5 per
+// window; larger windows leave too little parity to catch a wrong guess.
+#define RS_ERASURE_WINDOW_SIZE 16U
+#define RS_ERASURE_WINDOW_STRIDE 8U
+
+static obc_gs_error_code_t decodeWithHintRank(packed_rs_packet_t *rsData, const rs_erasure_hints_t *hints,
+                                              rs_erasure_hint_t hint, uint8_t *decodedData, uint8_t decodedDataLen);
+
+void rsErasureHintsInit(rs_erasure_hints_t *hints) {
+  if (hints == NULL) {
+    return;
+  }
+
+  memset(hints, 0, sizeof(*hints));
+}
+
+void rsErasureHintsMark(rs_erasure_hints_t *hints, int32_t start, int32_t length, rs_erasure_hint_t hint) {
+  if (hints == NULL || length <= 0 || hint == RS_ERASURE_HINT_NONE) {
+    return;
+  }
+
+  int32_t end = start + length;
+  if (start < 0) {
+    start = 0;
+  }
+  if (end > (int32_t)RS_ENCODED_SIZE) {
+    end = RS_ENCODED_SIZE;
+  }
+
+  for (int32_t i = start; i < end; ++i) {
+    if (hints->hint[i] == RS_ERASURE_HINT_NONE) {
+      hints->numHinted++;
+    }
+    if (hints->hint[i] < (uint8_t)hint) {
+      hints->hint[i] = (uint8_t)hint;
+    }
+  }
+}
+
+obc_gs_error_code_t ax25UnstuffWithErasureHints(const uint8_t *packet, uint16_t packetLen,
+                                                const ax25_byte_range_t *poorRanges, uint8_t numPoorRanges,
+                                                unstuffed_ax25_i_frame_t *unstuffedPacket, rs_erasure_hints_t *hints) {
+  if (packet == NULL || unstuffedPacket == NULL || hints == NULL || (poorRanges == NULL && numPoorRanges > 0)) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  obc_gs_error_code_t errCode;
+
+  uint16_t violations[MAX_TRACKED_STUFFING_VIOLATIONS];
+  uint8_t numViolations = 0;
+  errCode = ax25UnstuffWithAnomalies(packet, packetLen, unstuffedPacket->data, &unstuffedPacket->length, violations,
+                                     MAX_TRACKED_STUFFING_VIOLATIONS, &numViolations);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  rsErasureHintsInit(hints);
+
+  if (numViolations > MAX_TRACKED_STUFFING_VIOLATIONS) {
+    numViolations = MAX_TRACKED_STUFFING_VIOLATIONS;
+  }
+  for (uint8_t i = 0; i < numViolations; ++i) {
+    int32_t codewordIndex = (int32_t)violations[i] - AX25_INFO_FIELD_POSITION;
+    rsErasureHintsMark(hints, codewordIndex - STUFFING_VIOLATION_MARGIN, 2 * STUFFING_VIOLATION_MARGIN + 1,
+                       RS_ERASURE_HINT_FRAMING);
+  }
+
+  if (packetLen == 0) {
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  for (uint8_t i = 0; i < numPoorRanges; ++i) {
+    int32_t start = (int32_t)((uint32_t)poorRanges[i].start * unstuffedPacket->length / packetLen);
+    int32_t end =
+        (int32_t)(((uint32_t)poorRanges[i].start + poorRanges[i].length) * unstuffedPacket->length / packetLen);
+    rsErasureHintsMark(hints, start - AX25_INFO_FIELD_POSITION - POOR_RANGE_MARGIN,
+                       end - start + 2 * POOR_RANGE_MARGIN, RS_ERASURE_HINT_LINK_QUALITY);
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t rsDecodeWithErasureHints(packed_rs_packet_t *rsData, const rs_erasure_hints_t *hints,
+                                             uint8_t *decodedData, uint8_t decodedDataLen,
+                                             rs_erasure_hint_t *usedHint) {
+  if (rsData == NULL || decodedData == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  obc_gs_error_code_t errCode = rsDecode(rsData, decodedData, decodedDataLen);
+  rs_erasure_hint_t hint = RS_ERASURE_HINT_NONE;
+
+  if (errCode == OBC_GS_ERR_CODE_REED_SOL_DEC_ERR && hints != NULL && hints->numHinted > 0) {
+    uint16_t previousNumHinted = 0;
+
+    for (hint = RS_ERASURE_HINT_FRAMING; hint > RS_ERASURE_HINT_NONE; --hint) {
+      uint16_t numHinted = 0;
+      for (uint16_t i = 0; i < RS_ENCODED_SIZE; ++i) {
+        numHinted += (hints->hint[i] >= (uint8_t)hint);
+      }
+
+      // Nothing new at this rank, so the attempts would repeat the last ones
+      if (numHinted == previousNumHinted) {
+        continue;
+      }
+      previousNumHinted = numHinted;
+
+      errCode = decodeWithHintRank(rsData, hints, hint, decodedData, decodedDataLen);
+      if (errCode != OBC_GS_ERR_CODE_REED_SOL_DEC_ERR) {
+        break;
+      }
+    }
+  }
+
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  if (usedHint != NULL) {
+    *usedHint = hint;
+  }
+
+  // Rebuild the parity bytes as well so the corrected frame passes its FCS check
+  return rsEncode(decodedData, rsData);
+}
+
+/**
+ * @brief erasure decodes with every byte hinted at or above a rank, sliding a window over them if there are too many
+ *
+ * @param rsData the received codeword
+ * @param hints erasure hints for rsData
+ * @param hint the lowest rank to erase
+ * @param decodedData pointer to a uint8_t array of size 223B
+ * @param decodedDataLen length of the decodedData array
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_REED_SOL_DEC_ERR if no attempt succeeded
+ */
+static obc_gs_error_code_t decodeWithHintRank(packed_rs_packet_t *rsData, const rs_erasure_hints_t *hints,
+                                              rs_erasure_hint_t hint, uint8_t *decodedData, uint8_t decodedDataLen) {
+  uint8_t hinted[RS_ENCODED_SIZE];
+  uint16_t numHinted = 0;
+  for (uint16_t i = 0; i < RS_ENCODED_SIZE; ++i) {
+    if (hints->hint[i] >= (uint8_t)hint) {
+      hinted[numHinted++] = (uint8_t)i;
+    }
+  }
+
+  if (numHinted <= RS_MAX_ERASURES) {
+    return rsDecodeWithErasures(rsData, hinted, (uint8_t)numHinted, decodedData, decodedDataLen);
+  }
+
+  // A burst is usually much shorter than the hinted range around it, so try each part of the range in turn
+  obc_gs_error_code_t errCode = OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
+  for (uint16_t start = 0; start < numHinted; start += RS_ERASURE_WINDOW_STRIDE) {
+    if (start + RS_ERASURE_WINDOW_SIZE > numHinted) {
+      start = numHinted - RS_ERASURE_WINDOW_SIZE;
+    }
+
+    errCode = rsDecodeWithErasures(rsData, &hinted[start], RS_ERASURE_WINDOW_SIZE, decodedData, decodedDataLen);
+    if (errCode != OBC_GS_ERR_CODE_REED_SOL_DEC_ERR || start + RS_ERASURE_WINDOW_SIZE == numHinted) {
+      break;
+    }
+  }
+
+  return errCode;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "obc_gs_ax25.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <stdint.h>
+
+/*
+ * Erasure hints mark the bytes of a received Reed-Solomon codeword that are likely to be wrong. Decoding them as
+ * erasures instead of unknown errors lets a frame with up to 32 bad bytes be recovered instead of 16.
+ *
+ * Hints are ranked; a higher rank is more trustworthy and is tried first.
+ */
+typedef enum {
+  RS_ERASURE_HINT_NONE = 0,
+  RS_ERASURE_HINT_LINK_QUALITY,  // Received while the radio reported a weak or noisy signal
+  RS_ERASURE_HINT_FRAMING,       // Next to a broken bit stuffing rule (six or more 1s in a row)
+} rs_erasure_hint_t;
+
+typedef struct {
+  uint8_t hint[RS_ENCODED_SIZE];  // rs_erasure_hint_t of each codeword byte
+  uint16_t numHinted;             // Number of bytes with a hint other than RS_ERASURE_HINT_NONE
+} rs_erasure_hints_t;
+
+// A span of bytes in a stuffed frame, as counted from the frame's start flag
+typedef struct {
+  uint16_t start;
+  uint16_t length;
+} ax25_byte_range_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief clears every hint
+ *
+ * @param hints the hints to clear
+ */
+void rsErasureHintsInit(rs_erasure_hints_t *hints);
+
+/**
+ * @brief raises the hint of a range of codeword bytes; a byte keeps the higher of its old and new hints
+ *
+ * @param hints the hints to update
+ * @param start index of the first codeword byte; may be negative, parts of the range outside the codeword are ignored
+ * @param length number of bytes in the range
+ * @param hint the hint to apply
+ */
+void rsErasureHintsMark(rs_erasure_hints_t *hints, int32_t start, int32_t length, rs_erasure_hint_t hint);
+
+/**
+ * @brief unstuffs an I frame and collects erasure hints for its info field
+ *
+ * Bytes around a stuffing violation get RS_ERASURE_HINT_FRAMING. Each range in poorRanges gets
+ * RS_ERASURE_HINT_LINK_QUALITY; stuffed offsets are scaled to unstuffed ones and widened by a couple of bytes to
+ * cover the stuffing bits removed in between.
+ *
+ * @param packet the received stuffed frame including both flags
+ * @param packetLen number of bytes in packet
+ * @param poorRanges ranges of packet received with poor link quality; may be NULL if numPoorRanges is 0
+ * @param numPoorRanges number of entries in poorRanges
+ * @param unstuffedPacket stores the unstuffed frame
+ * @param hints set to the hints for the codeword in the info field
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if a pointer is NULL
+ */
+obc_gs_error_code_t ax25UnstuffWithErasureHints(const uint8_t *packet, uint16_t packetLen,
+                                                const ax25_byte_range_t *poorRanges, uint8_t numPoorRanges,
+                                                unstuffed_ax25_i_frame_t *unstuffedPacket, rs_erasure_hints_t *hints);
+
+/**
+ * @brief decodes a codeword, falling back to erasure decoding with progressively less trustworthy hints
+ *
+ * Errors-only decoding is tried first so a frame that decodes without hints never loses to a bad hint. The following
+ * attempts erase the bytes hinted at or above a rank, most trusted rank first. When a rank hints more than
+ * RS_MAX_ERASURES bytes, overlapping windows of the hinted bytes are erased one after another. On success rsData is
+ * rewritten as the corrected codeword so the frame's FCS can be checked afterwards.
+ *
+ * @param rsData the received codeword; set to the corrected codeword on success
+ * @param hints erasure hints for rsData; may be NULL
+ * @param decodedData pointer to a uint8_t array of size 223B
+ * @param decodedDataLen length of the decodedData array
+ * @param usedHint set to the lowest hint rank erased by the successful attempt, RS_ERASURE_HINT_NONE if errors-only
+ * decoding was enough; may be NULL
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_REED_SOL_DEC_ERR if no attempt succeeded
+ */
+obc_gs_error_code_t rsDecodeWithErasureHints(packed_rs_packet_t *rsData, const rs_erasure_hints_t *hints,
+                                             uint8_t *decodedData, uint8_t decodedDataLen,
+                                             rs_erasure_hint_t *usedHint);
+
+#ifdef __cplusplus
+}
+#endif
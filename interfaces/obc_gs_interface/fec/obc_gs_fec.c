@@ -1,12 +1,19 @@
 #include "obc_gs_fec.h"
 #include "obc_gs_aes128.h"
+#include "obc_gs_conv_ccsds.h"
 #include "obc_gs_errors.h"
+#include "obc_gs_rs_ccsds.h"
 
 #include <correct.h>
 
 #include <stdint.h>
 
+#if OBC_GS_RS_IMPLEMENTATION == OBC_GS_RS_LIBCORRECT
 static correct_reed_solomon *rs = NULL;
+#endif
+
+_Static_assert(RS_DECODED_SIZE == RS_CCSDS_MESSAGE_SIZE && RS_ENCODED_SIZE == RS_CCSDS_BLOCK_SIZE,
+               "the specialized codec only supports RS(255,223)");
 
 /**
  * @brief takes in a packed telemtry array and encodes it using reed solomon
@@ -21,11 +28,15 @@ obc_gs_error_code_t rsEncode(uint8_t *telemData, packed_rs_packet_t *rsData) {
 
   if (rsData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
 
+#if OBC_GS_RS_IMPLEMENTATION == OBC_GS_RS_CCSDS
+  return rsCcsdsEncode(telemData, rsData->data);
+#else
   if ((uint8_t)correct_reed_solomon_encode(rs, telemData, RS_DECODED_SIZE, rsData->data) < RS_ENCODED_SIZE) {
     return OBC_GS_ERR_CODE_REED_SOL_ENC_ERR;
   }
 
   return OBC_GS_ERR_CODE_SUCCESS;
+#endif
 }
 
 /**
@@ -44,21 +55,118 @@ obc_gs_error_code_t rsDecode(packed_rs_packet_t *rsData, uint8_t *decodedData, u
 
   if (decodedDataLen < RS_DECODED_SIZE) return OBC_GS_ERR_CODE_INVALID_ARG;
 
+#if OBC_GS_RS_IMPLEMENTATION == OBC_GS_RS_CCSDS
+  return rsCcsdsDecode(rsData->data, decodedData, NULL);
+#else
   int8_t decodedLength = correct_reed_solomon_decode(rs, rsData->data, RS_ENCODED_SIZE, decodedData);
   if (decodedLength == -1) return OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
 
   return OBC_GS_ERR_CODE_SUCCESS;
+#endif
+}
+
+/**
+ * @brief Decodes reed solomon data whose unreliable byte positions are known
+ *
+ * @param rsData 255 byte array that has encoded reed solomon data
+ * @param erasurePositions distinct indices into rsData->data that may be wrong
+ * @param numErasures number of entries in erasurePositions, at most RS_MAX_ERASURES
+ * @param decodedData pointer to a uint8_t array of size 223B
+ * @param decodedDataLen length of the decodedData array
+ *
+ * @return obc_gs_error_code_t - whether or not the data was successfully decoded
+ */
+obc_gs_error_code_t rsDecodeWithErasures(packed_rs_packet_t *rsData, const uint8_t *erasurePositions,
+                                         uint8_t numErasures, uint8_t *decodedData, uint8_t decodedDataLen) {
+  if (rsData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (decodedData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (decodedDataLen < RS_DECODED_SIZE) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (numErasures > RS_MAX_ERASURES) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (erasurePositions == NULL && numErasures > 0) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+#if OBC_GS_RS_IMPLEMENTATION == OBC_GS_RS_CCSDS
+  return rsCcsdsDecodeWithErasures(rsData->data, erasurePositions, numErasures, decodedData, NULL);
+#else
+  if (numErasures == 0) {
+    return rsDecode(rsData, decodedData, decodedDataLen);
+  }
+
+  ssize_t decodedLength = correct_reed_solomon_decode_with_erasures(rs, rsData->data, RS_ENCODED_SIZE,
+                                                                    erasurePositions, numErasures, decodedData);
+  if (decodedLength == -1) return OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+#endif
+}
+
+/**
+ * @brief wraps a reed solomon codeword in the inner convolutional code
+ *
+ * @param rsData 255 byte array with the reed solomon encoded data
+ * @param convData set to the convolutionally encoded codeword
+ *
+ * @return obc_gs_error_code_t - whether or not the codeword was successfully encoded
+ */
+obc_gs_error_code_t convEncode(const packed_rs_packet_t *rsData, packed_conv_packet_t *convData) {
+  if (rsData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (convData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  return convCcsdsEncode(rsData->data, RS_ENCODED_SIZE, convData->data, CONV_ENCODED_SIZE);
+}
+
+/**
+ * @brief Viterbi decodes the inner convolutional code from hard-decision bits
+ *
+ * @param decoder Viterbi working memory owned by the caller
+ * @param convData the received convolutionally encoded codeword
+ * @param rsData set to the reed solomon codeword, ready for rsDecode
+ *
+ * @return obc_gs_error_code_t - whether or not the codeword was successfully decoded
+ */
+obc_gs_error_code_t convDecode(conv_ccsds_decoder_t *decoder, const packed_conv_packet_t *convData,
+                               packed_rs_packet_t *rsData) {
+  if (convData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (rsData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  return convCcsdsDecodeHard(decoder, convData->data, RS_ENCODED_SIZE, rsData->data);
+}
+
+/**
+ * @brief Viterbi decodes the inner convolutional code from soft-decision symbols
+ *
+ * @param decoder Viterbi working memory owned by the caller
+ * @param softSymbols CONV_SOFT_SYMBOLS symbols, 0 for a confident 0 bit up to 255 for a confident 1 bit
+ * @param rsData set to the reed solomon codeword, ready for rsDecode
+ *
+ * @return obc_gs_error_code_t - whether or not the codeword was successfully decoded
+ */
+obc_gs_error_code_t convDecodeSoft(conv_ccsds_decoder_t *decoder, const uint8_t *softSymbols,
+                                   packed_rs_packet_t *rsData) {
+  if (rsData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  return convCcsdsDecodeSoft(decoder, softSymbols, RS_ENCODED_SIZE, rsData->data);
 }
 
 void initRs(void) {
+#if OBC_GS_RS_IMPLEMENTATION == OBC_GS_RS_LIBCORRECT
   if (rs == NULL) {
     // Create reed solomon variable for encryption and decryption
     rs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
   }
+#endif
 }
 
 void destroyRs(void) {
+#if OBC_GS_RS_IMPLEMENTATION == OBC_GS_RS_LIBCORRECT
   if (rs != NULL) {
     correct_reed_solomon_destroy(rs);
+    rs = NULL;
   }
+#endif
 }
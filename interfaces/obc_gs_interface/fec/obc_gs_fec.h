@@ -1,14 +1,35 @@
 #pragma once
 
+#include "obc_gs_conv_ccsds.h"
 #include "obc_gs_errors.h"
 #include "correct.h"
 
 #include <stdint.h>
 
+/*
+ * Reed-Solomon implementations. OBC_GS_RS_IMPLEMENTATION selects the codec behind rsEncode and rsDecode at build time;
+ * both produce identical codewords:
+ *   - OBC_GS_RS_LIBCORRECT: libcorrect's generic codec, with polynomials allocated from the heap by initRs
+ *   - OBC_GS_RS_CCSDS: the const-table (255,223) codec in obc_gs_rs_ccsds.h; initRs and destroyRs do nothing
+ */
+#define OBC_GS_RS_LIBCORRECT 0U
+#define OBC_GS_RS_CCSDS 1U
+
+#ifndef OBC_GS_RS_IMPLEMENTATION
+#define OBC_GS_RS_IMPLEMENTATION OBC_GS_RS_CCSDS
+#endif
+
+#if OBC_GS_RS_IMPLEMENTATION > OBC_GS_RS_CCSDS
+#error "Invalid OBC_GS_RS_IMPLEMENTATION"
+#endif
+
 #define RS_DECODED_SIZE 223U
 #define RS_ENCODED_SIZE 255U
 #define PACKED_TELEM_PACKET_SIZE RS_DECODED_SIZE
 
+// Each erasure uses up one of the parity bytes
+#define RS_MAX_ERASURES (RS_ENCODED_SIZE - RS_DECODED_SIZE)
+
 typedef struct {
   uint8_t data[RS_ENCODED_SIZE];
 } packed_rs_packet_t;
@@ -17,6 +38,18 @@ typedef struct {
   uint8_t data[PACKED_TELEM_PACKET_SIZE];
 } packed_telem_packet_t;
 
+/*
+ * Optional inner code: a Reed-Solomon codeword wrapped in the CCSDS rate 1/2, k = 7 convolutional code (see
+ * obc_gs_conv_ccsds.h). The Viterbi decoder cleans up scattered bit errors and leaves short bursts for the outer RS
+ * code, which buys several dB of link margin at the cost of twice the bits on air.
+ */
+#define CONV_ENCODED_SIZE CONV_CCSDS_ENCODED_SIZE(RS_ENCODED_SIZE)
+#define CONV_SOFT_SYMBOLS CONV_CCSDS_ENCODED_BITS(RS_ENCODED_SIZE)
+
+typedef struct {
+  uint8_t data[CONV_ENCODED_SIZE];
+} packed_conv_packet_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -38,6 +71,48 @@ obc_gs_error_code_t rsEncode(uint8_t *telemData, packed_rs_packet_t *rsData);
  */
 obc_gs_error_code_t rsDecode(packed_rs_packet_t *rsData, uint8_t *decodedData, uint8_t decodedDataLen);
 
+/**
+ * @brief Decodes the reed solomon data, treating the given byte positions as erasures
+ *
+ * An erasure costs one parity byte where an unknown error costs two, so 2 * errors + erasures <= 32 is corrected.
+ *
+ * @param rsData 255 byte array that has encoded reed solomon data
+ * @param erasurePositions distinct indices into rsData->data that may be wrong; may be NULL if numErasures is 0
+ * @param numErasures number of entries in erasurePositions, at most RS_MAX_ERASURES
+ * @param decodedData pointer to a uint8_t array of size 223B
+ * @param decodedDataLen length of the decodedData array
+ */
+obc_gs_error_code_t rsDecodeWithErasures(packed_rs_packet_t *rsData, const uint8_t *erasurePositions,
+                                         uint8_t numErasures, uint8_t *decodedData, uint8_t decodedDataLen);
+
+/**
+ * @brief wraps a reed solomon codeword in the inner convolutional code
+ *
+ * @param rsData 255 byte array with the reed solomon encoded data
+ * @param convData set to the convolutionally encoded codeword
+ */
+obc_gs_error_code_t convEncode(const packed_rs_packet_t *rsData, packed_conv_packet_t *convData);
+
+/**
+ * @brief Viterbi decodes the inner convolutional code from hard-decision bits
+ *
+ * @param decoder Viterbi working memory owned by the caller
+ * @param convData the received convolutionally encoded codeword
+ * @param rsData set to the reed solomon codeword, ready for rsDecode
+ */
+obc_gs_error_code_t convDecode(conv_ccsds_decoder_t *decoder, const packed_conv_packet_t *convData,
+                               packed_rs_packet_t *rsData);
+
+/**
+ * @brief Viterbi decodes the inner convolutional code from soft-decision symbols
+ *
+ * @param decoder Viterbi working memory owned by the caller
+ * @param softSymbols CONV_SOFT_SYMBOLS symbols, 0 for a confident 0 bit up to 255 for a confident 1 bit
+ * @param rsData set to the reed solomon codeword, ready for rsDecode
+ */
+obc_gs_error_code_t convDecodeSoft(conv_ccsds_decoder_t *decoder, const uint8_t *softSymbols,
+                                   packed_rs_packet_t *rsData);
+
 /**
  * @brief initializes the rs variable to be used for rs encryption and decryption
  */
@@ -0,0 +1,1366 @@
+#include "obc_gs_rs_ccsds.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#define RS_CCSDS_FIELD_SIZE 256U
+#define RS_CCSDS_FIELD_ORDER 255U  // Number of non-zero field elements
+
+/*
+ * rsGfExp[i] is alpha^i, repeated so that the sum of two logs can index it without a modulo.
+ * rsGfLog[x] is the log of x; rsGfLog[0] is unused.
+ */
+static const uint8_t rsGfExp[2U * RS_CCSDS_FIELD_ORDER + 2U] = {
+    0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U, 0x87U, 0x89U, 0x95U, 0xADU, 0xDDU, 0x3DU, 0x7AU, 0xF4U,
+    0x6FU, 0xDEU, 0x3BU, 0x76U, 0xECU, 0x5FU, 0xBEU, 0xFBU, 0x71U, 0xE2U, 0x43U, 0x86U, 0x8BU, 0x91U, 0xA5U, 0xCDU,
+    0x1DU, 0x3AU, 0x74U, 0xE8U, 0x57U, 0xAEU, 0xDBU, 0x31U, 0x62U, 0xC4U, 0x0FU, 0x1EU, 0x3CU, 0x78U, 0xF0U, 0x67U,
+    0xCEU, 0x1BU, 0x36U, 0x6CU, 0xD8U, 0x37U, 0x6EU, 0xDCU, 0x3FU, 0x7EU, 0xFCU, 0x7FU, 0xFEU, 0x7BU, 0xF6U, 0x6BU,
+    0xD6U, 0x2BU, 0x56U, 0xACU, 0xDFU, 0x39U, 0x72U, 0xE4U, 0x4FU, 0x9EU, 0xBBU, 0xF1U, 0x65U, 0xCAU, 0x13U, 0x26U,
+    0x4CU, 0x98U, 0xB7U, 0xE9U, 0x55U, 0xAAU, 0xD3U, 0x21U, 0x42U, 0x84U, 0x8FU, 0x99U, 0xB5U, 0xEDU, 0x5DU, 0xBAU,
+    0xF3U, 0x61U, 0xC2U, 0x03U, 0x06U, 0x0CU, 0x18U, 0x30U, 0x60U, 0xC0U, 0x07U, 0x0EU, 0x1CU, 0x38U, 0x70U, 0xE0U,
+    0x47U, 0x8EU, 0x9BU, 0xB1U, 0xE5U, 0x4DU, 0x9AU, 0xB3U, 0xE1U, 0x45U, 0x8AU, 0x93U, 0xA1U, 0xC5U, 0x0DU, 0x1AU,
+    0x34U, 0x68U, 0xD0U, 0x27U, 0x4EU, 0x9CU, 0xBFU, 0xF9U, 0x75U, 0xEAU, 0x53U, 0xA6U, 0xCBU, 0x11U, 0x22U, 0x44U,
+    0x88U, 0x97U, 0xA9U, 0xD5U, 0x2DU, 0x5AU, 0xB4U, 0xEFU, 0x59U, 0xB2U, 0xE3U, 0x41U, 0x82U, 0x83U, 0x81U, 0x85U,
+    0x8DU, 0x9DU, 0xBDU, 0xFDU, 0x7DU, 0xFAU, 0x73U, 0xE6U, 0x4BU, 0x96U, 0xABU, 0xD1U, 0x25U, 0x4AU, 0x94U, 0xAFU,
+    0xD9U, 0x35U, 0x6AU, 0xD4U, 0x2FU, 0x5EU, 0xBCU, 0xFFU, 0x79U, 0xF2U, 0x63U, 0xC6U, 0x0BU, 0x16U, 0x2CU, 0x58U,
+    0xB0U, 0xE7U, 0x49U, 0x92U, 0xA3U, 0xC1U, 0x05U, 0x0AU, 0x14U, 0x28U, 0x50U, 0xA0U, 0xC7U, 0x09U, 0x12U, 0x24U,
+    0x48U, 0x90U, 0xA7U, 0xC9U, 0x15U, 0x2AU, 0x54U, 0xA8U, 0xD7U, 0x29U, 0x52U, 0xA4U, 0xCFU, 0x19U, 0x32U, 0x64U,
+    0xC8U, 0x17U, 0x2EU, 0x5CU, 0xB8U, 0xF7U, 0x69U, 0xD2U, 0x23U, 0x46U, 0x8CU, 0x9FU, 0xB9U, 0xF5U, 0x6DU, 0xDAU,
+    0x33U, 0x66U, 0xCCU, 0x1FU, 0x3EU, 0x7CU, 0xF8U, 0x77U, 0xEEU, 0x5BU, 0xB6U, 0xEBU, 0x51U, 0xA2U, 0xC3U, 0x01U,
+    0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U, 0x87U, 0x89U, 0x95U, 0xADU, 0xDDU, 0x3DU, 0x7AU, 0xF4U, 0x6FU,
+    0xDEU, 0x3BU, 0x76U, 0xECU, 0x5FU, 0xBEU, 0xFBU, 0x71U, 0xE2U, 0x43U, 0x86U, 0x8BU, 0x91U, 0xA5U, 0xCDU, 0x1DU,
+    0x3AU, 0x74U, 0xE8U, 0x57U, 0xAEU, 0xDBU, 0x31U, 0x62U, 0xC4U, 0x0FU, 0x1EU, 0x3CU, 0x78U, 0xF0U, 0x67U, 0xCEU,
+    0x1BU, 0x36U, 0x6CU, 0xD8U, 0x37U, 0x6EU, 0xDCU, 0x3FU, 0x7EU, 0xFCU, 0x7FU, 0xFEU, 0x7BU, 0xF6U, 0x6BU, 0xD6U,
+    0x2BU, 0x56U, 0xACU, 0xDFU, 0x39U, 0x72U, 0xE4U, 0x4FU, 0x9EU, 0xBBU, 0xF1U, 0x65U, 0xCAU, 0x13U, 0x26U, 0x4CU,
+    0x98U, 0xB7U, 0xE9U, 0x55U, 0xAAU, 0xD3U, 0x21U, 0x42U, 0x84U, 0x8FU, 0x99U, 0xB5U, 0xEDU, 0x5DU, 0xBAU, 0xF3U,
+    0x61U, 0xC2U, 0x03U, 0x06U, 0x0CU, 0x18U, 0x30U, 0x60U, 0xC0U, 0x07U, 0x0EU, 0x1CU, 0x38U, 0x70U, 0xE0U, 0x47U,
+    0x8EU, 0x9BU, 0xB1U, 0xE5U, 0x4DU, 0x9AU, 0xB3U, 0xE1U, 0x45U, 0x8AU, 0x93U, 0xA1U, 0xC5U, 0x0DU, 0x1AU, 0x34U,
+    0x68U, 0xD0U, 0x27U, 0x4EU, 0x9CU, 0xBFU, 0xF9U, 0x75U, 0xEAU, 0x53U, 0xA6U, 0xCBU, 0x11U, 0x22U, 0x44U, 0x88U,
+    0x97U, 0xA9U, 0xD5U, 0x2DU, 0x5AU, 0xB4U, 0xEFU, 0x59U, 0xB2U, 0xE3U, 0x41U, 0x82U, 0x83U, 0x81U, 0x85U, 0x8DU,
+    0x9DU, 0xBDU, 0xFDU, 0x7DU, 0xFAU, 0x73U, 0xE6U, 0x4BU, 0x96U, 0xABU, 0xD1U, 0x25U, 0x4AU, 0x94U, 0xAFU, 0xD9U,
+    0x35U, 0x6AU, 0xD4U, 0x2FU, 0x5EU, 0xBCU, 0xFFU, 0x79U, 0xF2U, 0x63U, 0xC6U, 0x0BU, 0x16U, 0x2CU, 0x58U, 0xB0U,
+    0xE7U, 0x49U, 0x92U, 0xA3U, 0xC1U, 0x05U, 0x0AU, 0x14U, 0x28U, 0x50U, 0xA0U, 0xC7U, 0x09U, 0x12U, 0x24U, 0x48U,
+    0x90U, 0xA7U, 0xC9U, 0x15U, 0x2AU, 0x54U, 0xA8U, 0xD7U, 0x29U, 0x52U, 0xA4U, 0xCFU, 0x19U, 0x32U, 0x64U, 0xC8U,
+    0x17U, 0x2EU, 0x5CU, 0xB8U, 0xF7U, 0x69U, 0xD2U, 0x23U, 0x46U, 0x8CU, 0x9FU, 0xB9U, 0xF5U, 0x6DU, 0xDAU, 0x33U,
+    0x66U, 0xCCU, 0x1FU, 0x3EU, 0x7CU, 0xF8U, 0x77U, 0xEEU, 0x5BU, 0xB6U, 0xEBU, 0x51U, 0xA2U, 0xC3U, 0x01U, 0x02U,
+};
+
+static const uint8_t rsGfLog[RS_CCSDS_FIELD_SIZE] = {
+    0x00U, 0x00U, 0x01U, 0x63U, 0x02U, 0xC6U, 0x64U, 0x6AU, 0x03U, 0xCDU, 0xC7U, 0xBCU, 0x65U, 0x7EU, 0x6BU, 0x2AU,
+    0x04U, 0x8DU, 0xCEU, 0x4EU, 0xC8U, 0xD4U, 0xBDU, 0xE1U, 0x66U, 0xDDU, 0x7FU, 0x31U, 0x6CU, 0x20U, 0x2BU, 0xF3U,
+    0x05U, 0x57U, 0x8EU, 0xE8U, 0xCFU, 0xACU, 0x4FU, 0x83U, 0xC9U, 0xD9U, 0xD5U, 0x41U, 0xBEU, 0x94U, 0xE2U, 0xB4U,
+    0x67U, 0x27U, 0xDEU, 0xF0U, 0x80U, 0xB1U, 0x32U, 0x35U, 0x6DU, 0x45U, 0x21U, 0x12U, 0x2CU, 0x0DU, 0xF4U, 0x38U,
+    0x06U, 0x9BU, 0x58U, 0x1AU, 0x8FU, 0x79U, 0xE9U, 0x70U, 0xD0U, 0xC2U, 0xADU, 0xA8U, 0x50U, 0x75U, 0x84U, 0x48U,
+    0xCAU, 0xFCU, 0xDAU, 0x8AU, 0xD6U, 0x54U, 0x42U, 0x24U, 0xBFU, 0x98U, 0x95U, 0xF9U, 0xE3U, 0x5EU, 0xB5U, 0x15U,
+    0x68U, 0x61U, 0x28U, 0xBAU, 0xDFU, 0x4CU, 0xF1U, 0x2FU, 0x81U, 0xE6U, 0xB2U, 0x3FU, 0x33U, 0xEEU, 0x36U, 0x10U,
+    0x6EU, 0x18U, 0x46U, 0xA6U, 0x22U, 0x88U, 0x13U, 0xF7U, 0x2DU, 0xB8U, 0x0EU, 0x3DU, 0xF5U, 0xA4U, 0x39U, 0x3BU,
+    0x07U, 0x9EU, 0x9CU, 0x9DU, 0x59U, 0x9FU, 0x1BU, 0x08U, 0x90U, 0x09U, 0x7AU, 0x1CU, 0xEAU, 0xA0U, 0x71U, 0x5AU,
+    0xD1U, 0x1DU, 0xC3U, 0x7BU, 0xAEU, 0x0AU, 0xA9U, 0x91U, 0x51U, 0x5BU, 0x76U, 0x72U, 0x85U, 0xA1U, 0x49U, 0xEBU,
+    0xCBU, 0x7CU, 0xFDU, 0xC4U, 0xDBU, 0x1EU, 0x8BU, 0xD2U, 0xD7U, 0x92U, 0x55U, 0xAAU, 0x43U, 0x0BU, 0x25U, 0xAFU,
+    0xC0U, 0x73U, 0x99U, 0x77U, 0x96U, 0x5CU, 0xFAU, 0x52U, 0xE4U, 0xECU, 0x5FU, 0x4AU, 0xB6U, 0xA2U, 0x16U, 0x86U,
+    0x69U, 0xC5U, 0x62U, 0xFEU, 0x29U, 0x7DU, 0xBBU, 0xCCU, 0xE0U, 0xD3U, 0x4DU, 0x8CU, 0xF2U, 0x1FU, 0x30U, 0xDCU,
+    0x82U, 0xABU, 0xE7U, 0x56U, 0xB3U, 0x93U, 0x40U, 0xD8U, 0x34U, 0xB0U, 0xEFU, 0x26U, 0x37U, 0x0CU, 0x11U, 0x44U,
+    0x6FU, 0x78U, 0x19U, 0x9AU, 0x47U, 0x74U, 0xA7U, 0xC1U, 0x23U, 0x53U, 0x89U, 0xFBU, 0x14U, 0x5DU, 0xF8U, 0x97U,
+    0x2EU, 0x4BU, 0xB9U, 0x60U, 0x0FU, 0xEDU, 0x3EU, 0xE5U, 0xF6U, 0x87U, 0xA5U, 0x17U, 0x3AU, 0xA3U, 0x3CU, 0xB7U,
+};
+
+/*
+ * rsParityTable[f] is f times the generator polynomial, highest order coefficient first and excluding the leading 1.
+ * It is the XOR applied to the parity register when f is shifted out of it, so the LFSR encoder does one lookup and 32
+ * XORs per message byte instead of 32 field multiplications.
+ */
+static const uint8_t rsParityTable[RS_CCSDS_FIELD_SIZE][RS_CCSDS_PARITY_SIZE] = {
+    {
+        0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+        0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    },
+    {
+        0x95U, 0x3FU, 0x9EU, 0x97U, 0xF2U, 0x3CU, 0xB9U, 0xE5U, 0x99U, 0xB5U, 0xABU, 0x37U, 0xB1U, 0xFEU, 0x0DU, 0x82U,
+        0x85U, 0x0DU, 0x54U, 0xF2U, 0x4CU, 0xE8U, 0xACU, 0xC5U, 0xFBU, 0xB3U, 0xDBU, 0xCDU, 0x77U, 0x87U, 0xB6U, 0x3BU,
+    },
+    {
+        0xADU, 0x7EU, 0xBBU, 0xA9U, 0x63U, 0x78U, 0xF5U, 0x4DU, 0xB5U, 0xEDU, 0xD1U, 0x6EU, 0xE5U, 0x7BU, 0x1AU, 0x83U,
+        0x8DU, 0x1AU, 0xA8U, 0x63U, 0x98U, 0x57U, 0xDFU, 0x0DU, 0x71U, 0xE1U, 0x31U, 0x1DU, 0xEEU, 0x89U, 0xEBU, 0x76U,
+    },
+    {
+        0x38U, 0x41U, 0x25U, 0x3EU, 0x91U, 0x44U, 0x4CU, 0xA8U, 0x2CU, 0x58U, 0x7AU, 0x59U, 0x54U, 0x85U, 0x17U, 0x01U,
+        0x08U, 0x17U, 0xFCU, 0x91U, 0xD4U, 0xBFU, 0x73U, 0xC8U, 0x8AU, 0x52U, 0xEAU, 0xD0U, 0x99U, 0x0EU, 0x5DU, 0x4DU,
+    },
+    {
+        0xDDU, 0xFCU, 0xF1U, 0xD5U, 0xC6U, 0xF0U, 0x6DU, 0x9AU, 0xEDU, 0x5DU, 0x25U, 0xDCU, 0x4DU, 0xF6U, 0x34U, 0x81U,
+        0x9DU, 0x34U, 0xD7U, 0xC6U, 0xB7U, 0xAEU, 0x39U, 0x1AU, 0xE2U, 0x45U, 0x62U, 0x3AU, 0x5BU, 0x95U, 0x51U, 0xECU,
+    },
+    {
+        0x48U, 0xC3U, 0x6FU, 0x42U, 0x34U, 0xCCU, 0xD4U, 0x7FU, 0x74U, 0xE8U, 0x8EU, 0xEBU, 0xFCU, 0x08U, 0x39U, 0x03U,
+        0x18U, 0x39U, 0x83U, 0x34U, 0xFBU, 0x46U, 0x95U, 0xDFU, 0x19U, 0xF6U, 0xB9U, 0xF7U, 0x2CU, 0x12U, 0xE7U, 0xD7U,
+    },
+    {
+        0x70U, 0x82U, 0x4AU, 0x7CU, 0xA5U, 0x88U, 0x98U, 0xD7U, 0x58U, 0xB0U, 0xF4U, 0xB2U, 0xA8U, 0x8DU, 0x2EU, 0x02U,
+        0x10U, 0x2EU, 0x7FU, 0xA5U, 0x2FU, 0xF9U, 0xE6U, 0x17U, 0x93U, 0xA4U, 0x53U, 0x27U, 0xB5U, 0x1CU, 0xBAU, 0x9AU,
+    },
+    {
+        0xE5U, 0xBDU, 0xD4U, 0xEBU, 0x57U, 0xB4U, 0x21U, 0x32U, 0xC1U, 0x05U, 0x5FU, 0x85U, 0x19U, 0x73U, 0x23U, 0x80U,
+        0x95U, 0x23U, 0x2BU, 0x57U, 0x63U, 0x11U, 0x4AU, 0xD2U, 0x68U, 0x17U, 0x88U, 0xEAU, 0xC2U, 0x9BU, 0x0CU, 0xA1U,
+    },
+    {
+        0x3DU, 0x7FU, 0x65U, 0x2DU, 0x0BU, 0x67U, 0xDAU, 0xB3U, 0x5DU, 0xBAU, 0x4AU, 0x3FU, 0x9AU, 0x6BU, 0x68U, 0x85U,
+        0xBDU, 0x68U, 0x29U, 0x0BU, 0xE9U, 0xDBU, 0x72U, 0x34U, 0x43U, 0x8AU, 0xC4U, 0x74U, 0xB6U, 0xADU, 0xA2U, 0x5FU,
+    },
+    {
+        0xA8U, 0x40U, 0xFBU, 0xBAU, 0xF9U, 0x5BU, 0x63U, 0x56U, 0xC4U, 0x0FU, 0xE1U, 0x08U, 0x2BU, 0x95U, 0x65U, 0x07U,
+        0x38U, 0x65U, 0x7DU, 0xF9U, 0xA5U, 0x33U, 0xDEU, 0xF1U, 0xB8U, 0x39U, 0x1FU, 0xB9U, 0xC1U, 0x2AU, 0x14U, 0x64U,
+    },
+    {
+        0x90U, 0x01U, 0xDEU, 0x84U, 0x68U, 0x1FU, 0x2FU, 0xFEU, 0xE8U, 0x57U, 0x9BU, 0x51U, 0x7FU, 0x10U, 0x72U, 0x06U,
+        0x30U, 0x72U, 0x81U, 0x68U, 0x71U, 0x8CU, 0xADU, 0x39U, 0x32U, 0x6BU, 0xF5U, 0x69U, 0x58U, 0x24U, 0x49U, 0x29U,
+    },
+    {
+        0x05U, 0x3EU, 0x40U, 0x13U, 0x9AU, 0x23U, 0x96U, 0x1BU, 0x71U, 0xE2U, 0x30U, 0x66U, 0xCEU, 0xEEU, 0x7FU, 0x84U,
+        0xB5U, 0x7FU, 0xD5U, 0x9AU, 0x3DU, 0x64U, 0x01U, 0xFCU, 0xC9U, 0xD8U, 0x2EU, 0xA4U, 0x2FU, 0xA3U, 0xFFU, 0x12U,
+    },
+    {
+        0xE0U, 0x83U, 0x94U, 0xF8U, 0xCDU, 0x97U, 0xB7U, 0x29U, 0xB0U, 0xE7U, 0x6FU, 0xE3U, 0xD7U, 0x9DU, 0x5CU, 0x04U,
+        0x20U, 0x5CU, 0xFEU, 0xCDU, 0x5EU, 0x75U, 0x4BU, 0x2EU, 0xA1U, 0xCFU, 0xA6U, 0x4EU, 0xEDU, 0x38U, 0xF3U, 0xB3U,
+    },
+    {
+        0x75U, 0xBCU, 0x0AU, 0x6FU, 0x3FU, 0xABU, 0x0EU, 0xCCU, 0x29U, 0x52U, 0xC4U, 0xD4U, 0x66U, 0x63U, 0x51U, 0x86U,
+        0xA5U, 0x51U, 0xAAU, 0x3FU, 0x12U, 0x9DU, 0xE7U, 0xEBU, 0x5AU, 0x7CU, 0x7DU, 0x83U, 0x9AU, 0xBFU, 0x45U, 0x88U,
+    },
+    {
+        0x4DU, 0xFDU, 0x2FU, 0x51U, 0xAEU, 0xEFU, 0x42U, 0x64U, 0x05U, 0x0AU, 0xBEU, 0x8DU, 0x32U, 0xE6U, 0x46U, 0x87U,
+        0xADU, 0x46U, 0x56U, 0xAEU, 0xC6U, 0x22U, 0x94U, 0x23U, 0xD0U, 0x2EU, 0x97U, 0x53U, 0x03U, 0xB1U, 0x18U, 0xC5U,
+    },
+    {
+        0xD8U, 0xC2U, 0xB1U, 0xC6U, 0x5CU, 0xD3U, 0xFBU, 0x81U, 0x9CU, 0xBFU, 0x15U, 0xBAU, 0x83U, 0x18U, 0x4BU, 0x05U,
+        0x28U, 0x4BU, 0x02U, 0x5CU, 0x8AU, 0xCAU, 0x38U, 0xE6U, 0x2BU, 0x9DU, 0x4CU, 0x9EU, 0x74U, 0x36U, 0xAEU, 0xFEU,
+    },
+    {
+        0x7AU, 0xFEU, 0xCAU, 0x5AU, 0x16U, 0xCEU, 0x33U, 0xE1U, 0xBAU, 0xF3U, 0x94U, 0x7EU, 0xB3U, 0xD6U, 0xD0U, 0x8DU,
+        0xFDU, 0xD0U, 0x52U, 0x16U, 0x55U, 0x31U, 0xE4U, 0x68U, 0x86U, 0x93U, 0x0FU, 0xE8U, 0xEBU, 0xDDU, 0xC3U, 0xBEU,
+    },
+    {
+        0xEFU, 0xC1U, 0x54U, 0xCDU, 0xE4U, 0xF2U, 0x8AU, 0x04U, 0x23U, 0x46U, 0x3FU, 0x49U, 0x02U, 0x28U, 0xDDU, 0x0FU,
+        0x78U, 0xDDU, 0x06U, 0xE4U, 0x19U, 0xD9U, 0x48U, 0xADU, 0x7DU, 0x20U, 0xD4U, 0x25U, 0x9CU, 0x5AU, 0x75U, 0x85U,
+    },
+    {
+        0xD7U, 0x80U, 0x71U, 0xF3U, 0x75U, 0xB6U, 0xC6U, 0xACU, 0x0FU, 0x1EU, 0x45U, 0x10U, 0x56U, 0xADU, 0xCAU, 0x0EU,
+        0x70U, 0xCAU, 0xFAU, 0x75U, 0xCDU, 0x66U, 0x3BU, 0x65U, 0xF7U, 0x72U, 0x3EU, 0xF5U, 0x05U, 0x54U, 0x28U, 0xC8U,
+    },
+    {
+        0x42U, 0xBFU, 0xEFU, 0x64U, 0x87U, 0x8AU, 0x7FU, 0x49U, 0x96U, 0xABU, 0xEEU, 0x27U, 0xE7U, 0x53U, 0xC7U, 0x8CU,
+        0xF5U, 0xC7U, 0xAEU, 0x87U, 0x81U, 0x8EU, 0x97U, 0xA0U, 0x0CU, 0xC1U, 0xE5U, 0x38U, 0x72U, 0xD3U, 0x9EU, 0xF3U,
+    },
+    {
+        0xA7U, 0x02U, 0x3BU, 0x8FU, 0xD0U, 0x3EU, 0x5EU, 0x7BU, 0x57U, 0xAEU, 0xB1U, 0xA2U, 0xFEU, 0x20U, 0xE4U, 0x0CU,
+        0x60U, 0xE4U, 0x85U, 0xD0U, 0xE2U, 0x9FU, 0xDDU, 0x72U, 0x64U, 0xD6U, 0x6DU, 0xD2U, 0xB0U, 0x48U, 0x92U, 0x52U,
+    },
+    {
+        0x32U, 0x3DU, 0xA5U, 0x18U, 0x22U, 0x02U, 0xE7U, 0x9EU, 0xCEU, 0x1BU, 0x1AU, 0x95U, 0x4FU, 0xDEU, 0xE9U, 0x8EU,
+        0xE5U, 0xE9U, 0xD1U, 0x22U, 0xAEU, 0x77U, 0x71U, 0xB7U, 0x9FU, 0x65U, 0xB6U, 0x1FU, 0xC7U, 0xCFU, 0x24U, 0x69U,
+    },
+    {
+        0x0AU, 0x7CU, 0x80U, 0x26U, 0xB3U, 0x46U, 0xABU, 0x36U, 0xE2U, 0x43U, 0x60U, 0xCCU, 0x1BU, 0x5BU, 0xFEU, 0x8FU,
+        0xEDU, 0xFEU, 0x2DU, 0xB3U, 0x7AU, 0xC8U, 0x02U, 0x7FU, 0x15U, 0x37U, 0x5CU, 0xCFU, 0x5EU, 0xC1U, 0x79U, 0x24U,
+    },
+    {
+        0x9FU, 0x43U, 0x1EU, 0xB1U, 0x41U, 0x7AU, 0x12U, 0xD3U, 0x7BU, 0xF6U, 0xCBU, 0xFBU, 0xAAU, 0xA5U, 0xF3U, 0x0DU,
+        0x68U, 0xF3U, 0x79U, 0x41U, 0x36U, 0x20U, 0xAEU, 0xBAU, 0xEEU, 0x84U, 0x87U, 0x02U, 0x29U, 0x46U, 0xCFU, 0x1FU,
+    },
+    {
+        0x47U, 0x81U, 0xAFU, 0x77U, 0x1DU, 0xA9U, 0xE9U, 0x52U, 0xE7U, 0x49U, 0xDEU, 0x41U, 0x29U, 0xBDU, 0xB8U, 0x08U,
+        0x40U, 0xB8U, 0x7BU, 0x1DU, 0xBCU, 0xEAU, 0x96U, 0x5CU, 0xC5U, 0x19U, 0xCBU, 0x9CU, 0x5DU, 0x70U, 0x61U, 0xE1U,
+    },
+    {
+        0xD2U, 0xBEU, 0x31U, 0xE0U, 0xEFU, 0x95U, 0x50U, 0xB7U, 0x7EU, 0xFCU, 0x75U, 0x76U, 0x98U, 0x43U, 0xB5U, 0x8AU,
+        0xC5U, 0xB5U, 0x2FU, 0xEFU, 0xF0U, 0x02U, 0x3AU, 0x99U, 0x3EU, 0xAAU, 0x10U, 0x51U, 0x2AU, 0xF7U, 0xD7U, 0xDAU,
+    },
+    {
+        0xEAU, 0xFFU, 0x14U, 0xDEU, 0x7EU, 0xD1U, 0x1CU, 0x1FU, 0x52U, 0xA4U, 0x0FU, 0x2FU, 0xCCU, 0xC6U, 0xA2U, 0x8BU,
+        0xCDU, 0xA2U, 0xD3U, 0x7EU, 0x24U, 0xBDU, 0x49U, 0x51U, 0xB4U, 0xF8U, 0xFAU, 0x81U, 0xB3U, 0xF9U, 0x8AU, 0x97U,
+    },
+    {
+        0x7FU, 0xC0U, 0x8AU, 0x49U, 0x8CU, 0xEDU, 0xA5U, 0xFAU, 0xCBU, 0x11U, 0xA4U, 0x18U, 0x7DU, 0x38U, 0xAFU, 0x09U,
+        0x48U, 0xAFU, 0x87U, 0x8CU, 0x68U, 0x55U, 0xE5U, 0x94U, 0x4FU, 0x4BU, 0x21U, 0x4CU, 0xC4U, 0x7EU, 0x3CU, 0xACU,
+    },
+    {
+        0x9AU, 0x7DU, 0x5EU, 0xA2U, 0xDBU, 0x59U, 0x84U, 0xC8U, 0x0AU, 0x14U, 0xFBU, 0x9DU, 0x64U, 0x4BU, 0x8CU, 0x89U,
+        0xDDU, 0x8CU, 0xACU, 0xDBU, 0x0BU, 0x44U, 0xAFU, 0x46U, 0x27U, 0x5CU, 0xA9U, 0xA6U, 0x06U, 0xE5U, 0x30U, 0x0DU,
+    },
+    {
+        0x0FU, 0x42U, 0xC0U, 0x35U, 0x29U, 0x65U, 0x3DU, 0x2DU, 0x93U, 0xA1U, 0x50U, 0xAAU, 0xD5U, 0xB5U, 0x81U, 0x0BU,
+        0x58U, 0x81U, 0xF8U, 0x29U, 0x47U, 0xACU, 0x03U, 0x83U, 0xDCU, 0xEFU, 0x72U, 0x6BU, 0x71U, 0x62U, 0x86U, 0x36U,
+    },
+    {
+        0x37U, 0x03U, 0xE5U, 0x0BU, 0xB8U, 0x21U, 0x71U, 0x85U, 0xBFU, 0xF9U, 0x2AU, 0xF3U, 0x81U, 0x30U, 0x96U, 0x0AU,
+        0x50U, 0x96U, 0x04U, 0xB8U, 0x93U, 0x13U, 0x70U, 0x4BU, 0x56U, 0xBDU, 0x98U, 0xBBU, 0xE8U, 0x6CU, 0xDBU, 0x7BU,
+    },
+    {
+        0xA2U, 0x3CU, 0x7BU, 0x9CU, 0x4AU, 0x1DU, 0xC8U, 0x60U, 0x26U, 0x4CU, 0x81U, 0xC4U, 0x30U, 0xCEU, 0x9BU, 0x88U,
+        0xD5U, 0x9BU, 0x50U, 0x4AU, 0xDFU, 0xFBU, 0xDCU, 0x8EU, 0xADU, 0x0EU, 0x43U, 0x76U, 0x9FU, 0xEBU, 0x6DU, 0x40U,
+    },
+    {
+        0xF4U, 0x7BU, 0x13U, 0xB4U, 0x2CU, 0x1BU, 0x66U, 0x45U, 0xF3U, 0x61U, 0xAFU, 0xFCU, 0xE1U, 0x2BU, 0x27U, 0x9DU,
+        0x7DU, 0x27U, 0xA4U, 0x2CU, 0xAAU, 0x62U, 0x4FU, 0xD0U, 0x8BU, 0xA1U, 0x1EU, 0x57U, 0x51U, 0x3DU, 0x01U, 0xFBU,
+    },
+    {
+        0x61U, 0x44U, 0x8DU, 0x23U, 0xDEU, 0x27U, 0xDFU, 0xA0U, 0x6AU, 0xD4U, 0x04U, 0xCBU, 0x50U, 0xD5U, 0x2AU, 0x1FU,
+        0xF8U, 0x2AU, 0xF0U, 0xDEU, 0xE6U, 0x8AU, 0xE3U, 0x15U, 0x70U, 0x12U, 0xC5U, 0x9AU, 0x26U, 0xBAU, 0xB7U, 0xC0U,
+    },
+    {
+        0x59U, 0x05U, 0xA8U, 0x1DU, 0x4FU, 0x63U, 0x93U, 0x08U, 0x46U, 0x8CU, 0x7EU, 0x92U, 0x04U, 0x50U, 0x3DU, 0x1EU,
+        0xF0U, 0x3DU, 0x0CU, 0x4FU, 0x32U, 0x35U, 0x90U, 0xDDU, 0xFAU, 0x40U, 0x2FU, 0x4AU, 0xBFU, 0xB4U, 0xEAU, 0x8DU,
+    },
+    {
+        0xCCU, 0x3AU, 0x36U, 0x8AU, 0xBDU, 0x5FU, 0x2AU, 0xEDU, 0xDFU, 0x39U, 0xD5U, 0xA5U, 0xB5U, 0xAEU, 0x30U, 0x9CU,
+        0x75U, 0x30U, 0x58U, 0xBDU, 0x7EU, 0xDDU, 0x3CU, 0x18U, 0x01U, 0xF3U, 0xF4U, 0x87U, 0xC8U, 0x33U, 0x5CU, 0xB6U,
+    },
+    {
+        0x29U, 0x87U, 0xE2U, 0x61U, 0xEAU, 0xEBU, 0x0BU, 0xDFU, 0x1EU, 0x3CU, 0x8AU, 0x20U, 0xACU, 0xDDU, 0x13U, 0x1CU,
+        0xE0U, 0x13U, 0x73U, 0xEAU, 0x1DU, 0xCCU, 0x76U, 0xCAU, 0x69U, 0xE4U, 0x7CU, 0x6DU, 0x0AU, 0xA8U, 0x50U, 0x17U,
+    },
+    {
+        0xBCU, 0xB8U, 0x7CU, 0xF6U, 0x18U, 0xD7U, 0xB2U, 0x3AU, 0x87U, 0x89U, 0x21U, 0x17U, 0x1DU, 0x23U, 0x1EU, 0x9EU,
+        0x65U, 0x1EU, 0x27U, 0x18U, 0x51U, 0x24U, 0xDAU, 0x0FU, 0x92U, 0x57U, 0xA7U, 0xA0U, 0x7DU, 0x2FU, 0xE6U, 0x2CU,
+    },
+    {
+        0x84U, 0xF9U, 0x59U, 0xC8U, 0x89U, 0x93U, 0xFEU, 0x92U, 0xABU, 0xD1U, 0x5BU, 0x4EU, 0x49U, 0xA6U, 0x09U, 0x9FU,
+        0x6DU, 0x09U, 0xDBU, 0x89U, 0x85U, 0x9BU, 0xA9U, 0xC7U, 0x18U, 0x05U, 0x4DU, 0x70U, 0xE4U, 0x21U, 0xBBU, 0x61U,
+    },
+    {
+        0x11U, 0xC6U, 0xC7U, 0x5FU, 0x7BU, 0xAFU, 0x47U, 0x77U, 0x32U, 0x64U, 0xF0U, 0x79U, 0xF8U, 0x58U, 0x04U, 0x1DU,
+        0xE8U, 0x04U, 0x8FU, 0x7BU, 0xC9U, 0x73U, 0x05U, 0x02U, 0xE3U, 0xB6U, 0x96U, 0xBDU, 0x93U, 0xA6U, 0x0DU, 0x5AU,
+    },
+    {
+        0xC9U, 0x04U, 0x76U, 0x99U, 0x27U, 0x7CU, 0xBCU, 0xF6U, 0xAEU, 0xDBU, 0xE5U, 0xC3U, 0x7BU, 0x40U, 0x4FU, 0x18U,
+        0xC0U, 0x4FU, 0x8DU, 0x27U, 0x43U, 0xB9U, 0x3DU, 0xE4U, 0xC8U, 0x2BU, 0xDAU, 0x23U, 0xE7U, 0x90U, 0xA3U, 0xA4U,
+    },
+    {
+        0x5CU, 0x3BU, 0xE8U, 0x0EU, 0xD5U, 0x40U, 0x05U, 0x13U, 0x37U, 0x6EU, 0x4EU, 0xF4U, 0xCAU, 0xBEU, 0x42U, 0x9AU,
+        0x45U, 0x42U, 0xD9U, 0xD5U, 0x0FU, 0x51U, 0x91U, 0x21U, 0x33U, 0x98U, 0x01U, 0xEEU, 0x90U, 0x17U, 0x15U, 0x9FU,
+    },
+    {
+        0x64U, 0x7AU, 0xCDU, 0x30U, 0x44U, 0x04U, 0x49U, 0xBBU, 0x1BU, 0x36U, 0x34U, 0xADU, 0x9EU, 0x3BU, 0x55U, 0x9BU,
+        0x4DU, 0x55U, 0x25U, 0x44U, 0xDBU, 0xEEU, 0xE2U, 0xE9U, 0xB9U, 0xCAU, 0xEBU, 0x3EU, 0x09U, 0x19U, 0x48U, 0xD2U,
+    },
+    {
+        0xF1U, 0x45U, 0x53U, 0xA7U, 0xB6U, 0x38U, 0xF0U, 0x5EU, 0x82U, 0x83U, 0x9FU, 0x9AU, 0x2FU, 0xC5U, 0x58U, 0x19U,
+        0xC8U, 0x58U, 0x71U, 0xB6U, 0x97U, 0x06U, 0x4EU, 0x2CU, 0x42U, 0x79U, 0x30U, 0xF3U, 0x7EU, 0x9EU, 0xFEU, 0xE9U,
+    },
+    {
+        0x14U, 0xF8U, 0x87U, 0x4CU, 0xE1U, 0x8CU, 0xD1U, 0x6CU, 0x43U, 0x86U, 0xC0U, 0x1FU, 0x36U, 0xB6U, 0x7BU, 0x99U,
+        0x5DU, 0x7BU, 0x5AU, 0xE1U, 0xF4U, 0x17U, 0x04U, 0xFEU, 0x2AU, 0x6EU, 0xB8U, 0x19U, 0xBCU, 0x05U, 0xF2U, 0x48U,
+    },
+    {
+        0x81U, 0xC7U, 0x19U, 0xDBU, 0x13U, 0xB0U, 0x68U, 0x89U, 0xDAU, 0x33U, 0x6BU, 0x28U, 0x87U, 0x48U, 0x76U, 0x1BU,
+        0xD8U, 0x76U, 0x0EU, 0x13U, 0xB8U, 0xFFU, 0xA8U, 0x3BU, 0xD1U, 0xDDU, 0x63U, 0xD4U, 0xCBU, 0x82U, 0x44U, 0x73U,
+    },
+    {
+        0xB9U, 0x86U, 0x3CU, 0xE5U, 0x82U, 0xF4U, 0x24U, 0x21U, 0xF6U, 0x6BU, 0x11U, 0x71U, 0xD3U, 0xCDU, 0x61U, 0x1AU,
+        0xD0U, 0x61U, 0xF2U, 0x82U, 0x6CU, 0x40U, 0xDBU, 0xF3U, 0x5BU, 0x8FU, 0x89U, 0x04U, 0x52U, 0x8CU, 0x19U, 0x3EU,
+    },
+    {
+        0x2CU, 0xB9U, 0xA2U, 0x72U, 0x70U, 0xC8U, 0x9DU, 0xC4U, 0x6FU, 0xDEU, 0xBAU, 0x46U, 0x62U, 0x33U, 0x6CU, 0x98U,
+        0x55U, 0x6CU, 0xA6U, 0x70U, 0x20U, 0xA8U, 0x77U, 0x36U, 0xA0U, 0x3CU, 0x52U, 0xC9U, 0x25U, 0x0BU, 0xAFU, 0x05U,
+    },
+    {
+        0x8EU, 0x85U, 0xD9U, 0xEEU, 0x3AU, 0xD5U, 0x55U, 0xA4U, 0x49U, 0x92U, 0x3BU, 0x82U, 0x52U, 0xFDU, 0xF7U, 0x10U,
+        0x80U, 0xF7U, 0xF6U, 0x3AU, 0xFFU, 0x53U, 0xABU, 0xB8U, 0x0DU, 0x32U, 0x11U, 0xBFU, 0xBAU, 0xE0U, 0xC2U, 0x45U,
+    },
+    {
+        0x1BU, 0xBAU, 0x47U, 0x79U, 0xC8U, 0xE9U, 0xECU, 0x41U, 0xD0U, 0x27U, 0x90U, 0xB5U, 0xE3U, 0x03U, 0xFAU, 0x92U,
+        0x05U, 0xFAU, 0xA2U, 0xC8U, 0xB3U, 0xBBU, 0x07U, 0x7DU, 0xF6U, 0x81U, 0xCAU, 0x72U, 0xCDU, 0x67U, 0x74U, 0x7EU,
+    },
+    {
+        0x23U, 0xFBU, 0x62U, 0x47U, 0x59U, 0xADU, 0xA0U, 0xE9U, 0xFCU, 0x7FU, 0xEAU, 0xECU, 0xB7U, 0x86U, 0xEDU, 0x93U,
+        0x0DU, 0xEDU, 0x5EU, 0x59U, 0x67U, 0x04U, 0x74U, 0xB5U, 0x7CU, 0xD3U, 0x20U, 0xA2U, 0x54U, 0x69U, 0x29U, 0x33U,
+    },
+    {
+        0xB6U, 0xC4U, 0xFCU, 0xD0U, 0xABU, 0x91U, 0x19U, 0x0CU, 0x65U, 0xCAU, 0x41U, 0xDBU, 0x06U, 0x78U, 0xE0U, 0x11U,
+        0x88U, 0xE0U, 0x0AU, 0xABU, 0x2BU, 0xECU, 0xD8U, 0x70U, 0x87U, 0x60U, 0xFBU, 0x6FU, 0x23U, 0xEEU, 0x9FU, 0x08U,
+    },
+    {
+        0x53U, 0x79U, 0x28U, 0x3BU, 0xFCU, 0x25U, 0x38U, 0x3EU, 0xA4U, 0xCFU, 0x1EU, 0x5EU, 0x1FU, 0x0BU, 0xC3U, 0x91U,
+        0x1DU, 0xC3U, 0x21U, 0xFCU, 0x48U, 0xFDU, 0x92U, 0xA2U, 0xEFU, 0x77U, 0x73U, 0x85U, 0xE1U, 0x75U, 0x93U, 0xA9U,
+    },
+    {
+        0xC6U, 0x46U, 0xB6U, 0xACU, 0x0EU, 0x19U, 0x81U, 0xDBU, 0x3DU, 0x7AU, 0xB5U, 0x69U, 0xAEU, 0xF5U, 0xCEU, 0x13U,
+        0x98U, 0xCEU, 0x75U, 0x0EU, 0x04U, 0x15U, 0x3EU, 0x67U, 0x14U, 0xC4U, 0xA8U, 0x48U, 0x96U, 0xF2U, 0x25U, 0x92U,
+    },
+    {
+        0xFEU, 0x07U, 0x93U, 0x92U, 0x9FU, 0x5DU, 0xCDU, 0x73U, 0x11U, 0x22U, 0xCFU, 0x30U, 0xFAU, 0x70U, 0xD9U, 0x12U,
+        0x90U, 0xD9U, 0x89U, 0x9FU, 0xD0U, 0xAAU, 0x4DU, 0xAFU, 0x9EU, 0x96U, 0x42U, 0x98U, 0x0FU, 0xFCU, 0x78U, 0xDFU,
+    },
+    {
+        0x6BU, 0x38U, 0x0DU, 0x05U, 0x6DU, 0x61U, 0x74U, 0x96U, 0x88U, 0x97U, 0x64U, 0x07U, 0x4BU, 0x8EU, 0xD4U, 0x90U,
+        0x15U, 0xD4U, 0xDDU, 0x6DU, 0x9CU, 0x42U, 0xE1U, 0x6AU, 0x65U, 0x25U, 0x99U, 0x55U, 0x78U, 0x7BU, 0xCEU, 0xE4U,
+    },
+    {
+        0xB3U, 0xFAU, 0xBCU, 0xC3U, 0x31U, 0xB2U, 0x8FU, 0x17U, 0x14U, 0x28U, 0x71U, 0xBDU, 0xC8U, 0x96U, 0x9FU, 0x95U,
+        0x3DU, 0x9FU, 0xDFU, 0x31U, 0x16U, 0x88U, 0xD9U, 0x8CU, 0x4EU, 0xB8U, 0xD5U, 0xCBU, 0x0CU, 0x4DU, 0x60U, 0x1AU,
+    },
+    {
+        0x26U, 0xC5U, 0x22U, 0x54U, 0xC3U, 0x8EU, 0x36U, 0xF2U, 0x8DU, 0x9DU, 0xDAU, 0x8AU, 0x79U, 0x68U, 0x92U, 0x17U,
+        0xB8U, 0x92U, 0x8BU, 0xC3U, 0x5AU, 0x60U, 0x75U, 0x49U, 0xB5U, 0x0BU, 0x0EU, 0x06U, 0x7BU, 0xCAU, 0xD6U, 0x21U,
+    },
+    {
+        0x1EU, 0x84U, 0x07U, 0x6AU, 0x52U, 0xCAU, 0x7AU, 0x5AU, 0xA1U, 0xC5U, 0xA0U, 0xD3U, 0x2DU, 0xEDU, 0x85U, 0x16U,
+        0xB0U, 0x85U, 0x77U, 0x52U, 0x8EU, 0xDFU, 0x06U, 0x81U, 0x3FU, 0x59U, 0xE4U, 0xD6U, 0xE2U, 0xC4U, 0x8BU, 0x6CU,
+    },
+    {
+        0x8BU, 0xBBU, 0x99U, 0xFDU, 0xA0U, 0xF6U, 0xC3U, 0xBFU, 0x38U, 0x70U, 0x0BU, 0xE4U, 0x9CU, 0x13U, 0x88U, 0x94U,
+        0x35U, 0x88U, 0x23U, 0xA0U, 0xC2U, 0x37U, 0xAAU, 0x44U, 0xC4U, 0xEAU, 0x3FU, 0x1BU, 0x95U, 0x43U, 0x3DU, 0x57U,
+    },
+    {
+        0x6EU, 0x06U, 0x4DU, 0x16U, 0xF7U, 0x42U, 0xE2U, 0x8DU, 0xF9U, 0x75U, 0x54U, 0x61U, 0x85U, 0x60U, 0xABU, 0x14U,
+        0xA0U, 0xABU, 0x08U, 0xF7U, 0xA1U, 0x26U, 0xE0U, 0x96U, 0xACU, 0xFDU, 0xB7U, 0xF1U, 0x57U, 0xD8U, 0x31U, 0xF6U,
+    },
+    {
+        0xFBU, 0x39U, 0xD3U, 0x81U, 0x05U, 0x7EU, 0x5BU, 0x68U, 0x60U, 0xC0U, 0xFFU, 0x56U, 0x34U, 0x9EU, 0xA6U, 0x96U,
+        0x25U, 0xA6U, 0x5CU, 0x05U, 0xEDU, 0xCEU, 0x4CU, 0x53U, 0x57U, 0x4EU, 0x6CU, 0x3CU, 0x20U, 0x5FU, 0x87U, 0xCDU,
+    },
+    {
+        0xC3U, 0x78U, 0xF6U, 0xBFU, 0x94U, 0x3AU, 0x17U, 0xC0U, 0x4CU, 0x98U, 0x85U, 0x0FU, 0x60U, 0x1BU, 0xB1U, 0x97U,
+        0x2DU, 0xB1U, 0xA0U, 0x94U, 0x39U, 0x71U, 0x3FU, 0x9BU, 0xDDU, 0x1CU, 0x86U, 0xECU, 0xB9U, 0x51U, 0xDAU, 0x80U,
+    },
+    {
+        0x56U, 0x47U, 0x68U, 0x28U, 0x66U, 0x06U, 0xAEU, 0x25U, 0xD5U, 0x2DU, 0x2EU, 0x38U, 0xD1U, 0xE5U, 0xBCU, 0x15U,
+        0xA8U, 0xBCU, 0xF4U, 0x66U, 0x75U, 0x99U, 0x93U, 0x5EU, 0x26U, 0xAFU, 0x5DU, 0x21U, 0xCEU, 0xD6U, 0x6CU, 0xBBU,
+    },
+    {
+        0x6FU, 0xF6U, 0x26U, 0xEFU, 0x58U, 0x36U, 0xCCU, 0x8AU, 0x61U, 0xC2U, 0xD9U, 0x7FU, 0x45U, 0x56U, 0x4EU, 0xBDU,
+        0xFAU, 0x4EU, 0xCFU, 0x58U, 0xD3U, 0xC4U, 0x9EU, 0x27U, 0x91U, 0xC5U, 0x3CU, 0xAEU, 0xA2U, 0x7AU, 0x02U, 0x71U,
+    },
+    {
+        0xFAU, 0xC9U, 0xB8U, 0x78U, 0xAAU, 0x0AU, 0x75U, 0x6FU, 0xF8U, 0x77U, 0x72U, 0x48U, 0xF4U, 0xA8U, 0x43U, 0x3FU,
+        0x7FU, 0x43U, 0x9BU, 0xAAU, 0x9FU, 0x2CU, 0x32U, 0xE2U, 0x6AU, 0x76U, 0xE7U, 0x63U, 0xD5U, 0xFDU, 0xB4U, 0x4AU,
+    },
+    {
+        0xC2U, 0x88U, 0x9DU, 0x46U, 0x3BU, 0x4EU, 0x39U, 0xC7U, 0xD4U, 0x2FU, 0x08U, 0x11U, 0xA0U, 0x2DU, 0x54U, 0x3EU,
+        0x77U, 0x54U, 0x67U, 0x3BU, 0x4BU, 0x93U, 0x41U, 0x2AU, 0xE0U, 0x24U, 0x0DU, 0xB3U, 0x4CU, 0xF3U, 0xE9U, 0x07U,
+    },
+    {
+        0x57U, 0xB7U, 0x03U, 0xD1U, 0xC9U, 0x72U, 0x80U, 0x22U, 0x4DU, 0x9AU, 0xA3U, 0x26U, 0x11U, 0xD3U, 0x59U, 0xBCU,
+        0xF2U, 0x59U, 0x33U, 0xC9U, 0x07U, 0x7BU, 0xEDU, 0xEFU, 0x1BU, 0x97U, 0xD6U, 0x7EU, 0x3BU, 0x74U, 0x5FU, 0x3CU,
+    },
+    {
+        0xB2U, 0x0AU, 0xD7U, 0x3AU, 0x9EU, 0xC6U, 0xA1U, 0x10U, 0x8CU, 0x9FU, 0xFCU, 0xA3U, 0x08U, 0xA0U, 0x7AU, 0x3CU,
+        0x67U, 0x7AU, 0x18U, 0x9EU, 0x64U, 0x6AU, 0xA7U, 0x3DU, 0x73U, 0x80U, 0x5EU, 0x94U, 0xF9U, 0xEFU, 0x53U, 0x9DU,
+    },
+    {
+        0x27U, 0x35U, 0x49U, 0xADU, 0x6CU, 0xFAU, 0x18U, 0xF5U, 0x15U, 0x2AU, 0x57U, 0x94U, 0xB9U, 0x5EU, 0x77U, 0xBEU,
+        0xE2U, 0x77U, 0x4CU, 0x6CU, 0x28U, 0x82U, 0x0BU, 0xF8U, 0x88U, 0x33U, 0x85U, 0x59U, 0x8EU, 0x68U, 0xE5U, 0xA6U,
+    },
+    {
+        0x1FU, 0x74U, 0x6CU, 0x93U, 0xFDU, 0xBEU, 0x54U, 0x5DU, 0x39U, 0x72U, 0x2DU, 0xCDU, 0xEDU, 0xDBU, 0x60U, 0xBFU,
+        0xEAU, 0x60U, 0xB0U, 0xFDU, 0xFCU, 0x3DU, 0x78U, 0x30U, 0x02U, 0x61U, 0x6FU, 0x89U, 0x17U, 0x66U, 0xB8U, 0xEBU,
+    },
+    {
+        0x8AU, 0x4BU, 0xF2U, 0x04U, 0x0FU, 0x82U, 0xEDU, 0xB8U, 0xA0U, 0xC7U, 0x86U, 0xFAU, 0x5CU, 0x25U, 0x6DU, 0x3DU,
+        0x6FU, 0x6DU, 0xE4U, 0x0FU, 0xB0U, 0xD5U, 0xD4U, 0xF5U, 0xF9U, 0xD2U, 0xB4U, 0x44U, 0x60U, 0xE1U, 0x0EU, 0xD0U,
+    },
+    {
+        0x52U, 0x89U, 0x43U, 0xC2U, 0x53U, 0x51U, 0x16U, 0x39U, 0x3CU, 0x78U, 0x93U, 0x40U, 0xDFU, 0x3DU, 0x26U, 0x38U,
+        0x47U, 0x26U, 0xE6U, 0x53U, 0x3AU, 0x1FU, 0xECU, 0x13U, 0xD2U, 0x4FU, 0xF8U, 0xDAU, 0x14U, 0xD7U, 0xA0U, 0x2EU,
+    },
+    {
+        0xC7U, 0xB6U, 0xDDU, 0x55U, 0xA1U, 0x6DU, 0xAFU, 0xDCU, 0xA5U, 0xCDU, 0x38U, 0x77U, 0x6EU, 0xC3U, 0x2BU, 0xBAU,
+        0xC2U, 0x2BU, 0xB2U, 0xA1U, 0x76U, 0xF7U, 0x40U, 0xD6U, 0x29U, 0xFCU, 0x23U, 0x17U, 0x63U, 0x50U, 0x16U, 0x15U,
+    },
+    {
+        0xFFU, 0xF7U, 0xF8U, 0x6BU, 0x30U, 0x29U, 0xE3U, 0x74U, 0x89U, 0x95U, 0x42U, 0x2EU, 0x3AU, 0x46U, 0x3CU, 0xBBU,
+        0xCAU, 0x3CU, 0x4EU, 0x30U, 0xA2U, 0x48U, 0x33U, 0x1EU, 0xA3U, 0xAEU, 0xC9U, 0xC7U, 0xFAU, 0x5EU, 0x4BU, 0x58U,
+    },
+    {
+        0x6AU, 0xC8U, 0x66U, 0xFCU, 0xC2U, 0x15U, 0x5AU, 0x91U, 0x10U, 0x20U, 0xE9U, 0x19U, 0x8BU, 0xB8U, 0x31U, 0x39U,
+        0x4FU, 0x31U, 0x1AU, 0xC2U, 0xEEU, 0xA0U, 0x9FU, 0xDBU, 0x58U, 0x1DU, 0x12U, 0x0AU, 0x8DU, 0xD9U, 0xFDU, 0x63U,
+    },
+    {
+        0x8FU, 0x75U, 0xB2U, 0x17U, 0x95U, 0xA1U, 0x7BU, 0xA3U, 0xD1U, 0x25U, 0xB6U, 0x9CU, 0x92U, 0xCBU, 0x12U, 0xB9U,
+        0xDAU, 0x12U, 0x31U, 0x95U, 0x8DU, 0xB1U, 0xD5U, 0x09U, 0x30U, 0x0AU, 0x9AU, 0xE0U, 0x4FU, 0x42U, 0xF1U, 0xC2U,
+    },
+    {
+        0x1AU, 0x4AU, 0x2CU, 0x80U, 0x67U, 0x9DU, 0xC2U, 0x46U, 0x48U, 0x90U, 0x1DU, 0xABU, 0x23U, 0x35U, 0x1FU, 0x3BU,
+        0x5FU, 0x1FU, 0x65U, 0x67U, 0xC1U, 0x59U, 0x79U, 0xCCU, 0xCBU, 0xB9U, 0x41U, 0x2DU, 0x38U, 0xC5U, 0x47U, 0xF9U,
+    },
+    {
+        0x22U, 0x0BU, 0x09U, 0xBEU, 0xF6U, 0xD9U, 0x8EU, 0xEEU, 0x64U, 0xC8U, 0x67U, 0xF2U, 0x77U, 0xB0U, 0x08U, 0x3AU,
+        0x57U, 0x08U, 0x99U, 0xF6U, 0x15U, 0xE6U, 0x0AU, 0x04U, 0x41U, 0xEBU, 0xABU, 0xFDU, 0xA1U, 0xCBU, 0x1AU, 0xB4U,
+    },
+    {
+        0xB7U, 0x34U, 0x97U, 0x29U, 0x04U, 0xE5U, 0x37U, 0x0BU, 0xFDU, 0x7DU, 0xCCU, 0xC5U, 0xC6U, 0x4EU, 0x05U, 0xB8U,
+        0xD2U, 0x05U, 0xCDU, 0x04U, 0x59U, 0x0EU, 0xA6U, 0xC1U, 0xBAU, 0x58U, 0x70U, 0x30U, 0xD6U, 0x4CU, 0xACU, 0x8FU,
+    },
+    {
+        0x15U, 0x08U, 0xECU, 0xB5U, 0x4EU, 0xF8U, 0xFFU, 0x6BU, 0xDBU, 0x31U, 0x4DU, 0x01U, 0xF6U, 0x80U, 0x9EU, 0x30U,
+        0x07U, 0x9EU, 0x9DU, 0x4EU, 0x86U, 0xF5U, 0x7AU, 0x4FU, 0x17U, 0x56U, 0x33U, 0x46U, 0x49U, 0xA7U, 0xC1U, 0xCFU,
+    },
+    {
+        0x80U, 0x37U, 0x72U, 0x22U, 0xBCU, 0xC4U, 0x46U, 0x8EU, 0x42U, 0x84U, 0xE6U, 0x36U, 0x47U, 0x7EU, 0x93U, 0xB2U,
+        0x82U, 0x93U, 0xC9U, 0xBCU, 0xCAU, 0x1DU, 0xD6U, 0x8AU, 0xECU, 0xE5U, 0xE8U, 0x8BU, 0x3EU, 0x20U, 0x77U, 0xF4U,
+    },
+    {
+        0xB8U, 0x76U, 0x57U, 0x1CU, 0x2DU, 0x80U, 0x0AU, 0x26U, 0x6EU, 0xDCU, 0x9CU, 0x6FU, 0x13U, 0xFBU, 0x84U, 0xB3U,
+        0x8AU, 0x84U, 0x35U, 0x2DU, 0x1EU, 0xA2U, 0xA5U, 0x42U, 0x66U, 0xB7U, 0x02U, 0x5BU, 0xA7U, 0x2EU, 0x2AU, 0xB9U,
+    },
+    {
+        0x2DU, 0x49U, 0xC9U, 0x8BU, 0xDFU, 0xBCU, 0xB3U, 0xC3U, 0xF7U, 0x69U, 0x37U, 0x58U, 0xA2U, 0x05U, 0x89U, 0x31U,
+        0x0FU, 0x89U, 0x61U, 0xDFU, 0x52U, 0x4AU, 0x09U, 0x87U, 0x9DU, 0x04U, 0xD9U, 0x96U, 0xD0U, 0xA9U, 0x9CU, 0x82U,
+    },
+    {
+        0xC8U, 0xF4U, 0x1DU, 0x60U, 0x88U, 0x08U, 0x92U, 0xF1U, 0x36U, 0x6CU, 0x68U, 0xDDU, 0xBBU, 0x76U, 0xAAU, 0xB1U,
+        0x9AU, 0xAAU, 0x4AU, 0x88U, 0x31U, 0x5BU, 0x43U, 0x55U, 0xF5U, 0x13U, 0x51U, 0x7CU, 0x12U, 0x32U, 0x90U, 0x23U,
+    },
+    {
+        0x5DU, 0xCBU, 0x83U, 0xF7U, 0x7AU, 0x34U, 0x2BU, 0x14U, 0xAFU, 0xD9U, 0xC3U, 0xEAU, 0x0AU, 0x88U, 0xA7U, 0x33U,
+        0x1FU, 0xA7U, 0x1EU, 0x7AU, 0x7DU, 0xB3U, 0xEFU, 0x90U, 0x0EU, 0xA0U, 0x8AU, 0xB1U, 0x65U, 0xB5U, 0x26U, 0x18U,
+    },
+    {
+        0x65U, 0x8AU, 0xA6U, 0xC9U, 0xEBU, 0x70U, 0x67U, 0xBCU, 0x83U, 0x81U, 0xB9U, 0xB3U, 0x5EU, 0x0DU, 0xB0U, 0x32U,
+        0x17U, 0xB0U, 0xE2U, 0xEBU, 0xA9U, 0x0CU, 0x9CU, 0x58U, 0x84U, 0xF2U, 0x60U, 0x61U, 0xFCU, 0xBBU, 0x7BU, 0x55U,
+    },
+    {
+        0xF0U, 0xB5U, 0x38U, 0x5EU, 0x19U, 0x4CU, 0xDEU, 0x59U, 0x1AU, 0x34U, 0x12U, 0x84U, 0xEFU, 0xF3U, 0xBDU, 0xB0U,
+        0x92U, 0xBDU, 0xB6U, 0x19U, 0xE5U, 0xE4U, 0x30U, 0x9DU, 0x7FU, 0x41U, 0xBBU, 0xACU, 0x8BU, 0x3CU, 0xCDU, 0x6EU,
+    },
+    {
+        0x28U, 0x77U, 0x89U, 0x98U, 0x45U, 0x9FU, 0x25U, 0xD8U, 0x86U, 0x8BU, 0x07U, 0x3EU, 0x6CU, 0xEBU, 0xF6U, 0xB5U,
+        0xBAU, 0xF6U, 0xB4U, 0x45U, 0x6FU, 0x2EU, 0x08U, 0x7BU, 0x54U, 0xDCU, 0xF7U, 0x32U, 0xFFU, 0x0AU, 0x63U, 0x90U,
+    },
+    {
+        0xBDU, 0x48U, 0x17U, 0x0FU, 0xB7U, 0xA3U, 0x9CU, 0x3DU, 0x1FU, 0x3EU, 0xACU, 0x09U, 0xDDU, 0x15U, 0xFBU, 0x37U,
+        0x3FU, 0xFBU, 0xE0U, 0xB7U, 0x23U, 0xC6U, 0xA4U, 0xBEU, 0xAFU, 0x6FU, 0x2CU, 0xFFU, 0x88U, 0x8DU, 0xD5U, 0xABU,
+    },
+    {
+        0x85U, 0x09U, 0x32U, 0x31U, 0x26U, 0xE7U, 0xD0U, 0x95U, 0x33U, 0x66U, 0xD6U, 0x50U, 0x89U, 0x90U, 0xECU, 0x36U,
+        0x37U, 0xECU, 0x1CU, 0x26U, 0xF7U, 0x79U, 0xD7U, 0x76U, 0x25U, 0x3DU, 0xC6U, 0x2FU, 0x11U, 0x83U, 0x88U, 0xE6U,
+    },
+    {
+        0x10U, 0x36U, 0xACU, 0xA6U, 0xD4U, 0xDBU, 0x69U, 0x70U, 0xAAU, 0xD3U, 0x7DU, 0x67U, 0x38U, 0x6EU, 0xE1U, 0xB4U,
+        0xB2U, 0xE1U, 0x48U, 0xD4U, 0xBBU, 0x91U, 0x7BU, 0xB3U, 0xDEU, 0x8EU, 0x1DU, 0xE2U, 0x66U, 0x04U, 0x3EU, 0xDDU,
+    },
+    {
+        0xF5U, 0x8BU, 0x78U, 0x4DU, 0x83U, 0x6FU, 0x48U, 0x42U, 0x6BU, 0xD6U, 0x22U, 0xE2U, 0x21U, 0x1DU, 0xC2U, 0x34U,
+        0x27U, 0xC2U, 0x63U, 0x83U, 0xD8U, 0x80U, 0x31U, 0x61U, 0xB6U, 0x99U, 0x95U, 0x08U, 0xA4U, 0x9FU, 0x32U, 0x7CU,
+    },
+    {
+        0x60U, 0xB4U, 0xE6U, 0xDAU, 0x71U, 0x53U, 0xF1U, 0xA7U, 0xF2U, 0x63U, 0x89U, 0xD5U, 0x90U, 0xE3U, 0xCFU, 0xB6U,
+        0xA2U, 0xCFU, 0x37U, 0x71U, 0x94U, 0x68U, 0x9DU, 0xA4U, 0x4DU, 0x2AU, 0x4EU, 0xC5U, 0xD3U, 0x18U, 0x84U, 0x47U,
+    },
+    {
+        0x58U, 0xF5U, 0xC3U, 0xE4U, 0xE0U, 0x17U, 0xBDU, 0x0FU, 0xDEU, 0x3BU, 0xF3U, 0x8CU, 0xC4U, 0x66U, 0xD8U, 0xB7U,
+        0xAAU, 0xD8U, 0xCBU, 0xE0U, 0x40U, 0xD7U, 0xEEU, 0x6CU, 0xC7U, 0x78U, 0xA4U, 0x15U, 0x4AU, 0x16U, 0xD9U, 0x0AU,
+    },
+    {
+        0xCDU, 0xCAU, 0x5DU, 0x73U, 0x12U, 0x2BU, 0x04U, 0xEAU, 0x47U, 0x8EU, 0x58U, 0xBBU, 0x75U, 0x98U, 0xD5U, 0x35U,
+        0x2FU, 0xD5U, 0x9FU, 0x12U, 0x0CU, 0x3FU, 0x42U, 0xA9U, 0x3CU, 0xCBU, 0x7FU, 0xD8U, 0x3DU, 0x91U, 0x6FU, 0x31U,
+    },
+    {
+        0x9BU, 0x8DU, 0x35U, 0x5BU, 0x74U, 0x2DU, 0xAAU, 0xCFU, 0x92U, 0xA3U, 0x76U, 0x83U, 0xA4U, 0x7DU, 0x69U, 0x20U,
+        0x87U, 0x69U, 0x6BU, 0x74U, 0x79U, 0xA6U, 0xD1U, 0xF7U, 0x1AU, 0x64U, 0x22U, 0xF9U, 0xF3U, 0x47U, 0x03U, 0x8AU,
+    },
+    {
+        0x0EU, 0xB2U, 0xABU, 0xCCU, 0x86U, 0x11U, 0x13U, 0x2AU, 0x0BU, 0x16U, 0xDDU, 0xB4U, 0x15U, 0x83U, 0x64U, 0xA2U,
+        0x02U, 0x64U, 0x3FU, 0x86U, 0x35U, 0x4EU, 0x7DU, 0x32U, 0xE1U, 0xD7U, 0xF9U, 0x34U, 0x84U, 0xC0U, 0xB5U, 0xB1U,
+    },
+    {
+        0x36U, 0xF3U, 0x8EU, 0xF2U, 0x17U, 0x55U, 0x5FU, 0x82U, 0x27U, 0x4EU, 0xA7U, 0xEDU, 0x41U, 0x06U, 0x73U, 0xA3U,
+        0x0AU, 0x73U, 0xC3U, 0x17U, 0xE1U, 0xF1U, 0x0EU, 0xFAU, 0x6BU, 0x85U, 0x13U, 0xE4U, 0x1DU, 0xCEU, 0xE8U, 0xFCU,
+    },
+    {
+        0xA3U, 0xCCU, 0x10U, 0x65U, 0xE5U, 0x69U, 0xE6U, 0x67U, 0xBEU, 0xFBU, 0x0CU, 0xDAU, 0xF0U, 0xF8U, 0x7EU, 0x21U,
+        0x8FU, 0x7EU, 0x97U, 0xE5U, 0xADU, 0x19U, 0xA2U, 0x3FU, 0x90U, 0x36U, 0xC8U, 0x29U, 0x6AU, 0x49U, 0x5EU, 0xC7U,
+    },
+    {
+        0x46U, 0x71U, 0xC4U, 0x8EU, 0xB2U, 0xDDU, 0xC7U, 0x55U, 0x7FU, 0xFEU, 0x53U, 0x5FU, 0xE9U, 0x8BU, 0x5DU, 0xA1U,
+        0x1AU, 0x5DU, 0xBCU, 0xB2U, 0xCEU, 0x08U, 0xE8U, 0xEDU, 0xF8U, 0x21U, 0x40U, 0xC3U, 0xA8U, 0xD2U, 0x52U, 0x66U,
+    },
+    {
+        0xD3U, 0x4EU, 0x5AU, 0x19U, 0x40U, 0xE1U, 0x7EU, 0xB0U, 0xE6U, 0x4BU, 0xF8U, 0x68U, 0x58U, 0x75U, 0x50U, 0x23U,
+        0x9FU, 0x50U, 0xE8U, 0x40U, 0x82U, 0xE0U, 0x44U, 0x28U, 0x03U, 0x92U, 0x9BU, 0x0EU, 0xDFU, 0x55U, 0xE4U, 0x5DU,
+    },
+    {
+        0xEBU, 0x0FU, 0x7FU, 0x27U, 0xD1U, 0xA5U, 0x32U, 0x18U, 0xCAU, 0x13U, 0x82U, 0x31U, 0x0CU, 0xF0U, 0x47U, 0x22U,
+        0x97U, 0x47U, 0x14U, 0xD1U, 0x56U, 0x5FU, 0x37U, 0xE0U, 0x89U, 0xC0U, 0x71U, 0xDEU, 0x46U, 0x5BU, 0xB9U, 0x10U,
+    },
+    {
+        0x7EU, 0x30U, 0xE1U, 0xB0U, 0x23U, 0x99U, 0x8BU, 0xFDU, 0x53U, 0xA6U, 0x29U, 0x06U, 0xBDU, 0x0EU, 0x4AU, 0xA0U,
+        0x12U, 0x4AU, 0x40U, 0x23U, 0x1AU, 0xB7U, 0x9BU, 0x25U, 0x72U, 0x73U, 0xAAU, 0x13U, 0x31U, 0xDCU, 0x0FU, 0x2BU,
+    },
+    {
+        0xA6U, 0xF2U, 0x50U, 0x76U, 0x7FU, 0x4AU, 0x70U, 0x7CU, 0xCFU, 0x19U, 0x3CU, 0xBCU, 0x3EU, 0x16U, 0x01U, 0xA5U,
+        0x3AU, 0x01U, 0x42U, 0x7FU, 0x90U, 0x7DU, 0xA3U, 0xC3U, 0x59U, 0xEEU, 0xE6U, 0x8DU, 0x45U, 0xEAU, 0xA1U, 0xD5U,
+    },
+    {
+        0x33U, 0xCDU, 0xCEU, 0xE1U, 0x8DU, 0x76U, 0xC9U, 0x99U, 0x56U, 0xACU, 0x97U, 0x8BU, 0x8FU, 0xE8U, 0x0CU, 0x27U,
+        0xBFU, 0x0CU, 0x16U, 0x8DU, 0xDCU, 0x95U, 0x0FU, 0x06U, 0xA2U, 0x5DU, 0x3DU, 0x40U, 0x32U, 0x6DU, 0x17U, 0xEEU,
+    },
+    {
+        0x0BU, 0x8CU, 0xEBU, 0xDFU, 0x1CU, 0x32U, 0x85U, 0x31U, 0x7AU, 0xF4U, 0xEDU, 0xD2U, 0xDBU, 0x6DU, 0x1BU, 0x26U,
+        0xB7U, 0x1BU, 0xEAU, 0x1CU, 0x08U, 0x2AU, 0x7CU, 0xCEU, 0x28U, 0x0FU, 0xD7U, 0x90U, 0xABU, 0x63U, 0x4AU, 0xA3U,
+    },
+    {
+        0x9EU, 0xB3U, 0x75U, 0x48U, 0xEEU, 0x0EU, 0x3CU, 0xD4U, 0xE3U, 0x41U, 0x46U, 0xE5U, 0x6AU, 0x93U, 0x16U, 0xA4U,
+        0x32U, 0x16U, 0xBEU, 0xEEU, 0x44U, 0xC2U, 0xD0U, 0x0BU, 0xD3U, 0xBCU, 0x0CU, 0x5DU, 0xDCU, 0xE4U, 0xFCU, 0x98U,
+    },
+    {
+        0x7BU, 0x0EU, 0xA1U, 0xA3U, 0xB9U, 0xBAU, 0x1DU, 0xE6U, 0x22U, 0x44U, 0x19U, 0x60U, 0x73U, 0xE0U, 0x35U, 0x24U,
+        0xA7U, 0x35U, 0x95U, 0xB9U, 0x27U, 0xD3U, 0x9AU, 0xD9U, 0xBBU, 0xABU, 0x84U, 0xB7U, 0x1EU, 0x7FU, 0xF0U, 0x39U,
+    },
+    {
+        0xEEU, 0x31U, 0x3FU, 0x34U, 0x4BU, 0x86U, 0xA4U, 0x03U, 0xBBU, 0xF1U, 0xB2U, 0x57U, 0xC2U, 0x1EU, 0x38U, 0xA6U,
+        0x22U, 0x38U, 0xC1U, 0x4BU, 0x6BU, 0x3BU, 0x36U, 0x1CU, 0x40U, 0x18U, 0x5FU, 0x7AU, 0x69U, 0xF8U, 0x46U, 0x02U,
+    },
+    {
+        0xD6U, 0x70U, 0x1AU, 0x0AU, 0xDAU, 0xC2U, 0xE8U, 0xABU, 0x97U, 0xA9U, 0xC8U, 0x0EU, 0x96U, 0x9BU, 0x2FU, 0xA7U,
+        0x2AU, 0x2FU, 0x3DU, 0xDAU, 0xBFU, 0x84U, 0x45U, 0xD4U, 0xCAU, 0x4AU, 0xB5U, 0xAAU, 0xF0U, 0xF6U, 0x1BU, 0x4FU,
+    },
+    {
+        0x43U, 0x4FU, 0x84U, 0x9DU, 0x28U, 0xFEU, 0x51U, 0x4EU, 0x0EU, 0x1CU, 0x63U, 0x39U, 0x27U, 0x65U, 0x22U, 0x25U,
+        0xAFU, 0x22U, 0x69U, 0x28U, 0xF3U, 0x6CU, 0xE9U, 0x11U, 0x31U, 0xF9U, 0x6EU, 0x67U, 0x87U, 0x71U, 0xADU, 0x74U,
+    },
+    {
+        0xE1U, 0x73U, 0xFFU, 0x01U, 0x62U, 0xE3U, 0x99U, 0x2EU, 0x28U, 0x50U, 0xE2U, 0xFDU, 0x17U, 0xABU, 0xB9U, 0xADU,
+        0x7AU, 0xB9U, 0x39U, 0x62U, 0x2CU, 0x97U, 0x35U, 0x9FU, 0x9CU, 0xF7U, 0x2DU, 0x11U, 0x18U, 0x9AU, 0xC0U, 0x34U,
+    },
+    {
+        0x74U, 0x4CU, 0x61U, 0x96U, 0x90U, 0xDFU, 0x20U, 0xCBU, 0xB1U, 0xE5U, 0x49U, 0xCAU, 0xA6U, 0x55U, 0xB4U, 0x2FU,
+        0xFFU, 0xB4U, 0x6DU, 0x90U, 0x60U, 0x7FU, 0x99U, 0x5AU, 0x67U, 0x44U, 0xF6U, 0xDCU, 0x6FU, 0x1DU, 0x76U, 0x0FU,
+    },
+    {
+        0x4CU, 0x0DU, 0x44U, 0xA8U, 0x01U, 0x9BU, 0x6CU, 0x63U, 0x9DU, 0xBDU, 0x33U, 0x93U, 0xF2U, 0xD0U, 0xA3U, 0x2EU,
+        0xF7U, 0xA3U, 0x91U, 0x01U, 0xB4U, 0xC0U, 0xEAU, 0x92U, 0xEDU, 0x16U, 0x1CU, 0x0CU, 0xF6U, 0x13U, 0x2BU, 0x42U,
+    },
+    {
+        0xD9U, 0x32U, 0xDAU, 0x3FU, 0xF3U, 0xA7U, 0xD5U, 0x86U, 0x04U, 0x08U, 0x98U, 0xA4U, 0x43U, 0x2EU, 0xAEU, 0xACU,
+        0x72U, 0xAEU, 0xC5U, 0xF3U, 0xF8U, 0x28U, 0x46U, 0x57U, 0x16U, 0xA5U, 0xC7U, 0xC1U, 0x81U, 0x94U, 0x9DU, 0x79U,
+    },
+    {
+        0x3CU, 0x8FU, 0x0EU, 0xD4U, 0xA4U, 0x13U, 0xF4U, 0xB4U, 0xC5U, 0x0DU, 0xC7U, 0x21U, 0x5AU, 0x5DU, 0x8DU, 0x2CU,
+        0xE7U, 0x8DU, 0xEEU, 0xA4U, 0x9BU, 0x39U, 0x0CU, 0x85U, 0x7EU, 0xB2U, 0x4FU, 0x2BU, 0x43U, 0x0FU, 0x91U, 0xD8U,
+    },
+    {
+        0xA9U, 0xB0U, 0x90U, 0x43U, 0x56U, 0x2FU, 0x4DU, 0x51U, 0x5CU, 0xB8U, 0x6CU, 0x16U, 0xEBU, 0xA3U, 0x80U, 0xAEU,
+        0x62U, 0x80U, 0xBAU, 0x56U, 0xD7U, 0xD1U, 0xA0U, 0x40U, 0x85U, 0x01U, 0x94U, 0xE6U, 0x34U, 0x88U, 0x27U, 0xE3U,
+    },
+    {
+        0x91U, 0xF1U, 0xB5U, 0x7DU, 0xC7U, 0x6BU, 0x01U, 0xF9U, 0x70U, 0xE0U, 0x16U, 0x4FU, 0xBFU, 0x26U, 0x97U, 0xAFU,
+        0x6AU, 0x97U, 0x46U, 0xC7U, 0x03U, 0x6EU, 0xD3U, 0x88U, 0x0FU, 0x53U, 0x7EU, 0x36U, 0xADU, 0x86U, 0x7AU, 0xAEU,
+    },
+    {
+        0x04U, 0xCEU, 0x2BU, 0xEAU, 0x35U, 0x57U, 0xB8U, 0x1CU, 0xE9U, 0x55U, 0xBDU, 0x78U, 0x0EU, 0xD8U, 0x9AU, 0x2DU,
+        0xEFU, 0x9AU, 0x12U, 0x35U, 0x4FU, 0x86U, 0x7FU, 0x4DU, 0xF4U, 0xE0U, 0xA5U, 0xFBU, 0xDAU, 0x01U, 0xCCU, 0x95U,
+    },
+    {
+        0xDCU, 0x0CU, 0x9AU, 0x2CU, 0x69U, 0x84U, 0x43U, 0x9DU, 0x75U, 0xEAU, 0xA8U, 0xC2U, 0x8DU, 0xC0U, 0xD1U, 0x28U,
+        0xC7U, 0xD1U, 0x10U, 0x69U, 0xC5U, 0x4CU, 0x47U, 0xABU, 0xDFU, 0x7DU, 0xE9U, 0x65U, 0xAEU, 0x37U, 0x62U, 0x6BU,
+    },
+    {
+        0x49U, 0x33U, 0x04U, 0xBBU, 0x9BU, 0xB8U, 0xFAU, 0x78U, 0xECU, 0x5FU, 0x03U, 0xF5U, 0x3CU, 0x3EU, 0xDCU, 0xAAU,
+        0x42U, 0xDCU, 0x44U, 0x9BU, 0x89U, 0xA4U, 0xEBU, 0x6EU, 0x24U, 0xCEU, 0x32U, 0xA8U, 0xD9U, 0xB0U, 0xD4U, 0x50U,
+    },
+    {
+        0x71U, 0x72U, 0x21U, 0x85U, 0x0AU, 0xFCU, 0xB6U, 0xD0U, 0xC0U, 0x07U, 0x79U, 0xACU, 0x68U, 0xBBU, 0xCBU, 0xABU,
+        0x4AU, 0xCBU, 0xB8U, 0x0AU, 0x5DU, 0x1BU, 0x98U, 0xA6U, 0xAEU, 0x9CU, 0xD8U, 0x78U, 0x40U, 0xBEU, 0x89U, 0x1DU,
+    },
+    {
+        0xE4U, 0x4DU, 0xBFU, 0x12U, 0xF8U, 0xC0U, 0x0FU, 0x35U, 0x59U, 0xB2U, 0xD2U, 0x9BU, 0xD9U, 0x45U, 0xC6U, 0x29U,
+        0xCFU, 0xC6U, 0xECU, 0xF8U, 0x11U, 0xF3U, 0x34U, 0x63U, 0x55U, 0x2FU, 0x03U, 0xB5U, 0x37U, 0x39U, 0x3FU, 0x26U,
+    },
+    {
+        0x01U, 0xF0U, 0x6BU, 0xF9U, 0xAFU, 0x74U, 0x2EU, 0x07U, 0x98U, 0xB7U, 0x8DU, 0x1EU, 0xC0U, 0x36U, 0xE5U, 0xA9U,
+        0x5AU, 0xE5U, 0xC7U, 0xAFU, 0x72U, 0xE2U, 0x7EU, 0xB1U, 0x3DU, 0x38U, 0x8BU, 0x5FU, 0xF5U, 0xA2U, 0x33U, 0x87U,
+    },
+    {
+        0x94U, 0xCFU, 0xF5U, 0x6EU, 0x5DU, 0x48U, 0x97U, 0xE2U, 0x01U, 0x02U, 0x26U, 0x29U, 0x71U, 0xC8U, 0xE8U, 0x2BU,
+        0xDFU, 0xE8U, 0x93U, 0x5DU, 0x3EU, 0x0AU, 0xD2U, 0x74U, 0xC6U, 0x8BU, 0x50U, 0x92U, 0x82U, 0x25U, 0x85U, 0xBCU,
+    },
+    {
+        0xACU, 0x8EU, 0xD0U, 0x50U, 0xCCU, 0x0CU, 0xDBU, 0x4AU, 0x2DU, 0x5AU, 0x5CU, 0x70U, 0x25U, 0x4DU, 0xFFU, 0x2AU,
+        0xD7U, 0xFFU, 0x6FU, 0xCCU, 0xEAU, 0xB5U, 0xA1U, 0xBCU, 0x4CU, 0xD9U, 0xBAU, 0x42U, 0x1BU, 0x2BU, 0xD8U, 0xF1U,
+    },
+    {
+        0x39U, 0xB1U, 0x4EU, 0xC7U, 0x3EU, 0x30U, 0x62U, 0xAFU, 0xB4U, 0xEFU, 0xF7U, 0x47U, 0x94U, 0xB3U, 0xF2U, 0xA8U,
+        0x52U, 0xF2U, 0x3BU, 0x3EU, 0xA6U, 0x5DU, 0x0DU, 0x79U, 0xB7U, 0x6AU, 0x61U, 0x8FU, 0x6CU, 0xACU, 0x6EU, 0xCAU,
+    },
+    {
+        0xDEU, 0x6BU, 0x4CU, 0x59U, 0xB0U, 0x6CU, 0x1FU, 0x93U, 0xC2U, 0x03U, 0x35U, 0xFEU, 0x8AU, 0xACU, 0x9CU, 0xFDU,
+        0x73U, 0x9CU, 0x19U, 0xB0U, 0x21U, 0x0FU, 0xBBU, 0x4EU, 0xA5U, 0x0DU, 0x78U, 0xDBU, 0xC3U, 0xF4U, 0x04U, 0xE2U,
+    },
+    {
+        0x4BU, 0x54U, 0xD2U, 0xCEU, 0x42U, 0x50U, 0xA6U, 0x76U, 0x5BU, 0xB6U, 0x9EU, 0xC9U, 0x3BU, 0x52U, 0x91U, 0x7FU,
+        0xF6U, 0x91U, 0x4DU, 0x42U, 0x6DU, 0xE7U, 0x17U, 0x8BU, 0x5EU, 0xBEU, 0xA3U, 0x16U, 0xB4U, 0x73U, 0xB2U, 0xD9U,
+    },
+    {
+        0x73U, 0x15U, 0xF7U, 0xF0U, 0xD3U, 0x14U, 0xEAU, 0xDEU, 0x77U, 0xEEU, 0xE4U, 0x90U, 0x6FU, 0xD7U, 0x86U, 0x7EU,
+        0xFEU, 0x86U, 0xB1U, 0xD3U, 0xB9U, 0x58U, 0x64U, 0x43U, 0xD4U, 0xECU, 0x49U, 0xC6U, 0x2DU, 0x7DU, 0xEFU, 0x94U,
+    },
+    {
+        0xE6U, 0x2AU, 0x69U, 0x67U, 0x21U, 0x28U, 0x53U, 0x3BU, 0xEEU, 0x5BU, 0x4FU, 0xA7U, 0xDEU, 0x29U, 0x8BU, 0xFCU,
+        0x7BU, 0x8BU, 0xE5U, 0x21U, 0xF5U, 0xB0U, 0xC8U, 0x86U, 0x2FU, 0x5FU, 0x92U, 0x0BU, 0x5AU, 0xFAU, 0x59U, 0xAFU,
+    },
+    {
+        0x03U, 0x97U, 0xBDU, 0x8CU, 0x76U, 0x9CU, 0x72U, 0x09U, 0x2FU, 0x5EU, 0x10U, 0x22U, 0xC7U, 0x5AU, 0xA8U, 0x7CU,
+        0xEEU, 0xA8U, 0xCEU, 0x76U, 0x96U, 0xA1U, 0x82U, 0x54U, 0x47U, 0x48U, 0x1AU, 0xE1U, 0x98U, 0x61U, 0x55U, 0x0EU,
+    },
+    {
+        0x96U, 0xA8U, 0x23U, 0x1BU, 0x84U, 0xA0U, 0xCBU, 0xECU, 0xB6U, 0xEBU, 0xBBU, 0x15U, 0x76U, 0xA4U, 0xA5U, 0xFEU,
+        0x6BU, 0xA5U, 0x9AU, 0x84U, 0xDAU, 0x49U, 0x2EU, 0x91U, 0xBCU, 0xFBU, 0xC1U, 0x2CU, 0xEFU, 0xE6U, 0xE3U, 0x35U,
+    },
+    {
+        0xAEU, 0xE9U, 0x06U, 0x25U, 0x15U, 0xE4U, 0x87U, 0x44U, 0x9AU, 0xB3U, 0xC1U, 0x4CU, 0x22U, 0x21U, 0xB2U, 0xFFU,
+        0x63U, 0xB2U, 0x66U, 0x15U, 0x0EU, 0xF6U, 0x5DU, 0x59U, 0x36U, 0xA9U, 0x2BU, 0xFCU, 0x76U, 0xE8U, 0xBEU, 0x78U,
+    },
+    {
+        0x3BU, 0xD6U, 0x98U, 0xB2U, 0xE7U, 0xD8U, 0x3EU, 0xA1U, 0x03U, 0x06U, 0x6AU, 0x7BU, 0x93U, 0xDFU, 0xBFU, 0x7DU,
+        0xE6U, 0xBFU, 0x32U, 0xE7U, 0x42U, 0x1EU, 0xF1U, 0x9CU, 0xCDU, 0x1AU, 0xF0U, 0x31U, 0x01U, 0x6FU, 0x08U, 0x43U,
+    },
+    {
+        0xE3U, 0x14U, 0x29U, 0x74U, 0xBBU, 0x0BU, 0xC5U, 0x20U, 0x9FU, 0xB9U, 0x7FU, 0xC1U, 0x10U, 0xC7U, 0xF4U, 0x78U,
+        0xCEU, 0xF4U, 0x30U, 0xBBU, 0xC8U, 0xD4U, 0xC9U, 0x7AU, 0xE6U, 0x87U, 0xBCU, 0xAFU, 0x75U, 0x59U, 0xA6U, 0xBDU,
+    },
+    {
+        0x76U, 0x2BU, 0xB7U, 0xE3U, 0x49U, 0x37U, 0x7CU, 0xC5U, 0x06U, 0x0CU, 0xD4U, 0xF6U, 0xA1U, 0x39U, 0xF9U, 0xFAU,
+        0x4BU, 0xF9U, 0x64U, 0x49U, 0x84U, 0x3CU, 0x65U, 0xBFU, 0x1DU, 0x34U, 0x67U, 0x62U, 0x02U, 0xDEU, 0x10U, 0x86U,
+    },
+    {
+        0x4EU, 0x6AU, 0x92U, 0xDDU, 0xD8U, 0x73U, 0x30U, 0x6DU, 0x2AU, 0x54U, 0xAEU, 0xAFU, 0xF5U, 0xBCU, 0xEEU, 0xFBU,
+        0x43U, 0xEEU, 0x98U, 0xD8U, 0x50U, 0x83U, 0x16U, 0x77U, 0x97U, 0x66U, 0x8DU, 0xB2U, 0x9BU, 0xD0U, 0x4DU, 0xCBU,
+    },
+    {
+        0xDBU, 0x55U, 0x0CU, 0x4AU, 0x2AU, 0x4FU, 0x89U, 0x88U, 0xB3U, 0xE1U, 0x05U, 0x98U, 0x44U, 0x42U, 0xE3U, 0x79U,
+        0xC6U, 0xE3U, 0xCCU, 0x2AU, 0x1CU, 0x6BU, 0xBAU, 0xB2U, 0x6CU, 0xD5U, 0x56U, 0x7FU, 0xECU, 0x57U, 0xFBU, 0xF0U,
+    },
+    {
+        0x3EU, 0xE8U, 0xD8U, 0xA1U, 0x7DU, 0xFBU, 0xA8U, 0xBAU, 0x72U, 0xE4U, 0x5AU, 0x1DU, 0x5DU, 0x31U, 0xC0U, 0xF9U,
+        0x53U, 0xC0U, 0xE7U, 0x7DU, 0x7FU, 0x7AU, 0xF0U, 0x60U, 0x04U, 0xC2U, 0xDEU, 0x95U, 0x2EU, 0xCCU, 0xF7U, 0x51U,
+    },
+    {
+        0xABU, 0xD7U, 0x46U, 0x36U, 0x8FU, 0xC7U, 0x11U, 0x5FU, 0xEBU, 0x51U, 0xF1U, 0x2AU, 0xECU, 0xCFU, 0xCDU, 0x7BU,
+        0xD6U, 0xCDU, 0xB3U, 0x8FU, 0x33U, 0x92U, 0x5CU, 0xA5U, 0xFFU, 0x71U, 0x05U, 0x58U, 0x59U, 0x4BU, 0x41U, 0x6AU,
+    },
+    {
+        0x93U, 0x96U, 0x63U, 0x08U, 0x1EU, 0x83U, 0x5DU, 0xF7U, 0xC7U, 0x09U, 0x8BU, 0x73U, 0xB8U, 0x4AU, 0xDAU, 0x7AU,
+        0xDEU, 0xDAU, 0x4FU, 0x1EU, 0xE7U, 0x2DU, 0x2FU, 0x6DU, 0x75U, 0x23U, 0xEFU, 0x88U, 0xC0U, 0x45U, 0x1CU, 0x27U,
+    },
+    {
+        0x06U, 0xA9U, 0xFDU, 0x9FU, 0xECU, 0xBFU, 0xE4U, 0x12U, 0x5EU, 0xBCU, 0x20U, 0x44U, 0x09U, 0xB4U, 0xD7U, 0xF8U,
+        0x5BU, 0xD7U, 0x1BU, 0xECU, 0xABU, 0xC5U, 0x83U, 0xA8U, 0x8EU, 0x90U, 0x34U, 0x45U, 0xB7U, 0xC2U, 0xAAU, 0x1CU,
+    },
+    {
+        0xA4U, 0x95U, 0x86U, 0x03U, 0xA6U, 0xA2U, 0x2CU, 0x72U, 0x78U, 0xF0U, 0xA1U, 0x80U, 0x39U, 0x7AU, 0x4CU, 0x70U,
+        0x8EU, 0x4CU, 0x4BU, 0xA6U, 0x74U, 0x3EU, 0x5FU, 0x26U, 0x23U, 0x9EU, 0x77U, 0x33U, 0x28U, 0x29U, 0xC7U, 0x5CU,
+    },
+    {
+        0x31U, 0xAAU, 0x18U, 0x94U, 0x54U, 0x9EU, 0x95U, 0x97U, 0xE1U, 0x45U, 0x0AU, 0xB7U, 0x88U, 0x84U, 0x41U, 0xF2U,
+        0x0BU, 0x41U, 0x1FU, 0x54U, 0x38U, 0xD6U, 0xF3U, 0xE3U, 0xD8U, 0x2DU, 0xACU, 0xFEU, 0x5FU, 0xAEU, 0x71U, 0x67U,
+    },
+    {
+        0x09U, 0xEBU, 0x3DU, 0xAAU, 0xC5U, 0xDAU, 0xD9U, 0x3FU, 0xCDU, 0x1DU, 0x70U, 0xEEU, 0xDCU, 0x01U, 0x56U, 0xF3U,
+        0x03U, 0x56U, 0xE3U, 0xC5U, 0xECU, 0x69U, 0x80U, 0x2BU, 0x52U, 0x7FU, 0x46U, 0x2EU, 0xC6U, 0xA0U, 0x2CU, 0x2AU,
+    },
+    {
+        0x9CU, 0xD4U, 0xA3U, 0x3DU, 0x37U, 0xE6U, 0x60U, 0xDAU, 0x54U, 0xA8U, 0xDBU, 0xD9U, 0x6DU, 0xFFU, 0x5BU, 0x71U,
+        0x86U, 0x5BU, 0xB7U, 0x37U, 0xA0U, 0x81U, 0x2CU, 0xEEU, 0xA9U, 0xCCU, 0x9DU, 0xE3U, 0xB1U, 0x27U, 0x9AU, 0x11U,
+    },
+    {
+        0x79U, 0x69U, 0x77U, 0xD6U, 0x60U, 0x52U, 0x41U, 0xE8U, 0x95U, 0xADU, 0x84U, 0x5CU, 0x74U, 0x8CU, 0x78U, 0xF1U,
+        0x13U, 0x78U, 0x9CU, 0x60U, 0xC3U, 0x90U, 0x66U, 0x3CU, 0xC1U, 0xDBU, 0x15U, 0x09U, 0x73U, 0xBCU, 0x96U, 0xB0U,
+    },
+    {
+        0xECU, 0x56U, 0xE9U, 0x41U, 0x92U, 0x6EU, 0xF8U, 0x0DU, 0x0CU, 0x18U, 0x2FU, 0x6BU, 0xC5U, 0x72U, 0x75U, 0x73U,
+        0x96U, 0x75U, 0xC8U, 0x92U, 0x8FU, 0x78U, 0xCAU, 0xF9U, 0x3AU, 0x68U, 0xCEU, 0xC4U, 0x04U, 0x3BU, 0x20U, 0x8BU,
+    },
+    {
+        0xD4U, 0x17U, 0xCCU, 0x7FU, 0x03U, 0x2AU, 0xB4U, 0xA5U, 0x20U, 0x40U, 0x55U, 0x32U, 0x91U, 0xF7U, 0x62U, 0x72U,
+        0x9EU, 0x62U, 0x34U, 0x03U, 0x5BU, 0xC7U, 0xB9U, 0x31U, 0xB0U, 0x3AU, 0x24U, 0x14U, 0x9DU, 0x35U, 0x7DU, 0xC6U,
+    },
+    {
+        0x41U, 0x28U, 0x52U, 0xE8U, 0xF1U, 0x16U, 0x0DU, 0x40U, 0xB9U, 0xF5U, 0xFEU, 0x05U, 0x20U, 0x09U, 0x6FU, 0xF0U,
+        0x1BU, 0x6FU, 0x60U, 0xF1U, 0x17U, 0x2FU, 0x15U, 0xF4U, 0x4BU, 0x89U, 0xFFU, 0xD9U, 0xEAU, 0xB2U, 0xCBU, 0xFDU,
+    },
+    {
+        0x99U, 0xEAU, 0xE3U, 0x2EU, 0xADU, 0xC5U, 0xF6U, 0xC1U, 0x25U, 0x4AU, 0xEBU, 0xBFU, 0xA3U, 0x11U, 0x24U, 0xF5U,
+        0x33U, 0x24U, 0x62U, 0xADU, 0x9DU, 0xE5U, 0x2DU, 0x12U, 0x60U, 0x14U, 0xB3U, 0x47U, 0x9EU, 0x84U, 0x65U, 0x03U,
+    },
+    {
+        0x0CU, 0xD5U, 0x7DU, 0xB9U, 0x5FU, 0xF9U, 0x4FU, 0x24U, 0xBCU, 0xFFU, 0x40U, 0x88U, 0x12U, 0xEFU, 0x29U, 0x77U,
+        0xB6U, 0x29U, 0x36U, 0x5FU, 0xD1U, 0x0DU, 0x81U, 0xD7U, 0x9BU, 0xA7U, 0x68U, 0x8AU, 0xE9U, 0x03U, 0xD3U, 0x38U,
+    },
+    {
+        0x34U, 0x94U, 0x58U, 0x87U, 0xCEU, 0xBDU, 0x03U, 0x8CU, 0x90U, 0xA7U, 0x3AU, 0xD1U, 0x46U, 0x6AU, 0x3EU, 0x76U,
+        0xBEU, 0x3EU, 0xCAU, 0xCEU, 0x05U, 0xB2U, 0xF2U, 0x1FU, 0x11U, 0xF5U, 0x82U, 0x5AU, 0x70U, 0x0DU, 0x8EU, 0x75U,
+    },
+    {
+        0xA1U, 0xABU, 0xC6U, 0x10U, 0x3CU, 0x81U, 0xBAU, 0x69U, 0x09U, 0x12U, 0x91U, 0xE6U, 0xF7U, 0x94U, 0x33U, 0xF4U,
+        0x3BU, 0x33U, 0x9EU, 0x3CU, 0x49U, 0x5AU, 0x5EU, 0xDAU, 0xEAU, 0x46U, 0x59U, 0x97U, 0x07U, 0x8AU, 0x38U, 0x4EU,
+    },
+    {
+        0x44U, 0x16U, 0x12U, 0xFBU, 0x6BU, 0x35U, 0x9BU, 0x5BU, 0xC8U, 0x17U, 0xCEU, 0x63U, 0xEEU, 0xE7U, 0x10U, 0x74U,
+        0xAEU, 0x10U, 0xB5U, 0x6BU, 0x2AU, 0x4BU, 0x14U, 0x08U, 0x82U, 0x51U, 0xD1U, 0x7DU, 0xC5U, 0x11U, 0x34U, 0xEFU,
+    },
+    {
+        0xD1U, 0x29U, 0x8CU, 0x6CU, 0x99U, 0x09U, 0x22U, 0xBEU, 0x51U, 0xA2U, 0x65U, 0x54U, 0x5FU, 0x19U, 0x1DU, 0xF6U,
+        0x2BU, 0x1DU, 0xE1U, 0x99U, 0x66U, 0xA3U, 0xB8U, 0xCDU, 0x79U, 0xE2U, 0x0AU, 0xB0U, 0xB2U, 0x96U, 0x82U, 0xD4U,
+    },
+    {
+        0xE9U, 0x68U, 0xA9U, 0x52U, 0x08U, 0x4DU, 0x6EU, 0x16U, 0x7DU, 0xFAU, 0x1FU, 0x0DU, 0x0BU, 0x9CU, 0x0AU, 0xF7U,
+        0x23U, 0x0AU, 0x1DU, 0x08U, 0xB2U, 0x1CU, 0xCBU, 0x05U, 0xF3U, 0xB0U, 0xE0U, 0x60U, 0x2BU, 0x98U, 0xDFU, 0x99U,
+    },
+    {
+        0x7CU, 0x57U, 0x37U, 0xC5U, 0xFAU, 0x71U, 0xD7U, 0xF3U, 0xE4U, 0x4FU, 0xB4U, 0x3AU, 0xBAU, 0x62U, 0x07U, 0x75U,
+        0xA6U, 0x07U, 0x49U, 0xFAU, 0xFEU, 0xF4U, 0x67U, 0xC0U, 0x08U, 0x03U, 0x3BU, 0xADU, 0x5CU, 0x1FU, 0x69U, 0xA2U,
+    },
+    {
+        0x2AU, 0x10U, 0x5FU, 0xEDU, 0x9CU, 0x77U, 0x79U, 0xD6U, 0x31U, 0x62U, 0x9AU, 0x02U, 0x6BU, 0x87U, 0xBBU, 0x60U,
+        0x0EU, 0xBBU, 0xBDU, 0x9CU, 0x8BU, 0x6DU, 0xF4U, 0x9EU, 0x2EU, 0xACU, 0x66U, 0x8CU, 0x92U, 0xC9U, 0x05U, 0x19U,
+    },
+    {
+        0xBFU, 0x2FU, 0xC1U, 0x7AU, 0x6EU, 0x4BU, 0xC0U, 0x33U, 0xA8U, 0xD7U, 0x31U, 0x35U, 0xDAU, 0x79U, 0xB6U, 0xE2U,
+        0x8BU, 0xB6U, 0xE9U, 0x6EU, 0xC7U, 0x85U, 0x58U, 0x5BU, 0xD5U, 0x1FU, 0xBDU, 0x41U, 0xE5U, 0x4EU, 0xB3U, 0x22U,
+    },
+    {
+        0x87U, 0x6EU, 0xE4U, 0x44U, 0xFFU, 0x0FU, 0x8CU, 0x9BU, 0x84U, 0x8FU, 0x4BU, 0x6CU, 0x8EU, 0xFCU, 0xA1U, 0xE3U,
+        0x83U, 0xA1U, 0x15U, 0xFFU, 0x13U, 0x3AU, 0x2BU, 0x93U, 0x5FU, 0x4DU, 0x57U, 0x91U, 0x7CU, 0x40U, 0xEEU, 0x6FU,
+    },
+    {
+        0x12U, 0x51U, 0x7AU, 0xD3U, 0x0DU, 0x33U, 0x35U, 0x7EU, 0x1DU, 0x3AU, 0xE0U, 0x5BU, 0x3FU, 0x02U, 0xACU, 0x61U,
+        0x06U, 0xACU, 0x41U, 0x0DU, 0x5FU, 0xD2U, 0x87U, 0x56U, 0xA4U, 0xFEU, 0x8CU, 0x5CU, 0x0BU, 0xC7U, 0x58U, 0x54U,
+    },
+    {
+        0xF7U, 0xECU, 0xAEU, 0x38U, 0x5AU, 0x87U, 0x14U, 0x4CU, 0xDCU, 0x3FU, 0xBFU, 0xDEU, 0x26U, 0x71U, 0x8FU, 0xE1U,
+        0x93U, 0x8FU, 0x6AU, 0x5AU, 0x3CU, 0xC3U, 0xCDU, 0x84U, 0xCCU, 0xE9U, 0x04U, 0xB6U, 0xC9U, 0x5CU, 0x54U, 0xF5U,
+    },
+    {
+        0x62U, 0xD3U, 0x30U, 0xAFU, 0xA8U, 0xBBU, 0xADU, 0xA9U, 0x45U, 0x8AU, 0x14U, 0xE9U, 0x97U, 0x8FU, 0x82U, 0x63U,
+        0x16U, 0x82U, 0x3EU, 0xA8U, 0x70U, 0x2BU, 0x61U, 0x41U, 0x37U, 0x5AU, 0xDFU, 0x7BU, 0xBEU, 0xDBU, 0xE2U, 0xCEU,
+    },
+    {
+        0x5AU, 0x92U, 0x15U, 0x91U, 0x39U, 0xFFU, 0xE1U, 0x01U, 0x69U, 0xD2U, 0x6EU, 0xB0U, 0xC3U, 0x0AU, 0x95U, 0x62U,
+        0x1EU, 0x95U, 0xC2U, 0x39U, 0xA4U, 0x94U, 0x12U, 0x89U, 0xBDU, 0x08U, 0x35U, 0xABU, 0x27U, 0xD5U, 0xBFU, 0x83U,
+    },
+    {
+        0xCFU, 0xADU, 0x8BU, 0x06U, 0xCBU, 0xC3U, 0x58U, 0xE4U, 0xF0U, 0x67U, 0xC5U, 0x87U, 0x72U, 0xF4U, 0x98U, 0xE0U,
+        0x9BU, 0x98U, 0x96U, 0xCBU, 0xE8U, 0x7CU, 0xBEU, 0x4CU, 0x46U, 0xBBU, 0xEEU, 0x66U, 0x50U, 0x52U, 0x09U, 0xB8U,
+    },
+    {
+        0x17U, 0x6FU, 0x3AU, 0xC0U, 0x97U, 0x10U, 0xA3U, 0x65U, 0x6CU, 0xD8U, 0xD0U, 0x3DU, 0xF1U, 0xECU, 0xD3U, 0xE5U,
+        0xB3U, 0xD3U, 0x94U, 0x97U, 0x62U, 0xB6U, 0x86U, 0xAAU, 0x6DU, 0x26U, 0xA2U, 0xF8U, 0x24U, 0x64U, 0xA7U, 0x46U,
+    },
+    {
+        0x82U, 0x50U, 0xA4U, 0x57U, 0x65U, 0x2CU, 0x1AU, 0x80U, 0xF5U, 0x6DU, 0x7BU, 0x0AU, 0x40U, 0x12U, 0xDEU, 0x67U,
+        0x36U, 0xDEU, 0xC0U, 0x65U, 0x2EU, 0x5EU, 0x2AU, 0x6FU, 0x96U, 0x95U, 0x79U, 0x35U, 0x53U, 0xE3U, 0x11U, 0x7DU,
+    },
+    {
+        0xBAU, 0x11U, 0x81U, 0x69U, 0xF4U, 0x68U, 0x56U, 0x28U, 0xD9U, 0x35U, 0x01U, 0x53U, 0x14U, 0x97U, 0xC9U, 0x66U,
+        0x3EU, 0xC9U, 0x3CU, 0xF4U, 0xFAU, 0xE1U, 0x59U, 0xA7U, 0x1CU, 0xC7U, 0x93U, 0xE5U, 0xCAU, 0xEDU, 0x4CU, 0x30U,
+    },
+    {
+        0x2FU, 0x2EU, 0x1FU, 0xFEU, 0x06U, 0x54U, 0xEFU, 0xCDU, 0x40U, 0x80U, 0xAAU, 0x64U, 0xA5U, 0x69U, 0xC4U, 0xE4U,
+        0xBBU, 0xC4U, 0x68U, 0x06U, 0xB6U, 0x09U, 0xF5U, 0x62U, 0xE7U, 0x74U, 0x48U, 0x28U, 0xBDU, 0x6AU, 0xFAU, 0x0BU,
+    },
+    {
+        0xCAU, 0x93U, 0xCBU, 0x15U, 0x51U, 0xE0U, 0xCEU, 0xFFU, 0x81U, 0x85U, 0xF5U, 0xE1U, 0xBCU, 0x1AU, 0xE7U, 0x64U,
+        0x2EU, 0xE7U, 0x43U, 0x51U, 0xD5U, 0x18U, 0xBFU, 0xB0U, 0x8FU, 0x63U, 0xC0U, 0xC2U, 0x7FU, 0xF1U, 0xF6U, 0xAAU,
+    },
+    {
+        0x5FU, 0xACU, 0x55U, 0x82U, 0xA3U, 0xDCU, 0x77U, 0x1AU, 0x18U, 0x30U, 0x5EU, 0xD6U, 0x0DU, 0xE4U, 0xEAU, 0xE6U,
+        0xABU, 0xEAU, 0x17U, 0xA3U, 0x99U, 0xF0U, 0x13U, 0x75U, 0x74U, 0xD0U, 0x1BU, 0x0FU, 0x08U, 0x76U, 0x40U, 0x91U,
+    },
+    {
+        0x67U, 0xEDU, 0x70U, 0xBCU, 0x32U, 0x98U, 0x3BU, 0xB2U, 0x34U, 0x68U, 0x24U, 0x8FU, 0x59U, 0x61U, 0xFDU, 0xE7U,
+        0xA3U, 0xFDU, 0xEBU, 0x32U, 0x4DU, 0x4FU, 0x60U, 0xBDU, 0xFEU, 0x82U, 0xF1U, 0xDFU, 0x91U, 0x78U, 0x1DU, 0xDCU,
+    },
+    {
+        0xF2U, 0xD2U, 0xEEU, 0x2BU, 0xC0U, 0xA4U, 0x82U, 0x57U, 0xADU, 0xDDU, 0x8FU, 0xB8U, 0xE8U, 0x9FU, 0xF0U, 0x65U,
+        0x26U, 0xF0U, 0xBFU, 0xC0U, 0x01U, 0xA7U, 0xCCU, 0x78U, 0x05U, 0x31U, 0x2AU, 0x12U, 0xE6U, 0xFFU, 0xABU, 0xE7U,
+    },
+    {
+        0x50U, 0xEEU, 0x95U, 0xB7U, 0x8AU, 0xB9U, 0x4AU, 0x37U, 0x8BU, 0x91U, 0x0EU, 0x7CU, 0xD8U, 0x51U, 0x6BU, 0xEDU,
+        0xF3U, 0x6BU, 0xEFU, 0x8AU, 0xDEU, 0x5CU, 0x10U, 0xF6U, 0xA8U, 0x3FU, 0x69U, 0x64U, 0x79U, 0x14U, 0xC6U, 0xA7U,
+    },
+    {
+        0xC5U, 0xD1U, 0x0BU, 0x20U, 0x78U, 0x85U, 0xF3U, 0xD2U, 0x12U, 0x24U, 0xA5U, 0x4BU, 0x69U, 0xAFU, 0x66U, 0x6FU,
+        0x76U, 0x66U, 0xBBU, 0x78U, 0x92U, 0xB4U, 0xBCU, 0x33U, 0x53U, 0x8CU, 0xB2U, 0xA9U, 0x0EU, 0x93U, 0x70U, 0x9CU,
+    },
+    {
+        0xFDU, 0x90U, 0x2EU, 0x1EU, 0xE9U, 0xC1U, 0xBFU, 0x7AU, 0x3EU, 0x7CU, 0xDFU, 0x12U, 0x3DU, 0x2AU, 0x71U, 0x6EU,
+        0x7EU, 0x71U, 0x47U, 0xE9U, 0x46U, 0x0BU, 0xCFU, 0xFBU, 0xD9U, 0xDEU, 0x58U, 0x79U, 0x97U, 0x9DU, 0x2DU, 0xD1U,
+    },
+    {
+        0x68U, 0xAFU, 0xB0U, 0x89U, 0x1BU, 0xFDU, 0x06U, 0x9FU, 0xA7U, 0xC9U, 0x74U, 0x25U, 0x8CU, 0xD4U, 0x7CU, 0xECU,
+        0xFBU, 0x7CU, 0x13U, 0x1BU, 0x0AU, 0xE3U, 0x63U, 0x3EU, 0x22U, 0x6DU, 0x83U, 0xB4U, 0xE0U, 0x1AU, 0x9BU, 0xEAU,
+    },
+    {
+        0x8DU, 0x12U, 0x64U, 0x62U, 0x4CU, 0x49U, 0x27U, 0xADU, 0x66U, 0xCCU, 0x2BU, 0xA0U, 0x95U, 0xA7U, 0x5FU, 0x6CU,
+        0x6EU, 0x5FU, 0x38U, 0x4CU, 0x69U, 0xF2U, 0x29U, 0xECU, 0x4AU, 0x7AU, 0x0BU, 0x5EU, 0x22U, 0x81U, 0x97U, 0x4BU,
+    },
+    {
+        0x18U, 0x2DU, 0xFAU, 0xF5U, 0xBEU, 0x75U, 0x9EU, 0x48U, 0xFFU, 0x79U, 0x80U, 0x97U, 0x24U, 0x59U, 0x52U, 0xEEU,
+        0xEBU, 0x52U, 0x6CU, 0xBEU, 0x25U, 0x1AU, 0x85U, 0x29U, 0xB1U, 0xC9U, 0xD0U, 0x93U, 0x55U, 0x06U, 0x21U, 0x70U,
+    },
+    {
+        0x20U, 0x6CU, 0xDFU, 0xCBU, 0x2FU, 0x31U, 0xD2U, 0xE0U, 0xD3U, 0x21U, 0xFAU, 0xCEU, 0x70U, 0xDCU, 0x45U, 0xEFU,
+        0xE3U, 0x45U, 0x90U, 0x2FU, 0xF1U, 0xA5U, 0xF6U, 0xE1U, 0x3BU, 0x9BU, 0x3AU, 0x43U, 0xCCU, 0x08U, 0x7CU, 0x3DU,
+    },
+    {
+        0xB5U, 0x53U, 0x41U, 0x5CU, 0xDDU, 0x0DU, 0x6BU, 0x05U, 0x4AU, 0x94U, 0x51U, 0xF9U, 0xC1U, 0x22U, 0x48U, 0x6DU,
+        0x66U, 0x48U, 0xC4U, 0xDDU, 0xBDU, 0x4DU, 0x5AU, 0x24U, 0xC0U, 0x28U, 0xE1U, 0x8EU, 0xBBU, 0x8FU, 0xCAU, 0x06U,
+    },
+    {
+        0x6DU, 0x91U, 0xF0U, 0x9AU, 0x81U, 0xDEU, 0x90U, 0x84U, 0xD6U, 0x2BU, 0x44U, 0x43U, 0x42U, 0x3AU, 0x03U, 0x68U,
+        0x4EU, 0x03U, 0xC6U, 0x81U, 0x37U, 0x87U, 0x62U, 0xC2U, 0xEBU, 0xB5U, 0xADU, 0x10U, 0xCFU, 0xB9U, 0x64U, 0xF8U,
+    },
+    {
+        0xF8U, 0xAEU, 0x6EU, 0x0DU, 0x73U, 0xE2U, 0x29U, 0x61U, 0x4FU, 0x9EU, 0xEFU, 0x74U, 0xF3U, 0xC4U, 0x0EU, 0xEAU,
+        0xCBU, 0x0EU, 0x92U, 0x73U, 0x7BU, 0x6FU, 0xCEU, 0x07U, 0x10U, 0x06U, 0x76U, 0xDDU, 0xB8U, 0x3EU, 0xD2U, 0xC3U,
+    },
+    {
+        0xC0U, 0xEFU, 0x4BU, 0x33U, 0xE2U, 0xA6U, 0x65U, 0xC9U, 0x63U, 0xC6U, 0x95U, 0x2DU, 0xA7U, 0x41U, 0x19U, 0xEBU,
+        0xC3U, 0x19U, 0x6EU, 0xE2U, 0xAFU, 0xD0U, 0xBDU, 0xCFU, 0x9AU, 0x54U, 0x9CU, 0x0DU, 0x21U, 0x30U, 0x8FU, 0x8EU,
+    },
+    {
+        0x55U, 0xD0U, 0xD5U, 0xA4U, 0x10U, 0x9AU, 0xDCU, 0x2CU, 0xFAU, 0x73U, 0x3EU, 0x1AU, 0x16U, 0xBFU, 0x14U, 0x69U,
+        0x46U, 0x14U, 0x3AU, 0x10U, 0xE3U, 0x38U, 0x11U, 0x0AU, 0x61U, 0xE7U, 0x47U, 0xC0U, 0x56U, 0xB7U, 0x39U, 0xB5U,
+    },
+    {
+        0xB0U, 0x6DU, 0x01U, 0x4FU, 0x47U, 0x2EU, 0xFDU, 0x1EU, 0x3BU, 0x76U, 0x61U, 0x9FU, 0x0FU, 0xCCU, 0x37U, 0xE9U,
+        0xD3U, 0x37U, 0x11U, 0x47U, 0x80U, 0x29U, 0x5BU, 0xD8U, 0x09U, 0xF0U, 0xCFU, 0x2AU, 0x94U, 0x2CU, 0x35U, 0x14U,
+    },
+    {
+        0x25U, 0x52U, 0x9FU, 0xD8U, 0xB5U, 0x12U, 0x44U, 0xFBU, 0xA2U, 0xC3U, 0xCAU, 0xA8U, 0xBEU, 0x32U, 0x3AU, 0x6BU,
+        0x56U, 0x3AU, 0x45U, 0xB5U, 0xCCU, 0xC1U, 0xF7U, 0x1DU, 0xF2U, 0x43U, 0x14U, 0xE7U, 0xE3U, 0xABU, 0x83U, 0x2FU,
+    },
+    {
+        0x1DU, 0x13U, 0xBAU, 0xE6U, 0x24U, 0x56U, 0x08U, 0x53U, 0x8EU, 0x9BU, 0xB0U, 0xF1U, 0xEAU, 0xB7U, 0x2DU, 0x6AU,
+        0x5EU, 0x2DU, 0xB9U, 0x24U, 0x18U, 0x7EU, 0x84U, 0xD5U, 0x78U, 0x11U, 0xFEU, 0x37U, 0x7AU, 0xA5U, 0xDEU, 0x62U,
+    },
+    {
+        0x88U, 0x2CU, 0x24U, 0x71U, 0xD6U, 0x6AU, 0xB1U, 0xB6U, 0x17U, 0x2EU, 0x1BU, 0xC6U, 0x5BU, 0x49U, 0x20U, 0xE8U,
+        0xDBU, 0x20U, 0xEDU, 0xD6U, 0x54U, 0x96U, 0x28U, 0x10U, 0x83U, 0xA2U, 0x25U, 0xFAU, 0x0DU, 0x22U, 0x68U, 0x59U,
+    },
+    {
+        0xB1U, 0x9DU, 0x6AU, 0xB6U, 0xE8U, 0x5AU, 0xD3U, 0x19U, 0xA3U, 0xC1U, 0xECU, 0x81U, 0xCFU, 0xFAU, 0xD2U, 0x40U,
+        0x89U, 0xD2U, 0xD6U, 0xE8U, 0xF2U, 0xCBU, 0x25U, 0x69U, 0x34U, 0xC8U, 0x44U, 0x75U, 0x61U, 0x8EU, 0x06U, 0x93U,
+    },
+    {
+        0x24U, 0xA2U, 0xF4U, 0x21U, 0x1AU, 0x66U, 0x6AU, 0xFCU, 0x3AU, 0x74U, 0x47U, 0xB6U, 0x7EU, 0x04U, 0xDFU, 0xC2U,
+        0x0CU, 0xDFU, 0x82U, 0x1AU, 0xBEU, 0x23U, 0x89U, 0xACU, 0xCFU, 0x7BU, 0x9FU, 0xB8U, 0x16U, 0x09U, 0xB0U, 0xA8U,
+    },
+    {
+        0x1CU, 0xE3U, 0xD1U, 0x1FU, 0x8BU, 0x22U, 0x26U, 0x54U, 0x16U, 0x2CU, 0x3DU, 0xEFU, 0x2AU, 0x81U, 0xC8U, 0xC3U,
+        0x04U, 0xC8U, 0x7EU, 0x8BU, 0x6AU, 0x9CU, 0xFAU, 0x64U, 0x45U, 0x29U, 0x75U, 0x68U, 0x8FU, 0x07U, 0xEDU, 0xE5U,
+    },
+    {
+        0x89U, 0xDCU, 0x4FU, 0x88U, 0x79U, 0x1EU, 0x9FU, 0xB1U, 0x8FU, 0x99U, 0x96U, 0xD8U, 0x9BU, 0x7FU, 0xC5U, 0x41U,
+        0x81U, 0xC5U, 0x2AU, 0x79U, 0x26U, 0x74U, 0x56U, 0xA1U, 0xBEU, 0x9AU, 0xAEU, 0xA5U, 0xF8U, 0x80U, 0x5BU, 0xDEU,
+    },
+    {
+        0x6CU, 0x61U, 0x9BU, 0x63U, 0x2EU, 0xAAU, 0xBEU, 0x83U, 0x4EU, 0x9CU, 0xC9U, 0x5DU, 0x82U, 0x0CU, 0xE6U, 0xC1U,
+        0x14U, 0xE6U, 0x01U, 0x2EU, 0x45U, 0x65U, 0x1CU, 0x73U, 0xD6U, 0x8DU, 0x26U, 0x4FU, 0x3AU, 0x1BU, 0x57U, 0x7FU,
+    },
+    {
+        0xF9U, 0x5EU, 0x05U, 0xF4U, 0xDCU, 0x96U, 0x07U, 0x66U, 0xD7U, 0x29U, 0x62U, 0x6AU, 0x33U, 0xF2U, 0xEBU, 0x43U,
+        0x91U, 0xEBU, 0x55U, 0xDCU, 0x09U, 0x8DU, 0xB0U, 0xB6U, 0x2DU, 0x3EU, 0xFDU, 0x82U, 0x4DU, 0x9CU, 0xE1U, 0x44U,
+    },
+    {
+        0xC1U, 0x1FU, 0x20U, 0xCAU, 0x4DU, 0xD2U, 0x4BU, 0xCEU, 0xFBU, 0x71U, 0x18U, 0x33U, 0x67U, 0x77U, 0xFCU, 0x42U,
+        0x99U, 0xFCU, 0xA9U, 0x4DU, 0xDDU, 0x32U, 0xC3U, 0x7EU, 0xA7U, 0x6CU, 0x17U, 0x52U, 0xD4U, 0x92U, 0xBCU, 0x09U,
+    },
+    {
+        0x54U, 0x20U, 0xBEU, 0x5DU, 0xBFU, 0xEEU, 0xF2U, 0x2BU, 0x62U, 0xC4U, 0xB3U, 0x04U, 0xD6U, 0x89U, 0xF1U, 0xC0U,
+        0x1CU, 0xF1U, 0xFDU, 0xBFU, 0x91U, 0xDAU, 0x6FU, 0xBBU, 0x5CU, 0xDFU, 0xCCU, 0x9FU, 0xA3U, 0x15U, 0x0AU, 0x32U,
+    },
+    {
+        0x8CU, 0xE2U, 0x0FU, 0x9BU, 0xE3U, 0x3DU, 0x09U, 0xAAU, 0xFEU, 0x7BU, 0xA6U, 0xBEU, 0x55U, 0x91U, 0xBAU, 0xC5U,
+        0x34U, 0xBAU, 0xFFU, 0xE3U, 0x1BU, 0x10U, 0x57U, 0x5DU, 0x77U, 0x42U, 0x80U, 0x01U, 0xD7U, 0x23U, 0xA4U, 0xCCU,
+    },
+    {
+        0x19U, 0xDDU, 0x91U, 0x0CU, 0x11U, 0x01U, 0xB0U, 0x4FU, 0x67U, 0xCEU, 0x0DU, 0x89U, 0xE4U, 0x6FU, 0xB7U, 0x47U,
+        0xB1U, 0xB7U, 0xABU, 0x11U, 0x57U, 0xF8U, 0xFBU, 0x98U, 0x8CU, 0xF1U, 0x5BU, 0xCCU, 0xA0U, 0xA4U, 0x12U, 0xF7U,
+    },
+    {
+        0x21U, 0x9CU, 0xB4U, 0x32U, 0x80U, 0x45U, 0xFCU, 0xE7U, 0x4BU, 0x96U, 0x77U, 0xD0U, 0xB0U, 0xEAU, 0xA0U, 0x46U,
+        0xB9U, 0xA0U, 0x57U, 0x80U, 0x83U, 0x47U, 0x88U, 0x50U, 0x06U, 0xA3U, 0xB1U, 0x1CU, 0x39U, 0xAAU, 0x4FU, 0xBAU,
+    },
+    {
+        0xB4U, 0xA3U, 0x2AU, 0xA5U, 0x72U, 0x79U, 0x45U, 0x02U, 0xD2U, 0x23U, 0xDCU, 0xE7U, 0x01U, 0x14U, 0xADU, 0xC4U,
+        0x3CU, 0xADU, 0x03U, 0x72U, 0xCFU, 0xAFU, 0x24U, 0x95U, 0xFDU, 0x10U, 0x6AU, 0xD1U, 0x4EU, 0x2DU, 0xF9U, 0x81U,
+    },
+    {
+        0x51U, 0x1EU, 0xFEU, 0x4EU, 0x25U, 0xCDU, 0x64U, 0x30U, 0x13U, 0x26U, 0x83U, 0x62U, 0x18U, 0x67U, 0x8EU, 0x44U,
+        0xA9U, 0x8EU, 0x28U, 0x25U, 0xACU, 0xBEU, 0x6EU, 0x47U, 0x95U, 0x07U, 0xE2U, 0x3BU, 0x8CU, 0xB6U, 0xF5U, 0x20U,
+    },
+    {
+        0xC4U, 0x21U, 0x60U, 0xD9U, 0xD7U, 0xF1U, 0xDDU, 0xD5U, 0x8AU, 0x93U, 0x28U, 0x55U, 0xA9U, 0x99U, 0x83U, 0xC6U,
+        0x2CU, 0x83U, 0x7CU, 0xD7U, 0xE0U, 0x56U, 0xC2U, 0x82U, 0x6EU, 0xB4U, 0x39U, 0xF6U, 0xFBU, 0x31U, 0x43U, 0x1BU,
+    },
+    {
+        0xFCU, 0x60U, 0x45U, 0xE7U, 0x46U, 0xB5U, 0x91U, 0x7DU, 0xA6U, 0xCBU, 0x52U, 0x0CU, 0xFDU, 0x1CU, 0x94U, 0xC7U,
+        0x24U, 0x94U, 0x80U, 0x46U, 0x34U, 0xE9U, 0xB1U, 0x4AU, 0xE4U, 0xE6U, 0xD3U, 0x26U, 0x62U, 0x3FU, 0x1EU, 0x56U,
+    },
+    {
+        0x69U, 0x5FU, 0xDBU, 0x70U, 0xB4U, 0x89U, 0x28U, 0x98U, 0x3FU, 0x7EU, 0xF9U, 0x3BU, 0x4CU, 0xE2U, 0x99U, 0x45U,
+        0xA1U, 0x99U, 0xD4U, 0xB4U, 0x78U, 0x01U, 0x1DU, 0x8FU, 0x1FU, 0x55U, 0x08U, 0xEBU, 0x15U, 0xB8U, 0xA8U, 0x6DU,
+    },
+    {
+        0xCBU, 0x63U, 0xA0U, 0xECU, 0xFEU, 0x94U, 0xE0U, 0xF8U, 0x19U, 0x32U, 0x78U, 0xFFU, 0x7CU, 0x2CU, 0x02U, 0xCDU,
+        0x74U, 0x02U, 0x84U, 0xFEU, 0xA7U, 0xFAU, 0xC1U, 0x01U, 0xB2U, 0x5BU, 0x4BU, 0x9DU, 0x8AU, 0x53U, 0xC5U, 0x2DU,
+    },
+    {
+        0x5EU, 0x5CU, 0x3EU, 0x7BU, 0x0CU, 0xA8U, 0x59U, 0x1DU, 0x80U, 0x87U, 0xD3U, 0xC8U, 0xCDU, 0xD2U, 0x0FU, 0x4FU,
+        0xF1U, 0x0FU, 0xD0U, 0x0CU, 0xEBU, 0x12U, 0x6DU, 0xC4U, 0x49U, 0xE8U, 0x90U, 0x50U, 0xFDU, 0xD4U, 0x73U, 0x16U,
+    },
+    {
+        0x66U, 0x1DU, 0x1BU, 0x45U, 0x9DU, 0xECU, 0x15U, 0xB5U, 0xACU, 0xDFU, 0xA9U, 0x91U, 0x99U, 0x57U, 0x18U, 0x4EU,
+        0xF9U, 0x18U, 0x2CU, 0x9DU, 0x3FU, 0xADU, 0x1EU, 0x0CU, 0xC3U, 0xBAU, 0x7AU, 0x80U, 0x64U, 0xDAU, 0x2EU, 0x5BU,
+    },
+    {
+        0xF3U, 0x22U, 0x85U, 0xD2U, 0x6FU, 0xD0U, 0xACU, 0x50U, 0x35U, 0x6AU, 0x02U, 0xA6U, 0x28U, 0xA9U, 0x15U, 0xCCU,
+        0x7CU, 0x15U, 0x78U, 0x6FU, 0x73U, 0x45U, 0xB2U, 0xC9U, 0x38U, 0x09U, 0xA1U, 0x4DU, 0x13U, 0x5DU, 0x98U, 0x60U,
+    },
+    {
+        0x16U, 0x9FU, 0x51U, 0x39U, 0x38U, 0x64U, 0x8DU, 0x62U, 0xF4U, 0x6FU, 0x5DU, 0x23U, 0x31U, 0xDAU, 0x36U, 0x4CU,
+        0xE9U, 0x36U, 0x53U, 0x38U, 0x10U, 0x54U, 0xF8U, 0x1BU, 0x50U, 0x1EU, 0x29U, 0xA7U, 0xD1U, 0xC6U, 0x94U, 0xC1U,
+    },
+    {
+        0x83U, 0xA0U, 0xCFU, 0xAEU, 0xCAU, 0x58U, 0x34U, 0x87U, 0x6DU, 0xDAU, 0xF6U, 0x14U, 0x80U, 0x24U, 0x3BU, 0xCEU,
+        0x6CU, 0x3BU, 0x07U, 0xCAU, 0x5CU, 0xBCU, 0x54U, 0xDEU, 0xABU, 0xADU, 0xF2U, 0x6AU, 0xA6U, 0x41U, 0x22U, 0xFAU,
+    },
+    {
+        0xBBU, 0xE1U, 0xEAU, 0x90U, 0x5BU, 0x1CU, 0x78U, 0x2FU, 0x41U, 0x82U, 0x8CU, 0x4DU, 0xD4U, 0xA1U, 0x2CU, 0xCFU,
+        0x64U, 0x2CU, 0xFBU, 0x5BU, 0x88U, 0x03U, 0x27U, 0x16U, 0x21U, 0xFFU, 0x18U, 0xBAU, 0x3FU, 0x4FU, 0x7FU, 0xB7U,
+    },
+    {
+        0x2EU, 0xDEU, 0x74U, 0x07U, 0xA9U, 0x20U, 0xC1U, 0xCAU, 0xD8U, 0x37U, 0x27U, 0x7AU, 0x65U, 0x5FU, 0x21U, 0x4DU,
+        0xE1U, 0x21U, 0xAFU, 0xA9U, 0xC4U, 0xEBU, 0x8BU, 0xD3U, 0xDAU, 0x4CU, 0xC3U, 0x77U, 0x48U, 0xC8U, 0xC9U, 0x8CU,
+    },
+    {
+        0xF6U, 0x1CU, 0xC5U, 0xC1U, 0xF5U, 0xF3U, 0x3AU, 0x4BU, 0x44U, 0x88U, 0x32U, 0xC0U, 0xE6U, 0x47U, 0x6AU, 0x48U,
+        0xC9U, 0x6AU, 0xADU, 0xF5U, 0x4EU, 0x21U, 0xB3U, 0x35U, 0xF1U, 0xD1U, 0x8FU, 0xE9U, 0x3CU, 0xFEU, 0x67U, 0x72U,
+    },
+    {
+        0x63U, 0x23U, 0x5BU, 0x56U, 0x07U, 0xCFU, 0x83U, 0xAEU, 0xDDU, 0x3DU, 0x99U, 0xF7U, 0x57U, 0xB9U, 0x67U, 0xCAU,
+        0x4CU, 0x67U, 0xF9U, 0x07U, 0x02U, 0xC9U, 0x1FU, 0xF0U, 0x0AU, 0x62U, 0x54U, 0x24U, 0x4BU, 0x79U, 0xD1U, 0x49U,
+    },
+    {
+        0x5BU, 0x62U, 0x7EU, 0x68U, 0x96U, 0x8BU, 0xCFU, 0x06U, 0xF1U, 0x65U, 0xE3U, 0xAEU, 0x03U, 0x3CU, 0x70U, 0xCBU,
+        0x44U, 0x70U, 0x05U, 0x96U, 0xD6U, 0x76U, 0x6CU, 0x38U, 0x80U, 0x30U, 0xBEU, 0xF4U, 0xD2U, 0x77U, 0x8CU, 0x04U,
+    },
+    {
+        0xCEU, 0x5DU, 0xE0U, 0xFFU, 0x64U, 0xB7U, 0x76U, 0xE3U, 0x68U, 0xD0U, 0x48U, 0x99U, 0xB2U, 0xC2U, 0x7DU, 0x49U,
+        0xC1U, 0x7DU, 0x51U, 0x64U, 0x9AU, 0x9EU, 0xC0U, 0xFDU, 0x7BU, 0x83U, 0x65U, 0x39U, 0xA5U, 0xF0U, 0x3AU, 0x3FU,
+    },
+    {
+        0x2BU, 0xE0U, 0x34U, 0x14U, 0x33U, 0x03U, 0x57U, 0xD1U, 0xA9U, 0xD5U, 0x17U, 0x1CU, 0xABU, 0xB1U, 0x5EU, 0xC9U,
+        0x54U, 0x5EU, 0x7AU, 0x33U, 0xF9U, 0x8FU, 0x8AU, 0x2FU, 0x13U, 0x94U, 0xEDU, 0xD3U, 0x67U, 0x6BU, 0x36U, 0x9EU,
+    },
+    {
+        0xBEU, 0xDFU, 0xAAU, 0x83U, 0xC1U, 0x3FU, 0xEEU, 0x34U, 0x30U, 0x60U, 0xBCU, 0x2BU, 0x1AU, 0x4FU, 0x53U, 0x4BU,
+        0xD1U, 0x53U, 0x2EU, 0xC1U, 0xB5U, 0x67U, 0x26U, 0xEAU, 0xE8U, 0x27U, 0x36U, 0x1EU, 0x10U, 0xECU, 0x80U, 0xA5U,
+    },
+    {
+        0x86U, 0x9EU, 0x8FU, 0xBDU, 0x50U, 0x7BU, 0xA2U, 0x9CU, 0x1CU, 0x38U, 0xC6U, 0x72U, 0x4EU, 0xCAU, 0x44U, 0x4AU,
+        0xD9U, 0x44U, 0xD2U, 0x50U, 0x61U, 0xD8U, 0x55U, 0x22U, 0x62U, 0x75U, 0xDCU, 0xCEU, 0x89U, 0xE2U, 0xDDU, 0xE8U,
+    },
+    {
+        0x13U, 0xA1U, 0x11U, 0x2AU, 0xA2U, 0x47U, 0x1BU, 0x79U, 0x85U, 0x8DU, 0x6DU, 0x45U, 0xFFU, 0x34U, 0x49U, 0xC8U,
+        0x5CU, 0x49U, 0x86U, 0xA2U, 0x2DU, 0x30U, 0xF9U, 0xE7U, 0x99U, 0xC6U, 0x07U, 0x03U, 0xFEU, 0x65U, 0x6BU, 0xD3U,
+    },
+    {
+        0x45U, 0xE6U, 0x79U, 0x02U, 0xC4U, 0x41U, 0xB5U, 0x5CU, 0x50U, 0xA0U, 0x43U, 0x7DU, 0x2EU, 0xD1U, 0xF5U, 0xDDU,
+        0xF4U, 0xF5U, 0x72U, 0xC4U, 0x58U, 0xA9U, 0x6AU, 0xB9U, 0xBFU, 0x69U, 0x5AU, 0x22U, 0x30U, 0xB3U, 0x07U, 0x68U,
+    },
+    {
+        0xD0U, 0xD9U, 0xE7U, 0x95U, 0x36U, 0x7DU, 0x0CU, 0xB9U, 0xC9U, 0x15U, 0xE8U, 0x4AU, 0x9FU, 0x2FU, 0xF8U, 0x5FU,
+        0x71U, 0xF8U, 0x26U, 0x36U, 0x14U, 0x41U, 0xC6U, 0x7CU, 0x44U, 0xDAU, 0x81U, 0xEFU, 0x47U, 0x34U, 0xB1U, 0x53U,
+    },
+    {
+        0xE8U, 0x98U, 0xC2U, 0xABU, 0xA7U, 0x39U, 0x40U, 0x11U, 0xE5U, 0x4DU, 0x92U, 0x13U, 0xCBU, 0xAAU, 0xEFU, 0x5EU,
+        0x79U, 0xEFU, 0xDAU, 0xA7U, 0xC0U, 0xFEU, 0xB5U, 0xB4U, 0xCEU, 0x88U, 0x6BU, 0x3FU, 0xDEU, 0x3AU, 0xECU, 0x1EU,
+    },
+    {
+        0x7DU, 0xA7U, 0x5CU, 0x3CU, 0x55U, 0x05U, 0xF9U, 0xF4U, 0x7CU, 0xF8U, 0x39U, 0x24U, 0x7AU, 0x54U, 0xE2U, 0xDCU,
+        0xFCU, 0xE2U, 0x8EU, 0x55U, 0x8CU, 0x16U, 0x19U, 0x71U, 0x35U, 0x3BU, 0xB0U, 0xF2U, 0xA9U, 0xBDU, 0x5AU, 0x25U,
+    },
+    {
+        0x98U, 0x1AU, 0x88U, 0xD7U, 0x02U, 0xB1U, 0xD8U, 0xC6U, 0xBDU, 0xFDU, 0x66U, 0xA1U, 0x63U, 0x27U, 0xC1U, 0x5CU,
+        0x69U, 0xC1U, 0xA5U, 0x02U, 0xEFU, 0x07U, 0x53U, 0xA3U, 0x5DU, 0x2CU, 0x38U, 0x18U, 0x6BU, 0x26U, 0x56U, 0x84U,
+    },
+    {
+        0x0DU, 0x25U, 0x16U, 0x40U, 0xF0U, 0x8DU, 0x61U, 0x23U, 0x24U, 0x48U, 0xCDU, 0x96U, 0xD2U, 0xD9U, 0xCCU, 0xDEU,
+        0xECU, 0xCCU, 0xF1U, 0xF0U, 0xA3U, 0xEFU, 0xFFU, 0x66U, 0xA6U, 0x9FU, 0xE3U, 0xD5U, 0x1CU, 0xA1U, 0xE0U, 0xBFU,
+    },
+    {
+        0x35U, 0x64U, 0x33U, 0x7EU, 0x61U, 0xC9U, 0x2DU, 0x8BU, 0x08U, 0x10U, 0xB7U, 0xCFU, 0x86U, 0x5CU, 0xDBU, 0xDFU,
+        0xE4U, 0xDBU, 0x0DU, 0x61U, 0x77U, 0x50U, 0x8CU, 0xAEU, 0x2CU, 0xCDU, 0x09U, 0x05U, 0x85U, 0xAFU, 0xBDU, 0xF2U,
+    },
+    {
+        0xA0U, 0x5BU, 0xADU, 0xE9U, 0x93U, 0xF5U, 0x94U, 0x6EU, 0x91U, 0xA5U, 0x1CU, 0xF8U, 0x37U, 0xA2U, 0xD6U, 0x5DU,
+        0x61U, 0xD6U, 0x59U, 0x93U, 0x3BU, 0xB8U, 0x20U, 0x6BU, 0xD7U, 0x7EU, 0xD2U, 0xC8U, 0xF2U, 0x28U, 0x0BU, 0xC9U,
+    },
+    {
+        0x78U, 0x99U, 0x1CU, 0x2FU, 0xCFU, 0x26U, 0x6FU, 0xEFU, 0x0DU, 0x1AU, 0x09U, 0x42U, 0xB4U, 0xBAU, 0x9DU, 0x58U,
+        0x49U, 0x9DU, 0x5BU, 0xCFU, 0xB1U, 0x72U, 0x18U, 0x8DU, 0xFCU, 0xE3U, 0x9EU, 0x56U, 0x86U, 0x1EU, 0xA5U, 0x37U,
+    },
+    {
+        0xEDU, 0xA6U, 0x82U, 0xB8U, 0x3DU, 0x1AU, 0xD6U, 0x0AU, 0x94U, 0xAFU, 0xA2U, 0x75U, 0x05U, 0x44U, 0x90U, 0xDAU,
+        0xCCU, 0x90U, 0x0FU, 0x3DU, 0xFDU, 0x9AU, 0xB4U, 0x48U, 0x07U, 0x50U, 0x45U, 0x9BU, 0xF1U, 0x99U, 0x13U, 0x0CU,
+    },
+    {
+        0xD5U, 0xE7U, 0xA7U, 0x86U, 0xACU, 0x5EU, 0x9AU, 0xA2U, 0xB8U, 0xF7U, 0xD8U, 0x2CU, 0x51U, 0xC1U, 0x87U, 0xDBU,
+        0xC4U, 0x87U, 0xF3U, 0xACU, 0x29U, 0x25U, 0xC7U, 0x80U, 0x8DU, 0x02U, 0xAFU, 0x4BU, 0x68U, 0x97U, 0x4EU, 0x41U,
+    },
+    {
+        0x40U, 0xD8U, 0x39U, 0x11U, 0x5EU, 0x62U, 0x23U, 0x47U, 0x21U, 0x42U, 0x73U, 0x1BU, 0xE0U, 0x3FU, 0x8AU, 0x59U,
+        0x41U, 0x8AU, 0xA7U, 0x5EU, 0x65U, 0xCDU, 0x6BU, 0x45U, 0x76U, 0xB1U, 0x74U, 0x86U, 0x1FU, 0x10U, 0xF8U, 0x7AU,
+    },
+    {
+        0xA5U, 0x65U, 0xEDU, 0xFAU, 0x09U, 0xD6U, 0x02U, 0x75U, 0xE0U, 0x47U, 0x2CU, 0x9EU, 0xF9U, 0x4CU, 0xA9U, 0xD9U,
+        0xD4U, 0xA9U, 0x8CU, 0x09U, 0x06U, 0xDCU, 0x21U, 0x97U, 0x1EU, 0xA6U, 0xFCU, 0x6CU, 0xDDU, 0x8BU, 0xF4U, 0xDBU,
+    },
+    {
+        0x30U, 0x5AU, 0x73U, 0x6DU, 0xFBU, 0xEAU, 0xBBU, 0x90U, 0x79U, 0xF2U, 0x87U, 0xA9U, 0x48U, 0xB2U, 0xA4U, 0x5BU,
+        0x51U, 0xA4U, 0xD8U, 0xFBU, 0x4AU, 0x34U, 0x8DU, 0x52U, 0xE5U, 0x15U, 0x27U, 0xA1U, 0xAAU, 0x0CU, 0x42U, 0xE0U,
+    },
+    {
+        0x08U, 0x1BU, 0x56U, 0x53U, 0x6AU, 0xAEU, 0xF7U, 0x38U, 0x55U, 0xAAU, 0xFDU, 0xF0U, 0x1CU, 0x37U, 0xB3U, 0x5AU,
+        0x59U, 0xB3U, 0x24U, 0x6AU, 0x9EU, 0x8BU, 0xFEU, 0x9AU, 0x6FU, 0x47U, 0xCDU, 0x71U, 0x33U, 0x02U, 0x1FU, 0xADU,
+    },
+    {
+        0x9DU, 0x24U, 0xC8U, 0xC4U, 0x98U, 0x92U, 0x4EU, 0xDDU, 0xCCU, 0x1FU, 0x56U, 0xC7U, 0xADU, 0xC9U, 0xBEU, 0xD8U,
+        0xDCU, 0xBEU, 0x70U, 0x98U, 0xD2U, 0x63U, 0x52U, 0x5FU, 0x94U, 0xF4U, 0x16U, 0xBCU, 0x44U, 0x85U, 0xA9U, 0x96U,
+    },
+    {
+        0x3FU, 0x18U, 0xB3U, 0x58U, 0xD2U, 0x8FU, 0x86U, 0xBDU, 0xEAU, 0x53U, 0xD7U, 0x03U, 0x9DU, 0x07U, 0x25U, 0x50U,
+        0x09U, 0x25U, 0x20U, 0xD2U, 0x0DU, 0x98U, 0x8EU, 0xD1U, 0x39U, 0xFAU, 0x55U, 0xCAU, 0xDBU, 0x6EU, 0xC4U, 0xD6U,
+    },
+    {
+        0xAAU, 0x27U, 0x2DU, 0xCFU, 0x20U, 0xB3U, 0x3FU, 0x58U, 0x73U, 0xE6U, 0x7CU, 0x34U, 0x2CU, 0xF9U, 0x28U, 0xD2U,
+        0x8CU, 0x28U, 0x74U, 0x20U, 0x41U, 0x70U, 0x22U, 0x14U, 0xC2U, 0x49U, 0x8EU, 0x07U, 0xACU, 0xE9U, 0x72U, 0xEDU,
+    },
+    {
+        0x92U, 0x66U, 0x08U, 0xF1U, 0xB1U, 0xF7U, 0x73U, 0xF0U, 0x5FU, 0xBEU, 0x06U, 0x6DU, 0x78U, 0x7CU, 0x3FU, 0xD3U,
+        0x84U, 0x3FU, 0x88U, 0xB1U, 0x95U, 0xCFU, 0x51U, 0xDCU, 0x48U, 0x1BU, 0x64U, 0xD7U, 0x35U, 0xE7U, 0x2FU, 0xA0U,
+    },
+    {
+        0x07U, 0x59U, 0x96U, 0x66U, 0x43U, 0xCBU, 0xCAU, 0x15U, 0xC6U, 0x0BU, 0xADU, 0x5AU, 0xC9U, 0x82U, 0x32U, 0x51U,
+        0x01U, 0x32U, 0xDCU, 0x43U, 0xD9U, 0x27U, 0xFDU, 0x19U, 0xB3U, 0xA8U, 0xBFU, 0x1AU, 0x42U, 0x60U, 0x99U, 0x9BU,
+    },
+    {
+        0xE2U, 0xE4U, 0x42U, 0x8DU, 0x14U, 0x7FU, 0xEBU, 0x27U, 0x07U, 0x0EU, 0xF2U, 0xDFU, 0xD0U, 0xF1U, 0x11U, 0xD1U,
+        0x94U, 0x11U, 0xF7U, 0x14U, 0xBAU, 0x36U, 0xB7U, 0xCBU, 0xDBU, 0xBFU, 0x37U, 0xF0U, 0x80U, 0xFBU, 0x95U, 0x3AU,
+    },
+    {
+        0x77U, 0xDBU, 0xDCU, 0x1AU, 0xE6U, 0x43U, 0x52U, 0xC2U, 0x9EU, 0xBBU, 0x59U, 0xE8U, 0x61U, 0x0FU, 0x1CU, 0x53U,
+        0x11U, 0x1CU, 0xA3U, 0xE6U, 0xF6U, 0xDEU, 0x1BU, 0x0EU, 0x20U, 0x0CU, 0xECU, 0x3DU, 0xF7U, 0x7CU, 0x23U, 0x01U,
+    },
+    {
+        0x4FU, 0x9AU, 0xF9U, 0x24U, 0x77U, 0x07U, 0x1EU, 0x6AU, 0xB2U, 0xE3U, 0x23U, 0xB1U, 0x35U, 0x8AU, 0x0BU, 0x52U,
+        0x19U, 0x0BU, 0x5FU, 0x77U, 0x22U, 0x61U, 0x68U, 0xC6U, 0xAAU, 0x5EU, 0x06U, 0xEDU, 0x6EU, 0x72U, 0x7EU, 0x4CU,
+    },
+    {
+        0xDAU, 0xA5U, 0x67U, 0xB3U, 0x85U, 0x3BU, 0xA7U, 0x8FU, 0x2BU, 0x56U, 0x88U, 0x86U, 0x84U, 0x74U, 0x06U, 0xD0U,
+        0x9CU, 0x06U, 0x0BU, 0x85U, 0x6EU, 0x89U, 0xC4U, 0x03U, 0x51U, 0xEDU, 0xDDU, 0x20U, 0x19U, 0xF5U, 0xC8U, 0x77U,
+    },
+    {
+        0x02U, 0x67U, 0xD6U, 0x75U, 0xD9U, 0xE8U, 0x5CU, 0x0EU, 0xB7U, 0xE9U, 0x9DU, 0x3CU, 0x07U, 0x6CU, 0x4DU, 0xD5U,
+        0xB4U, 0x4DU, 0x09U, 0xD9U, 0xE4U, 0x43U, 0xFCU, 0xE5U, 0x7AU, 0x70U, 0x91U, 0xBEU, 0x6DU, 0xC3U, 0x66U, 0x89U,
+    },
+    {
+        0x97U, 0x58U, 0x48U, 0xE2U, 0x2BU, 0xD4U, 0xE5U, 0xEBU, 0x2EU, 0x5CU, 0x36U, 0x0BU, 0xB6U, 0x92U, 0x40U, 0x57U,
+        0x31U, 0x40U, 0x5DU, 0x2BU, 0xA8U, 0xABU, 0x50U, 0x20U, 0x81U, 0xC3U, 0x4AU, 0x73U, 0x1AU, 0x44U, 0xD0U, 0xB2U,
+    },
+    {
+        0xAFU, 0x19U, 0x6DU, 0xDCU, 0xBAU, 0x90U, 0xA9U, 0x43U, 0x02U, 0x04U, 0x4CU, 0x52U, 0xE2U, 0x17U, 0x57U, 0x56U,
+        0x39U, 0x57U, 0xA1U, 0xBAU, 0x7CU, 0x14U, 0x23U, 0xE8U, 0x0BU, 0x91U, 0xA0U, 0xA3U, 0x83U, 0x4AU, 0x8DU, 0xFFU,
+    },
+    {
+        0x3AU, 0x26U, 0xF3U, 0x4BU, 0x48U, 0xACU, 0x10U, 0xA6U, 0x9BU, 0xB1U, 0xE7U, 0x65U, 0x53U, 0xE9U, 0x5AU, 0xD4U,
+        0xBCU, 0x5AU, 0xF5U, 0x48U, 0x30U, 0xFCU, 0x8FU, 0x2DU, 0xF0U, 0x22U, 0x7BU, 0x6EU, 0xF4U, 0xCDU, 0x3BU, 0xC4U,
+    },
+    {
+        0xDFU, 0x9BU, 0x27U, 0xA0U, 0x1FU, 0x18U, 0x31U, 0x94U, 0x5AU, 0xB4U, 0xB8U, 0xE0U, 0x4AU, 0x9AU, 0x79U, 0x54U,
+        0x29U, 0x79U, 0xDEU, 0x1FU, 0x53U, 0xEDU, 0xC5U, 0xFFU, 0x98U, 0x35U, 0xF3U, 0x84U, 0x36U, 0x56U, 0x37U, 0x65U,
+    },
+    {
+        0x4AU, 0xA4U, 0xB9U, 0x37U, 0xEDU, 0x24U, 0x88U, 0x71U, 0xC3U, 0x01U, 0x13U, 0xD7U, 0xFBU, 0x64U, 0x74U, 0xD6U,
+        0xACU, 0x74U, 0x8AU, 0xEDU, 0x1FU, 0x05U, 0x69U, 0x3AU, 0x63U, 0x86U, 0x28U, 0x49U, 0x41U, 0xD1U, 0x81U, 0x5EU,
+    },
+    {
+        0x72U, 0xE5U, 0x9CU, 0x09U, 0x7CU, 0x60U, 0xC4U, 0xD9U, 0xEFU, 0x59U, 0x69U, 0x8EU, 0xAFU, 0xE1U, 0x63U, 0xD7U,
+        0xA4U, 0x63U, 0x76U, 0x7CU, 0xCBU, 0xBAU, 0x1AU, 0xF2U, 0xE9U, 0xD4U, 0xC2U, 0x99U, 0xD8U, 0xDFU, 0xDCU, 0x13U,
+    },
+    {
+        0xE7U, 0xDAU, 0x02U, 0x9EU, 0x8EU, 0x5CU, 0x7DU, 0x3CU, 0x76U, 0xECU, 0xC2U, 0xB9U, 0x1EU, 0x1FU, 0x6EU, 0x55U,
+        0x21U, 0x6EU, 0x22U, 0x8EU, 0x87U, 0x52U, 0xB6U, 0x37U, 0x12U, 0x67U, 0x19U, 0x54U, 0xAFU, 0x58U, 0x6AU, 0x28U,
+    },
+};
+
+static uint8_t gfMul(uint8_t a, uint8_t b);
+static uint8_t gfDiv(uint8_t a, uint8_t b);
+static void computeParity(const uint8_t *message, uint8_t *parity);
+static uint8_t berlekampMassey(const uint8_t *syndromes, uint8_t numErasures, uint8_t *errorLocator);
+static uint8_t evaluateAtLog(const uint8_t *poly, uint8_t numCoeffs, uint8_t xLog);
+
+obc_gs_error_code_t rsCcsdsEncode(const uint8_t *message, uint8_t *codeword) {
+  if (message == NULL || codeword == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint8_t parity[RS_CCSDS_PARITY_SIZE];
+  computeParity(message, parity);
+
+  memmove(codeword, message, RS_CCSDS_MESSAGE_SIZE);
+  memcpy(codeword + RS_CCSDS_MESSAGE_SIZE, parity, RS_CCSDS_PARITY_SIZE);
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t rsCcsdsDecode(const uint8_t *codeword, uint8_t *message, uint8_t *numCorrected) {
+  return rsCcsdsDecodeWithErasures(codeword, NULL, 0, message, numCorrected);
+}
+
+obc_gs_error_code_t rsCcsdsDecodeWithErasures(const uint8_t *codeword, const uint8_t *erasurePositions,
+                                              uint8_t numErasures, uint8_t *message, uint8_t *numCorrected) {
+  if (codeword == NULL || message == NULL || (erasurePositions == NULL && numErasures > 0)) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (numErasures > RS_CCSDS_PARITY_SIZE) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+  for (uint8_t i = 0; i < numErasures; ++i) {
+    if (erasurePositions[i] >= RS_CCSDS_BLOCK_SIZE) {
+      return OBC_GS_ERR_CODE_INVALID_ARG;
+    }
+  }
+
+  if (numCorrected != NULL) {
+    *numCorrected = 0;
+  }
+
+  // The received word modulo the generator is the recomputed parity XOR the received parity. It has the same
+  // syndromes as the whole word, and is all zero exactly when every syndrome is.
+  uint8_t remainder[RS_CCSDS_PARITY_SIZE];
+  computeParity(codeword, remainder);
+
+  uint8_t remainderBits = 0;
+  for (uint8_t i = 0; i < RS_CCSDS_PARITY_SIZE; ++i) {
+    remainder[i] ^= codeword[RS_CCSDS_MESSAGE_SIZE + i];
+    remainderBits |= remainder[i];
+  }
+
+  memmove(message, codeword, RS_CCSDS_MESSAGE_SIZE);
+  if (remainderBits == 0) {
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  // syndromes[j] is the received word evaluated at alpha^(j + 1). remainder[i] is the coefficient of x^(31 - i), so
+  // Horner's method runs through it in order.
+  uint8_t syndromes[RS_CCSDS_PARITY_SIZE];
+  for (uint8_t j = 0; j < RS_CCSDS_PARITY_SIZE; ++j) {
+    uint8_t syndrome = 0;
+    for (uint8_t i = 0; i < RS_CCSDS_PARITY_SIZE; ++i) {
+      syndrome = (syndrome == 0) ? remainder[i] : (uint8_t)(rsGfExp[rsGfLog[syndrome] + j + 1] ^ remainder[i]);
+    }
+    syndromes[j] = syndrome;
+  }
+
+  // Seed the locator with the erasure locator, the product of (1 + X_i x) over the erased positions, where X_i is
+  // alpha to the power of the position's term in the codeword polynomial
+  uint8_t errorLocator[RS_CCSDS_PARITY_SIZE + 1] = {1};
+  for (uint8_t i = 0; i < numErasures; ++i) {
+    uint8_t erasureLog = (uint8_t)(RS_CCSDS_BLOCK_SIZE - 1 - erasurePositions[i]);
+    for (uint8_t j = i + 1; j > 0; --j) {
+      if (errorLocator[j - 1] != 0) {
+        errorLocator[j] ^= rsGfExp[rsGfLog[errorLocator[j - 1]] + erasureLog];
+      }
+    }
+  }
+
+  // numErrors counts erasures too. Each erasure costs one parity symbol and each unknown error costs two.
+  uint8_t numErrors = berlekampMassey(syndromes, numErasures, errorLocator);
+  if (numErrors == 0 || numErrors < numErasures || 2U * numErrors - numErasures > RS_CCSDS_PARITY_SIZE ||
+      errorLocator[numErrors] == 0) {
+    return OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
+  }
+  for (uint8_t j = numErrors + 1; j <= RS_CCSDS_PARITY_SIZE; ++j) {
+    if (errorLocator[j] != 0) {
+      return OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
+    }
+  }
+
+  // Error evaluator: syndromes(x) * errorLocator(x) mod x^32, lowest order coefficient first
+  uint8_t errorEvaluator[RS_CCSDS_PARITY_SIZE] = {0};
+  for (uint8_t i = 0; i < RS_CCSDS_PARITY_SIZE; ++i) {
+    for (uint8_t j = 0; j <= numErrors && j <= i; ++j) {
+      errorEvaluator[i] ^= gfMul(syndromes[i - j], errorLocator[j]);
+    }
+  }
+
+  // Chien search. locatorTerms[j] tracks the log of errorLocator[j] * alpha^(-j * p) as p steps through every
+  // power of x, so each step is an add per term instead of evaluating the polynomial from scratch.
+  int16_t locatorTerms[RS_CCSDS_PARITY_SIZE + 1];
+  for (uint8_t j = 1; j <= numErrors; ++j) {
+    locatorTerms[j] = (errorLocator[j] == 0) ? -1 : (int16_t)rsGfLog[errorLocator[j]];
+  }
+
+  uint8_t errorPowers[RS_CCSDS_PARITY_SIZE];
+  uint8_t numRoots = 0;
+  for (uint16_t p = 0; p < RS_CCSDS_FIELD_ORDER && numRoots < numErrors; ++p) {
+    uint8_t sum = errorLocator[0];
+    for (uint8_t j = 1; j <= numErrors; ++j) {
+      if (locatorTerms[j] < 0) {
+        continue;
+      }
+      sum ^= rsGfExp[locatorTerms[j]];
+
+      // Multiply by alpha^-j for the next power
+      locatorTerms[j] += (int16_t)(RS_CCSDS_FIELD_ORDER - j);
+      if (locatorTerms[j] >= (int16_t)RS_CCSDS_FIELD_ORDER) {
+        locatorTerms[j] -= (int16_t)RS_CCSDS_FIELD_ORDER;
+      }
+    }
+
+    if (sum == 0) {
+      errorPowers[numRoots++] = (uint8_t)p;
+    }
+  }
+
+  // The locator must split into distinct roots inside the codeword, otherwise there are too many errors
+  if (numRoots != numErrors) {
+    return OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
+  }
+
+  // Forney's algorithm with the first root at alpha^1: error = evaluator(X^-1) / locator'(X^-1)
+  uint8_t locatorDerivative[RS_CCSDS_PARITY_SIZE] = {0};
+  for (uint8_t j = 1; j <= numErrors; j += 2) {
+    locatorDerivative[j - 1] = errorLocator[j];
+  }
+
+  for (uint8_t i = 0; i < numRoots; ++i) {
+    uint8_t inverseLog = (uint8_t)((RS_CCSDS_FIELD_ORDER - errorPowers[i]) % RS_CCSDS_FIELD_ORDER);
+    uint8_t numerator = evaluateAtLog(errorEvaluator, RS_CCSDS_PARITY_SIZE, inverseLog);
+    uint8_t denominator = evaluateAtLog(locatorDerivative, numErrors, inverseLog);
+    if (denominator == 0) {
+      return OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
+    }
+
+    // Only message bytes are corrected; errors in the parity do not affect the output
+    uint8_t position = (uint8_t)(RS_CCSDS_BLOCK_SIZE - 1 - errorPowers[i]);
+    if (position < RS_CCSDS_MESSAGE_SIZE) {
+      message[position] ^= gfDiv(numerator, denominator);
+    }
+  }
+
+  if (numCorrected != NULL) {
+    *numCorrected = numErrors;
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+static uint8_t gfMul(uint8_t a, uint8_t b) {
+  if (a == 0 || b == 0) {
+    return 0;
+  }
+  return rsGfExp[rsGfLog[a] + rsGfLog[b]];
+}
+
+/**
+ * @brief divides two field elements; b must not be 0
+ */
+static uint8_t gfDiv(uint8_t a, uint8_t b) {
+  if (a == 0) {
+    return 0;
+  }
+  return rsGfExp[rsGfLog[a] + RS_CCSDS_FIELD_ORDER - rsGfLog[b]];
+}
+
+/**
+ * @brief runs the message through the generator LFSR
+ *
+ * @param message RS_CCSDS_MESSAGE_SIZE bytes
+ * @param parity set to the RS_CCSDS_PARITY_SIZE parity bytes, highest order coefficient first
+ */
+static void computeParity(const uint8_t *message, uint8_t *parity) {
+  memset(parity, 0, RS_CCSDS_PARITY_SIZE);
+
+  for (uint8_t i = 0; i < RS_CCSDS_MESSAGE_SIZE; ++i) {
+    const uint8_t *feedback = rsParityTable[message[i] ^ parity[0]];
+    for (uint8_t j = 0; j < RS_CCSDS_PARITY_SIZE - 1; ++j) {
+      parity[j] = parity[j + 1] ^ feedback[j];
+    }
+    parity[RS_CCSDS_PARITY_SIZE - 1] = feedback[RS_CCSDS_PARITY_SIZE - 1];
+  }
+}
+
+/**
+ * @brief finds the errata locator polynomial of a set of syndromes
+ *
+ * @param syndromes RS_CCSDS_PARITY_SIZE syndromes, starting at alpha^1
+ * @param numErasures number of erasures already factored into errorLocator
+ * @param errorLocator holds the erasure locator on entry (1 with no erasures); set to the RS_CCSDS_PARITY_SIZE + 1
+ * coefficients of the errata locator, lowest order first
+ *
+ * @return uint8_t - the number of errors and erasures the locator describes
+ */
+static uint8_t berlekampMassey(const uint8_t *syndromes, uint8_t numErasures, uint8_t *errorLocator) {
+  uint8_t previous[RS_CCSDS_PARITY_SIZE + 1];
+  uint8_t scratch[RS_CCSDS_PARITY_SIZE + 1];
+  uint8_t numErrors = numErasures;
+  uint8_t shift = 1;
+  uint8_t previousDiscrepancy = 1;
+
+  memcpy(previous, errorLocator, sizeof(previous));
+
+  // The first numErasures syndromes are accounted for by the erasure locator
+  for (uint8_t n = numErasures; n < RS_CCSDS_PARITY_SIZE; ++n) {
+    uint8_t discrepancy = 0;
+    for (uint8_t i = 0; i <= numErrors && i <= n; ++i) {
+      discrepancy ^= gfMul(errorLocator[i], syndromes[n - i]);
+    }
+
+    if (discrepancy == 0) {
+      shift++;
+      continue;
+    }
+
+    uint8_t scale = gfDiv(discrepancy, previousDiscrepancy);
+    bool lengthChanges = (2U * numErrors <= n + numErasures);
+    if (lengthChanges) {
+      memcpy(scratch, errorLocator, sizeof(scratch));
+    }
+
+    for (uint8_t i = 0; i + shift <= RS_CCSDS_PARITY_SIZE; ++i) {
+      errorLocator[i + shift] ^= gfMul(scale, previous[i]);
+    }
+
+    if (lengthChanges) {
+      numErrors = (uint8_t)(n + 1 + numErasures - numErrors);
+      memcpy(previous, scratch, sizeof(previous));
+      previousDiscrepancy = discrepancy;
+      shift = 1;
+    } else {
+      shift++;
+    }
+  }
+
+  return numErrors;
+}
+
+/**
+ * @brief evaluates a polynomial at alpha^xLog with Horner's method
+ *
+ * @param poly coefficients, lowest order first
+ * @param numCoeffs number of coefficients in poly
+ * @param xLog log of the point to evaluate at
+ */
+static uint8_t evaluateAtLog(const uint8_t *poly, uint8_t numCoeffs, uint8_t xLog) {
+  uint8_t result = 0;
+  for (uint8_t i = numCoeffs; i > 0; --i) {
+    result = (result == 0) ? poly[i - 1] : (uint8_t)(rsGfExp[rsGfLog[result] + xLog] ^ poly[i - 1]);
+  }
+  return result;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "obc_gs_errors.h"
+
+#include <stdint.h>
+
+/*
+ * Reed-Solomon (255,223) codec specialized for the code used on the link: GF(2^8) with primitive polynomial 0x187,
+ * generator roots alpha^1 through alpha^32. Codewords are bit-for-bit identical to libcorrect's
+ * correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32).
+ *
+ * Everything is computed from const tables, so there is no heap use and no initialization.
+ */
+#define RS_CCSDS_BLOCK_SIZE 255U
+#define RS_CCSDS_MESSAGE_SIZE 223U
+#define RS_CCSDS_PARITY_SIZE (RS_CCSDS_BLOCK_SIZE - RS_CCSDS_MESSAGE_SIZE)
+#define RS_CCSDS_MAX_CORRECTABLE (RS_CCSDS_PARITY_SIZE / 2U)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief encodes a message into a systematic codeword with table-driven LFSR parity generation
+ *
+ * @param message RS_CCSDS_MESSAGE_SIZE bytes to encode
+ * @param codeword RS_CCSDS_BLOCK_SIZE byte buffer; set to the message followed by the parity bytes
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if a pointer is NULL
+ */
+obc_gs_error_code_t rsCcsdsEncode(const uint8_t *message, uint8_t *codeword);
+
+/**
+ * @brief decodes a codeword, correcting up to RS_CCSDS_MAX_CORRECTABLE byte errors
+ *
+ * A codeword whose syndromes are all zero is copied out without running the error locator search.
+ *
+ * @param codeword RS_CCSDS_BLOCK_SIZE bytes received
+ * @param message RS_CCSDS_MESSAGE_SIZE byte buffer; set to the corrected message
+ * @param numCorrected set to the number of bytes corrected, including parity bytes; may be NULL
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_REED_SOL_DEC_ERR if the codeword has too many errors to correct
+ */
+obc_gs_error_code_t rsCcsdsDecode(const uint8_t *codeword, uint8_t *message, uint8_t *numCorrected);
+
+/**
+ * @brief decodes a codeword whose unreliable positions are known
+ *
+ * An erased position costs one parity symbol instead of the two an unknown error costs, so any mix of numErrors
+ * errors and numErasures erasures with 2 * numErrors + numErasures <= RS_CCSDS_PARITY_SIZE is corrected.
+ *
+ * @param codeword RS_CCSDS_BLOCK_SIZE bytes received
+ * @param erasurePositions distinct codeword indices (0 is the first message byte) that may be wrong; may be NULL if
+ * numErasures is 0
+ * @param numErasures number of entries in erasurePositions, at most RS_CCSDS_PARITY_SIZE
+ * @param message RS_CCSDS_MESSAGE_SIZE byte buffer; set to the corrected message
+ * @param numCorrected set to the number of errors and erasures located; may be NULL
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_REED_SOL_DEC_ERR if the codeword has too many errors to correct
+ */
+obc_gs_error_code_t rsCcsdsDecodeWithErasures(const uint8_t *codeword, const uint8_t *erasurePositions,
+                                              uint8_t numErasures, uint8_t *message, uint8_t *numCorrected);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,160 @@
+from ctypes import POINTER, Structure, Union, c_float, c_uint, c_uint8, c_uint16, c_uint32, pointer
+from enum import IntEnum
+from typing import Final
+
+from interfaces import RS_DECODED_DATA_SIZE
+from interfaces.obc_gs_interface import interface
+
+# ######################################################################
+# ||                                                                  ||
+# ||            Ctype Declerations for Telemetry Unpacking            ||
+# ||                                                                  ||
+# ######################################################################
+
+# Path to File: interfaces/obc_gs_interface/telemetry/obc_gs_telemetry_data.h
+TELEM_GNC_HIST_NUM_BINS: Final[int] = 8
+
+
+class TelemGncHistBin(Structure):
+    """
+    One bin of a GNC timing histogram, the python equivalent of telem_gnc_hist_bin_t
+    """
+
+    _fields_ = [("bin", c_uint8), ("cycles", c_uint16)]
+
+
+class _TelemetryValue(Union):
+    """
+    Union class needed to create the TelemetryData Class
+    """
+
+    _fields_ = [
+        ("cc1120Temp", c_float),
+        ("commsCustomTransceiverTemp", c_float),
+        ("obcTemp", c_float),
+        ("adcsMagBoardTemp", c_float),
+        ("adcsSensorBoardTemp", c_float),
+        ("epsBoardTemp", c_float),
+        ("solarPanel1Temp", c_float),
+        ("solarPanel2Temp", c_float),
+        ("solarPanel3Temp", c_float),
+        ("solarPanel4Temp", c_float),
+        ("epsComms5vCurrent", c_float),
+        ("epsComms3v3Current", c_float),
+        ("epsMagnetorquer8vCurrent", c_float),
+        ("epsAdcs5vCurrent", c_float),
+        ("epsAdcs3v3Current", c_float),
+        ("epsObc3v3Current", c_float),
+        ("epsComms5vVoltage", c_float),
+        ("epsComms3v3Voltage", c_float),
+        ("epsMagnetorquer8vVoltage", c_float),
+        ("epsAdcs5vVoltage", c_float),
+        ("epsAdcs3v3Voltage", c_float),
+        ("epsObc3v3Voltage", c_float),
+        ("obcState", c_uint8),
+        ("epsState", c_uint8),
+        ("numCspPacketsRcvd", c_uint32),
+        ("gncStartLatencyBin", TelemGncHistBin),
+        ("gncExecTimeBin", TelemGncHistBin),
+        ("gncDeadlineMisses", c_uint32),
+    ]
+
+
+class TelemetryData(Structure):
+    """
+    The python equivalent class for the telemetry_data_t structure in the C implementation
+    NOTE: This class has a union so read the member that matches the id
+    """
+
+    _anonymous_ = ("u",)
+    _fields_ = [("u", _TelemetryValue), ("id", c_uint), ("timestamp", c_uint32)]
+
+
+interface.unpackTelemetryPacket.argtypes = (
+    POINTER(c_uint8 * RS_DECODED_DATA_SIZE),
+    c_uint32,
+    POINTER(TelemetryData * RS_DECODED_DATA_SIZE),
+    c_uint32,
+    POINTER(c_uint32),
+)
+interface.unpackTelemetryPacket.restype = c_uint
+
+
+# ######################################################################
+# ||                                                                  ||
+# ||                        ENUM Declerations                         ||
+# ||                                                                  ||
+# ######################################################################
+# NOTE: Update these files accordingly when the C Enums are updated
+
+
+# Path to File: interfaces/obc_gs_interface/telemetry/obc_gs_telemetry_id.h
+class TelemetryDataId(IntEnum):
+    """
+    Enums corresponding to the C implementation of telemetry_data_id_t
+    """
+
+    TELEM_NONE = 0
+    TELEM_CC1120_TEMP = 1
+    TELEM_COMMS_CUSTOM_TRANSCEIVER_TEMP = 2
+    TELEM_OBC_TEMP = 3
+    TELEM_ADCS_MAG_BOARD_TEMP = 4
+    TELEM_ADCS_SENSOR_BOARD_TEMP = 5
+    TELEM_EPS_BOARD_TEMP = 6
+    TELEM_SOLAR_PANEL_1_TEMP = 7
+    TELEM_SOLAR_PANEL_2_TEMP = 8
+    TELEM_SOLAR_PANEL_3_TEMP = 9
+    TELEM_SOLAR_PANEL_4_TEMP = 10
+    TELEM_EPS_COMMS_5V_CURRENT = 11
+    TELEM_EPS_COMMS_3V3_CURRENT = 12
+    TELEM_EPS_MAGNETORQUER_8V_CURRENT = 13
+    TELEM_EPS_ADCS_5V_CURRENT = 14
+    TELEM_EPS_ADCS_3V3_CURRENT = 15
+    TELEM_EPS_OBC_3V3_CURRENT = 16
+    TELEM_EPS_COMMS_5V_VOLTAGE = 17
+    TELEM_EPS_COMMS_3V3_VOLTAGE = 18
+    TELEM_EPS_MAGNETORQUER_8V_VOLTAGE = 19
+    TELEM_EPS_ADCS_5V_VOLTAGE = 20
+    TELEM_EPS_ADCS_3V3_VOLTAGE = 21
+    TELEM_EPS_OBC_3V3_VOLTAGE = 22
+    TELEM_OBC_STATE = 23
+    TELEM_EPS_STATE = 24
+    TELEM_NUM_CSP_PACKETS_RCVD = 25
+    TELEM_PONG = 26
+    TELEM_GNC_START_LATENCY_HIST = 27
+    TELEM_GNC_EXEC_TIME_HIST = 28
+    TELEM_GNC_DEADLINE_MISSES = 29
+    NUM_TELEMETRY_DATA_IDS = 30
+
+
+# ######################################################################
+# ||                                                                  ||
+# ||                        Telemetry Unpacking                       ||
+# ||                                                                  ||
+# ######################################################################
+
+
+def unpack_telemetry_packet(packet: bytes) -> list[TelemetryData]:
+    """
+    Unpacks every telemetry point of a downlinked telemetry packet. Both the plain layout (items packed one after
+    another) and the compressed layout (a base timestamp with per item deltas) are handled; see unpackTelemetryPacket
+    in the C implementation
+
+    :param packet: Bytes of a telemetry packet (at most 223 bytes)
+    :return: A list of the unpacked telemetry points
+    """
+    if len(packet) > RS_DECODED_DATA_SIZE:
+        raise ValueError("The telemetry packet to unpack is too long")
+
+    buff = (c_uint8 * RS_DECODED_DATA_SIZE)(*list(packet))
+    # Every item takes at least two bytes, so this can never fill up
+    data = (TelemetryData * RS_DECODED_DATA_SIZE)()
+    num_unpacked = c_uint32(0)
+
+    res = interface.unpackTelemetryPacket(
+        pointer(buff), len(packet), pointer(data), RS_DECODED_DATA_SIZE, pointer(num_unpacked)
+    )
+    if res != 0:
+        raise ValueError("Could not unpack telemetry packet. OBC GS Error Code: " + str(res))
+
+    return list(data[: num_unpacked.value])
@@ -5,6 +5,20 @@
 #include <stdint.h>
 #include <stddef.h>
 
+/*
+ * Bins of the GNC timing histograms, by upper edge: 100 us, 200 us, 500 us, 1 ms, 2 ms, 5 ms, 10 ms and the last bin
+ * holds everything from 10 ms up. Each bin counts the GNC cycles of one reporting period.
+ *
+ * A histogram goes down as one item per bin that counted any cycles, all with the same timestamp. A whole histogram in
+ * one item would make the union three times as wide, and every item in the telemetry queue with it.
+ */
+#define TELEM_GNC_HIST_NUM_BINS 8U
+
+typedef struct {
+  uint8_t bin;      // 0 to TELEM_GNC_HIST_NUM_BINS - 1
+  uint16_t cycles;  // GNC cycles in the bin over the reporting period
+} telem_gnc_hist_bin_t;
+
 typedef struct {
   union {
     // Temperature values
@@ -39,6 +53,10 @@ typedef struct {
     uint8_t epsState;
 
     uint32_t numCspPacketsRcvd;
+
+    telem_gnc_hist_bin_t gncStartLatencyBin;
+    telem_gnc_hist_bin_t gncExecTimeBin;
+    uint32_t gncDeadlineMisses;  // Since boot
   };
 
   telemetry_data_id_t id;
@@ -47,3 +65,18 @@ typedef struct {
 } telemetry_data_t;
 
 #define MAX_TELEMETRY_DATA_SIZE sizeof(telemetry_data_t)
+
+/*
+ * A telemetry packet is either a run of items packed by packTelemetry or a compressed packet. A compressed packet
+ * starts with TELEM_COMPRESSED_PACKET_MARKER, which is not a telemetry ID, and the timestamp of its first item
+ * (4B, big endian). Each item is then:
+ *   ID (1B) | zigzag varint of its timestamp minus the previous item's | value
+ * The value of an ID picked by TELEM_IS_XOR_DELTA_ENCODED is a varint of its bits XORed with the previous value of the
+ * same ID in the packet; every other value is stored as packTelemetry stores it. Either kind of packet ends at its
+ * last byte or at a zero byte, and decodes without any other packet.
+ */
+#define TELEM_COMPRESSED_PACKET_MARKER 0xC7U
+#define TELEM_COMPRESSED_HEADER_SIZE 5U
+
+// Sensor readings are quantized, so consecutive values share their sign, exponent and low mantissa bits
+#define TELEM_IS_XOR_DELTA_ENCODED(id) ((id) == TELEM_OBC_TEMP)
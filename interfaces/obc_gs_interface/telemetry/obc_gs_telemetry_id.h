@@ -38,4 +38,10 @@ typedef enum {
 
   TELEM_NUM_CSP_PACKETS_RCVD,
   TELEM_PONG,
+
+  // GNC control loop timing
+  TELEM_GNC_START_LATENCY_HIST,
+  TELEM_GNC_EXEC_TIME_HIST,
+  TELEM_GNC_DEADLINE_MISSES,
+  NUM_TELEMETRY_DATA_IDS
 } telemetry_data_id_t;
@@ -2,15 +2,27 @@
 #include "obc_gs_telemetry_data.h"
 #include "obc_gs_telemetry_id.h"
 #include "data_pack_utils.h"
+#include "data_unpack_utils.h"
 #include "obc_gs_errors.h"
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+
+#define TELEM_PACKED_HEADER_SIZE 5U  // ID and timestamp of a packTelemetry item
+#define TELEM_XOR_DELTA_VALUE_SIZE 4U
+#define TELEM_COMPRESSED_MAX_ITEM_SIZE (1U + VARINT_MAX_SIZE + MAX_TELEMETRY_DATA_SIZE)
 
 /* Declare all pack functions for telemetry data */
 static void packObcTemp(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset);
 static void packObcState(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset);
 static void packPong(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset);
+static void packGncStartLatencyHist(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset);
+static void packGncExecTimeHist(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset);
+static void packGncDeadlineMisses(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset);
+
+static uint64_t xorDeltaToVarint(uint32_t value, uint32_t prevValue);
 
 typedef void (*telemetry_pack_func_t)(const telemetry_data_t *, uint8_t *, uint32_t *);
 
@@ -18,6 +30,9 @@ static const telemetry_pack_func_t telemPackFns[] = {
     [TELEM_OBC_TEMP] = packObcTemp,
     [TELEM_OBC_STATE] = packObcState,
     [TELEM_PONG] = packPong,
+    [TELEM_GNC_START_LATENCY_HIST] = packGncStartLatencyHist,
+    [TELEM_GNC_EXEC_TIME_HIST] = packGncExecTimeHist,
+    [TELEM_GNC_DEADLINE_MISSES] = packGncDeadlineMisses,
 };
 
 obc_gs_error_code_t packTelemetry(const telemetry_data_t *data, uint8_t *buffer, size_t len, uint32_t *numPacked) {
@@ -49,6 +64,95 @@ obc_gs_error_code_t packTelemetry(const telemetry_data_t *data, uint8_t *buffer,
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
+obc_gs_error_code_t telemCompressorInit(telemetry_compressor_t *compressor, uint8_t *buffer, uint32_t buffLen) {
+  if (compressor == NULL || buffer == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  memset(compressor, 0, sizeof(*compressor));
+  compressor->buffer = buffer;
+  compressor->buffLen = buffLen;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t telemCompressorAdd(telemetry_compressor_t *compressor, const uint8_t *packed, uint32_t packedLen) {
+  if (compressor == NULL || packed == NULL || packedLen < TELEM_PACKED_HEADER_SIZE ||
+      packedLen > MAX_TELEMETRY_DATA_SIZE) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t packedOffset = 0;
+  uint8_t id = unpackUint8(packed, &packedOffset);
+  uint32_t timestamp = unpackUint32(packed, &packedOffset);
+
+  if (id == TELEM_NONE || id >= NUM_TELEMETRY_DATA_IDS) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  bool isFirstItem = (compressor->offset == 0);
+  uint32_t prevTimestamp = isFirstItem ? timestamp : compressor->prevTimestamp;
+
+  uint8_t item[TELEM_COMPRESSED_MAX_ITEM_SIZE];
+  uint32_t itemLen = 0;
+  packUint8(id, item, &itemLen);
+  packVarInt64((int64_t)timestamp - (int64_t)prevTimestamp, item, &itemLen);
+
+  uint32_t value = 0;
+  if (TELEM_IS_XOR_DELTA_ENCODED(id)) {
+    if (packedLen != TELEM_PACKED_HEADER_SIZE + TELEM_XOR_DELTA_VALUE_SIZE) {
+      return OBC_GS_ERR_CODE_INVALID_ARG;
+    }
+    value = unpackUint32(packed, &packedOffset);
+    packVarUint64(xorDeltaToVarint(value, compressor->prevValues[id]), item, &itemLen);
+  } else {
+    memcpy(&item[itemLen], &packed[packedOffset], packedLen - packedOffset);
+    itemLen += packedLen - packedOffset;
+  }
+
+  uint32_t headerLen = isFirstItem ? TELEM_COMPRESSED_HEADER_SIZE : 0;
+  if (compressor->offset + headerLen + itemLen > compressor->buffLen) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  if (isFirstItem) {
+    packUint8(TELEM_COMPRESSED_PACKET_MARKER, compressor->buffer, &compressor->offset);
+    packUint32(timestamp, compressor->buffer, &compressor->offset);
+  }
+
+  memcpy(&compressor->buffer[compressor->offset], item, itemLen);
+  compressor->offset += itemLen;
+  compressor->prevTimestamp = timestamp;
+  if (TELEM_IS_XOR_DELTA_ENCODED(id)) {
+    compressor->prevValues[id] = value;
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Encode the XOR of a value with the previous one so that a short run of differing bits makes a small varint
+ *
+ * @param value The value bits
+ * @param prevValue The previous value bits of the same ID
+ * @return uint64_t - 0 if the values are equal. Otherwise 1 + (the XOR without its trailing zeros and the lowest 1 bit,
+ * shifted up by 5 bits, with the number of trailing zeros in the low 5 bits).
+ */
+static uint64_t xorDeltaToVarint(uint32_t value, uint32_t prevValue) {
+  uint32_t delta = value ^ prevValue;
+  if (delta == 0) {
+    return 0;
+  }
+
+  uint32_t trailingZeros = 0;
+  while ((delta & 1U) == 0) {
+    delta >>= 1;
+    trailingZeros++;
+  }
+
+  return ((((uint64_t)delta >> 1) << 5) | trailingZeros) + 1U;
+}
+
 static void packObcTemp(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset) {
   packFloat(data->obcTemp, buffer, offset);
 }
@@ -60,3 +164,17 @@ static void packObcState(const telemetry_data_t *data, uint8_t *buffer, uint32_t
 static void packPong(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset) {
   // Nothing to pack
 }
+
+static void packGncStartLatencyHist(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset) {
+  packUint8(data->gncStartLatencyBin.bin, buffer, offset);
+  packUint16(data->gncStartLatencyBin.cycles, buffer, offset);
+}
+
+static void packGncExecTimeHist(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset) {
+  packUint8(data->gncExecTimeBin.bin, buffer, offset);
+  packUint16(data->gncExecTimeBin.cycles, buffer, offset);
+}
+
+static void packGncDeadlineMisses(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset) {
+  packUint32(data->gncDeadlineMisses, buffer, offset);
+}
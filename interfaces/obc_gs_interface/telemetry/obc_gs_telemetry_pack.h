@@ -6,6 +6,15 @@
 #include <stdint.h>
 #include <stddef.h>
 
+// Builds one compressed telemetry packet; see TELEM_COMPRESSED_PACKET_MARKER for the layout
+typedef struct {
+  uint8_t *buffer;
+  uint32_t buffLen;
+  uint32_t offset;  // Bytes of buffer used; 0 until the first item is added
+  uint32_t prevTimestamp;
+  uint32_t prevValues[NUM_TELEMETRY_DATA_IDS];  // Last value bits of each XOR delta encoded ID
+} telemetry_compressor_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -20,6 +29,26 @@ extern "C" {
  */
 obc_gs_error_code_t packTelemetry(const telemetry_data_t *data, uint8_t *buffer, size_t buffLen, uint32_t *numPacked);
 
+/**
+ * @brief Start a compressed telemetry packet
+ *
+ * @param compressor The compressor to reset
+ * @param buffer The packet buffer; zero it first so the unused end reads as padding
+ * @param buffLen The length of the packet buffer
+ */
+obc_gs_error_code_t telemCompressorInit(telemetry_compressor_t *compressor, uint8_t *buffer, uint32_t buffLen);
+
+/**
+ * @brief Add a telemetry point to a compressed packet
+ *
+ * @param compressor The compressor of the packet
+ * @param packed The telemetry point as packed by packTelemetry
+ * @param packedLen The length of the packed telemetry point
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_BUFF_TOO_SMALL if the packet has no room for the point; the packet is
+ * left unchanged so the caller can send it and start a new one
+ */
+obc_gs_error_code_t telemCompressorAdd(telemetry_compressor_t *compressor, const uint8_t *packed, uint32_t packedLen);
+
 #ifdef __cplusplus
 }
 #endif
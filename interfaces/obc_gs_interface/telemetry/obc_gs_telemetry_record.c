@@ -0,0 +1,146 @@
+#include "obc_gs_telemetry_record.h"
+#include "obc_gs_telemetry_pack.h"
+#include "obc_gs_crc.h"
+#include "data_pack_utils.h"
+#include "data_unpack_utils.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define TELEM_RECORD_PAYLOAD(block) ((block)->data + TELEM_RECORD_BLOCK_HEADER_SIZE)
+
+void telemRecordBlockInit(telemetry_record_block_t *block) {
+  if (block == NULL) {
+    return;
+  }
+
+  block->payloadLen = 0;
+  block->numRecords = 0;
+}
+
+obc_gs_error_code_t telemRecordBlockAppend(telemetry_record_block_t *block, const telemetry_data_t *data) {
+  if (block == NULL || data == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  // packTelemetry needs room for the largest point, which the end of the block may not have
+  uint8_t packed[MAX_TELEMETRY_DATA_SIZE];
+  uint32_t packedLen = 0;
+  obc_gs_error_code_t errCode = packTelemetry(data, packed, sizeof(packed), &packedLen);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  if (block->payloadLen + TELEM_RECORD_LENGTH_SIZE + packedLen > TELEM_RECORD_BLOCK_MAX_PAYLOAD_SIZE ||
+      block->numRecords == UINT8_MAX) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  uint8_t *payload = TELEM_RECORD_PAYLOAD(block);
+  payload[block->payloadLen] = (uint8_t)packedLen;
+  memcpy(&payload[block->payloadLen + TELEM_RECORD_LENGTH_SIZE], packed, packedLen);
+
+  block->payloadLen += (uint16_t)(TELEM_RECORD_LENGTH_SIZE + packedLen);
+  block->numRecords++;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t telemRecordBlockFinish(telemetry_record_block_t *block, uint16_t *blockLen) {
+  if (block == NULL || blockLen == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t offset = 0;
+  packUint8(TELEM_RECORD_BLOCK_MAGIC, block->data, &offset);
+  packUint8(TELEM_RECORD_FORMAT_VERSION, block->data, &offset);
+  packUint8(block->numRecords, block->data, &offset);
+  packUint16(block->payloadLen, block->data, &offset);
+  packUint16(calculateCrc16Ccitt(TELEM_RECORD_PAYLOAD(block), block->payloadLen), block->data, &offset);
+
+  *blockLen = (uint16_t)(TELEM_RECORD_BLOCK_HEADER_SIZE + block->payloadLen);
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t telemRecordParseHeader(const uint8_t *header, uint16_t *payloadLen) {
+  if (header == NULL || payloadLen == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t offset = 0;
+  uint8_t magic = unpackUint8(header, &offset);
+  uint8_t version = unpackUint8(header, &offset);
+  (void)unpackUint8(header, &offset);  // Number of records; checked against the payload by telemRecordBlockLoad
+  uint16_t length = unpackUint16(header, &offset);
+
+  if (magic != TELEM_RECORD_BLOCK_MAGIC || version != TELEM_RECORD_FORMAT_VERSION ||
+      length > TELEM_RECORD_BLOCK_MAX_PAYLOAD_SIZE) {
+    return OBC_GS_ERR_CODE_INVALID_TELEM_RECORD;
+  }
+
+  *payloadLen = length;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t telemRecordBlockLoad(telemetry_record_block_t *block) {
+  if (block == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint16_t payloadLen = 0;
+  obc_gs_error_code_t errCode = telemRecordParseHeader(block->data, &payloadLen);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  uint32_t offset = 0;
+  (void)unpackUint8(block->data, &offset);  // Magic and version, checked above
+  (void)unpackUint8(block->data, &offset);
+  uint8_t numRecords = unpackUint8(block->data, &offset);
+  (void)unpackUint16(block->data, &offset);
+  uint16_t crc = unpackUint16(block->data, &offset);
+
+  const uint8_t *payload = TELEM_RECORD_PAYLOAD(block);
+  if (calculateCrc16Ccitt(payload, payloadLen) != crc) {
+    return OBC_GS_ERR_CODE_INVALID_TELEM_RECORD;
+  }
+
+  // Walk the lengths once so telemRecordBlockNext never reads past the payload
+  uint16_t recordOffset = 0;
+  uint16_t recordsFound = 0;
+  while (recordOffset < payloadLen) {
+    uint8_t recordLen = payload[recordOffset];
+    if (recordLen == 0 || recordLen > MAX_TELEMETRY_DATA_SIZE ||
+        recordOffset + TELEM_RECORD_LENGTH_SIZE + recordLen > payloadLen) {
+      return OBC_GS_ERR_CODE_INVALID_TELEM_RECORD;
+    }
+    recordOffset += TELEM_RECORD_LENGTH_SIZE + recordLen;
+    recordsFound++;
+  }
+
+  if (recordsFound != numRecords) {
+    return OBC_GS_ERR_CODE_INVALID_TELEM_RECORD;
+  }
+
+  block->payloadLen = payloadLen;
+  block->numRecords = numRecords;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+bool telemRecordBlockNext(const telemetry_record_block_t *block, uint16_t *offset, const uint8_t **record,
+                          uint8_t *recordLen) {
+  if (block == NULL || offset == NULL || record == NULL || recordLen == NULL || *offset >= block->payloadLen) {
+    return false;
+  }
+
+  const uint8_t *payload = TELEM_RECORD_PAYLOAD(block);
+  *recordLen = payload[*offset];
+  *record = &payload[*offset + TELEM_RECORD_LENGTH_SIZE];
+  *offset += TELEM_RECORD_LENGTH_SIZE + *recordLen;
+
+  return true;
+}
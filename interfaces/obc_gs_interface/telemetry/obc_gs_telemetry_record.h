@@ -0,0 +1,95 @@
+#pragma once
+
+#include "obc_gs_errors.h"
+#include "obc_gs_telemetry_data.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Telemetry is stored in blocks of records. A record is a one byte length followed by the telemetry point exactly as
+ * packTelemetry encodes it for the downlink, so the downlink builds packets from stored telemetry without repacking.
+ *
+ * Block layout (multi-byte fields are big endian, like the rest of the packed data):
+ *   magic (1B) | version (1B) | number of records (1B) | payload length (2B) | CRC-16-CCITT of the payload (2B)
+ *   followed by the payload: length (1B) | packed telemetry (length B), repeated for every record
+ *
+ * A full block is one 512B SD card sector.
+ */
+#define TELEM_RECORD_BLOCK_MAGIC 0x54U
+#define TELEM_RECORD_FORMAT_VERSION 1U
+
+#define TELEM_RECORD_BLOCK_HEADER_SIZE 7U
+#define TELEM_RECORD_BLOCK_SIZE 512U
+#define TELEM_RECORD_BLOCK_MAX_PAYLOAD_SIZE (TELEM_RECORD_BLOCK_SIZE - TELEM_RECORD_BLOCK_HEADER_SIZE)
+
+#define TELEM_RECORD_LENGTH_SIZE 1U
+
+typedef struct {
+  uint8_t data[TELEM_RECORD_BLOCK_SIZE];  // Header followed by the payload
+  uint16_t payloadLen;
+  uint8_t numRecords;
+} telemetry_record_block_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Empty a block so records can be appended to it
+ *
+ * @param block The block to reset
+ */
+void telemRecordBlockInit(telemetry_record_block_t *block);
+
+/**
+ * @brief Pack a telemetry point and append it to a block
+ *
+ * @param block The block to append to
+ * @param data The telemetry point to append
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_BUFF_TOO_SMALL if the block has no room for the record; the block is
+ * left unchanged so the caller can store it and append the record to an empty block
+ */
+obc_gs_error_code_t telemRecordBlockAppend(telemetry_record_block_t *block, const telemetry_data_t *data);
+
+/**
+ * @brief Write the header of a block
+ *
+ * @param block The block to finish
+ * @param blockLen Set to the number of bytes of block->data to store (header and payload)
+ */
+obc_gs_error_code_t telemRecordBlockFinish(telemetry_record_block_t *block, uint16_t *blockLen);
+
+/**
+ * @brief Check a stored block header and get the length of the payload that follows it
+ *
+ * @param header TELEM_RECORD_BLOCK_HEADER_SIZE bytes read from storage
+ * @param payloadLen Set to the number of payload bytes that follow the header
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_TELEM_RECORD if the header is not a valid block header
+ */
+obc_gs_error_code_t telemRecordParseHeader(const uint8_t *header, uint16_t *payloadLen);
+
+/**
+ * @brief Check a block read back from storage
+ *
+ * @param block A block with the header and the payload length given by telemRecordParseHeader in block->data
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_TELEM_RECORD if the header, the CRC or a record length is bad
+ */
+obc_gs_error_code_t telemRecordBlockLoad(telemetry_record_block_t *block);
+
+/**
+ * @brief Get the next packed telemetry point of a loaded block
+ *
+ * @param block A block checked by telemRecordBlockLoad, or one being built
+ * @param offset Payload offset of the next record; start at 0, advanced past the returned record
+ * @param record Set to the packed telemetry point, which unpackTelemetry can decode
+ * @param recordLen Set to the length of the packed telemetry point
+ * @return bool - false once every record has been returned
+ */
+bool telemRecordBlockNext(const telemetry_record_block_t *block, uint16_t *offset, const uint8_t **record,
+                          uint8_t *recordLen);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,16 +1,26 @@
 #include "obc_gs_telemetry_unpack.h"
 #include "obc_gs_telemetry_data.h"
 #include "obc_gs_telemetry_id.h"
+#include "data_pack_utils.h"
 #include "data_unpack_utils.h"
 #include "obc_gs_errors.h"
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 /* Declare all unpack functions for telemetry data */
 static void unpackObcTemp(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
 static void unpackObcState(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
 static void unpackPong(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
+static void unpackGncStartLatencyHist(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
+static void unpackGncExecTimeHist(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
+static void unpackGncDeadlineMisses(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
+
+static obc_gs_error_code_t unpackBounded(const uint8_t *buffer, uint32_t buffLen, uint32_t *offset, bool valueOnly,
+                                         telemetry_data_t *data);
+static bool varintToXorDelta(uint64_t varint, uint32_t *delta);
 
 typedef void (*telemetry_unpack_func_t)(const uint8_t *, uint32_t *, telemetry_data_t *);
 
@@ -18,6 +28,9 @@ static const telemetry_unpack_func_t telemUnpackFns[] = {
     [TELEM_OBC_TEMP] = unpackObcTemp,
     [TELEM_OBC_STATE] = unpackObcState,
     [TELEM_PONG] = unpackPong,
+    [TELEM_GNC_START_LATENCY_HIST] = unpackGncStartLatencyHist,
+    [TELEM_GNC_EXEC_TIME_HIST] = unpackGncExecTimeHist,
+    [TELEM_GNC_DEADLINE_MISSES] = unpackGncDeadlineMisses,
 };
 
 #define NUM_UNPACK_FNS (sizeof(telemUnpackFns) / sizeof(telemUnpackFns[0]))
@@ -49,6 +62,152 @@ obc_gs_error_code_t unpackTelemetry(const uint8_t *buffer, uint32_t *offset, tel
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
+obc_gs_error_code_t unpackTelemetryPacket(const uint8_t *buffer, uint32_t buffLen, telemetry_data_t *data,
+                                          uint32_t maxData, uint32_t *numUnpacked) {
+  if (buffer == NULL || data == NULL || numUnpacked == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  *numUnpacked = 0;
+
+  if (buffLen == 0) {
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  uint32_t offset = 0;
+  bool isCompressed = (buffer[0] == TELEM_COMPRESSED_PACKET_MARKER);
+
+  uint32_t prevTimestamp = 0;
+  uint32_t prevValues[NUM_TELEMETRY_DATA_IDS] = {0};
+  if (isCompressed) {
+    if (buffLen < TELEM_COMPRESSED_HEADER_SIZE) {
+      return OBC_GS_ERR_CODE_INVALID_ARG;
+    }
+    offset++;
+    prevTimestamp = unpackUint32(buffer, &offset);
+  }
+
+  // Zero bytes pad the packet after its last item
+  while (offset < buffLen && buffer[offset] != TELEM_NONE) {
+    if (*numUnpacked == maxData) {
+      return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+    }
+
+    telemetry_data_t *point = &data[*numUnpacked];
+    memset(point, 0, sizeof(*point));
+
+    if (!isCompressed) {
+      obc_gs_error_code_t errCode = unpackBounded(buffer, buffLen, &offset, false, point);
+      if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+        return errCode;
+      }
+      (*numUnpacked)++;
+      continue;
+    }
+
+    uint8_t id = unpackUint8(buffer, &offset);
+    if (id >= NUM_UNPACK_FNS || telemUnpackFns[id] == NULL) {
+      return OBC_GS_ERR_CODE_INVALID_ARG;
+    }
+    point->id = (telemetry_data_id_t)id;
+
+    int64_t timestampDelta = 0;
+    if (!unpackVarInt64(buffer, buffLen, &offset, &timestampDelta)) {
+      return OBC_GS_ERR_CODE_INVALID_ARG;
+    }
+    prevTimestamp = (uint32_t)((int64_t)prevTimestamp + timestampDelta);
+    point->timestamp = prevTimestamp;
+
+    if (TELEM_IS_XOR_DELTA_ENCODED(id)) {
+      uint64_t varint = 0;
+      uint32_t delta = 0;
+      if (!unpackVarUint64(buffer, buffLen, &offset, &varint) || !varintToXorDelta(varint, &delta)) {
+        return OBC_GS_ERR_CODE_INVALID_ARG;
+      }
+      prevValues[id] ^= delta;
+
+      // Unpack the value bits the same way as a plain item so each ID keeps its own union member
+      uint8_t valueBytes[sizeof(uint32_t)];
+      uint32_t valueOffset = 0;
+      packUint32(prevValues[id], valueBytes, &valueOffset);
+      valueOffset = 0;
+      telemUnpackFns[id](valueBytes, &valueOffset, point);
+    } else {
+      obc_gs_error_code_t errCode = unpackBounded(buffer, buffLen, &offset, true, point);
+      if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+        return errCode;
+      }
+    }
+
+    (*numUnpacked)++;
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Unpack a packTelemetry item, or just its value, without reading past the end of the packet
+ *
+ * @param buffer The packet
+ * @param buffLen The length of the packet
+ * @param offset Offset of the item or value; advanced past it
+ * @param valueOnly Unpack only the value of data->id instead of a whole item
+ * @param data The telemetry point to unpack into
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if the item is cut off or has an unknown ID
+ */
+static obc_gs_error_code_t unpackBounded(const uint8_t *buffer, uint32_t buffLen, uint32_t *offset, bool valueOnly,
+                                         telemetry_data_t *data) {
+  // Items are at most MAX_TELEMETRY_DATA_SIZE bytes, so only one near the end of the packet needs copying
+  uint8_t tail[MAX_TELEMETRY_DATA_SIZE] = {0};
+  uint32_t remaining = buffLen - *offset;
+  const uint8_t *item = &buffer[*offset];
+  if (remaining < MAX_TELEMETRY_DATA_SIZE) {
+    memcpy(tail, item, remaining);
+    item = tail;
+  }
+
+  uint32_t itemOffset = 0;
+  if (valueOnly) {
+    telemUnpackFns[data->id](item, &itemOffset, data);
+  } else {
+    obc_gs_error_code_t errCode = unpackTelemetry(item, &itemOffset, data);
+    if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+      return errCode;
+    }
+  }
+
+  if (itemOffset > remaining) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  *offset += itemOffset;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Undo the varint encoding of an XOR delta made when the packet was compressed
+ *
+ * @param varint The decoded varint
+ * @param delta Set to the XOR of the value with the previous value of its ID
+ * @return bool - false if the varint does not encode a 32-bit XOR
+ */
+static bool varintToXorDelta(uint64_t varint, uint32_t *delta) {
+  if (varint == 0) {
+    *delta = 0;
+    return true;
+  }
+
+  varint -= 1U;
+  uint32_t trailingZeros = (uint32_t)(varint & 0x1FU);
+  uint64_t highBits = varint >> 5;
+  if (highBits > ((uint64_t)UINT32_MAX >> (trailingZeros + 1U))) {
+    return false;
+  }
+
+  *delta = (uint32_t)(((highBits << 1) | 1U) << trailingZeros);
+  return true;
+}
+
 static void unpackObcTemp(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data) {
   data->obcTemp = unpackFloat(buffer, offset);
 }
@@ -60,3 +219,17 @@ static void unpackObcState(const uint8_t *buffer, uint32_t *offset, telemetry_da
 static void unpackPong(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data) {
   // Nothing to unpack
 }
+
+static void unpackGncStartLatencyHist(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data) {
+  data->gncStartLatencyBin.bin = unpackUint8(buffer, offset);
+  data->gncStartLatencyBin.cycles = unpackUint16(buffer, offset);
+}
+
+static void unpackGncExecTimeHist(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data) {
+  data->gncExecTimeBin.bin = unpackUint8(buffer, offset);
+  data->gncExecTimeBin.cycles = unpackUint16(buffer, offset);
+}
+
+static void unpackGncDeadlineMisses(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data) {
+  data->gncDeadlineMisses = unpackUint32(buffer, offset);
+}
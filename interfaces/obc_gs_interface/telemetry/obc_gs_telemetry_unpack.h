@@ -19,6 +19,20 @@ extern "C" {
  */
 obc_gs_error_code_t unpackTelemetry(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
 
+/**
+ * @brief Unpack every telemetry point of a downlinked telemetry packet, compressed or not
+ *
+ * @param buffer The packet to unpack
+ * @param buffLen The length of the packet
+ * @param data Array to unpack the telemetry points into
+ * @param maxData Number of entries in data
+ * @param numUnpacked Set to the number of telemetry points unpacked
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_BUFF_TOO_SMALL if data is full before the end of the packet,
+ * OBC_GS_ERR_CODE_INVALID_ARG if the packet is malformed
+ */
+obc_gs_error_code_t unpackTelemetryPacket(const uint8_t *buffer, uint32_t buffLen, telemetry_data_t *data,
+                                          uint32_t maxData, uint32_t *numUnpacked);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,19 +4,57 @@
 #include "CSerialPort/SerialPortInfo.h"
 #include "CSerialPort/iutils.hpp"
 
+#include <atomic>
 #include <vector>
 
 class CSPListener : public itas109::CSerialPortListener {
  public:
-  CSPListener(void *pSerialPort, pFunReadEvent pFun) : m_pSerialPort(pSerialPort), m_pFun(pFun){};
+  CSPListener(void *pSerialPort) : m_pSerialPort(pSerialPort), m_pFun(nullptr){};
+
+  void setCallback(pFunReadEvent pFun) { m_pFun = pFun; }
 
   void onReadEvent(const char *portName, unsigned int readBufferLen) {
-    m_pFun(m_pSerialPort, portName, readBufferLen);
+    pFunReadEvent pFun = m_pFun;
+    if (pFun) {
+      pFun(m_pSerialPort, portName, readBufferLen);
+    }
+  };
+
+ private:
+  void *m_pSerialPort;
+  std::atomic<pFunReadEvent> m_pFun;
+};
+
+class CSPSpanListener : public itas109::CSerialPortSpanListener {
+ public:
+  CSPSpanListener(void *pSerialPort) : m_pSerialPort(pSerialPort), m_pFun(nullptr){};
+
+  void setCallback(pFunReadSpanEvent pFun) { m_pFun = pFun; }
+
+  void onReadSpan(const char *portName, const char *data, unsigned int size) {
+    pFunReadSpanEvent pFun = m_pFun;
+    if (pFun) {
+      pFun(m_pSerialPort, portName, data, size);
+    }
   };
 
  private:
   void *m_pSerialPort;
-  pFunReadEvent m_pFun;
+  std::atomic<pFunReadSpanEvent> m_pFun;
+};
+
+// The listeners live in the handle, so connecting a callback allocates nothing and they are freed with the port
+class CSPHandle : public itas109::CSerialPort {
+ public:
+  CSPHandle()
+      : readListener(static_cast<itas109::CSerialPort *>(this)),
+        spanListener(static_cast<itas109::CSerialPort *>(this)){};
+
+  // Stop the read thread before the listeners it calls are destroyed
+  ~CSPHandle() { close(); }
+
+  CSPListener readListener;
+  CSPSpanListener spanListener;
 };
 
 void CSerialPortAvailablePortInfos(SerialPortInfoArray *portInfoArray) {
@@ -42,12 +80,12 @@ void CSerialPortAvailablePortInfosFree(struct SerialPortInfoArray *portInfoArray
   }
 }
 
-void *CSerialPortMalloc() { return new itas109::CSerialPort(); }
+void *CSerialPortMalloc() { return static_cast<itas109::CSerialPort *>(new CSPHandle()); }
 
 void CSerialPortFree(void *pSerialPort) {
   itas109::CSerialPort *pCSP = reinterpret_cast<itas109::CSerialPort *>(pSerialPort);
   if (pCSP) {
-    delete pCSP;
+    delete static_cast<CSPHandle *>(pCSP);
     pCSP = nullptr;
   }
 }
@@ -96,8 +134,8 @@ int CSerialPortIsOpen(void *pSerialPort) {
 int CSerialPortConnectReadEvent(void *pSerialPort, pFunReadEvent pFun) {
   itas109::CSerialPort *pCSP = reinterpret_cast<itas109::CSerialPort *>(pSerialPort);
   if (pCSP) {
-    // TODO: delete new CSPListener
-    CSPListener *listen = new CSPListener(pSerialPort, pFun);
+    CSPListener *listen = &static_cast<CSPHandle *>(pCSP)->readListener;
+    listen->setCallback(pFun);
     return pCSP->connectReadEvent(listen);
   }
 
@@ -113,6 +151,26 @@ int CSerialPortDisconnectReadEvent(void *pSerialPort) {
   return -1;
 }
 
+int CSerialPortConnectReadSpanEvent(void *pSerialPort, pFunReadSpanEvent pFun) {
+  itas109::CSerialPort *pCSP = reinterpret_cast<itas109::CSerialPort *>(pSerialPort);
+  if (pCSP) {
+    CSPSpanListener *listen = &static_cast<CSPHandle *>(pCSP)->spanListener;
+    listen->setCallback(pFun);
+    return pCSP->connectReadSpanEvent(listen);
+  }
+
+  return -1;
+}
+
+int CSerialPortDisconnectReadSpanEvent(void *pSerialPort) {
+  itas109::CSerialPort *pCSP = reinterpret_cast<itas109::CSerialPort *>(pSerialPort);
+  if (pCSP) {
+    return pCSP->disconnectReadSpanEvent();
+  }
+
+  return -1;
+}
+
 unsigned int CSerialPortGetReadBufferUsedLen(void *pSerialPort) {
   itas109::CSerialPort *pCSP = reinterpret_cast<itas109::CSerialPort *>(pSerialPort);
   if (pCSP) {
@@ -19,6 +19,7 @@ namespace itas109
 {
 class IMutex;
 class CSerialPortListener;
+class CSerialPortSpanListener;
 template <class T> class ITimer;
 } // namespace itas109
 
@@ -114,6 +115,28 @@ public:
      */
     int disconnectReadEvent();
 
+    /**
+     * @brief connect read span event, async mode on unix only 连接零拷贝读取事件(仅unix异步模式)
+     *
+     * While connected, received data is handed to the listener straight from the read buffer and never reaches
+     * readData or the read event.
+     *
+     * @param event [in] serial port span listener 串口零拷贝读取监听类
+     * @return return connect status 返回连接状态
+     * @retval 0 success 成功
+     * @retval 14 invalid parameter error 无效的参数
+     */
+    int connectReadSpanEvent(itas109::CSerialPortSpanListener *event);
+
+    /**
+     * @brief disconnect read span event 断开连接零拷贝读取事件
+     *
+     * @return return disconnect status 返回断开连接状态
+     * @retval 0 success 成功
+     * @retval [other] failed 失败
+     */
+    int disconnectReadSpanEvent();
+
     /**
      * @brief get used length of buffer 获取读取缓冲区已使用大小
      *
@@ -351,6 +374,7 @@ protected:
     unsigned int m_minByteReadNotify;                       ///< minimum byte of read notify 读取通知触发最小字节数
     itas109::IMutex *p_mutex;                               ///< mutex 互斥锁
     itas109::CSerialPortListener *p_readEvent;              ///< read event 读取事件
+    itas109::CSerialPortSpanListener *p_readSpanEvent;      ///< read span event 零拷贝读取事件
     itas109::ITimer<itas109::CSerialPortListener> *p_timer; ///< read timer 读取定时器
 private:
 };
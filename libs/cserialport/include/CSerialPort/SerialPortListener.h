@@ -35,5 +35,31 @@ public:
      */
     virtual void onReadEvent(const char *portName, unsigned int readBufferLen) = 0;
 };
+
+/**
+ * @brief the CSerialPortSpanListener class 串口零拷贝读取监听类
+ *
+ */
+class CSerialPortSpanListener
+{
+public:
+    /**
+     * @brief Destroy the CSerialPortSpanListener object 析构函数
+     *
+     */
+    virtual ~CSerialPortSpanListener() {}
+
+    /**
+     * @brief on read span 响应读取数据块
+     *
+     * Called from the read thread with data still in the read buffer, which is released when the call returns, so the
+     * data must be used or copied before then. Data that wraps around the end of the buffer arrives in two calls.
+     *
+     * @param portName [out] the port name 串口名称 Windows:COM1 Linux:/dev/ttyS0
+     * @param data [out] received data 接收数据
+     * @param size [out] received data length 接收数据长度
+     */
+    virtual void onReadSpan(const char *portName, const char *data, unsigned int size) = 0;
+};
 } // namespace itas109
 #endif //__CSERIALPORT_LISTENER_H__
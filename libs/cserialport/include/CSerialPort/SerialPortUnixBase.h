@@ -20,6 +20,7 @@
 #include <fcntl.h>     // File control definitions
 #include <unistd.h>    // UNIX standard function definitions
 #include <errno.h>     // Error number definitions
+#include <poll.h>      // poll
 
 #include "ithread.hpp"
 #include "ibuffer.hpp"
@@ -354,15 +355,10 @@ private:
     bool stopThreadMonitor();
 
     /**
-     * @brief read specified length data 读取指定长度数据
+     * @brief hand buffered data to the connected listener 通知监听者已接收数据
      *
-     * @param data [out] read data result 读取结果
-     * @param size [in] read length 读取长度
-     * @return return number Of bytes read 返回读取字节数
-     * @retval -1 read error 读取错误
-     * @retval [other] return number Of bytes read 返回读取字节数
      */
-    virtual int readDataUnix(void *data, int size);
+    void notifyRead();
 
 private:
     char m_portName[256];
@@ -379,6 +375,7 @@ private:
     itas109::i_thread_t m_monitorThread; /**< read thread */
 
     bool m_isThreadRunning;
+    int m_wakeupPipe[2]; ///< written to wake the read thread out of poll 用于唤醒读取线程
 
     itas109::RingBuffer<char> *p_buffer; ///< receive buffer
 };
@@ -10,6 +10,10 @@
 #ifndef __I_BUFFER_HPP__
 #define __I_BUFFER_HPP__
 
+#include <algorithm> // std::copy
+#include <atomic>
+#include <stddef.h> // NULL
+
 static unsigned int nextPowerOf2(unsigned int num)
 {
     // 2^30 = 1 << 30 = 1073741824
@@ -17,9 +21,7 @@ static unsigned int nextPowerOf2(unsigned int num)
     // unsigned int(Max PowerOf2) 2^31 = 1 << 31 = 2147483648
     // unsigned int(Max) 2^32 -1 = 4294967295
 
-    // because MSB(mirroring significant bit), so 2^30 not 2^31
-    // m_maxBufferSize = 1073741824;// 2^30
-    // m_maxMirrorBufferIndex = 2 * m_maxBufferSize - 1 = 2147483647
+    // the read and write counts of RingBuffer wrap at 2^32, which any power of two up to 2^30 divides
     if (num == 0 || num > 1073741824 /* 2^30 */)
     {
         return 4096;
@@ -101,7 +103,16 @@ public:
 };
 
 /**
- * @brief RingBuffer MSB(mirroring significant bit) 环形缓冲区(镜像指示位方式)
+ * @brief RingBuffer for one producer thread and one consumer thread 单生产者单消费者环形缓冲区
+ *
+ * head and tail count every element ever read and written and wrap around the unsigned int range, which the power of
+ * two buffer size divides, so used length is always tail - head. Only the producer moves tail and only the consumer
+ * moves head, and each publishes its index with release ordering after copying, so no lock is needed between the two.
+ * Data is copied in at most two contiguous blocks instead of element by element, and the span functions let either
+ * side work in place without any copy.
+ *
+ * A full buffer refuses new data rather than overwriting the oldest, since overwriting would move head from the
+ * producer.
  *
  * @tparam T
  */
@@ -116,7 +127,6 @@ public:
         : m_head(0)
         , m_tail(0)
         , m_maxBufferSize(4096) ///< must power of two
-        , m_maxMirrorBufferIndex(2 * m_maxBufferSize - 1)
         , m_buffer(new T[m_maxBufferSize])
     {
     }
@@ -130,7 +140,6 @@ public:
         : m_head(0)
         , m_tail(0)
         , m_maxBufferSize((maxBufferSize && (0 == (maxBufferSize & (maxBufferSize - 1)))) ? maxBufferSize : nextPowerOf2(maxBufferSize)) ///< must power of two
-        , m_maxMirrorBufferIndex(2 * m_maxBufferSize - 1)
         , m_buffer(new T[m_maxBufferSize])
     {
     }
@@ -149,29 +158,40 @@ public:
     }
 
     /**
-     * @brief write data to buffer 向缓冲区写数据
+     * @brief write data to buffer, producer only 向缓冲区写数据(仅生产者)
      *
      * @param data [in] write data 待写入数据
      * @param size [in] write data size 待写入大小
-     * @return return write data size 返回写入数据大小
+     * @return return write data size, less than size if the buffer fills 返回写入数据大小
      */
     virtual int write(const T *data, unsigned int size)
     {
-        for (unsigned int i = 0; i < size; i++)
+        unsigned int written = 0;
+
+        while (written < size)
         {
-            m_buffer[m_tail & (m_maxBufferSize - 1)] = data[i];
-            if (isFull())
+            T *span = NULL;
+            unsigned int len = getWriteSpan(&span);
+            if (0 == len)
             {
-                m_head = (m_head + 1) & m_maxMirrorBufferIndex; ///< head and tail pointers incrementation is done modulo 2*size
+                break;
             }
-            m_tail = (m_tail + 1) & m_maxMirrorBufferIndex;
+
+            if (len > size - written)
+            {
+                len = size - written;
+            }
+
+            std::copy(data + written, data + written + len, span);
+            commitWrite(len);
+            written += len;
         }
 
-        return size;
+        return written;
     }
 
     /**
-     * @brief read data from buffer 从缓冲区读数据
+     * @brief read data from buffer, consumer only 从缓冲区读数据(仅消费者)
      *
      * @param data [out] read data to save 待读取数据存储
      * @param size [in] read data size 待读取数据大小
@@ -181,24 +201,90 @@ public:
      */
     virtual int read(T *data, unsigned int size)
     {
-        if (isEmpty())
-        {
-            return 0;
-        }
+        unsigned int readLen = 0;
 
-        if (size > m_maxBufferSize)
+        while (readLen < size)
         {
-            size = m_maxBufferSize;
-        }
+            const T *span = NULL;
+            unsigned int len = getReadSpan(&span);
+            if (0 == len)
+            {
+                break;
+            }
 
-        for (unsigned int i = 0; i < size; i++)
-        {
-            *data = m_buffer[m_head & (m_maxBufferSize - 1)];
-            data++;
-            m_head = (m_head + 1) & m_maxMirrorBufferIndex;
+            if (len > size - readLen)
+            {
+                len = size - readLen;
+            }
+
+            std::copy(span, span + len, data + readLen);
+            consume(len);
+            readLen += len;
         }
 
-        return size;
+        return readLen;
+    }
+
+    /**
+     * @brief get the free space that can be written in place, producer only 获取可直接写入的连续空间(仅生产者)
+     *
+     * The free space may wrap around the end of the buffer, in which case only the part up to the end is returned and
+     * the rest follows after commitWrite.
+     *
+     * @param span [out] start of the free space 空闲空间起始地址
+     * @return return contiguous free length 返回连续空闲长度
+     */
+    unsigned int getWriteSpan(T **span)
+    {
+        unsigned int tail = m_tail.load(std::memory_order_relaxed);
+        unsigned int head = m_head.load(std::memory_order_acquire);
+        unsigned int offset = tail & (m_maxBufferSize - 1);
+        unsigned int unused = m_maxBufferSize - (tail - head);
+        unsigned int toEnd = m_maxBufferSize - offset;
+
+        *span = m_buffer + offset;
+        return unused < toEnd ? unused : toEnd;
+    }
+
+    /**
+     * @brief publish data written in place, producer only 提交直接写入的数据(仅生产者)
+     *
+     * @param size [in] written length, at most the length from getWriteSpan 已写入长度
+     */
+    void commitWrite(unsigned int size)
+    {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + size, std::memory_order_release);
+    }
+
+    /**
+     * @brief get the data that can be read in place, consumer only 获取可直接读取的连续数据(仅消费者)
+     *
+     * The data may wrap around the end of the buffer, in which case only the part up to the end is returned and the
+     * rest follows after consume.
+     *
+     * @param span [out] start of the data 数据起始地址
+     * @return return contiguous data length 返回连续数据长度
+     */
+    unsigned int getReadSpan(const T **span)
+    {
+        unsigned int head = m_head.load(std::memory_order_relaxed);
+        unsigned int tail = m_tail.load(std::memory_order_acquire);
+        unsigned int offset = head & (m_maxBufferSize - 1);
+        unsigned int used = tail - head;
+        unsigned int toEnd = m_maxBufferSize - offset;
+
+        *span = m_buffer + offset;
+        return used < toEnd ? used : toEnd;
+    }
+
+    /**
+     * @brief release data read in place, consumer only 释放直接读取的数据(仅消费者)
+     *
+     * @param size [in] read length, at most the length from getReadSpan 已读取长度
+     */
+    void consume(unsigned int size)
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + size, std::memory_order_release);
     }
 
     /**
@@ -209,7 +295,7 @@ public:
      */
     bool isFull()
     {
-        return m_tail == (m_head ^ m_maxBufferSize);
+        return getUsedLen() == m_maxBufferSize;
     }
 
     /**
@@ -220,7 +306,7 @@ public:
      */
     virtual bool isEmpty()
     {
-        return m_tail == m_head;
+        return getUsedLen() == 0;
     }
 
     /**
@@ -230,7 +316,7 @@ public:
      */
     virtual unsigned int getUsedLen()
     {
-        return (m_tail >= m_head) ? (m_tail - m_head) : (m_tail + 2 * m_maxBufferSize - m_head);
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
     }
 
     /**
@@ -254,11 +340,10 @@ public:
     }
 
 private:
-    unsigned int m_head;
-    unsigned int m_tail;
+    std::atomic<unsigned int> m_head; ///< written by the consumer only 仅消费者修改
+    std::atomic<unsigned int> m_tail; ///< written by the producer only 仅生产者修改
 
-    unsigned int m_maxBufferSize;        ///< must power of two 必须为2的幂
-    unsigned int m_maxMirrorBufferIndex; ///< 2 * m_maxBuffSize - 1
+    unsigned int m_maxBufferSize; ///< must power of two 必须为2的幂
     T *m_buffer;
 };
 } // namespace itas109
@@ -80,6 +80,10 @@ extern "C" {
 #endif
 typedef void (*pFunReadEvent)(void * /*pSerialPort*/, const char * /*portName*/, unsigned int /*readBufferLen*/);
 
+// data points into the read buffer and is only valid during the call
+typedef void (*pFunReadSpanEvent)(void * /*pSerialPort*/, const char * /*portName*/, const char * /*data*/,
+                                  unsigned int /*size*/);
+
 C_DLL_EXPORT void CSerialPortAvailablePortInfos(struct SerialPortInfoArray *portInfoArray);
 
 C_DLL_EXPORT void CSerialPortAvailablePortInfosFree(struct SerialPortInfoArray *portInfoArray);
@@ -104,6 +108,10 @@ C_DLL_EXPORT int CSerialPortConnectReadEvent(void *pSerialPort, pFunReadEvent pF
 
 C_DLL_EXPORT int CSerialPortDisconnectReadEvent(void *pSerialPort);
 
+C_DLL_EXPORT int CSerialPortConnectReadSpanEvent(void *pSerialPort, pFunReadSpanEvent pFun);
+
+C_DLL_EXPORT int CSerialPortDisconnectReadSpanEvent(void *pSerialPort);
+
 C_DLL_EXPORT unsigned int CSerialPortGetReadBufferUsedLen(void *pSerialPort);
 
 C_DLL_EXPORT int CSerialPortReadData(void *pSerialPort, void *data, int size);
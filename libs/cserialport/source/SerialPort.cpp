@@ -123,6 +123,30 @@ int itas109::CSerialPort::disconnectReadEvent()
     }
 }
 
+int itas109::CSerialPort::connectReadSpanEvent(itas109::CSerialPortSpanListener *event)
+{
+    if (p_serialPortBase)
+    {
+        return p_serialPortBase->connectReadSpanEvent(event);
+    }
+    else
+    {
+        return itas109::ErrorNullPointer;
+    }
+}
+
+int itas109::CSerialPort::disconnectReadSpanEvent()
+{
+    if (p_serialPortBase)
+    {
+        return p_serialPortBase->disconnectReadSpanEvent();
+    }
+    else
+    {
+        return itas109::ErrorNullPointer;
+    }
+}
+
 unsigned int itas109::CSerialPort::getReadBufferUsedLen() const
 {
     if (p_serialPortBase)
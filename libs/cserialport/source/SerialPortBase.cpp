@@ -9,6 +9,7 @@ CSerialPortBase::CSerialPortBase()
     , m_minByteReadNotify(1)
     , p_mutex(NULL)
     , p_readEvent(NULL)
+    , p_readSpanEvent(NULL)
     , p_timer(NULL)
 {
     p_mutex = new itas109::IMutex();
@@ -22,6 +23,7 @@ CSerialPortBase::CSerialPortBase(const char *portName)
     , m_minByteReadNotify(1)
     , p_mutex(NULL)
     , p_readEvent(NULL)
+    , p_readSpanEvent(NULL)
     , p_timer(NULL)
 
 {
@@ -136,4 +138,23 @@ int CSerialPortBase::disconnectReadEvent()
 {
     p_readEvent = NULL;
     return itas109::ErrorOK;
+}
+
+int CSerialPortBase::connectReadSpanEvent(itas109::CSerialPortSpanListener *event)
+{
+    if (event)
+    {
+        p_readSpanEvent = event;
+        return itas109::ErrorOK;
+    }
+    else
+    {
+        return itas109::ErrorInvalidParam;
+    }
+}
+
+int CSerialPortBase::disconnectReadSpanEvent()
+{
+    p_readSpanEvent = NULL;
+    return itas109::ErrorOK;
 }
\ No newline at end of file
@@ -1,4 +1,4 @@
-#include <unistd.h> // usleep
+#include <unistd.h> // pipe
 
 #include "CSerialPort/SerialPortUnixBase.h"
 #include "CSerialPort/SerialPortListener.h"
@@ -45,6 +45,7 @@ CSerialPortUnixBase::CSerialPortUnixBase()
     , m_flowControl(itas109::FlowNone)
     , m_readBufferSize(4096)
     , m_isThreadRunning(false)
+    , m_wakeupPipe()
     , p_buffer(new itas109::RingBuffer<char>(m_readBufferSize))
 {
     itas109::IUtils::strncpy(m_portName, "", 1);
@@ -59,6 +60,7 @@ CSerialPortUnixBase::CSerialPortUnixBase(const char *portName)
     , m_flowControl(itas109::FlowNone)
     , m_readBufferSize(4096)
     , m_isThreadRunning(false)
+    , m_wakeupPipe()
     , p_buffer(new itas109::RingBuffer<char>(m_readBufferSize))
 {
     itas109::IUtils::strncpy(m_portName, portName, 256);
@@ -281,68 +283,78 @@ int CSerialPortUnixBase::uartSet(int fd, int baudRate, itas109::Parity parity, i
     return 0;
 }
 
+// How long the read thread leaves the port alone while the read buffer is full, or after the port hung up, before
+// looking at it again
+static const int FULL_BUFFER_RETRY_MS = 5;
+static const int HANGUP_RETRY_MS = 100;
+
 void *CSerialPortUnixBase::commThreadMonitor(void *pParam)
 {
     // Cast the void pointer passed to the thread back to
-    // a pointer of CSerialPortWinBase class
+    // a pointer of CSerialPortUnixBase class
     CSerialPortUnixBase *p_base = (CSerialPortUnixBase *)pParam;
 
     if (p_base)
     {
+        struct pollfd fds[2];
+        fds[1].fd = p_base->m_wakeupPipe[0];
+        fds[1].events = POLLIN;
+
+        bool isHangup = false;
+
         for (; p_base->isThreadRunning();)
         {
-            int readbytes = 0;
+            // Sleep until data arrives or stopThreadMonitor wakes the thread. A port left out of the poll keeps its data
+            // in the kernel until the buffer has room again.
+            int timeoutMS = -1;
+            fds[0].fd = p_base->fd;
+            fds[0].events = POLLIN;
+            if (isHangup)
+            {
+                fds[0].fd = -1;
+                timeoutMS = HANGUP_RETRY_MS;
+                isHangup = false;
+            }
+            else if (p_base->p_buffer->isFull())
+            {
+                fds[0].fd = -1;
+                timeoutMS = FULL_BUFFER_RETRY_MS;
+            }
+
+            if (poll(fds, 2, timeoutMS) < 0)
+            {
+                continue; // EINTR
+            }
 
-            // read前获取可读的字节数,不区分阻塞和非阻塞
-            ioctl(p_base->fd, FIONREAD, &readbytes);
-            if (readbytes >= p_base->getMinByteReadNotify()) // 设定字符数，默认为1
+            if (fds[1].revents & POLLIN)
             {
-                char *data = NULL;
-                data = new char[readbytes];
-                if (data)
+                continue; // woken to stop
+            }
+
+            if (fds[0].revents & POLLIN)
+            {
+                // read straight into the buffer, as much as is contiguous
+                char *span = NULL;
+                unsigned int spanLen = p_base->p_buffer->getWriteSpan(&span);
+                int len = read(p_base->fd, span, spanLen);
+                if (len > 0)
                 {
-                    if (p_base->p_buffer)
-                    {
-                        int len = p_base->readDataUnix(data, readbytes);
-                        p_base->p_buffer->write(data, len);
 #ifdef CSERIALPORT_DEBUG
-                        char hexStr[201]; // 100*2 + 1
-                        LOG_INFO("write buffer(usedLen %u). len: %d, hex(top100): %s", p_base->p_buffer->getUsedLen(), len,
-                                 itas109::IUtils::charToHexStr(hexStr, data, len > 100 ? 100 : len));
-#endif
-
-                        if (p_base->p_readEvent)
-                        {
-                            unsigned int readIntervalTimeoutMS = p_base->getReadIntervalTimeout();
-                            if (readIntervalTimeoutMS > 0)
-                            {
-                                if (p_base->p_timer)
-                                {
-                                    if (p_base->p_timer->isRunning())
-                                    {
-                                        p_base->p_timer->stop();
-                                    }
-
-                                    LOG_INFO("onReadEvent. portName: %s, readLen: %u", p_base->getPortName(), p_base->p_buffer->getUsedLen());
-                                    p_base->p_timer->startOnce(readIntervalTimeoutMS, p_base->p_readEvent, &itas109::CSerialPortListener::onReadEvent, p_base->getPortName(),
-                                                               p_base->p_buffer->getUsedLen());
-                                }
-                            }
-                            else
-                            {
-                                LOG_INFO("onReadEvent. portName: %s, readLen: %u", p_base->getPortName(), p_base->p_buffer->getUsedLen());
-                                p_base->p_readEvent->onReadEvent(p_base->getPortName(), p_base->p_buffer->getUsedLen());
-                            }
-                        }
-                    }
-
-                    delete[] data;
-                    data = NULL;
+                    char hexStr[201]; // 100*2 + 1
+                    LOG_INFO("write buffer(usedLen %u). len: %d, hex(top100): %s", p_base->p_buffer->getUsedLen() + len, len,
+                             itas109::IUtils::charToHexStr(hexStr, span, len > 100 ? 100 : len));
+#endif
+                    p_base->p_buffer->commitWrite(len);
+                    p_base->notifyRead();
+                }
+                else if (len == 0 || (errno != EAGAIN && errno != EINTR))
+                {
+                    isHangup = true;
                 }
             }
-            else
+            else if (fds[0].revents & (POLLHUP | POLLERR | POLLNVAL))
             {
-                usleep(1); // fix high cpu usage on unix
+                isHangup = true;
             }
         }
     }
@@ -354,27 +366,92 @@ void *CSerialPortUnixBase::commThreadMonitor(void *pParam)
     pthread_exit(NULL);
 }
 
+void CSerialPortUnixBase::notifyRead()
+{
+    if (p_buffer->getUsedLen() < getMinByteReadNotify()) // 设定字符数，默认为1
+    {
+        return;
+    }
+
+    itas109::CSerialPortSpanListener *readSpanEvent = p_readSpanEvent;
+    if (readSpanEvent)
+    {
+        const char *span = NULL;
+        unsigned int spanLen = 0;
+        while ((spanLen = p_buffer->getReadSpan(&span)) > 0)
+        {
+            readSpanEvent->onReadSpan(getPortName(), span, spanLen);
+            p_buffer->consume(spanLen);
+        }
+    }
+    else if (p_readEvent)
+    {
+        unsigned int readIntervalTimeoutMS = getReadIntervalTimeout();
+        if (readIntervalTimeoutMS > 0)
+        {
+            if (p_timer)
+            {
+                if (p_timer->isRunning())
+                {
+                    p_timer->stop();
+                }
+
+                LOG_INFO("onReadEvent. portName: %s, readLen: %u", getPortName(), p_buffer->getUsedLen());
+                p_timer->startOnce(readIntervalTimeoutMS, p_readEvent, &itas109::CSerialPortListener::onReadEvent, getPortName(), p_buffer->getUsedLen());
+            }
+        }
+        else
+        {
+            LOG_INFO("onReadEvent. portName: %s, readLen: %u", getPortName(), p_buffer->getUsedLen());
+            p_readEvent->onReadEvent(getPortName(), p_buffer->getUsedLen());
+        }
+    }
+}
+
 bool CSerialPortUnixBase::startThreadMonitor()
 {
-    bool bRet = true;
+    if (0 != pipe(m_wakeupPipe))
+    {
+        printf("Create wakeup pipe error.");
+        return false;
+    }
+
+    m_isThreadRunning = true;
 
     // start read thread
     if (0 != itas109::i_thread_create(&m_monitorThread, NULL, commThreadMonitor, (void *)this))
     {
-        bRet = false;
-
         printf("Create read thread error.");
+
+        m_isThreadRunning = false;
+        close(m_wakeupPipe[0]);
+        close(m_wakeupPipe[1]);
+        return false;
     }
 
-    return bRet;
+    return true;
 }
 
 bool CSerialPortUnixBase::stopThreadMonitor()
 {
+    if (!m_isThreadRunning)
+    {
+        return true;
+    }
+
     m_isThreadRunning = false;
 
+    char wakeup = 0;
+    if (write(m_wakeupPipe[1], &wakeup, 1) != 1)
+    {
+        perror("wakeup read thread error");
+    }
+
     itas109::i_thread_join(m_monitorThread);
 
+    close(m_wakeupPipe[0]);
+    close(m_wakeupPipe[1]);
+
     return true;
 }
 
@@ -405,17 +482,20 @@ bool CSerialPortUnixBase::openPort()
                 bRet = false;
                 m_lastError = itas109::/*SerialPortError::*/ ErrorInvalidParam;
             }
-            else
+            else if (m_operateMode == itas109::/*OperateMode::*/ AsynchronousOperate)
             {
-                m_isThreadRunning = true;
                 bRet = startThreadMonitor();
 
                 if (!bRet)
                 {
-                    m_isThreadRunning = false;
                     m_lastError = itas109::/*SerialPortError::*/ ErrorInner;
                 }
             }
+            else
+            {
+                // sync reads go straight to the port, a read thread would take their data
+                bRet = true;
+            }
         }
         else
         {
@@ -492,25 +572,6 @@ unsigned int CSerialPortUnixBase::getReadBufferUsedLen() const
     return usedLen;
 }
 
-int CSerialPortUnixBase::readDataUnix(void *data, int size)
-{
-    itas109::IAutoLock lock(p_mutex);
-
-    int iRet = -1;
-
-    if (isOpen())
-    {
-        iRet = read(fd, data, size);
-    }
-    else
-    {
-        m_lastError = itas109::/*SerialPortError::*/ ErrorNotOpen;
-        iRet = -1;
-    }
-
-    return iRet;
-}
-
 int CSerialPortUnixBase::readData(void *data, int size)
 {
     itas109::IAutoLock lock(p_mutex);
@@ -0,0 +1,78 @@
+/*
+ * Academic License - for use in teaching, academic research, and meeting
+ * course requirements at degree granting institutions only.  Not for
+ * government, commercial, or other organizational use.
+ *
+ * File: attitude_control_single.h
+ *
+ * Single-precision variant of the code generated for Simulink model
+ * 'attitude_control' (see attitude_control.h). Every signal, constant and
+ * math call is real32_T so the step runs without double-precision
+ * arithmetic. attitude_control.c remains the reference implementation.
+ *
+ * Model version                  : 3.78
+ * Simulink Coder version         : 9.9 (R2023a) 19-Nov-2022
+ *
+ * Target selection: ert.tlc
+ * Embedded hardware selection: ARM Compatible->ARM Cortex-R
+ * Code generation objectives:
+ *    1. Execution efficiency
+ *    2. RAM efficiency
+ * Validation result: Not run
+ */
+
+#ifndef RTW_HEADER_attitude_control_single_h_
+#define RTW_HEADER_attitude_control_single_h_
+#ifndef attitude_control_single_COMMON_INCLUDES_
+#define attitude_control_single_COMMON_INCLUDES_
+#include "rtwtypes.h"
+#include "rtw_continuous.h"
+#include "rtw_solver.h"
+#endif                          /* attitude_control_single_COMMON_INCLUDES_ */
+
+/* Forward declaration for rtModel */
+typedef struct tag_RTM_attitude_control_single RT_MODEL_attitude_control_single;
+
+/* External inputs (root inport signals with default storage) */
+typedef struct {
+  real32_T est_curr_ang_vel_body[3];   /* '<Root>/ang_vel_body' */
+  real32_T est_curr_quat_body[4];      /* '<Root>/curr_quat_body' */
+  real32_T com_quat_body[4];           /* '<Root>/com_quat_body' */
+  real32_T mag_field_body[3];          /* '<Root>/mag_field_body' */
+} attitude_control_single_model_ext_inputs_t;
+
+/* External outputs (root outports fed by signals with default storage) */
+typedef struct {
+  real32_T comm_wheel_torque_body[3];  /* '<Root>/comm_wheel_torque_body' */
+  real32_T comm_mag_dipole_body[3];    /* '<Root>/comm_mag_dipole_body' */
+} attitude_control_single_model_ext_outputs_t;
+
+/* Real-time Model Data Structure */
+struct tag_RTM_attitude_control_single {
+  const char_T * volatile errorStatus;
+};
+
+/* External inputs (root inport signals with default storage) */
+extern attitude_control_single_model_ext_inputs_t attitude_control_single_model_ext_inputs;
+
+/* External outputs (root outports fed by signals with default storage) */
+extern attitude_control_single_model_ext_outputs_t attitude_control_single_model_ext_outputs;
+
+/* Model entry point functions */
+extern void attitude_control_single_initialize(void);
+extern void attitude_control_single_step(void);
+
+/* Real-time Model object */
+extern RT_MODEL_attitude_control_single *const attitude_control_single_model_rt_object;
+
+/*-
+ * The block structure and hierarchy are those of attitude_control.h; refer to
+ * it to trace the code back to the model.
+ */
+#endif                             /* RTW_HEADER_attitude_control_single_h_ */
+
+/*
+ * File trailer for generated code.
+ *
+ * [EOF]
+ */
@@ -0,0 +1,149 @@
+/*
+ * Academic License - for use in teaching, academic research, and meeting
+ * course requirements at degree granting institutions only.  Not for
+ * government, commercial, or other organizational use.
+ *
+ * File: attitude_control_single.c
+ *
+ * Single-precision variant of the code generated for Simulink model
+ * 'attitude_control' (see attitude_control.c).
+ *
+ * Model version                  : 3.78
+ * Simulink Coder version         : 9.9 (R2023a) 19-Nov-2022
+ *
+ * Target selection: ert.tlc
+ * Embedded hardware selection: ARM Compatible->ARM Cortex-R
+ * Code generation objectives:
+ *    1. Execution efficiency
+ *    2. RAM efficiency
+ * Validation result: Not run
+ */
+
+#include "attitude_control_single.h"
+#include "rtwtypes.h"
+
+/* External inputs (root inport signals with default storage) */
+attitude_control_single_model_ext_inputs_t attitude_control_single_model_ext_inputs;
+
+/* External outputs (root outports fed by signals with default storage) */
+attitude_control_single_model_ext_outputs_t attitude_control_single_model_ext_outputs;
+
+/* Real-time model */
+static RT_MODEL_attitude_control_single rtM_;
+RT_MODEL_attitude_control_single *const attitude_control_single_model_rt_object = &rtM_;
+
+/* Model step function */
+void attitude_control_single_step(void)
+{
+  real32_T rtb_Product1;
+  real32_T rtb_Product2;
+  real32_T rtb_Product2_l;
+  real32_T rtb_Sign;
+  real32_T rtb_Sum_b;
+
+  /* Sum: '<S5>/Sum' incorporates:
+   *  Inport: '<Root>/com_quat_body'
+   *  Product: '<S5>/Product'
+   *  Product: '<S5>/Product1'
+   *  Product: '<S5>/Product2'
+   *  Product: '<S5>/Product3'
+   */
+  rtb_Product2_l = ((attitude_control_single_model_ext_inputs.com_quat_body[0] * attitude_control_single_model_ext_inputs.com_quat_body[0] +
+                     attitude_control_single_model_ext_inputs.com_quat_body[1] * attitude_control_single_model_ext_inputs.com_quat_body[1]) +
+                    attitude_control_single_model_ext_inputs.com_quat_body[2] * attitude_control_single_model_ext_inputs.com_quat_body[2]) +
+    attitude_control_single_model_ext_inputs.com_quat_body[3] * attitude_control_single_model_ext_inputs.com_quat_body[3];
+
+  /* Product: '<S2>/Divide' incorporates:
+   *  Inport: '<Root>/com_quat_body'
+   */
+  rtb_Sum_b = attitude_control_single_model_ext_inputs.com_quat_body[0] / rtb_Product2_l;
+
+  /* Product: '<S2>/Divide1' incorporates:
+   *  Inport: '<Root>/com_quat_body'
+   *  UnaryMinus: '<S4>/Unary Minus'
+   */
+  rtb_Product1 = -attitude_control_single_model_ext_inputs.com_quat_body[1] / rtb_Product2_l;
+
+  /* Product: '<S2>/Divide2' incorporates:
+   *  Inport: '<Root>/com_quat_body'
+   *  UnaryMinus: '<S4>/Unary Minus1'
+   */
+  rtb_Product2 = -attitude_control_single_model_ext_inputs.com_quat_body[2] / rtb_Product2_l;
+
+  /* Product: '<S2>/Divide3' incorporates:
+   *  Inport: '<Root>/com_quat_body'
+   *  UnaryMinus: '<S4>/Unary Minus2'
+   */
+  rtb_Product2_l = -attitude_control_single_model_ext_inputs.com_quat_body[3] / rtb_Product2_l;
+
+  /* Sum: '<S6>/Sum' incorporates:
+   *  Inport: '<Root>/curr_quat_body'
+   *  Product: '<S6>/Product'
+   *  Product: '<S6>/Product1'
+   *  Product: '<S6>/Product2'
+   *  Product: '<S6>/Product3'
+   */
+  rtb_Sign = ((rtb_Sum_b * attitude_control_single_model_ext_inputs.est_curr_quat_body[0] - rtb_Product1 *
+               attitude_control_single_model_ext_inputs.est_curr_quat_body[1]) - rtb_Product2 *
+              attitude_control_single_model_ext_inputs.est_curr_quat_body[2]) - rtb_Product2_l *
+    attitude_control_single_model_ext_inputs.est_curr_quat_body[3];
+
+  /* Signum: '<S1>/Sign' (a NaN input is passed through as NaN) */
+  if (rtb_Sign < 0.0F) {
+    rtb_Sign = -1.0F;
+  } else if (rtb_Sign > 0.0F) {
+    rtb_Sign = 1.0F;
+  } else if (rtb_Sign == 0.0F) {
+    rtb_Sign = 0.0F;
+  }
+
+  /* End of Signum: '<S1>/Sign' */
+
+  /* Outport: '<Root>/comm_wheel_torque_body' incorporates:
+   *  Gain: '<S1>/k_d'
+   *  Gain: '<S1>/k_p'
+   *  Inport: '<Root>/ang_vel_body'
+   *  Inport: '<Root>/curr_quat_body'
+   *  Product: '<S1>/Product'
+   *  Product: '<S7>/Product'
+   *  Product: '<S7>/Product1'
+   *  Product: '<S7>/Product2'
+   *  Product: '<S7>/Product3'
+   *  Product: '<S8>/Product'
+   *  Product: '<S8>/Product1'
+   *  Product: '<S8>/Product2'
+   *  Product: '<S8>/Product3'
+   *  Product: '<S9>/Product'
+   *  Product: '<S9>/Product1'
+   *  Product: '<S9>/Product2'
+   *  Product: '<S9>/Product3'
+   *  Sum: '<S1>/Sum6'
+   *  Sum: '<S7>/Sum'
+   *  Sum: '<S8>/Sum'
+   *  Sum: '<S9>/Sum'
+   */
+  attitude_control_single_model_ext_outputs.comm_wheel_torque_body[0] = (((rtb_Sum_b * attitude_control_single_model_ext_inputs.est_curr_quat_body[1] +
+    rtb_Product1 * attitude_control_single_model_ext_inputs.est_curr_quat_body[0]) + rtb_Product2 *
+    attitude_control_single_model_ext_inputs.est_curr_quat_body[3]) - rtb_Product2_l * attitude_control_single_model_ext_inputs.est_curr_quat_body[2]) *
+    0.2F * rtb_Sign + 0.1F * attitude_control_single_model_ext_inputs.est_curr_ang_vel_body[0];
+  attitude_control_single_model_ext_outputs.comm_wheel_torque_body[1] = (((rtb_Sum_b * attitude_control_single_model_ext_inputs.est_curr_quat_body[2] -
+    rtb_Product1 * attitude_control_single_model_ext_inputs.est_curr_quat_body[3]) + rtb_Product2 *
+    attitude_control_single_model_ext_inputs.est_curr_quat_body[0]) + rtb_Product2_l * attitude_control_single_model_ext_inputs.est_curr_quat_body[1]) *
+    0.2F * rtb_Sign + 0.1F * attitude_control_single_model_ext_inputs.est_curr_ang_vel_body[1];
+  attitude_control_single_model_ext_outputs.comm_wheel_torque_body[2] = (((rtb_Sum_b * attitude_control_single_model_ext_inputs.est_curr_quat_body[3] +
+    rtb_Product1 * attitude_control_single_model_ext_inputs.est_curr_quat_body[2]) - rtb_Product2 *
+    attitude_control_single_model_ext_inputs.est_curr_quat_body[1]) + rtb_Product2_l * attitude_control_single_model_ext_inputs.est_curr_quat_body[0]) *
+    0.2F * rtb_Sign + 0.1F * attitude_control_single_model_ext_inputs.est_curr_ang_vel_body[2];
+}
+
+/* Model initialize function */
+void attitude_control_single_initialize(void)
+{
+  /* (no initialization code required) */
+}
+
+/*
+ * File trailer for generated code.
+ *
+ * [EOF]
+ */
@@ -0,0 +1,106 @@
+/*
+ * Academic License - for use in teaching, academic research, and meeting
+ * course requirements at degree granting institutions only.  Not for
+ * government, commercial, or other organizational use.
+ *
+ * File: attitude_determination_and_vehi_single.h
+ *
+ * Single-precision variant of the code generated for Simulink model
+ * 'attitude_determination_and_vehi' (see attitude_determination_and_vehi.h).
+ * Every signal, state, constant and math call is real32_T so the step runs
+ * without double-precision arithmetic. attitude_determination_and_vehi.c
+ * remains the reference implementation.
+ *
+ * Model version                  : 3.78
+ * Simulink Coder version         : 9.9 (R2023a) 19-Nov-2022
+ *
+ * Target selection: ert.tlc
+ * Embedded hardware selection: ARM Compatible->ARM Cortex-R
+ * Code generation objectives:
+ *    1. Execution efficiency
+ *    2. RAM efficiency
+ * Validation result: Not run
+ */
+
+#ifndef RTW_HEADER_attitude_determination_and_vehi_single_h_
+#define RTW_HEADER_attitude_determination_and_vehi_single_h_
+#ifndef attitude_determination_and_vehi_single_COMMON_INCLUDES_
+#define attitude_determination_and_vehi_single_COMMON_INCLUDES_
+#include "rtwtypes.h"
+#include "rtw_continuous.h"
+#include "rtw_solver.h"
+#endif             /* attitude_determination_and_vehi_single_COMMON_INCLUDES_ */
+
+/* Forward declaration for rtModel */
+typedef struct tag_RTM_attitude_determination_single RT_MODEL_attitude_determination_single;
+
+/* Block signals and states (default storage) for system '<Root>' */
+typedef struct {
+  real32_T P_o[36];                    /* '<S1>/Data Store Memory' */
+  real32_T q_n2m[4];                   /* '<S1>/Data Store Memory1' */
+  real32_T beta[3];                    /* '<S1>/Data Store Memory2' */
+} DW_single;
+
+/* Constant parameters (default storage) */
+typedef struct {
+  /* Expression: diag([1*ones(1,3), 1*ones(1,3)])
+   * Referenced by: '<S1>/Data Store Memory'
+   */
+  real32_T DataStoreMemory_InitialValue[36];
+} ConstP_single;
+
+/* External inputs (root inport signals with default storage) */
+typedef struct {
+  real32_T earth_mag_field_ref[3];     /* '<Root>/earth_mag_field_ref' */
+  real32_T sat_to_sun_unit_ref[3];     /* '<Root>/sat_to_sun_unit_ref' */
+  real32_T omega[3];                   /* '<Root>/omega' */
+  real32_T mes_ss[3];                  /* '<Root>/mes_ss' */
+  real32_T r_sat_com_ax1[3];           /* '<Root>/r_sat_com' */
+  real32_T mes_mag[3];                 /* '<Root>/mes_mag' */
+  real32_T ref_aam[3];                 /* '<Root>/ref_aam' */
+  real32_T mes_aam[3];                 /* '<Root>/mes_aam' */
+  real32_T steve_mes[3];               /* '<Root>/steve_mes' */
+} attitude_determination_single_model_ext_inputs_t;
+
+/* External outputs (root outports fed by signals with default storage) */
+typedef struct {
+  real32_T meas_ang_vel_body[3];       /* '<Root>/meas_ang_vel_body' */
+  real32_T meas_quat_body[4];          /* '<Root>/meas_quat_body' */
+} attitude_determination_single_model_ext_outputs_t;
+
+/* Real-time Model Data Structure */
+struct tag_RTM_attitude_determination_single {
+  const char_T * volatile errorStatus;
+};
+
+/* Block signals and states (default storage) */
+extern DW_single rtDWSingle;
+
+/* External inputs (root inport signals with default storage) */
+extern attitude_determination_single_model_ext_inputs_t attitude_determination_single_model_ext_inputs;
+
+/* External outputs (root outports fed by signals with default storage) */
+extern attitude_determination_single_model_ext_outputs_t attitude_determination_single_model_ext_outputs;
+
+/* Constant parameters (default storage) */
+extern const ConstP_single rtConstPSingle;
+
+/* Model entry point functions */
+extern void attitude_determination_and_vehi_single_initialize(void);
+extern void attitude_determination_and_vehi_single_step(void);
+
+/* Real-time Model object */
+extern RT_MODEL_attitude_determination_single *const attitude_determination_single_model_rt_object;
+
+/*-
+ * The block structure and hierarchy are those of
+ * attitude_determination_and_vehi.h; refer to it to trace the code back to
+ * the model.
+ */
+#endif                /* RTW_HEADER_attitude_determination_and_vehi_single_h_ */
+
+/*
+ * File trailer for generated code.
+ *
+ * [EOF]
+ */
@@ -0,0 +1,80 @@
+/*
+ * Academic License - for use in teaching, academic research, and meeting
+ * course requirements at degree granting institutions only.  Not for
+ * government, commercial, or other organizational use.
+ *
+ * File: onboard_env_modelling_single.h
+ *
+ * Single-precision variant of the code generated for Simulink model
+ * 'onboard_env_modelling' (see onboard_env_modelling.h). Every signal,
+ * constant and math call is real32_T so the step runs without
+ * double-precision arithmetic. onboard_env_modelling.c remains the
+ * reference implementation.
+ *
+ * Model version                  : 3.78
+ * Simulink Coder version         : 9.9 (R2023a) 19-Nov-2022
+ *
+ * Target selection: ert.tlc
+ * Embedded hardware selection: ARM Compatible->ARM Cortex-R
+ * Code generation objectives:
+ *    1. Execution efficiency
+ *    2. RAM efficiency
+ * Validation result: Not run
+ */
+
+#ifndef RTW_HEADER_onboard_env_modelling_single_h_
+#define RTW_HEADER_onboard_env_modelling_single_h_
+#ifndef onboard_env_modelling_single_COMMON_INCLUDES_
+#define onboard_env_modelling_single_COMMON_INCLUDES_
+#include "rtwtypes.h"
+#include "rtw_continuous.h"
+#include "rtw_solver.h"
+#endif                     /* onboard_env_modelling_single_COMMON_INCLUDES_ */
+
+/* Forward declaration for rtModel */
+typedef struct tag_RTM_onboard_model_single RT_MODEL_onboard_model_single;
+
+/* External inputs (root inport signals with default storage) */
+typedef struct {
+  real32_T commanded_mag_dipole_body[3]; /* '<Root>/magnetorquer comm' */
+  real32_T r_sat_com[3];               /* '<Root>/r_sat_com' */
+  real32_T r_sat_com_ax1[3];           /* '<Root>/r_sat_com_ax1' */
+  real32_T steve_values[2];            /* '<Root>/steve_values' */
+} onboard_env_single_model_ext_inputs_t;
+
+/* External outputs (root outports fed by signals with default storage) */
+typedef struct {
+  real32_T estimated_expect_ang_acc_body[3];
+                                    /* '<Root>/estimated_expect_ang_acc_body' */
+  real32_T r_ref_com_est[3];           /* '<Root>/r_ref_com_est' */
+} onboard_env_single_model_ext_outputs_t;
+
+/* Real-time Model Data Structure */
+struct tag_RTM_onboard_model_single {
+  const char_T * volatile errorStatus;
+};
+
+/* External inputs (root inport signals with default storage) */
+extern onboard_env_single_model_ext_inputs_t onboard_env_single_model_ext_inputs;
+
+/* External outputs (root outports fed by signals with default storage) */
+extern onboard_env_single_model_ext_outputs_t onboard_env_single_model_ext_outputs;
+
+/* Model entry point functions */
+extern void onboard_env_modelling_single_initialize(void);
+extern void onboard_env_modelling_single_step(void);
+
+/* Real-time Model object */
+extern RT_MODEL_onboard_model_single *const onboard_env_single_model_rt_object;
+
+/*-
+ * The block structure and hierarchy are those of onboard_env_modelling.h;
+ * refer to it to trace the code back to the model.
+ */
+#endif                        /* RTW_HEADER_onboard_env_modelling_single_h_ */
+
+/*
+ * File trailer for generated code.
+ *
+ * [EOF]
+ */
@@ -0,0 +1,137 @@
+/*
+ * Compares the specialized RS(255,223) codec in obc_gs_rs_ccsds.h with libcorrect configured the way obc_gs_fec.c
+ * used it. Every codeword is checked against libcorrect's output before anything is timed.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_interfaces/benchmark/rs-ccsds-benchmark
+ */
+#include "correct.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_rs_ccsds.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCHMARK_CODEWORDS 256U
+#define BENCHMARK_ITERATIONS 20U
+
+static uint8_t messages[BENCHMARK_CODEWORDS][RS_CCSDS_MESSAGE_SIZE];
+static uint8_t codewords[BENCHMARK_CODEWORDS][RS_CCSDS_BLOCK_SIZE];
+static uint8_t received[BENCHMARK_CODEWORDS][RS_CCSDS_BLOCK_SIZE];
+
+static uint32_t seed = 0xFEC;
+
+static uint32_t nextPseudorandom(void) {
+  // Pseudorandom generation using a simple algorithm
+  seed = (seed * 1103515245 + 12345) % (1U << 31);
+  return seed >> 16;
+}
+
+static double secondsNow(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void fail(const char *reason, uint32_t index) {
+  printf("FAILED: %s (codeword %u)\n", reason, (unsigned)index);
+  exit(1);
+}
+
+static void corrupt(uint32_t numErrors) {
+  memcpy(received, codewords, sizeof(received));
+  for (uint32_t i = 0; i < BENCHMARK_CODEWORDS; ++i) {
+    // Positions may repeat, which only lowers the error count
+    for (uint32_t j = 0; j < numErrors; ++j) {
+      received[i][nextPseudorandom() % RS_CCSDS_BLOCK_SIZE] ^= (uint8_t)(nextPseudorandom() | 1U);
+    }
+  }
+}
+
+static void benchmarkEncode(correct_reed_solomon *rs) {
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE];
+  double start = secondsNow();
+  for (uint32_t n = 0; n < BENCHMARK_ITERATIONS; ++n) {
+    for (uint32_t i = 0; i < BENCHMARK_CODEWORDS; ++i) {
+      correct_reed_solomon_encode(rs, messages[i], RS_CCSDS_MESSAGE_SIZE, codeword);
+    }
+  }
+  double libcorrectSeconds = secondsNow() - start;
+
+  start = secondsNow();
+  for (uint32_t n = 0; n < BENCHMARK_ITERATIONS; ++n) {
+    for (uint32_t i = 0; i < BENCHMARK_CODEWORDS; ++i) {
+      rsCcsdsEncode(messages[i], codeword);
+    }
+  }
+  double ccsdsSeconds = secondsNow() - start;
+
+  double count = (double)BENCHMARK_CODEWORDS * BENCHMARK_ITERATIONS;
+  printf("[ RS       ] encode            libcorrect %8.2f us, ccsds %8.2f us, %5.1fx\n", libcorrectSeconds * 1e6 / count,
+         ccsdsSeconds * 1e6 / count, libcorrectSeconds / ccsdsSeconds);
+}
+
+static void benchmarkDecode(correct_reed_solomon *rs, uint32_t numErrors) {
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t expected[RS_CCSDS_MESSAGE_SIZE];
+  corrupt(numErrors);
+
+  for (uint32_t i = 0; i < BENCHMARK_CODEWORDS; ++i) {
+    if (correct_reed_solomon_decode(rs, received[i], RS_CCSDS_BLOCK_SIZE, expected) < 0 ||
+        rsCcsdsDecode(received[i], message, NULL) != OBC_GS_ERR_CODE_SUCCESS ||
+        memcmp(message, expected, RS_CCSDS_MESSAGE_SIZE) != 0 || memcmp(message, messages[i], sizeof(message)) != 0) {
+      fail("decoders disagree", i);
+    }
+  }
+
+  double start = secondsNow();
+  for (uint32_t n = 0; n < BENCHMARK_ITERATIONS; ++n) {
+    for (uint32_t i = 0; i < BENCHMARK_CODEWORDS; ++i) {
+      correct_reed_solomon_decode(rs, received[i], RS_CCSDS_BLOCK_SIZE, message);
+    }
+  }
+  double libcorrectSeconds = secondsNow() - start;
+
+  start = secondsNow();
+  for (uint32_t n = 0; n < BENCHMARK_ITERATIONS; ++n) {
+    for (uint32_t i = 0; i < BENCHMARK_CODEWORDS; ++i) {
+      rsCcsdsDecode(received[i], message, NULL);
+    }
+  }
+  double ccsdsSeconds = secondsNow() - start;
+
+  double count = (double)BENCHMARK_CODEWORDS * BENCHMARK_ITERATIONS;
+  printf("[ RS       ] decode %2u errors  libcorrect %8.2f us, ccsds %8.2f us, %5.1fx\n", (unsigned)numErrors,
+         libcorrectSeconds * 1e6 / count, ccsdsSeconds * 1e6 / count, libcorrectSeconds / ccsdsSeconds);
+}
+
+int main(void) {
+  correct_reed_solomon *rs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  if (rs == NULL) {
+    printf("FAILED: could not create the libcorrect codec\n");
+    return 1;
+  }
+
+  uint8_t expected[RS_CCSDS_BLOCK_SIZE];
+  for (uint32_t i = 0; i < BENCHMARK_CODEWORDS; ++i) {
+    for (uint32_t j = 0; j < RS_CCSDS_MESSAGE_SIZE; ++j) {
+      messages[i][j] = (uint8_t)nextPseudorandom();
+    }
+    correct_reed_solomon_encode(rs, messages[i], RS_CCSDS_MESSAGE_SIZE, expected);
+    if (rsCcsdsEncode(messages[i], codewords[i]) != OBC_GS_ERR_CODE_SUCCESS ||
+        memcmp(codewords[i], expected, RS_CCSDS_BLOCK_SIZE) != 0) {
+      fail("codewords differ", i);
+    }
+  }
+
+  benchmarkEncode(rs);
+
+  const uint32_t errorCounts[] = {0, 1, 4, 8, RS_CCSDS_MAX_CORRECTABLE};
+  for (uint32_t i = 0; i < sizeof(errorCounts) / sizeof(errorCounts[0]); ++i) {
+    benchmarkDecode(rs, errorCounts[i]);
+  }
+
+  correct_reed_solomon_destroy(rs);
+  return 0;
+}
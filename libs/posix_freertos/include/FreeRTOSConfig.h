@@ -55,6 +55,7 @@ void vConfigureTimerForRunTimeStats(void);
 #define INCLUDE_xTimerGetTimerDaemonTaskHandle 1
 #define INCLUDE_xTaskGetIdleTaskHandle 1
 #define INCLUDE_xTaskGetHandle 1
+#define INCLUDE_xTaskGetCurrentTaskHandle 1
 #define INCLUDE_eTaskGetState 1
 #define INCLUDE_xSemaphoreGetMutexHolder 1
 #define INCLUDE_xTimerPendFunctionCall 1
@@ -90,4 +91,9 @@ extern void vLoggingPrintf(const char* pcFormatString, ...);
 #if (ipconfigHAS_PRINTF == 1)
 #define FreeRTOS_printf(X) vLoggingPrintf X
 #endif
+/* A build can define the trace macros (traceQUEUE_SEND, ...) in its own header */
+#ifdef FREERTOS_TRACE_HOOKS_HEADER
+#include FREERTOS_TRACE_HOOKS_HEADER
+#endif
+
 #endif /* FREERTOS_CONFIG_H */
@@ -114,6 +114,10 @@ extern void vPortCancelThread(void *pxTaskToDelete);
 #define portTASK_FUNCTION(vFunction, pvParameters) void vFunction(void *pvParameters)
 /*-----------------------------------------------------------*/
 
+/* There is no MPU, so every task keeps the privileges it started with. */
+#define portSWITCH_TO_USER_MODE()
+/*-----------------------------------------------------------*/
+
 /*
  * Tasks run in their own pthreads and context switches between them
  * are always a full memory barrier. ISRs are emulated as signals
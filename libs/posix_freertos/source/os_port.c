@@ -57,7 +57,6 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
-#include <sys/times.h>
 #include <time.h>
 
 /* Scheduler includes. */
@@ -508,10 +507,14 @@ static void prvSetupSignalsAndSchedulerPolicy(void) {
 /*-----------------------------------------------------------*/
 
 unsigned long ulPortGetRunTime(void) {
-  struct tms xTimes;
+  struct timespec xTime;
 
-  times(&xTimes);
+  /* Only the running task's thread is ever awake, so process CPU time in
+     microseconds splits between tasks the way the scheduler ran them. times()
+     only has clock tick (10 ms) resolution, which is longer than most task
+     activations. */
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &xTime);
 
-  return (unsigned long)xTimes.tms_utime;
+  return (unsigned long)(xTime.tv_sec * 1000000ull + xTime.tv_nsec / 1000);
 }
 /*-----------------------------------------------------------*/
@@ -2,6 +2,8 @@
 #include "obc_sci_io.h"
 #include "obc_i2c_io.h"
 #include "obc_spi_io.h"
+#include "obc_spi_dma.h"
+#include "obc_board_config.h"
 #include "obc_reset.h"
 #include "obc_scheduler_config.h"
 #include "state_mgr.h"
@@ -15,6 +17,7 @@
 #include <sci.h>
 #include <i2c.h>
 #include <spi.h>
+#include <sys_dma.h>
 #include <can.h>
 #include <het.h>
 
@@ -41,6 +44,12 @@ int main(void) {
   initI2CMutex();
   initSpiMutex();
 
+  // DMA for the SD card sectors and the camera FIFO readout
+  dmaEnable();
+  initDmaSpiSemaphores();
+  spiDmaInit(SDC_SPI_REG);
+  spiDmaInit(CAM_SPI_REG);
+
   // The state_mgr is the only task running initially.
   obcSchedulerInitTask(OBC_SCHEDULER_CONFIG_ID_STATE_MGR);
   obcSchedulerCreateTask(OBC_SCHEDULER_CONFIG_ID_STATE_MGR);
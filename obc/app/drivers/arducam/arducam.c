@@ -1,10 +1,13 @@
 #include "arducam.h"
+#include "jpeg_stream.h"
 #include "ov5642_reg.h"
 #include "obc_spi_io.h"
+#include "obc_spi_dma.h"
 #include "obc_reliance_fs.h"
 #include "obc_board_config.h"
 
 #include <redposix.h>
+#include <redconf.h>
 
 // Camera control
 #define ARDUCHIP_TRIG 0x41     // Trigger source
@@ -25,10 +28,24 @@
 #define FIFO_SIZE2 0x43  // Camera write FIFO size[15:8]
 #define FIFO_SIZE3 0x44  // Camera write FIFO size[18:16]
 
+// FIFO bytes per DMA transfer; one file system block so that a chunk's worth of image fills one aligned write
+#define FIFO_CHUNK_FRAMES REDCONF_BLOCK_SIZE
+#define FIFO_CHUNK_TIMEOUT_MS 100U
+
 static uint8_t m_fmt;
 // Todo: support multiple image captures in different files
 static const char fname[] = "image.jpg";
 
+// Ping-pong buffers: the DMA fills one while the other is scanned and written to the file
+static uint16_t fifoChunks[2][FIFO_CHUNK_FRAMES];
+// Clocked out while reading the FIFO; its contents are ignored by the camera
+static uint16_t fifoDummyTx[FIFO_CHUNK_FRAMES];
+static uint8_t imageBlock[REDCONF_BLOCK_SIZE];
+
+static obc_error_code_t readFifoChunks(jpeg_stream_t *stream, uint32_t length);
+
+static obc_error_code_t writeImageBlock(const uint8_t *data, size_t len, void *ctx);
+
 void setFormat(image_format_t fmt) {
   if (fmt == BMP)
     m_fmt = BMP;
@@ -132,9 +149,9 @@ obc_error_code_t readFifoLength(uint32_t *length, camera_t cam) {
   RETURN_IF_ERROR_CODE(camReadReg(FIFO_SIZE1, &rx_data, cam));
   len1 = rx_data;
   RETURN_IF_ERROR_CODE(camReadReg(FIFO_SIZE2, &rx_data, cam));
-  len1 = rx_data;
+  len2 = rx_data;
   RETURN_IF_ERROR_CODE(camReadReg(FIFO_SIZE3, &rx_data, cam));
-  len1 = (rx_data & 0x7f);
+  len3 = (rx_data & 0x7f);
 
   *length = ((len3 << 16) | (len2 << 8) | len1) & 0x07fffff;
   return errCode;
@@ -145,60 +162,83 @@ obc_error_code_t readFifoBurst(camera_t cam) {
   obc_error_code_t errCode;
   int32_t file = 0;
   uint32_t length = 0;
-  uint8_t temp = 0, temp_last = 0;
-  bool is_header = false;
+
+  RETURN_IF_ERROR_CODE(readFifoLength(&length, cam));
+  if (length >= MAX_FIFO_SIZE || length == 0) {
+    return OBC_ERR_CODE_FRAME_SIZE_OUT_OF_RANGE;
+  }
 
   // Open a new image file
   RETURN_IF_ERROR_CODE(createFile(fname, &file));
 
-  readFifoLength(&length, cam);
-  if (length >= MAX_FIFO_SIZE) {
-    // 512 kb
-    errCode = OBC_ERR_CODE_FRAME_SIZE_OUT_OF_RANGE;
-  } else if (length == 0) {
-    // 0 kb
-    errCode = OBC_ERR_CODE_FRAME_SIZE_OUT_OF_RANGE;
-  }
-
-  RETURN_IF_ERROR_CODE(errCode);
-  RETURN_IF_ERROR_CODE(assertChipSelect(CAM_SPI_PORT, 1));
+  jpeg_stream_t stream;
+  errCode = jpegStreamInit(&stream, imageBlock, sizeof(imageBlock), writeImageBlock, &file);
 
   // Set fifo to burst mode, receive continuous data until EOF
-  errCode = setFifoBurst(cam);
-  camReadByte(&temp, cam);
-  length--;
-  while (length-- && !errCode) {
-    temp_last = temp;
-    errCode = camReadByte(&temp, cam);
+  if (!errCode) {
+    errCode = camBeginBurst(BURST_FIFO_READ, cam);
     if (!errCode) {
-      if (is_header == true) {
-        errCode = writeFile(file, &temp, 1);
-      } else if ((temp == 0xD8) & (temp_last == 0xFF)) {
-        is_header = true;
-        errCode = writeFile(file, &temp_last, 1);
-        if (!errCode) {
-          errCode = writeFile(file, &temp, 1);
-        }
-      }
-      if ((temp == 0xD9) && (temp_last == 0xFF)) {
-        break;
+      errCode = readFifoChunks(&stream, length);
+      if (!errCode) {
+        errCode = camEndBurst(cam);
+      } else {
+        // If there was an error during capture, deassert without an error check
+        camEndBurst(cam);
       }
     }
-
-    // Todo: Can this be changed to ~15us instead?
-    vTaskDelay(pdMS_TO_TICKS(1));
   }
 
   if (!errCode) {
-    errCode = deassertChipSelect(CAM_SPI_PORT, 1);
-  } else {
-    // If there was an error during capture, deassert without an error check
-    deassertChipSelect(CAM_SPI_PORT, 1);
+    errCode = jpegStreamFinish(&stream);
   }
 
   if (!errCode) {
     errCode = closeFile(file);
+  } else {
+    closeFile(file);
   }
 
   return errCode;
 }
+
+static obc_error_code_t readFifoChunks(jpeg_stream_t *stream, uint32_t length) {
+  obc_error_code_t errCode;
+  uint32_t remaining = length;
+  uint8_t next = 0;
+  bool done = false;
+
+  uint32_t chunkLen = (remaining < FIFO_CHUNK_FRAMES) ? remaining : FIFO_CHUNK_FRAMES;
+  RETURN_IF_ERROR_CODE(dmaSpiStartTransfer(CAM_SPI_REG, fifoDummyTx, fifoChunks[next], chunkLen));
+  remaining -= chunkLen;
+
+  while (1) {
+    RETURN_IF_ERROR_CODE(dmaSpiWaitTransfer(CAM_SPI_REG, FIFO_CHUNK_TIMEOUT_MS));
+    const uint16_t *filled = fifoChunks[next];
+    uint32_t filledLen = chunkLen;
+
+    // Start the next chunk before handling this one so the SPI transfer overlaps the scan and the file write
+    bool inFlight = remaining > 0;
+    if (inFlight) {
+      next ^= 1U;
+      chunkLen = (remaining < FIFO_CHUNK_FRAMES) ? remaining : FIFO_CHUNK_FRAMES;
+      RETURN_IF_ERROR_CODE(dmaSpiStartTransfer(CAM_SPI_REG, fifoDummyTx, fifoChunks[next], chunkLen));
+      remaining -= chunkLen;
+    }
+
+    errCode = jpegStreamFeed(stream, filled, filledLen, &done);
+    if (errCode != OBC_ERR_CODE_SUCCESS || done || !inFlight) {
+      // The transfer in flight must finish before the chip select is released
+      if (inFlight) {
+        obc_error_code_t waitErrCode = dmaSpiWaitTransfer(CAM_SPI_REG, FIFO_CHUNK_TIMEOUT_MS);
+        if (errCode == OBC_ERR_CODE_SUCCESS) {
+          errCode = waitErrCode;
+        }
+      }
+      return errCode;
+    }
+  }
+}
+
+static obc_error_code_t writeImageBlock(const uint8_t *data, size_t len, void *ctx) {
+  return writeFile(*(int32_t *)ctx, data, len);
+}
@@ -58,6 +58,19 @@ obc_error_code_t camReadByte(uint8_t *byte, camera_t cam) {
   return spiReceiveByte(CAM_SPI_REG, &cam_config[cam].spi_config, byte);
 }
 
+obc_error_code_t camBeginBurst(uint8_t cmd, camera_t cam) {
+  obc_error_code_t errCode;
+  RETURN_IF_ERROR_CODE(assertChipSelect(CAM_SPI_PORT, cam_config[cam].cs_num));
+  errCode = spiTransmitByte(CAM_SPI_REG, &cam_config[cam].spi_config, cmd);
+  if (errCode != OBC_ERR_CODE_SUCCESS) {
+    // If the command could not be sent, deassert without an error check
+    deassertChipSelect(CAM_SPI_PORT, cam_config[cam].cs_num);
+  }
+  return errCode;
+}
+
+obc_error_code_t camEndBurst(camera_t cam) { return deassertChipSelect(CAM_SPI_PORT, cam_config[cam].cs_num); }
+
 obc_error_code_t camWriteSensorReg16_8(uint32_t regID, uint8_t regDat) {
   uint8_t reg_tx_data[3] = {(regID >> 8), (regID & 0x00FF), regDat};
   return i2cSendTo(CAM_I2C_WR_ADDR, 3, reg_tx_data, I2C_MUTEX_TIMEOUT, I2C_TRANSFER_TIMEOUT);
@@ -66,6 +66,22 @@ obc_error_code_t camReadByte(uint8_t* byte, camera_t cam);
  */
 obc_error_code_t camWriteSensorReg16_8(uint32_t regID, uint8_t regDat);
 
+/**
+ * @brief Assert a camera's chip select and send a burst command. The chip select stays asserted and the bus stays
+ * held for the burst transfer until camEndBurst is called.
+ * @param cmd  Burst command to send
+ * @param cam  Camera identifier
+ * @return Error code
+ */
+obc_error_code_t camBeginBurst(uint8_t cmd, camera_t cam);
+
+/**
+ * @brief Deassert a camera's chip select after a burst transfer
+ * @param cam  Camera identifier
+ * @return Error code
+ */
+obc_error_code_t camEndBurst(camera_t cam);
+
 /**
  * @brief Write 8 bits to a 16 bit register over I2C
  * @param regID Register address to read from
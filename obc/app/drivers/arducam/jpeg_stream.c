@@ -0,0 +1,103 @@
+#include "jpeg_stream.h"
+#include "obc_logging.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define JPEG_MARKER_PREFIX 0xFFU
+#define JPEG_SOI 0xD8U
+#define JPEG_EOI 0xD9U
+
+static obc_error_code_t appendByte(jpeg_stream_t *stream, uint8_t byte) {
+  stream->block[stream->blockLen++] = byte;
+  stream->imageLen++;
+
+  if (stream->blockLen < stream->blockSize) {
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  stream->blockLen = 0;
+  return stream->write(stream->block, stream->blockSize, stream->writeCtx);
+}
+
+obc_error_code_t jpegStreamInit(jpeg_stream_t *stream, uint8_t *block, size_t blockSize, jpeg_stream_write_t write,
+                                void *writeCtx) {
+  if (stream == NULL || block == NULL || blockSize == 0 || write == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  stream->block = block;
+  stream->blockSize = blockSize;
+  stream->blockLen = 0;
+  stream->write = write;
+  stream->writeCtx = writeCtx;
+  stream->state = JPEG_STREAM_SEARCHING;
+  stream->lastByte = 0;
+  stream->imageLen = 0;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t jpegStreamFeed(jpeg_stream_t *stream, const uint16_t *frames, size_t numFrames, bool *done) {
+  if (stream == NULL || (frames == NULL && numFrames > 0) || done == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  obc_error_code_t errCode;
+  size_t i = 0;
+  uint8_t lastByte = stream->lastByte;
+
+  if (stream->state == JPEG_STREAM_SEARCHING) {
+    for (; i < numFrames; i++) {
+      uint8_t byte = (uint8_t)(frames[i] & 0xFFU);
+      bool isSoi = lastByte == JPEG_MARKER_PREFIX && byte == JPEG_SOI;
+      lastByte = byte;
+      if (isSoi) {
+        stream->state = JPEG_STREAM_IN_IMAGE;
+        RETURN_IF_ERROR_CODE(appendByte(stream, JPEG_MARKER_PREFIX));
+        RETURN_IF_ERROR_CODE(appendByte(stream, JPEG_SOI));
+        i++;
+        break;
+      }
+    }
+  }
+
+  if (stream->state == JPEG_STREAM_IN_IMAGE) {
+    for (; i < numFrames; i++) {
+      uint8_t byte = (uint8_t)(frames[i] & 0xFFU);
+      bool isEoi = lastByte == JPEG_MARKER_PREFIX && byte == JPEG_EOI;
+      lastByte = byte;
+      RETURN_IF_ERROR_CODE(appendByte(stream, byte));
+      if (isEoi) {
+        stream->state = JPEG_STREAM_DONE;
+        break;
+      }
+    }
+  }
+
+  stream->lastByte = lastByte;
+  *done = stream->state == JPEG_STREAM_DONE;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t jpegStreamFinish(jpeg_stream_t *stream) {
+  if (stream == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  obc_error_code_t errCode;
+
+  if (stream->blockLen > 0) {
+    size_t len = stream->blockLen;
+    stream->blockLen = 0;
+    RETURN_IF_ERROR_CODE(stream->write(stream->block, len, stream->writeCtx));
+  }
+
+  if (stream->state != JPEG_STREAM_DONE) {
+    return OBC_ERR_CODE_JPEG_INCOMPLETE;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "obc_errors.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Called with each full block of the image, and with the final partial block
+ * @param data The block to write
+ * @param len Number of bytes in the block
+ * @param ctx The context passed to jpegStreamInit
+ */
+typedef obc_error_code_t (*jpeg_stream_write_t)(const uint8_t *data, size_t len, void *ctx);
+
+typedef enum {
+  JPEG_STREAM_SEARCHING,  // Skipping FIFO bytes before the start of image marker
+  JPEG_STREAM_IN_IMAGE,   // Copying the image until the end of image marker
+  JPEG_STREAM_DONE,       // End of image marker found; later data is ignored
+} jpeg_stream_state_t;
+
+/**
+ * @brief Extracts a JPEG from a camera FIFO readout and gathers it into fixed size blocks.
+ *
+ * The readout arrives as SPI DMA frames with one byte in the low half of each 16 bit frame. Everything before the
+ * start of image marker (FF D8) and after the end of image marker (FF D9) is dropped, including markers that straddle
+ * two chunks. Blocks are only written when full, so every write but the last lands on a block boundary of the file.
+ */
+typedef struct {
+  uint8_t *block;
+  size_t blockSize;
+  size_t blockLen;
+  jpeg_stream_write_t write;
+  void *writeCtx;
+  jpeg_stream_state_t state;
+  uint8_t lastByte;
+  uint32_t imageLen;
+} jpeg_stream_t;
+
+/**
+ * @brief Initialize a stream
+ *
+ * @param stream The stream to initialize
+ * @param block Buffer for one block
+ * @param blockSize Size of block in bytes; the file system block size for aligned writes
+ * @param write Called with each block of the image
+ * @param writeCtx Passed to write
+ * @return obc_error_code_t OBC_ERR_CODE_INVALID_ARG if an argument is NULL or blockSize is 0
+ */
+obc_error_code_t jpegStreamInit(jpeg_stream_t *stream, uint8_t *block, size_t blockSize, jpeg_stream_write_t write,
+                                void *writeCtx);
+
+/**
+ * @brief Feed the next chunk of the FIFO readout
+ *
+ * @param stream The stream to feed
+ * @param frames SPI DMA frames read from the FIFO
+ * @param numFrames Number of frames
+ * @param done Set to true once the end of image marker has been seen, so no more chunks need to be read
+ * @return obc_error_code_t The error from the write callback, if any
+ */
+obc_error_code_t jpegStreamFeed(jpeg_stream_t *stream, const uint16_t *frames, size_t numFrames, bool *done);
+
+/**
+ * @brief Write the final partial block
+ *
+ * @param stream The stream to finish
+ * @return obc_error_code_t OBC_ERR_CODE_JPEG_INCOMPLETE if the readout did not hold a start and end of image marker
+ */
+obc_error_code_t jpegStreamFinish(jpeg_stream_t *stream);
+
+#ifdef __cplusplus
+}
+#endif
@@ -413,6 +413,30 @@ obc_error_code_t cc1120GetState(cc1120_state_t *stateNum) {
   return OBC_ERR_CODE_SUCCESS;
 }
 
+/**
+ * @brief Reads the RSSI and LQI of the signal currently being received in one burst
+ * See chapters 6.9 and 6.10 in the user guide
+ *
+ * @param quality - Stores the link quality
+ * @return obc_error_code_t - Whether or not the register read was successful
+ */
+obc_error_code_t cc1120GetLinkQuality(cc1120_link_quality_t *quality) {
+  if (quality == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+  obc_error_code_t errCode;
+
+  // RSSI1, RSSI0, MARCSTATE and LQI_VAL are consecutive
+  uint8_t regs[CC1120_REGS_EXT_LQI_VAL - CC1120_REGS_EXT_RSSI1 + 1];
+  RETURN_IF_ERROR_CODE(cc1120ReadExtAddrSpi(CC1120_REGS_EXT_RSSI1, regs, sizeof(regs)));
+
+  // RSSI1 holds the upper 8 bits of the 12 bit two's complement RSSI in dBm
+  quality->rssiDbm = (int8_t)regs[0];
+  quality->rssiValid = (regs[CC1120_REGS_EXT_RSSI0 - CC1120_REGS_EXT_RSSI1] & 0x01U) != 0;
+  quality->lqi = regs[CC1120_REGS_EXT_LQI_VAL - CC1120_REGS_EXT_RSSI1] & 0x7FU;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
 /**
  * @brief Resets CC1120 & initializes transmit mode
  *
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "obc_errors.h"
 
@@ -37,6 +38,12 @@ typedef enum {
   CC1120_STATE_IFADCON_TXRX
 } cc1120_state_t;
 
+typedef struct {
+  int8_t rssiDbm;  // Integer part of the RSSI estimate
+  bool rssiValid;  // Whether the RSSI estimate has settled
+  uint8_t lqi;     // Link quality indicator; lower is better
+} cc1120_link_quality_t;
+
 /**
  * @brief - Reads from consecutive registers from the CC1120.
  *
@@ -165,6 +172,15 @@ obc_error_code_t cc1120GetBytesInRxFifo(uint8_t *numBytes);
  */
 obc_error_code_t cc1120GetState(cc1120_state_t *stateNum);
 
+/**
+ * @brief Reads the RSSI and LQI of the signal currently being received in one burst
+ * See chapters 6.9 and 6.10 in the user guide
+ *
+ * @param quality - Stores the link quality
+ * @return obc_error_code_t - Whether or not the register read was successful
+ */
+obc_error_code_t cc1120GetLinkQuality(cc1120_link_quality_t *quality);
+
 /**
  * @brief Resets CC1120 & initializes transmit mode
  *
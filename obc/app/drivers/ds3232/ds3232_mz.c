@@ -32,6 +32,13 @@
 
 #define DS3232_TEMP_RESOLUTION 0.25f
 
+// Seconds through year, read in one burst
+#define DS3232_DATE_TIME_REG_COUNT 7U
+#define DS3232_TIME_REG_COUNT 3U
+
+#define DS3232_HOURS_24_MASK 0x3FU
+#define DS3232_MONTH_MASK 0x1FU  // Bit 7 is the century bit
+
 #define RTC_RST_GIO_PIN 1UL
 #define RTC_RST_GIO_PORT gioPORTA
 
@@ -169,7 +176,7 @@ obc_error_code_t getMinutesRTC(uint8_t *minutes) {
   return OBC_ERR_CODE_SUCCESS;
 }
 
-obc_error_code_t getHourRTC(uint8_t *hours) {
+obc_error_code_t getHoursRTC(uint8_t *hours) {
   obc_error_code_t errCode;
 
   if (hours == NULL) return OBC_ERR_CODE_INVALID_ARG;
@@ -234,16 +241,24 @@ obc_error_code_t getYearRTC(uint8_t *year) {
   return OBC_ERR_CODE_SUCCESS;
 }
 
+/*
+ * The time registers are read in one burst starting at the seconds register. The DS3232 copies the time into its
+ * read buffer on the START condition, so a rollover during the read cannot tear the result, and the bus is claimed
+ * for one register read instead of one per field.
+ */
+
 obc_error_code_t getCurrentTimeRTC(rtc_time_t *time) {
   obc_error_code_t errCode;
 
-  rtc_time_t tmp = {0};
+  if (time == NULL) return OBC_ERR_CODE_INVALID_ARG;
 
-  RETURN_IF_ERROR_CODE(getMinutesRTC(&tmp.minutes));
-  RETURN_IF_ERROR_CODE(getSecondsRTC(&tmp.seconds));
-  RETURN_IF_ERROR_CODE(getHourRTC(&tmp.hours));
+  uint8_t regs[DS3232_TIME_REG_COUNT];
+  RETURN_IF_ERROR_CODE(
+      i2cReadReg(DS3232_I2C_ADDRESS, DS3232_REG_SECONDS, regs, DS3232_TIME_REG_COUNT, I2C_TRANSFER_TIMEOUT));
 
-  *time = tmp;
+  time->seconds = twoDigitDecimalFromBCD(regs[DS3232_REG_SECONDS]);
+  time->minutes = twoDigitDecimalFromBCD(regs[DS3232_REG_MINUTES]);
+  time->hours = twoDigitDecimalFromBCD(regs[DS3232_REG_HOURS] & DS3232_HOURS_24_MASK);
 
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -251,17 +266,18 @@ obc_error_code_t getCurrentTimeRTC(rtc_time_t *time) {
 obc_error_code_t getCurrentDateTimeRTC(rtc_date_time_t *dateTime) {
   obc_error_code_t errCode;
 
-  rtc_date_time_t tmp = {0};
-
-  RETURN_IF_ERROR_CODE(getDateRTC(&tmp.date.date));
-  RETURN_IF_ERROR_CODE(getMonthRTC(&tmp.date.month));
-  RETURN_IF_ERROR_CODE(getYearRTC(&tmp.date.year));
+  if (dateTime == NULL) return OBC_ERR_CODE_INVALID_ARG;
 
-  RETURN_IF_ERROR_CODE(getHourRTC(&tmp.time.hours));
-  RETURN_IF_ERROR_CODE(getMinutesRTC(&tmp.time.minutes));
-  RETURN_IF_ERROR_CODE(getSecondsRTC(&tmp.time.seconds));
+  uint8_t regs[DS3232_DATE_TIME_REG_COUNT];
+  RETURN_IF_ERROR_CODE(
+      i2cReadReg(DS3232_I2C_ADDRESS, DS3232_REG_SECONDS, regs, DS3232_DATE_TIME_REG_COUNT, I2C_TRANSFER_TIMEOUT));
 
-  *dateTime = tmp;
+  dateTime->time.seconds = twoDigitDecimalFromBCD(regs[DS3232_REG_SECONDS]);
+  dateTime->time.minutes = twoDigitDecimalFromBCD(regs[DS3232_REG_MINUTES]);
+  dateTime->time.hours = twoDigitDecimalFromBCD(regs[DS3232_REG_HOURS] & DS3232_HOURS_24_MASK);
+  dateTime->date.date = twoDigitDecimalFromBCD(regs[DS3232_REG_DATE]);
+  dateTime->date.month = twoDigitDecimalFromBCD(regs[DS3232_REG_MONTH] & DS3232_MONTH_MASK);
+  dateTime->date.year = twoDigitDecimalFromBCD(regs[DS3232_REG_YEAR]);
 
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -19,9 +19,9 @@ void gioNotification(gioPORT_t *port, uint32 bit) {
         txFifoReadyCallback();
         break;
       // See section 3.4.1.1
-      // triggered on falling edge once TX FIFO has been completely emptied
+      // triggered on falling edge once TX FIFO has been completely emptied, or on the sync word while receiving
       case CC1120_PKT_SYNC_RXTX_gioPORTA_PIN:
-        txFifoEmptyCallback();
+        gpio2Callback();
         break;
     }
   } else if (port == gioPORTB) {
@@ -29,6 +29,12 @@ static StaticSemaphore_t sciTransferCompleteBuffer;
 static SemaphoreHandle_t sciLinTransferComplete = NULL;
 static StaticSemaphore_t sciLinTransferCompleteBuffer;
 
+// Stream receivers take over a port's receive interrupt and get each byte instead of the transfer semaphore
+static volatile sci_rx_byte_handler_t sciRxByteHandler = NULL;
+static volatile sci_rx_byte_handler_t sciLinRxByteHandler = NULL;
+static uint8_t sciRxByte;
+static uint8_t sciLinRxByte;
+
 STATIC_ASSERT((UART_PRINT_REG == sciREG) || (UART_PRINT_REG == scilinREG),
               "UART_PRINT_REG must be sciREG or scilinREG");
 STATIC_ASSERT((UART_READ_REG == sciREG) || (UART_READ_REG == scilinREG), "UART_READ_REG must be sciREG or scilinREG");
@@ -131,19 +137,59 @@ obc_error_code_t sciSendBytes(uint8_t *buf, size_t numBytes, TickType_t uartMute
   return OBC_ERR_CODE_SUCCESS;
 }
 
+obc_error_code_t sciStartStreamReceive(sciBASE_t *sciReg, sci_rx_byte_handler_t handler,
+                                       TickType_t uartMutexTimeoutTicks) {
+  if (!(sciReg == scilinREG || sciReg == sciREG)) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (handler == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  SemaphoreHandle_t mutex = (sciReg == sciREG) ? sciReadMutex : sciLinReadMutex;
+  configASSERT(mutex != NULL);
+
+  // Never given back; the stream receiver owns the port from now on
+  if (xSemaphoreTake(mutex, uartMutexTimeoutTicks) != pdTRUE) {
+    return OBC_ERR_CODE_MUTEX_TIMEOUT;
+  }
+
+  // Receive one byte at a time; the notification hands each byte over and re-arms the receive
+  if (sciReg == sciREG) {
+    sciRxByteHandler = handler;
+    sciReceive(sciReg, 1, &sciRxByte);
+  } else {
+    sciLinRxByteHandler = handler;
+    sciReceive(sciReg, 1, &sciLinRxByte);
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
 void sciNotification(sciBASE_t *sci, uint32 flags) {
   BaseType_t xHigherPriorityTaskWoken = pdFALSE;
 
   if (sci == sciREG) {
     switch (flags) {
       case SCI_RX_INT:
-        xSemaphoreGiveFromISR(sciTransferComplete, &xHigherPriorityTaskWoken);
+        if (sciRxByteHandler != NULL) {
+          sciRxByteHandler(sciRxByte, &xHigherPriorityTaskWoken);
+          sciReceive(sciREG, 1, &sciRxByte);
+        } else {
+          xSemaphoreGiveFromISR(sciTransferComplete, &xHigherPriorityTaskWoken);
+        }
         break;
     }
   } else if (sci == scilinREG) {
     switch (flags) {
       case SCI_RX_INT:
-        xSemaphoreGiveFromISR(sciLinTransferComplete, &xHigherPriorityTaskWoken);
+        if (sciLinRxByteHandler != NULL) {
+          sciLinRxByteHandler(sciLinRxByte, &xHigherPriorityTaskWoken);
+          sciReceive(scilinREG, 1, &sciLinRxByte);
+        } else {
+          xSemaphoreGiveFromISR(sciLinTransferComplete, &xHigherPriorityTaskWoken);
+        }
         break;
     }
   } else {
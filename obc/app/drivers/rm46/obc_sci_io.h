@@ -2,6 +2,9 @@
 
 #include "obc_errors.h"
 
+#include <FreeRTOS.h>
+#include <os_portmacro.h>
+
 #include <sci.h>
 #include <stdint.h>
 
@@ -9,6 +12,14 @@
 #define OBC_UART_BAUD_RATE 115200
 #endif
 
+/**
+ * @brief Called from the SCI interrupt for each byte received by a stream receiver
+ *
+ * @param byte The received byte
+ * @param higherPriorityTaskWoken Set to pdTRUE if the handler woke a task that should run when the interrupt returns
+ */
+typedef void (*sci_rx_byte_handler_t)(uint8_t byte, BaseType_t *higherPriorityTaskWoken);
+
 /**
  * @brief Initialize mutexes protecting SCI and SCI2.
  *
@@ -38,3 +49,16 @@ obc_error_code_t sciReadBytes(uint8_t *buf, size_t numBytes, TickType_t uartMute
  * @return OBC_ERR_CODE_SUCCESS on success, else an error code
  */
 obc_error_code_t sciSendBytes(uint8_t *buf, size_t numBytes, TickType_t uartMutexTimeoutTicks, sciBASE_t *sciReg);
+
+/**
+ * @brief Receive every byte arriving on an SCI port from now on and hand it to a handler from the interrupt.
+ *
+ * The port's read mutex is held for good, so sciReadBytes on the same port fails with OBC_ERR_CODE_MUTEX_TIMEOUT.
+ *
+ * @param sciReg Pointer to the SCI register to receive from
+ * @param handler Called from the interrupt with each received byte; must be short and ISR safe
+ * @param uartMutexTimeoutTicks Number of ticks to wait for the read mutex to become available
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS on success, else an error code
+ */
+obc_error_code_t sciStartStreamReceive(sciBASE_t *sciReg, sci_rx_byte_handler_t handler,
+                                       TickType_t uartMutexTimeoutTicks);
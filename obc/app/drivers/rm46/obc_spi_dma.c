@@ -39,6 +39,32 @@ static obc_error_code_t spiDmaTxConfig(spiBASE_t *spiReg, uint32_t txDataAddr, s
  */
 static obc_error_code_t spiDmaRxConfig(spiBASE_t *spiReg, uint32_t rxDataAddr, size_t dataLen);
 
+static obc_error_code_t getSpiDmaChannels(spiBASE_t *spiReg, uint32_t *rxChannel, uint32_t *txChannel) {
+  switch ((uint32_t)spiReg) {
+    case (uint32_t)spiREG1:
+      *rxChannel = DMA_SPI_1_RX_CHANNEL;
+      *txChannel = DMA_SPI_1_TX_CHANNEL;
+      return OBC_ERR_CODE_SUCCESS;
+    case (uint32_t)spiREG3:
+      *rxChannel = DMA_SPI_3_RX_CHANNEL;
+      *txChannel = DMA_SPI_3_TX_CHANNEL;
+      return OBC_ERR_CODE_SUCCESS;
+    default:
+      return OBC_ERR_CODE_INVALID_ARG;
+  }
+}
+
+/**
+ * @brief Stops spiReg from requesting DMA and disables its channels, so the byte-by-byte transfers that share the bus
+ * between DMA transfers cannot move data to or from the last transfer's buffers
+ */
+static void spiDmaStop(spiBASE_t *spiReg, uint32_t rxChannel, uint32_t txChannel) {
+  BaseType_t xRunningPrivileged = prvRaisePrivilege();
+  spiDisableNotification(spiReg, SPI_NOTIFICATION_DMA_REQ);
+  dmaREG->HWCHENAR = ((uint32_t)1U << rxChannel) | ((uint32_t)1U << txChannel);
+  portRESET_PRIVILEGE(xRunningPrivileged);
+}
+
 /**
  * @brief initializes the semaphores for using the DMA for SPI1
  */
@@ -70,8 +96,6 @@ obc_error_code_t spiDmaInit(spiBASE_t *spiReg) {
       dmaReqAssign(DMA_SPI_1_TX_CHANNEL,
                    DMA_SPI1_TX_REQ_LINE);             // Assign SPI1 TX to DMA channel 1 (See Table 6-33 in datasheet)
       dmaEnableInterrupt(DMA_SPI_1_RX_CHANNEL, BTC);  // Set DMA to trigger interrupt after a block transfer is complete
-      dmaSetChEnable(DMA_SPI_1_RX_CHANNEL, DMA_HW);   // SPI1 RX, hardware triggering
-      dmaSetChEnable(DMA_SPI_1_TX_CHANNEL, DMA_HW);   // SPI1 TX, hardware triggering
       break;
     case (uint32_t)spiREG3:
       dmaReqAssign(DMA_SPI_3_RX_CHANNEL,
@@ -79,8 +103,6 @@ obc_error_code_t spiDmaInit(spiBASE_t *spiReg) {
       dmaReqAssign(DMA_SPI_3_TX_CHANNEL,
                    DMA_SPI3_TX_REQ_LINE);             // Assign SPI3 TX to DMA channel 3 (See Table 6-33 in datasheet)
       dmaEnableInterrupt(DMA_SPI_3_RX_CHANNEL, BTC);  // Set DMA to trigger interrupt after a block transfer is complete
-      dmaSetChEnable(DMA_SPI_3_RX_CHANNEL, DMA_HW);   // SPI3 RX, hardware triggering
-      dmaSetChEnable(DMA_SPI_3_TX_CHANNEL, DMA_HW);   // SPI3 TX, hardware triggering
       break;
     // Add more cases as we start to implement different spi buses with DMA
     default:
@@ -113,7 +135,7 @@ static obc_error_code_t spiDmaRxConfig(spiBASE_t *spiReg, uint32_t rxDataAddr, s
   dmaCtrlPktRx.TTYPE = FRAME_TRANSFER;
   dmaCtrlPktRx.ADDMODERD = ADDR_FIXED;
   dmaCtrlPktRx.ADDMODEWR = ADDR_INC1;
-  dmaCtrlPktRx.AUTOINIT = AUTOINIT_ON;
+  dmaCtrlPktRx.AUTOINIT = AUTOINIT_OFF;  // One block per transfer; the channel disables itself when it is done
 
   switch ((uint32_t)spiReg) {
     case (uint32_t)spiREG1:
@@ -153,7 +175,7 @@ static obc_error_code_t spiDmaTxConfig(spiBASE_t *spiReg, uint32_t txDataAddr, s
   dmaCtrlPktTx.TTYPE = FRAME_TRANSFER;
   dmaCtrlPktTx.ADDMODERD = ADDR_INC1;
   dmaCtrlPktTx.ADDMODEWR = ADDR_FIXED;
-  dmaCtrlPktTx.AUTOINIT = AUTOINIT_ON;
+  dmaCtrlPktTx.AUTOINIT = AUTOINIT_OFF;
 
   switch ((uint32_t)spiReg) {
     case (uint32_t)spiREG1:
@@ -171,6 +193,15 @@ static obc_error_code_t spiDmaTxConfig(spiBASE_t *spiReg, uint32_t txDataAddr, s
 
 obc_error_code_t dmaSpiTransmitandReceiveBytes(spiBASE_t *spiReg, uint16_t *txData, uint16_t *rxData, size_t dataLen,
                                                uint32_t spiMutexTimeoutMs, uint32_t transferCompleteTimeoutMs) {
+  obc_error_code_t errCode;
+
+  RETURN_IF_ERROR_CODE(dmaSpiStartTransfer(spiReg, txData, rxData, dataLen));
+  RETURN_IF_ERROR_CODE(dmaSpiWaitTransfer(spiReg, transferCompleteTimeoutMs));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t dmaSpiStartTransfer(spiBASE_t *spiReg, uint16_t *txData, uint16_t *rxData, size_t dataLen) {
   if (spiReg == NULL) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
@@ -185,6 +216,9 @@ obc_error_code_t dmaSpiTransmitandReceiveBytes(spiBASE_t *spiReg, uint16_t *txDa
   }
   obc_error_code_t errCode;
 
+  uint32_t rxChannel, txChannel;
+  RETURN_IF_ERROR_CODE(getSpiDmaChannels(spiReg, &rxChannel, &txChannel));
+
   SemaphoreHandle_t spiMutex;
   RETURN_IF_ERROR_CODE(getSpiMutex(spiReg, &spiMutex));
 
@@ -198,24 +232,35 @@ obc_error_code_t dmaSpiTransmitandReceiveBytes(spiBASE_t *spiReg, uint16_t *txDa
   RETURN_IF_ERROR_CODE(spiDmaRxConfig(spiReg, (uint32_t)rxData, dataLen));
   RETURN_IF_ERROR_CODE(spiDmaTxConfig(spiReg, (uint32_t)txData, dataLen));
 
+  // Auto-init is off, so the channels are armed for this transfer only
+  dmaSetChEnable(rxChannel, DMA_HW);
+  dmaSetChEnable(txChannel, DMA_HW);
   spiEnableNotification(spiReg, SPI_NOTIFICATION_DMA_REQ);
 
   /* END PRIVILEGED SECTION */
   portRESET_PRIVILEGE(xRunningPrivileged);
 
-  switch ((uint32_t)spiReg) {
-    case (uint32_t)spiREG1:
-      if (xSemaphoreTake(dmaSpi1FinishedSemaphore, pdMS_TO_TICKS(transferCompleteTimeoutMs)) != pdPASS) {
-        return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
-      }
-      break;
-    case (uint32_t)spiREG3:
-      if (xSemaphoreTake(dmaSpi3FinishedSemaphore, pdMS_TO_TICKS(transferCompleteTimeoutMs)) != pdPASS) {
-        return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
-      }
-      break;
-    default:
-      return OBC_ERR_CODE_INVALID_ARG;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t dmaSpiWaitTransfer(spiBASE_t *spiReg, uint32_t transferCompleteTimeoutMs) {
+  if (spiReg == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+  obc_error_code_t errCode;
+
+  uint32_t rxChannel, txChannel;
+  RETURN_IF_ERROR_CODE(getSpiDmaChannels(spiReg, &rxChannel, &txChannel));
+  SemaphoreHandle_t finishedSemaphore =
+      ((uint32_t)spiReg == (uint32_t)spiREG1) ? dmaSpi1FinishedSemaphore : dmaSpi3FinishedSemaphore;
+
+  BaseType_t finished = xSemaphoreTake(finishedSemaphore, pdMS_TO_TICKS(transferCompleteTimeoutMs));
+  spiDmaStop(spiReg, rxChannel, txChannel);
+
+  if (finished != pdPASS) {
+    // Drop a completion that landed between the timeout and stopping the channels so the next wait does not see it
+    xSemaphoreTake(finishedSemaphore, 0);
+    return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
   }
 
   return OBC_ERR_CODE_SUCCESS;
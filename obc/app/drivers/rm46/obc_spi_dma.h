@@ -34,6 +34,30 @@ void initDmaSpiSemaphores(void);
 obc_error_code_t dmaSpiTransmitandReceiveBytes(spiBASE_t *spiReg, uint16_t *txData, uint16_t *rxData, size_t dataLen,
                                                uint32_t spiMutexTimeoutMs, uint32_t transferCompleteTimeoutMs);
 
+/**
+ * @brief Starts a DMA transfer over SPI and returns without waiting for it to finish, so the caller can work on the
+ * previous transfer's data while this one runs. Must be followed by dmaSpiWaitTransfer before the next transfer.
+ *
+ * @param spiReg the SPI bus to use for the transfer
+ * @param txData array of uint16_t to be sent over the SPI bus; must stay valid until the transfer finishes
+ * @param rxData buffer of atleast dataLen size to hold the received bytes; must stay valid until the transfer finishes
+ * @param dataLen number of uint16_t to send
+ *
+ * @return obc_error_code_t - whether or not the transfer was started
+ */
+obc_error_code_t dmaSpiStartTransfer(spiBASE_t *spiReg, uint16_t *txData, uint16_t *rxData, size_t dataLen);
+
+/**
+ * @brief Waits for the transfer started by dmaSpiStartTransfer to finish, then stops the bus requesting DMA whether or
+ * not it finished, so byte-by-byte transfers can use the bus again
+ *
+ * @param spiReg the SPI bus the transfer was started on
+ * @param transferCompleteTimeoutMs time to wait for the SPI transfer to finish
+ *
+ * @return obc_error_code_t - whether or not the transfer finished in time
+ */
+obc_error_code_t dmaSpiWaitTransfer(spiBASE_t *spiReg, uint32_t transferCompleteTimeoutMs);
+
 /**
  * @brief callback function to be called from ISR when DMA Block transfer is complete for SPI1
  */
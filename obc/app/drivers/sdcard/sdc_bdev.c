@@ -10,7 +10,9 @@
 
 #include "sdc_diskio.h"
 #include "sdc_rm46.h"
+#include "sdc_transfer.h"
 #include "obc_spi_io.h"
+#include "obc_spi_dma.h"
 #include "obc_logging.h"
 #include "obc_assert.h"
 #include "obc_board_config.h"
@@ -25,44 +27,13 @@
 /* SD Card Definitions                         */
 /*---------------------------------------------*/
 
-#define SDC_CMD_BASE 0x40U
-#define SDC_CMD0 (SDC_CMD_BASE)       /* GO_IDLE_STATE */
-#define SDC_CMD1 (SDC_CMD_BASE + 1)   /* SEND_OP_COND */
-#define SDC_CMD8 (SDC_CMD_BASE + 8)   /* SEND_IF_COND */
-#define SDC_CMD9 (SDC_CMD_BASE + 9)   /* SEND_CSD */
-#define SDC_CMD10 (SDC_CMD_BASE + 10) /* SEND_CID */
-#define SDC_CMD12 (SDC_CMD_BASE + 12) /* STOP_TRANSMISSION */
-#define SDC_CMD16 (SDC_CMD_BASE + 16) /* SET_BLOCKLEN */
-#define SDC_CMD17 (SDC_CMD_BASE + 17) /* READ_SINGLE_BLOCK */
-#define SDC_CMD18 (SDC_CMD_BASE + 18) /* READ_MULTIPLE_BLOCK */
-#define SDC_CMD23 (SDC_CMD_BASE + 23) /* SET_BLOCK_COUNT */
-#define SDC_CMD24 (SDC_CMD_BASE + 24) /* WRITE_BLOCK */
-#define SDC_CMD25 (SDC_CMD_BASE + 25) /* WRITE_MULTIPLE_BLOCK */
-#define SDC_CMD41 (SDC_CMD_BASE + 41) /* SEND_OP_COND (ACMD) */
-#define SDC_CMD55 (SDC_CMD_BASE + 55) /* APP_CMD */
-#define SDC_CMD58 (SDC_CMD_BASE + 58) /* READ_OCR */
-
-#define SD_SECTOR_SIZE 512U
-#define SD_STOP_TRANSMISSION 0xFDU
-#define SD_DATA_RESPONSE_MASK 0x1FU
-#define SD_DATA_RESPONSE_ACCEPTED 0x05U
-
-#define SDC_CMD17_DATA_TOKEN 0xFEU
-#define SDC_CMD18_DATA_TOKEN 0xFEU
-#define SDC_CMD24_DATA_TOKEN 0xFEU
-#define SDC_CMD25_DATA_TOKEN 0xFCU
-
 // Card type masks (b0:MMC, b1:SDC, b2:Block addressing), see cardType variable
 #define CARD_TYPE_MMC_MASK 0b001U
 #define CARD_TYPE_SDC_MASK 0b010U
 #define CARD_TYPE_BLOCK_ADDR_MASK 0b100U
 
-#define SDC_CMD_RESP_MASK 0x80U
 #define CARD_CAPACITY_OCR_MASK (1 << 6)
 
-#define SDC_CMD0_RESET_CRC 0x95U
-#define SDC_CMD8_CHECK_VOLTAGE_CRC 0x87U
-
 #define DISK_INIT_RESET_ARG 0x1AAUL
 
 // 10 bytes = 80 clock transitions
@@ -73,7 +44,10 @@ STATIC_ASSERT(SDC_ACTION_NUM_ATTEMPTS_DEFAULT <= 255, "SDC_ACTION_NUM_ATTEMPTS_D
 
 #define SDC_DELAY_1MS pdMS_TO_TICKS(1)
 
-#define SDC_MOSI_HIGH 0xFFU  // Keep MOSI high during read operations
+// A sector takes 14 ms at the 300 kHz SPI clock
+#define SDC_DMA_TIMEOUT_MS 100U
+// One 1 ms tick at the 300 kHz SPI clock; scale with the clock
+#define SDC_POLL_SPIN_BYTES 40U
 
 /*---------------------------------------------*/
 /* Global Variables                            */
@@ -88,6 +62,20 @@ static spiDAT1_t sdcSpiConfig = {
     .CSNR = SPI_CS_NONE,
 };
 
+static obc_error_code_t sdcExchangeByte(uint8_t tx, uint8_t *rx);
+static obc_error_code_t sdcStartDma(uint16_t *tx, uint16_t *rx, size_t numFrames);
+static obc_error_code_t sdcWaitDma(void);
+static void sdcDelayMs(uint32_t ms);
+
+// Sectors are moved by DMA; commands, tokens and polling go through the byte path
+static const sdc_spi_ops_t sdcSpiOps = {
+    .exchangeByte = sdcExchangeByte,
+    .startDma = sdcStartDma,
+    .waitDma = sdcWaitDma,
+    .delayMs = sdcDelayMs,
+    .pollSpinBytes = SDC_POLL_SPIN_BYTES,
+};
+
 static volatile DSTATUS stat = STA_NOINIT; /* Disk status */
 static uint8_t cardType;                   /* Card type flags: b0:MMC, b1:SDC, b2:Block addressing */
 static sdc_power_t powerFlag = POWER_OFF;  /* indicates if "power" is on */
@@ -96,28 +84,18 @@ static sdc_power_t powerFlag = POWER_OFF;  /* indicates if "power" is on */
 /* SD Card Private Functions                   */
 /*---------------------------------------------*/
 
-/**
- * @brief Check if card is ready
- *
- * @return bool True if card is ready, false otherwise.
- */
-static bool isCardReady(void) {
-  obc_error_code_t errCode;
-
-  // Assume CS is already asserted
-
-  for (uint8_t i = 0; i < SDC_ACTION_NUM_ATTEMPTS_DEFAULT; i++) {
-    uint8_t res;
-
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, &res));
+static obc_error_code_t sdcExchangeByte(uint8_t tx, uint8_t *rx) {
+  return spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, tx, rx);
+}
 
-    if (res == 0xFF) return true;
+// DMA frames are written to SPIDAT0, which reuses the data format last set through SPIDAT1 by the byte path
+static obc_error_code_t sdcStartDma(uint16_t *tx, uint16_t *rx, size_t numFrames) {
+  return dmaSpiStartTransfer(SDC_SPI_REG, tx, rx, numFrames);
+}
 
-    vTaskDelay(SDC_DELAY_1MS);
-  }
+static obc_error_code_t sdcWaitDma(void) { return dmaSpiWaitTransfer(SDC_SPI_REG, SDC_DMA_TIMEOUT_MS); }
 
-  return false;
-}
+static void sdcDelayMs(uint32_t ms) { vTaskDelay(pdMS_TO_TICKS(ms)); }
 
 /**
  * @brief Send >74 clock transitions with CS and DI held high. This is
@@ -159,85 +137,6 @@ static void turnOffSDC(void) { powerFlag = POWER_OFF; }
  */
 static sdc_power_t checkPower(void) { return powerFlag; }
 
-/**
- * @brief Receive a data packet from the SD card.
- * @param buff Buffer to store the received data.
- * @param btr Number of bytes to receive (Must be an even number).
- * @return bool True if the packet was received successfully, false otherwise.
- */
-static bool rcvDataBlock(uint8_t *buff, uint32_t btr) {
-  obc_error_code_t errCode;
-
-  // Assume CS is already asserted
-
-  if (btr % 2 != 0)  // Must be an even number
-    return false;
-
-  uint8_t token = 0xFF;
-
-  /* Wait for a data packet */
-  for (uint8_t i = 0; i < SDC_ACTION_NUM_ATTEMPTS_DEFAULT; i++) {
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, &token));
-    if (token != 0xFF) break;
-    vTaskDelay(SDC_DELAY_1MS);
-  }
-
-  /* If not valid data token, return with error */
-  if (token != SDC_CMD17_DATA_TOKEN) return false;
-
-  /* Receive the data block into buffer */
-  while (btr) {
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, buff++));
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, buff++));
-    btr -= 2;
-  }
-
-  /* Discard CRC */
-  unsigned char crc;
-  LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, &crc));
-  LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, &crc));
-
-  return true;
-}
-
-#if _READONLY == 0
-
-/**
- * @brief Send a data packet to the SD card.
- * @param buff 512 uint8_t buffer containing the data to send.
- * @param token Data/Stop token.
- * @return bool True if the packet was sent successfully, false otherwise.
- */
-static bool sendDataBlock(const uint8_t *buff, uint8_t token) {
-  obc_error_code_t errCode;
-
-  // Assume CS is already asserted
-
-  if (!isCardReady()) return false;
-
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, token));  // Send token
-
-  if (token != SD_STOP_TRANSMISSION) {
-    for (unsigned int wc = 0; wc < SD_SECTOR_SIZE; wc++) {
-      // Send the data block
-      LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, *buff++));
-    }
-
-    // Send dummy CRC
-    LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, 0xFF));
-    LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, 0xFF));
-
-    uint8_t resp;
-    LOG_IF_ERROR_CODE(
-        spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, &resp)); /* Receive data response */
-    if ((resp & SD_DATA_RESPONSE_MASK) != SD_DATA_RESPONSE_ACCEPTED) return false;
-  }
-
-  return true;
-}
-
-#endif /* _READONLY */
-
 /**
  * @brief Send a command packet to the SD card.
  * @param cmd Command uint8_t.
@@ -245,79 +144,8 @@ static bool sendDataBlock(const uint8_t *buff, uint8_t token) {
  * @return uint8_t Response uint8_t.
  */
 static uint8_t sendCMD(uint8_t cmd, uint32_t arg) {
-  obc_error_code_t errCode;
   // Assume CS is already asserted
-
-  if (!isCardReady()) return 0xFFU;
-
-  /* Send command packet */
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, cmd));                  /* Command */
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, (uint8_t)(arg >> 24))); /* Argument[31..24] */
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, (uint8_t)(arg >> 16))); /* Argument[23..16] */
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, (uint8_t)(arg >> 8)));  /* Argument[15..8] */
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, (uint8_t)arg));         /* Argument[7..0] */
-
-  /* Some commands require a CRC to be sent */
-  uint8_t crc = 0xFFU;
-  if (cmd == SDC_CMD0) {
-    crc = SDC_CMD0_RESET_CRC;
-  } else if (cmd == SDC_CMD8) {
-    crc = SDC_CMD8_CHECK_VOLTAGE_CRC;
-  }
-
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, crc));
-
-  /* Skip a uint8_t after "stop reading" cmd is sent */
-  unsigned char tmp;
-  if (cmd == SDC_CMD12) {
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, &tmp));
-  }
-
-  /* Receive command response */
-  uint8_t res;
-  for (uint8_t i = 0; i < SDC_ACTION_NUM_ATTEMPTS_DEFAULT; i++) {
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, &res));
-    if (!(res & SDC_CMD_RESP_MASK)) break;
-    vTaskDelay(SDC_DELAY_1MS);
-  }
-
-  return res;
-}
-
-/**
- * @brief Send SDC_CMD12 to the SD card to stop a multi-block read.
- *
- * @return uint8_t Response uint8_t.
- */
-static uint8_t stopTransmission(void) {
-  obc_error_code_t errCode;
-
-  // Assume CS is already asserted
-
-  /* Send command packet - the argument for SDC_CMD12 is ignored. */
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, SDC_CMD12));
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, 0));
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, 0));
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, 0));
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, 0));
-  LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, 0));
-
-  /* Data transfer stops 2 bytes after 6-uint8_t SDC_CMD12 */
-  uint8_t val;
-  for (uint8_t i = 0; i < 2; i++) {
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, &val));
-  }
-
-  /* SDC should now send 2-6 0xFF bytes, the response uint8_t, and then another 0xFF */
-  /* Some cards don't send the 2-6 0xFF bytes */
-  uint8_t res;
-  const uint8_t numBytesRcv = 8U;
-  for (unsigned int n = 0; n < numBytesRcv; n++) {
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, &val));
-    if (val != 0xFF) res = val;
-  }
-
-  return res;
+  return sdcSendCmd(&sdcSpiOps, cmd, arg);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -476,19 +304,8 @@ DRESULT disk_read(uint8_t pdrv, uint8_t *buff, uint32_t sector, uint32_t count)
     return stat;
   }
 
-  if (count == 1) {
-    /* Single block read */
-    if ((sendCMD(SDC_CMD17, sector) == 0) && rcvDataBlock(buff, SD_SECTOR_SIZE)) count = 0;
-  } else {
-    /* Multiple block read */
-    if (sendCMD(SDC_CMD18, sector) == 0) {
-      do {
-        if (!rcvDataBlock(buff, SD_SECTOR_SIZE)) break;
-        buff += SD_SECTOR_SIZE;
-      } while (--count);
-      stopTransmission();
-    }
-  }
+  LOG_IF_ERROR_CODE(sdcReadSectors(&sdcSpiOps, sector, buff, count));
+  DRESULT res = (errCode == OBC_ERR_CODE_SUCCESS) ? RES_OK : RES_ERROR;
 
   LOG_IF_ERROR_CODE(deassertChipSelect(SDC_SPI_PORT, SDC_SPI_CS));
   if (errCode == OBC_ERR_CODE_SUCCESS) {
@@ -497,7 +314,7 @@ DRESULT disk_read(uint8_t pdrv, uint8_t *buff, uint32_t sector, uint32_t count)
   }
   LOG_IF_ERROR_CODE(spiReleaseBusMutex(SDC_SPI_REG));
 
-  return count ? RES_ERROR : RES_OK;
+  return res;
 }
 
 #if _READONLY == 0
@@ -529,26 +346,10 @@ DRESULT disk_write(uint8_t pdrv, const uint8_t *buff, uint32_t sector, uint32_t
     return stat;
   }
 
-  if (count == 1) {
-    /* Single block write */
-    if ((sendCMD(SDC_CMD24, sector) == 0) && sendDataBlock(buff, SDC_CMD24_DATA_TOKEN)) count = 0;
-  } else {
-    /* Multiple block write */
-    if (cardType & CARD_TYPE_SDC_MASK) {
-      sendCMD(SDC_CMD55, 0);
-      sendCMD(SDC_CMD23, count);
-    }
-
-    if (sendCMD(SDC_CMD25, sector) == 0) {
-      do {
-        if (!sendDataBlock(buff, SDC_CMD25_DATA_TOKEN)) break;
-        buff += SD_SECTOR_SIZE;
-      } while (--count);
-
-      // Send stop transmission token
-      if (!sendDataBlock(0, SD_STOP_TRANSMISSION)) count = 1;
-    }
-  }
+  // Only SD cards support pre-erasing with ACMD23
+  bool preErase = (cardType & CARD_TYPE_SDC_MASK) != 0;
+  LOG_IF_ERROR_CODE(sdcWriteSectors(&sdcSpiOps, sector, buff, count, preErase));
+  DRESULT res = (errCode == OBC_ERR_CODE_SUCCESS) ? RES_OK : RES_ERROR;
 
   LOG_IF_ERROR_CODE(deassertChipSelect(SDC_SPI_PORT, SDC_SPI_CS));
   if (errCode == OBC_ERR_CODE_SUCCESS) {
@@ -557,7 +358,7 @@ DRESULT disk_write(uint8_t pdrv, const uint8_t *buff, uint32_t sector, uint32_t
   }
   LOG_IF_ERROR_CODE(spiReleaseBusMutex(SDC_SPI_REG));
 
-  return count ? RES_ERROR : RES_OK;
+  return res;
 }
 #endif /* _READONLY */
 
@@ -619,7 +420,7 @@ DRESULT disk_ioctl(uint8_t pdrv, uint8_t ctrl, void *buff) {
       case GET_SECTOR_COUNT:
         /* Get number of sectors on the disk (uint32_t) */
         // Read from CSD register
-        if ((sendCMD(SDC_CMD9, 0) == 0) && rcvDataBlock(csd, csdSize)) {
+        if (sdcReadRegister(&sdcSpiOps, SDC_CMD9, csd, csdSize) == OBC_ERR_CODE_SUCCESS) {
           // Check if SDCv2+ or SDCv1/MMC
           uint8_t csdStructField = (csd[0] >> 6);  // 1 = SDCv2, 0 = SDCv1/MMC
           if (csdStructField == 1) {
@@ -646,7 +447,7 @@ DRESULT disk_ioctl(uint8_t pdrv, uint8_t ctrl, void *buff) {
         break;
       case CTRL_SYNC:
         /* Make sure that data has been written */
-        if (isCardReady()) res = RES_OK;
+        if (sdcWaitReady(&sdcSpiOps) == OBC_ERR_CODE_SUCCESS) res = RES_OK;
         break;
       default:
         res = RES_PARERR;
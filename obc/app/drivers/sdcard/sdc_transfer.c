@@ -0,0 +1,329 @@
+#include "sdc_transfer.h"
+#include "obc_gs_crc.h"
+#include "obc_logging.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SDC_POLL_SLEEP_ATTEMPTS 50U
+#define SDC_POLL_SLEEP_MS 1U
+
+#define SDC_CRC_BYTES 2U
+#define SDC_CMD_PACKET_SIZE 6U
+
+// A sector read is polled up to its token, then the data block and CRC are moved in one transfer
+#define SDC_READ_PACKET_FRAMES (SD_SECTOR_SIZE + SDC_CRC_BYTES)
+// A sector write moves the token, data block and CRC, and clocks in the data response that follows them
+#define SDC_WRITE_PACKET_FRAMES (1U + SD_SECTOR_SIZE + SDC_CRC_BYTES + 1U)
+#define SDC_WRITE_RESPONSE_FRAME (SDC_WRITE_PACKET_FRAMES - 1U)
+
+typedef enum {
+  SDC_POLL_READY,     // Card holds MISO low while busy
+  SDC_POLL_TOKEN,     // First byte that is not 0xFF starts a data packet
+  SDC_POLL_RESPONSE,  // Command responses have the top bit clear
+} sdc_poll_t;
+
+// Ping-pong frame buffers: one sector is on the bus while the other is packed or unpacked
+static uint16_t txFrames[2][SDC_WRITE_PACKET_FRAMES];
+static uint16_t rxFrames[2][SDC_WRITE_PACKET_FRAMES];
+
+static bool isPollDone(sdc_poll_t poll, uint8_t byte) {
+  switch (poll) {
+    case SDC_POLL_READY:
+      return byte == 0xFFU;
+    case SDC_POLL_TOKEN:
+      return byte != 0xFFU;
+    default:
+      return (byte & SDC_CMD_RESP_MASK) == 0;
+  }
+}
+
+static obc_error_code_t pollByte(const sdc_spi_ops_t *ops, sdc_poll_t poll, uint8_t *byte) {
+  obc_error_code_t errCode;
+
+  for (uint32_t i = 0; i < ops->pollSpinBytes + SDC_POLL_SLEEP_ATTEMPTS; i++) {
+    if (i >= ops->pollSpinBytes) {
+      ops->delayMs(SDC_POLL_SLEEP_MS);
+    }
+    RETURN_IF_ERROR_CODE(ops->exchangeByte(SDC_MOSI_HIGH, byte));
+    if (isPollDone(poll, *byte)) {
+      return OBC_ERR_CODE_SUCCESS;
+    }
+  }
+
+  return OBC_ERR_CODE_SD_CARD_TIMEOUT;
+}
+
+static obc_error_code_t startFrames(const sdc_spi_ops_t *ops, uint16_t *tx, uint16_t *rx, size_t numFrames) {
+  obc_error_code_t errCode;
+
+  if (ops->startDma != NULL) {
+    return ops->startDma(tx, rx, numFrames);
+  }
+
+  for (size_t i = 0; i < numFrames; i++) {
+    uint8_t byte;
+    RETURN_IF_ERROR_CODE(ops->exchangeByte((uint8_t)tx[i], &byte));
+    rx[i] = byte;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t waitFrames(const sdc_spi_ops_t *ops) {
+  if (ops->startDma != NULL) {
+    return ops->waitDma();
+  }
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static void packSector(uint16_t *frames, uint8_t token, const uint8_t *data) {
+  frames[0] = token;
+  for (uint32_t i = 0; i < SD_SECTOR_SIZE; i++) {
+    frames[1 + i] = data[i];
+  }
+
+  uint16_t crc = crc16CcittUpdate(0, data, SD_SECTOR_SIZE);
+  frames[1 + SD_SECTOR_SIZE] = (uint8_t)(crc >> 8);
+  frames[2 + SD_SECTOR_SIZE] = (uint8_t)crc;
+  frames[SDC_WRITE_RESPONSE_FRAME] = SDC_MOSI_HIGH;
+}
+
+static obc_error_code_t unpackSector(const uint16_t *frames, uint8_t *data) {
+  for (uint32_t i = 0; i < SD_SECTOR_SIZE; i++) {
+    data[i] = (uint8_t)frames[i];
+  }
+
+#if SDC_CHECK_READ_CRC
+  uint16_t crc = (uint16_t)(((frames[SD_SECTOR_SIZE] & 0xFFU) << 8) | (frames[SD_SECTOR_SIZE + 1] & 0xFFU));
+  if (crc16CcittUpdate(0, data, SD_SECTOR_SIZE) != crc) {
+    return OBC_ERR_CODE_SD_CARD_CRC_MISMATCH;
+  }
+#endif
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t receiveSectors(const sdc_spi_ops_t *ops, uint8_t *buff, uint32_t count) {
+  obc_error_code_t errCode;
+  uint8_t cur = 0;
+
+  for (uint32_t i = 0; i < SDC_READ_PACKET_FRAMES; i++) {
+    txFrames[0][i] = SDC_MOSI_HIGH;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t token;
+    RETURN_IF_ERROR_CODE(pollByte(ops, SDC_POLL_TOKEN, &token));
+    if (token != SDC_CMD18_DATA_TOKEN) {
+      return OBC_ERR_CODE_SD_CARD_INVALID_DATA_TOKEN;
+    }
+
+    RETURN_IF_ERROR_CODE(startFrames(ops, txFrames[0], rxFrames[cur], SDC_READ_PACKET_FRAMES));
+
+    // Unpack the previous sector while this one is clocked in
+    obc_error_code_t unpackErrCode = OBC_ERR_CODE_SUCCESS;
+    if (i > 0) {
+      unpackErrCode = unpackSector(rxFrames[cur ^ 1U], buff + (i - 1) * SD_SECTOR_SIZE);
+    }
+
+    RETURN_IF_ERROR_CODE(waitFrames(ops));
+    RETURN_IF_ERROR_CODE(unpackErrCode);
+    cur ^= 1U;
+  }
+
+  return unpackSector(rxFrames[cur ^ 1U], buff + (count - 1) * SD_SECTOR_SIZE);
+}
+
+static obc_error_code_t sendSectors(const sdc_spi_ops_t *ops, const uint8_t *buff, uint32_t count, uint8_t token) {
+  obc_error_code_t errCode;
+  uint8_t cur = 0;
+
+  packSector(txFrames[cur], token, buff);
+
+  for (uint32_t i = 0; i < count; i++) {
+    // Wait for the card to finish programming the previous sector
+    RETURN_IF_ERROR_CODE(sdcWaitReady(ops));
+    RETURN_IF_ERROR_CODE(startFrames(ops, txFrames[cur], rxFrames[cur], SDC_WRITE_PACKET_FRAMES));
+
+    // Pack the next sector while this one is clocked out
+    if (i + 1 < count) {
+      packSector(txFrames[cur ^ 1U], token, buff + (i + 1) * SD_SECTOR_SIZE);
+    }
+
+    RETURN_IF_ERROR_CODE(waitFrames(ops));
+    if ((rxFrames[cur][SDC_WRITE_RESPONSE_FRAME] & SD_DATA_RESPONSE_MASK) != SD_DATA_RESPONSE_ACCEPTED) {
+      return OBC_ERR_CODE_SD_CARD_WRITE_REJECTED;
+    }
+    cur ^= 1U;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Send CMD12 to stop a multi-block read
+ *
+ * @return uint8_t R1 response; 0xFF if none was found
+ */
+static uint8_t stopTransmission(const sdc_spi_ops_t *ops) {
+  obc_error_code_t errCode;
+
+  /* Send command packet - the argument for SDC_CMD12 is ignored. */
+  const uint8_t packet[SDC_CMD_PACKET_SIZE] = {SDC_CMD12, 0, 0, 0, 0, 0};
+  uint8_t val;
+  for (uint8_t i = 0; i < SDC_CMD_PACKET_SIZE; i++) {
+    LOG_IF_ERROR_CODE(ops->exchangeByte(packet[i], &val));
+  }
+
+  /* Data transfer stops 2 bytes after 6-uint8_t SDC_CMD12 */
+  for (uint8_t i = 0; i < 2; i++) {
+    LOG_IF_ERROR_CODE(ops->exchangeByte(SDC_MOSI_HIGH, &val));
+  }
+
+  /* SDC should now send 2-6 0xFF bytes, the response uint8_t, and then another 0xFF */
+  /* Some cards don't send the 2-6 0xFF bytes */
+  uint8_t res = 0xFFU;
+  const uint8_t numBytesRcv = 8U;
+  for (uint8_t n = 0; n < numBytesRcv; n++) {
+    LOG_IF_ERROR_CODE(ops->exchangeByte(SDC_MOSI_HIGH, &val));
+    if (val != 0xFF) res = val;
+  }
+
+  return res;
+}
+
+obc_error_code_t sdcWaitReady(const sdc_spi_ops_t *ops) {
+  if (ops == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  uint8_t byte;
+  return pollByte(ops, SDC_POLL_READY, &byte);
+}
+
+uint8_t sdcSendCmd(const sdc_spi_ops_t *ops, uint8_t cmd, uint32_t arg) {
+  obc_error_code_t errCode;
+
+  LOG_IF_ERROR_CODE(sdcWaitReady(ops));
+  if (errCode != OBC_ERR_CODE_SUCCESS) {
+    return 0xFFU;
+  }
+
+  /* Some commands require a CRC to be sent */
+  uint8_t crc = 0xFFU;
+  if (cmd == SDC_CMD0) {
+    crc = SDC_CMD0_RESET_CRC;
+  } else if (cmd == SDC_CMD8) {
+    crc = SDC_CMD8_CHECK_VOLTAGE_CRC;
+  }
+
+  const uint8_t packet[SDC_CMD_PACKET_SIZE] = {cmd, (uint8_t)(arg >> 24), (uint8_t)(arg >> 16), (uint8_t)(arg >> 8),
+                                               (uint8_t)arg, crc};
+  uint8_t res;
+  for (uint8_t i = 0; i < SDC_CMD_PACKET_SIZE; i++) {
+    LOG_IF_ERROR_CODE(ops->exchangeByte(packet[i], &res));
+  }
+
+  /* Skip a uint8_t after "stop reading" cmd is sent */
+  if (cmd == SDC_CMD12) {
+    LOG_IF_ERROR_CODE(ops->exchangeByte(SDC_MOSI_HIGH, &res));
+  }
+
+  /* Receive command response */
+  res = 0xFFU;
+  LOG_IF_ERROR_CODE(pollByte(ops, SDC_POLL_RESPONSE, &res));
+
+  return res;
+}
+
+obc_error_code_t sdcReadRegister(const sdc_spi_ops_t *ops, uint8_t cmd, uint8_t *buff, uint32_t len) {
+  obc_error_code_t errCode;
+
+  if (ops == NULL || buff == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (sdcSendCmd(ops, cmd, 0) != 0) {
+    return OBC_ERR_CODE_SD_CARD_CMD_REJECTED;
+  }
+
+  uint8_t token;
+  RETURN_IF_ERROR_CODE(pollByte(ops, SDC_POLL_TOKEN, &token));
+  if (token != SDC_CMD17_DATA_TOKEN) {
+    return OBC_ERR_CODE_SD_CARD_INVALID_DATA_TOKEN;
+  }
+
+  for (uint32_t i = 0; i < len; i++) {
+    RETURN_IF_ERROR_CODE(ops->exchangeByte(SDC_MOSI_HIGH, &buff[i]));
+  }
+
+  /* Discard CRC */
+  uint8_t crc;
+  for (uint8_t i = 0; i < SDC_CRC_BYTES; i++) {
+    RETURN_IF_ERROR_CODE(ops->exchangeByte(SDC_MOSI_HIGH, &crc));
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t sdcReadSectors(const sdc_spi_ops_t *ops, uint32_t addr, uint8_t *buff, uint32_t count) {
+  if (ops == NULL || buff == NULL || count == 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (count == 1) {
+    if (sdcSendCmd(ops, SDC_CMD17, addr) != 0) {
+      return OBC_ERR_CODE_SD_CARD_CMD_REJECTED;
+    }
+    return receiveSectors(ops, buff, 1);
+  }
+
+  if (sdcSendCmd(ops, SDC_CMD18, addr) != 0) {
+    return OBC_ERR_CODE_SD_CARD_CMD_REJECTED;
+  }
+
+  obc_error_code_t errCode = receiveSectors(ops, buff, count);
+
+  // The card streams sectors until it is stopped, even after an error. The CMD12 response is not checked since
+  // cards may flag an out of range error for the sector they had started to fetch after the last one.
+  stopTransmission(ops);
+
+  return errCode;
+}
+
+obc_error_code_t sdcWriteSectors(const sdc_spi_ops_t *ops, uint32_t addr, const uint8_t *buff, uint32_t count,
+                                 bool preErase) {
+  obc_error_code_t errCode;
+
+  if (ops == NULL || buff == NULL || count == 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (count == 1) {
+    if (sdcSendCmd(ops, SDC_CMD24, addr) != 0) {
+      return OBC_ERR_CODE_SD_CARD_CMD_REJECTED;
+    }
+    return sendSectors(ops, buff, 1, SDC_CMD24_DATA_TOKEN);
+  }
+
+  if (preErase) {
+    // ACMD23: CMD55 followed by CMD23
+    sdcSendCmd(ops, SDC_CMD55, 0);
+    sdcSendCmd(ops, SDC_CMD23, count);
+  }
+
+  if (sdcSendCmd(ops, SDC_CMD25, addr) != 0) {
+    return OBC_ERR_CODE_SD_CARD_CMD_REJECTED;
+  }
+
+  obc_error_code_t sendErrCode = sendSectors(ops, buff, count, SDC_CMD25_DATA_TOKEN);
+
+  // The stop token ends the transfer, including after a rejected sector
+  uint8_t unused;
+  RETURN_IF_ERROR_CODE(sdcWaitReady(ops));
+  RETURN_IF_ERROR_CODE(ops->exchangeByte(SD_STOP_TRANSMISSION, &unused));
+
+  return sendErrCode;
+}
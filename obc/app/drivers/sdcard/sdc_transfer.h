@@ -0,0 +1,135 @@
+#pragma once
+
+#include "obc_errors.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*---------------------------------------------*/
+/* SD Card Definitions                         */
+/*---------------------------------------------*/
+
+#define SDC_CMD_BASE 0x40U
+#define SDC_CMD0 (SDC_CMD_BASE)       /* GO_IDLE_STATE */
+#define SDC_CMD1 (SDC_CMD_BASE + 1)   /* SEND_OP_COND */
+#define SDC_CMD8 (SDC_CMD_BASE + 8)   /* SEND_IF_COND */
+#define SDC_CMD9 (SDC_CMD_BASE + 9)   /* SEND_CSD */
+#define SDC_CMD10 (SDC_CMD_BASE + 10) /* SEND_CID */
+#define SDC_CMD12 (SDC_CMD_BASE + 12) /* STOP_TRANSMISSION */
+#define SDC_CMD16 (SDC_CMD_BASE + 16) /* SET_BLOCKLEN */
+#define SDC_CMD17 (SDC_CMD_BASE + 17) /* READ_SINGLE_BLOCK */
+#define SDC_CMD18 (SDC_CMD_BASE + 18) /* READ_MULTIPLE_BLOCK */
+#define SDC_CMD23 (SDC_CMD_BASE + 23) /* SET_BLOCK_COUNT */
+#define SDC_CMD24 (SDC_CMD_BASE + 24) /* WRITE_BLOCK */
+#define SDC_CMD25 (SDC_CMD_BASE + 25) /* WRITE_MULTIPLE_BLOCK */
+#define SDC_CMD41 (SDC_CMD_BASE + 41) /* SEND_OP_COND (ACMD) */
+#define SDC_CMD55 (SDC_CMD_BASE + 55) /* APP_CMD */
+#define SDC_CMD58 (SDC_CMD_BASE + 58) /* READ_OCR */
+
+#define SD_SECTOR_SIZE 512U
+#define SD_STOP_TRANSMISSION 0xFDU
+#define SD_DATA_RESPONSE_MASK 0x1FU
+#define SD_DATA_RESPONSE_ACCEPTED 0x05U
+
+#define SDC_CMD17_DATA_TOKEN 0xFEU
+#define SDC_CMD18_DATA_TOKEN 0xFEU
+#define SDC_CMD24_DATA_TOKEN 0xFEU
+#define SDC_CMD25_DATA_TOKEN 0xFCU
+
+#define SDC_CMD_RESP_MASK 0x80U
+
+#define SDC_CMD0_RESET_CRC 0x95U
+#define SDC_CMD8_CHECK_VOLTAGE_CRC 0x87U
+
+#define SDC_MOSI_HIGH 0xFFU  // Keep MOSI high during read operations
+
+// Verify the CRC16 the card sends with each sector read. The card computes it even when CRC checking is off.
+#ifndef SDC_CHECK_READ_CRC
+#define SDC_CHECK_READ_CRC 1
+#endif
+
+/**
+ * @brief SPI access used by the SD card protocol, so the same protocol code runs on the RM46 SPI and DMA drivers and
+ * against a simulated card on the host. The caller owns the bus and keeps the chip select asserted.
+ */
+typedef struct {
+  // Clock one byte out to the card and return the byte clocked in
+  obc_error_code_t (*exchangeByte)(uint8_t tx, uint8_t *rx);
+  // Start clocking numFrames frames, one byte in the low half of each; NULL to move data packets a byte at a time
+  obc_error_code_t (*startDma)(uint16_t *tx, uint16_t *rx, size_t numFrames);
+  // Wait for the transfer started by startDma
+  obc_error_code_t (*waitDma)(void);
+  // Sleep between polls of a card that is slow to respond
+  void (*delayMs)(uint32_t ms);
+  // Polls clocked back to back before sleeping between polls. About a tick's worth of bytes at the SPI clock keeps a
+  // card that is busy for a fraction of a tick from costing a whole one.
+  uint32_t pollSpinBytes;
+} sdc_spi_ops_t;
+
+/**
+ * @brief Poll the card until it is no longer busy
+ *
+ * @param ops SPI access to the card
+ * @return obc_error_code_t OBC_ERR_CODE_SD_CARD_TIMEOUT if the card stays busy
+ */
+obc_error_code_t sdcWaitReady(const sdc_spi_ops_t *ops);
+
+/**
+ * @brief Send a command packet to the SD card
+ *
+ * @param ops SPI access to the card
+ * @param cmd Command byte
+ * @param arg Argument
+ * @return uint8_t R1 response; 0xFF if the card did not respond
+ */
+uint8_t sdcSendCmd(const sdc_spi_ops_t *ops, uint8_t cmd, uint32_t arg);
+
+/**
+ * @brief Read a register sent as a data packet, such as the CSD or CID
+ *
+ * @param ops SPI access to the card
+ * @param cmd Command that reads the register
+ * @param buff Buffer for the register
+ * @param len Size of the register in bytes
+ * @return obc_error_code_t Whether the register was read
+ */
+obc_error_code_t sdcReadRegister(const sdc_spi_ops_t *ops, uint8_t cmd, uint8_t *buff, uint32_t len);
+
+/**
+ * @brief Read sectors with CMD17, or CMD18 and CMD12 for more than one sector
+ *
+ * Each sector is moved in one transfer. While a sector is clocked in, the previous one is unpacked from its frames
+ * and its CRC is checked.
+ *
+ * @param ops SPI access to the card
+ * @param addr Card address of the first sector; a sector number or a byte address depending on the card type
+ * @param buff Buffer for count sectors
+ * @param count Number of sectors
+ * @return obc_error_code_t Whether every sector was read
+ */
+obc_error_code_t sdcReadSectors(const sdc_spi_ops_t *ops, uint32_t addr, uint8_t *buff, uint32_t count);
+
+/**
+ * @brief Write sectors with CMD24, or CMD25 and a stop token for more than one sector
+ *
+ * Each sector is moved in one transfer along with its token, CRC and data response. While a sector is clocked out,
+ * the next one is packed into frames and its CRC is computed.
+ *
+ * @param ops SPI access to the card
+ * @param addr Card address of the first sector; a sector number or a byte address depending on the card type
+ * @param buff count sectors to write
+ * @param count Number of sectors
+ * @param preErase Send ACMD23 before a multiple sector write so the card can erase the whole range up front
+ * @return obc_error_code_t Whether every sector was accepted
+ */
+obc_error_code_t sdcWriteSectors(const sdc_spi_ops_t *ops, uint32_t addr, const uint8_t *buff, uint32_t count,
+                                 bool preErase);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,8 +3,16 @@
 #include "obc_logging.h"
 #include "obc_sci_io.h"
 #include "vn100.h"
+#include "vn100_stream.h"
+#include "obc_byte_ring.h"
+#include "obc_seqlock.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+#include <os_timer.h>
 
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -15,8 +23,6 @@
 #define MAX_BAUDRATE_LENGTH 7U
 #define MAX_OUTPUT_RATE_LENGTH 3U
 #define DEFAULT_OUTPUT_RATE_HZ 20U
-#define SCI_SEMAPHORE_TIMEOUT_MS \
-  50U /* Time between successive sensor outputs (period): 1/output rate = 1/20Hz = 0.05s = 50ms */
 
 /* Building start and stop binary output comands */
 #define BINARY_OUTPUT_START_PREFIX "$VNWRG,75,2,"  // Configure write command to output on register 75 and serial port 2
@@ -31,11 +37,45 @@
 #define STOP_BINARY_OUTPUTS \
   BINARY_OUTPUT_STOP_PREFIX BINARY_OUTPUT_RATE_DIVISOR BINARY_OUTPUT_POSTFIX /* $VNWRG,75,0,80,01,0528*XX\r\n */
 
+/* Binary output reception */
+#define VN100_RX_RING_SIZE 256U  // Four packets, a power of 2 for the byte ring
+#define VN100_PACKET_MAX_AGE_MS 150U  // Three output periods; an older packet is reported as no data
+#define VN100_READ_ATTEMPTS 4U
+
+typedef struct {
+  vn100_binary_packet_t packet;
+  TickType_t receivedTicks;
+  bool valid;
+} vn100_latest_packet_t;
+
+// Bytes from the receive interrupt, drained by the timer service task
+static uint8_t vn100RxRingBuffer[VN100_RX_RING_SIZE];
+static obc_byte_ring_t vn100RxRing;
+static volatile bool vn100DrainPending = false;
+static volatile uint32_t vn100DrainThreshold = VN100_BINARY_PACKET_SIZE;
+static uint32_t vn100RxOverruns = 0;
+
+static vn100_stream_parser_t vn100Parser;
+
+// Latest valid packet, written by the timer service task and read by the GNC task without blocking
+static obc_seqlock_t vn100LatestLock;
+static vn100_latest_packet_t vn100Latest;
+
 static obc_error_code_t isValidBaudRate(uint32_t baudRate);
 
 static obc_error_code_t isValidOutputRate(uint32_t outputRateHz);
 
+static void vn100RxByteHandler(uint8_t byte, BaseType_t* higherPriorityTaskWoken);
+
+static void vn100DrainRx(void* pvParameter1, uint32_t ulParameter2);
+
+static void vn100PublishPacket(const vn100_binary_packet_t* packet, void* context);
+
 void initVn100(void) {
+  byteRingInit(&vn100RxRing, vn100RxRingBuffer, VN100_RX_RING_SIZE);
+  vn100StreamParserInit(&vn100Parser);
+  seqlockInit(&vn100LatestLock);
+
   sciSetBaudrate(UART_VN100_REG, VN100_DEFAULT_BAUDRATE);
 
   vn100SetBaudrate(VN100_DEFAULT_BAUDRATE);
@@ -45,6 +85,9 @@ void initVn100(void) {
   vn100SetOutputRate(DEFAULT_OUTPUT_RATE_HZ);
 
   vn100ResumeAsync();
+
+  // Any replies to the commands above are skipped by the parser while it hunts for the first packet
+  sciStartStreamReceive(UART_VN100_REG, vn100RxByteHandler, MUTEX_TIMEOUT);
 }
 
 obc_error_code_t vn100ResetModule(void) {
@@ -152,15 +195,65 @@ obc_error_code_t vn100ReadBinaryOutputs(vn100_binary_packet_t* parsedPacket) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
 
-  unsigned char buf[VN100_BINARY_PACKET_SIZE] = {'\0'};
-  obc_error_code_t errCode;
-  RETURN_IF_ERROR_CODE(sciReadBytes(buf, VN100_BINARY_PACKET_SIZE, portMAX_DELAY,
-                                    pdMS_TO_TICKS(SCI_SEMAPHORE_TIMEOUT_MS), UART_VN100_REG));
+  vn100_latest_packet_t latest;
+  bool consistent = false;
+
+  for (uint32_t attempt = 0; attempt < VN100_READ_ATTEMPTS && !consistent; attempt++) {
+    consistent = seqlockTryRead(&vn100LatestLock, &vn100Latest, &latest, sizeof(latest));
+    if (!consistent) {
+      // The writer was preempted mid-write; it runs at the GNC task's priority, so let it finish
+      taskYIELD();
+    }
+  }
 
-  RETURN_IF_ERROR_CODE(vn100ParsePacket(buf, VN100_BINARY_PACKET_SIZE, parsedPacket));
+  if (!consistent || !latest.valid ||
+      (xTaskGetTickCount() - latest.receivedTicks) > pdMS_TO_TICKS(VN100_PACKET_MAX_AGE_MS)) {
+    return OBC_ERR_CODE_VN100_NO_DATA;
+  }
+
+  *parsedPacket = latest.packet;
   return OBC_ERR_CODE_SUCCESS;
 }
 
+static void vn100RxByteHandler(uint8_t byte, BaseType_t* higherPriorityTaskWoken) {
+  if (byteRingWrite(&vn100RxRing, &byte, 1) != 1) {
+    vn100RxOverruns++;
+  }
+
+  // Wake the drain only once enough bytes are waiting to finish a packet, rather than for every byte
+  if (!vn100DrainPending && byteRingBytesUsed(&vn100RxRing) >= vn100DrainThreshold) {
+    vn100DrainPending = true;
+    if (xTimerPendFunctionCallFromISR(vn100DrainRx, NULL, 0, higherPriorityTaskWoken) != pdPASS) {
+      vn100DrainPending = false;
+    }
+  }
+}
+
+/**
+ * @brief Parse the bytes waiting in the receive ring; runs in the timer service task
+ */
+static void vn100DrainRx(void* pvParameter1, uint32_t ulParameter2) {
+  vn100DrainPending = false;
+
+  do {
+    const uint8_t* data;
+    uint32_t dataLen;
+    while ((dataLen = byteRingPeekContiguous(&vn100RxRing, &data)) > 0) {
+      vn100StreamParserPush(&vn100Parser, data, dataLen, vn100PublishPacket, NULL);
+      byteRingConsume(&vn100RxRing, dataLen);
+    }
+
+    vn100DrainThreshold = vn100StreamParserBytesNeeded(&vn100Parser);
+
+    // Bytes that arrived before the new threshold was set were checked against the old one
+  } while (byteRingBytesUsed(&vn100RxRing) >= vn100DrainThreshold);
+}
+
+static void vn100PublishPacket(const vn100_binary_packet_t* packet, void* context) {
+  vn100_latest_packet_t latest = {.packet = *packet, .receivedTicks = xTaskGetTickCount(), .valid = true};
+  seqlockWrite(&vn100LatestLock, &vn100Latest, &latest, sizeof(latest));
+}
+
 obc_error_code_t vn100PauseAsync(void) {
   obc_error_code_t errCode;
   unsigned char command[] = "$VNASY,0*XX\r\n";
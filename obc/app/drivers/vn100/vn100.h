@@ -85,9 +85,12 @@ obc_error_code_t vn100StartBinaryOutputs(void);
 obc_error_code_t vn100StopBinaryOutputs(void);
 
 /**
- * @brief Reads all incoming asyncronous binary output data.
+ * @brief Get the latest valid binary output packet without blocking.
+ *
+ * Packets are received in the background once initVn100 has run. The receiver hunts for the packet header and
+ * checks the CRC, so lost or corrupted bytes only cost the packets they touch.
  *
  * @param parsedPacket Pointer to the packet to store data in.
- * @return OBC_ERR_CODE_SUCCESS on success, else an error code
+ * @return OBC_ERR_CODE_SUCCESS on success, OBC_ERR_CODE_VN100_NO_DATA if no valid packet has been received recently
  */
 obc_error_code_t vn100ReadBinaryOutputs(vn100_binary_packet_t* parsedPacket);
@@ -10,7 +10,7 @@
 #define VN100_BINARY_CRC_SIZE 2U
 #define VN100_BINARY_PAYLOAD_SIZE 56U  // Size excluding header and CRC
 #define VN100_BINARY_PACKET_SIZE \
-  VN100_BINARY_HEADER_SIZE + VN100_BINARY_PAYLOAD_SIZE + VN100_BINARY_CRC_SIZE  // Total Size
+  (VN100_BINARY_HEADER_SIZE + VN100_BINARY_PAYLOAD_SIZE + VN100_BINARY_CRC_SIZE)  // Total Size
 
 typedef struct {
   float yaw;
@@ -0,0 +1,119 @@
+#include "vn100_stream.h"
+#include "vn100_binary_parsing.h"
+#include "obc_errors.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define VN100_SYNC_BYTE 0xFAU
+
+// Sync byte, output group 1 and the group 1 fields (0x0528, little endian) set up by vn100StartBinaryOutputs
+static const uint8_t vn100Header[VN100_BINARY_HEADER_SIZE] = {VN100_SYNC_BYTE, 0x01U, 0x28U, 0x05U};
+
+static bool matchesHeader(const uint8_t *data, uint32_t dataLen);
+static void resync(vn100_stream_parser_t *parser);
+
+void vn100StreamParserInit(vn100_stream_parser_t *parser) {
+  if (parser == NULL) {
+    return;
+  }
+
+  parser->packetLen = 0;
+  parser->packets = 0;
+  parser->crcErrors = 0;
+  parser->bytesDiscarded = 0;
+}
+
+obc_error_code_t vn100StreamParserPush(vn100_stream_parser_t *parser, const uint8_t *data, uint32_t dataLen,
+                                       vn100_packet_callback_t callback, void *context) {
+  if (parser == NULL || data == NULL || callback == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  const uint8_t *cursor = data;
+  const uint8_t *end = data + dataLen;
+
+  while (cursor < end) {
+    if (parser->packetLen == 0) {
+      const uint8_t *sync = memchr(cursor, VN100_SYNC_BYTE, (size_t)(end - cursor));
+      if (sync == NULL) {
+        parser->bytesDiscarded += (uint32_t)(end - cursor);
+        break;
+      }
+
+      parser->bytesDiscarded += (uint32_t)(sync - cursor);
+      cursor = sync;
+    }
+
+    if (parser->packetLen < VN100_BINARY_HEADER_SIZE) {
+      // Check the header a byte at a time so a false sync byte is dropped as soon as it is seen
+      parser->packet[parser->packetLen++] = *cursor++;
+      if (!matchesHeader(parser->packet, parser->packetLen)) {
+        resync(parser);
+      }
+      continue;
+    }
+
+    uint32_t copyLen = VN100_BINARY_PACKET_SIZE - parser->packetLen;
+    if (copyLen > (uint32_t)(end - cursor)) {
+      copyLen = (uint32_t)(end - cursor);
+    }
+
+    memcpy(parser->packet + parser->packetLen, cursor, copyLen);
+    parser->packetLen += copyLen;
+    cursor += copyLen;
+
+    if (parser->packetLen == VN100_BINARY_PACKET_SIZE) {
+      vn100_binary_packet_t parsedPacket;
+      if (vn100ParsePacket(parser->packet, VN100_BINARY_PACKET_SIZE, &parsedPacket) == OBC_ERR_CODE_SUCCESS) {
+        parser->packets++;
+        parser->packetLen = 0;
+        callback(&parsedPacket, context);
+      } else {
+        parser->crcErrors++;
+        resync(parser);
+      }
+    }
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+uint32_t vn100StreamParserBytesNeeded(const vn100_stream_parser_t *parser) {
+  if (parser == NULL || parser->packetLen == 0) {
+    return VN100_BINARY_PACKET_SIZE;
+  }
+
+  return VN100_BINARY_PACKET_SIZE - parser->packetLen;
+}
+
+/**
+ * @brief Check that data matches as much of the header as it covers
+ */
+static bool matchesHeader(const uint8_t *data, uint32_t dataLen) {
+  uint32_t compareLen = (dataLen < VN100_BINARY_HEADER_SIZE) ? dataLen : VN100_BINARY_HEADER_SIZE;
+  return memcmp(data, vn100Header, compareLen) == 0;
+}
+
+/**
+ * @brief Drop the candidate packet's start and restart from the next header inside it, if there is one
+ *
+ * The bytes of a rejected packet may hold the start of the next packet when a byte was lost, so they are searched
+ * rather than thrown away.
+ */
+static void resync(vn100_stream_parser_t *parser) {
+  uint32_t start = 1;
+
+  for (; start < parser->packetLen; start++) {
+    if (parser->packet[start] == VN100_SYNC_BYTE &&
+        matchesHeader(&parser->packet[start], parser->packetLen - start)) {
+      break;
+    }
+  }
+
+  parser->bytesDiscarded += start;
+  parser->packetLen -= start;
+  memmove(parser->packet, parser->packet + start, parser->packetLen);
+}
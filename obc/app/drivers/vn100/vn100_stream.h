@@ -0,0 +1,65 @@
+#pragma once
+
+#include "obc_errors.h"
+#include "vn100_binary_parsing.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Called for each valid packet found by the stream parser
+ *
+ * @param packet The parsed packet; only valid for the duration of the call
+ * @param context The context pointer passed to vn100StreamParserPush
+ */
+typedef void (*vn100_packet_callback_t)(const vn100_binary_packet_t *packet, void *context);
+
+/**
+ * @brief Splits a stream of received bytes into VN100 binary packets
+ *
+ * A packet starts with the sync byte and the group header configured by vn100StartBinaryOutputs, and must pass its
+ * CRC. After a lost or corrupted byte the parser hunts for the next header, including inside the rejected packet, so
+ * it loses at most the packets the bad bytes touched.
+ */
+typedef struct {
+  uint8_t packet[VN100_BINARY_PACKET_SIZE];  // Candidate packet carried over from earlier pushes
+  uint16_t packetLen;                        // Number of bytes in packet
+  uint32_t packets;                          // Valid packets parsed
+  uint32_t crcErrors;                        // Candidate packets dropped for a bad CRC
+  uint32_t bytesDiscarded;                   // Bytes skipped while hunting for a header
+} vn100_stream_parser_t;
+
+/**
+ * @brief Reset the parser so it hunts for a header
+ *
+ * @param parser The parser to reset
+ */
+void vn100StreamParserInit(vn100_stream_parser_t *parser);
+
+/**
+ * @brief Scan a span of received bytes and report every valid packet it completes
+ *
+ * @param parser The parser holding state between pushes
+ * @param data The received bytes
+ * @param dataLen Number of bytes in data
+ * @param callback Called once per valid packet
+ * @param context Passed through to callback
+ * @return obc_error_code_t OBC_ERR_CODE_INVALID_ARG if a pointer is NULL
+ */
+obc_error_code_t vn100StreamParserPush(vn100_stream_parser_t *parser, const uint8_t *data, uint32_t dataLen,
+                                       vn100_packet_callback_t callback, void *context);
+
+/**
+ * @brief Get the number of bytes that could complete the candidate packet
+ *
+ * @param parser The parser to check
+ * @return uint32_t Bytes still missing from the candidate packet, or a whole packet while hunting for a header
+ */
+uint32_t vn100StreamParserBytesNeeded(const vn100_stream_parser_t *parser);
+
+#ifdef __cplusplus
+}
+#endif
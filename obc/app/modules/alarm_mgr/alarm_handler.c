@@ -1,4 +1,5 @@
 #include "alarm_handler.h"
+#include "alarm_queue.h"
 #include "ds3232_mz.h"
 #include "obc_gs_commands_response.h"
 #include "obc_gs_fec.h"
@@ -10,13 +11,15 @@
 #include "obc_persistent.h"
 #include "obc_assert.h"
 #include "command_manager.h"
+#include "command.h"
 
 #include <FreeRTOS.h>
 #include <os_task.h>
 #include <os_queue.h>
 #include <sys_common.h>
 
-#define ALARM_QUEUE_SIZE 24U
+// Each queued alarm holds a FRAM section, so the queue is as large as the persistent alarm array
+#define ALARM_QUEUE_SIZE OBC_PERSISTENT_MAX_SUBINDEX_ALARM
 #define ALARM_HANDLER_QUEUE_LENGTH 64U
 #define ALARM_HANDLER_QUEUE_ITEM_SIZE sizeof(alarm_handler_event_t)
 #define ALARM_HANDLER_QUEUE_RX_WAIT_PERIOD pdMS_TO_TICKS(10)
@@ -26,14 +29,14 @@ static QueueHandle_t alarmHandlerQueueHandle;
 static StaticQueue_t alarmHandlerQueue;
 static uint8_t alarmHandlerQueueStack[ALARM_HANDLER_QUEUE_LENGTH * ALARM_HANDLER_QUEUE_ITEM_SIZE];
 
-static alarm_handler_alarm_info_t alarmQueue[ALARM_QUEUE_SIZE];
-static size_t numActiveAlarms = 0;
+static alarm_queue_t alarmQueue;
+static alarm_handler_alarm_info_t alarmSlots[ALARM_QUEUE_SIZE];
+static alarm_queue_node_t alarmHeap[ALARM_QUEUE_SIZE];
+static uint16_t alarmFreeSlots[ALARM_QUEUE_SIZE];
 
-static obc_error_code_t enqueueAlarm(alarm_handler_alarm_info_t alarm, size_t *insertedAlarmIndex);
+static obc_error_code_t restoreAlarms(void);
 
-static obc_error_code_t dequeueAlarm(alarm_handler_alarm_info_t *alarm);
-
-static obc_error_code_t peekEarliestAlarm(alarm_handler_alarm_info_t *alarm);
+static obc_error_code_t scheduleEarliestAlarm(void);
 
 static void datetimeToAlarmTime(rtc_date_time_t *datetime, rtc_alarm_time_t *alarmTime);
 
@@ -44,13 +47,17 @@ void obcTaskInitAlarmMgr(void) {
   ASSERT((alarmHandlerQueueStack != NULL) && (&alarmHandlerQueue != NULL));
   alarmHandlerQueueHandle = xQueueCreateStatic(ALARM_HANDLER_QUEUE_LENGTH, ALARM_HANDLER_QUEUE_ITEM_SIZE,
                                                alarmHandlerQueueStack, &alarmHandlerQueue);
+  vQueueAddToRegistry(alarmHandlerQueueHandle, "alarm handler");
 }
 
 void obcTaskFunctionAlarmMgr(void *pvParameters) {
   obc_error_code_t errCode;
   uint8_t responseData[CMD_RESPONSE_DATA_MAX_SIZE] = {0};
-  uint8_t sendBuffer[RS_DECODED_SIZE] = {0};
   cmd_response_header_t cmdResHeader = {0};
+
+  // FRAM is read over SPI, so this waits for the scheduler rather than running in obcTaskInitAlarmMgr
+  LOG_IF_ERROR_CODE(restoreAlarms());
+
   while (1) {
     alarm_handler_event_t event;
     uint8_t responseDataLen = 0;
@@ -61,27 +68,15 @@ void obcTaskFunctionAlarmMgr(void *pvParameters) {
 
     switch (event.id) {
       case ALARM_HANDLER_NEW_ALARM: {
-        size_t insertedAlarmIndex;
-        LOG_IF_ERROR_CODE(enqueueAlarm(event.alarmInfo, &insertedAlarmIndex));
-        if (errCode != OBC_ERR_CODE_SUCCESS) {
-          break;
-        }
-
-        if (insertedAlarmIndex != 0) {
-          break;
-        }
+        bool isEarliest = false;
+        LOG_IF_ERROR_CODE(alarmQueuePush(&alarmQueue, &event.alarmInfo, &isEarliest));
 
-        // If the new alarm is the earliest alarm, set the RTC alarm to it
-        rtc_date_time_t alarmDateTime;
-        LOG_IF_ERROR_CODE(unixToDatetime(event.alarmInfo.unixTime, &alarmDateTime));
-        if (errCode != OBC_ERR_CODE_SUCCESS) {
-          break;
+        // If the new alarm is the earliest alarm, set the RTC alarm to it. An alarm that could not be saved to FRAM
+        // is still queued, so it is scheduled as well.
+        if (isEarliest) {
+          LOG_IF_ERROR_CODE(scheduleEarliestAlarm());
         }
 
-        rtc_alarm_time_t alarmTime;
-        datetimeToAlarmTime(&alarmDateTime, &alarmTime);
-        LOG_IF_ERROR_CODE(setAlarm1RTC(RTC_ALARM1_MATCH_DATE_HOURS_MINUTES_SECONDS, alarmTime));
-
         break;
       }
 
@@ -92,8 +87,8 @@ void obcTaskFunctionAlarmMgr(void *pvParameters) {
           break;
         }
 
-        alarm_handler_alarm_info_t alarm;
-        LOG_IF_ERROR_CODE(peekEarliestAlarm(&alarm));
+        const alarm_handler_alarm_info_t *earliest;
+        LOG_IF_ERROR_CODE(alarmQueuePeek(&alarmQueue, &earliest));
         if (errCode != OBC_ERR_CODE_SUCCESS) {
           break;
         }
@@ -102,39 +97,42 @@ void obcTaskFunctionAlarmMgr(void *pvParameters) {
         // not have updated the local time yet
         static const uint32_t tol = 2;  // tolerance of 2 seconds
         uint32_t currTime = getCurrentUnixTime();
-        if (currTime + tol < alarm.unixTime) {
+        if (currTime + tol < earliest->unixTime) {
           LOG_ERROR_CODE(OBC_ERR_CODE_RTC_ALARM_EARLY);
           break;
         }
 
-        uint32_t timestampThresh = alarm.unixTime;
+        uint32_t timestampThresh = earliest->unixTime;
 
         // Execute callbacks for all alarms that have triggered
         // I.e. any alarm with a timestamp less than or equal to the first
         // alarm in the queue
-        for (size_t i = 0; i < numActiveAlarms; i++) {
-          LOG_IF_ERROR_CODE(peekEarliestAlarm(&alarm));
-          if (errCode != OBC_ERR_CODE_SUCCESS) {
+        while (alarmQueuePeek(&alarmQueue, &earliest) == OBC_ERR_CODE_SUCCESS) {
+          if (earliest->unixTime > timestampThresh) {
             break;
           }
 
-          if (alarm.unixTime > timestampThresh) {
-            break;
-          }
-
-          LOG_IF_ERROR_CODE(dequeueAlarm(&alarm));
-          if (errCode != OBC_ERR_CODE_SUCCESS) {
-            break;
-          }
+          // The alarm is off the queue even if it could not be cleared from FRAM, so it still runs
+          alarm_handler_alarm_info_t alarm;
+          LOG_IF_ERROR_CODE(alarmQueuePop(&alarmQueue, &alarm));
 
           switch (alarm.type) {
             case ALARM_TYPE_DEFAULT:
               LOG_IF_ERROR_CODE(alarm.callbackDef.defaultCallback());
               break;
             case ALARM_TYPE_TIME_TAGGED_CMD:
+              // Alarms restored from FRAM after a reset do not have their callback saved
+              if (alarm.callbackDef.cmdCallback == NULL) {
+                cmd_info_t cmdInfo;
+                LOG_IF_ERROR_CODE(verifyCommand(&alarm.cmdMsg, &cmdInfo));
+                if (errCode != OBC_ERR_CODE_SUCCESS) {
+                  break;
+                }
+                alarm.callbackDef.cmdCallback = cmdInfo.callback;
+              }
               LOG_IF_ERROR_CODE(alarm.callbackDef.cmdCallback(&alarm.cmdMsg, responseData, &responseDataLen));
-              LOG_IF_ERROR_CODE(downlinkCmdResponse(&cmdResHeader, &alarm.cmdMsg, errCode, responseData,
-                                                    &responseDataLen, sendBuffer));
+              LOG_IF_ERROR_CODE(
+                  downlinkCmdResponse(&cmdResHeader, &alarm.cmdMsg, errCode, responseData, &responseDataLen));
               memset(responseData, 0, CMD_RESPONSE_DATA_MAX_SIZE);
               break;
             default:
@@ -142,6 +140,11 @@ void obcTaskFunctionAlarmMgr(void *pvParameters) {
               break;
           }
         }
+
+        // Arm the RTC for the next alarm still in the queue
+        if (alarmQueueCount(&alarmQueue) > 0) {
+          LOG_IF_ERROR_CODE(scheduleEarliestAlarm());
+        }
         break;
       }
 
@@ -169,58 +172,43 @@ obc_error_code_t sendToAlarmHandlerQueue(alarm_handler_event_t *event) {
   return OBC_ERR_CODE_QUEUE_FULL;
 }
 
-static obc_error_code_t enqueueAlarm(alarm_handler_alarm_info_t alarm, size_t *insertedAlarmIndex) {
-  if (numActiveAlarms >= ALARM_QUEUE_SIZE) {
-    return OBC_ERR_CODE_QUEUE_FULL;
-  }
+static obc_error_code_t restoreAlarms(void) {
+  obc_error_code_t errCode;
 
-  // Insert the alarm into the queue in order of increasing time
-  size_t i = 0;
-  while (i < numActiveAlarms && alarmQueue[i].unixTime < alarm.unixTime) {
-    i++;
-  }
+  RETURN_IF_ERROR_CODE(alarmQueueInit(&alarmQueue, alarmSlots, alarmHeap, alarmFreeSlots, ALARM_QUEUE_SIZE, true));
 
-  // Shift all alarms after the new alarm back by one
-  for (size_t j = numActiveAlarms; j > i; j--) {
-    alarmQueue[j] = alarmQueue[j - 1];
+  uint16_t numRestored = 0;
+  RETURN_IF_ERROR_CODE(alarmQueueRestore(&alarmQueue, &numRestored));
+  if (numRestored == 0) {
+    return OBC_ERR_CODE_SUCCESS;
   }
 
-  // Insert the new alarm
-  alarmQueue[i] = alarm;
-  numActiveAlarms++;
+  LOG_DEBUG("Restored time-tagged commands from FRAM");
 
-  *insertedAlarmIndex = i;
+  const alarm_handler_alarm_info_t *earliest;
+  RETURN_IF_ERROR_CODE(alarmQueuePeek(&alarmQueue, &earliest));
 
-  return OBC_ERR_CODE_SUCCESS;
-}
-
-static obc_error_code_t dequeueAlarm(alarm_handler_alarm_info_t *alarm) {
-  if (numActiveAlarms == 0) {
-    return OBC_ERR_CODE_QUEUE_EMPTY;
+  // Alarms that came due while the OBC was down run now instead of waiting for an RTC match that will not come
+  if (earliest->unixTime <= getCurrentUnixTime()) {
+    alarm_handler_event_t event = {.id = ALARM_HANDLER_ALARM_TRIGGERED};
+    return sendToAlarmHandlerQueue(&event);
   }
 
-  *alarm = alarmQueue[0];
-
-  // Shift all alarms after the new alarm back by one
-  for (size_t j = 0; j < numActiveAlarms - 1; j++) {
-    if (j >= ALARM_QUEUE_SIZE - 1) {
-      break;
-    }
-
-    alarmQueue[j] = alarmQueue[j + 1];
-  }
+  return scheduleEarliestAlarm();
+}
 
-  numActiveAlarms--;
+static obc_error_code_t scheduleEarliestAlarm(void) {
+  obc_error_code_t errCode;
 
-  return OBC_ERR_CODE_SUCCESS;
-}
+  const alarm_handler_alarm_info_t *earliest;
+  RETURN_IF_ERROR_CODE(alarmQueuePeek(&alarmQueue, &earliest));
 
-static obc_error_code_t peekEarliestAlarm(alarm_handler_alarm_info_t *alarm) {
-  if (numActiveAlarms == 0) {
-    return OBC_ERR_CODE_QUEUE_EMPTY;
-  }
+  rtc_date_time_t alarmDateTime;
+  RETURN_IF_ERROR_CODE(unixToDatetime(earliest->unixTime, &alarmDateTime));
 
-  *alarm = alarmQueue[0];
+  rtc_alarm_time_t alarmTime;
+  datetimeToAlarmTime(&alarmDateTime, &alarmTime);
+  RETURN_IF_ERROR_CODE(setAlarm1RTC(RTC_ALARM1_MATCH_DATE_HOURS_MINUTES_SECONDS, alarmTime));
 
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -0,0 +1,269 @@
+#include "alarm_queue.h"
+#include "obc_persistent.h"
+#include "obc_errors.h"
+#include "obc_assert.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+STATIC_ASSERT((int)NUM_CMD_CALLBACKS_PERSIST == (int)NUM_CMD_CALLBACKS, "persistent command IDs are out of date");
+
+// Ties are broken by insertion order; sequence numbers are compared by difference so they may wrap
+static inline bool nodeBefore(const alarm_queue_node_t *a, const alarm_queue_node_t *b) {
+  if (a->unixTime != b->unixTime) {
+    return a->unixTime < b->unixTime;
+  }
+  return (int32_t)(a->sequence - b->sequence) < 0;
+}
+
+static void siftUp(alarm_queue_t *queue, uint16_t index) {
+  alarm_queue_node_t node = queue->heap[index];
+  while (index > 0) {
+    uint16_t parent = (index - 1) / 2;
+    if (!nodeBefore(&node, &queue->heap[parent])) {
+      break;
+    }
+    queue->heap[index] = queue->heap[parent];
+    index = parent;
+  }
+  queue->heap[index] = node;
+}
+
+static void siftDown(alarm_queue_t *queue, uint16_t index) {
+  alarm_queue_node_t node = queue->heap[index];
+  while (1) {
+    uint32_t child = 2U * index + 1U;
+    if (child >= queue->numAlarms) {
+      break;
+    }
+    if (child + 1U < queue->numAlarms && nodeBefore(&queue->heap[child + 1U], &queue->heap[child])) {
+      child++;
+    }
+    if (!nodeBefore(&queue->heap[child], &node)) {
+      break;
+    }
+    queue->heap[index] = queue->heap[child];
+    index = (uint16_t)child;
+  }
+  queue->heap[index] = node;
+}
+
+static void insertNode(alarm_queue_t *queue, uint16_t slot, uint32_t sequence) {
+  uint16_t index = queue->numAlarms++;
+  queue->heap[index] =
+      (alarm_queue_node_t){.unixTime = queue->slots[slot].unixTime, .sequence = sequence, .slot = slot};
+  siftUp(queue, index);
+}
+
+static void toPersist(const alarm_handler_alarm_info_t *alarm, uint32_t sequence, alarm_mgr_persist_data_t *data) {
+  memset(data, 0, sizeof(*data));
+  data->unixTime = alarm->unixTime;
+  data->sequence = sequence;
+  data->type = ALARM_TYPE_TIME_TAGGED_CMD_PERSIST;
+  data->active = true;
+  data->cmdMsg.timestamp = alarm->cmdMsg.timestamp;
+  data->cmdMsg.isTimeTagged = alarm->cmdMsg.isTimeTagged;
+  data->cmdMsg.id = (cmd_callback_id_persist_t)alarm->cmdMsg.id;
+
+  switch (alarm->cmdMsg.id) {
+    case CMD_RTC_SYNC:
+      data->cmdMsg.rtcSync.unixTime = alarm->cmdMsg.rtcSync.unixTime;
+      break;
+    case CMD_DOWNLINK_LOGS_NEXT_PASS:
+      data->cmdMsg.downlinkLogsNextPass.logLevel = alarm->cmdMsg.downlinkLogsNextPass.logLevel;
+      break;
+    default:
+      break;
+  }
+}
+
+static void fromPersist(const alarm_mgr_persist_data_t *data, alarm_handler_alarm_info_t *alarm) {
+  memset(alarm, 0, sizeof(*alarm));
+  alarm->unixTime = data->unixTime;
+  alarm->type = ALARM_TYPE_TIME_TAGGED_CMD;
+  alarm->cmdMsg.timestamp = data->cmdMsg.timestamp;
+  alarm->cmdMsg.isTimeTagged = data->cmdMsg.isTimeTagged;
+  alarm->cmdMsg.id = (cmd_callback_id_t)data->cmdMsg.id;
+
+  switch (alarm->cmdMsg.id) {
+    case CMD_RTC_SYNC:
+      alarm->cmdMsg.rtcSync.unixTime = data->cmdMsg.rtcSync.unixTime;
+      break;
+    case CMD_DOWNLINK_LOGS_NEXT_PASS:
+      alarm->cmdMsg.downlinkLogsNextPass.logLevel = data->cmdMsg.downlinkLogsNextPass.logLevel;
+      break;
+    default:
+      break;
+  }
+}
+
+static obc_error_code_t saveSlot(alarm_queue_t *queue, uint16_t slot, uint32_t sequence) {
+  // Default alarms carry a callback that only means something to the running image, so they are not saved
+  if (!queue->persistent || queue->slots[slot].type != ALARM_TYPE_TIME_TAGGED_CMD) {
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  alarm_mgr_persist_data_t data;
+  toPersist(&queue->slots[slot], sequence, &data);
+  return setPersistentDataByIndex(OBC_PERSIST_SECTION_ID_ALARM_MGR, slot, &data, sizeof(data));
+}
+
+static obc_error_code_t clearSlot(alarm_queue_t *queue, uint16_t slot) {
+  if (!queue->persistent || queue->slots[slot].type != ALARM_TYPE_TIME_TAGGED_CMD) {
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  alarm_mgr_persist_data_t data = {0};
+  return setPersistentDataByIndex(OBC_PERSIST_SECTION_ID_ALARM_MGR, slot, &data, sizeof(data));
+}
+
+static void resetQueue(alarm_queue_t *queue) {
+  queue->numAlarms = 0;
+  queue->nextSequence = 0;
+
+  // Hand out low slots first so a lightly used queue touches few FRAM sections
+  for (uint16_t i = 0; i < queue->capacity; i++) {
+    queue->freeSlots[i] = queue->capacity - 1 - i;
+  }
+  queue->numFree = queue->capacity;
+}
+
+obc_error_code_t alarmQueueInit(alarm_queue_t *queue, alarm_handler_alarm_info_t *slots, alarm_queue_node_t *heap,
+                                uint16_t *freeSlots, uint16_t capacity, bool persistent) {
+  if (queue == NULL || slots == NULL || heap == NULL || freeSlots == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (capacity == 0 || capacity == ALARM_QUEUE_INVALID_SLOT) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (persistent && capacity > OBC_PERSISTENT_MAX_SUBINDEX_ALARM) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  queue->slots = slots;
+  queue->heap = heap;
+  queue->freeSlots = freeSlots;
+  queue->capacity = capacity;
+  queue->persistent = persistent;
+  resetQueue(queue);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t alarmQueueRestore(alarm_queue_t *queue, uint16_t *numRestored) {
+  if (queue == NULL || numRestored == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (!queue->persistent || queue->numAlarms != 0) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  *numRestored = 0;
+
+  bool restored = false;
+  uint32_t lastSequence = 0;
+  uint16_t numFree = 0;
+
+  // Free slots are popped from the end of the list, so list the highest first to hand out low slots first
+  for (uint16_t i = queue->capacity; i > 0; i--) {
+    uint16_t slot = i - 1;
+    alarm_mgr_persist_data_t data;
+    obc_error_code_t errCode = getPersistentDataByIndex(OBC_PERSIST_SECTION_ID_ALARM_MGR, slot, &data, sizeof(data));
+
+    // Sections that were never written fail their CRC check and are free like cleared ones
+    bool inUse = errCode == OBC_ERR_CODE_SUCCESS && data.active && data.type == ALARM_TYPE_TIME_TAGGED_CMD_PERSIST &&
+                 data.cmdMsg.id < NUM_CMD_CALLBACKS_PERSIST;
+    if (!inUse) {
+      if (errCode != OBC_ERR_CODE_SUCCESS && errCode != OBC_ERR_CODE_PERSISTENT_CORRUPTED) {
+        // Some slots may already be in the heap while the free list still counts them, so start over empty
+        resetQueue(queue);
+        return errCode;
+      }
+      queue->freeSlots[numFree++] = slot;
+      continue;
+    }
+
+    fromPersist(&data, &queue->slots[slot]);
+    insertNode(queue, slot, data.sequence);
+
+    if (!restored || (int32_t)(data.sequence - lastSequence) > 0) {
+      lastSequence = data.sequence;
+    }
+    restored = true;
+  }
+
+  queue->numFree = numFree;
+
+  queue->nextSequence = restored ? lastSequence + 1 : 0;
+  *numRestored = queue->numAlarms;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t alarmQueuePush(alarm_queue_t *queue, const alarm_handler_alarm_info_t *alarm, bool *isEarliest) {
+  if (queue == NULL || alarm == NULL || isEarliest == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (queue->numFree == 0) {
+    return OBC_ERR_CODE_QUEUE_FULL;
+  }
+
+  uint16_t slot = queue->freeSlots[--queue->numFree];
+  queue->slots[slot] = *alarm;
+
+  uint32_t sequence = queue->nextSequence++;
+  insertNode(queue, slot, sequence);
+  *isEarliest = queue->heap[0].slot == slot;
+
+  return saveSlot(queue, slot, sequence);
+}
+
+obc_error_code_t alarmQueuePeek(const alarm_queue_t *queue, const alarm_handler_alarm_info_t **alarm) {
+  if (queue == NULL || alarm == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (queue->numAlarms == 0) {
+    return OBC_ERR_CODE_QUEUE_EMPTY;
+  }
+
+  *alarm = &queue->slots[queue->heap[0].slot];
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t alarmQueuePop(alarm_queue_t *queue, alarm_handler_alarm_info_t *alarm) {
+  if (queue == NULL || alarm == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (queue->numAlarms == 0) {
+    return OBC_ERR_CODE_QUEUE_EMPTY;
+  }
+
+  uint16_t slot = queue->heap[0].slot;
+  *alarm = queue->slots[slot];
+
+  queue->numAlarms--;
+  if (queue->numAlarms > 0) {
+    queue->heap[0] = queue->heap[queue->numAlarms];
+    siftDown(queue, 0);
+  }
+  queue->freeSlots[queue->numFree++] = slot;
+
+  return clearSlot(queue, slot);
+}
+
+uint16_t alarmQueueCount(const alarm_queue_t *queue) {
+  if (queue == NULL) {
+    return 0;
+  }
+
+  return queue->numAlarms;
+}
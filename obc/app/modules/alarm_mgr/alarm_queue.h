@@ -0,0 +1,109 @@
+#pragma once
+
+#include "alarm_handler.h"
+#include "obc_errors.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ALARM_QUEUE_INVALID_SLOT 0xFFFFU
+
+// Heap node; the sort key is kept next to the slot index so sifting never touches the alarms themselves
+typedef struct {
+  uint32_t unixTime;
+  uint32_t sequence;  // Insertion order, so alarms due at the same second run in the order they were queued
+  uint16_t slot;
+} alarm_queue_node_t;
+
+/**
+ * @brief Min-heap of alarms ordered by time over a preallocated pool of alarm slots.
+ *
+ * An alarm is copied into a free slot once when pushed and once out of it when popped. Only the small heap nodes move
+ * while the heap is reordered, so pushes and pops are O(log n) node swaps instead of O(n) alarm copies.
+ *
+ * If the queue is persistent, slot i is mirrored to FRAM sub index i of OBC_PERSIST_SECTION_ID_ALARM_MGR whenever it
+ * is filled or freed, and alarmQueueRestore() rebuilds the queue from FRAM after a reset.
+ */
+typedef struct {
+  alarm_handler_alarm_info_t *slots;
+  alarm_queue_node_t *heap;
+  uint16_t *freeSlots;
+  uint16_t capacity;
+  uint16_t numAlarms;
+  uint16_t numFree;
+  uint32_t nextSequence;
+  bool persistent;
+} alarm_queue_t;
+
+/**
+ * @brief Initialize an empty alarm queue over caller-provided storage
+ *
+ * @param queue The queue to initialize
+ * @param slots Pool of capacity alarm slots
+ * @param heap Storage for capacity heap nodes
+ * @param freeSlots Storage for capacity free slot indices
+ * @param capacity Number of alarms the queue can hold
+ * @param persistent Mirror the slots to FRAM; capacity must not exceed OBC_PERSISTENT_MAX_SUBINDEX_ALARM
+ * @return obc_error_code_t OBC_ERR_CODE_INVALID_ARG if the storage or capacity is not usable
+ */
+obc_error_code_t alarmQueueInit(alarm_queue_t *queue, alarm_handler_alarm_info_t *slots, alarm_queue_node_t *heap,
+                                uint16_t *freeSlots, uint16_t capacity, bool persistent);
+
+/**
+ * @brief Rebuild a persistent queue from the alarms saved in FRAM. Call once, right after alarmQueueInit().
+ *
+ * Only time-tagged commands are saved. Their callbacks are not, so restored alarms have a NULL cmdCallback that must
+ * be looked up again from the command ID before they run.
+ *
+ * @param queue The queue to restore into
+ * @param numRestored Set to the number of alarms restored
+ * @return obc_error_code_t OBC_ERR_CODE_INVALID_STATE if the queue is not persistent or not empty. If FRAM cannot be
+ * read, the error is returned and the queue is left empty.
+ */
+obc_error_code_t alarmQueueRestore(alarm_queue_t *queue, uint16_t *numRestored);
+
+/**
+ * @brief Add an alarm to the queue
+ *
+ * @param queue The queue to add to
+ * @param alarm The alarm to copy into the queue
+ * @param isEarliest Set to true if the alarm is now the earliest in the queue
+ * @return obc_error_code_t OBC_ERR_CODE_QUEUE_FULL if there is no free slot. If saving the alarm to FRAM fails, the
+ * error is returned and the alarm stays queued in RAM.
+ */
+obc_error_code_t alarmQueuePush(alarm_queue_t *queue, const alarm_handler_alarm_info_t *alarm, bool *isEarliest);
+
+/**
+ * @brief Get the earliest alarm without removing it
+ *
+ * @param queue The queue to check
+ * @param alarm Set to point at the earliest alarm; valid until the next push or pop
+ * @return obc_error_code_t OBC_ERR_CODE_QUEUE_EMPTY if there are no alarms
+ */
+obc_error_code_t alarmQueuePeek(const alarm_queue_t *queue, const alarm_handler_alarm_info_t **alarm);
+
+/**
+ * @brief Remove the earliest alarm
+ *
+ * @param queue The queue to remove from
+ * @param alarm Buffer for the removed alarm
+ * @return obc_error_code_t OBC_ERR_CODE_QUEUE_EMPTY if there are no alarms. If clearing the alarm from FRAM fails,
+ * the error is returned and the alarm is still removed from RAM.
+ */
+obc_error_code_t alarmQueuePop(alarm_queue_t *queue, alarm_handler_alarm_info_t *alarm);
+
+/**
+ * @brief Get the number of alarms in the queue
+ *
+ * @param queue The queue to check
+ * @return uint16_t Number of queued alarms
+ */
+uint16_t alarmQueueCount(const alarm_queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
@@ -10,6 +10,7 @@
 #include "os_portmacro.h"
 #include "os_projdefs.h"
 #include "telemetry_manager.h"
+#include "gnc_manager.h"
 #include "command.h"
 #include "obc_general_util.h"
 
@@ -44,7 +45,7 @@ static obc_error_code_t rtcSyncCmdCallback(cmd_msg_t *cmd, uint8_t *responseData
   rtc_date_time_t dt;
   RETURN_IF_ERROR_CODE(unixToDatetime(cmd->rtcSync.unixTime, &dt));
   RETURN_IF_ERROR_CODE(setCurrentDateTimeRTC(&dt));
-  RETURN_IF_ERROR_CODE(syncUnixTime());
+  RETURN_IF_ERROR_CODE(stepUnixTimeToRtc());
 
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -116,6 +117,32 @@ static obc_error_code_t I2CProbeCmdCallback(cmd_msg_t *cmd, uint8_t *responseDat
   return OBC_ERR_CODE_SUCCESS;
 }
 
+static obc_error_code_t gncTimingStatsCmdCallback(cmd_msg_t *cmd, uint8_t *responseData, uint8_t *responseDataLen) {
+  obc_error_code_t errCode;
+
+  if (cmd == NULL || responseData == NULL || responseDataLen == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  gnc_timing_stats_t stats;
+  RETURN_IF_ERROR_CODE(getGncTimingStats(&stats));
+
+  // Counters, then the start latency and execution time histograms
+  uint32_t words[4 + 2 * GNC_TIMING_HIST_NUM_BINS] = {
+      stats.cycles,
+      stats.deadlineMisses,
+      GNC_TIMING_COUNTS_TO_US(stats.maxStartLatency),
+      GNC_TIMING_COUNTS_TO_US(stats.maxExecTime),
+  };
+  memcpy(&words[4], stats.startLatencyHist, sizeof(stats.startLatencyHist));
+  memcpy(&words[4 + GNC_TIMING_HIST_NUM_BINS], stats.execTimeHist, sizeof(stats.execTimeHist));
+
+  memcpy(responseData, words, sizeof(words));
+  *responseDataLen = sizeof(words);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
 const cmd_info_t cmdsConfig[] = {
     [CMD_END_OF_FRAME] = {NULL, CMD_POLICY_PROD, CMD_TYPE_NORMAL},
     // TODO: Change this to critial once critical commands are implemented
@@ -126,6 +153,7 @@ const cmd_info_t cmdsConfig[] = {
     [CMD_PING] = {pingCmdCallback, CMD_POLICY_PROD, CMD_TYPE_NORMAL},
     [CMD_DOWNLINK_TELEM] = {downlinkTelemCmdCallback, CMD_POLICY_PROD, CMD_TYPE_NORMAL},
     [CMD_I2C_PROBE] = {I2CProbeCmdCallback, CMD_POLICY_PROD, CMD_TYPE_NORMAL},
+    [CMD_GNC_TIMING_STATS] = {gncTimingStatsCmdCallback, CMD_POLICY_PROD, CMD_TYPE_NORMAL},
 };
 
 // This function is purely to trick the compiler into thinking we are using the cmdsConfig variable so we avoid the
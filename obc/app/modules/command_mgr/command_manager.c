@@ -12,6 +12,7 @@
 
 #include <FreeRTOS.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys_common.h>
 #include <os_task.h>
 #include <os_queue.h>
@@ -28,6 +29,7 @@ void obcTaskInitCommandMgr(void) {
   if (commandQueueHandle == NULL) {
     commandQueueHandle =
         xQueueCreateStatic(COMMAND_QUEUE_LENGTH, COMMAND_QUEUE_ITEM_SIZE, commandQueueStack, &commandQueue);
+    vQueueAddToRegistry(commandQueueHandle, "command");
   }
 }
 
@@ -78,7 +80,7 @@ obc_error_code_t processTimeTaggedCommand(cmd_msg_t *cmd, cmd_info_t *currCmdInf
 }
 
 obc_error_code_t downlinkCmdResponse(cmd_response_header_t *cmdResHeader, cmd_msg_t *cmd, obc_error_code_t errCode,
-                                     uint8_t *responseData, uint8_t *responseDataLen, uint8_t *sendBuffer) {
+                                     uint8_t *responseData, uint8_t *responseDataLen) {
   cmdResHeader->cmdId = cmd->id;
   cmdResHeader->dataLen = *responseDataLen;
 
@@ -88,18 +90,28 @@ obc_error_code_t downlinkCmdResponse(cmd_response_header_t *cmdResHeader, cmd_ms
     cmdResHeader->errCode = CMD_RESPONSE_ERROR;
   }
 
-  obc_gs_error_code_t interfaceErr = packCmdResponse(cmdResHeader, sendBuffer, responseData);
+  cmd_response_handle_t handle;
+  uint8_t *sendBuffer;
+  RETURN_IF_ERROR_CODE(acquireCmdResponseBuffer(&handle, &sendBuffer));
+
+  uint32_t packedLen = 0;
+  obc_gs_error_code_t interfaceErr =
+      appendCmdResponse(cmdResHeader, responseData, sendBuffer, RS_DECODED_SIZE, &packedLen);
+  memset(responseData, 0, CMD_RESPONSE_DATA_MAX_SIZE);
 
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
+    LOG_IF_ERROR_CODE(releaseCmdResponseBuffer(handle));
     return OBC_ERR_CODE_FAILED_PACK;
-  } else {
-    for (uint8_t i = 0; i < RS_DECODED_SIZE; i++) {
-      encode_event_t queueMsg = {.eventID = DOWNLINK_CMD_RESPONSE, .cmdResponseByte = sendBuffer[i]};
-      LOG_IF_ERROR_CODE(sendToDownlinkEncodeQueue(&queueMsg));
-    }
   }
 
-  memset(responseData, 0, CMD_RESPONSE_DATA_MAX_SIZE);
+  // The encoder returns the buffer to the pool once it has copied the response out
+  encode_event_t queueMsg = {.eventID = DOWNLINK_CMD_RESPONSE,
+                             .cmdResponse = {.handle = handle, .length = (uint8_t)packedLen}};
+  errCode = sendToDownlinkEncodeQueue(&queueMsg);
+  if (errCode != OBC_ERR_CODE_SUCCESS) {
+    LOG_IF_ERROR_CODE(releaseCmdResponseBuffer(handle));
+    return OBC_ERR_CODE_QUEUE_FULL;
+  }
 
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -107,7 +119,6 @@ obc_error_code_t downlinkCmdResponse(cmd_response_header_t *cmdResHeader, cmd_ms
 void obcTaskFunctionCommandMgr(void *pvParameters) {
   obc_error_code_t errCode = 0;
   uint8_t responseData[CMD_RESPONSE_DATA_MAX_SIZE] = {0};
-  uint8_t sendBuffer[RS_DECODED_SIZE] = {0};
 
   while (1) {
     cmd_msg_t cmd;
@@ -126,8 +137,7 @@ void obcTaskFunctionCommandMgr(void *pvParameters) {
         LOG_IF_ERROR_CODE(processTimeTaggedCommand(&cmd, &currCmdInfo));
       } else {
         LOG_IF_ERROR_CODE(processNonTimeTaggedCommand(&cmd, &currCmdInfo, responseData, &responseDataLen));
-        LOG_IF_ERROR_CODE(
-            downlinkCmdResponse(&cmdResHeader, &cmd, errCode, responseData, &responseDataLen, sendBuffer));
+        LOG_IF_ERROR_CODE(downlinkCmdResponse(&cmdResHeader, &cmd, errCode, responseData, &responseDataLen));
       }
     }
   }
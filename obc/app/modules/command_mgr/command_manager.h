@@ -13,7 +13,8 @@
 obc_error_code_t sendToCommandQueue(cmd_msg_t *cmd);
 
 /**
- * @brief Downlinks a command response by sending it to the downlink data queue
+ * @brief Downlinks a command response by packing it into a pooled response buffer and sending its handle to the
+ * downlink encoder, which may coalesce it with other responses into one RS block
  *
  * @param cmdResHeader Pointer to the command response that stores the data to downlink
  * @param cmd Pointer to the command that just executed
@@ -22,8 +23,7 @@ obc_error_code_t sendToCommandQueue(cmd_msg_t *cmd);
  * @param responseData A pointer to an array that has data contained in the command response
  * @param responseDataLen A pointer to the length of data conatined in responseData (i.e. what number of bytes are
  * actual data rather than 0s)
- * @param sendBuffer A pointer to the array that will contained the packed command response to downlink
  * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise an error code
  */
 obc_error_code_t downlinkCmdResponse(cmd_response_header_t *cmdResHeader, cmd_msg_t *cmd, obc_error_code_t errCode,
-                                     uint8_t *responseData, uint8_t *responseDataLen, uint8_t *sendBuffer);
+                                     uint8_t *responseData, uint8_t *responseDataLen);
@@ -25,6 +25,11 @@
 #define TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT pdMS_TO_TICKS(5000)
 #define SYNC_EVENT_SEMAPHORE_TIMEOUT pdMS_TO_TICKS(30000)
 
+// A chunk received below this RSSI or above this LQI is handed to the decoder as unreliable, so its bytes can be
+// decoded as erasures if the frame does not decode otherwise
+#define RX_POOR_LINK_RSSI_DBM -115
+#define RX_POOR_LINK_LQI 40U
+
 static SemaphoreHandle_t rxSemaphore = NULL;
 static StaticSemaphore_t rxSemaphoreBuffer;
 static SemaphoreHandle_t txSemaphore = NULL;
@@ -34,12 +39,19 @@ static StaticSemaphore_t txFifoEmptySemaphoreBuffer;
 static SemaphoreHandle_t syncReceivedSemaphore = NULL;
 static StaticSemaphore_t syncReceivedSemaphoreBuffer;
 
+// GIO2 has one interrupt pin, so gpio2Callback needs to know which signal it is currently routed to
+static volatile bool gpio2IsSyncEvent = false;
+
 static obc_error_code_t cc1120SendVariablePktMode(uint8_t *data, uint32_t len);
 
 static obc_error_code_t cc1120SendInifinitePktMode(uint8_t *data, uint32_t len);
 
 static obc_error_code_t writeFifoBlocking(uint8_t *data, uint32_t len);
 
+static bool isLinkQualityPoor(void);
+
+static obc_error_code_t setGpio2Signal(uint8_t signal);
+
 void initAllCc1120TxRxSemaphores(void) {
   if (txSemaphore == NULL) {
     txSemaphore = xSemaphoreCreateBinaryStatic(&txSemaphoreBuffer);
@@ -90,6 +102,19 @@ obc_error_code_t cc1120Send(uint8_t *data, uint32_t len, TickType_t txFifoEmptyT
     return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
   }
 
+  // The TX FIFO is empty, so it has room for a chunk. A packet that never filled the FIFO past the threshold (e.g. an
+  // ACK U frame) leaves txSemaphore taken because the threshold interrupt never fired
+  xSemaphoreGive(txSemaphore);
+
+  // A receive leaves GIO2 on the sync event, which never signals the end of this packet
+  if (gpio2IsSyncEvent) {
+    errCode = setGpio2Signal(PKT_SYNC_RXTX_SIGNAL_NUM);
+    if (errCode != OBC_ERR_CODE_SUCCESS) {
+      xSemaphoreGive(txFifoEmptySemaphore);
+      return errCode;
+    }
+  }
+
   // See section 8.1.5
   if (len > CC1120_MAX_PACKET_LEN) {
     RETURN_IF_ERROR_CODE(cc1120SendInifinitePktMode(data, len));
@@ -210,6 +235,47 @@ static obc_error_code_t writeFifoBlocking(uint8_t *data, uint32_t len) {
   return OBC_ERR_CODE_SUCCESS;
 }
 
+/**
+ * @brief Routes a signal to cc1120 GIO2
+ *
+ * @param signal - SYNC_EVENT_SIGNAL_NUM or PKT_SYNC_RXTX_SIGNAL_NUM
+ * @return obc_error_code_t
+ */
+static obc_error_code_t setGpio2Signal(uint8_t signal) {
+  obc_error_code_t errCode;
+
+  // When changing which signals are sent by each gpio, the output will be unstable so interrupts should be disabled
+  // see chapter 3.4 in the datasheet for more info
+  gioDisableNotification(gioPORTA, CC1120_PKT_SYNC_RXTX_gioPORTA_PIN);
+
+  errCode = cc1120WriteSpi(CC1120_REGS_IOCFG2, &signal, 1);
+  if (errCode == OBC_ERR_CODE_SUCCESS) {
+    gpio2IsSyncEvent = (signal == SYNC_EVENT_SIGNAL_NUM);
+  }
+
+  // enable interrupts again now that the gpio signals are set
+  gioEnableNotification(gioPORTA, CC1120_PKT_SYNC_RXTX_gioPORTA_PIN);
+
+  return errCode;
+}
+
+/**
+ * @brief Checks the RSSI and LQI of the chunk that was just read out of the RX FIFO
+ *
+ * @return true if the chunk should be treated as unreliable; a failed read counts as a good link so a flaky SPI bus
+ * cannot flood the decoder with hints
+ */
+static bool isLinkQualityPoor(void) {
+  obc_error_code_t errCode;
+  cc1120_link_quality_t quality = {0};
+  LOG_IF_ERROR_CODE(cc1120GetLinkQuality(&quality));
+  if (errCode != OBC_ERR_CODE_SUCCESS) {
+    return false;
+  }
+
+  return (quality.rssiValid && quality.rssiDbm < RX_POOR_LINK_RSSI_DBM) || quality.lqi > RX_POOR_LINK_LQI;
+}
+
 /**
  * @brief Switches the cc1120 to RX mode to continuously receive bytes and send them to the decode task
  * @param syncWordTimeoutTicks - The amount of time to wait for the syncReceivedSemaphore to become available
@@ -221,22 +287,17 @@ obc_error_code_t cc1120ReceiveToDecodeTask(TickType_t syncWordTimeoutTicks) {
     return OBC_ERR_CODE_INVALID_STATE;
   }
 
+  // cc1120Send returns once the last bytes are in the TX FIFO, and SRX would cut off whatever is still on the air
+  LOG_IF_ERROR_CODE(txFifoEmptyCheckBlocking());
+
   // poll the semaphore to clear whatever value it has (do not block and wait on it)
   xSemaphoreTake(syncReceivedSemaphore, (TickType_t)0);
 
-  // When changing which signals are sent by each gpio, the output will be unstable so interrupts should be disabled
-  // see chapter 3.4 in the datasheet for more info
-  gioDisableNotification(gioPORTA, CC1120_PKT_SYNC_RXTX_gioPORTA_PIN);
-
   // switch gpio 2 to be a SYNC_EVENT signal instead of CC1120_PKT_SYNC_RXTX_PIN
-  uint8_t spiTransferData = SYNC_EVENT_SIGNAL_NUM;
-  RETURN_IF_ERROR_CODE(cc1120WriteSpi(CC1120_REGS_IOCFG2, &spiTransferData, 1));
-
-  // enable interrupts again now that the gpio signals are set
-  gioEnableNotification(gioPORTA, (uint32_t)CC1120_SYNC_EVENT_PIN);
+  RETURN_IF_ERROR_CODE(setGpio2Signal(SYNC_EVENT_SIGNAL_NUM));
 
   // Temporarily set packet size to infinite
-  spiTransferData = INFINITE_PACKET_LENGTH_MODE;
+  uint8_t spiTransferData = INFINITE_PACKET_LENGTH_MODE;
   RETURN_IF_ERROR_CODE(cc1120WriteSpi(CC1120_REGS_PKT_CFG0, &spiTransferData, 1));
 
   // Switch cc1120 to receive mode
@@ -262,9 +323,8 @@ obc_error_code_t cc1120ReceiveToDecodeTask(TickType_t syncWordTimeoutTicks) {
       break;
     }
     RETURN_IF_ERROR_CODE(cc1120ReadFifo(dataBuffer, TXRX_INTERRUPT_THRESHOLD));
-    for (uint8_t i = 0; i < TXRX_INTERRUPT_THRESHOLD; ++i) {
-      sendToDecodeDataQueue(&dataBuffer[i]);
-    }
+    LOG_IF_ERROR_CODE(
+        sendToDecodeDataStreamWithLinkQuality(dataBuffer, TXRX_INTERRUPT_THRESHOLD, isLinkQualityPoor()));
   }
 
   uint8_t numBytesInRxFifo;
@@ -277,9 +337,9 @@ obc_error_code_t cc1120ReceiveToDecodeTask(TickType_t syncWordTimeoutTicks) {
     RETURN_IF_ERROR_CODE(cc1120ReadFifo(dataBuffer, numBytesInRxFifo));
   }
 
-  // send the bytes read (if any) to decode data queue
-  for (uint8_t i = 0; i < numBytesInRxFifo; ++i) {
-    sendToDecodeDataQueue(&dataBuffer[i]);
+  // send the bytes read (if any) to decode data stream
+  if (numBytesInRxFifo != 0) {
+    LOG_IF_ERROR_CODE(sendToDecodeDataStreamWithLinkQuality(dataBuffer, numBytesInRxFifo, isLinkQualityPoor()));
   }
 
   if (rxFifoReadCycles == (COMMS_MAX_UPLINK_BYTES + TXRX_INTERRUPT_THRESHOLD - 1) / TXRX_INTERRUPT_THRESHOLD) {
@@ -307,22 +367,17 @@ obc_error_code_t cc1120Receive(uint8_t *recvBuf, uint16_t recvBufLen, TickType_t
 
   obc_error_code_t errCode = OBC_ERR_CODE_SUCCESS;
 
+  // cc1120Send returns once the last bytes are in the TX FIFO, and SRX would cut off whatever is still on the air
+  LOG_IF_ERROR_CODE(txFifoEmptyCheckBlocking());
+
   // poll the semaphore to clear whatever value it has (do not block and wait on it)
   xSemaphoreTake(syncReceivedSemaphore, (TickType_t)0);
 
-  // When changing which signals are sent by each gpio, the output will be unstable so interrupts should be disabled
-  // see chapter 3.4 in the datasheet for more info
-  gioDisableNotification(gioPORTA, CC1120_PKT_SYNC_RXTX_gioPORTA_PIN);
-
   // switch gpio 2 to be a SYNC_EVENT signal instead of CC1120_PKT_SYNC_RXTX_PIN
-  uint8_t spiTransferData = SYNC_EVENT_SIGNAL_NUM;
-  RETURN_IF_ERROR_CODE(cc1120WriteSpi(CC1120_REGS_IOCFG2, &spiTransferData, 1));
-
-  // enable interrupts again now that the gpio signals are set
-  gioEnableNotification(gioPORTA, (uint32_t)CC1120_SYNC_EVENT_PIN);
+  RETURN_IF_ERROR_CODE(setGpio2Signal(SYNC_EVENT_SIGNAL_NUM));
 
   // Temporarily set packet size to infinite
-  spiTransferData = INFINITE_PACKET_LENGTH_MODE;
+  uint8_t spiTransferData = INFINITE_PACKET_LENGTH_MODE;
   RETURN_IF_ERROR_CODE(cc1120WriteSpi(CC1120_REGS_PKT_CFG0, &spiTransferData, 1));
 
   // Switch cc1120 to receive mode
@@ -430,3 +485,11 @@ void syncEventCallback(void) {
   // been unblocked
   portYIELD_FROM_ISR(xHigherPriorityTaskAwoken);
 }
+
+void gpio2Callback(void) {
+  if (gpio2IsSyncEvent) {
+    syncEventCallback();
+  } else {
+    txFifoEmptyCallback();
+  }
+}
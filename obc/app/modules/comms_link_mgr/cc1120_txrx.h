@@ -66,3 +66,9 @@ void txFifoEmptyCallback(void);
  * @brief callback function to be used in an ISR when the sync word has been received
  */
 void syncEventCallback(void);
+
+/**
+ * @brief callback function to be used in an ISR on a falling edge of cc1120 GIO2, which signals the end of a transmitted
+ * packet or, while receiving, the sync word
+ */
+void gpio2Callback(void);
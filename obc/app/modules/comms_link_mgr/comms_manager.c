@@ -1,7 +1,9 @@
 #include "comms_manager.h"
 #include "cc1120.h"
+#include "cc1120_defs.h"
 #include "cc1120_txrx.h"
 #include "downlink_encoder.h"
+#include "obc_assert.h"
 #include "obc_board_config.h"
 #include "obc_errors.h"
 #include "obc_gs_aes128.h"
@@ -21,6 +23,7 @@
 #include "telemetry_manager.h"
 #include "uplink_decoder.h"
 #include <stdint.h>
+#include <string.h>
 
 #if COMMS_PHY == COMMS_PHY_UART
 #include "obc_sci_io.h"
@@ -39,6 +42,11 @@
 #define COMMS_MAX_DOWNLINK_FRAMES 1000U
 #define RFFM6404_VAPC_REGULAR_POWER_VAL 1.9f
 
+// Longest frame at the slowest data rate, with margin
+#define CC1120_TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT pdMS_TO_TICKS(5000)
+// Like the UART reads, wait as long as it takes for the ground station to transmit
+#define CC1120_SYNC_WORD_TIMEOUT portMAX_DELAY
+
 /* Comms Manager event queue config */
 #define COMMS_MANAGER_QUEUE_LENGTH 10U
 #define COMMS_MANAGER_QUEUE_ITEM_SIZE sizeof(comms_event_t)
@@ -58,6 +66,21 @@ static QueueHandle_t cc1120TransmitQueueHandle = NULL;
 static StaticQueue_t cc1120TransmitQueue;
 static uint8_t cc1120TransmitQueueStack[CC1120_TRANSMIT_QUEUE_LENGTH * CC1120_TRANSMIT_QUEUE_ITEM_SIZE];
 
+/* Downlink frame pool config */
+#define DOWNLINK_FRAME_FREE_QUEUE_ITEM_SIZE sizeof(downlink_frame_handle_t)
+#define DOWNLINK_FRAME_FREE_QUEUE_RX_WAIT_PERIOD portMAX_DELAY
+
+static QueueHandle_t downlinkFrameFreeQueueHandle = NULL;
+static StaticQueue_t downlinkFrameFreeQueue;
+static uint8_t downlinkFrameFreeQueueStack[DOWNLINK_FRAME_POOL_SIZE * DOWNLINK_FRAME_FREE_QUEUE_ITEM_SIZE];
+
+// Frames are encoded in place so they are never copied through the transmit queue
+static packed_ax25_i_frame_t downlinkFramePool[DOWNLINK_FRAME_POOL_SIZE];
+
+STATIC_ASSERT(DOWNLINK_FRAME_POOL_SIZE <= UINT8_MAX, "downlink frame handles must fit in a downlink_frame_handle_t");
+
+static downlink_stats_t lastDownlinkStats;
+
 static const uint8_t TEMP_STATIC_KEY[AES_KEY_SIZE] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
                                                       0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
 
@@ -96,6 +119,12 @@ static obc_error_code_t handleEnterEmergencyState(void);
 static obc_error_code_t handleEmergUplinkState(void);
 /* COMMS STATE HANDLER FUNCTIONS END */
 
+#if COMMS_PHY == COMMS_PHY_UART
+static uint16_t uartFrameLength(const uint8_t *readBytes, uint16_t readBytesLen);
+
+static obc_error_code_t uartReceiveToDecodeTask(void);
+#endif
+
 typedef obc_error_code_t (*comms_state_func_t)(void);
 
 static const comms_state_func_t commsStateFns[] = {
@@ -118,12 +147,23 @@ void obcTaskInitCommsMgr(void) {
   if (commsQueueHandle == NULL) {
     commsQueueHandle =
         xQueueCreateStatic(COMMS_MANAGER_QUEUE_LENGTH, COMMS_MANAGER_QUEUE_ITEM_SIZE, commsQueueStack, &commsQueue);
+    vQueueAddToRegistry(commsQueueHandle, "comms mgr");
   }
 
   ASSERT((cc1120TransmitQueueStack != NULL) && (&cc1120TransmitQueue != NULL))
   if (cc1120TransmitQueueHandle == NULL) {
     cc1120TransmitQueueHandle = xQueueCreateStatic(CC1120_TRANSMIT_QUEUE_LENGTH, CC1120_TRANSMIT_QUEUE_ITEM_SIZE,
                                                    cc1120TransmitQueueStack, &cc1120TransmitQueue);
+    vQueueAddToRegistry(cc1120TransmitQueueHandle, "cc1120 transmit");
+  }
+
+  if (downlinkFrameFreeQueueHandle == NULL) {
+    downlinkFrameFreeQueueHandle = xQueueCreateStatic(DOWNLINK_FRAME_POOL_SIZE, DOWNLINK_FRAME_FREE_QUEUE_ITEM_SIZE,
+                                                      downlinkFrameFreeQueueStack, &downlinkFrameFreeQueue);
+    vQueueAddToRegistry(downlinkFrameFreeQueueHandle, "downlink frame free");
+    for (downlink_frame_handle_t handle = 0; handle < DOWNLINK_FRAME_POOL_SIZE; handle++) {
+      xQueueSend(downlinkFrameFreeQueueHandle, &handle, 0);
+    }
   }
 
   // TODO: Implement a key exchange algorithm instead of using Pre-Shared/static
@@ -303,10 +343,12 @@ obc_error_code_t sendToFrontCommsManagerQueue(comms_event_t *event) {
 void obcTaskFunctionCommsMgr(void *pvParameters) {
   obc_error_code_t errCode;
   comms_state_t commsState = *((comms_state_t *)pvParameters);
-  LOG_IF_ERROR_CODE(commsStateFns[commsState]());
 
+  // The initial state may already use the cc1120
   initAllCc1120TxRxSemaphores();
 
+  LOG_IF_ERROR_CODE(commsStateFns[commsState]());
+
   while (1) {
     comms_event_t queueMsg;
 
@@ -361,6 +403,52 @@ obc_error_code_t sendToCC1120TransmitQueue(transmit_event_t *event) {
   return OBC_ERR_CODE_QUEUE_FULL;
 }
 
+obc_error_code_t acquireDownlinkFrame(downlink_frame_handle_t *handle, packed_ax25_i_frame_t **frame) {
+  if (handle == NULL || frame == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (downlinkFrameFreeQueueHandle == NULL) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  if (xQueueReceive(downlinkFrameFreeQueueHandle, handle, DOWNLINK_FRAME_FREE_QUEUE_RX_WAIT_PERIOD) != pdPASS) {
+    return OBC_ERR_CODE_QUEUE_EMPTY;
+  }
+
+  *frame = &downlinkFramePool[*handle];
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t releaseDownlinkFrame(downlink_frame_handle_t handle) {
+  if (handle >= DOWNLINK_FRAME_POOL_SIZE) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (downlinkFrameFreeQueueHandle == NULL) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  // The free queue holds every handle, so it can only be full if a handle is released twice
+  if (xQueueSend(downlinkFrameFreeQueueHandle, &handle, 0) != pdPASS) {
+    return OBC_ERR_CODE_QUEUE_FULL;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getLastDownlinkStats(downlink_stats_t *stats) {
+  if (stats == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  taskENTER_CRITICAL();
+  *stats = lastDownlinkStats;
+  taskEXIT_CRITICAL();
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
 static obc_error_code_t handleDisconnectedState(void) {
   obc_error_code_t errCode;
   clearCurrentLinkDestAddress();
@@ -376,17 +464,12 @@ static obc_error_code_t handleAwaitingConnState(void) {
 #if COMMS_PHY == COMMS_PHY_UART
   uint8_t readBytes[AX25_MAXIMUM_U_FRAME_CMD_LENGTH] = {0};
   RETURN_IF_ERROR_CODE(sciReadBytes(readBytes, U_FRAME_COMMS_RECV_SIZE, portMAX_DELAY, portMAX_DELAY, UART_READ_REG));
-  for (uint16_t i = 0; i < AX25_MAXIMUM_U_FRAME_CMD_LENGTH; i++) {
-    RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&readBytes[i]));
-    if (readBytes[i] == AX25_FLAG && i > 0) {
-      break;
-    }
-  }
+  RETURN_IF_ERROR_CODE(sendToDecodeDataStream(readBytes, uartFrameLength(readBytes, sizeof(readBytes))));
 #else
   // switch cc1120 to receive mode and start receiving all the bytes for one
   // continuous transmission
   RETURN_IF_ERROR_CODE(rffm6404ActivateRx());
-  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask());
+  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask(CC1120_SYNC_WORD_TIMEOUT));
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SFSTXON));
 #endif
   return OBC_ERR_CODE_SUCCESS;
@@ -454,24 +537,12 @@ static obc_error_code_t handleAwaitingAckDiscState(void) {
    * for retries */
   obc_error_code_t errCode;
 #if COMMS_PHY == COMMS_PHY_UART
-  uint8_t rxByte;
-
-  // Read first byte
-  RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(1000), UART_READ_REG));
-
-  RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-
-  // Read the rest of the bytes until we stop uplinking
-  for (uint16_t i = 0; i < AX25_MAXIMUM_PKT_LEN; ++i) {
-    RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(10), UART_READ_REG));
-
-    RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-  }
+  RETURN_IF_ERROR_CODE(uartReceiveToDecodeTask());
 #else
   // switch cc1120 to receive mode and start receiving all the bytes for one
   // continuous transmission
   RETURN_IF_ERROR_CODE(rffm6404ActivateRx());
-  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask());
+  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask(CC1120_SYNC_WORD_TIMEOUT));
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SFSTXON));
 #endif
   return OBC_ERR_CODE_SUCCESS;
@@ -483,24 +554,12 @@ static obc_error_code_t handleAwaitingAckConnState(void) {
    * for retries */
   obc_error_code_t errCode;
 #if COMMS_PHY == COMMS_PHY_UART
-  uint8_t rxByte;
-
-  // Read first byte
-  RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(1000), UART_READ_REG));
-
-  RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-
-  // Read the rest of the bytes until we stop uplinking
-  for (uint16_t i = 0; i < AX25_MAXIMUM_PKT_LEN; ++i) {
-    RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(10), UART_READ_REG));
-
-    RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-  }
+  RETURN_IF_ERROR_CODE(uartReceiveToDecodeTask());
 #else
   // switch cc1120 to receive mode and start receiving all the bytes for one
   // continuous transmission
   RETURN_IF_ERROR_CODE(rffm6404ActivateRx());
-  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask());
+  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask(CC1120_SYNC_WORD_TIMEOUT));
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SFSTXON));
 #endif
   return OBC_ERR_CODE_SUCCESS;
@@ -511,17 +570,11 @@ static obc_error_code_t handleUplinkingState(void) {
 #if COMMS_PHY == COMMS_PHY_UART
   uint8_t readBytes[AX25_MAXIMUM_PKT_LEN] = {0};
   RETURN_IF_ERROR_CODE(sciReadBytes(readBytes, I_FRAME_COMMS_RECV_SIZE, portMAX_DELAY, portMAX_DELAY, UART_READ_REG));
-  uint16_t i;
-  for (i = 0; i < AX25_MAXIMUM_PKT_LEN; i++) {
-    RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&readBytes[i]));
-    if (readBytes[i] == AX25_FLAG && i > 0) {
-      break;
-    }
-  }
+  RETURN_IF_ERROR_CODE(sendToDecodeDataStream(readBytes, uartFrameLength(readBytes, sizeof(readBytes))));
 #else
   // switch cc1120 to receive mode and start receiving all the bytes for one
   // continuous transmission
-  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask());
+  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask(CC1120_SYNC_WORD_TIMEOUT));
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SFSTXON));
 #endif
   comms_event_t uplinkFinishedEvent = {.eventID = COMMS_EVENT_UPLINK_FINISHED};
@@ -534,6 +587,9 @@ static obc_error_code_t handleDownlinkingState(void) {
 #if COMMS_PHY != COMMS_PHY_UART
   RETURN_IF_ERROR_CODE(rffm6404ActivateTx(RFFM6404_VAPC_REGULAR_POWER_VAL));
 #endif
+  downlink_stats_t stats;
+  downlinkStatsStart(&stats, xTaskGetTickCount());
+
   for (uint16_t i = 0; i < COMMS_MAX_DOWNLINK_FRAMES; ++i) {
     transmit_event_t transmitEvent;
     // poll the transmit queue
@@ -541,19 +597,35 @@ static obc_error_code_t handleDownlinkingState(void) {
       LOG_ERROR_CODE(OBC_ERR_CODE_QUEUE_EMPTY);
     }
     if (transmitEvent.eventID == DOWNLINK_PACKET) {
+      if (transmitEvent.frameHandle >= DOWNLINK_FRAME_POOL_SIZE) {
+        LOG_ERROR_CODE(OBC_ERR_CODE_INVALID_ARG);
+        continue;
+      }
+
+      // The encoder fills the next pool frame while this one is on air
+      packed_ax25_i_frame_t *frame = &downlinkFramePool[transmitEvent.frameHandle];
+      TickType_t sendStartTick = xTaskGetTickCount();
 #if COMMS_PHY == COMMS_PHY_UART
-      RETURN_IF_ERROR_CODE(sciSendBytes((uint8_t *)transmitEvent.ax25Pkt.data, transmitEvent.ax25Pkt.length,
-                                        portMAX_DELAY, UART_PRINT_REG));
+      obc_error_code_t sendErrCode = sciSendBytes((uint8_t *)frame->data, frame->length, portMAX_DELAY, UART_PRINT_REG);
 #else
-      RETURN_IF_ERROR_CODE(cc1120Send((uint8_t *)transmitEvent.ax25Pkt.data, transmitEvent.ax25Pkt.length,
-                                      CC1120_TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT));
+      obc_error_code_t sendErrCode =
+          cc1120Send((uint8_t *)frame->data, frame->length, CC1120_TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT);
 #endif
+      downlinkStatsAddFrame(&stats, sendStartTick, xTaskGetTickCount(), frame->length);
+
+      LOG_IF_ERROR_CODE(releaseDownlinkFrame(transmitEvent.frameHandle));
+      RETURN_IF_ERROR_CODE(sendErrCode);
     } else if (transmitEvent.eventID == END_DOWNLINK) {
       break;
     } else {
       LOG_ERROR_CODE(OBC_ERR_CODE_UNSUPPORTED_EVENT);
     }
   }
+
+  taskENTER_CRITICAL();
+  lastDownlinkStats = stats;
+  taskEXIT_CRITICAL();
+
   comms_event_t finishedDownlinkEvent = {.eventID = COMMS_EVENT_DOWNLINK_FINISHED};
   RETURN_IF_ERROR_CODE(sendToCommsManagerQueue(&finishedDownlinkEvent));
   return OBC_ERR_CODE_SUCCESS;
@@ -571,3 +643,52 @@ static obc_error_code_t handleEmergUplinkState(void) {
   // TODO: Fill this in
   return OBC_ERR_CODE_SUCCESS;
 }
+
+#if COMMS_PHY == COMMS_PHY_UART
+/**
+ * @brief finds the end of the first frame in a UART read
+ *
+ * @param readBytes bytes read from the UART, starting with a flag
+ * @param readBytesLen number of bytes in readBytes
+ *
+ * @return uint16_t - number of bytes up to and including the first end flag, or readBytesLen if there is none
+ */
+static uint16_t uartFrameLength(const uint8_t *readBytes, uint16_t readBytesLen) {
+  if (readBytesLen <= 1) {
+    return readBytesLen;
+  }
+
+  const uint8_t *endFlag = memchr(readBytes + 1, AX25_FLAG, readBytesLen - 1);
+  return (endFlag == NULL) ? readBytesLen : (uint16_t)(endFlag - readBytes + 1);
+}
+
+/**
+ * @brief reads one UART transmission byte by byte until the line goes quiet and forwards it to the decode task
+ *
+ * @return obc_error_code_t - whether or not the transmission was received and forwarded
+ */
+static obc_error_code_t uartReceiveToDecodeTask(void) {
+  obc_error_code_t errCode;
+  uint8_t rxBytes[AX25_MAXIMUM_PKT_LEN + 1];
+  uint16_t rxBytesLen = 0;
+
+  // Read first byte
+  RETURN_IF_ERROR_CODE(sciReadBytes(&rxBytes[rxBytesLen++], 1, portMAX_DELAY, pdMS_TO_TICKS(1000), UART_READ_REG));
+
+  // Read the rest of the bytes until we stop uplinking
+  obc_error_code_t readErrCode = OBC_ERR_CODE_SUCCESS;
+  while (rxBytesLen < sizeof(rxBytes)) {
+    readErrCode = sciReadBytes(&rxBytes[rxBytesLen], 1, portMAX_DELAY, pdMS_TO_TICKS(10), UART_READ_REG);
+    if (readErrCode != OBC_ERR_CODE_SUCCESS) {
+      break;
+    }
+    rxBytesLen++;
+  }
+
+  // Forward everything received before the read stopped in one write
+  RETURN_IF_ERROR_CODE(sendToDecodeDataStream(rxBytes, rxBytesLen));
+  RETURN_IF_ERROR_CODE(readErrCode);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+#endif
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "downlink_stats.h"
 #include "obc_errors.h"
 #include "telemetry_manager.h"
 #include "obc_gs_ax25.h"
@@ -8,8 +9,19 @@
 #include <os_semphr.h>
 #include <sys_common.h>
 
+// Physical layer of the comms link, selected with COMMS_PHY
+#define COMMS_PHY_UART 0
+#define COMMS_PHY_CC1120 1
+
+#ifndef COMMS_PHY
+#define COMMS_PHY COMMS_PHY_UART
+#endif
+
 #define MAX_DOWNLINK_TELEM_BUFFER_SIZE 1U
 
+// One frame on air, one waiting in the transmit queue and one being encoded
+#define DOWNLINK_FRAME_POOL_SIZE 3U
+
 #define U_FRAME_COMMS_RECV_SIZE 30
 #define I_FRAME_COMMS_RECV_SIZE 300
 
@@ -50,9 +62,11 @@ typedef struct {
 
 typedef enum { DOWNLINK_PACKET, END_DOWNLINK } transmit_event_id_t;
 
+typedef uint8_t downlink_frame_handle_t;
+
 typedef struct {
   transmit_event_id_t eventID;
-  packed_ax25_i_frame_t ax25Pkt;
+  downlink_frame_handle_t frameHandle;  // Pool frame to send for DOWNLINK_PACKET
 } transmit_event_t;
 
 typedef enum {
@@ -92,3 +106,31 @@ obc_error_code_t sendToFrontCommsManagerQueue(comms_event_t *event);
  * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the packet was sent to the queue
  */
 obc_error_code_t sendToCC1120TransmitQueue(transmit_event_t *event);
+
+/**
+ * @brief Takes a free frame from the downlink frame pool, waiting for one if they are all in use
+ *
+ * The frame is returned to the pool by the comms manager once the DOWNLINK_PACKET event for it has been sent, or by
+ * releaseDownlinkFrame if it is not sent.
+ *
+ * @param handle - Set to the handle of the frame, to be put in the DOWNLINK_PACKET event
+ * @param frame - Set to the frame to fill with a stuffed AX.25 packet
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if a frame was taken
+ */
+obc_error_code_t acquireDownlinkFrame(downlink_frame_handle_t *handle, packed_ax25_i_frame_t **frame);
+
+/**
+ * @brief Returns a frame to the downlink frame pool without sending it
+ *
+ * @param handle - Handle from acquireDownlinkFrame
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the frame was returned
+ */
+obc_error_code_t releaseDownlinkFrame(downlink_frame_handle_t handle);
+
+/**
+ * @brief Gets the radio duty cycle and inter-frame gaps of the last completed downlink
+ *
+ * @param stats - Set to the stats of the last downlink
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the stats were copied
+ */
+obc_error_code_t getLastDownlinkStats(downlink_stats_t *stats);
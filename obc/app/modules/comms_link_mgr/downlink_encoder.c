@@ -6,11 +6,13 @@
 #include "obc_gs_fec.h"
 
 #include "obc_gs_telemetry_pack.h"
+#include "obc_gs_telemetry_record.h"
 #include "obc_sci_io.h"
 #include "telemetry_fs_utils.h"
 #include "telemetry_manager.h"
 
 #include "comms_manager.h"
+#include "obc_assert.h"
 #include "obc_errors.h"
 #include "obc_logging.h"
 #include "obc_reliance_fs.h"
@@ -22,7 +24,9 @@
 #include <os_task.h>
 
 #include <gio.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys_common.h>
 
 #define COMMS_TELEM_ENCODE_QUEUE_LENGTH 2U
@@ -34,6 +38,50 @@ static QueueHandle_t telemEncodeQueueHandle = NULL;
 static StaticQueue_t telemEncodeQueue;
 static uint8_t telemEncodeQueueStack[COMMS_TELEM_ENCODE_QUEUE_LENGTH * COMMS_TELEM_ENCODE_QUEUE_ITEM_SIZE];
 
+// Holds a block of packed telemetry records read from a telemetry file; too large for the task stack
+static telemetry_record_block_t telemBlock;
+
+// Handles of the command response buffers that are not in use
+#define CMD_RESPONSE_FREE_QUEUE_ITEM_SIZE sizeof(cmd_response_handle_t)
+#define CMD_RESPONSE_FREE_QUEUE_RX_WAIT_PERIOD portMAX_DELAY
+
+static QueueHandle_t cmdResponseFreeQueueHandle = NULL;
+static StaticQueue_t cmdResponseFreeQueue;
+static uint8_t cmdResponseFreeQueueStack[CMD_RESPONSE_POOL_SIZE * CMD_RESPONSE_FREE_QUEUE_ITEM_SIZE];
+
+static uint8_t cmdResponsePool[CMD_RESPONSE_POOL_SIZE][RS_DECODED_SIZE];
+
+STATIC_ASSERT(CMD_RESPONSE_POOL_SIZE <= UINT8_MAX, "command response handles must fit in a cmd_response_handle_t");
+STATIC_ASSERT(RS_DECODED_SIZE <= UINT8_MAX, "command response lengths must fit in a uint8_t");
+
+/**
+ * @brief Adds a packed command response to the RS block being built, sending the block first if the response does
+ * not fit in it
+ *
+ * @param cmdResponse - The DOWNLINK_CMD_RESPONSE event; its buffer is returned to the pool
+ * @param cmdResBlock - The RS block of coalesced responses, zeroed past cmdResBlockLen
+ * @param cmdResBlockLen - Pointer to the number of bytes filled in cmdResBlock
+ * @return obc_error_code_t
+ */
+static obc_error_code_t coalesceCmdResponse(const cmd_response_event_t *cmdResponse, uint8_t *cmdResBlock,
+                                            uint8_t *cmdResBlockLen);
+
+/**
+ * @brief Downlinks the RS block of coalesced command responses and ends the downlink
+ *
+ * @param cmdResBlock - The RS block of coalesced responses, zeroed past cmdResBlockLen
+ * @param cmdResBlockLen - Pointer to the number of bytes filled in cmdResBlock; reset to 0
+ * @return obc_error_code_t
+ */
+static obc_error_code_t flushCmdResponses(uint8_t *cmdResBlock, uint8_t *cmdResBlockLen);
+
+/**
+ * @brief Checks whether the next event in the encode queue is another command response
+ *
+ * @return true if a DOWNLINK_CMD_RESPONSE event is waiting
+ */
+static bool isCmdResponsePending(void);
+
 /**
  * @brief Sends data from a telemetry buffer to the CC1120 transmit queue
  *
@@ -76,18 +124,77 @@ static obc_error_code_t sendPacket(uint8_t *sendBuffer);
  *
  * @param singleTelem - A single piece of telemetry_data_t
  * @param telemPacket - A complete telemetry packet of size 223B
- * @param telemPacketOffset - Pointer to number of bytes already filled in
- * telemPacket
+ * @param telemCompressor - Compressor writing into telemPacket
  * @return obc_error_code_t
  */
 static obc_error_code_t sendOrPackNextTelemetry(telemetry_data_t *singleTelem, packed_telem_packet_t *telemPacket,
-                                                size_t *telemPacketOffset);
+                                                telemetry_compressor_t *telemCompressor);
+
+/**
+ * @brief Either sends the current telemetry packet or compresses an already
+ * packed piece of telemetry into it
+ *
+ * @param packedTelem - A single piece of telemetry as packed by packTelemetry()
+ * @param packedTelemSize - Number of bytes in packedTelem
+ * @param telemPacket - A complete telemetry packet of size 223B
+ * @param telemCompressor - Compressor writing into telemPacket
+ * @return obc_error_code_t
+ */
+static obc_error_code_t sendOrCompressPackedTelemetry(const uint8_t *packedTelem, uint32_t packedTelemSize,
+                                                      packed_telem_packet_t *telemPacket,
+                                                      telemetry_compressor_t *telemCompressor);
 
 void obcTaskInitCommsDownlinkEncoder(void) {
   if (telemEncodeQueueHandle == NULL) {
     telemEncodeQueueHandle = xQueueCreateStatic(COMMS_TELEM_ENCODE_QUEUE_LENGTH, COMMS_TELEM_ENCODE_QUEUE_ITEM_SIZE,
                                                 telemEncodeQueueStack, &telemEncodeQueue);
+    vQueueAddToRegistry(telemEncodeQueueHandle, "telem encode");
   }
+
+  if (cmdResponseFreeQueueHandle == NULL) {
+    cmdResponseFreeQueueHandle = xQueueCreateStatic(CMD_RESPONSE_POOL_SIZE, CMD_RESPONSE_FREE_QUEUE_ITEM_SIZE,
+                                                    cmdResponseFreeQueueStack, &cmdResponseFreeQueue);
+    vQueueAddToRegistry(cmdResponseFreeQueueHandle, "cmd response free");
+    for (cmd_response_handle_t handle = 0; handle < CMD_RESPONSE_POOL_SIZE; handle++) {
+      xQueueSend(cmdResponseFreeQueueHandle, &handle, 0);
+    }
+  }
+}
+
+obc_error_code_t acquireCmdResponseBuffer(cmd_response_handle_t *handle, uint8_t **buffer) {
+  if (handle == NULL || buffer == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (cmdResponseFreeQueueHandle == NULL) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  if (xQueueReceive(cmdResponseFreeQueueHandle, handle, CMD_RESPONSE_FREE_QUEUE_RX_WAIT_PERIOD) != pdPASS) {
+    return OBC_ERR_CODE_QUEUE_EMPTY;
+  }
+
+  *buffer = cmdResponsePool[*handle];
+  memset(*buffer, 0, RS_DECODED_SIZE);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t releaseCmdResponseBuffer(cmd_response_handle_t handle) {
+  if (handle >= CMD_RESPONSE_POOL_SIZE) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (cmdResponseFreeQueueHandle == NULL) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  // The free queue holds every handle, so it can only be full if a handle is released twice
+  if (xQueueSend(cmdResponseFreeQueueHandle, &handle, 0) != pdPASS) {
+    return OBC_ERR_CODE_QUEUE_FULL;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
 }
 
 /**
@@ -110,8 +217,8 @@ obc_error_code_t sendToDownlinkEncodeQueue(encode_event_t *queueMsg) {
 
 void obcTaskFunctionCommsDownlinkEncoder(void *pvParameters) {
   obc_error_code_t errCode;
-  uint8_t cmdResBuffer[RS_DECODED_SIZE] = {0};
-  uint8_t cmdResBytesRecieved = 0;
+  uint8_t cmdResBlock[RS_DECODED_SIZE] = {0};
+  uint8_t cmdResBlockLen = 0;
 
   while (1) {
     encode_event_t queueMsg;
@@ -137,19 +244,11 @@ void obcTaskFunctionCommsDownlinkEncoder(void *pvParameters) {
         LOG_IF_ERROR_CODE(sendToCC1120TransmitQueue(&transmitEvent));
         break;
       case DOWNLINK_CMD_RESPONSE:
-        if (cmdResBytesRecieved < RS_DECODED_SIZE) {
-          cmdResBuffer[cmdResBytesRecieved] = queueMsg.cmdResponseByte;
-          cmdResBytesRecieved++;
-        }
+        LOG_IF_ERROR_CODE(coalesceCmdResponse(&queueMsg.cmdResponse, cmdResBlock, &cmdResBlockLen));
 
-        if (cmdResBytesRecieved >= RS_DECODED_SIZE) {
-          // Downlink this response if the array gets filled up
-          setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
-          LOG_IF_ERROR_CODE(sendPacket(cmdResBuffer));
-          transmitEvent.eventID = END_DOWNLINK;
-          LOG_IF_ERROR_CODE(sendToCC1120TransmitQueue(&transmitEvent));
-          cmdResBytesRecieved = 0;
-          memset(cmdResBuffer, 0, RS_DECODED_SIZE);  // Not required, but done to avoid any edge cases
+        // Keep filling the block while more responses are already waiting
+        if (!isCmdResponsePending()) {
+          LOG_IF_ERROR_CODE(flushCmdResponses(cmdResBlock, &cmdResBlockLen));
         }
         break;
       default:
@@ -179,18 +278,19 @@ static obc_error_code_t sendTelemetryBuffer(telemetry_data_t *telemetryDataBuffe
 
   // Initialize important variables related to packing and queueing the
   // telemetry to be sen
-  packed_telem_packet_t telemPacket = {0};  // Holds 223B of "raw" telemetry data.
+  packed_telem_packet_t telemPacket = {0};  // Holds 223B of compressed telemetry data.
                                             // Zero initialized because telem IDs of 0 are ignored at the ground
                                             // station
-  size_t telemPacketOffset = 0;             // Number of bytes filled in telemPacket
+  telemetry_compressor_t telemCompressor;   // Tracks the bytes filled in telemPacket
+  telemCompressorInit(&telemCompressor, telemPacket.data, PACKED_TELEM_PACKET_SIZE);
 
   // Loop through all telemetry data in the buffer
   for (uint8_t i = 0; i < numTelemetryData; i++) {
-    RETURN_IF_ERROR_CODE(sendOrPackNextTelemetry(telemetryDataBuffer + i, &telemPacket, &telemPacketOffset));
+    RETURN_IF_ERROR_CODE(sendOrPackNextTelemetry(telemetryDataBuffer + i, &telemPacket, &telemCompressor));
   }
 
   // Send the last packet if it is not empty
-  if (telemPacketOffset == 0) return OBC_ERR_CODE_SUCCESS;
+  if (telemCompressor.offset == 0) return OBC_ERR_CODE_SUCCESS;
 
   RETURN_IF_ERROR_CODE(sendPacket(telemPacket.data));
 
@@ -214,20 +314,25 @@ static obc_error_code_t sendTelemetryFile(uint32_t telemetryBatchId) {
 
   // Initialize important variables related to packing and queueing the
   // telemetry to be sent
-  telemetry_data_t singleTelem;  // Holds a single piece of telemetry from getNextTelemetry()
-
-  packed_telem_packet_t telemPacket = {0};  // Holds 223B of "raw" telemetry data.
+  packed_telem_packet_t telemPacket = {0};  // Holds 223B of compressed telemetry data.
                                             // Zero initialized because telem IDs of 0 are ignored at the ground
                                             // station
-  size_t telemPacketOffset = 0;             // Number of bytes filled in telemPacket
-
-  // Read a single piece of telemetry from the file
-  while ((errCode = readNextTelemetryFromFile(fd, &singleTelem)) == OBC_ERR_CODE_SUCCESS) {
-    errCode = sendOrPackNextTelemetry(&singleTelem, &telemPacket, &telemPacketOffset);
-    if (errCode != OBC_ERR_CODE_SUCCESS) {
-      LOG_ERROR_CODE(errCode);
-      RETURN_IF_ERROR_CODE(closeTelemetryFile(fd));
-      return errCode;
+  telemetry_compressor_t telemCompressor;   // Tracks the bytes filled in telemPacket
+  telemCompressorInit(&telemCompressor, telemPacket.data, PACKED_TELEM_PACKET_SIZE);
+
+  // Read a block of telemetry from the file; its records are already packed for the downlink
+  while ((errCode = readNextTelemetryBlockFromFile(fd, &telemBlock)) == OBC_ERR_CODE_SUCCESS) {
+    uint16_t recordOffset = 0;
+    const uint8_t *packedTelem = NULL;
+    uint8_t packedTelemSize = 0;
+
+    while (telemRecordBlockNext(&telemBlock, &recordOffset, &packedTelem, &packedTelemSize)) {
+      errCode = sendOrCompressPackedTelemetry(packedTelem, packedTelemSize, &telemPacket, &telemCompressor);
+      if (errCode != OBC_ERR_CODE_SUCCESS) {
+        LOG_ERROR_CODE(errCode);
+        RETURN_IF_ERROR_CODE(closeTelemetryFile(fd));
+        return errCode;
+      }
     }
   }
 
@@ -241,7 +346,7 @@ static obc_error_code_t sendTelemetryFile(uint32_t telemetryBatchId) {
   }
 
   // If there's no data left to send, return
-  if (telemPacketOffset == 0) return OBC_ERR_CODE_SUCCESS;
+  if (telemCompressor.offset == 0) return OBC_ERR_CODE_SUCCESS;
 
   errCode = sendPacket(telemPacket.data);
   if (errCode != OBC_ERR_CODE_SUCCESS) {
@@ -301,12 +406,11 @@ static obc_error_code_t getFileDescriptor(uint32_t telemetryBatchId, int32_t *fd
  *
  * @param singleTelem - A single piece of telemetry_data_t
  * @param telemPacket - A complete telemetry packet of size 223B
- * @param telemPacketOffset - Pointer to number of bytes already filled in
- * telemPacket
+ * @param telemCompressor - Compressor writing into telemPacket
  * @return obc_error_code_t
  */
 static obc_error_code_t sendOrPackNextTelemetry(telemetry_data_t *singleTelem, packed_telem_packet_t *telemPacket,
-                                                size_t *telemPacketOffset) {
+                                                telemetry_compressor_t *telemCompressor) {
   obc_error_code_t errCode;
 
   uint8_t packedSingleTelem[MAX_TELEMETRY_DATA_SIZE];  // Holds a serialized
@@ -320,18 +424,33 @@ static obc_error_code_t sendOrPackNextTelemetry(telemetry_data_t *singleTelem, p
     return OBC_ERR_CODE_FAILED_PACK;
   }
 
+  RETURN_IF_ERROR_CODE(
+      sendOrCompressPackedTelemetry(packedSingleTelem, packedSingleTelemSize, telemPacket, telemCompressor));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t sendOrCompressPackedTelemetry(const uint8_t *packedTelem, uint32_t packedTelemSize,
+                                                      packed_telem_packet_t *telemPacket,
+                                                      telemetry_compressor_t *telemCompressor) {
+  obc_error_code_t errCode;
+
+  obc_gs_error_code_t packErrCode = telemCompressorAdd(telemCompressor, packedTelem, packedTelemSize);
+
   // If the single telemetry is too large to continue adding to the telemPacket,
   // send the telemPacket
-  if ((*telemPacketOffset) + packedSingleTelemSize > PACKED_TELEM_PACKET_SIZE) {
+  if (packErrCode == OBC_GS_ERR_CODE_BUFF_TOO_SMALL) {
     RETURN_IF_ERROR_CODE(sendPacket(telemPacket->data));
-    // Reset the packedTelem struct and offset
+    // Reset the packedTelem struct and start a new compressed packet
     *telemPacket = (packed_telem_packet_t){0};
-    *telemPacketOffset = 0;
+    telemCompressorInit(telemCompressor, telemPacket->data, PACKED_TELEM_PACKET_SIZE);
+
+    packErrCode = telemCompressorAdd(telemCompressor, packedTelem, packedTelemSize);
   }
 
-  // Copy the telemetry data into the packedTelem struct
-  memcpy(telemPacket->data + (*telemPacketOffset), packedSingleTelem, packedSingleTelemSize);
-  *telemPacketOffset += packedSingleTelemSize;
+  if (packErrCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_FAILED_PACK;
+  }
 
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -343,32 +462,105 @@ static obc_error_code_t sendOrPackNextTelemetry(telemetry_data_t *singleTelem, p
  * @return obc_error_code_t
  */
 static obc_error_code_t sendPacket(uint8_t *sendBuffer) {
-  packed_rs_packet_t fecPkt = {0};  // Holds a 255B RS packet
-  unstuffed_ax25_i_frame_t unstuffedAx25Pkt = {0};
-  transmit_event_t transmitEvent = {.eventID = DOWNLINK_PACKET};
+  obc_error_code_t errCode;
+
+  // Static to keep them off the encoder stack; only this task encodes
+  static packed_rs_packet_t fecPkt;  // Holds a 255B RS packet
+  static unstuffed_ax25_i_frame_t unstuffedAx25Pkt;
+
+  // Encode straight into a pool frame. This blocks once every frame is queued or on air, which paces the encoder to
+  // the radio while keeping the next frame ready as soon as the current one finishes.
+  downlink_frame_handle_t frameHandle;
+  packed_ax25_i_frame_t *frame;
+  RETURN_IF_ERROR_CODE(acquireDownlinkFrame(&frameHandle, &frame));
 
   obc_gs_error_code_t interfaceErr;
   // Apply Reed Solomon FEC
   interfaceErr = rsEncode(sendBuffer, &fecPkt);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
+    LOG_IF_ERROR_CODE(releaseDownlinkFrame(frameHandle));
     return OBC_ERR_CODE_FEC_ENCODE_FAILURE;
   }
 
   // Perform AX.25 framing
   interfaceErr = ax25SendIFrame((uint8_t *)&fecPkt.data, RS_ENCODED_SIZE, &unstuffedAx25Pkt);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
+    LOG_IF_ERROR_CODE(releaseDownlinkFrame(frameHandle));
     return OBC_ERR_CODE_AX25_ENCODE_FAILURE;
   }
 
-  interfaceErr = ax25Stuff(unstuffedAx25Pkt.data, unstuffedAx25Pkt.length, transmitEvent.ax25Pkt.data,
-                           &transmitEvent.ax25Pkt.length);
+  interfaceErr = ax25Stuff(unstuffedAx25Pkt.data, unstuffedAx25Pkt.length, frame->data, &frame->length);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
+    LOG_IF_ERROR_CODE(releaseDownlinkFrame(frameHandle));
     return OBC_ERR_CODE_AX25_BIT_STUFF_FAILURE;
   }
 
-  // Send into CC1120 transmit queue
+  // Send into CC1120 transmit queue; the comms manager returns the frame to the pool once it is on air
+  transmit_event_t transmitEvent = {.eventID = DOWNLINK_PACKET, .frameHandle = frameHandle};
+  errCode = sendToCC1120TransmitQueue(&transmitEvent);
+  if (errCode != OBC_ERR_CODE_SUCCESS) {
+    LOG_IF_ERROR_CODE(releaseDownlinkFrame(frameHandle));
+    return OBC_ERR_CODE_QUEUE_FULL;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t coalesceCmdResponse(const cmd_response_event_t *cmdResponse, uint8_t *cmdResBlock,
+                                            uint8_t *cmdResBlockLen) {
   obc_error_code_t errCode;
+
+  if (cmdResponse->handle >= CMD_RESPONSE_POOL_SIZE) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (cmdResponse->length > RS_DECODED_SIZE) {
+    RETURN_IF_ERROR_CODE(releaseCmdResponseBuffer(cmdResponse->handle));
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (*cmdResBlockLen + cmdResponse->length > RS_DECODED_SIZE) {
+    errCode = flushCmdResponses(cmdResBlock, cmdResBlockLen);
+    if (errCode != OBC_ERR_CODE_SUCCESS) {
+      LOG_ERROR_CODE(errCode);
+    }
+  }
+
+  memcpy(&cmdResBlock[*cmdResBlockLen], cmdResponsePool[cmdResponse->handle], cmdResponse->length);
+  *cmdResBlockLen += cmdResponse->length;
+
+  RETURN_IF_ERROR_CODE(releaseCmdResponseBuffer(cmdResponse->handle));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t flushCmdResponses(uint8_t *cmdResBlock, uint8_t *cmdResBlockLen) {
+  obc_error_code_t errCode;
+
+  if (*cmdResBlockLen == 0) {
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+  errCode = sendPacket(cmdResBlock);
+
+  // Zero the block even if the send failed, since a zero cmdId marks the end of the responses at the ground station
+  memset(cmdResBlock, 0, RS_DECODED_SIZE);
+  *cmdResBlockLen = 0;
+  RETURN_IF_ERROR_CODE(errCode);
+
+  transmit_event_t transmitEvent = {.eventID = END_DOWNLINK};
   RETURN_IF_ERROR_CODE(sendToCC1120TransmitQueue(&transmitEvent));
 
   return OBC_ERR_CODE_SUCCESS;
 }
+
+static bool isCmdResponsePending(void) {
+  encode_event_t nextMsg;
+
+  if (xQueuePeek(telemEncodeQueueHandle, &nextMsg, 0) != pdPASS) {
+    return false;
+  }
+
+  return nextMsg.eventID == DOWNLINK_CMD_RESPONSE;
+}
@@ -6,6 +6,9 @@
 #include "obc_errors.h"
 #include "comms_manager.h"
 
+// Number of packed command responses that can be waiting for the downlink encoder at once
+#define CMD_RESPONSE_POOL_SIZE 4U
+
 typedef enum { DOWNLINK_TELEMETRY_FILE, DOWNLINK_DATA_BUFFER, DOWNLINK_CMD_RESPONSE } encode_event_id_t;
 
 typedef struct {
@@ -13,12 +16,19 @@ typedef struct {
   uint8_t bufferSize;
 } telemetry_data_buffer_t;
 
+typedef uint8_t cmd_response_handle_t;
+
+typedef struct {
+  cmd_response_handle_t handle;  // Pool buffer holding the packed response
+  uint8_t length;                // Number of packed bytes in the buffer
+} cmd_response_event_t;
+
 typedef struct {
   encode_event_id_t eventID;
   union {
     uint32_t telemetryBatchId;
     telemetry_data_buffer_t telemetryDataBuffer;
-    uint8_t cmdResponseByte;
+    cmd_response_event_t cmdResponse;
   };
 } encode_event_t;
 
@@ -29,3 +39,23 @@ typedef struct {
  * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if the telemetry batch ID was successfully sent to the queue
  */
 obc_error_code_t sendToDownlinkEncodeQueue(encode_event_t *queueMsg);
+
+/**
+ * @brief Takes a free command response buffer from the pool, waiting for one if they are all in use
+ *
+ * The buffer is handed back to the pool by the downlink encoder once a DOWNLINK_CMD_RESPONSE event for it has been
+ * processed, or by releaseCmdResponseBuffer if the response is not sent.
+ *
+ * @param handle - Set to the handle of the buffer, to be put in the DOWNLINK_CMD_RESPONSE event
+ * @param buffer - Set to the buffer, which holds up to RS_DECODED_SIZE bytes
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if a buffer was taken
+ */
+obc_error_code_t acquireCmdResponseBuffer(cmd_response_handle_t *handle, uint8_t **buffer);
+
+/**
+ * @brief Returns a command response buffer to the pool without sending it
+ *
+ * @param handle - Handle from acquireCmdResponseBuffer
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if the buffer was returned
+ */
+obc_error_code_t releaseCmdResponseBuffer(cmd_response_handle_t handle);
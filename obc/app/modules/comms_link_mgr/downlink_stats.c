@@ -0,0 +1,54 @@
+#include "downlink_stats.h"
+
+#include <stddef.h>
+
+void downlinkStatsStart(downlink_stats_t *stats, uint32_t nowTick) {
+  if (stats == NULL) {
+    return;
+  }
+
+  *stats = (downlink_stats_t){.startTick = nowTick, .lastFrameEndTick = nowTick};
+}
+
+void downlinkStatsAddFrame(downlink_stats_t *stats, uint32_t sendStartTick, uint32_t sendEndTick, uint32_t frameLen) {
+  if (stats == NULL) {
+    return;
+  }
+
+  // The wait for the first frame is encoder startup, not a gap between frames
+  if (stats->framesSent > 0) {
+    uint32_t gap = sendStartTick - stats->lastFrameEndTick;
+    stats->gapTicks += gap;
+    if (gap > stats->maxGapTicks) {
+      stats->maxGapTicks = gap;
+    }
+  } else {
+    stats->startTick = sendStartTick;
+  }
+
+  stats->busyTicks += sendEndTick - sendStartTick;
+  stats->bytesSent += frameLen;
+  stats->framesSent++;
+  stats->lastFrameEndTick = sendEndTick;
+}
+
+uint16_t downlinkStatsDutyCyclePermille(const downlink_stats_t *stats) {
+  if (stats == NULL || stats->framesSent == 0) {
+    return 0;
+  }
+
+  uint32_t totalTicks = stats->lastFrameEndTick - stats->startTick;
+  if (totalTicks == 0) {
+    return 1000U;
+  }
+
+  return (uint16_t)(((uint64_t)stats->busyTicks * 1000U) / totalTicks);
+}
+
+uint32_t downlinkStatsMeanGapTicks(const downlink_stats_t *stats) {
+  if (stats == NULL || stats->framesSent < 2) {
+    return 0;
+  }
+
+  return stats->gapTicks / (stats->framesSent - 1);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Radio utilization over one downlink
+ *
+ * Times are in RTOS ticks. A frame is busy from when it is handed to the radio until the radio driver returns, and a
+ * gap is the time from the end of one frame to the start of the next one.
+ */
+typedef struct {
+  uint32_t framesSent;        // Frames handed to the radio
+  uint32_t bytesSent;         // Stuffed bytes handed to the radio
+  uint32_t busyTicks;         // Total time spent sending frames
+  uint32_t gapTicks;          // Total time between frames
+  uint32_t maxGapTicks;       // Longest time between two frames
+  uint32_t startTick;         // Tick the first frame started at, or the downlink if none were sent
+  uint32_t lastFrameEndTick;  // Tick the last frame finished at
+} downlink_stats_t;
+
+/**
+ * @brief Clears the stats at the start of a downlink
+ *
+ * @param stats The stats to clear
+ * @param nowTick The current tick count
+ */
+void downlinkStatsStart(downlink_stats_t *stats, uint32_t nowTick);
+
+/**
+ * @brief Records one frame sent to the radio
+ *
+ * @param stats The stats to update
+ * @param sendStartTick Tick the frame was handed to the radio
+ * @param sendEndTick Tick the radio driver returned
+ * @param frameLen Number of bytes in the frame
+ */
+void downlinkStatsAddFrame(downlink_stats_t *stats, uint32_t sendStartTick, uint32_t sendEndTick, uint32_t frameLen);
+
+/**
+ * @brief Gets the fraction of the downlink the radio spent sending frames
+ *
+ * Only the time from the start of the first frame to the end of the last frame is counted, so neither the wait for the
+ * first encoded frame nor the wait for END_DOWNLINK lowers the duty cycle.
+ *
+ * @param stats The stats of the downlink
+ * @return uint16_t Duty cycle in tenths of a percent, 0 if no frames were sent
+ */
+uint16_t downlinkStatsDutyCyclePermille(const downlink_stats_t *stats);
+
+/**
+ * @brief Gets the average time between two frames
+ *
+ * @param stats The stats of the downlink
+ * @return uint32_t Mean gap in ticks, 0 if fewer than two frames were sent
+ */
+uint32_t downlinkStatsMeanGapTicks(const downlink_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,12 +4,16 @@
 #include "cc1120_txrx.h"
 #include "command_manager.h"
 #include "comms_manager.h"
+#include "obc_assert.h"
 #include "obc_board_config.h"
+#include "obc_byte_ring.h"
 #include "obc_gs_aes128.h"
 #include "obc_gs_ax25.h"
+#include "obc_gs_ax25_frame_extractor.h"
 #include "obc_gs_command_data.h"
 #include "obc_gs_command_id.h"
 #include "obc_gs_command_unpack.h"
+#include "obc_gs_erasure_hints.h"
 #include "obc_gs_errors.h"
 #include "obc_gs_fec.h"
 #include "obc_logging.h"
@@ -19,7 +23,6 @@
 #include <FreeRTOS.h>
 #include <gio.h>
 #include <os_portmacro.h>
-#include <os_queue.h>
 #include <os_semphr.h>
 #include <os_task.h>
 #include <os_timer.h>
@@ -30,25 +33,68 @@
 #include <stdio.h>
 #include <string.h>
 
-// decode data queue length should be double TXRX_INTERRUPT_THRESHOLD for safety
-// to avoid cc1120 getting blocked can be reduced later depending on memory
-// limitations
-#define DECODE_DATA_QUEUE_LENGTH 2 * TXRX_INTERRUPT_THRESHOLD
-#define DECODE_DATA_QUEUE_ITEM_SIZE sizeof(uint8_t)
-#define DECODE_DATA_QUEUE_RX_WAIT_PERIOD portMAX_DELAY
-#define DECODE_DATA_QUEUE_TX_WAIT_PERIOD portMAX_DELAY
+// The decode data stream must hold at least a few TXRX_INTERRUPT_THRESHOLD
+// chunks so the cc1120 is not blocked while a frame is being decoded. Frames
+// are decoded in place, so it also has to hold a full stuffed frame.
+#define DECODE_DATA_STREAM_SIZE 1024U
+#define DECODE_DATA_STREAM_RX_WAIT_PERIOD portMAX_DELAY
+#define DECODE_DATA_STREAM_TX_WAIT_PERIOD portMAX_DELAY
 #define AX25_TIMEOUT_MILLISECONDS 330000
 #define TIMER_QUEUE_TX_TIMEOUT_MILLISECONDS 500
 #define TIMER_NAME "flag_timeout"
 
+// Chunks received with poor link quality that are remembered at once. The ring holds at most
+// DECODE_DATA_STREAM_SIZE / TXRX_INTERRUPT_THRESHOLD chunks that have not been decoded yet, so older entries are
+// never needed.
+#define POOR_LINK_RANGE_COUNT 16U
+#define MAX_POOR_RANGES_PER_FRAME 8U
+
 static bool isStartFlagReceived;
 
-// Decode Data Queue
-static QueueHandle_t decodeDataQueueHandle = NULL;
-static StaticQueue_t decodeDataQueue;
-static uint8_t decodeDataQueueStack[DECODE_DATA_QUEUE_LENGTH * DECODE_DATA_QUEUE_ITEM_SIZE];
+STATIC_ASSERT((DECODE_DATA_STREAM_SIZE & (DECODE_DATA_STREAM_SIZE - 1)) == 0,
+              "DECODE_DATA_STREAM_SIZE must be a power of 2");
+STATIC_ASSERT(DECODE_DATA_STREAM_SIZE >= 2 * (AX25_MAXIMUM_PKT_LEN), "Decode data stream must hold two full frames");
+STATIC_ASSERT(DECODE_DATA_STREAM_SIZE >= 2 * TXRX_INTERRUPT_THRESHOLD, "Decode data stream must hold two RX chunks");
+STATIC_ASSERT(POOR_LINK_RANGE_COUNT > DECODE_DATA_STREAM_SIZE / TXRX_INTERRUPT_THRESHOLD,
+              "Poor link ranges must cover every chunk in the decode data stream");
+
+// Decode Data Stream
+// Received bytes are written to a ring and the decoder is woken with a
+// semaphore once per chunk instead of once per byte
+static obc_byte_ring_t decodeDataRing;
+static uint8_t decodeDataRingBuffer[DECODE_DATA_STREAM_SIZE];
+static bool isDecodeDataStreamInitialized = false;
+
+// Given by the producer when bytes are added
+static SemaphoreHandle_t decodeDataAvailableSemaphore = NULL;
+static StaticSemaphore_t decodeDataAvailableSemaphoreBuffer;
+
+// Given by the decoder when bytes are consumed
+static SemaphoreHandle_t decodeDataSpaceSemaphore = NULL;
+static StaticSemaphore_t decodeDataSpaceSemaphoreBuffer;
+
+// Stream offsets [start, end) of chunks received with poor link quality, in the ring's free-running byte count.
+// Written by the producer before the chunk's bytes are added, so the decoder always sees a chunk's entry.
+typedef struct {
+  uint32_t start;
+  uint32_t end;
+} stream_range_t;
+
+static stream_range_t poorLinkRanges[POOR_LINK_RANGE_COUNT];
+static volatile uint32_t poorLinkRangesWritten = 0;
+
+// Where the span being pushed through the frame extractor sits in the stream
+typedef struct {
+  const uint8_t *span;
+  uint32_t spanLen;
+  uint32_t spanStreamOffset;
+} decode_span_t;
 
-static obc_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_packet_t *rsData, aes_data_t *aesData);
+static obc_error_code_t decodePacket(const uint8_t *ax25Frame, uint16_t ax25FrameLen,
+                                     const ax25_byte_range_t *poorRanges, uint8_t numPoorRanges,
+                                     packed_rs_packet_t *rsData, aes_data_t *aesData);
+static void decodeFrameCallback(const uint8_t *frame, uint16_t frameLen, void *context);
+static uint8_t collectPoorRanges(uint32_t frameStreamOffset, uint16_t frameLen, ax25_byte_range_t *poorRanges);
 
 /**
  * @brief parses the completely decoded data and sends it to the command manager
@@ -91,10 +137,16 @@ obc_error_code_t handleCommands(uint8_t *cmdBytes) {
 static void flagTimeoutCallback() { isStartFlagReceived = false; }
 
 void obcTaskInitCommsUplinkDecoder(void) {
-  ASSERT((decodeDataQueueStack != NULL) && (&decodeDataQueue != NULL));
-  if (decodeDataQueueHandle == NULL) {
-    decodeDataQueueHandle = xQueueCreateStatic(DECODE_DATA_QUEUE_LENGTH, DECODE_DATA_QUEUE_ITEM_SIZE,
-                                               decodeDataQueueStack, &decodeDataQueue);
+  if (!isDecodeDataStreamInitialized) {
+    // Cannot fail since the size is checked at compile time
+    byteRingInit(&decodeDataRing, decodeDataRingBuffer, sizeof(decodeDataRingBuffer));
+    isDecodeDataStreamInitialized = true;
+  }
+  if (decodeDataAvailableSemaphore == NULL) {
+    decodeDataAvailableSemaphore = xSemaphoreCreateBinaryStatic(&decodeDataAvailableSemaphoreBuffer);
+  }
+  if (decodeDataSpaceSemaphore == NULL) {
+    decodeDataSpaceSemaphore = xSemaphoreCreateBinaryStatic(&decodeDataSpaceSemaphoreBuffer);
   }
 }
 
@@ -102,64 +154,120 @@ void obcTaskFunctionCommsUplinkDecoder(void *pvParameters) {
   StaticTimer_t timerBuffer = {0};
   TimerHandle_t flagTimeoutTimer = xTimerCreateStatic(TIMER_NAME, pdMS_TO_TICKS(AX25_TIMEOUT_MILLISECONDS), pdFALSE,
                                                       (void *)0, flagTimeoutCallback, &timerBuffer);
-  obc_error_code_t errCode;
-  uint8_t byte = 0;
-
-  packed_ax25_i_frame_t axData = {0};
-  uint16_t axDataIndex = 0;
 
-  bool startFlagReceived = false;
+  static ax25_frame_extractor_t frameExtractor;
+  ax25FrameExtractorInit(&frameExtractor);
+  uint32_t reportedOverflows = 0;
 
   while (1) {
-    if (xQueueReceive(decodeDataQueueHandle, &byte, DECODE_DATA_QUEUE_RX_WAIT_PERIOD) == pdPASS) {
-      if (axDataIndex >= sizeof(axData.data)) {
-        LOG_ERROR_CODE(OBC_ERR_CODE_BUFF_OVERFLOW);
+    if (xSemaphoreTake(decodeDataAvailableSemaphore, DECODE_DATA_STREAM_RX_WAIT_PERIOD) != pdPASS) {
+      continue;
+    }
 
-        // Restart the decoding process
-        memset(&axData, 0, sizeof(axData));
-        axDataIndex = 0;
-        startFlagReceived = false;
-      }
+    // Drain everything that arrived, one contiguous span of the ring at a time.
+    // Frames that fit in a span are decoded straight out of the ring.
+    const uint8_t *span = NULL;
+    uint32_t spanLen;
+    while ((spanLen = byteRingPeekContiguous(&decodeDataRing, &span)) > 0) {
+      bool wasInFrame = frameExtractor.inFrame;
 
-      if (byte == AX25_FLAG) {
-        axData.data[axDataIndex++] = byte;
-
-        // Decode packet if we have start flag, end flag, and at least 1 byte of
-        // data During idling, multiple AX25_FLAGs may be sent in a row, so we
-        // enforce that axData.data[1] must be something other than AX25_FLAG
-        if (axDataIndex > 2) {
-          axData.length = axDataIndex;
-
-          packed_rs_packet_t rsData = {0};
-          aes_data_t aesData = {0};
-          LOG_IF_ERROR_CODE(decodePacket(&axData, &rsData, &aesData));
-
-          // Restart the decoding process
-          memset(&axData, 0, sizeof(axData));
-          axDataIndex = 0;
-          axData.data[axDataIndex++] = AX25_FLAG;
-        } else {
-          if (!startFlagReceived) {
-            if (xTimerStart(flagTimeoutTimer, pdMS_TO_TICKS(TIMER_QUEUE_TX_TIMEOUT_MILLISECONDS)) != pdPASS) {
-              LOG_ERROR_CODE(OBC_ERR_CODE_QUEUE_FULL);
-            }
-          }
-          startFlagReceived = true;
-          axDataIndex = 1;
+      decode_span_t decodeSpan = {.span = span, .spanLen = spanLen, .spanStreamOffset = decodeDataRing.tail};
+      ax25FrameExtractorPush(&frameExtractor, span, spanLen, decodeFrameCallback, &decodeSpan);
+
+      byteRingConsume(&decodeDataRing, spanLen);
+      xSemaphoreGive(decodeDataSpaceSemaphore);
+
+      if (!wasInFrame && frameExtractor.inFrame) {
+        if (xTimerStart(flagTimeoutTimer, pdMS_TO_TICKS(TIMER_QUEUE_TX_TIMEOUT_MILLISECONDS)) != pdPASS) {
+          LOG_ERROR_CODE(OBC_ERR_CODE_QUEUE_FULL);
         }
-        continue;
       }
-      if (startFlagReceived) {
-        axData.data[axDataIndex++] = byte;
+
+      if (frameExtractor.overflows != reportedOverflows) {
+        reportedOverflows = frameExtractor.overflows;
+        LOG_ERROR_CODE(OBC_ERR_CODE_BUFF_OVERFLOW);
       }
     }
   }
 }
 
+/**
+ * @brief decodes a frame found by the frame extractor
+ *
+ * @param frame stuffed ax25 frame including both flags
+ * @param frameLen number of bytes in frame
+ * @param context the decode_span_t being pushed
+ */
+static void decodeFrameCallback(const uint8_t *frame, uint16_t frameLen, void *context) {
+  obc_error_code_t errCode;
+  const decode_span_t *decodeSpan = (const decode_span_t *)context;
+
+  // The end flag is always in the current span. A frame carried over from earlier spans was copied out of the ring
+  // and ends at the first flag of this one.
+  const uint8_t *frameEnd;
+  if (frame >= decodeSpan->span && frame < decodeSpan->span + decodeSpan->spanLen) {
+    frameEnd = frame + frameLen - 1;
+  } else {
+    frameEnd = memchr(decodeSpan->span, AX25_FLAG, decodeSpan->spanLen);
+  }
+
+  ax25_byte_range_t poorRanges[MAX_POOR_RANGES_PER_FRAME];
+  uint8_t numPoorRanges = 0;
+  if (frameEnd != NULL) {
+    uint32_t frameEndOffset = decodeSpan->spanStreamOffset + (uint32_t)(frameEnd - decodeSpan->span);
+    numPoorRanges = collectPoorRanges(frameEndOffset + 1 - frameLen, frameLen, poorRanges);
+  }
+
+  packed_rs_packet_t rsData = {0};
+  aes_data_t aesData = {0};
+  LOG_IF_ERROR_CODE(decodePacket(frame, frameLen, poorRanges, numPoorRanges, &rsData, &aesData));
+}
+
+/**
+ * @brief finds the parts of a frame that arrived in chunks with poor link quality
+ *
+ * @param frameStreamOffset stream offset of the frame's start flag
+ * @param frameLen number of bytes in the frame
+ * @param poorRanges stores up to MAX_POOR_RANGES_PER_FRAME ranges, relative to the start flag
+ *
+ * @return uint8_t - the number of ranges stored
+ */
+static uint8_t collectPoorRanges(uint32_t frameStreamOffset, uint16_t frameLen, ax25_byte_range_t *poorRanges) {
+  uint32_t written = poorLinkRangesWritten;
+  uint32_t first = (written > POOR_LINK_RANGE_COUNT) ? written - POOR_LINK_RANGE_COUNT : 0;
+  uint8_t numPoorRanges = 0;
+
+  for (uint32_t i = first; i < written && numPoorRanges < MAX_POOR_RANGES_PER_FRAME; ++i) {
+    const stream_range_t *range = &poorLinkRanges[i % POOR_LINK_RANGE_COUNT];
+
+    // Offsets run freely, so compare distances from the frame start rather than the offsets themselves
+    int32_t start = (int32_t)(range->start - frameStreamOffset);
+    int32_t end = (int32_t)(range->end - frameStreamOffset);
+    if (start < 0) {
+      start = 0;
+    }
+    if (end > (int32_t)frameLen) {
+      end = frameLen;
+    }
+    if (start >= end) {
+      continue;
+    }
+
+    poorRanges[numPoorRanges].start = (uint16_t)start;
+    poorRanges[numPoorRanges].length = (uint16_t)(end - start);
+    numPoorRanges++;
+  }
+
+  return numPoorRanges;
+}
+
 /**
  * @brief completely decode a recieved packet
  *
- * @param data - packed ax25 packet with received data
+ * @param ax25Frame - stuffed ax25 frame with received data, including both flags
+ * @param ax25FrameLen - number of bytes in ax25Frame
+ * @param poorRanges - parts of ax25Frame received with poor link quality
+ * @param numPoorRanges - number of entries in poorRanges
  * @param rsData - holds packed reed solomon data
  * @param aesData - pointer to an aes_data_t type, which holds the data to
  * decrypt & the IV
@@ -168,12 +276,16 @@ void obcTaskFunctionCommsUplinkDecoder(void *pvParameters) {
  * @return obc_error_code_t - whether or not the data was completely decoded
  * successfully
  */
-static obc_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_packet_t *rsData, aes_data_t *aesData) {
+static obc_error_code_t decodePacket(const uint8_t *ax25Frame, uint16_t ax25FrameLen,
+                                     const ax25_byte_range_t *poorRanges, uint8_t numPoorRanges,
+                                     packed_rs_packet_t *rsData, aes_data_t *aesData) {
   obc_gs_error_code_t interfaceErr;
 
-  // perform bit unstuffing
+  // perform bit unstuffing, noting which bytes of the info field are unreliable
   unstuffed_ax25_i_frame_t unstuffedPacket = {0};
-  interfaceErr = ax25Unstuff(ax25Data->data, ax25Data->length, unstuffedPacket.data, &unstuffedPacket.length);
+  rs_erasure_hints_t erasureHints;
+  interfaceErr = ax25UnstuffWithErasureHints(ax25Frame, ax25FrameLen, poorRanges, numPoorRanges, &unstuffedPacket,
+                                             &erasureHints);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
     return OBC_ERR_CODE_AX25_DECODE_FAILURE;
   }
@@ -184,10 +296,14 @@ static obc_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_
     // copy the unstuffed data into rsData
     memcpy(rsData->data, unstuffedPacket.data + AX25_INFO_FIELD_POSITION, RS_ENCODED_SIZE);
     // decode the info field and store it in the unstuffed packet
-    interfaceErr = rsDecode(rsData, unstuffedPacket.data + AX25_INFO_FIELD_POSITION, RS_DECODED_SIZE);
+    interfaceErr = rsDecodeWithErasureHints(rsData, &erasureHints, unstuffedPacket.data + AX25_INFO_FIELD_POSITION,
+                                            RS_DECODED_SIZE, NULL);
     if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
       return OBC_ERR_CODE_FEC_DECODE_FAILURE;
     }
+    // restore the corrected parity bytes too so the FCS check sees the frame that was sent
+    memcpy(unstuffedPacket.data + AX25_INFO_FIELD_POSITION + RS_DECODED_SIZE, rsData->data + RS_DECODED_SIZE,
+           RS_ENCODED_SIZE - RS_DECODED_SIZE);
   }
 
   obc_error_code_t errCode;
@@ -233,16 +349,31 @@ static obc_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_
 }
 
 /**
- * @brief send a received packet to the decode data pipeline to be sent to
- * command manager
+ * @brief send a chunk of received bytes to the decode data pipeline to be sent
+ * to command manager
+ *
+ * @param data pointer to the received bytes
+ * @param dataLen number of bytes in data
+ *
+ * @return obc_error_code_t - whether or not the bytes were successfully sent to
+ * the stream
+ */
+obc_error_code_t sendToDecodeDataStream(const uint8_t *data, uint32_t dataLen) {
+  return sendToDecodeDataStreamWithLinkQuality(data, dataLen, false);
+}
+
+/**
+ * @brief send a chunk of received bytes to the decode data pipeline along with the radio's view of the link
  *
- * @param data pointer to a single byte
+ * @param data pointer to the received bytes
+ * @param dataLen number of bytes in data
+ * @param poorLinkQuality whether the radio reported a weak or noisy signal while the chunk was received
  *
- * @return obc_error_code_t - whether or not the packet was successfully sent to
- * the queue
+ * @return obc_error_code_t - whether or not the bytes were successfully sent to
+ * the stream
  */
-obc_error_code_t sendToDecodeDataQueue(uint8_t *data) {
-  if (decodeDataQueueHandle == NULL) {
+obc_error_code_t sendToDecodeDataStreamWithLinkQuality(const uint8_t *data, uint32_t dataLen, bool poorLinkQuality) {
+  if (!isDecodeDataStreamInitialized || decodeDataAvailableSemaphore == NULL || decodeDataSpaceSemaphore == NULL) {
     return OBC_ERR_CODE_INVALID_STATE;
   }
 
@@ -250,9 +381,28 @@ obc_error_code_t sendToDecodeDataQueue(uint8_t *data) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
 
-  if (xQueueSend(decodeDataQueueHandle, (void *)data, DECODE_DATA_QUEUE_TX_WAIT_PERIOD) == pdPASS) {
-    return OBC_ERR_CODE_SUCCESS;
+  if (poorLinkQuality && dataLen > 0) {
+    // Only the producer moves head, so it is where this chunk will start
+    stream_range_t *range = &poorLinkRanges[poorLinkRangesWritten % POOR_LINK_RANGE_COUNT];
+    range->start = decodeDataRing.head;
+    range->end = decodeDataRing.head + dataLen;
+    poorLinkRangesWritten = poorLinkRangesWritten + 1;
   }
 
-  return OBC_ERR_CODE_QUEUE_FULL;
+  while (dataLen > 0) {
+    uint32_t bytesWritten = byteRingWrite(&decodeDataRing, data, dataLen);
+    if (bytesWritten > 0) {
+      data += bytesWritten;
+      dataLen -= bytesWritten;
+      xSemaphoreGive(decodeDataAvailableSemaphore);
+      continue;
+    }
+
+    // The stream is full; wait for the decoder to free some space
+    if (xSemaphoreTake(decodeDataSpaceSemaphore, DECODE_DATA_STREAM_TX_WAIT_PERIOD) != pdPASS) {
+      return OBC_ERR_CODE_QUEUE_FULL;
+    }
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
 }
@@ -15,10 +15,27 @@
 obc_error_code_t handleCommands(uint8_t *cmdBytes);
 
 /**
- * @brief send a received packet to the decode data pipeline to be sent to command manager
+ * @brief send a chunk of received bytes to the decode data pipeline to be sent to command manager
  *
- * @param data pointer to a single byte
+ * Blocks until the whole chunk has been copied into the decode data stream.
  *
- * @return obc_error_code_t - whether or not the packet was successfully sent to the queue
+ * @param data pointer to the received bytes
+ * @param dataLen number of bytes in data
+ *
+ * @return obc_error_code_t - whether or not the bytes were successfully sent to the stream
+ */
+obc_error_code_t sendToDecodeDataStream(const uint8_t *data, uint32_t dataLen);
+
+/**
+ * @brief send a chunk of received bytes to the decode data pipeline along with the radio's view of the link
+ *
+ * Chunks received with poor link quality are remembered so the decoder can decode their bytes as Reed-Solomon
+ * erasures when a frame does not decode otherwise.
+ *
+ * @param data pointer to the received bytes
+ * @param dataLen number of bytes in data
+ * @param poorLinkQuality whether the radio reported a weak or noisy signal while the chunk was received
+ *
+ * @return obc_error_code_t - whether or not the bytes were successfully sent to the stream
  */
-obc_error_code_t sendToDecodeDataQueue(uint8_t *data);
+obc_error_code_t sendToDecodeDataStreamWithLinkQuality(const uint8_t *data, uint32_t dataLen, bool poorLinkQuality);
@@ -6,9 +6,10 @@
 #include "obc_logging.h"
 #include "obc_general_util.h"
 #include "gnc_manager.h"
-#include "attitude_control.h"
-#include "attitude_determination_and_vehi.h"
-#include "onboard_env_modelling.h"
+#include "gnc_models.h"
+#include "gnc_timing_stats.h"
+#include "telemetry_manager.h"
+#include "obc_time.h"
 #include "vn100.h"
 #include "bd621x.h"
 
@@ -18,163 +19,35 @@
 #include <sys_common.h>
 #include <gio.h>
 
-#include <math.h>
+#include <string.h>
 
 #define DEFAULT_GNC_TASK_PERIOD_MS 50 /* 50ms period or 20Hz */
 #define MAX_GNC_TASK_PERIOD_MS 100
-#define DEGREES_TO_RADIANS(theta) (theta * M_PI / 180)
+
+#define GNC_TIMING_PERIOD_COUNTS (DEFAULT_GNC_TASK_PERIOD_MS * GNC_TIMING_COUNTS_PER_MS)
+/* Report the timing histograms about once a minute; only the cycles that step the models are timed, which is every
+ * other 50 ms period with the default taskRateDivisor */
+#define GNC_TIMING_TELEM_CYCLES 600U
+
+#if ENABLE_TASK_STATS_COLLECTOR == 1
+/* The RTI counter the task runtime stats run on */
+#define GNC_TIMING_NOW() ulSystemTickGet()
+#else
+/* The RTI counter is only started for the task runtime stats, so fall back to the RTOS tick */
+#define GNC_TIMING_NOW() (xTaskGetTickCount() * portTICK_PERIOD_MS * GNC_TIMING_COUNTS_PER_MS)
+#endif
 
 uint32_t cycleNum = 1;
 uint32_t taskRateDivisor = 1;
 
 vn100_binary_packet_t vn100LastValidPacket;
 
-static void rtOnboardModelStep(void);
-static void rtAttitudeDeterminationModelStep(void);
-static void rtAttitudeControlModelStep(void);
-
-static void rtOnboardModelStep(void) {
-  /* Set model inputs here | Currently setting mock values for inputs */
-  onboard_env_model_ext_intputs.commanded_mag_dipole_body[0] = 5.83;
-  onboard_env_model_ext_intputs.commanded_mag_dipole_body[1] = 2.12;
-  onboard_env_model_ext_intputs.commanded_mag_dipole_body[2] = -0.4;
-
-  onboard_env_model_ext_intputs.r_sat_com[0] = (6371 + 408) * 1000;
-  onboard_env_model_ext_intputs.r_sat_com[1] = 0.0;
-  onboard_env_model_ext_intputs.r_sat_com[2] = 0.0;
-
-  onboard_env_model_ext_intputs.r_sat_com_ax1[0] = 1.0;
-  onboard_env_model_ext_intputs.r_sat_com_ax1[1] = 1.0;
-  onboard_env_model_ext_intputs.r_sat_com_ax1[2] = 1.0;
-
-  onboard_env_model_ext_intputs.steve_values[0] = 0.0;
-  onboard_env_model_ext_intputs.steve_values[1] = 0.0;
-
-  /* Step the model */
-  onboard_env_modelling_step();
-
-  /* Get model outputs here */
-  real_T angularBodyX = onboard_env_model_ext_outputs.estimated_expect_ang_acc_body[0];
-  real_T angularBodyY = onboard_env_model_ext_outputs.estimated_expect_ang_acc_body[1];
-  real_T angularBodyZ = onboard_env_model_ext_outputs.estimated_expect_ang_acc_body[2];
-
-  real_T referenceEstimateX = onboard_env_model_ext_outputs.r_ref_com_est[0];
-  real_T referenceEstimateY = onboard_env_model_ext_outputs.r_ref_com_est[1];
-  real_T referenceEstimateZ = onboard_env_model_ext_outputs.r_ref_com_est[2];
-
-  UNUSED(angularBodyX);
-  UNUSED(angularBodyY);
-  UNUSED(angularBodyZ);
-
-  UNUSED(referenceEstimateX);
-  UNUSED(referenceEstimateY);
-  UNUSED(referenceEstimateZ);
-}
-
-static void rtAttitudeDeterminationModelStep(void) {
-  /* Set model inputs here - Arbitrary for now */
-
-  attitude_determination_model_ext_inputs.earth_mag_field_ref[0] = -300;
-  attitude_determination_model_ext_inputs.earth_mag_field_ref[1] = 500;
-  attitude_determination_model_ext_inputs.earth_mag_field_ref[2] = 28000;
-
-  attitude_determination_model_ext_inputs.mes_aam[0] = -0.2;
-  attitude_determination_model_ext_inputs.mes_aam[1] = -8.13;
-  attitude_determination_model_ext_inputs.mes_aam[2] = 0.05;
-
-  attitude_determination_model_ext_inputs.mes_mag[0] = -356;
-  attitude_determination_model_ext_inputs.mes_mag[1] = 487;
-  attitude_determination_model_ext_inputs.mes_mag[2] = 26840;
-
-  attitude_determination_model_ext_inputs.mes_ss[0] = 0.94;
-  attitude_determination_model_ext_inputs.mes_ss[1] = 0.75;
-  attitude_determination_model_ext_inputs.mes_ss[2] = 0.67;
-
-  attitude_determination_model_ext_inputs.omega[0] = 1.0;
-  attitude_determination_model_ext_inputs.omega[1] = 1.0;
-  attitude_determination_model_ext_inputs.omega[2] = 1.0;
-
-  attitude_determination_model_ext_inputs.r_sat_com_ax1[0] = 1.0;
-  attitude_determination_model_ext_inputs.r_sat_com_ax1[1] = 1.0;
-  attitude_determination_model_ext_inputs.r_sat_com_ax1[2] = 1.0;
-
-  attitude_determination_model_ext_inputs.ref_aam[0] = -0.01;
-  attitude_determination_model_ext_inputs.ref_aam[1] = -8.29;
-  attitude_determination_model_ext_inputs.ref_aam[2] = 0.01;
-
-  attitude_determination_model_ext_inputs.sat_to_sun_unit_ref[0] = 1.0;
-  attitude_determination_model_ext_inputs.sat_to_sun_unit_ref[1] = 0.0;
-  attitude_determination_model_ext_inputs.sat_to_sun_unit_ref[2] = 0.0;
-
-  attitude_determination_model_ext_inputs.steve_mes[0] = 0.4;
-  attitude_determination_model_ext_inputs.steve_mes[1] = -0.3;
-  attitude_determination_model_ext_inputs.steve_mes[2] = 0.0;
-
-  /* Step the model */
-  attitude_determination_and_vehi_step();
-
-  /* Get model outputs here */
-  real_T measuredAngularVelocityX = attitude_determination_model_ext_outputs.meas_ang_vel_body[0];
-  real_T measuredAngularVelocityY = attitude_determination_model_ext_outputs.meas_ang_vel_body[1];
-  real_T measuredAngularVelocityZ = attitude_determination_model_ext_outputs.meas_ang_vel_body[2];
-
-  real_T quaterionX = attitude_determination_model_ext_outputs.meas_quat_body[0];
-  real_T quaterionY = attitude_determination_model_ext_outputs.meas_quat_body[1];
-  real_T quaterionZ = attitude_determination_model_ext_outputs.meas_quat_body[2];
-  real_T quaterionW = attitude_determination_model_ext_outputs.meas_quat_body[3];
-
-  UNUSED(measuredAngularVelocityX);
-  UNUSED(measuredAngularVelocityY);
-  UNUSED(measuredAngularVelocityZ);
-
-  UNUSED(quaterionX);
-  UNUSED(quaterionY);
-  UNUSED(quaterionZ);
-  UNUSED(quaterionW);
-}
-
-static void rtAttitudeControlModelStep(void) {
-  /* Set model inputs here - Arbitrary for now */
-  attitude_control_model_ext_inputs.com_quat_body[0] = sin(DEGREES_TO_RADIANS(25));
-  attitude_control_model_ext_inputs.com_quat_body[1] = cos(DEGREES_TO_RADIANS(25) / sqrt(2));
-  attitude_control_model_ext_inputs.com_quat_body[2] = cos(DEGREES_TO_RADIANS(24) / sqrt(2));
-  attitude_control_model_ext_inputs.com_quat_body[3] = 0.0;
-
-  attitude_control_model_ext_inputs.est_curr_ang_vel_body[0] = 0.1;
-  attitude_control_model_ext_inputs.est_curr_ang_vel_body[1] = -0.05;
-  attitude_control_model_ext_inputs.est_curr_ang_vel_body[2] = 0.03;
-
-  attitude_control_model_ext_inputs.est_curr_quat_body[0] = cos(DEGREES_TO_RADIANS(-30));
-  attitude_control_model_ext_inputs.est_curr_quat_body[1] = sin(DEGREES_TO_RADIANS(-30) / sqrt(3));
-  attitude_control_model_ext_inputs.est_curr_quat_body[2] = sin(DEGREES_TO_RADIANS(-30) / sqrt(3));
-  attitude_control_model_ext_inputs.est_curr_quat_body[3] = 0.0;
-
-  attitude_control_model_ext_inputs.mag_field_body[0] = 1.0;
-  attitude_control_model_ext_inputs.mag_field_body[1] = 1.0;
-  attitude_control_model_ext_inputs.mag_field_body[2] = 1.0;
-
-  /* Step the model */
-  attitude_control_step();
-
-  /* Get model outputs here */
-  real_T commandedDipoleX = attitude_control_model_ext_outputs.comm_mag_dipole_body[0];
-  real_T commandedDipoleY = attitude_control_model_ext_outputs.comm_mag_dipole_body[1];
-  real_T commandedDipoleZ = attitude_control_model_ext_outputs.comm_mag_dipole_body[2];
-
-  real_T commandedWheelTorqueX = attitude_control_model_ext_outputs.comm_wheel_torque_body[0];
-  real_T commandedWheelTorqueY = attitude_control_model_ext_outputs.comm_wheel_torque_body[1];
-  real_T commandedWheelTorqueZ = attitude_control_model_ext_outputs.comm_wheel_torque_body[2];
+static gnc_timing_schedule_t gncSchedule;
+static gnc_timing_stats_t gncTimingStats;       // Since boot
+static gnc_timing_stats_t gncTimingTelemStats;  // Since the last timing telemetry
 
-  /* Use the outputs to control actuators */
-
-  UNUSED(commandedDipoleX);
-  UNUSED(commandedDipoleY);
-  UNUSED(commandedDipoleZ);
-
-  UNUSED(commandedWheelTorqueX);
-  UNUSED(commandedWheelTorqueY);
-  UNUSED(commandedWheelTorqueZ);
-}
+static void recordGncCycleTiming(uint32_t startLatency, uint32_t stepsStart, uint32_t stepsEnd);
+static obc_error_code_t sendGncTimingTelemetry(void);
 
 obc_error_code_t setGncTaskPeriod(uint16_t periodMs) {
   /* If the period exceeds 50ms, set to block for another interval (e.g 100ms is one blocked cycle for 50ms and then
@@ -188,24 +61,26 @@ obc_error_code_t setGncTaskPeriod(uint16_t periodMs) {
 }
 
 void obcTaskInitGncMgr(void) {
-  /* Initialize the onboard modelling environment */
-  onboard_env_modelling_initialize();
-
-  /* Initialize the attitude determination algorithms */
-  attitude_determination_and_vehi_initialize();
-
-  /* Initialize the attitude control algorithms */
-  attitude_control_initialize();
+  /* Initialize the onboard modelling environment and the attitude determination and control algorithms */
+  gncModelsInitialize();
 }
 
 void obcTaskFunctionGncMgr(void *pvParameters) {
   TickType_t xLastWakeTime;
 
+#ifdef CONFIG_VN100
+  /* Start the VN100 outputs and their background reception; needs the scheduler running */
+  initVn100();
+#endif
+
   /* Initialize the last wake time to the current time */
   xLastWakeTime = xTaskGetTickCount();
+  gncTimingScheduleInit(&gncSchedule, GNC_TIMING_PERIOD_COUNTS);
 
   /* Run GNC tasks periodically at 20 Hz */
   while (1) {
+    uint32_t startLatency = gncTimingScheduleWake(&gncSchedule, GNC_TIMING_NOW());
+
     /* Check in with the watchdog */
     digitalWatchdogTaskCheckIn(OBC_SCHEDULER_CONFIG_ID_GNC_MGR);
     if (cycleNum <= taskRateDivisor) {
@@ -221,7 +96,7 @@ void obcTaskFunctionGncMgr(void *pvParameters) {
     /* Place GNC Tasks here */
     obc_error_code_t errCode = OBC_ERR_CODE_SUCCESS;
 
-    /* Read from sensors */
+    /* Read from sensors; the VN100 read returns its latest packet without waiting for one */
     vn100_binary_packet_t vn100CurrentPacket = {0};
 
 #ifdef CONFIG_VN100
@@ -236,13 +111,77 @@ void obcTaskFunctionGncMgr(void *pvParameters) {
     }
 
     /* Refresh GNC outputs */
+    uint32_t stepsStart = GNC_TIMING_NOW();
+
     rtOnboardModelStep();
 
     rtAttitudeDeterminationModelStep();
 
     rtAttitudeControlModelStep();
 
+    recordGncCycleTiming(startLatency, stepsStart, GNC_TIMING_NOW());
+
     /* This will automatically update the xLastWakeTime variable to be the last unblocked time, set to delay for 50ms */
     vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(DEFAULT_GNC_TASK_PERIOD_MS));
   }
 }
+
+obc_error_code_t getGncTimingStats(gnc_timing_stats_t *stats) {
+  if (stats == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  taskENTER_CRITICAL();
+  *stats = gncTimingStats;
+  taskEXIT_CRITICAL();
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static void recordGncCycleTiming(uint32_t startLatency, uint32_t stepsStart, uint32_t stepsEnd) {
+  obc_error_code_t errCode;
+
+  bool deadlineMissed = gncTimingScheduleMissed(&gncSchedule, stepsEnd);
+
+  taskENTER_CRITICAL();
+  gncTimingStatsAddCycle(&gncTimingStats, startLatency, stepsEnd - stepsStart, deadlineMissed);
+  taskEXIT_CRITICAL();
+
+  gncTimingStatsAddCycle(&gncTimingTelemStats, startLatency, stepsEnd - stepsStart, deadlineMissed);
+  if (gncTimingTelemStats.cycles >= GNC_TIMING_TELEM_CYCLES) {
+    LOG_IF_ERROR_CODE(sendGncTimingTelemetry());
+    memset(&gncTimingTelemStats, 0, sizeof(gncTimingTelemStats));
+  }
+}
+
+static obc_error_code_t sendGncTimingTelemetry(void) {
+  obc_error_code_t errCode;
+
+  uint32_t timestamp = getCurrentUnixTime();
+
+  /* One item per bin that counted any cycles. A reporting period is GNC_TIMING_TELEM_CYCLES cycles, so no bin can
+   * exceed 16 bits */
+  for (uint8_t i = 0; i < GNC_TIMING_HIST_NUM_BINS; i++) {
+    if (gncTimingTelemStats.startLatencyHist[i] > 0) {
+      telemetry_data_t startLatency = {
+          .gncStartLatencyBin = {.bin = i, .cycles = (uint16_t)gncTimingTelemStats.startLatencyHist[i]},
+          .id = TELEM_GNC_START_LATENCY_HIST,
+          .timestamp = timestamp};
+      RETURN_IF_ERROR_CODE(addTelemetryData(&startLatency));
+    }
+
+    if (gncTimingTelemStats.execTimeHist[i] > 0) {
+      telemetry_data_t execTime = {
+          .gncExecTimeBin = {.bin = i, .cycles = (uint16_t)gncTimingTelemStats.execTimeHist[i]},
+          .id = TELEM_GNC_EXEC_TIME_HIST,
+          .timestamp = timestamp};
+      RETURN_IF_ERROR_CODE(addTelemetryData(&execTime));
+    }
+  }
+
+  telemetry_data_t deadlineMisses = {
+      .gncDeadlineMisses = gncTimingStats.deadlineMisses, .id = TELEM_GNC_DEADLINE_MISSES, .timestamp = timestamp};
+  RETURN_IF_ERROR_CODE(addTelemetryData(&deadlineMisses));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "obc_errors.h"
+#include "gnc_timing_stats.h"
 
 #include <stdlib.h>
 #include <stdint.h>
@@ -13,3 +14,11 @@
  * @return OBC_ERR_CODE_SUCCESS on success, else an error code
  */
 obc_error_code_t setGncTaskPeriod(uint16_t periodMs);
+
+/**
+ * @brief Get the timing of the GNC cycles since boot: how late each cycle started, how long its model steps took and
+ * how many cycles finished after the next one was due
+ * @param stats Set to the timing stats
+ * @return OBC_ERR_CODE_SUCCESS if the stats were copied
+ */
+obc_error_code_t getGncTimingStats(gnc_timing_stats_t *stats);
@@ -0,0 +1,212 @@
+#include "gnc_models.h"
+#include "obc_general_util.h"
+
+#include <math.h>
+
+#if GNC_SINGLE_PRECISION == 1
+#include "attitude_control_single.h"
+#include "attitude_determination_and_vehi_single.h"
+#include "onboard_env_modelling_single.h"
+
+/* The RM46 firmware is built soft-float, so keep the whole step in single precision, including the math calls */
+typedef real32_T gnc_real_t;
+#define GNC_SIN sinf
+#define GNC_COS cosf
+#define GNC_SQRT sqrtf
+
+#define onboardEnvInputs onboard_env_single_model_ext_inputs
+#define onboardEnvOutputs onboard_env_single_model_ext_outputs
+#define onboardEnvInitialize onboard_env_modelling_single_initialize
+#define onboardEnvStep onboard_env_modelling_single_step
+
+#define attitudeDeterminationInputs attitude_determination_single_model_ext_inputs
+#define attitudeDeterminationOutputs attitude_determination_single_model_ext_outputs
+#define attitudeDeterminationInitialize attitude_determination_and_vehi_single_initialize
+#define attitudeDeterminationStep attitude_determination_and_vehi_single_step
+
+#define attitudeControlInputs attitude_control_single_model_ext_inputs
+#define attitudeControlOutputs attitude_control_single_model_ext_outputs
+#define attitudeControlInitialize attitude_control_single_initialize
+#define attitudeControlStep attitude_control_single_step
+#else
+#include "attitude_control.h"
+#include "attitude_determination_and_vehi.h"
+#include "onboard_env_modelling.h"
+
+typedef real_T gnc_real_t;
+#define GNC_SIN sin
+#define GNC_COS cos
+#define GNC_SQRT sqrt
+
+#define onboardEnvInputs onboard_env_model_ext_intputs
+#define onboardEnvOutputs onboard_env_model_ext_outputs
+#define onboardEnvInitialize onboard_env_modelling_initialize
+#define onboardEnvStep onboard_env_modelling_step
+
+#define attitudeDeterminationInputs attitude_determination_model_ext_inputs
+#define attitudeDeterminationOutputs attitude_determination_model_ext_outputs
+#define attitudeDeterminationInitialize attitude_determination_and_vehi_initialize
+#define attitudeDeterminationStep attitude_determination_and_vehi_step
+
+#define attitudeControlInputs attitude_control_model_ext_inputs
+#define attitudeControlOutputs attitude_control_model_ext_outputs
+#define attitudeControlInitialize attitude_control_initialize
+#define attitudeControlStep attitude_control_step
+#endif
+
+#define GNC_PI ((gnc_real_t)M_PI)
+#define DEGREES_TO_RADIANS(theta) ((theta) * GNC_PI / 180)
+
+void gncModelsInitialize(void) {
+  /* Initialize the onboard modelling environment */
+  onboardEnvInitialize();
+
+  /* Initialize the attitude determination algorithms */
+  attitudeDeterminationInitialize();
+
+  /* Initialize the attitude control algorithms */
+  attitudeControlInitialize();
+}
+
+void rtOnboardModelStep(void) {
+  /* Set model inputs here | Currently setting mock values for inputs */
+  onboardEnvInputs.commanded_mag_dipole_body[0] = 5.83;
+  onboardEnvInputs.commanded_mag_dipole_body[1] = 2.12;
+  onboardEnvInputs.commanded_mag_dipole_body[2] = -0.4;
+
+  onboardEnvInputs.r_sat_com[0] = (6371 + 408) * 1000;
+  onboardEnvInputs.r_sat_com[1] = 0.0;
+  onboardEnvInputs.r_sat_com[2] = 0.0;
+
+  onboardEnvInputs.r_sat_com_ax1[0] = 1.0;
+  onboardEnvInputs.r_sat_com_ax1[1] = 1.0;
+  onboardEnvInputs.r_sat_com_ax1[2] = 1.0;
+
+  onboardEnvInputs.steve_values[0] = 0.0;
+  onboardEnvInputs.steve_values[1] = 0.0;
+
+  /* Step the model */
+  onboardEnvStep();
+
+  /* Get model outputs here */
+  gnc_real_t angularBodyX = onboardEnvOutputs.estimated_expect_ang_acc_body[0];
+  gnc_real_t angularBodyY = onboardEnvOutputs.estimated_expect_ang_acc_body[1];
+  gnc_real_t angularBodyZ = onboardEnvOutputs.estimated_expect_ang_acc_body[2];
+
+  gnc_real_t referenceEstimateX = onboardEnvOutputs.r_ref_com_est[0];
+  gnc_real_t referenceEstimateY = onboardEnvOutputs.r_ref_com_est[1];
+  gnc_real_t referenceEstimateZ = onboardEnvOutputs.r_ref_com_est[2];
+
+  UNUSED(angularBodyX);
+  UNUSED(angularBodyY);
+  UNUSED(angularBodyZ);
+
+  UNUSED(referenceEstimateX);
+  UNUSED(referenceEstimateY);
+  UNUSED(referenceEstimateZ);
+}
+
+void rtAttitudeDeterminationModelStep(void) {
+  /* Set model inputs here - Arbitrary for now */
+
+  attitudeDeterminationInputs.earth_mag_field_ref[0] = -300;
+  attitudeDeterminationInputs.earth_mag_field_ref[1] = 500;
+  attitudeDeterminationInputs.earth_mag_field_ref[2] = 28000;
+
+  attitudeDeterminationInputs.mes_aam[0] = -0.2;
+  attitudeDeterminationInputs.mes_aam[1] = -8.13;
+  attitudeDeterminationInputs.mes_aam[2] = 0.05;
+
+  attitudeDeterminationInputs.mes_mag[0] = -356;
+  attitudeDeterminationInputs.mes_mag[1] = 487;
+  attitudeDeterminationInputs.mes_mag[2] = 26840;
+
+  attitudeDeterminationInputs.mes_ss[0] = 0.94;
+  attitudeDeterminationInputs.mes_ss[1] = 0.75;
+  attitudeDeterminationInputs.mes_ss[2] = 0.67;
+
+  attitudeDeterminationInputs.omega[0] = 1.0;
+  attitudeDeterminationInputs.omega[1] = 1.0;
+  attitudeDeterminationInputs.omega[2] = 1.0;
+
+  attitudeDeterminationInputs.r_sat_com_ax1[0] = 1.0;
+  attitudeDeterminationInputs.r_sat_com_ax1[1] = 1.0;
+  attitudeDeterminationInputs.r_sat_com_ax1[2] = 1.0;
+
+  attitudeDeterminationInputs.ref_aam[0] = -0.01;
+  attitudeDeterminationInputs.ref_aam[1] = -8.29;
+  attitudeDeterminationInputs.ref_aam[2] = 0.01;
+
+  attitudeDeterminationInputs.sat_to_sun_unit_ref[0] = 1.0;
+  attitudeDeterminationInputs.sat_to_sun_unit_ref[1] = 0.0;
+  attitudeDeterminationInputs.sat_to_sun_unit_ref[2] = 0.0;
+
+  attitudeDeterminationInputs.steve_mes[0] = 0.4;
+  attitudeDeterminationInputs.steve_mes[1] = -0.3;
+  attitudeDeterminationInputs.steve_mes[2] = 0.0;
+
+  /* Step the model */
+  attitudeDeterminationStep();
+
+  /* Get model outputs here */
+  gnc_real_t measuredAngularVelocityX = attitudeDeterminationOutputs.meas_ang_vel_body[0];
+  gnc_real_t measuredAngularVelocityY = attitudeDeterminationOutputs.meas_ang_vel_body[1];
+  gnc_real_t measuredAngularVelocityZ = attitudeDeterminationOutputs.meas_ang_vel_body[2];
+
+  gnc_real_t quaterionX = attitudeDeterminationOutputs.meas_quat_body[0];
+  gnc_real_t quaterionY = attitudeDeterminationOutputs.meas_quat_body[1];
+  gnc_real_t quaterionZ = attitudeDeterminationOutputs.meas_quat_body[2];
+  gnc_real_t quaterionW = attitudeDeterminationOutputs.meas_quat_body[3];
+
+  UNUSED(measuredAngularVelocityX);
+  UNUSED(measuredAngularVelocityY);
+  UNUSED(measuredAngularVelocityZ);
+
+  UNUSED(quaterionX);
+  UNUSED(quaterionY);
+  UNUSED(quaterionZ);
+  UNUSED(quaterionW);
+}
+
+void rtAttitudeControlModelStep(void) {
+  /* Set model inputs here - Arbitrary for now */
+  attitudeControlInputs.com_quat_body[0] = GNC_SIN(DEGREES_TO_RADIANS(25));
+  attitudeControlInputs.com_quat_body[1] = GNC_COS(DEGREES_TO_RADIANS(25) / GNC_SQRT(2));
+  attitudeControlInputs.com_quat_body[2] = GNC_COS(DEGREES_TO_RADIANS(24) / GNC_SQRT(2));
+  attitudeControlInputs.com_quat_body[3] = 0.0;
+
+  attitudeControlInputs.est_curr_ang_vel_body[0] = 0.1;
+  attitudeControlInputs.est_curr_ang_vel_body[1] = -0.05;
+  attitudeControlInputs.est_curr_ang_vel_body[2] = 0.03;
+
+  attitudeControlInputs.est_curr_quat_body[0] = GNC_COS(DEGREES_TO_RADIANS(-30));
+  attitudeControlInputs.est_curr_quat_body[1] = GNC_SIN(DEGREES_TO_RADIANS(-30) / GNC_SQRT(3));
+  attitudeControlInputs.est_curr_quat_body[2] = GNC_SIN(DEGREES_TO_RADIANS(-30) / GNC_SQRT(3));
+  attitudeControlInputs.est_curr_quat_body[3] = 0.0;
+
+  attitudeControlInputs.mag_field_body[0] = 1.0;
+  attitudeControlInputs.mag_field_body[1] = 1.0;
+  attitudeControlInputs.mag_field_body[2] = 1.0;
+
+  /* Step the model */
+  attitudeControlStep();
+
+  /* Get model outputs here */
+  gnc_real_t commandedDipoleX = attitudeControlOutputs.comm_mag_dipole_body[0];
+  gnc_real_t commandedDipoleY = attitudeControlOutputs.comm_mag_dipole_body[1];
+  gnc_real_t commandedDipoleZ = attitudeControlOutputs.comm_mag_dipole_body[2];
+
+  gnc_real_t commandedWheelTorqueX = attitudeControlOutputs.comm_wheel_torque_body[0];
+  gnc_real_t commandedWheelTorqueY = attitudeControlOutputs.comm_wheel_torque_body[1];
+  gnc_real_t commandedWheelTorqueZ = attitudeControlOutputs.comm_wheel_torque_body[2];
+
+  /* Use the outputs to control actuators */
+
+  UNUSED(commandedDipoleX);
+  UNUSED(commandedDipoleY);
+  UNUSED(commandedDipoleZ);
+
+  UNUSED(commandedWheelTorqueX);
+  UNUSED(commandedWheelTorqueY);
+  UNUSED(commandedWheelTorqueZ);
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+/*
+ * The GNC models the GNC manager runs each cycle. GNC_SINGLE_PRECISION selects the single-precision variants of the
+ * generated models (the flight default) or the double-precision reference models.
+ */
+
+#ifndef GNC_SINGLE_PRECISION
+#define GNC_SINGLE_PRECISION 1
+#endif
+
+/**
+ * @brief Initialize the onboard environment, attitude determination and attitude control models
+ */
+void gncModelsInitialize(void);
+
+/**
+ * @brief Set the onboard environment model inputs and step the model
+ */
+void rtOnboardModelStep(void);
+
+/**
+ * @brief Set the attitude determination model inputs and step the model
+ */
+void rtAttitudeDeterminationModelStep(void);
+
+/**
+ * @brief Set the attitude control model inputs and step the model
+ */
+void rtAttitudeControlModelStep(void);
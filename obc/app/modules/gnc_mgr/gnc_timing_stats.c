@@ -0,0 +1,80 @@
+#include "gnc_timing_stats.h"
+
+#include <stddef.h>
+
+#define US_TO_COUNTS(us) ((us) * GNC_TIMING_COUNTS_PER_MS / 1000U)
+
+// Upper edges of all bins but the last
+static const uint32_t histBinEdges[GNC_TIMING_HIST_NUM_BINS - 1] = {
+    US_TO_COUNTS(100U),  US_TO_COUNTS(200U),  US_TO_COUNTS(500U),   US_TO_COUNTS(1000U),
+    US_TO_COUNTS(2000U), US_TO_COUNTS(5000U), US_TO_COUNTS(10000U),
+};
+
+void gncTimingScheduleInit(gnc_timing_schedule_t *schedule, uint32_t periodCounts) {
+  if (schedule == NULL) {
+    return;
+  }
+
+  *schedule = (gnc_timing_schedule_t){.periodCounts = periodCounts};
+}
+
+uint32_t gncTimingScheduleWake(gnc_timing_schedule_t *schedule, uint32_t nowCount) {
+  if (schedule == NULL) {
+    return 0;
+  }
+
+  if (!schedule->started) {
+    schedule->started = true;
+    schedule->dueCount = nowCount;
+    return 0;
+  }
+
+  schedule->dueCount += schedule->periodCounts;
+
+  // Woke up before the schedule said the period was due, so the schedule is ahead
+  int32_t latency = (int32_t)(nowCount - schedule->dueCount);
+  if (latency < 0) {
+    schedule->dueCount = nowCount;
+    return 0;
+  }
+
+  return (uint32_t)latency;
+}
+
+bool gncTimingScheduleMissed(const gnc_timing_schedule_t *schedule, uint32_t nowCount) {
+  if (schedule == NULL || !schedule->started) {
+    return false;
+  }
+
+  return (nowCount - schedule->dueCount) > schedule->periodCounts;
+}
+
+uint32_t gncTimingHistBin(uint32_t counts) {
+  uint32_t bin = 0;
+  while (bin < GNC_TIMING_HIST_NUM_BINS - 1 && counts >= histBinEdges[bin]) {
+    bin++;
+  }
+
+  return bin;
+}
+
+void gncTimingStatsAddCycle(gnc_timing_stats_t *stats, uint32_t startLatency, uint32_t execTime, bool deadlineMissed) {
+  if (stats == NULL) {
+    return;
+  }
+
+  stats->cycles++;
+  if (deadlineMissed) {
+    stats->deadlineMisses++;
+  }
+
+  if (startLatency > stats->maxStartLatency) {
+    stats->maxStartLatency = startLatency;
+  }
+  if (execTime > stats->maxExecTime) {
+    stats->maxExecTime = execTime;
+  }
+
+  stats->startLatencyHist[gncTimingHistBin(startLatency)]++;
+  stats->execTimeHist[gncTimingHistBin(execTime)]++;
+}
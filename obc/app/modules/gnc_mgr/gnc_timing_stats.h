@@ -0,0 +1,94 @@
+#pragma once
+
+#include "obc_gs_telemetry_data.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Times are in counts of the RTI counter behind the task runtime stats (ulSystemTickGet), which is prescaled to
+ * GNC_TIMING_COUNTS_PER_MS counts per RTOS tick of 1 ms. The prescaler divides by one more than the ratio of the two,
+ * so the counter runs a little slower than that: 2499.4 counts per 50 ms period.
+ */
+#define GNC_TIMING_COUNTS_PER_MS 50U
+#define GNC_TIMING_COUNTS_TO_US(counts) ((counts) * (1000U / GNC_TIMING_COUNTS_PER_MS))
+
+#define GNC_TIMING_HIST_NUM_BINS TELEM_GNC_HIST_NUM_BINS
+
+/**
+ * @brief Tracks when each period of a periodic task was due
+ *
+ * The schedule is kept in counter time: each period is due periodCounts after the previous one. A wake-up earlier than
+ * the schedule means the schedule has drifted ahead of the RTOS tick, and it is moved back to that wake-up. As long as
+ * periodCounts is at least the true period in counts, the schedule therefore follows the earliest wake-ups and start
+ * latencies are never overstated by more than a count or two.
+ */
+typedef struct {
+  uint32_t periodCounts;  // Nominal period
+  uint32_t dueCount;      // When the current period was due
+  bool started;
+} gnc_timing_schedule_t;
+
+/**
+ * @brief Timing of the GNC cycles that stepped the models
+ */
+typedef struct {
+  uint32_t cycles;
+  uint32_t deadlineMisses;   // Cycles that finished after the next period was due
+  uint32_t maxStartLatency;  // Counts
+  uint32_t maxExecTime;      // Counts
+  uint32_t startLatencyHist[GNC_TIMING_HIST_NUM_BINS];
+  uint32_t execTimeHist[GNC_TIMING_HIST_NUM_BINS];
+} gnc_timing_stats_t;
+
+/**
+ * @brief Starts a schedule; the first wake-up sets when periods are due
+ *
+ * @param schedule The schedule to start
+ * @param periodCounts Nominal period in counts
+ */
+void gncTimingScheduleInit(gnc_timing_schedule_t *schedule, uint32_t periodCounts);
+
+/**
+ * @brief Records the wake-up at the start of a period
+ *
+ * @param schedule The schedule of the task
+ * @param nowCount The counter at the wake-up
+ * @return uint32_t How late the wake-up was, in counts
+ */
+uint32_t gncTimingScheduleWake(gnc_timing_schedule_t *schedule, uint32_t nowCount);
+
+/**
+ * @brief Checks whether the current period has overrun into the next one
+ *
+ * @param schedule The schedule of the task
+ * @param nowCount The counter when the work of the period finished
+ * @return bool True if the next period was already due
+ */
+bool gncTimingScheduleMissed(const gnc_timing_schedule_t *schedule, uint32_t nowCount);
+
+/**
+ * @brief Gets the histogram bin of a time
+ *
+ * @param counts The time in counts
+ * @return uint32_t Index of the bin, see TELEM_GNC_HIST_NUM_BINS for the bin edges
+ */
+uint32_t gncTimingHistBin(uint32_t counts);
+
+/**
+ * @brief Adds one cycle to the stats
+ *
+ * @param stats The stats to update
+ * @param startLatency How late the cycle started, in counts
+ * @param execTime How long the cycle's model steps took, in counts
+ * @param deadlineMissed Whether the cycle finished after the next period was due
+ */
+void gncTimingStatsAddCycle(gnc_timing_stats_t *stats, uint32_t startLatency, uint32_t execTime, bool deadlineMissed);
+
+#ifdef __cplusplus
+}
+#endif
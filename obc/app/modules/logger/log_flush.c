@@ -0,0 +1,36 @@
+#include "log_flush.h"
+#include "obc_errors.h"
+#include "obc_byte_ring.h"
+
+#include <redposix.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+obc_error_code_t logFlushRing(obc_byte_ring_t *ring, int32_t fd, uint32_t minFlushSize, uint32_t maxWriteSize,
+                              uint32_t *numWrites) {
+  if (ring == NULL || numWrites == NULL || minFlushSize == 0 || maxWriteSize == 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  while (byteRingBytesUsed(ring) >= minFlushSize) {
+    const uint8_t *data = NULL;
+    uint32_t len = byteRingPeekContiguous(ring, &data);
+    if (len > maxWriteSize) {
+      len = maxWriteSize;
+    }
+
+    int32_t written = red_write(fd, data, len);
+    if (written > 0) {
+      // Whatever made it into the file is not written again
+      byteRingConsume(ring, (uint32_t)written);
+    }
+    if (written != (int32_t)len) {
+      return OBC_ERR_CODE_FAILED_FILE_WRITE;
+    }
+
+    (*numWrites)++;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "obc_errors.h"
+#include "obc_byte_ring.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Write the bytes of a ring to a file until fewer than minFlushSize are left
+ *
+ * The bytes a write took are consumed from the ring even when the write falls short (e.g. the volume is full), so no
+ * byte reaches the file twice and the records in it stay aligned across the failure.
+ *
+ * @param ring Ring holding the bytes to write
+ * @param fd Reliance Edge file descriptor to write to
+ * @param minFlushSize Smallest number of bytes worth a write
+ * @param maxWriteSize Largest number of bytes in one write
+ * @param numWrites Incremented for each write that went through in full
+ * @return obc_error_code_t OBC_ERR_CODE_FAILED_FILE_WRITE if a write fell short or failed; the file should be reopened
+ */
+obc_error_code_t logFlushRing(obc_byte_ring_t *ring, int32_t fd, uint32_t minFlushSize, uint32_t maxWriteSize,
+                              uint32_t *numWrites);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,107 @@
+#include "log_record.h"
+#include "obc_logging.h"
+#include "data_pack_utils.h"
+#include "data_unpack_utils.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME 16777619U
+
+#define LOG_RECORD_TYPE_SHIFT 3U
+#define LOG_RECORD_LEVEL_MASK 0x07U
+
+static const char *LEVEL_STRINGS[] = {"TRACE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL"};
+
+uint32_t logHashString(const char *str) {
+  if (str == NULL) {
+    return 0;
+  }
+
+  uint32_t hash = FNV_OFFSET_BASIS;
+  while (*str != '\0') {
+    hash ^= (uint8_t)*str++;
+    hash *= FNV_PRIME;
+  }
+
+  return hash;
+}
+
+obc_error_code_t logRecordPack(const log_record_t *record, uint8_t *buffer) {
+  if (record == NULL || buffer == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (record->logType > LOG_TYPE_MSG || record->logLevel > LOG_FATAL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t offset = 0;
+  packUint8(LOG_RECORD_SYNC, buffer, &offset);
+  packUint8((uint8_t)((record->logType << LOG_RECORD_TYPE_SHIFT) | record->logLevel), buffer, &offset);
+  packUint16(record->line, buffer, &offset);
+  packUint32(record->fileId, buffer, &offset);
+  packUint32(record->arg, buffer, &offset);
+  packUint32(record->timestamp, buffer, &offset);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t logRecordUnpack(const uint8_t *buffer, log_record_t *record) {
+  if (buffer == NULL || record == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t offset = 0;
+  uint8_t sync = unpackUint8(buffer, &offset);
+  uint8_t typeAndLevel = unpackUint8(buffer, &offset);
+  uint8_t logType = typeAndLevel >> LOG_RECORD_TYPE_SHIFT;
+  uint8_t logLevel = typeAndLevel & LOG_RECORD_LEVEL_MASK;
+
+  if (sync != LOG_RECORD_SYNC || logType > LOG_TYPE_MSG || logLevel > LOG_FATAL) {
+    return OBC_ERR_CODE_FAILED_UNPACK;
+  }
+
+  record->logType = logType;
+  record->logLevel = logLevel;
+  record->line = unpackUint16(buffer, &offset);
+  record->fileId = unpackUint32(buffer, &offset);
+  record->arg = unpackUint32(buffer, &offset);
+  record->timestamp = unpackUint32(buffer, &offset);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t logRecordFormat(const log_record_t *record, char *buffer, uint32_t bufferLen, uint32_t *lineLen) {
+  if (record == NULL || buffer == NULL || lineLen == NULL || bufferLen == 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (record->logLevel > LOG_FATAL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  int ret = 0;
+  if (record->logType == LOG_TYPE_ERROR_CODE) {
+    ret = snprintf(buffer, bufferLen, "%lu %-5s -> file#%08lx:%u - %lu\r\n", (unsigned long)record->timestamp,
+                   LEVEL_STRINGS[record->logLevel], (unsigned long)record->fileId, (unsigned)record->line,
+                   (unsigned long)record->arg);
+  } else {
+    ret = snprintf(buffer, bufferLen, "%lu %-5s -> file#%08lx:%u - msg#%08lx\r\n", (unsigned long)record->timestamp,
+                   LEVEL_STRINGS[record->logLevel], (unsigned long)record->fileId, (unsigned)record->line,
+                   (unsigned long)record->arg);
+  }
+
+  if (ret < 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+  if ((uint32_t)ret >= bufferLen) {
+    return OBC_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  *lineLen = (uint32_t)ret;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "obc_errors.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Binary log record, stored big endian:
+ *   sync (1B) | log type << 3 | log level (1B) | line (2B) | file ID (4B) | arg (4B) | unix timestamp (4B)
+ *
+ * The file ID is logHashString of the file path relative to the repo root (what __FILE_FROM_REPO_ROOT__ gives). The
+ * arg is the error code for LOG_TYPE_ERROR_CODE records and logHashString of the message for LOG_TYPE_MSG records.
+ * The ground station maps both hashes back to strings from the source tree, so no text is formatted on the OBC.
+ */
+#define LOG_RECORD_SIZE 16U
+#define LOG_RECORD_SYNC 0xA5U
+
+// Lines past this are stored as this value
+#define LOG_RECORD_MAX_LINE UINT16_MAX
+
+typedef struct {
+  uint8_t logType;
+  uint8_t logLevel;
+  uint16_t line;
+  uint32_t fileId;
+  uint32_t arg;
+  uint32_t timestamp;
+} log_record_t;
+
+/**
+ * @brief 32-bit FNV-1a hash of a string, used for the file and message IDs of log records
+ *
+ * @param str Null terminated string to hash
+ * @return uint32_t The hash; 0 if str is NULL
+ */
+uint32_t logHashString(const char *str);
+
+/**
+ * @brief Pack a log record
+ *
+ * @param record The record to pack
+ * @param buffer Buffer of at least LOG_RECORD_SIZE bytes
+ * @return obc_error_code_t OBC_ERR_CODE_INVALID_ARG if an argument is NULL or the type or level is out of range
+ */
+obc_error_code_t logRecordPack(const log_record_t *record, uint8_t *buffer);
+
+/**
+ * @brief Unpack a log record
+ *
+ * @param buffer LOG_RECORD_SIZE bytes of a packed record
+ * @param record Set to the unpacked record
+ * @return obc_error_code_t OBC_ERR_CODE_FAILED_UNPACK if the sync byte or the type or level is invalid
+ */
+obc_error_code_t logRecordUnpack(const uint8_t *buffer, log_record_t *record);
+
+/**
+ * @brief Format a log record as a line of text, for printing records on demand
+ *
+ * The file and message are printed as their hashed IDs; the ground station log decoder resolves them to strings.
+ *
+ * @param record The record to format
+ * @param buffer Buffer for the null terminated line
+ * @param bufferLen Size of buffer
+ * @param lineLen Set to the length of the line without the null terminator
+ * @return obc_error_code_t OBC_ERR_CODE_BUFF_TOO_SMALL if the line does not fit
+ */
+obc_error_code_t logRecordFormat(const log_record_t *record, char *buffer, uint32_t bufferLen, uint32_t *lineLen);
+
+#ifdef __cplusplus
+}
+#endif
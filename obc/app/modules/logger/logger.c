@@ -1,21 +1,36 @@
 #include "logger.h"
+#include "log_record.h"
+#include "log_flush.h"
 #include "obc_logging.h"
 #include "obc_errors.h"
 #include "obc_print.h"
 #include "obc_time.h"
+#include "obc_time_utils.h"
+#include "obc_byte_ring.h"
+#include "obc_mpsc_ring.h"
 
 #include <FreeRTOS.h>
 #include <FreeRTOSConfig.h>
 #include <sys_common.h>
-#include <os_queue.h>
+#include <os_task.h>
 #include <redposix.h>
 
 #include <string.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 
 #define LOG_FILE_NAME "log.log"
+#define LOG_BINARY_FILE_NAME "log.bin"
+
+// Binary records are written to the SD card a block at a time from a ring that holds a few blocks
+#define LOG_FLUSH_BLOCK_SIZE 512U
+#define LOG_RING_SIZE (4U * LOG_FLUSH_BLOCK_SIZE)
+// The log file stays open, so its data is only committed by a Reliance Edge transaction when it is synced
+#define LOG_SYNC_BLOCK_COUNT 8U
+// Records short of a full block are written once no log has arrived for this long
+#define LOGGER_IDLE_FLUSH_PERIOD pdMS_TO_TICKS(5000)
 
 #define MAX_MSG_SIZE 128U
 #define MAX_FNAME_LINENUM_SIZE 150U
@@ -38,51 +53,96 @@ static const char *LEVEL_STRINGS[] = {"TRACE", "DEBUG", "INFO", "WARN", "ERROR",
 
 static log_level_t logLevel;
 static log_output_location_t outputLocation;
+static log_format_t logFormat;
+
+static obc_byte_ring_t logRing;
+static uint8_t logRingBuffer[LOG_RING_SIZE];
+static int32_t binaryLogFd = -1;
+static uint32_t blocksSinceSync;
+static uint32_t droppedRecords;
+
+// Holds the logs of bursts between polls; an error code takes 28 bytes and a message up to 28 more than its text
+#define LOGGER_RING_SIZE 4096U
+#define LOGGER_POLL_PERIOD pdMS_TO_TICKS(10)
 
-#define LOGGER_QUEUE_LENGTH 10U
-#define LOGGER_QUEUE_ITEM_SIZE sizeof(logger_event_t)
-#define LOGGER_QUEUE_RX_WAIT_PERIOD portMAX_DELAY
-#define LOGGER_QUEUE_TX_WAIT_PERIOD 0
+// An event as stored in the ring, with the text of a message right after the event
+typedef struct {
+  logger_event_t event;
+  char msg[MAX_MSG_SIZE];
+} logger_ring_entry_t;
 
-static QueueHandle_t loggerQueueHandle = NULL;
-static StaticQueue_t loggerQueue;
-static uint8_t loggerQueueStack[LOGGER_QUEUE_LENGTH * LOGGER_QUEUE_ITEM_SIZE];
+static obc_mpsc_ring_t eventRing;
+static uint32_t eventRingBuffer[LOGGER_RING_SIZE / sizeof(uint32_t)];
+static bool eventRingReady = false;
 
 /**
- * @brief Sends an event to the logger queue
+ * @brief Push an event to the logger ring. Never blocks, so it is safe from tasks and ISRs.
  *
- * @param event Pointer to the event to send
- * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the packet was sent to the queue
+ * @param event Pointer to the event to push; the text of a message event is copied along with it
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the event was pushed to the ring
  */
-static obc_error_code_t sendToLoggerQueue(logger_event_t *event, size_t blockTimeTicks);
+static obc_error_code_t pushLoggerEvent(const logger_event_t *event);
 
 /**
- * @brief Sends an event to the logger queue from an ISR
+ * @brief Add a binary record of an event to the log ring. The record is dropped if the ring is full.
  *
- * @param event Pointer to the event to send
- * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the packet was sent to the queue
+ * @param event The event to record
  */
-static obc_error_code_t sendToLoggerQueueFromISR(logger_event_t *event);
+static void bufferBinaryRecord(const logger_event_t *event);
+
+/**
+ * @brief Write full blocks of binary records from the log ring to the log file
+ *
+ * @param flushAll Also write the records of a partial block and sync the file
+ */
+static void flushBinaryRecords(bool flushAll);
 
 void logSetLevel(log_level_t newLogLevel) { logLevel = newLogLevel; }
 
 void obcTaskInitLogger(void) {
-  ASSERT((loggerQueueStack != NULL) && (&loggerQueue != NULL));
-  if (loggerQueueHandle == NULL) {
-    loggerQueueHandle = xQueueCreateStatic(LOGGER_QUEUE_LENGTH, LOGGER_QUEUE_ITEM_SIZE, loggerQueueStack, &loggerQueue);
+  if (!eventRingReady) {
+    eventRingReady = mpscRingInit(&eventRing, (uint8_t *)eventRingBuffer, LOGGER_RING_SIZE) == OBC_ERR_CODE_SUCCESS;
   }
 
   outputLocation = LOG_DEFAULT_OUTPUT_LOCATION;
   logLevel = LOG_DEFAULT_LEVEL;
+  logFormat = LOG_DEFAULT_FORMAT;
+
+  byteRingInit(&logRing, logRingBuffer, LOG_RING_SIZE);
 }
 
 void obcTaskFunctionLogger(void *pvParameters) {
   char *fname = LOG_FILE_NAME;
+  TickType_t lastLogTick = xTaskGetTickCount();
+  uint32_t reportedDrops = 0;
   while (1) {
-    logger_event_t queueMsg;
-    if (xQueueReceive(loggerQueueHandle, &queueMsg, LOGGER_QUEUE_RX_WAIT_PERIOD) != pdPASS) {
+    static logger_ring_entry_t entry;
+    uint32_t entryLen = 0;
+    obc_error_code_t popErrCode = mpscRingPop(&eventRing, &entry, sizeof(entry), &entryLen);
+    if (popErrCode == OBC_ERR_CODE_QUEUE_EMPTY) {
+      uint32_t dropped = mpscRingDropped(&eventRing);
+      if (dropped != reportedDrops) {
+        // Logs were lost while the ring was full; record that once it has room again
+        reportedDrops = dropped;
+        LOG_ERROR_CODE(OBC_ERR_CODE_QUEUE_FULL);
+      }
+      if (xTaskGetTickCount() - lastLogTick >= LOGGER_IDLE_FLUSH_PERIOD) {
+        flushBinaryRecords(true);
+        lastLogTick = xTaskGetTickCount();
+      }
+      vTaskDelay(LOGGER_POLL_PERIOD);
+      continue;
+    }
+    if (popErrCode != OBC_ERR_CODE_SUCCESS || entryLen < sizeof(logger_event_t)) {
       continue;
     }
+    lastLogTick = xTaskGetTickCount();
+
+    logger_event_t queueMsg = entry.event;
+    if (queueMsg.logEntry.logType == LOG_TYPE_MSG) {
+      entry.msg[entryLen - sizeof(logger_event_t)] = '\0';
+      queueMsg.msg = entry.msg;
+    }
     if (queueMsg.logEntry.logLevel > LOG_FATAL) {
       LOG_ERROR_CODE(OBC_ERR_CODE_UNSUPPORTED_EVENT);
       continue;
@@ -92,6 +152,13 @@ void obcTaskFunctionLogger(void *pvParameters) {
       continue;
     }
 
+    if (outputLocation == LOG_TO_SDCARD && logFormat == LOG_FORMAT_BINARY) {
+      // Nothing is formatted here; the ground station turns the records into text
+      bufferBinaryRecord(&queueMsg);
+      flushBinaryRecords(queueMsg.logEntry.logLevel == LOG_FATAL);
+      continue;
+    }
+
     // File & line number
     char infobuf[MAX_FNAME_LINENUM_SIZE] = {0};
     int ret = 0;
@@ -166,8 +233,8 @@ void obcTaskFunctionLogger(void *pvParameters) {
   }
 }
 
-static obc_error_code_t sendToLoggerQueue(logger_event_t *event, size_t blockTimeTicks) {
-  if (loggerQueueHandle == NULL) {
+static obc_error_code_t pushLoggerEvent(const logger_event_t *event) {
+  if (!eventRingReady) {
     return OBC_ERR_CODE_INVALID_STATE;
   }
 
@@ -175,32 +242,97 @@ static obc_error_code_t sendToLoggerQueue(logger_event_t *event, size_t blockTim
     return OBC_ERR_CODE_INVALID_ARG;
   }
 
-  if (xQueueSend(loggerQueueHandle, (void *)event, blockTimeTicks) == pdPASS) {
-    return OBC_ERR_CODE_SUCCESS;
+  if (event->logEntry.logType == LOG_TYPE_MSG) {
+    // Messages longer than the logger prints are cut short here
+    return mpscRingPush(&eventRing, event, sizeof(*event), event->msg, strnlen(event->msg, MAX_MSG_SIZE - 1));
   }
 
-  return OBC_ERR_CODE_QUEUE_FULL;
+  return mpscRingPush(&eventRing, event, sizeof(*event), NULL, 0);
 }
 
-static obc_error_code_t sendToLoggerQueueFromISR(logger_event_t *event) {
-  if (loggerQueueHandle == NULL) {
-    return OBC_ERR_CODE_INVALID_STATE;
+static void bufferBinaryRecord(const logger_event_t *event) {
+  if (LOG_RING_SIZE - byteRingBytesUsed(&logRing) < LOG_RECORD_SIZE) {
+    droppedRecords++;
+    return;
   }
 
-  if (event == NULL) {
-    return OBC_ERR_CODE_INVALID_ARG;
+  log_record_t record = {.logType = event->logEntry.logType,
+                         .logLevel = event->logEntry.logLevel,
+                         .line = event->line > LOG_RECORD_MAX_LINE ? LOG_RECORD_MAX_LINE : (uint16_t)event->line,
+                         .fileId = logHashString(event->file)};
+
+  if (event->logEntry.logType == LOG_TYPE_ERROR_CODE) {
+    record.arg = event->errCode;
+  } else {
+    record.arg = logHashString(event->msg);
   }
-  BaseType_t xHigherPriorityTaskAwoken = pdFALSE;
 
-  xQueueSendFromISR(loggerQueueHandle, (void *)event, &xHigherPriorityTaskAwoken);
+#if defined(LOG_DATE_TIME)
+  rtc_date_time_t timestamp = event->timestamp;
+  if (datetimeToUnix(&timestamp, &record.timestamp) != OBC_ERR_CODE_SUCCESS) {
+    record.timestamp = 0;
+  }
+#elif defined(LOG_UNIX)
+  record.timestamp = event->timestamp;
+#endif
 
-  portYIELD_FROM_ISR(xHigherPriorityTaskAwoken);
+  uint8_t packed[LOG_RECORD_SIZE];
+  if (logRecordPack(&record, packed) != OBC_ERR_CODE_SUCCESS) {
+    droppedRecords++;
+    return;
+  }
 
-  return OBC_ERR_CODE_QUEUE_FULL;
+  // The free space was checked above, so the whole record fits
+  byteRingWrite(&logRing, packed, LOG_RECORD_SIZE);
+}
+
+static void flushBinaryRecords(bool flushAll) {
+  uint32_t minFlushSize = flushAll ? 1U : LOG_FLUSH_BLOCK_SIZE;
+  if (byteRingBytesUsed(&logRing) < minFlushSize) {
+    return;
+  }
+
+  if (binaryLogFd == -1) {
+    binaryLogFd = red_open(LOG_BINARY_FILE_NAME, RED_O_WRONLY | RED_O_APPEND | RED_O_CREAT);
+    if (binaryLogFd == -1) {
+      // The records stay in the ring until the file can be opened
+      return;
+    }
+  }
+
+  if (logFlushRing(&logRing, binaryLogFd, minFlushSize, LOG_FLUSH_BLOCK_SIZE, &blocksSinceSync) !=
+      OBC_ERR_CODE_SUCCESS) {
+    // Reopen the file on the next flush in case the handle went bad
+    red_close(binaryLogFd);
+    binaryLogFd = -1;
+    return;
+  }
+
+  if (flushAll || blocksSinceSync >= LOG_SYNC_BLOCK_COUNT) {
+    red_fsync(binaryLogFd);
+    blocksSinceSync = 0;
+  }
+
+  if (droppedRecords > 0) {
+    // Record that logs were lost while the SD card could not keep up
+    droppedRecords = 0;
+    LOG_ERROR_CODE(OBC_ERR_CODE_BUFF_OVERFLOW);
+  }
 }
 
 void logSetOutputLocation(log_output_location_t newOutputLocation) { outputLocation = newOutputLocation; }
 
+void logSetFormat(log_format_t newFormat) { logFormat = newFormat; }
+
+void logGetRingStats(uint32_t *droppedEntries, uint32_t *highWaterBytes) {
+  if (droppedEntries != NULL) {
+    *droppedEntries = mpscRingDropped(&eventRing);
+  }
+  if (highWaterBytes != NULL) {
+    *highWaterBytes = mpscRingHighWater(&eventRing);
+  }
+}
+
 obc_error_code_t logErrorCode(log_level_t msgLevel, const char *file, uint32_t line, uint32_t errCode) {
   if (msgLevel < logLevel) {
     return OBC_ERR_CODE_LOG_MSG_SILENCED;
@@ -219,8 +351,8 @@ obc_error_code_t logErrorCode(log_level_t msgLevel, const char *file, uint32_t l
   logEvent.timestamp = GET_TIMESTAMP;
 #endif
 
-  // send the event to the logger queue and don't try to log any error that occurs
-  return sendToLoggerQueue(&logEvent, LOGGER_QUEUE_TX_WAIT_PERIOD);
+  // push the event to the logger ring and don't try to log any error that occurs
+  return pushLoggerEvent(&logEvent);
 }
 
 obc_error_code_t logMsg(log_level_t msgLevel, const char *file, uint32_t line, const char *msg) {
@@ -243,7 +375,7 @@ obc_error_code_t logMsg(log_level_t msgLevel, const char *file, uint32_t line, c
   logEvent.timestamp = GET_TIMESTAMP;
 #endif
 
-  return sendToLoggerQueue(&logEvent, LOGGER_QUEUE_TX_WAIT_PERIOD);
+  return pushLoggerEvent(&logEvent);
 }
 
 obc_error_code_t logErrorCodeFromISR(log_level_t msgLevel, const char *file, uint32_t line, uint32_t errCode) {
@@ -264,8 +396,8 @@ obc_error_code_t logErrorCodeFromISR(log_level_t msgLevel, const char *file, uin
   logEvent.timestamp = GET_TIMESTAMP_FROM_ISR;
 #endif
 
-  // send the event to the logger queue and don't try to log any error that occurs
-  return sendToLoggerQueueFromISR(&logEvent);
+  // push the event to the logger ring and don't try to log any error that occurs
+  return pushLoggerEvent(&logEvent);
 }
 
 obc_error_code_t logMsgFromISR(log_level_t msgLevel, const char *file, uint32_t line, const char *msg) {
@@ -288,5 +420,5 @@ obc_error_code_t logMsgFromISR(log_level_t msgLevel, const char *file, uint32_t
   logEvent.timestamp = GET_TIMESTAMP_FROM_ISR;
 #endif
 
-  return sendToLoggerQueueFromISR(&logEvent);
+  return pushLoggerEvent(&logEvent);
 }
@@ -33,3 +33,18 @@ typedef struct {
  * @param newOutputLocation The new output location
  */
 void logSetOutputLocation(log_output_location_t newOutputLocation);
+
+/**
+ * @brief Set the format of logs written to the SD card
+ *
+ * @param newFormat The new log format
+ */
+void logSetFormat(log_format_t newFormat);
+
+/**
+ * @brief Get the counters of the ring that carries logs to the logger task
+ *
+ * @param droppedEntries Set to the number of logs dropped because the ring was full, if not NULL
+ * @param highWaterBytes Set to the most bytes the ring has held at once, if not NULL
+ */
+void logGetRingStats(uint32_t *droppedEntries, uint32_t *highWaterBytes);
@@ -48,6 +48,7 @@ void obcTaskInitStateMgr(void) {
   if (stateMgrQueueHandle == NULL) {
     stateMgrQueueHandle =
         xQueueCreateStatic(STATE_MGR_QUEUE_LENGTH, STATE_MGR_QUEUE_ITEM_SIZE, stateMgrQueueStack, &stateMgrQueue);
+    vQueueAddToRegistry(stateMgrQueueHandle, "state mgr");
   }
 }
 
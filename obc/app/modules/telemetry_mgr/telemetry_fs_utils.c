@@ -116,35 +116,91 @@ obc_error_code_t constructTelemetryFilePath(uint32_t telemBatchId, char *buff, s
   return OBC_ERR_CODE_SUCCESS;
 }
 
-obc_error_code_t writeTelemetryToFile(int32_t telFileId, telemetry_data_t telemetryData) {
+obc_error_code_t writeTelemetryToFile(int32_t telFileId, telemetry_record_block_t *block,
+                                      const telemetry_data_t *telemetryData) {
   // Assume file is open and valid
   obc_error_code_t errCode;
 
-  RETURN_IF_ERROR_CODE(writeFile(telFileId, &telemetryData, sizeof(telemetry_data_t)));
+  if (block == NULL || telemetryData == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  obc_gs_error_code_t packErrCode = telemRecordBlockAppend(block, telemetryData);
+  if (packErrCode == OBC_GS_ERR_CODE_BUFF_TOO_SMALL) {
+    RETURN_IF_ERROR_CODE(flushTelemetryBlockToFile(telFileId, block));
+    packErrCode = telemRecordBlockAppend(block, telemetryData);
+  }
+
+  if (packErrCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_FAILED_PACK;
+  }
 
   return OBC_ERR_CODE_SUCCESS;
 }
 
-obc_error_code_t readNextTelemetryFromFile(int32_t telemFileId, telemetry_data_t *telemData) {
+obc_error_code_t flushTelemetryBlockToFile(int32_t telFileId, telemetry_record_block_t *block) {
   // Assume file is open and valid
   obc_error_code_t errCode;
 
+  if (block == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (block->numRecords == 0) {
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  uint16_t blockLen = 0;
+  if (telemRecordBlockFinish(block, &blockLen) != OBC_GS_ERR_CODE_SUCCESS) {
+    telemRecordBlockInit(block);
+    return OBC_ERR_CODE_FAILED_PACK;
+  }
+
+  // Empty the block first; retrying a failed write would only hold up every later record
+  telemRecordBlockInit(block);
+  RETURN_IF_ERROR_CODE(writeFile(telFileId, block->data, blockLen));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t readNextTelemetryBlockFromFile(int32_t telemFileId, telemetry_record_block_t *block) {
+  // Assume file is open and valid
+  obc_error_code_t errCode;
+
+  if (block == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
   // TODO: Read the file in reverse and filter out excess state data
   // We're only sending X past states per downlink, so we should only need to read
   // the last X states
 
   size_t bytesRead = 0;
-  RETURN_IF_ERROR_CODE(readFile(telemFileId, telemData, sizeof(telemetry_data_t), &bytesRead));
+  RETURN_IF_ERROR_CODE(readFile(telemFileId, block->data, TELEM_RECORD_BLOCK_HEADER_SIZE, &bytesRead));
 
   if (bytesRead == 0) {
     return OBC_ERR_CODE_REACHED_EOF;
   }
 
-  // Since we only write the telemetry data struct, the number of bytes in the file
-  // should be a multiple of the size of the struct.
-  if (bytesRead != sizeof(telemetry_data_t)) {
+  // Blocks are written whole, so a short header means the file was cut off
+  if (bytesRead != TELEM_RECORD_BLOCK_HEADER_SIZE) {
     return OBC_ERR_CODE_FAILED_FILE_READ;
   }
 
+  uint16_t payloadLen = 0;
+  if (telemRecordParseHeader(block->data, &payloadLen) != OBC_GS_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_FAILED_UNPACK;
+  }
+
+  RETURN_IF_ERROR_CODE(readFile(telemFileId, block->data + TELEM_RECORD_BLOCK_HEADER_SIZE, payloadLen, &bytesRead));
+
+  if (bytesRead != payloadLen) {
+    return OBC_ERR_CODE_FAILED_FILE_READ;
+  }
+
+  if (telemRecordBlockLoad(block) != OBC_GS_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_FAILED_UNPACK;
+  }
+
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -2,6 +2,7 @@
 
 #include "obc_errors.h"
 #include "telemetry_manager.h"
+#include "obc_gs_telemetry_record.h"
 
 #include <stdint.h>
 #include <stddef.h>
@@ -68,24 +69,38 @@ obc_error_code_t closeTelemetryFile(int32_t telemFileId);
 obc_error_code_t constructTelemetryFilePath(uint32_t telemBatchId, char *buff, size_t buffSize);
 
 /**
- * @brief Write telemetry data to file.
+ * @brief Pack telemetry data into a block of records, writing the block to file once it is full.
  *
  * @param telFileId File descriptor given by Reliance Edge
- * @param telemetryData Telemetry data to write to file
+ * @param block Block collecting the records not yet written to the file
+ * @param telemetryData Telemetry data to add
  * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
- * @note File must already be opened for writing
+ * @note File must already be opened for writing. Records stay in RAM until the block fills up or
+ * flushTelemetryBlockToFile is called.
  */
-obc_error_code_t writeTelemetryToFile(int32_t telFileId, telemetry_data_t telemetryData);
+obc_error_code_t writeTelemetryToFile(int32_t telFileId, telemetry_record_block_t *block,
+                                      const telemetry_data_t *telemetryData);
 
 /**
- * @brief Get the next telemetry data point from the given telemetry file
+ * @brief Write the records collected in a block to file and empty the block.
+ *
+ * @param telFileId File descriptor given by Reliance Edge
+ * @param block Block to write; nothing is written if it has no records
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ * @note File must already be opened for writing. The block is emptied even if the write fails.
+ */
+obc_error_code_t flushTelemetryBlockToFile(int32_t telFileId, telemetry_record_block_t *block);
+
+/**
+ * @brief Get the next block of telemetry records from the given telemetry file
  *
  * @param telemFileId The telemetry file descriptor
- * @param telemData Buffer to store the telemetry data point in
- * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, error code otherwise
+ * @param block Buffer to store the block in; iterate its records with telemRecordBlockNext
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, OBC_ERR_CODE_REACHED_EOF at the end of the file,
+ * OBC_ERR_CODE_FAILED_UNPACK if the block is corrupted, error code otherwise
  * @note File must already be opened for reading
  */
-obc_error_code_t readNextTelemetryFromFile(int32_t telemFileId, telemetry_data_t *telemData);
+obc_error_code_t readNextTelemetryBlockFromFile(int32_t telemFileId, telemetry_record_block_t *block);
 
 /**
  * @brief Create and open a new telemetry file in read/write mode.
@@ -44,6 +44,11 @@ static uint8_t telemetryDataQueueStack[TELEMETRY_DATA_QUEUE_LENGTH * TELEMETRY_D
 static SemaphoreHandle_t downlinkReady = NULL;
 static StaticSemaphore_t downlinkReadyBuffer;
 
+#ifdef CONFIG_SDCARD
+// Records waiting to be written to the telemetry file as one block
+static telemetry_record_block_t telemetryBlock;
+#endif  // CONFIG_SDCARD
+
 void obcTaskInitTelemetryMgr(void) {
   memset(&telemetryDataQueue, 0, sizeof(telemetryDataQueue));
   memset(&telemetryDataQueueStack, 0, sizeof(telemetryDataQueueStack));
@@ -51,6 +56,7 @@ void obcTaskInitTelemetryMgr(void) {
   ASSERT((telemetryDataQueueStack != NULL) && (&telemetryDataQueue != NULL));
   telemetryDataQueueHandle = xQueueCreateStatic(TELEMETRY_DATA_QUEUE_LENGTH, TELEMETRY_DATA_QUEUE_ITEM_SIZE,
                                                 telemetryDataQueueStack, &telemetryDataQueue);
+  vQueueAddToRegistry(telemetryDataQueueHandle, "telemetry data");
 
   ASSERT(&downlinkReadyBuffer != NULL);
   downlinkReady = xSemaphoreCreateBinaryStatic(&downlinkReadyBuffer);
@@ -70,11 +76,13 @@ void obcTaskFunctionTelemetryMgr(void *pvParameters) {
   // TODO: Deal with errors
   LOG_IF_ERROR_CODE(createAndOpenTelemetryFileRW(telemetryBatchId, &telemetryFileId));
 
+  telemRecordBlockInit(&telemetryBlock);
+
   while (1) {
     telemetry_data_t telemData;
     if (xQueueReceive(telemetryDataQueueHandle, &telemData, TELEMETRY_DATA_QUEUE_WAIT_PERIOD) == pdPASS) {
       // TODO: Deal with errors
-      LOG_IF_ERROR_CODE(writeTelemetryToFile(telemetryFileId, telemData));
+      LOG_IF_ERROR_CODE(writeTelemetryToFile(telemetryFileId, &telemetryBlock, &telemData));
     }
 
     // Check if we need to downlink telemetry
@@ -82,6 +90,9 @@ void obcTaskFunctionTelemetryMgr(void *pvParameters) {
       continue;
     }
 
+    // The downlink only reads whole blocks from the file
+    LOG_IF_ERROR_CODE(flushTelemetryBlockToFile(telemetryFileId, &telemetryBlock));
+
     // Important to close the file before sending it to the comms task
     LOG_IF_ERROR_CODE(closeTelemetryFile(telemetryFileId));
     if (errCode != OBC_ERR_CODE_SUCCESS) {
@@ -19,9 +19,9 @@ void obcTaskInitTimekeeper(void) {}
 void obcTaskFunctionTimekeeper(void *pvParameters) {
   /*
    * The timekeeper is a task instead of a FreeRTOS timer because we have more control
-   * over its priority relative to other tasks (inc. the time service daemon). The sync period is
-   * often enough (and the MCU clock speed is high enough) that we don't need to
-   * worry about significant drift.
+   * over its priority relative to other tasks (inc. the time service daemon). The local time
+   * runs from the RTOS tick, so between syncs nothing needs to advance it. The sync period is
+   * often enough that we don't need to worry about significant drift of the tick against the RTC.
    *
    * The I2C clock speed is high enough that, if another task is completing an I2C transaction
    * when the timekeeper task is performing a local RTC sync, the timekeeper task should not have to
@@ -33,17 +33,15 @@ void obcTaskFunctionTimekeeper(void *pvParameters) {
   uint8_t syncPeriodCounter = 0;  // Sync whenever this counter is 0
 
   while (1) {
+    // Builds without an RTC never sync, so the base is kept from falling a tick wrap behind here
+    foldUnixTime();
+
     if (syncPeriodCounter == 0) {
       // Sync the local time with the RTC every LOCAL_TIME_SYNC_PERIOD_S seconds.
       // TODO: Deal with errors
 #ifdef CONFIG_DS3232
       LOG_IF_ERROR_CODE(syncUnixTime());
 #endif  // DCONFIG_DS3232
-    } else {
-      vPortEnterCritical();
-      incrementCurrentUnixTime();
-      incrementCurrentDateTime();
-      vPortExitCritical();
     }
 
     // Send Unix time to fram
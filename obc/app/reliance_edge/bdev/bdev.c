@@ -32,6 +32,39 @@
 
 BDEVINFO gaRedBdevInfo[REDCONF_VOLUME_COUNT];
 
+#if (REDCONF_READ_ONLY == 0) && (REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U)
+/*  The GPL buffer module cannot gather writes itself, so contiguous sector
+    writes are gathered here instead, beneath the buffers.  The file system
+    calls RedBDevFlush() before any write which must not reach the media ahead
+    of the writes before it, so holding writes back until the next flush keeps
+    the same ordering guarantees as writing them through.
+*/
+#define GATHER_SIZE (REDCONF_BUFFER_WRITE_GATHER_SIZE_KB * 1024U)
+
+/** @brief A run of contiguous sectors which have been written but not yet
+           sent to the block device.
+*/
+typedef struct {
+  uint8_t bVolNum;         /**< Volume the sectors belong to. */
+  uint32_t ulSectorCount;  /**< Number of sectors gathered; zero if none. */
+  uint64_t ullSectorStart; /**< First sector gathered. */
+
+  /** Byte array used as the heap for the gathered sectors.
+   */
+  uint8_t abHeap[(REDCONF_BUFFER_ALIGNMENT - 1U) + GATHER_SIZE];
+
+  /** Pointer into abHeap, aligned the same as the block buffers.
+   */
+  uint8_t *pbBuffer;
+} GATHERCTX;
+
+static GATHERCTX gGather;
+
+static REDSTATUS GatherFlush(uint8_t bVolNum);
+static REDSTATUS GatherWrite(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount, const void *pBuffer);
+static void GatherOverlay(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount, void *pBuffer);
+#endif
+
 /** @brief Initialize a block device.
 
     This function is called when the file system needs access to a block
@@ -152,7 +185,25 @@ REDSTATUS RedBDevClose(uint8_t bVolNum) {
   if (bVolNum >= REDCONF_VOLUME_COUNT) {
     ret = -RED_EINVAL;
   } else {
+#if (REDCONF_READ_ONLY == 0) && (REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U)
+    /*  Send any gathered sectors out before closing, as they would have been
+        had they been written through.  They are dropped if that fails, so
+        that they cannot land on the media after it is reopened.
+    */
+    REDSTATUS flushRet = GatherFlush(bVolNum);
+
+    if (gGather.bVolNum == bVolNum) {
+      gGather.ulSectorCount = 0U;
+    }
+
+    ret = RedOsBDevClose(bVolNum);
+
+    if (flushRet != 0) {
+      ret = flushRet;
+    }
+#else
     ret = RedOsBDevClose(bVolNum);
+#endif
   }
 
   return ret;
@@ -185,6 +236,12 @@ REDSTATUS RedBDevRead(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSecto
     ret = -RED_EINVAL;
   } else {
     ret = RedOsBDevRead(bVolNum, ullSectorStart, ulSectorCount, pBuffer);
+
+#if (REDCONF_READ_ONLY == 0) && (REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U)
+    if (ret == 0) {
+      GatherOverlay(bVolNum, ullSectorStart, ulSectorCount, pBuffer);
+    }
+#endif
   }
 
   return ret;
@@ -217,7 +274,11 @@ REDSTATUS RedBDevWrite(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSect
       (pBuffer == NULL)) {
     ret = -RED_EINVAL;
   } else {
+#if REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U
+    ret = GatherWrite(bVolNum, ullSectorStart, ulSectorCount, pBuffer);
+#else
     ret = RedOsBDevWrite(bVolNum, ullSectorStart, ulSectorCount, pBuffer);
+#endif
   }
 
   return ret;
@@ -250,9 +311,128 @@ REDSTATUS RedBDevFlush(uint8_t bVolNum) {
   if (bVolNum >= REDCONF_VOLUME_COUNT) {
     ret = -RED_EINVAL;
   } else {
+#if REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U
+    ret = GatherFlush(bVolNum);
+
+    if (ret == 0) {
+      ret = RedOsBDevFlush(bVolNum);
+    }
+#else
     ret = RedOsBDevFlush(bVolNum);
+#endif
   }
 
   return ret;
 }
 #endif /* REDCONF_READ_ONLY == 0 */
+
+#if (REDCONF_READ_ONLY == 0) && (REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U)
+/** @brief Send the gathered sectors of a volume to its block device.
+
+    On failure the sectors stay gathered, so that a retried flush writes them
+    again.
+
+    @param bVolNum  The volume number of the volume whose sectors are written.
+
+    @return A negated ::REDSTATUS code indicating the operation result.
+
+    @retval 0           Operation was successful.
+    @retval -RED_EIO    A disk I/O error occurred.
+*/
+static REDSTATUS GatherFlush(uint8_t bVolNum) {
+  REDSTATUS ret = 0;
+
+  if ((gGather.ulSectorCount > 0U) && (gGather.bVolNum == bVolNum)) {
+    ret = RedOsBDevWrite(bVolNum, gGather.ullSectorStart, gGather.ulSectorCount, gGather.pbBuffer);
+
+    if (ret == 0) {
+      gGather.ulSectorCount = 0U;
+    }
+  }
+
+  return ret;
+}
+
+/** @brief Gather a sector write, sending the gathered run to the block device
+           when the write does not extend it.
+
+    A write which continues the run is appended to it, and one which falls
+    entirely within the run replaces those sectors in place.  Anything else
+    sends the run out first and then starts a new one, or is written through if
+    it would not fit.  A run which has filled up is sent out right away.
+
+    @param bVolNum          The volume number of the volume being written to.
+    @param ullSectorStart   The starting sector number.
+    @param ulSectorCount    The number of sectors to write.
+    @param pBuffer          The buffer from which to write the sector data.
+
+    @return A negated ::REDSTATUS code indicating the operation result.
+
+    @retval 0           Operation was successful.
+    @retval -RED_EIO    A disk I/O error occurred.
+*/
+static REDSTATUS GatherWrite(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount, const void *pBuffer) {
+  REDSTATUS ret = 0;
+  uint32_t ulSectorSize = gaRedBdevInfo[bVolNum].ulSectorSize;
+  uint32_t ulCapacity = GATHER_SIZE / ulSectorSize;
+  uint64_t ullRunEnd = gGather.ullSectorStart + gGather.ulSectorCount;
+  bool fSameRun = (gGather.ulSectorCount > 0U) && (gGather.bVolNum == bVolNum);
+
+  if (gGather.pbBuffer == NULL) {
+    gGather.pbBuffer = UINT8_PTR_ALIGN(gGather.abHeap, REDCONF_BUFFER_ALIGNMENT);
+  }
+
+  if (fSameRun && (ullSectorStart >= gGather.ullSectorStart) &&
+      ((ullSectorStart + ulSectorCount) <= ullRunEnd)) {
+    uint32_t ulOffset = (uint32_t)(ullSectorStart - gGather.ullSectorStart);
+
+    RedMemCpy(&gGather.pbBuffer[ulOffset * ulSectorSize], pBuffer, ulSectorCount * ulSectorSize);
+  } else if (fSameRun && (ullSectorStart == ullRunEnd) && (ulSectorCount <= (ulCapacity - gGather.ulSectorCount))) {
+    RedMemCpy(&gGather.pbBuffer[gGather.ulSectorCount * ulSectorSize], pBuffer, ulSectorCount * ulSectorSize);
+    gGather.ulSectorCount += ulSectorCount;
+  } else {
+    ret = GatherFlush(gGather.bVolNum);
+
+    if (ret == 0) {
+      if (ulSectorCount < ulCapacity) {
+        RedMemCpy(gGather.pbBuffer, pBuffer, ulSectorCount * ulSectorSize);
+        gGather.bVolNum = bVolNum;
+        gGather.ullSectorStart = ullSectorStart;
+        gGather.ulSectorCount = ulSectorCount;
+      } else {
+        ret = RedOsBDevWrite(bVolNum, ullSectorStart, ulSectorCount, pBuffer);
+      }
+    }
+  }
+
+  if ((ret == 0) && (gGather.ulSectorCount == ulCapacity)) {
+    ret = GatherFlush(bVolNum);
+  }
+
+  return ret;
+}
+
+/** @brief Copy gathered sectors over the stale copies just read from the
+           block device.
+
+    @param bVolNum          The volume number of the volume that was read.
+    @param ullSectorStart   The starting sector number that was read.
+    @param ulSectorCount    The number of sectors that were read.
+    @param pBuffer          The buffer holding the sector data that was read.
+*/
+static void GatherOverlay(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount, void *pBuffer) {
+  if ((gGather.ulSectorCount > 0U) && (gGather.bVolNum == bVolNum)) {
+    uint64_t ullFirst = REDMAX(ullSectorStart, gGather.ullSectorStart);
+    uint64_t ullEnd = REDMIN(ullSectorStart + ulSectorCount, gGather.ullSectorStart + gGather.ulSectorCount);
+
+    if (ullFirst < ullEnd) {
+      uint32_t ulSectorSize = gaRedBdevInfo[bVolNum].ulSectorSize;
+      uint8_t *pbBuffer = (uint8_t *)pBuffer;
+
+      RedMemCpy(&pbBuffer[(uint32_t)(ullFirst - ullSectorStart) * ulSectorSize],
+                &gGather.pbBuffer[(uint32_t)(ullFirst - gGather.ullSectorStart) * ulSectorSize],
+                (uint32_t)(ullEnd - ullFirst) * ulSectorSize);
+    }
+  }
+}
+#endif
@@ -43,10 +43,16 @@
 #error "REDCONF_BUFFER_COUNT cannot be greater than 255"
 #endif
 
-/*  This implementation does not support the write-gather buffer.
- */
-#if REDCONF_BUFFER_WRITE_GATHER_SIZE_KB != 0U
-#error "Configuration error: REDCONF_BUFFER_WRITE_GATHER_SIZE_KB must be zero"
+/*  This implementation has no write-gather buffer of its own; when one is
+    configured, bdev.c gathers the writes beneath it.  Dirty buffers are
+    written in ascending block order so that contiguous blocks reach bdev.c
+    back to back.
+*/
+#if REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U
+#if (REDCONF_BUFFER_WRITE_GATHER_SIZE_KB * 1024U) < REDCONF_BLOCK_SIZE
+#error "Configuration error: REDCONF_BUFFER_WRITE_GATHER_SIZE_KB must hold at least one block"
+#endif
+#define GATHER_BLOCKS ((REDCONF_BUFFER_WRITE_GATHER_SIZE_KB * 1024U) >> BLOCK_SIZE_P2)
 #endif
 
 /** @brief Convert a buffer index into a block buffer pointer.
@@ -99,6 +105,10 @@ typedef struct {
 static bool BufferToIdx(const void *pBuffer, uint8_t *pbIdx);
 #if REDCONF_READ_ONLY == 0
 static REDSTATUS BufferWrite(uint8_t bIdx);
+#if REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U
+static REDSTATUS BufferWriteRun(uint8_t bIdx);
+static bool BufferFindRunNeighbor(uint32_t ulBlock, uint8_t *pbIdx);
+#endif
 #endif
 static void BufferMakeLRU(uint8_t bIdx);
 static void BufferMakeMRU(uint8_t bIdx);
@@ -192,6 +202,8 @@ REDSTATUS RedBufferGet(uint32_t ulBlock, uint16_t uFlags, void **ppBuffer) {
 #if REDCONF_READ_ONLY == 1
           CRITICAL_ERROR();
           ret = -RED_EFUBAR;
+#elif REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U
+          ret = BufferWriteRun(bIdx);
 #else
           ret = BufferWrite(bIdx);
 #endif
@@ -321,21 +333,35 @@ REDSTATUS RedBufferFlushRange(uint32_t ulBlockStart, uint32_t ulBlockCount) {
     REDERROR();
     ret = -RED_EINVAL;
   } else {
-    uint8_t bIdx;
+    uint32_t ulNextBlock = ulBlockStart;
 
-    for (bIdx = 0U; bIdx < REDCONF_BUFFER_COUNT; bIdx++) {
-      BUFFERHEAD *pHead = &gBufCtx.aHead[bIdx];
+    /*  Write the dirty buffers lowest block first, so that blocks which are
+        contiguous on disk are written one after the other.
+    */
+    while (ret == 0) {
+      uint8_t bLowIdx = REDCONF_BUFFER_COUNT;
+      uint8_t bIdx;
+
+      for (bIdx = 0U; bIdx < REDCONF_BUFFER_COUNT; bIdx++) {
+        const BUFFERHEAD *pHead = &gBufCtx.aHead[bIdx];
+
+        if ((pHead->bVolNum == gbRedVolNum) && (pHead->ulBlock != BBLK_INVALID) &&
+            ((pHead->uFlags & BFLAG_DIRTY) != 0U) && (pHead->ulBlock >= ulNextBlock) &&
+            (pHead->ulBlock < (ulBlockStart + ulBlockCount)) &&
+            ((bLowIdx == REDCONF_BUFFER_COUNT) || (pHead->ulBlock < gBufCtx.aHead[bLowIdx].ulBlock))) {
+          bLowIdx = bIdx;
+        }
+      }
 
-      if ((pHead->bVolNum == gbRedVolNum) && (pHead->ulBlock != BBLK_INVALID) &&
-          ((pHead->uFlags & BFLAG_DIRTY) != 0U) && (pHead->ulBlock >= ulBlockStart) &&
-          (pHead->ulBlock < (ulBlockStart + ulBlockCount))) {
-        ret = BufferWrite(bIdx);
+      if (bLowIdx == REDCONF_BUFFER_COUNT) {
+        break;
+      }
 
-        if (ret == 0) {
-          pHead->uFlags &= (~BFLAG_DIRTY);
-        } else {
-          break;
-        }
+      ret = BufferWrite(bLowIdx);
+
+      if (ret == 0) {
+        gBufCtx.aHead[bLowIdx].uFlags &= (~BFLAG_DIRTY);
+        ulNextBlock = gBufCtx.aHead[bLowIdx].ulBlock + 1U;
       }
     }
   }
@@ -613,6 +639,86 @@ static REDSTATUS BufferWrite(uint8_t bIdx) {
 
   return ret;
 }
+
+#if REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U
+/** @brief Write a dirty buffer which is being evicted, along with the dirty
+           data buffers on either side of it.
+
+    Appending to a file dirties a run of newly allocated, contiguous data
+    blocks.  Writing the whole run when its first block is evicted lets bdev.c
+    send it as one multiple sector write, rather than one write per block as
+    each is evicted in turn.  The neighbors stay buffered, now clean.  Metadata
+    buffers are left alone, since they are usually dirtied again before the
+    next transaction point.
+
+    @param bIdx The index of the buffer being evicted.
+
+    @return A negated ::REDSTATUS code indicating the operation result.
+
+    @retval 0           Operation was successful.
+    @retval -RED_EIO    A disk I/O error occurred.
+    @retval -RED_EINVAL Invalid parameters.
+*/
+static REDSTATUS BufferWriteRun(uint8_t bIdx) {
+  REDSTATUS ret;
+  const BUFFERHEAD *pHead = &gBufCtx.aHead[bIdx];
+
+  if (pHead->bVolNum != gbRedVolNum) {
+    ret = BufferWrite(bIdx);
+  } else {
+    uint32_t ulFirstBlock = pHead->ulBlock;
+    uint32_t ulBlock;
+    uint8_t bRunIdx;
+
+    while ((ulFirstBlock > 0U) && ((pHead->ulBlock - ulFirstBlock) < (GATHER_BLOCKS - 1U)) &&
+           BufferFindRunNeighbor(ulFirstBlock - 1U, &bRunIdx)) {
+      ulFirstBlock--;
+    }
+
+    ret = 0;
+
+    for (ulBlock = ulFirstBlock; (ret == 0) && ((ulBlock - ulFirstBlock) < GATHER_BLOCKS); ulBlock++) {
+      if (ulBlock == pHead->ulBlock) {
+        /*  The evicted buffer is marked clean by the caller when it is
+            repurposed.
+        */
+        ret = BufferWrite(bIdx);
+      } else if ((ulBlock < gpRedVolume->ulBlockCount) && BufferFindRunNeighbor(ulBlock, &bRunIdx)) {
+        ret = BufferWrite(bRunIdx);
+
+        if (ret == 0) {
+          gBufCtx.aHead[bRunIdx].uFlags &= (~BFLAG_DIRTY);
+        }
+      } else {
+        break;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/** @brief Find a dirty, unreferenced data buffer which can be written along
+           with an evicted neighbor.
+
+    @param ulBlock  The block number to find.
+    @param pbIdx    If the block qualifies (true is returned), populated with
+                    the index of its buffer.
+
+    @return Whether @p ulBlock is buffered in a dirty, unreferenced data buffer.
+*/
+static bool BufferFindRunNeighbor(uint32_t ulBlock, uint8_t *pbIdx) {
+  bool ret = false;
+
+  if (BufferFind(ulBlock, pbIdx)) {
+    const BUFFERHEAD *pHead = &gBufCtx.aHead[*pbIdx];
+
+    ret = ((pHead->uFlags & BFLAG_DIRTY) != 0U) && ((pHead->uFlags & BFLAG_META) == 0U) && (pHead->bRefCount == 0U);
+  }
+
+  return ret;
+}
+#endif /* REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U */
 #endif /* REDCONF_READ_ONLY == 0 */
 
 /** @brief Mark a buffer as least recently used.
@@ -86,11 +86,11 @@
 
 #define REDCONF_INDIRECT_POINTERS 32U
 
-#define REDCONF_BUFFER_COUNT 12U
+#define REDCONF_BUFFER_COUNT 20U
 
 #define REDCONF_BUFFER_ALIGNMENT 8U
 
-#define REDCONF_BUFFER_WRITE_GATHER_SIZE_KB 0U
+#define REDCONF_BUFFER_WRITE_GATHER_SIZE_KB 4U
 
 #define RedMemCpyUnchecked memcpy
 
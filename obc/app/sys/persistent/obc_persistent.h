@@ -50,7 +50,7 @@ extern "C" {
 /*---------------------------------------------------------------------------*/
 /* Maximum sub index for each section */
 #define OBC_PERSISTENT_MIN_SUBINDEX 1U
-#define OBC_PERSISTENT_MAX_SUBINDEX_ALARM 24U
+#define OBC_PERSISTENT_MAX_SUBINDEX_ALARM 256U
 
 /*---------------------------------------------------------------------------*/
 /**
@@ -87,6 +87,13 @@ typedef enum {
   CMD_MICRO_SD_FORMAT_PERSIST,
   CMD_PING_PERSIST,
   CMD_DOWNLINK_TELEM_PERSIST,
+  CMD_UPLINK_DISC_PERSIST,
+  CMD_SET_PROGRAMMING_SESSION_PERSIST,
+  CMD_ERASE_APP_PERSIST,
+  CMD_DOWNLOAD_DATA_PERSIST,
+  CMD_VERIFY_CRC_PERSIST,
+  CMD_I2C_PROBE_PERSIST,
+  CMD_GNC_TIMING_STATS_PERSIST,
   NUM_CMD_CALLBACKS_PERSIST
 } cmd_callback_id_persist_t;
 
@@ -109,21 +116,17 @@ typedef struct {
   cmd_callback_id_persist_t id;
 } cmd_msg_persist_t;
 
-// Alarm handler callback definition for persistent
-typedef union {
-  obc_error_code_t (*defaultCallback)(void);
-  obc_error_code_t (*cmdCallback)(cmd_msg_persist_t *);
-} alarm_handler_callback_def_persist_t;
-
 typedef enum {
   ALARM_TYPE_DEFAULT_PERSIST,
   ALARM_TYPE_TIME_TAGGED_CMD_PERSIST,
 } alarm_type_persist_t;
 
+// Callbacks are not stored since function addresses change between firmware images
 typedef struct {
   uint32_t unixTime;
+  uint32_t sequence;  // Queue order of alarms due at the same time
   alarm_type_persist_t type;
-  alarm_handler_callback_def_persist_t callbackDef;
+  bool active;  // Cleared once the alarm has been taken off the queue
   union {
     cmd_msg_persist_t cmdMsg;
   };
@@ -1,5 +1,6 @@
 #include "obc_time.h"
 #include "obc_time_utils.h"
+#include "obc_time_base.h"
 #include "obc_errors.h"
 #include "obc_logging.h"
 #include "obc_assert.h"
@@ -7,36 +8,29 @@
 
 #include <FreeRTOS.h>
 #include <os_task.h>
-#include <os_atomic.h>
 
 #include <stdint.h>
 #include <stddef.h>
-#include <string.h>
 
-// Global Unix time
-static volatile uint32_t currTime;
-static volatile rtc_date_time_t currDataTime = {0};
+// Local time, extrapolated from the RTOS tick between syncs with the RTC
+static obc_time_base_t timeBase;
 
 /**
- * @brief Set the current unix time.
- *
- * @param unixTime The unix time to set.
- * @warning This function should not be called from an ISR.
+ * @brief Convert an RTOS tick count to milliseconds
  */
-static void setCurrentUnixTime(uint32_t unixTime);
+static inline uint32_t ticksToMs(TickType_t ticks) { return (uint32_t)ticks * portTICK_PERIOD_MS; }
 
 /**
- * @brief Set the current data time.
- *
- * @param datetime The data time to set.
- * @warning This function should not be called from an ISR.
+ * @brief Read the RTC as a Unix time, with the tick at which it was read
  */
-static void setCurrentDateTime(rtc_date_time_t datetime);
+static obc_error_code_t readRtcUnixTime(uint32_t *unixTime, uint32_t *readTickMs);
 
 obc_error_code_t initTime(void) {
   obc_error_code_t errCode;
 
-  memset((void *)&currTime, 0, sizeof(currTime));
+  vPortEnterCritical();
+  timeBaseSet(&timeBase, 0, ticksToMs(xTaskGetTickCount()));
+  vPortExitCritical();
 
   // Initialize the RTC
 
@@ -60,81 +54,99 @@ obc_error_code_t initTime(void) {
   rtcControl.INTCN = 1;
   RETURN_IF_ERROR_CODE(setControlRTC(&rtcControl));
 
-  // Synch the local Unix time with the RTC
-  RETURN_IF_ERROR_CODE(syncUnixTime());
+  // Synch the local Unix time with the RTC that was just set
+  RETURN_IF_ERROR_CODE(stepUnixTimeToRtc());
 
   return OBC_ERR_CODE_SUCCESS;
 }
 
-uint32_t getCurrentUnixTime(void) {
-  uint32_t time;
+unix_time_ms_t getCurrentUnixTimeMs(void) {
+  unix_time_ms_t time;
 
   vPortEnterCritical();
-  time = currTime;
+  time = timeBaseNow(&timeBase, ticksToMs(xTaskGetTickCount()));
   vPortExitCritical();
 
   return time;
 }
 
-uint32_t getCurrentUnixTimeInISR(void) {
-  uint32_t time;
+unix_time_ms_t getCurrentUnixTimeMsInISR(void) {
+  unix_time_ms_t time;
 
   UBaseType_t uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
-  time = currTime;
+  time = timeBaseNow(&timeBase, ticksToMs(xTaskGetTickCountFromISR()));
   taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
 
   return time;
 }
 
+uint32_t getCurrentUnixTime(void) { return getCurrentUnixTimeMs().seconds; }
+
+uint32_t getCurrentUnixTimeInISR(void) { return getCurrentUnixTimeMsInISR().seconds; }
+
 rtc_date_time_t getCurrentDateTime(void) {
   rtc_date_time_t dateTime = {0};
-  vPortEnterCritical();
-  dateTime = currDataTime;
-  vPortExitCritical();
+
+  // Only fails for times past the end of the RTC's century; the zeroed date time is returned then
+  unixToDatetime(getCurrentUnixTime(), &dateTime);
 
   return dateTime;
 }
 
 rtc_date_time_t getCurrentDateTimeinISR(void) {
   rtc_date_time_t dateTime = {0};
-  UBaseType_t uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
-  dateTime = currDataTime;
-  taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+
+  unixToDatetime(getCurrentUnixTimeInISR(), &dateTime);
 
   return dateTime;
 }
 
-static void setCurrentUnixTime(uint32_t unixTime) {
+void foldUnixTime(void) {
   vPortEnterCritical();
-  currTime = unixTime;
+  timeBaseFold(&timeBase, ticksToMs(xTaskGetTickCount()));
   vPortExitCritical();
 }
 
-static void setCurrentDateTime(rtc_date_time_t datetime) {
+obc_error_code_t syncUnixTime(void) {
+  obc_error_code_t errCode;
+
+  // Keep the base close to the tick so the time since it never wraps, even if the RTC cannot be read
+  foldUnixTime();
+
+  uint32_t unixTime;
+  uint32_t readTickMs;
+  RETURN_IF_ERROR_CODE(readRtcUnixTime(&unixTime, &readTickMs));
+
   vPortEnterCritical();
-  currDataTime = datetime;
+  timeBaseResync(&timeBase, readTickMs, unixTime, ticksToMs(xTaskGetTickCount()));
   vPortExitCritical();
+
+  return OBC_ERR_CODE_SUCCESS;
 }
 
-void incrementCurrentUnixTime(void) { Atomic_Increment_u32(&currTime); }
-void incrementCurrentDateTime(void) {
+obc_error_code_t stepUnixTimeToRtc(void) {
+  obc_error_code_t errCode;
+
+  uint32_t unixTime;
+  uint32_t readTickMs;
+  RETURN_IF_ERROR_CODE(readRtcUnixTime(&unixTime, &readTickMs));
+
   vPortEnterCritical();
-  currDataTime.time.seconds++;
+  timeBaseSet(&timeBase, unixTime, readTickMs);
   vPortExitCritical();
+
+  return OBC_ERR_CODE_SUCCESS;
 }
 
-obc_error_code_t syncUnixTime(void) {
+static obc_error_code_t readRtcUnixTime(uint32_t *unixTime, uint32_t *readTickMs) {
   obc_error_code_t errCode;
 
   rtc_date_time_t datetime = {0};
 
+  // The RTC has just ticked over somewhere within the read; the read itself is a few ms at most
+  *readTickMs = ticksToMs(xTaskGetTickCount());
   RETURN_IF_ERROR_CODE(getCurrentDateTimeRTC(&datetime));
-
-  uint32_t unixTime;
-  RETURN_IF_ERROR_CODE(datetimeToUnix(&datetime, &unixTime));
-
-  setCurrentUnixTime(unixTime);
-  setCurrentDateTime(datetime);
+  RETURN_IF_ERROR_CODE(datetimeToUnix(&datetime, unixTime));
 
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -2,6 +2,7 @@
 
 #include "obc_errors.h"
 #include "ds3232_mz.h"
+#include "obc_time_base.h"
 
 #include <stdint.h>
 
@@ -10,6 +11,21 @@
  */
 obc_error_code_t initTime(void);
 
+/**
+ * @brief Get the current unix time with millisecond resolution.
+ *
+ * @return unix_time_ms_t The current unix time.
+ * @warning Do not call in an ISR
+ */
+unix_time_ms_t getCurrentUnixTimeMs(void);
+
+/**
+ * @brief Get the current unix time with millisecond resolution while in ISR.
+ *
+ * @return unix_time_ms_t The current unix time.
+ */
+unix_time_ms_t getCurrentUnixTimeMsInISR(void);
+
 /**
  * @brief Get the current unix time.
  *
@@ -41,20 +57,30 @@ rtc_date_time_t getCurrentDateTime(void);
 rtc_date_time_t getCurrentDateTimeinISR(void);
 
 /**
- * @brief Increment the current unix time by 1 second.
- * @warning This function should not be called from an ISR.
+ * @brief Move the local time's base up to the current tick.
+ *
+ * The local time is extrapolated from a base on the millisecond tick, which wraps after 49.7 days. This must be called
+ * more often than that, with or without an RTC to sync to.
  */
-void incrementCurrentUnixTime(void);
+void foldUnixTime(void);
 
 /**
- * @brief Increment the current date time by 1 second.
- * @warning This function should not be called from an ISR.
+ * @brief Sync the unix time with the RTC.
+ *
+ * The local time runs from the RTOS tick between syncs. The sync keeps its sub-second phase when it agrees with the
+ * RTC, steps it forward onto the RTC's second when it is behind, and slows it down when it is ahead, so it never goes
+ * backwards (see timeBaseResync).
+ *
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise an error code.
  */
-void incrementCurrentDateTime(void);
+obc_error_code_t syncUnixTime(void);
 
 /**
- * @brief Sync the unix time with the RTC.
+ * @brief Set the unix time to the RTC's, even if that moves it backwards.
+ *
+ * Only for right after the RTC has been set. syncUnixTime takes OBC_TIME_BASE_SLEW_DIVISOR times as long as a time
+ * is ahead to slew it back, which is far too slow for a time set back from the ground.
  *
  * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise an error code.
  */
-obc_error_code_t syncUnixTime(void);
+obc_error_code_t stepUnixTimeToRtc(void);
@@ -0,0 +1,97 @@
+#include "obc_time_base.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MS_PER_SECOND 1000U
+
+/**
+ * @brief Part of the time elapsed since the base that goes to the slew
+ */
+static uint32_t slewTaken(const obc_time_base_t *base, uint32_t elapsedMs);
+
+void timeBaseSet(obc_time_base_t *base, uint32_t unixTime, uint32_t tickMs) {
+  if (base == NULL) {
+    return;
+  }
+
+  base->time.seconds = unixTime;
+  base->time.milliseconds = 0;
+  base->tickMs = tickMs;
+  base->slewMs = 0;
+}
+
+unix_time_ms_t timeBaseNow(const obc_time_base_t *base, uint32_t tickMs) {
+  unix_time_ms_t now = {0};
+
+  if (base == NULL) {
+    return now;
+  }
+
+  // Unsigned subtraction handles the tick count wrapping
+  uint32_t elapsedMs = tickMs - base->tickMs;
+  elapsedMs -= slewTaken(base, elapsedMs);
+
+  // Split the elapsed time first so the sum cannot overflow, whatever the elapsed time
+  uint32_t ms = base->time.milliseconds + elapsedMs % MS_PER_SECOND;
+  now.seconds = base->time.seconds + elapsedMs / MS_PER_SECOND + ms / MS_PER_SECOND;
+  now.milliseconds = (uint16_t)(ms % MS_PER_SECOND);
+
+  return now;
+}
+
+void timeBaseFold(obc_time_base_t *base, uint32_t tickMs) {
+  if (base == NULL) {
+    return;
+  }
+
+  base->time = timeBaseNow(base, tickMs);
+  base->slewMs -= slewTaken(base, tickMs - base->tickMs);
+  base->tickMs = tickMs;
+}
+
+int32_t timeBaseResync(obc_time_base_t *base, uint32_t rtcTickMs, uint32_t rtcUnixTime, uint32_t tickMs) {
+  if (base == NULL) {
+    return 0;
+  }
+
+  // The time may have been read since the RTC was, so the correction starts from now rather than from rtcTickMs
+  timeBaseFold(base, tickMs);
+  int64_t sinceRtcMs = (int64_t)(uint32_t)(tickMs - rtcTickMs);
+
+  // Local time relative to the start of the RTC's second, both taken back to when the RTC was read
+  int64_t offsetMs = ((int64_t)base->time.seconds - (int64_t)rtcUnixTime) * MS_PER_SECOND +
+                     (int64_t)base->time.milliseconds - sinceRtcMs;
+
+  // The offset already counts any slew still pending, so it replaces that slew
+  base->slewMs = 0;
+
+  if (offsetMs >= 0 && offsetMs < (int64_t)MS_PER_SECOND) {
+    return 0;
+  }
+
+  int64_t correctionMs;
+  if (offsetMs < 0) {
+    // Behind: forward to the start of the second
+    base->time.seconds = rtcUnixTime + (uint32_t)(sinceRtcMs / MS_PER_SECOND);
+    base->time.milliseconds = (uint16_t)(sinceRtcMs % MS_PER_SECOND);
+    correctionMs = -offsetMs;
+  } else {
+    // Ahead: slew back to the last ms of the second
+    correctionMs = (int64_t)(MS_PER_SECOND - 1) - offsetMs;
+    base->slewMs = (-correctionMs > (int64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)(-correctionMs);
+  }
+
+  if (correctionMs > INT32_MAX) {
+    return INT32_MAX;
+  }
+  if (correctionMs < INT32_MIN) {
+    return INT32_MIN;
+  }
+  return (int32_t)correctionMs;
+}
+
+static uint32_t slewTaken(const obc_time_base_t *base, uint32_t elapsedMs) {
+  uint32_t slewMs = elapsedMs / OBC_TIME_BASE_SLEW_DIVISOR;
+  return (slewMs < base->slewMs) ? slewMs : base->slewMs;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Unix time with millisecond resolution
+ */
+typedef struct {
+  uint32_t seconds;
+  uint16_t milliseconds;  // 0-999
+} unix_time_ms_t;
+
+/**
+ * @brief Unix time at a point on the millisecond tick; the current time is extrapolated from it
+ *
+ * The tick count since the base must stay below 2^32 ms, so the base has to be folded forward at least every 49
+ * days.
+ */
+typedef struct {
+  unix_time_ms_t time;
+  uint32_t tickMs;
+  uint32_t slewMs;  // Time still to be taken out of the elapsed time, to bring a local time that ran ahead back
+} obc_time_base_t;
+
+// While slewing, 1 ms in this many of the elapsed time is taken out, so the local time runs at 90% speed
+#define OBC_TIME_BASE_SLEW_DIVISOR 10U
+
+/**
+ * @brief Set the base to the start of a second
+ *
+ * This is the only way to move the time backwards, e.g. after the RTC has been set.
+ *
+ * @param base Time base to set
+ * @param unixTime Unix time at the tick
+ * @param tickMs Millisecond tick count
+ */
+void timeBaseSet(obc_time_base_t *base, uint32_t unixTime, uint32_t tickMs);
+
+/**
+ * @brief Extrapolate the time at a tick from the base
+ *
+ * @param base Time base
+ * @param tickMs Millisecond tick count, no earlier than the base
+ * @return unix_time_ms_t Time at the tick
+ */
+unix_time_ms_t timeBaseNow(const obc_time_base_t *base, uint32_t tickMs);
+
+/**
+ * @brief Move the base forward to a tick without changing the time it gives
+ *
+ * @param base Time base
+ * @param tickMs Millisecond tick count, no earlier than the base
+ */
+void timeBaseFold(obc_time_base_t *base, uint32_t tickMs);
+
+/**
+ * @brief Correct the base with the RTC without ever moving the time backwards
+ *
+ * The RTC counts whole seconds, so it only says the time is somewhere within its current second. A local time within
+ * that second is kept, so that the tick's sub-second phase survives the resync. A local time behind it is stepped
+ * forward to the start of the second. A local time ahead of it is slewed: it runs slower until it is back at the last
+ * ms of the second, however far ahead it was.
+ *
+ * @param base Time base
+ * @param rtcTickMs Millisecond tick count at which the RTC was read, no earlier than the base
+ * @param rtcUnixTime Unix time read from the RTC
+ * @param tickMs Current millisecond tick count, no earlier than rtcTickMs; the correction starts here, so times read
+ * from the base since the RTC was read are not undone
+ * @return int32_t Correction applied or still to be slewed, in milliseconds; positive if the local time was behind
+ */
+int32_t timeBaseResync(obc_time_base_t *base, uint32_t rtcTickMs, uint32_t rtcUnixTime, uint32_t tickMs);
+
+#ifdef __cplusplus
+}
+#endif
@@ -141,8 +141,8 @@ obc_error_code_t unixToDatetime(uint32_t ts, rtc_date_time_t *dt) {
 
   // Ex: If it's February, months = 11 and dt->date.month = 14
   // because LEAPOCH starts in March. So we need to subtract 12
-  // to get the correct month (1-indexed)
-  if (dt->date.month >= 12) {
+  // to get the correct month (1-indexed). December is month 12.
+  if (dt->date.month > 12) {
     dt->date.month -= 12;
     dt->date.year++;
   }
@@ -0,0 +1,79 @@
+#include "obc_byte_ring.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// The acquire/release pairs make the data copy visible before the index that publishes it
+#define RING_LOAD_ACQUIRE(index) __atomic_load_n(&(index), __ATOMIC_ACQUIRE)
+#define RING_STORE_RELEASE(index, value) __atomic_store_n(&(index), (value), __ATOMIC_RELEASE)
+
+obc_error_code_t byteRingInit(obc_byte_ring_t *ring, uint8_t *buffer, uint32_t size) {
+  if (ring == NULL || buffer == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (size == 0 || (size & (size - 1)) != 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  ring->buffer = buffer;
+  ring->mask = size - 1;
+  ring->head = 0;
+  ring->tail = 0;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+uint32_t byteRingWrite(obc_byte_ring_t *ring, const uint8_t *data, uint32_t dataLen) {
+  if (ring == NULL || data == NULL) {
+    return 0;
+  }
+
+  uint32_t head = ring->head;
+  uint32_t freeBytes = (ring->mask + 1) - (head - RING_LOAD_ACQUIRE(ring->tail));
+  uint32_t writeLen = (dataLen < freeBytes) ? dataLen : freeBytes;
+
+  // Copy in at most two pieces, the second one starting back at the beginning of the buffer
+  uint32_t offset = head & ring->mask;
+  uint32_t firstLen = (ring->mask + 1) - offset;
+  if (firstLen > writeLen) {
+    firstLen = writeLen;
+  }
+
+  memcpy(ring->buffer + offset, data, firstLen);
+  memcpy(ring->buffer, data + firstLen, writeLen - firstLen);
+
+  RING_STORE_RELEASE(ring->head, head + writeLen);
+
+  return writeLen;
+}
+
+uint32_t byteRingPeekContiguous(obc_byte_ring_t *ring, const uint8_t **data) {
+  if (ring == NULL || data == NULL) {
+    return 0;
+  }
+
+  uint32_t tail = ring->tail;
+  uint32_t usedBytes = RING_LOAD_ACQUIRE(ring->head) - tail;
+  uint32_t offset = tail & ring->mask;
+  uint32_t untilWrap = (ring->mask + 1) - offset;
+
+  *data = ring->buffer + offset;
+  return (usedBytes < untilWrap) ? usedBytes : untilWrap;
+}
+
+void byteRingConsume(obc_byte_ring_t *ring, uint32_t len) {
+  if (ring == NULL) {
+    return;
+  }
+
+  RING_STORE_RELEASE(ring->tail, ring->tail + len);
+}
+
+uint32_t byteRingBytesUsed(obc_byte_ring_t *ring) {
+  if (ring == NULL) {
+    return 0;
+  }
+
+  return RING_LOAD_ACQUIRE(ring->head) - RING_LOAD_ACQUIRE(ring->tail);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "obc_errors.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Single-producer single-consumer byte ring.
+ *
+ * Only the producer moves head and only the consumer moves tail, so one context can write while another reads
+ * without a lock. Both indices run freely and are masked on access, which requires a power of 2 size.
+ */
+typedef struct {
+  uint8_t *buffer;
+  uint32_t mask;
+  uint32_t head;
+  uint32_t tail;
+} obc_byte_ring_t;
+
+/**
+ * @brief Initialize a ring over a caller-provided buffer
+ *
+ * @param ring The ring to initialize
+ * @param buffer Backing storage for the ring
+ * @param size Size of buffer in bytes; must be a non-zero power of 2
+ * @return obc_error_code_t OBC_ERR_CODE_INVALID_ARG if the size is not a power of 2
+ */
+obc_error_code_t byteRingInit(obc_byte_ring_t *ring, uint8_t *buffer, uint32_t size);
+
+/**
+ * @brief Copy as much of data into the ring as fits. Producer side only.
+ *
+ * @param ring The ring to write to
+ * @param data Bytes to write
+ * @param dataLen Number of bytes in data
+ * @return uint32_t Number of bytes written, less than dataLen if the ring filled up
+ */
+uint32_t byteRingWrite(obc_byte_ring_t *ring, const uint8_t *data, uint32_t dataLen);
+
+/**
+ * @brief Get the longest readable span that does not wrap, without consuming it. Consumer side only.
+ *
+ * @param ring The ring to read from
+ * @param data Set to the start of the span inside the ring's buffer
+ * @return uint32_t Number of bytes in the span, 0 if the ring is empty
+ */
+uint32_t byteRingPeekContiguous(obc_byte_ring_t *ring, const uint8_t **data);
+
+/**
+ * @brief Release bytes returned by byteRingPeekContiguous so the producer can reuse them. Consumer side only.
+ *
+ * @param ring The ring to consume from
+ * @param len Number of bytes to release; must not exceed the number of bytes in the ring
+ */
+void byteRingConsume(obc_byte_ring_t *ring, uint32_t len);
+
+/**
+ * @brief Get the number of bytes waiting in the ring
+ *
+ * @param ring The ring to check
+ * @return uint32_t Number of unread bytes
+ */
+uint32_t byteRingBytesUsed(obc_byte_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,157 @@
+#include "obc_mpsc_ring.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MPSC_RING_COMMITTED 0x80000000U
+#define MPSC_RING_PADDING 0x40000000U
+#define MPSC_RING_LENGTH_MASK 0x0000FFFFU
+
+#define MPSC_RING_MIN_SIZE 16U
+#define MPSC_RING_ALIGN(len) (((len) + 3U) & ~3U)
+
+#define RING_LOAD_RELAXED(var) __atomic_load_n(&(var), __ATOMIC_RELAXED)
+#define RING_LOAD_ACQUIRE(var) __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define RING_STORE_RELEASE(var, value) __atomic_store_n(&(var), (value), __ATOMIC_RELEASE)
+
+static inline uint32_t *entryHeader(obc_mpsc_ring_t *ring, uint32_t index) {
+  return (uint32_t *)(void *)(ring->buffer + (index & ring->mask));
+}
+
+static void updateHighWater(obc_mpsc_ring_t *ring, uint32_t used) {
+  uint32_t highWater = RING_LOAD_RELAXED(ring->highWater);
+  while (used > highWater &&
+         !__atomic_compare_exchange_n(&ring->highWater, &highWater, used, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+  }
+}
+
+obc_error_code_t mpscRingInit(obc_mpsc_ring_t *ring, uint8_t *buffer, uint32_t size) {
+  if (ring == NULL || buffer == NULL || ((uintptr_t)buffer & 3U) != 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  // The largest entry, a quarter of the ring, must fit in the header's length field
+  if (size < MPSC_RING_MIN_SIZE || size > 4U * MPSC_RING_LENGTH_MASK || (size & (size - 1)) != 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  memset(buffer, 0, size);
+  ring->buffer = buffer;
+  ring->mask = size - 1;
+  ring->head = 0;
+  ring->tail = 0;
+  ring->dropped = 0;
+  ring->highWater = 0;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t mpscRingPush(obc_mpsc_ring_t *ring, const void *header, uint32_t headerLen, const void *payload,
+                              uint32_t payloadLen) {
+  if (ring == NULL || header == NULL || (payload == NULL && payloadLen > 0)) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t size = ring->mask + 1;
+  uint32_t entryLen = headerLen + payloadLen;
+  uint32_t slotLen = MPSC_RING_HEADER_SIZE + MPSC_RING_ALIGN(entryLen);
+  // Keeps a padded entry well inside the ring
+  if (slotLen > size / 4) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t head = RING_LOAD_RELAXED(ring->head);
+  uint32_t padLen = 0;
+  uint32_t tail = 0;
+  do {
+    tail = RING_LOAD_ACQUIRE(ring->tail);
+    uint32_t untilWrap = size - (head & ring->mask);
+    padLen = (slotLen > untilWrap) ? untilWrap : 0;
+
+    if (size - (head - tail) < padLen + slotLen) {
+      __atomic_fetch_add(&ring->dropped, 1U, __ATOMIC_RELAXED);
+      return OBC_ERR_CODE_QUEUE_FULL;
+    }
+    // On failure head is reloaded with the value another producer moved it to
+  } while (!__atomic_compare_exchange_n(&ring->head, &head, head + padLen + slotLen, true, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_RELAXED));
+
+  updateHighWater(ring, head + padLen + slotLen - tail);
+
+  if (padLen > 0) {
+    RING_STORE_RELEASE(*entryHeader(ring, head), MPSC_RING_COMMITTED | MPSC_RING_PADDING |
+                                                     (padLen - MPSC_RING_HEADER_SIZE));
+    head += padLen;
+  }
+
+  uint8_t *data = (uint8_t *)entryHeader(ring, head) + MPSC_RING_HEADER_SIZE;
+  memcpy(data, header, headerLen);
+  if (payloadLen > 0) {
+    memcpy(data + headerLen, payload, payloadLen);
+  }
+
+  // Publishes the copy above to the consumer
+  RING_STORE_RELEASE(*entryHeader(ring, head), MPSC_RING_COMMITTED | entryLen);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t mpscRingPop(obc_mpsc_ring_t *ring, void *entry, uint32_t entrySize, uint32_t *entryLen) {
+  if (ring == NULL || entry == NULL || entryLen == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t tail = ring->tail;
+  while (1) {
+    if (tail == RING_LOAD_ACQUIRE(ring->head)) {
+      return OBC_ERR_CODE_QUEUE_EMPTY;
+    }
+
+    uint32_t *header = entryHeader(ring, tail);
+    uint32_t headerWord = RING_LOAD_ACQUIRE(*header);
+    if ((headerWord & MPSC_RING_COMMITTED) == 0) {
+      // The oldest entry is reserved but its producer has not finished copying it in
+      return OBC_ERR_CODE_QUEUE_EMPTY;
+    }
+
+    uint32_t len = headerWord & MPSC_RING_LENGTH_MASK;
+    uint32_t slotLen = MPSC_RING_HEADER_SIZE + MPSC_RING_ALIGN(len);
+    obc_error_code_t errCode = OBC_ERR_CODE_SUCCESS;
+
+    if ((headerWord & MPSC_RING_PADDING) == 0) {
+      if (len <= entrySize) {
+        memcpy(entry, (uint8_t *)header + MPSC_RING_HEADER_SIZE, len);
+        *entryLen = len;
+      } else {
+        errCode = OBC_ERR_CODE_BUFF_TOO_SMALL;
+      }
+    }
+
+    // Producers that reserve this space again write their header last, so it must not hold an old commit flag
+    memset(header, 0, slotLen);
+    tail += slotLen;
+    RING_STORE_RELEASE(ring->tail, tail);
+
+    if ((headerWord & MPSC_RING_PADDING) == 0) {
+      return errCode;
+    }
+  }
+}
+
+uint32_t mpscRingDropped(obc_mpsc_ring_t *ring) {
+  if (ring == NULL) {
+    return 0;
+  }
+
+  return RING_LOAD_RELAXED(ring->dropped);
+}
+
+uint32_t mpscRingHighWater(obc_mpsc_ring_t *ring) {
+  if (ring == NULL) {
+    return 0;
+  }
+
+  return RING_LOAD_RELAXED(ring->highWater);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "obc_errors.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Lock-free multi-producer single-consumer ring of variable length entries.
+ *
+ * Producers reserve space by moving head with a compare-and-swap, copy their entry in and then set the commit flag in
+ * the entry's header word. Tasks and ISRs can push at the same time without a critical section or a kernel call. The
+ * consumer pops entries in reservation order, so a producer interrupted between reserving and committing holds back
+ * the entries after it until it finishes.
+ *
+ * Each entry is a 4 byte header (commit flag, padding flag, length) followed by the data rounded up to 4 bytes. An
+ * entry that would run past the end of the buffer is placed at the start, behind a padding entry for the rest of the
+ * buffer. The consumer zeroes what it consumes so a producer's unfinished entry never shows an old commit flag.
+ */
+typedef struct {
+  uint8_t *buffer;
+  uint32_t mask;
+  uint32_t head;
+  uint32_t tail;
+  uint32_t dropped;
+  uint32_t highWater;
+} obc_mpsc_ring_t;
+
+#define MPSC_RING_HEADER_SIZE 4U
+
+/**
+ * @brief Initialize a ring over a caller-provided buffer
+ *
+ * @param ring The ring to initialize
+ * @param buffer Backing storage for the ring; must be 4 byte aligned
+ * @param size Size of buffer in bytes; must be a power of 2 from 16 to 128 KiB
+ * @return obc_error_code_t OBC_ERR_CODE_INVALID_ARG if the buffer or size is not usable
+ */
+obc_error_code_t mpscRingInit(obc_mpsc_ring_t *ring, uint8_t *buffer, uint32_t size);
+
+/**
+ * @brief Push an entry made of a fixed part and an optional variable part. Safe from any task or ISR.
+ *
+ * @param ring The ring to push to
+ * @param header First part of the entry
+ * @param headerLen Number of bytes in header
+ * @param payload Second part of the entry, may be NULL if payloadLen is 0
+ * @param payloadLen Number of bytes in payload
+ * @return obc_error_code_t OBC_ERR_CODE_QUEUE_FULL if the entry does not fit right now, which is counted as dropped.
+ * OBC_ERR_CODE_INVALID_ARG if the entry is larger than a quarter of the ring.
+ */
+obc_error_code_t mpscRingPush(obc_mpsc_ring_t *ring, const void *header, uint32_t headerLen, const void *payload,
+                              uint32_t payloadLen);
+
+/**
+ * @brief Pop the oldest entry. Consumer side only.
+ *
+ * @param ring The ring to pop from
+ * @param entry Buffer for the entry
+ * @param entrySize Size of entry in bytes
+ * @param entryLen Set to the length of the popped entry
+ * @return obc_error_code_t OBC_ERR_CODE_QUEUE_EMPTY if there is no committed entry to pop.
+ * OBC_ERR_CODE_BUFF_TOO_SMALL if the entry does not fit in the buffer; the entry is discarded.
+ */
+obc_error_code_t mpscRingPop(obc_mpsc_ring_t *ring, void *entry, uint32_t entrySize, uint32_t *entryLen);
+
+/**
+ * @brief Get the number of entries dropped because the ring was full
+ *
+ * @param ring The ring to check
+ * @return uint32_t Number of dropped entries since the ring was initialized
+ */
+uint32_t mpscRingDropped(obc_mpsc_ring_t *ring);
+
+/**
+ * @brief Get the most bytes that were reserved in the ring at once, headers and padding included
+ *
+ * @param ring The ring to check
+ * @return uint32_t The high-water mark in bytes
+ */
+uint32_t mpscRingHighWater(obc_mpsc_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
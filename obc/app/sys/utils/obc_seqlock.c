@@ -0,0 +1,48 @@
+#include "obc_seqlock.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+void seqlockInit(obc_seqlock_t *lock) {
+  if (lock == NULL) {
+    return;
+  }
+
+  __atomic_store_n(&lock->sequence, 0U, __ATOMIC_RELAXED);
+}
+
+void seqlockWrite(obc_seqlock_t *lock, void *value, const void *src, size_t len) {
+  if (lock == NULL || value == NULL || src == NULL) {
+    return;
+  }
+
+  uint32_t sequence = __atomic_load_n(&lock->sequence, __ATOMIC_RELAXED);
+
+  // Mark the write as started before any of the value changes
+  __atomic_store_n(&lock->sequence, sequence + 1U, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  memcpy(value, src, len);
+
+  // Publish the value along with the end of the write
+  __atomic_store_n(&lock->sequence, sequence + 2U, __ATOMIC_RELEASE);
+}
+
+bool seqlockTryRead(const obc_seqlock_t *lock, const void *value, void *dest, size_t len) {
+  if (lock == NULL || value == NULL || dest == NULL) {
+    return false;
+  }
+
+  uint32_t start = __atomic_load_n(&lock->sequence, __ATOMIC_ACQUIRE);
+  if ((start & 1U) != 0U) {
+    return false;
+  }
+
+  memcpy(dest, value, len);
+
+  // Order the copy before the second look at the sequence
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  return __atomic_load_n(&lock->sequence, __ATOMIC_RELAXED) == start;
+}
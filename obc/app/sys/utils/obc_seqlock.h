@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sequence lock guarding a value with one writer and any number of readers.
+ *
+ * The writer never waits and readers never block the writer: a reader copies the value and checks that no write
+ * overlapped the copy, retrying if one did. The sequence is odd while a write is in progress.
+ */
+typedef struct {
+  uint32_t sequence;
+} obc_seqlock_t;
+
+/**
+ * @brief Initialize a sequence lock with no write in progress
+ *
+ * @param lock The lock to initialize
+ */
+void seqlockInit(obc_seqlock_t *lock);
+
+/**
+ * @brief Copy a new value into the guarded storage. Writer side only.
+ *
+ * @param lock The lock guarding value
+ * @param value The guarded storage
+ * @param src The new value
+ * @param len Size of the value in bytes
+ */
+void seqlockWrite(obc_seqlock_t *lock, void *value, const void *src, size_t len);
+
+/**
+ * @brief Make one attempt at copying the guarded value out
+ *
+ * @param lock The lock guarding value
+ * @param value The guarded storage
+ * @param dest Buffer for the copy
+ * @param len Size of the value in bytes
+ * @return true if the copy is consistent, false if a write overlapped it and it must be retried
+ */
+bool seqlockTryRead(const obc_seqlock_t *lock, const void *value, void *dest, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
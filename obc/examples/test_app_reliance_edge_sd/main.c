@@ -1,4 +1,6 @@
 #include "obc_spi_io.h"
+#include "obc_spi_dma.h"
+#include "obc_board_config.h"
 #include "obc_sci_io.h"
 #include "obc_print.h"
 
@@ -8,6 +10,7 @@
 #include <sys_common.h>
 #include <sci.h>
 #include <spi.h>
+#include <sys_dma.h>
 
 #include <redposix.h>
 #include <string.h>
@@ -138,6 +141,11 @@ int main(void) {
   initSciPrint();
   initSpiMutex();
 
+  // The SD card driver moves sectors by DMA
+  dmaEnable();
+  initDmaSpiSemaphores();
+  spiDmaInit(SDC_SPI_REG);
+
   sciPrintf("Starting Reliance Edge Demo\r\n");
 
   xTaskCreateStatic(vTask1, "RelianceEdgeDemo", 1024, NULL, 1, taskStack, &taskBuffer);
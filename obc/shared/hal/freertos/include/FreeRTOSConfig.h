@@ -193,6 +193,13 @@ void freertosConfigAssert( const char * pcFile, unsigned long ulLine);
 
 #undef INCLUDE_xSemaphoreGetMutexHolder
 #define INCLUDE_xSemaphoreGetMutexHolder 1
+
+#undef INCLUDE_xTimerPendFunctionCall
+#define INCLUDE_xTimerPendFunctionCall 1
+
+/* The timer service task also parses VN100 packets pended from the SCI interrupt */
+#undef configTIMER_TASK_STACK_DEPTH
+#define configTIMER_TASK_STACK_DEPTH 256
 /* USER CODE END */
 
 #endif /* FREERTOS_CONFIG_H */
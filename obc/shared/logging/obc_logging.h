@@ -21,6 +21,19 @@ typedef enum { LOG_TO_SDCARD, LOG_TO_UART } log_output_location_t;
 #define LOG_DEFAULT_OUTPUT_LOCATION LOG_TO_UART
 #endif
 
+/**
+ * @enum log_format_t
+ * @brief Format of logs written to the SD card.
+ *
+ * Text logs are formatted on the OBC. Binary logs are fixed size records formatted by the ground station, see
+ * log_record.h. Logs sent over UART are always text.
+ */
+typedef enum { LOG_FORMAT_TEXT, LOG_FORMAT_BINARY } log_format_t;
+
+#ifndef LOG_DEFAULT_FORMAT
+#define LOG_DEFAULT_FORMAT LOG_FORMAT_TEXT
+#endif
+
 /**
  * @enum log_level_t
  * @brief Log levels enum.
@@ -94,6 +107,7 @@ void logSetLevel(log_level_t newLogLevel);
  * 								OBC_ERR_CODE_BUFF_TOO_SMALL		if logged message is too long
  * 								OBC_ERR_CODE_INVALID_ARG		if file or s are null or if there is an encoding error
  * 								OBC_ERR_CODE_SUCCESS			if message is successfully logged
+ * 								OBC_ERR_CODE_QUEUE_FULL			if the log ring is full and the log was dropped
  * 								OBC_ERR_CODE_UNKNOWN 			otherwise
  *
  */
@@ -105,11 +119,12 @@ obc_error_code_t logErrorCode(log_level_t msgLevel, const char *file, uint32_t l
  * @param msgLevel				Level of the message
  * @param file					File of message
  * @param line					Line of message
- * @param msg           the message that should be logged (MUST BE STATIC)
+ * @param msg           the message that should be logged; the first 127 characters are copied
  * @return obc_error_code_t		OBC_ERR_CODE_LOG_MSG_SILENCED 	if msgLevel is lower than logging level
  * 								OBC_ERR_CODE_BUFF_TOO_SMALL		if logged message is too long
  * 								OBC_ERR_CODE_INVALID_ARG		if file or s are null or if there is an encoding error
  * 								OBC_ERR_CODE_SUCCESS			if message is successfully logged
+ * 								OBC_ERR_CODE_QUEUE_FULL			if the log ring is full and the log was dropped
  * 								OBC_ERR_CODE_UNKNOWN 			otherwise
  *
  */
@@ -126,6 +141,7 @@ obc_error_code_t logMsg(log_level_t msgLevel, const char *file, uint32_t line, c
  * 								OBC_ERR_CODE_BUFF_TOO_SMALL		if logged message is too long
  * 								OBC_ERR_CODE_INVALID_ARG		if file or s are null or if there is an encoding error
  * 								OBC_ERR_CODE_SUCCESS			if message is successfully logged
+ * 								OBC_ERR_CODE_QUEUE_FULL			if the log ring is full and the log was dropped
  * 								OBC_ERR_CODE_UNKNOWN 			otherwise
  *
  */
@@ -137,11 +153,12 @@ obc_error_code_t logErrorCodeFromISR(log_level_t msgLevel, const char *file, uin
  * @param msgLevel				Level of the message
  * @param file					File of message
  * @param line					Line of message
- * @param msg           the message that should be logged (MUST BE STATIC)
+ * @param msg           the message that should be logged; the first 127 characters are copied
  * @return obc_error_code_t		OBC_ERR_CODE_LOG_MSG_SILENCED 	if msgLevel is lower than logging level
  * 								OBC_ERR_CODE_BUFF_TOO_SMALL		if logged message is too long
  * 								OBC_ERR_CODE_INVALID_ARG		if file or s are null or if there is an encoding error
  * 								OBC_ERR_CODE_SUCCESS			if message is successfully logged
+ * 								OBC_ERR_CODE_QUEUE_FULL			if the log ring is full and the log was dropped
  * 								OBC_ERR_CODE_UNKNOWN 			otherwise
  *
  */
@@ -44,6 +44,11 @@ typedef enum {
   OBC_ERR_CODE_SPI_RX_OVERRUN = 114,
   OBC_ERR_CODE_ADC_INVALID_CHANNEL = 115,
   OBC_ERR_CODE_ADC_FAILURE = 116,
+  OBC_ERR_CODE_SD_CARD_TIMEOUT = 117,
+  OBC_ERR_CODE_SD_CARD_CMD_REJECTED = 118,
+  OBC_ERR_CODE_SD_CARD_INVALID_DATA_TOKEN = 119,
+  OBC_ERR_CODE_SD_CARD_WRITE_REJECTED = 120,
+  OBC_ERR_CODE_SD_CARD_CRC_MISMATCH = 121,
 
   /* CDH errors 200 - 299 */
   OBC_ERR_CODE_UNSUPPORTED_CMD = 200,
@@ -71,6 +76,7 @@ typedef enum {
   OBC_ERR_CODE_VN100_OUTPUT_BUFFER_OVERFLOW = 311,
   OBC_ERR_CODE_VN100_INSUFFICIENT_BAUD_RATE = 312,
   OBC_ERR_CODE_VN100_ERROR_BUFFER_OVERFLOW = 313,
+  OBC_ERR_CODE_VN100_NO_DATA = 314,
 
   /* EPS errors 400 - 499 */
 
@@ -93,6 +99,7 @@ typedef enum {
 
   /* Payload errors 600 - 699 */
   OBC_ERR_CODE_FRAME_SIZE_OUT_OF_RANGE = 600,
+  OBC_ERR_CODE_JPEG_INCOMPLETE = 601,
 
   /* File System errors 700 - 799 */
   OBC_ERR_CODE_INVALID_FILE_NAME = 700,
@@ -0,0 +1,163 @@
+import re
+from argparse import ArgumentParser
+from dataclasses import dataclass
+from datetime import datetime, timezone
+from pathlib import Path
+from struct import unpack
+from typing import Final
+
+# Binary log record layout, see obc/app/modules/logger/log_record.h
+LOG_RECORD_SIZE: Final = 16
+LOG_RECORD_SYNC: Final = 0xA5
+LOG_RECORD_FMT: Final = ">BBHIII"
+
+LOG_TYPE_ERROR_CODE: Final = 0
+LOG_TYPE_MSG: Final = 1
+LEVEL_STRINGS: Final = ["TRACE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL"]
+
+FNV_OFFSET_BASIS: Final = 2166136261
+FNV_PRIME: Final = 16777619
+
+# String literal passed to one of the LOG_<LEVEL> macros
+LOG_MSG_PATTERN: Final = re.compile(
+    r'LOG_(?:TRACE|DEBUG|INFO|WARN|ERROR|FATAL)(?:_FROM_ISR)?\(\s*"((?:[^"\\]|\\.)*)"\s*\)'
+)
+SOURCE_SUFFIXES: Final = (".c", ".h")
+
+
+@dataclass
+class LogRecord:
+    """A binary log record written by the OBC logger"""
+
+    log_type: int
+    log_level: int
+    line: int
+    file_id: int
+    arg: int
+    timestamp: int
+
+
+@dataclass
+class StringTable:
+    """Strings of the source tree keyed by the hashes the OBC stores in place of them"""
+
+    files: dict[int, str]
+    msgs: dict[int, str]
+
+
+def fnv1a(text: str) -> int:
+    """
+    Returns the 32-bit FNV-1a hash the OBC uses for file and message IDs (logHashString)
+
+    :param text: String to hash
+    :return: The hash
+    """
+    value = FNV_OFFSET_BASIS
+    for byte in text.encode():
+        value = ((value ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    return value
+
+
+def build_string_table(repo_root: Path) -> StringTable:
+    """
+    Hashes the paths of the OBC sources and the messages they log
+
+    :param repo_root: Root of the repository the firmware was built from
+    :return: The string table
+    """
+    files: dict[int, str] = {}
+    msgs: dict[int, str] = {}
+    for path in sorted((repo_root / "obc").rglob("*")):
+        if path.suffix not in SOURCE_SUFFIXES or not path.is_file():
+            continue
+
+        # Paths are logged relative to the repo root with forward slashes
+        relative_path = path.relative_to(repo_root).as_posix()
+        files[fnv1a(relative_path)] = relative_path
+
+        for match in LOG_MSG_PATTERN.finditer(path.read_text(errors="ignore")):
+            msg = match.group(1).encode().decode("unicode_escape")
+            msgs[fnv1a(msg)] = msg
+
+    return StringTable(files=files, msgs=msgs)
+
+
+def decode_records(data: bytes) -> tuple[list[LogRecord], int]:
+    """
+    Decodes the records of a binary log file. The OBC only writes whole records, so they sit at multiples of
+    LOG_RECORD_SIZE and a damaged record is skipped without losing the ones after it.
+
+    :param data: Contents of the log file
+    :return: The decoded records and the number of records skipped (a partial record at the end counts as one)
+    """
+    records: list[LogRecord] = []
+    skipped = 0
+    for offset in range(0, len(data) - LOG_RECORD_SIZE + 1, LOG_RECORD_SIZE):
+        sync, type_and_level, line, file_id, arg, timestamp = unpack(
+            LOG_RECORD_FMT, data[offset : offset + LOG_RECORD_SIZE]
+        )
+        log_type = type_and_level >> 3
+        log_level = type_and_level & 0x07
+        if sync != LOG_RECORD_SYNC or log_type > LOG_TYPE_MSG or log_level >= len(LEVEL_STRINGS):
+            skipped += 1
+            continue
+
+        records.append(LogRecord(log_type, log_level, line, file_id, arg, timestamp))
+
+    if len(data) % LOG_RECORD_SIZE != 0:
+        skipped += 1
+
+    return records, skipped
+
+
+def format_record(record: LogRecord, table: StringTable) -> str:
+    """
+    Formats a record like the OBC's text logs
+
+    :param record: The record to format
+    :param table: Strings to resolve the file and message IDs with
+    :return: The log line
+    """
+    file_name = table.files.get(record.file_id, f"file#{record.file_id:08x}")
+    if record.log_type == LOG_TYPE_ERROR_CODE:
+        body = str(record.arg)
+    else:
+        body = table.msgs.get(record.arg, f"msg#{record.arg:08x}")
+
+    timestamp = datetime.fromtimestamp(record.timestamp, tz=timezone.utc).strftime("%y-%m-%d_%H-%M-%S")
+    return f"{timestamp} {LEVEL_STRINGS[record.log_level]:<5} -> {file_name}:{record.line} - {body}"
+
+
+def arg_parse() -> ArgumentParser:
+    """
+    Returns the argument parser
+
+    :return: Parser object
+    """
+    parser = ArgumentParser(description="Convert a binary OBC log file to text")
+    parser.add_argument("-i", required=True, dest="input_path", type=str, help="Path to the binary log file")
+    parser.add_argument(
+        "-r",
+        dest="repo_root",
+        type=str,
+        default=str(Path(__file__).resolve().parents[3]),
+        help="Root of the repository the firmware was built from. Default is this repository",
+    )
+    return parser
+
+
+def main() -> None:
+    """Entry point to script"""
+    args = arg_parse().parse_args()
+    table = build_string_table(Path(args.repo_root))
+    records, skipped = decode_records(Path(args.input_path).read_bytes())
+
+    for record in records:
+        print(format_record(record, table))
+
+    if skipped > 0:
+        print(f"Skipped {skipped} records that were not valid")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,123 @@
+from array import array
+
+import pytest
+
+from interfaces import INFO_FIELD_START_POSITION, RS_DECODED_DATA_SIZE, RS_ENCODED_DATA_SIZE
+from interfaces.obc_gs_interface.batch import BATCH_ENCODED_FRAME_MAX_LEN, BatchPipeline
+from interfaces.obc_gs_interface.fec import FEC
+
+AX25_FLAG = 0x7E
+
+
+def _payloads() -> list[bytes]:
+    return [bytes((i * 7 + j) % 256 for j in range(i * 20)) for i in range(11)] + [bytes(range(RS_DECODED_DATA_SIZE))]
+
+
+def test_round_trip():
+    for aes_key in (None, bytes(range(16))):
+        pipeline = BatchPipeline(aes_key=aes_key)
+        payloads = _payloads()
+
+        frames = pipeline.encode_frames(payloads)
+        for frame in frames:
+            assert frame is not None
+            assert frame[0] == AX25_FLAG and frame[-1] == AX25_FLAG
+            assert len(frame) <= BATCH_ENCODED_FRAME_MAX_LEN
+
+        decoded = pipeline.decode_frames(frame for frame in frames if frame is not None)
+        assert decoded == [payload.ljust(RS_DECODED_DATA_SIZE, b"\x00") for payload in payloads]
+
+
+def test_buffers_with_offsets():
+    pipeline = BatchPipeline()
+    frames = [frame for frame in pipeline.encode_frames(_payloads()) if frame is not None]
+
+    # Frames with idle flags between them, located by offset as a recording would be
+    stream = bytearray()
+    offsets = array("I")
+    lengths = array("I")
+    for frame in frames:
+        stream += bytes([AX25_FLAG] * 3)
+        offsets.append(len(stream))
+        lengths.append(len(frame))
+        stream += frame
+
+    result = pipeline.decode(stream, offsets, lengths)
+    assert list(result.statuses) == [0] * len(frames)
+    assert list(result.lengths) == [RS_DECODED_DATA_SIZE] * len(frames)
+    assert result.frames() == pipeline.decode(bytes(stream), list(offsets), list(lengths)).frames()
+
+
+def test_numpy_buffers():
+    np = pytest.importorskip("numpy")
+
+    pipeline = BatchPipeline()
+    payloads = _payloads()
+    frames = [frame for frame in pipeline.encode_frames(payloads) if frame is not None]
+
+    stream = np.frombuffer(b"".join(frames), dtype=np.uint8).copy()
+    lengths = np.array([len(frame) for frame in frames], dtype=np.uint32)
+    offsets = (np.cumsum(lengths) - lengths).astype(np.uint32)
+
+    result = pipeline.decode(stream, offsets, lengths)
+    decoded = np.frombuffer(result.data, dtype=np.uint8)[: len(frames) * RS_DECODED_DATA_SIZE]
+    assert bytes(decoded) == b"".join(payload.ljust(RS_DECODED_DATA_SIZE, b"\x00") for payload in payloads)
+
+
+def test_bad_frames_are_reported_alone():
+    pipeline = BatchPipeline()
+    payloads = _payloads()
+    frames = [bytearray(frame) for frame in pipeline.encode_frames(payloads) if frame is not None]
+
+    # More byte errors than the reed solomon code corrects
+    for i in range(40):
+        frames[2][20 + i * 6] ^= 0x80 | i
+    # Not a frame at all
+    frames[5] = bytearray([AX25_FLAG] + [0x55] * 300 + [AX25_FLAG])
+
+    decoded = pipeline.decode_frames(bytes(frame) for frame in frames)
+    assert decoded[2] is None
+    assert decoded[5] is None
+    for i in (0, 1, 3, 4, 6):
+        assert decoded[i] == payloads[i].ljust(RS_DECODED_DATA_SIZE, b"\x00")
+
+
+def _unstuff(frame: bytes) -> bytes:
+    """
+    Removes the 0 bit the sender adds after five 1s in a row, between the flags
+    """
+    bits = []
+    ones = 0
+    for byte in frame[1:-1]:
+        for shift in range(7, -1, -1):
+            bit = (byte >> shift) & 1
+            if ones == 5:
+                ones = 0
+                continue
+            bits.append(bit)
+            ones = ones + 1 if bit else 0
+    return bytes(int("".join(map(str, bits[i : i + 8])), 2) for i in range(0, len(bits) - 7, 8))
+
+
+def test_encode_matches_fec():
+    pipeline = BatchPipeline(aes_key=None)
+    payload = bytes(range(100))
+    frame = pipeline.encode_frames([payload])[0]
+    assert frame is not None
+
+    # The info field carries the same codeword as the per frame reed solomon binding produces
+    unstuffed = _unstuff(frame)
+    codeword = FEC().encode(payload)
+    assert unstuffed[INFO_FIELD_START_POSITION - 1 : INFO_FIELD_START_POSITION - 1 + RS_ENCODED_DATA_SIZE] == codeword
+
+
+def test_invalid_payload():
+    pipeline = BatchPipeline()
+    frames = pipeline.encode_frames([bytes(RS_DECODED_DATA_SIZE + 1), b"UW Orbital"])
+    assert frames[0] is None
+    assert frames[1] is not None
+
+    with pytest.raises(ValueError):
+        pipeline.encode(b"", [0], [])
+    with pytest.raises(ValueError):
+        BatchPipeline(aes_key=bytes(8))
@@ -4,6 +4,7 @@ from interfaces.obc_gs_interface.commands import (
     create_cmd_rtc_sync,
     pack_command,
     unpack_command,
+    unpack_command_responses,
 )
 
 
@@ -41,3 +42,17 @@ def test_time_tagged_pack_unpack():
     assert cmd_list[0].isTimeTagged == True
 
     assert cmd_list[0].timestamp == 1234567
+
+
+def test_coalesced_command_responses_unpack():
+    # An RTC sync response with 4 bytes of data followed by a ping response, then the zeroed tail of the block
+    block = b"\x02\x01\x04\x78\x56\x34\x12" + b"\x05\x7f\x00"
+    responses = unpack_command_responses(block + b"\x00" * 20)
+
+    assert len(responses) == 2
+    assert responses[0][0].cmdId == CmdCallbackId.CMD_RTC_SYNC.value
+    assert responses[0][0].dataLen == 4
+    assert responses[0][1][:4] == b"\x78\x56\x34\x12"
+    assert responses[1][0].cmdId == CmdCallbackId.CMD_PING.value
+    assert responses[1][0].errCode == 0x7F
+    assert responses[1][0].dataLen == 0
@@ -0,0 +1,68 @@
+from pathlib import Path
+from struct import pack
+
+from obc.tools.python.log_decoder import (
+    LOG_RECORD_SYNC,
+    LOG_TYPE_ERROR_CODE,
+    LOG_TYPE_MSG,
+    LogRecord,
+    build_string_table,
+    decode_records,
+    fnv1a,
+    format_record,
+)
+
+
+def _record(log_type: int, log_level: int, line: int, file_id: int, arg: int, timestamp: int) -> bytes:
+    return pack(">BBHIII", LOG_RECORD_SYNC, (log_type << 3) | log_level, line, file_id, arg, timestamp)
+
+
+def test_fnv1a():
+    # Same reference values as the OBC unit tests of logHashString
+    assert fnv1a("") == 0x811C9DC5
+    assert fnv1a("a") == 0xE40C292C
+    assert fnv1a("foobar") == 0xBF9CF968
+
+
+def test_decode_records():
+    data = _record(LOG_TYPE_ERROR_CODE, 4, 120, 0x1234, 703, 1700000000)
+    data += _record(LOG_TYPE_MSG, 2, 5, 0x5678, 0x9ABC, 1700000001)
+
+    records, skipped = decode_records(data)
+
+    assert skipped == 0
+    assert records == [
+        LogRecord(LOG_TYPE_ERROR_CODE, 4, 120, 0x1234, 703, 1700000000),
+        LogRecord(LOG_TYPE_MSG, 2, 5, 0x5678, 0x9ABC, 1700000001),
+    ]
+
+
+def test_decode_records_skips_damaged_records():
+    first = _record(LOG_TYPE_ERROR_CODE, 4, 1, 1, 1, 1)
+    second = _record(LOG_TYPE_ERROR_CODE, 5, 2, 2, 2, 2)
+    # A record with a bad sync byte, a whole one and a partial record at the end of the file
+    data = b"\x00" + first[1:] + second + first[:3]
+
+    records, skipped = decode_records(data)
+
+    assert records == [LogRecord(LOG_TYPE_ERROR_CODE, 5, 2, 2, 2, 2)]
+    assert skipped == 2
+
+
+def test_format_record_with_string_table(tmp_path: Path):
+    source = tmp_path / "obc" / "app" / "example.c"
+    source.parent.mkdir(parents=True)
+    source.write_text('void f(void) {\n  LOG_INFO("Hello from example");\n  LOG_ERROR_CODE(errCode);\n}\n')
+
+    table = build_string_table(tmp_path)
+    file_id = fnv1a("obc/app/example.c")
+    msg_id = fnv1a("Hello from example")
+    assert table.files[file_id] == "obc/app/example.c"
+    assert table.msgs[msg_id] == "Hello from example"
+
+    msg_record = LogRecord(LOG_TYPE_MSG, 2, 2, file_id, msg_id, 0)
+    assert format_record(msg_record, table) == "70-01-01_00-00-00 INFO  -> obc/app/example.c:2 - Hello from example"
+
+    # Unknown IDs are printed as hashes
+    error_record = LogRecord(LOG_TYPE_ERROR_CODE, 4, 3, 0xDEADBEEF, 703, 0)
+    assert format_record(error_record, table) == "70-01-01_00-00-00 ERROR -> file#deadbeef:3 - 703"
@@ -0,0 +1,78 @@
+import struct
+
+import pytest
+
+from interfaces.obc_gs_interface.telemetry import TelemetryDataId, unpack_telemetry_packet
+
+COMPRESSED_PACKET_MARKER = 0xC7
+
+
+def _varint(value: int) -> bytes:
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def _zigzag(value: int) -> int:
+    return (value << 1) if value >= 0 else ((-value) << 1) - 1
+
+
+def _xor_delta(value: float, prev_value: float) -> bytes:
+    delta = struct.unpack(">I", struct.pack(">f", value))[0] ^ struct.unpack(">I", struct.pack(">f", prev_value))[0]
+    if delta == 0:
+        return _varint(0)
+
+    trailing_zeros = (delta & -delta).bit_length() - 1
+    return _varint((((delta >> trailing_zeros) >> 1) << 5 | trailing_zeros) + 1)
+
+
+def test_plain_packet_unpack():
+    packet = bytes([TelemetryDataId.TELEM_OBC_TEMP]) + struct.pack(">If", 1000, 21.5)
+    packet += bytes([TelemetryDataId.TELEM_OBC_STATE]) + struct.pack(">IB", 1001, 3) + b"\x00"
+
+    data = unpack_telemetry_packet(packet)
+
+    assert len(data) == 2
+    assert data[0].id == TelemetryDataId.TELEM_OBC_TEMP
+    assert data[0].timestamp == 1000
+    assert data[0].obcTemp == 21.5
+    assert data[1].id == TelemetryDataId.TELEM_OBC_STATE
+    assert data[1].timestamp == 1001
+    assert data[1].obcState == 3
+
+
+def test_compressed_packet_unpack():
+    base = 1700000000
+    packet = bytes([COMPRESSED_PACKET_MARKER]) + struct.pack(">I", base)
+    packet += bytes([TelemetryDataId.TELEM_OBC_TEMP]) + _varint(_zigzag(0)) + _xor_delta(21.5, 0.0)
+    packet += bytes([TelemetryDataId.TELEM_OBC_STATE]) + _varint(_zigzag(60)) + bytes([2])
+    packet += bytes([TelemetryDataId.TELEM_OBC_TEMP]) + _varint(_zigzag(0)) + _xor_delta(21.625, 21.5)
+    # Out of order timestamps are a negative delta
+    packet += bytes([TelemetryDataId.TELEM_PONG]) + _varint(_zigzag(-30))
+    packet += bytes([TelemetryDataId.TELEM_OBC_TEMP]) + _varint(_zigzag(90)) + _xor_delta(21.625, 21.625)
+
+    data = unpack_telemetry_packet(packet)
+
+    assert [d.id for d in data] == [
+        TelemetryDataId.TELEM_OBC_TEMP,
+        TelemetryDataId.TELEM_OBC_STATE,
+        TelemetryDataId.TELEM_OBC_TEMP,
+        TelemetryDataId.TELEM_PONG,
+        TelemetryDataId.TELEM_OBC_TEMP,
+    ]
+    assert [d.timestamp for d in data] == [base, base + 60, base + 60, base + 30, base + 120]
+    assert data[0].obcTemp == 21.5
+    assert data[1].obcState == 2
+    assert data[2].obcTemp == 21.625
+    assert data[4].obcTemp == 21.625
+
+
+def test_truncated_compressed_packet():
+    packet = bytes([COMPRESSED_PACKET_MARKER]) + struct.pack(">I", 5)
+    packet += bytes([TelemetryDataId.TELEM_OBC_TEMP, 0x80])
+
+    with pytest.raises(ValueError):
+        unpack_telemetry_packet(packet)
@@ -0,0 +1,809 @@
+#include "sim_cc1120.h"
+#include "sim_hal.h"
+
+#include "cc1120.h"
+#include "cc1120_defs.h"
+#include "cc1120_mcu.h"
+#include "obc_board_config.h"
+#include "obc_errors.h"
+
+#include <FreeRTOS.h>
+#include <os_semphr.h>
+#include <os_stream_buffer.h>
+#include <os_task.h>
+
+#include <gio.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define RADIO_TASK_NAME "sim radio"
+#define RADIO_TASK_PRIORITY (configMAX_PRIORITIES - 1U)  // The pins are interrupts, so they preempt every task
+#define RADIO_TASK_STACK_SIZE 1024U
+#define RADIO_TASK_PERIOD_TICKS 1U
+
+#define BIT_CREDIT_PER_BYTE (8U * configTICK_RATE_HZ)  // Credit is bit rate times ticks
+
+// Enough for one tick at 1 Mbps
+#define MAX_BYTES_PER_TICK 128U
+#define MAX_EDGES_PER_TICK (4U * MAX_BYTES_PER_TICK)
+
+#define GS_RX_STREAM_SIZE 8192U
+
+#define SPI_READ_BIT 0x80U
+#define SPI_BURST_BIT 0x40U
+#define SPI_ADDR_MASK 0x3FU
+
+#define IOCFG_INV_BIT 0x40U
+#define IOCFG_SIGNAL_MASK 0x3FU
+#define SIGNAL_RXFIFO_THR 0x00U
+#define SIGNAL_RXFIFO_THR_PKT 0x01U
+#define SIGNAL_TXFIFO_THR 0x02U
+#define SIGNAL_TXFIFO_THR_PKT 0x03U
+
+#define PKT_CFG0_LENGTH_CONFIG_MASK 0x60U
+#define PKT_CFG1_CRC_CFG_MASK 0x06U
+#define CRC_BYTES 2U
+#define RFEND_CFG0_TXOFF_MODE(reg) (((reg) >> 4) & 0x3U)
+#define FIFO_CFG_FIFO_THR_MASK 0x7FU
+#define PREAMBLE_CFG1_NUM_PREAMBLE(reg) (((reg) >> 2) & 0xFU)
+#define SYNC_CFG0_SYNC_MODE(reg) (((reg) >> 2) & 0x7U)
+
+#define STATUS_STATE_SHIFT 4U
+#define RSSI0_RSSI_VALID 0x01U
+#define LQI_VAL_PKT_CRC_OK 0x80U
+#define RNDGEN_EN 0x80U
+
+// Status byte states, see table 2 in the user guide
+typedef enum {
+  STATUS_IDLE = 0,
+  STATUS_RX = 1,
+  STATUS_TX = 2,
+  STATUS_FSTXON = 3,
+  STATUS_RX_FIFO_ERR = 6,
+  STATUS_TX_FIFO_ERR = 7,
+} status_state_t;
+
+typedef enum {
+  SPI_PHASE_HEADER,
+  SPI_PHASE_EXT_ADDR,
+  SPI_PHASE_REG,
+  SPI_PHASE_FIFO,
+  SPI_PHASE_DIRECT_ADDR,
+  SPI_PHASE_DIRECT,
+  SPI_PHASE_DONE,
+} spi_phase_t;
+
+typedef struct {
+  uint8_t data[CC1120_TX_FIFO_SIZE];
+  uint32_t head;
+  uint32_t count;
+} fifo_t;
+
+typedef struct {
+  gioPORT_t *port;
+  uint32_t pin;
+} pin_event_t;
+
+typedef struct {
+  // Registers
+  uint8_t regs[CC1120_REGS_STD_SPACE_SIZE];
+  uint8_t extRegs[UINT8_MAX + 1];
+  cc1120_state_t state;
+  fifo_t txFifo;
+  fifo_t rxFifo;
+
+  // SPI transaction
+  spi_phase_t spiPhase;
+  bool spiRead;
+  bool spiBurst;
+  bool spiExt;
+  uint8_t spiAddr;
+
+  // OBC transmission
+  uint32_t txLeadBytes;     // Preamble and sync word bytes left
+  uint32_t txTrailBytes;    // CRC bytes left after the payload
+  uint32_t txPacketBytes;   // Bytes taken from the TX FIFO, including a length byte
+  uint32_t txPacketLen;     // Length byte of a variable length packet
+  bool txVariableLength;    // Latched when the packet starts
+  bool txInPacket;          // Between the sync word and the end of the packet
+
+  // Ground station transmission
+  uint8_t gsTxData[SIM_CC1120_AIR_BUFFER_SIZE];
+  uint32_t gsTxLen;
+  uint32_t gsTxPos;
+  uint32_t gsTxLeadBytes;
+  bool gsTxActive;
+  bool rxInPacket;  // The OBC heard the sync word of the current ground station transmission
+  bool syncPulse;   // The sync word was just heard
+
+  // Pins
+  bool gio0;
+  bool gio2;
+  bool gio3;
+
+  sim_cc1120_link_t link;
+  uint32_t bitCredit;
+  uint32_t rngState;
+  sim_cc1120_stats_t stats;
+} radio_t;
+
+static radio_t radio;
+
+static StaticTask_t radioTaskBuffer;
+static StackType_t radioTaskStack[RADIO_TASK_STACK_SIZE];
+
+static StreamBufferHandle_t gsRxStream;
+static StaticStreamBuffer_t gsRxStreamBuffer;
+static uint8_t gsRxStreamStorage[GS_RX_STREAM_SIZE + 1];
+
+static SemaphoreHandle_t gsTxDoneSemaphore;
+static StaticSemaphore_t gsTxDoneSemaphoreBuffer;
+
+// Work collected inside a critical section and done after it
+typedef struct {
+  pin_event_t edges[MAX_EDGES_PER_TICK];
+  uint32_t numEdges;
+  uint8_t gsRxBytes[MAX_BYTES_PER_TICK];
+  uint32_t numGsRxBytes;
+  bool gsTxDone;
+} deferred_t;
+
+static void resetRadio(void);
+static void radioTask(void *pvParameters);
+static void airByte(deferred_t *deferred);
+static void updatePins(deferred_t *deferred);
+static void runDeferred(deferred_t *deferred);
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                  FIFOs and noise                                                 */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static bool fifoPush(fifo_t *fifo, uint8_t byte) {
+  if (fifo->count == sizeof(fifo->data)) {
+    return false;
+  }
+  fifo->data[(fifo->head + fifo->count) % sizeof(fifo->data)] = byte;
+  fifo->count++;
+  return true;
+}
+
+static bool fifoPop(fifo_t *fifo, uint8_t *byte) {
+  if (fifo->count == 0) {
+    return false;
+  }
+  *byte = fifo->data[fifo->head];
+  fifo->head = (fifo->head + 1) % sizeof(fifo->data);
+  fifo->count--;
+  return true;
+}
+
+static void fifoClear(fifo_t *fifo) {
+  fifo->head = 0;
+  fifo->count = 0;
+}
+
+static uint32_t nextRandom(void) {
+  // xorshift32
+  uint32_t x = radio.rngState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  radio.rngState = x;
+  return x;
+}
+
+static uint8_t addBitErrors(uint8_t byte) {
+  if (radio.link.bitErrorRate <= 0.0) {
+    return byte;
+  }
+
+  for (uint8_t bit = 0; bit < 8U; bit++) {
+    if ((double)nextRandom() / (double)UINT32_MAX < radio.link.bitErrorRate) {
+      byte ^= (uint8_t)(1U << bit);
+      radio.stats.bitErrors++;
+    }
+  }
+  return byte;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                     Registers                                                    */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static status_state_t statusState(void) {
+  switch (radio.state) {
+    case CC1120_STATE_RX:
+      return STATUS_RX;
+    case CC1120_STATE_TX:
+      return STATUS_TX;
+    case CC1120_STATE_FSTXON:
+      return STATUS_FSTXON;
+    case CC1120_STATE_RX_FIFO_ERR:
+      return STATUS_RX_FIFO_ERR;
+    case CC1120_STATE_TX_FIFO_ERR:
+      return STATUS_TX_FIFO_ERR;
+    default:
+      return STATUS_IDLE;
+  }
+}
+
+static uint8_t statusByte(void) { return (uint8_t)(statusState() << STATUS_STATE_SHIFT); }  // CHIP_RDYn is low
+
+static uint8_t readExtReg(uint8_t addr) {
+  switch (addr) {
+    case CC1120_REGS_EXT_NUM_TXBYTES:
+      return (uint8_t)radio.txFifo.count;
+    case CC1120_REGS_EXT_NUM_RXBYTES:
+      return (uint8_t)radio.rxFifo.count;
+    case CC1120_REGS_EXT_MARCSTATE:
+      return (uint8_t)radio.state;
+    case CC1120_REGS_EXT_RSSI1:
+      return (uint8_t)radio.link.rssiDbm;
+    case CC1120_REGS_EXT_RSSI0:
+      return (radio.state == CC1120_STATE_RX) ? RSSI0_RSSI_VALID : 0U;
+    case CC1120_REGS_EXT_LQI_VAL:
+      return (uint8_t)(LQI_VAL_PKT_CRC_OK | (radio.link.lqi & 0x7FU));
+    case CC1120_REGS_EXT_RNDGEN:
+      if ((radio.extRegs[addr] & RNDGEN_EN) == 0) {
+        return radio.extRegs[addr];
+      }
+      return (uint8_t)(RNDGEN_EN | (nextRandom() & 0x7FU));
+    default:
+      return radio.extRegs[addr];
+  }
+}
+
+static uint32_t rxFifoThreshold(void) {
+  return (radio.regs[CC1120_REGS_FIFO_CFG] & FIFO_CFG_FIFO_THR_MASK) + 1U;
+}
+
+static uint32_t txFifoThreshold(void) {
+  return CC1120_TX_FIFO_SIZE - 1U - (radio.regs[CC1120_REGS_FIFO_CFG] & FIFO_CFG_FIFO_THR_MASK);
+}
+
+// Preamble and sync word sent before each packet, see PREAMBLE_CFG1 and SYNC_CFG0
+static uint32_t leadBytes(void) {
+  static const uint8_t preambleHalfBytes[] = {0, 1, 2, 3, 4, 6, 8, 10, 12, 14, 16, 24, 48, 60, 0, 0};
+  static const uint8_t syncBits[] = {0, 11, 16, 18, 24, 32, 16, 16};
+
+  uint32_t preamble = preambleHalfBytes[PREAMBLE_CFG1_NUM_PREAMBLE(radio.regs[CC1120_REGS_PREAMBLE_CFG1])];
+  uint32_t sync = syncBits[SYNC_CFG0_SYNC_MODE(radio.regs[CC1120_REGS_SYNC_CFG0])];
+  return (preamble + 1U) / 2U + (sync + 7U) / 8U;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                   State changes                                                  */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static void endTxPacket(void) {
+  radio.txInPacket = false;
+  radio.txLeadBytes = 0;
+  radio.txTrailBytes = 0;
+}
+
+static void setState(cc1120_state_t state) {
+  if (radio.state == CC1120_STATE_TX && state != CC1120_STATE_TX) {
+    endTxPacket();
+  }
+  if (radio.state == CC1120_STATE_RX && state != CC1120_STATE_RX) {
+    radio.rxInPacket = false;
+  }
+  radio.state = state;
+}
+
+static void startTx(void) {
+  setState(CC1120_STATE_TX);
+  radio.txLeadBytes = leadBytes();
+  radio.txTrailBytes = 0;
+  radio.txPacketBytes = 0;
+  radio.txPacketLen = 0;
+  radio.txVariableLength =
+      (radio.regs[CC1120_REGS_PKT_CFG0] & PKT_CFG0_LENGTH_CONFIG_MASK) == VARIABLE_PACKET_LENGTH_MODE;
+  radio.txInPacket = false;
+}
+
+static void strobe(uint8_t addr) {
+  switch (addr) {
+    case CC1120_STROBE_SRES:
+      resetRadio();
+      break;
+    case CC1120_STROBE_SFSTXON:
+      setState(CC1120_STATE_FSTXON);
+      break;
+    case CC1120_STROBE_SRX:
+      setState(CC1120_STATE_RX);
+      break;
+    case CC1120_STROBE_STX:
+      if (radio.state != CC1120_STATE_TX) {
+        startTx();
+      }
+      break;
+    case CC1120_STROBE_SIDLE:
+      setState(CC1120_STATE_IDLE);
+      break;
+    case CC1120_STROBE_SFRX:
+      fifoClear(&radio.rxFifo);
+      if (radio.state == CC1120_STATE_RX_FIFO_ERR) {
+        setState(CC1120_STATE_IDLE);
+      }
+      break;
+    case CC1120_STROBE_SFTX:
+      fifoClear(&radio.txFifo);
+      if (radio.state == CC1120_STATE_TX_FIFO_ERR) {
+        setState(CC1120_STATE_IDLE);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+static void resetRadio(void) {
+  memset(radio.regs, 0, sizeof(radio.regs));
+  memset(radio.extRegs, 0, sizeof(radio.extRegs));
+  radio.regs[CC1120_REGS_IOCFG3] = CC1120_DEFAULTS_IOCFG3;
+  radio.regs[CC1120_REGS_IOCFG2] = CC1120_DEFAULTS_IOCFG2;
+  radio.regs[CC1120_REGS_IOCFG1] = CC1120_DEFAULTS_IOCFG1;
+  radio.regs[CC1120_REGS_IOCFG0] = CC1120_DEFAULTS_IOCFG0;
+  radio.regs[CC1120_REGS_SYNC_CFG0] = CC1120_DEFAULTS_SYNC_CFG0;
+  radio.regs[CC1120_REGS_PREAMBLE_CFG1] = CC1120_DEFAULTS_PREAMBLE_CFG1;
+  radio.regs[CC1120_REGS_FIFO_CFG] = CC1120_DEFAULTS_FIFO_CFG;
+  radio.regs[CC1120_REGS_PKT_CFG1] = CC1120_DEFAULTS_PKT_CFG1;
+  radio.regs[CC1120_REGS_PKT_CFG0] = CC1120_DEFAULTS_PKT_CFG0;
+  radio.regs[CC1120_REGS_RFEND_CFG1] = CC1120_DEFAULTS_RFEND_CFG1;
+  radio.regs[CC1120_REGS_RFEND_CFG0] = CC1120_DEFAULTS_RFEND_CFG0;
+  radio.regs[CC1120_REGS_PKT_LEN] = CC1120_DEFAULTS_PKT_LEN;
+  radio.extRegs[CC1120_REGS_EXT_RNDGEN] = CC1120_EXT_DEFAULTS_RNDGEN;
+
+  fifoClear(&radio.txFifo);
+  fifoClear(&radio.rxFifo);
+  setState(CC1120_STATE_IDLE);
+  radio.spiPhase = SPI_PHASE_HEADER;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                        Air                                                       */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static bool txPacketComplete(void) {
+  if (radio.txVariableLength) {
+    return radio.txPacketBytes == radio.txPacketLen + 1U;
+  }
+
+  // Infinite packets end once the length config is switched to fixed and the byte count modulo 256 reaches PKT_LEN
+  uint8_t lengthConfig = radio.regs[CC1120_REGS_PKT_CFG0] & PKT_CFG0_LENGTH_CONFIG_MASK;
+  if (lengthConfig != FIXED_PACKET_LENGTH_MODE) {
+    return false;
+  }
+  return (radio.txPacketBytes % (CC1120_MAX_PACKET_LEN + 1U)) == radio.regs[CC1120_REGS_PKT_LEN];
+}
+
+static void finishTxPacket(void) {
+  radio.stats.txPackets++;
+
+  switch (RFEND_CFG0_TXOFF_MODE(radio.regs[CC1120_REGS_RFEND_CFG0])) {
+    case 1:
+      setState(CC1120_STATE_FSTXON);
+      break;
+    case 3:
+      setState(CC1120_STATE_RX);
+      break;
+    default:
+      setState(CC1120_STATE_IDLE);
+      break;
+  }
+}
+
+// One byte time of the OBC transmitting
+static void obcTxByte(deferred_t *deferred) {
+  radio.stats.airBytes++;
+
+  if (radio.txLeadBytes > 0) {
+    if (--radio.txLeadBytes == 0) {
+      radio.txInPacket = true;
+    }
+    return;
+  }
+
+  if (radio.txTrailBytes > 0) {
+    if (--radio.txTrailBytes == 0) {
+      finishTxPacket();
+    }
+    return;
+  }
+
+  uint8_t byte;
+  if (!fifoPop(&radio.txFifo, &byte)) {
+    radio.stats.txUnderflows++;
+    setState(CC1120_STATE_TX_FIFO_ERR);
+    return;
+  }
+
+  radio.txPacketBytes++;
+  if (radio.txVariableLength && radio.txPacketBytes == 1U) {
+    radio.txPacketLen = byte;  // The receiving radio strips the length byte
+  } else {
+    radio.stats.txBytes++;
+    if (deferred->numGsRxBytes < sizeof(deferred->gsRxBytes)) {
+      deferred->gsRxBytes[deferred->numGsRxBytes++] = addBitErrors(byte);
+    }
+  }
+
+  if (txPacketComplete()) {
+    if ((radio.regs[CC1120_REGS_PKT_CFG1] & PKT_CFG1_CRC_CFG_MASK) != 0) {
+      radio.txTrailBytes = CRC_BYTES;
+    } else {
+      finishTxPacket();
+    }
+  }
+}
+
+// One byte time of the ground station transmitting
+static void gsTxByte(deferred_t *deferred) {
+  radio.stats.airBytes++;
+
+  if (radio.gsTxLeadBytes > 0) {
+    if (--radio.gsTxLeadBytes == 0 && radio.state == CC1120_STATE_RX) {
+      radio.rxInPacket = true;
+      radio.syncPulse = true;
+      radio.stats.rxPackets++;
+    }
+    return;
+  }
+
+  uint8_t byte = addBitErrors(radio.gsTxData[radio.gsTxPos++]);
+
+  // The OBC radio never switches out of infinite packet length mode while receiving, so it keeps every byte until it
+  // leaves RX or the carrier drops
+  if (radio.state == CC1120_STATE_RX && radio.rxInPacket) {
+    if (fifoPush(&radio.rxFifo, byte)) {
+      radio.stats.rxBytes++;
+    } else {
+      radio.stats.rxOverflows++;
+      setState(CC1120_STATE_RX_FIFO_ERR);
+    }
+  } else {
+    radio.stats.rxBytesMissed++;
+  }
+
+  if (radio.gsTxPos == radio.gsTxLen) {
+    radio.gsTxActive = false;
+    radio.rxInPacket = false;
+    deferred->gsTxDone = true;
+  }
+}
+
+static void airByte(deferred_t *deferred) {
+  if (radio.state == CC1120_STATE_TX) {
+    obcTxByte(deferred);
+  } else if (radio.gsTxActive) {
+    gsTxByte(deferred);
+  }
+
+  if (radio.txFifo.count > radio.stats.txFifoHighWater) {
+    radio.stats.txFifoHighWater = radio.txFifo.count;
+  }
+  if (radio.rxFifo.count > radio.stats.rxFifoHighWater) {
+    radio.stats.rxFifoHighWater = radio.rxFifo.count;
+  }
+
+  updatePins(deferred);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                        Pins                                                       */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static bool signalLevel(uint8_t iocfg) {
+  bool level;
+  switch (iocfg & IOCFG_SIGNAL_MASK) {
+    case SIGNAL_RXFIFO_THR:
+    case SIGNAL_RXFIFO_THR_PKT:
+      level = radio.rxFifo.count >= rxFifoThreshold();
+      break;
+    case SIGNAL_TXFIFO_THR:
+    case SIGNAL_TXFIFO_THR_PKT:
+      level = radio.txFifo.count >= txFifoThreshold();
+      break;
+    case PKT_SYNC_RXTX_SIGNAL_NUM:
+      level = radio.txInPacket || radio.rxInPacket;
+      break;
+    case SYNC_EVENT_SIGNAL_NUM:
+      level = radio.syncPulse;
+      break;
+    default:
+      level = false;
+      break;
+  }
+  return level != ((iocfg & IOCFG_INV_BIT) != 0);
+}
+
+static void addEdge(deferred_t *deferred, gioPORT_t *port, uint32_t pin) {
+  // Edges while the notification is disabled are lost, as the driver expects when it reroutes a pin
+  if (deferred->numEdges < MAX_EDGES_PER_TICK && simGioIsNotificationEnabled(port, pin)) {
+    deferred->edges[deferred->numEdges].port = port;
+    deferred->edges[deferred->numEdges].pin = pin;
+    deferred->numEdges++;
+  }
+}
+
+static void samplePins(deferred_t *deferred) {
+  bool gio0 = signalLevel(radio.regs[CC1120_REGS_IOCFG0]);
+  bool gio2 = signalLevel(radio.regs[CC1120_REGS_IOCFG2]);
+  bool gio3 = signalLevel(radio.regs[CC1120_REGS_IOCFG3]);
+
+  // Edges as configured in the HAL, see obc_gio_ctrl.c
+  if (gio0 && !radio.gio0) {
+    addEdge(deferred, gioPORTB, CC1120_RX_THR_PKT_gioPORTB_PIN);
+  }
+  if (!gio2 && radio.gio2) {
+    addEdge(deferred, gioPORTA, CC1120_PKT_SYNC_RXTX_gioPORTA_PIN);
+  }
+  if (!gio3 && radio.gio3) {
+    addEdge(deferred, gioPORTA, CC1120_TX_THR_PKT_gioPORTA_PIN);
+  }
+
+  radio.gio0 = gio0;
+  radio.gio2 = gio2;
+  radio.gio3 = gio3;
+}
+
+static void updatePins(deferred_t *deferred) {
+  samplePins(deferred);
+
+  // SYNC_EVENT is a pulse
+  if (radio.syncPulse) {
+    radio.syncPulse = false;
+    samplePins(deferred);
+  }
+}
+
+static void runDeferred(deferred_t *deferred) {
+  if (deferred->numGsRxBytes > 0) {
+    xStreamBufferSend(gsRxStream, deferred->gsRxBytes, deferred->numGsRxBytes, 0);
+  }
+  if (deferred->gsTxDone) {
+    xSemaphoreGive(gsTxDoneSemaphore);
+  }
+
+  // The radio task has the highest priority, so every notification runs as an ISR would before any task resumes
+  for (uint32_t i = 0; i < deferred->numEdges; i++) {
+    gioNotification(deferred->edges[i].port, deferred->edges[i].pin);
+  }
+}
+
+static void radioTask(void *pvParameters) {
+  static deferred_t deferred;
+  TickType_t lastWake = xTaskGetTickCount();
+
+  while (1) {
+    vTaskDelayUntil(&lastWake, RADIO_TASK_PERIOD_TICKS);
+
+    memset(&deferred, 0, sizeof(deferred));
+
+    taskENTER_CRITICAL();
+    radio.bitCredit += radio.link.bitRate * RADIO_TASK_PERIOD_TICKS;
+    uint32_t bytes = 0;
+    while (radio.bitCredit >= BIT_CREDIT_PER_BYTE && bytes < MAX_BYTES_PER_TICK) {
+      radio.bitCredit -= BIT_CREDIT_PER_BYTE;
+      airByte(&deferred);
+      bytes++;
+    }
+    if (radio.bitCredit >= BIT_CREDIT_PER_BYTE) {
+      radio.bitCredit = 0;  // Faster than the simulation can go
+    }
+    taskEXIT_CRITICAL();
+
+    runDeferred(&deferred);
+  }
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                        SPI                                                       */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static uint8_t spiHeader(uint8_t header) {
+  uint8_t status = statusByte();
+  uint8_t addr = header & SPI_ADDR_MASK;
+
+  radio.spiRead = (header & SPI_READ_BIT) != 0;
+  radio.spiBurst = (header & SPI_BURST_BIT) != 0;
+  radio.spiExt = false;
+
+  if (addr >= CC1120_STROBE_SRES && addr <= CC1120_STROBE_SNOP) {
+    strobe(addr);
+    radio.spiPhase = SPI_PHASE_DONE;
+  } else if (addr == CC1120_REGS_EXT_ADDR) {
+    radio.spiPhase = SPI_PHASE_EXT_ADDR;
+  } else if (addr == CC1120_REGS_FIFO_ACCESS_STD) {
+    radio.spiPhase = SPI_PHASE_FIFO;
+  } else if (addr == CC1120_REGS_FIFO_ACCESS_DIR) {
+    radio.spiPhase = SPI_PHASE_DIRECT_ADDR;
+  } else {
+    radio.spiAddr = addr;
+    radio.spiPhase = SPI_PHASE_REG;
+  }
+
+  return status;
+}
+
+static uint8_t spiRegData(uint8_t outb) {
+  uint8_t inb;
+
+  if (radio.spiRead) {
+    inb = radio.spiExt ? readExtReg(radio.spiAddr) : radio.regs[radio.spiAddr];
+  } else {
+    inb = statusByte();
+    if (radio.spiExt) {
+      radio.extRegs[radio.spiAddr] = outb;
+    } else if (radio.spiAddr < CC1120_REGS_STD_SPACE_SIZE) {
+      radio.regs[radio.spiAddr] = outb;
+    }
+  }
+
+  if (!radio.spiBurst) {
+    radio.spiPhase = SPI_PHASE_DONE;
+  } else if (radio.spiExt || radio.spiAddr + 1U < CC1120_REGS_STD_SPACE_SIZE) {
+    radio.spiAddr++;
+  }
+
+  return inb;
+}
+
+static uint8_t spiFifoData(uint8_t outb) {
+  uint8_t inb;
+
+  if (radio.spiRead) {
+    if (!fifoPop(&radio.rxFifo, &inb)) {
+      radio.stats.rxUnderflows++;
+      inb = 0;
+    }
+  } else {
+    inb = statusByte();
+    if (!fifoPush(&radio.txFifo, outb)) {
+      radio.stats.txOverflows++;
+    }
+  }
+
+  if (!radio.spiBurst) {
+    radio.spiPhase = SPI_PHASE_DONE;
+  }
+
+  return inb;
+}
+
+static uint8_t spiTransfer(uint8_t outb) {
+  switch (radio.spiPhase) {
+    case SPI_PHASE_HEADER:
+      return spiHeader(outb);
+    case SPI_PHASE_EXT_ADDR:
+      radio.spiAddr = outb;
+      radio.spiExt = true;
+      radio.spiPhase = SPI_PHASE_REG;
+      return 0;
+    case SPI_PHASE_REG:
+      return spiRegData(outb);
+    case SPI_PHASE_FIFO:
+      return spiFifoData(outb);
+    case SPI_PHASE_DIRECT_ADDR:
+      // Direct FIFO access is not used by the flight software; the bytes are accepted and read back as 0
+      radio.spiPhase = SPI_PHASE_DIRECT;
+      return 0;
+    default:
+      return 0;
+  }
+}
+
+obc_error_code_t mcuCC1120SpiTransfer(uint8_t outb, uint8_t *inb) {
+  if (inb == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  taskENTER_CRITICAL();
+  *inb = spiTransfer(outb);
+  taskEXIT_CRITICAL();
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t mcuCC1120CSAssert(void) {
+  taskENTER_CRITICAL();
+  radio.spiPhase = SPI_PHASE_HEADER;
+  taskEXIT_CRITICAL();
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t mcuCC1120CSDeassert(void) {
+  static deferred_t deferred;
+
+  // A transaction can move a pin, e.g. flushing the TX FIFO drops TXFIFO_THR
+  taskENTER_CRITICAL();
+  memset(&deferred, 0, sizeof(deferred));
+  radio.spiPhase = SPI_PHASE_HEADER;
+  updatePins(&deferred);
+  taskEXIT_CRITICAL();
+
+  runDeferred(&deferred);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                    Public API                                                    */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+void simCc1120Init(const sim_cc1120_link_t *link) {
+  memset(&radio, 0, sizeof(radio));
+  radio.link = *link;
+  radio.rngState = 0x12345678U;
+  resetRadio();
+
+  gsRxStream = xStreamBufferCreateStatic(GS_RX_STREAM_SIZE, 1, gsRxStreamStorage, &gsRxStreamBuffer);
+  gsTxDoneSemaphore = xSemaphoreCreateBinaryStatic(&gsTxDoneSemaphoreBuffer);
+
+  xTaskCreateStatic(radioTask, RADIO_TASK_NAME, RADIO_TASK_STACK_SIZE, NULL, RADIO_TASK_PRIORITY, radioTaskStack,
+                    &radioTaskBuffer);
+}
+
+void simCc1120SetLink(const sim_cc1120_link_t *link) {
+  taskENTER_CRITICAL();
+  radio.link = *link;
+  taskEXIT_CRITICAL();
+}
+
+void simCc1120GetLink(sim_cc1120_link_t *link) {
+  taskENTER_CRITICAL();
+  *link = radio.link;
+  taskEXIT_CRITICAL();
+}
+
+void simCc1120GetStats(sim_cc1120_stats_t *stats) {
+  taskENTER_CRITICAL();
+  *stats = radio.stats;
+  taskEXIT_CRITICAL();
+}
+
+bool simCc1120IsListening(void) {
+  taskENTER_CRITICAL();
+  bool listening = radio.state == CC1120_STATE_RX && !radio.gsTxActive;
+  taskEXIT_CRITICAL();
+  return listening;
+}
+
+BaseType_t simCc1120GsTransmit(const uint8_t *data, uint32_t len, TickType_t listenTimeout) {
+  if (data == NULL || len == 0 || len > SIM_CC1120_AIR_BUFFER_SIZE) {
+    return pdFAIL;
+  }
+
+  // The ground station only keys up once the OBC is waiting for it
+  TickType_t start = xTaskGetTickCount();
+  while (!simCc1120IsListening()) {
+    if (xTaskGetTickCount() - start >= listenTimeout) {
+      return pdFAIL;
+    }
+    vTaskDelay(1);
+  }
+
+  xSemaphoreTake(gsTxDoneSemaphore, 0);
+
+  taskENTER_CRITICAL();
+  memcpy(radio.gsTxData, data, len);
+  radio.gsTxLen = len;
+  radio.gsTxPos = 0;
+  radio.gsTxLeadBytes = leadBytes();
+  radio.gsTxActive = true;
+  taskEXIT_CRITICAL();
+
+  xSemaphoreTake(gsTxDoneSemaphore, portMAX_DELAY);
+  return pdPASS;
+}
+
+uint32_t simCc1120GsReceive(uint8_t *buf, uint32_t maxLen, TickType_t timeout) {
+  if (buf == NULL || maxLen == 0) {
+    return 0;
+  }
+  return (uint32_t)xStreamBufferReceive(gsRxStream, buf, maxLen, timeout);
+}
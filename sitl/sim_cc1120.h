@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+ * Simulated CC1120. It sits under the real cc1120.c driver: the mcuCC1120* SPI functions are implemented here and
+ * decoded into register, FIFO and strobe accesses. A radio task moves bytes between the FIFOs and the air at the link
+ * bit rate and raises GIO0, GIO2 and GIO3 edges through the real gioNotification, as the pins wired to the RM46 would.
+ *
+ * The other end of the link is the simulated ground station, which sends whole transmissions and reads back the
+ * payload of every packet the OBC sends.
+ */
+
+#include <FreeRTOS.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SIM_CC1120_DEFAULT_BIT_RATE 9600U
+#define SIM_CC1120_AIR_BUFFER_SIZE 4096U  // Longest ground station transmission
+
+typedef struct {
+  uint32_t bitRate;     // Bits per second in both directions
+  int8_t rssiDbm;       // Reported by RSSI1 while receiving
+  uint8_t lqi;          // Reported by LQI_VAL while receiving; lower is better
+  double bitErrorRate;  // Probability of each bit on the air being flipped
+} sim_cc1120_link_t;
+
+typedef struct {
+  uint32_t txPackets;      // Packets the OBC finished sending
+  uint32_t txBytes;        // Payload bytes the OBC sent
+  uint32_t txUnderflows;   // Packets cut short because the TX FIFO ran dry
+  uint32_t rxPackets;      // Ground station transmissions the OBC heard the sync word of
+  uint32_t rxBytes;        // Bytes put in the RX FIFO
+  uint32_t rxOverflows;    // Transmissions cut short because the RX FIFO was full
+  uint32_t rxBytesMissed;  // Ground station bytes sent while the OBC was not receiving
+  uint32_t rxUnderflows;   // Reads of an empty RX FIFO
+  uint32_t txOverflows;    // Writes to a full TX FIFO
+  uint32_t bitErrors;      // Bits flipped on the air
+  uint32_t txFifoHighWater;
+  uint32_t rxFifoHighWater;
+  uint32_t airBytes;  // Byte times either end was transmitting, including preambles and sync words
+} sim_cc1120_stats_t;
+
+/**
+ * @brief Resets the radio and creates its task
+ *
+ * @param link Initial link conditions
+ */
+void simCc1120Init(const sim_cc1120_link_t *link);
+
+/**
+ * @brief Changes the link conditions; takes effect from the next byte on the air
+ */
+void simCc1120SetLink(const sim_cc1120_link_t *link);
+
+void simCc1120GetLink(sim_cc1120_link_t *link);
+
+void simCc1120GetStats(sim_cc1120_stats_t *stats);
+
+/**
+ * @brief Whether the OBC radio is in RX with nothing on the air, so a ground station transmission would be heard
+ */
+bool simCc1120IsListening(void);
+
+/**
+ * @brief Sends one ground station transmission to the OBC
+ *
+ * Blocks until the OBC is listening and the whole transmission has been on the air.
+ *
+ * @param data Bytes to send after the preamble and sync word
+ * @param len Number of bytes in data, at most SIM_CC1120_AIR_BUFFER_SIZE
+ * @param listenTimeout How long to wait for the OBC to start listening
+ * @return pdPASS if the transmission was sent, pdFAIL if the OBC never listened
+ */
+BaseType_t simCc1120GsTransmit(const uint8_t *data, uint32_t len, TickType_t listenTimeout);
+
+/**
+ * @brief Reads payload bytes of packets sent by the OBC, in the order they came off the air
+ *
+ * @param buf Buffer for the bytes
+ * @param maxLen Size of buf
+ * @param timeout How long to wait for the first byte
+ * @return The number of bytes read
+ */
+uint32_t simCc1120GsReceive(uint8_t *buf, uint32_t maxLen, TickType_t timeout);
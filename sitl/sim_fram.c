@@ -0,0 +1,118 @@
+#include "sim_fram.h"
+
+#include "fm25v20a.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define FRAM_SIZE (FRAM_MAX_ADDRESS + 1U)
+
+// Manufacturer ID: 6 bytes of continuation code, then Cypress and the FM25V20A family and density
+static const uint8_t framId[FRAM_ID_LEN] = {0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xC2, 0x25, 0x08};
+
+static uint8_t framMemory[FRAM_SIZE];
+static uint8_t framStatusReg;
+static bool isAsleep;
+
+static sim_fram_stats_t stats;
+
+void simFramGetStats(sim_fram_stats_t *out) {
+  taskENTER_CRITICAL();
+  *out = stats;
+  taskEXIT_CRITICAL();
+}
+
+static obc_error_code_t checkRange(uint32_t addr, size_t nBytes) {
+  if (addr > FRAM_MAX_ADDRESS || nBytes > FRAM_SIZE - addr) {
+    return OBC_ERR_CODE_FRAM_ADDRESS_OUT_OF_RANGE;
+  }
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+void initFRAM(void) { isAsleep = false; }
+
+obc_error_code_t framReadStatusReg(uint8_t *status) {
+  if (status == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+  if (isAsleep) {
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+  *status = framStatusReg;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framWriteStatusReg(uint8_t status) {
+  if (isAsleep) {
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+  framStatusReg = status;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framRead(uint32_t addr, uint8_t *buffer, size_t nBytes) {
+  obc_error_code_t errCode;
+  if (buffer == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+  RETURN_IF_ERROR_CODE(checkRange(addr, nBytes));
+  if (isAsleep) {
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+
+  taskENTER_CRITICAL();
+  memcpy(buffer, &framMemory[addr], nBytes);
+  stats.reads++;
+  stats.bytesRead += nBytes;
+  taskEXIT_CRITICAL();
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framFastRead(uint32_t addr, uint8_t *buffer, size_t nBytes) { return framRead(addr, buffer, nBytes); }
+
+obc_error_code_t framWrite(uint32_t addr, const uint8_t *data, size_t nBytes) {
+  obc_error_code_t errCode;
+  if (data == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+  RETURN_IF_ERROR_CODE(checkRange(addr, nBytes));
+  if (isAsleep) {
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+
+  taskENTER_CRITICAL();
+  memcpy(&framMemory[addr], data, nBytes);
+  stats.writes++;
+  stats.bytesWritten += nBytes;
+  taskEXIT_CRITICAL();
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framSleep(void) {
+  isAsleep = true;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framWakeUp(void) {
+  isAsleep = false;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framReadID(uint8_t *id, size_t nBytes) {
+  if (id == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+  if (isAsleep) {
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+  memcpy(id, framId, (nBytes < FRAM_ID_LEN) ? nBytes : FRAM_ID_LEN);
+  return OBC_ERR_CODE_SUCCESS;
+}
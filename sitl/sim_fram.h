@@ -0,0 +1,17 @@
+#pragma once
+
+/*
+ * Simulated FM25V20A. The fm25v20a.h API is implemented over RAM; contents start erased to 0 on every run, as the
+ * persistent sections would be on a fresh board.
+ */
+
+#include <stdint.h>
+
+typedef struct {
+  uint32_t reads;
+  uint32_t writes;
+  uint32_t bytesRead;
+  uint32_t bytesWritten;
+} sim_fram_stats_t;
+
+void simFramGetStats(sim_fram_stats_t *stats);
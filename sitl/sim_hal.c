@@ -0,0 +1,194 @@
+#include "sim_hal.h"
+
+#include "obc_errors.h"
+#include "obc_digital_watchdog.h"
+#include "obc_privilege.h"
+#include "obc_reset.h"
+#include "obc_sci_io.h"
+#include "obc_spi_io.h"
+#include "rffm6404.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include <gio.h>
+#include <sci.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define GIO_PINS_PER_PORT 8U
+
+typedef struct {
+  uint32_t levels;
+  uint32_t notificationsEnabled;
+} sim_gio_port_t;
+
+static sim_gio_port_t gioPortAState;
+static sim_gio_port_t gioPortBState;
+
+static FILE *uartLogFile;
+static uint32_t uartBytes;
+
+// Replaced at startup with bytes from the CC1120 random number generator, as on the OBC
+void *__stack_chk_guard = (void *)0xDEADBEEF;
+
+void simHalInit(FILE *uartLog) { uartLogFile = uartLog; }
+
+uint32_t simHalGetUartBytes(void) { return uartBytes; }
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                        GIO                                                       */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static sim_gio_port_t *getPortState(gioPORT_t *port) {
+  if (port == gioPORTA) {
+    return &gioPortAState;
+  }
+  if (port == gioPORTB) {
+    return &gioPortBState;
+  }
+  return NULL;
+}
+
+bool simGioIsNotificationEnabled(gioPORT_t *port, uint32 bit) {
+  sim_gio_port_t *state = getPortState(port);
+  return state != NULL && bit < GIO_PINS_PER_PORT && (state->notificationsEnabled & (1U << bit)) != 0;
+}
+
+void gioSetBit(gioPORT_t *port, uint32 bit, uint32 value) {
+  sim_gio_port_t *state = getPortState(port);
+  if (state == NULL || bit >= GIO_PINS_PER_PORT) {
+    return;
+  }
+
+  if (value) {
+    state->levels |= (1U << bit);
+  } else {
+    state->levels &= ~(1U << bit);
+  }
+}
+
+void gioSetPort(gioPORT_t *port, uint32 value) {
+  sim_gio_port_t *state = getPortState(port);
+  if (state != NULL) {
+    state->levels = value;
+  }
+}
+
+uint32 gioGetBit(gioPORT_t *port, uint32 bit) {
+  sim_gio_port_t *state = getPortState(port);
+  if (state == NULL || bit >= GIO_PINS_PER_PORT) {
+    return 0;
+  }
+  return (state->levels >> bit) & 1U;
+}
+
+void gioToggleBit(gioPORT_t *port, uint32 bit) { gioSetBit(port, bit, gioGetBit(port, bit) ^ 1U); }
+
+void gioEnableNotification(gioPORT_t *port, uint32 bit) {
+  sim_gio_port_t *state = getPortState(port);
+  if (state != NULL && bit < GIO_PINS_PER_PORT) {
+    taskENTER_CRITICAL();
+    state->notificationsEnabled |= (1U << bit);
+    taskEXIT_CRITICAL();
+  }
+}
+
+void gioDisableNotification(gioPORT_t *port, uint32 bit) {
+  sim_gio_port_t *state = getPortState(port);
+  if (state != NULL && bit < GIO_PINS_PER_PORT) {
+    taskENTER_CRITICAL();
+    state->notificationsEnabled &= ~(1U << bit);
+    taskEXIT_CRITICAL();
+  }
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                        SCI                                                       */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+void initSciMutex(void) {}
+
+void sciSetBaudrate(sciBASE_t *sci, uint32 baud) {}
+
+obc_error_code_t sciSendBytes(uint8_t *buf, size_t numBytes, TickType_t uartMutexTimeoutTicks, sciBASE_t *sciReg) {
+  if (buf == NULL || numBytes < 1) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  taskENTER_CRITICAL();
+  if (uartLogFile != NULL) {
+    fwrite(buf, 1, numBytes, uartLogFile);
+  }
+  uartBytes += numBytes;
+  taskEXIT_CRITICAL();
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t sciReadBytes(uint8_t *buf, size_t numBytes, TickType_t uartMutexTimeoutTicks, size_t blockTimeTicks,
+                              sciBASE_t *sciReg) {
+  if (buf == NULL || numBytes < 1) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  // Nothing is ever sent to the OBC over the UART
+  vTaskDelay(blockTimeTicks == portMAX_DELAY ? portMAX_DELAY : (TickType_t)blockTimeTicks);
+  return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+}
+
+obc_error_code_t sciStartStreamReceive(sciBASE_t *sciReg, sci_rx_byte_handler_t handler,
+                                       TickType_t uartMutexTimeoutTicks) {
+  if (handler == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                        SPI                                                       */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+// The CC1120 is the only SPI device left; sim_cc1120.c implements its transfers directly
+
+void initSpiMutex(void) {}
+
+obc_error_code_t assertChipSelect(gioPORT_t *spiPort, uint8_t csNum) { return OBC_ERR_CODE_SUCCESS; }
+
+obc_error_code_t deassertChipSelect(gioPORT_t *spiPort, uint8_t csNum) { return OBC_ERR_CODE_SUCCESS; }
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                      System                                                      */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+void initDigitalWatchdog(void) {}
+
+void feedDigitalWatchdog(void) {}
+
+BaseType_t prvRaisePrivilege(void) { return pdTRUE; }
+
+void resetSystem(obc_reset_reason_t reason) {
+  // A reset ends the run; the scenario cannot continue against a rebooted OBC
+  fprintf(stderr, "OBC reset, reason %d\n", (int)reason);
+  if (uartLogFile != NULL) {
+    fflush(uartLogFile);
+  }
+  exit(EXIT_FAILURE);
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                     RFFM6404                                                     */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+// The front end only switches the antenna path, which the simulated link does not model
+
+obc_error_code_t rffm6404ActivateRx(void) { return OBC_ERR_CODE_SUCCESS; }
+
+obc_error_code_t rffm6404ActivateTx(float voltagePowerControl) { return OBC_ERR_CODE_SUCCESS; }
+
+obc_error_code_t rffm6404ActivateRecvByp(void) { return OBC_ERR_CODE_SUCCESS; }
+
+obc_error_code_t rffm6404PowerOff(void) { return OBC_ERR_CODE_SUCCESS; }
@@ -0,0 +1,30 @@
+#pragma once
+
+/*
+ * Stand-ins for the RM46 HAL and the bus drivers in obc/app/drivers/rm46. Pins only remember their level and whether
+ * their notification is enabled; the simulated devices raise edges by calling gioNotification themselves. Everything
+ * the OBC prints over the UART is appended to a log file.
+ */
+
+#include <gio.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @brief Sets where UART output goes
+ *
+ * @param uartLog Open file for everything sent over the UART, or NULL to drop it
+ */
+void simHalInit(FILE *uartLog);
+
+/**
+ * @brief Whether a pin edge would reach gioNotification, as set by gioEnableNotification and gioDisableNotification
+ */
+bool simGioIsNotificationEnabled(gioPORT_t *port, uint32 bit);
+
+/**
+ * @brief Number of bytes sent over the UART so far
+ */
+uint32_t simHalGetUartBytes(void);
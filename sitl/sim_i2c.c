@@ -0,0 +1,244 @@
+#include "sim_i2c.h"
+
+#include "ds3232_mz.h"
+#include "lm75bd.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+#include "obc_i2c_io.h"
+#include "obc_time_utils.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define DS3232_I2C_ADDRESS 0x68U
+#define DS3232_REG_COUNT 0x14U
+#define DS3232_DATE_TIME_REG_COUNT 7U
+#define DS3232_REG_DAY 3U
+#define DS3232_REG_TEMP_MSB 0x11U
+#define DS3232_HOURS_24_MASK 0x3FU
+
+#define LM75BD_REG_COUNT 4U
+#define LM75BD_REG_TEMP 0x00U
+#define LM75BD_REG_WIDTH 2U  // Every register but the configuration register is 16 bits
+#define LM75BD_TEMP_RES 0.125f
+
+#define BOARD_TEMP_CELSIUS 25U
+
+typedef struct {
+  uint8_t regs[DS3232_REG_COUNT];
+  int64_t offsetSeconds;  // Added to the start time and the tick count
+  uint8_t pointer;
+} sim_ds3232_t;
+
+typedef struct {
+  uint8_t regs[LM75BD_REG_COUNT][LM75BD_REG_WIDTH];
+  uint8_t pointer;
+} sim_lm75bd_t;
+
+static uint32_t rtcStartUnixTime;
+static sim_ds3232_t ds3232;
+static sim_lm75bd_t lm75bd;
+static sim_i2c_stats_t stats;
+
+static uint8_t toBCD(uint8_t value) { return (uint8_t)(((value / 10U) << 4) | (value % 10U)); }
+
+static uint8_t fromBCD(uint8_t bcd) { return (uint8_t)((bcd >> 4) * 10U + (bcd & 0x0FU)); }
+
+static uint32_t rtcNow(void) {
+  return (uint32_t)((int64_t)rtcStartUnixTime + (int64_t)(xTaskGetTickCount() / configTICK_RATE_HZ) +
+                    ds3232.offsetSeconds);
+}
+
+// Copies the counting time into the time registers, as the DS3232 does on every START condition
+static void latchTime(void) {
+  rtc_date_time_t dateTime = {0};
+  unixToDatetime(rtcNow(), &dateTime);
+
+  ds3232.regs[0] = toBCD(dateTime.time.seconds);
+  ds3232.regs[1] = toBCD(dateTime.time.minutes);
+  ds3232.regs[2] = toBCD(dateTime.time.hours);
+  ds3232.regs[DS3232_REG_DAY] = 1;
+  ds3232.regs[4] = toBCD(dateTime.date.date);
+  ds3232.regs[5] = toBCD(dateTime.date.month);
+  ds3232.regs[6] = toBCD(dateTime.date.year);
+}
+
+// A write to the time registers restarts the count from the written time
+static void restartTime(void) {
+  rtc_date_time_t dateTime = {
+      .date = {.date = fromBCD(ds3232.regs[4]), .month = fromBCD(ds3232.regs[5]), .year = fromBCD(ds3232.regs[6])},
+      .time = {.hours = fromBCD(ds3232.regs[2] & DS3232_HOURS_24_MASK),
+               .minutes = fromBCD(ds3232.regs[1]),
+               .seconds = fromBCD(ds3232.regs[0])},
+  };
+
+  uint32_t written;
+  if (datetimeToUnix(&dateTime, &written) == OBC_ERR_CODE_SUCCESS) {
+    ds3232.offsetSeconds += (int64_t)written - (int64_t)rtcNow();
+  }
+}
+
+static void setLm75bdTemp(float celsius) {
+  int16_t value = (int16_t)(celsius / LM75BD_TEMP_RES);
+  uint16_t reg = (uint16_t)((uint16_t)value << 5);  // 11 bits, left aligned
+
+  lm75bd.regs[LM75BD_REG_TEMP][0] = (uint8_t)(reg >> 8);
+  lm75bd.regs[LM75BD_REG_TEMP][1] = (uint8_t)reg;
+}
+
+void simI2cInit(uint32_t startUnixTime, float obcTempCelsius) {
+  rtcStartUnixTime = startUnixTime;
+  memset(&ds3232, 0, sizeof(ds3232));
+  memset(&lm75bd, 0, sizeof(lm75bd));
+  memset(&stats, 0, sizeof(stats));
+
+  ds3232.regs[DS3232_REG_TEMP_MSB] = BOARD_TEMP_CELSIUS;
+  setLm75bdTemp(obcTempCelsius);
+}
+
+void simI2cSetObcTemp(float celsius) {
+  taskENTER_CRITICAL();
+  setLm75bdTemp(celsius);
+  taskEXIT_CRITICAL();
+}
+
+void simI2cGetStats(sim_i2c_stats_t *out) {
+  taskENTER_CRITICAL();
+  *out = stats;
+  taskEXIT_CRITICAL();
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                      Devices                                                     */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static bool isPresent(uint8_t sAddr) { return sAddr == DS3232_I2C_ADDRESS || sAddr == LM75BD_OBC_I2C_ADDR; }
+
+// The first byte of every write sets the register pointer; the rest are written from there
+static void deviceWrite(uint8_t sAddr, const uint8_t *data, uint16_t size) {
+  if (size == 0) {
+    return;
+  }
+
+  if (sAddr == DS3232_I2C_ADDRESS) {
+    ds3232.pointer = data[0] % DS3232_REG_COUNT;
+    if (size == 1) {
+      return;
+    }
+
+    latchTime();
+    bool timeWritten = false;
+    for (uint16_t i = 1; i < size; i++) {
+      timeWritten |= ds3232.pointer < DS3232_DATE_TIME_REG_COUNT;
+      ds3232.regs[ds3232.pointer] = data[i];
+      ds3232.pointer = (ds3232.pointer + 1U) % DS3232_REG_COUNT;
+    }
+    if (timeWritten) {
+      restartTime();
+    }
+  } else if (sAddr == LM75BD_OBC_I2C_ADDR) {
+    lm75bd.pointer = data[0] % LM75BD_REG_COUNT;
+    // The temperature register is read only
+    if (lm75bd.pointer != LM75BD_REG_TEMP) {
+      for (uint16_t i = 1; i < size && i <= LM75BD_REG_WIDTH; i++) {
+        lm75bd.regs[lm75bd.pointer][i - 1U] = data[i];
+      }
+    }
+  }
+}
+
+static void deviceRead(uint8_t sAddr, uint8_t *data, uint16_t size) {
+  if (sAddr == DS3232_I2C_ADDRESS) {
+    latchTime();
+    for (uint16_t i = 0; i < size; i++) {
+      data[i] = ds3232.regs[ds3232.pointer];
+      ds3232.pointer = (ds3232.pointer + 1U) % DS3232_REG_COUNT;
+    }
+  } else if (sAddr == LM75BD_OBC_I2C_ADDR) {
+    // The LM75BD keeps reading the same register
+    for (uint16_t i = 0; i < size; i++) {
+      data[i] = lm75bd.regs[lm75bd.pointer][i % LM75BD_REG_WIDTH];
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                     I2C driver                                                   */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+void initI2CMutex(void) {}
+
+obc_error_code_t i2cSendTo(uint8_t sAddr, uint16_t size, uint8_t *buf, TickType_t mutexTimeoutTicks,
+                           TickType_t transferTimeoutTicks) {
+  if (buf == NULL || size < 1) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  obc_error_code_t errCode = OBC_ERR_CODE_SUCCESS;
+  taskENTER_CRITICAL();
+  stats.transactions++;
+  if (isPresent(sAddr)) {
+    stats.bytes += size;
+    deviceWrite(sAddr, buf, size);
+  } else {
+    stats.nacks++;
+    errCode = OBC_ERR_CODE_I2C_FAILURE;
+  }
+  taskEXIT_CRITICAL();
+
+  return errCode;
+}
+
+obc_error_code_t i2cReceiveFrom(uint8_t sAddr, uint16_t size, uint8_t *buf, TickType_t transferTimeoutTicks,
+                                TickType_t mutexTimeoutTicks) {
+  if (buf == NULL || size < 1) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  obc_error_code_t errCode = OBC_ERR_CODE_SUCCESS;
+  taskENTER_CRITICAL();
+  stats.transactions++;
+  if (isPresent(sAddr)) {
+    stats.bytes += size;
+    deviceRead(sAddr, buf, size);
+  } else {
+    stats.nacks++;
+    errCode = OBC_ERR_CODE_I2C_FAILURE;
+  }
+  taskEXIT_CRITICAL();
+
+  return errCode;
+}
+
+obc_error_code_t i2cReadReg(uint8_t sAddr, uint8_t reg, uint8_t *data, uint16_t numBytes,
+                            TickType_t transferTimeoutTicks) {
+  obc_error_code_t errCode;
+
+  if (data == NULL || numBytes < 1) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  RETURN_IF_ERROR_CODE(i2cSendTo(sAddr, 1, &reg, portMAX_DELAY, transferTimeoutTicks));
+  RETURN_IF_ERROR_CODE(i2cReceiveFrom(sAddr, numBytes, data, transferTimeoutTicks, portMAX_DELAY));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t i2cWriteReg(uint8_t sAddr, uint8_t reg, uint8_t *data, uint8_t numBytes) {
+  obc_error_code_t errCode;
+  uint8_t buf[UINT8_MAX + 1U];
+
+  if (data == NULL || numBytes < 1) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  buf[0] = reg;
+  memcpy(&buf[1], data, numBytes);
+  RETURN_IF_ERROR_CODE(i2cSendTo(sAddr, numBytes + 1U, buf, portMAX_DELAY, portMAX_DELAY));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+/*
+ * Simulated I2C bus with the DS3232 RTC and the LM75BD temperature sensor on it. The RTC counts from the host time at
+ * startup with the scheduler tick, so it agrees with the OBC's own tick based time; writes to its time registers move
+ * it like a real RTC sync would. Alarms are stored but never fire.
+ */
+
+#include <stdint.h>
+
+typedef struct {
+  uint32_t transactions;
+  uint32_t nacks;  // Transactions to an address with nothing on it
+  uint32_t bytes;
+} sim_i2c_stats_t;
+
+/**
+ * @param startUnixTime Time on the RTC when the scheduler starts
+ * @param obcTempCelsius Temperature the LM75BD reports
+ */
+void simI2cInit(uint32_t startUnixTime, float obcTempCelsius);
+
+void simI2cSetObcTemp(float celsius);
+
+void simI2cGetStats(sim_i2c_stats_t *stats);
@@ -0,0 +1,160 @@
+#include "sim_sdcard.h"
+
+#include "sdc_diskio.h"
+
+#include <FreeRTOS.h>
+#include <os_semphr.h>
+#include <os_task.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define US_PER_MS 1000U
+
+static FILE *imageFile;
+static uint32_t numSectors;
+static uint32_t usPerSector;
+static DSTATUS status = STA_NOINIT | STA_NODISK;
+
+static SemaphoreHandle_t cardMutex;
+static StaticSemaphore_t cardMutexBuffer;
+
+static sim_sdcard_stats_t stats;
+
+bool simSdCardInit(const char *imagePath, uint32_t sectorCount, uint32_t sectorUs) {
+  imageFile = fopen(imagePath, "r+b");
+  if (imageFile == NULL) {
+    imageFile = fopen(imagePath, "w+b");
+  }
+  if (imageFile == NULL) {
+    return false;
+  }
+
+  // Grow the image so every sector reads back, as blank sectors would on a card
+  if (fseek(imageFile, 0, SEEK_END) != 0) {
+    return false;
+  }
+  long size = ftell(imageFile);
+  long fullSize = (long)sectorCount * SIM_SDCARD_SECTOR_SIZE;
+  if (size < fullSize) {
+    if (fseek(imageFile, fullSize - 1, SEEK_SET) != 0 || fputc(0, imageFile) == EOF) {
+      return false;
+    }
+  }
+
+  numSectors = sectorCount;
+  usPerSector = sectorUs;
+  cardMutex = xSemaphoreCreateMutexStatic(&cardMutexBuffer);
+  status = STA_NOINIT;
+  return true;
+}
+
+void simSdCardGetStats(sim_sdcard_stats_t *out) {
+  taskENTER_CRITICAL();
+  *out = stats;
+  taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Holds the caller for the time count sectors take on the bus; the card mutex stays taken, as the SPI bus
+ * would be
+ */
+static void waitForTransfer(uint32_t count) {
+  TickType_t ticks = pdMS_TO_TICKS((count * usPerSector + US_PER_MS - 1U) / US_PER_MS);
+  if (ticks > 0) {
+    vTaskDelay(ticks);
+  }
+  stats.busyMs += (count * usPerSector) / US_PER_MS;
+}
+
+DSTATUS disk_initialize(uint8_t pdrv) {
+  if (pdrv != 0) {
+    return STA_NOINIT;
+  }
+  if (imageFile != NULL) {
+    status &= ~STA_NOINIT;
+  }
+  return status;
+}
+
+DSTATUS disk_status(uint8_t pdrv) { return (pdrv != 0) ? STA_NOINIT : status; }
+
+DRESULT disk_read(uint8_t pdrv, uint8_t *buff, uint32_t sector, uint32_t count) {
+  if (pdrv != 0 || buff == NULL || count == 0 || sector >= numSectors || count > numSectors - sector) {
+    return RES_PARERR;
+  }
+  if (status & STA_NOINIT) {
+    return RES_NOTRDY;
+  }
+
+  DRESULT res = RES_OK;
+  xSemaphoreTake(cardMutex, portMAX_DELAY);
+  if (fseek(imageFile, (long)sector * SIM_SDCARD_SECTOR_SIZE, SEEK_SET) != 0 ||
+      fread(buff, SIM_SDCARD_SECTOR_SIZE, count, imageFile) != count) {
+    res = RES_ERROR;
+  } else {
+    stats.reads++;
+    stats.sectorsRead += count;
+    waitForTransfer(count);
+  }
+  xSemaphoreGive(cardMutex);
+
+  return res;
+}
+
+DRESULT disk_write(uint8_t pdrv, const uint8_t *buff, uint32_t sector, uint32_t count) {
+  if (pdrv != 0 || buff == NULL || count == 0 || sector >= numSectors || count > numSectors - sector) {
+    return RES_PARERR;
+  }
+  if (status & STA_NOINIT) {
+    return RES_NOTRDY;
+  }
+
+  DRESULT res = RES_OK;
+  xSemaphoreTake(cardMutex, portMAX_DELAY);
+  if (fseek(imageFile, (long)sector * SIM_SDCARD_SECTOR_SIZE, SEEK_SET) != 0 ||
+      fwrite(buff, SIM_SDCARD_SECTOR_SIZE, count, imageFile) != count) {
+    res = RES_ERROR;
+  } else {
+    stats.writes++;
+    stats.sectorsWritten += count;
+    waitForTransfer(count);
+  }
+  xSemaphoreGive(cardMutex);
+
+  return res;
+}
+
+DRESULT disk_ioctl(uint8_t pdrv, uint8_t cmd, void *buff) {
+  if (pdrv != 0) {
+    return RES_PARERR;
+  }
+  if (status & STA_NOINIT) {
+    return RES_NOTRDY;
+  }
+
+  switch (cmd) {
+    case CTRL_SYNC: {
+      xSemaphoreTake(cardMutex, portMAX_DELAY);
+      DRESULT res = (fflush(imageFile) == 0) ? RES_OK : RES_ERROR;
+      stats.syncs++;
+      xSemaphoreGive(cardMutex);
+      return res;
+    }
+    case GET_SECTOR_COUNT:
+      if (buff == NULL) return RES_PARERR;
+      *(uint32_t *)buff = numSectors;
+      return RES_OK;
+    case GET_SECTOR_SIZE:
+      if (buff == NULL) return RES_PARERR;
+      *(uint16_t *)buff = SIM_SDCARD_SECTOR_SIZE;
+      return RES_OK;
+    case GET_BLOCK_SIZE:
+      if (buff == NULL) return RES_PARERR;
+      *(uint32_t *)buff = 1;
+      return RES_OK;
+    default:
+      return RES_PARERR;
+  }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+/*
+ * Simulated SD card behind the Reliance Edge block device. It implements the disk_* functions from sdc_diskio.h over
+ * a host file, and holds the calling task for the time the sectors would take over the flight SPI clock.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SIM_SDCARD_SECTOR_SIZE 512U
+#define SIM_SDCARD_DEFAULT_SECTOR_COUNT 1024U  // The Reliance Edge volume size in redconf.c
+#define SIM_SDCARD_DEFAULT_SECTOR_US 14000U    // One sector at the 300 kHz SPI clock, see sdc_bdev.c
+
+typedef struct {
+  uint32_t reads;
+  uint32_t writes;
+  uint32_t syncs;
+  uint32_t sectorsRead;
+  uint32_t sectorsWritten;
+  uint32_t busyMs;  // Time tasks spent waiting on sector transfers
+} sim_sdcard_stats_t;
+
+/**
+ * @brief Opens or creates the card image
+ *
+ * @param imagePath Host file holding the card; it is grown to sectorCount sectors if shorter
+ * @param sectorCount Number of sectors on the card
+ * @param sectorUs Transfer time of one sector
+ * @return Whether the image could be opened
+ */
+bool simSdCardInit(const char *imagePath, uint32_t sectorCount, uint32_t sectorUs);
+
+void simSdCardGetStats(sim_sdcard_stats_t *stats);
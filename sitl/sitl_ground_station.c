@@ -0,0 +1,333 @@
+#include "sitl_ground_station.h"
+#include "sitl_report.h"
+#include "sim_cc1120.h"
+
+#include "obc_errors.h"
+#include "obc_logging.h"
+#include "obc_gs_aes128.h"
+#include "obc_gs_ax25.h"
+#include "obc_gs_ax25_frame_extractor.h"
+#include "obc_gs_batch.h"
+#include "obc_gs_command_id.h"
+#include "obc_gs_command_pack.h"
+#include "obc_gs_commands_response.h"
+#include "obc_gs_commands_response_unpack.h"
+#include "obc_gs_fec.h"
+#include "obc_gs_telemetry_data.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define GS_RX_TASK_NAME "sim gs rx"
+#define GS_RX_TASK_PRIORITY (configMAX_PRIORITIES - 2U)  // Decodes before the scenario looks at a closed window
+#define GS_RX_TASK_STACK_SIZE 4096U
+#define GS_RX_CHUNK_SIZE 256U
+
+#define GS_POLL_PERIOD pdMS_TO_TICKS(1)
+#define GS_MAX_IDLE_WINDOWS 3U  // Pings without telemetry before giving up on a downlink that never started
+
+// Same key and IV as the OBC's uplink decoder
+static const uint8_t gsAesKey[AES_KEY_SIZE] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                               0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+static const uint8_t gsAesIv[AES_IV_SIZE] = {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+                                             0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01};
+
+// What the OBC sent in the current window; written by the receive task, read by the scenario
+typedef struct {
+  TickType_t startTick;
+  TickType_t firstResponseTick;
+  TickType_t lastTelemetryTick;
+  uint32_t uFrames;
+  uint32_t telemetryFrames;
+  uint32_t responses;
+  uint32_t failedResponses;
+} gs_window_t;
+
+static gs_window_t window;
+static sitl_gs_stats_t stats;
+static uint8_t sendSeq;
+
+static ax25_frame_extractor_t extractor;
+
+static StaticTask_t gsRxTaskBuffer;
+static StackType_t gsRxTaskStack[GS_RX_TASK_STACK_SIZE];
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                      Receive                                                     */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static void handleResponses(const uint8_t *payload, uint32_t payloadLen, TickType_t now) {
+  static uint8_t responseData[CMD_RESPONSE_DATA_MAX_SIZE];
+  uint32_t offset = 0;
+
+  while (1) {
+    cmd_response_header_t header = {0};
+    if (unpackNextCmdResponse(payload, payloadLen, &offset, &header, responseData) != OBC_GS_ERR_CODE_SUCCESS ||
+        header.cmdId == CMD_END_OF_FRAME) {
+      break;
+    }
+
+    taskENTER_CRITICAL();
+    if (window.responses == 0) {
+      window.firstResponseTick = now;
+    }
+    window.responses++;
+    stats.responses++;
+    if (header.errCode != CMD_RESPONSE_SUCCESS) {
+      window.failedResponses++;
+      stats.failedResponses++;
+    }
+    taskEXIT_CRITICAL();
+  }
+}
+
+static void handleFrame(const uint8_t *frame, uint16_t frameLen, void *context) {
+  static uint8_t payload[BATCH_DECODED_FRAME_LEN];
+
+  uint32_t inOffset = 0;
+  uint32_t inLength = frameLen;
+  uint32_t outOffset = 0;
+  uint32_t outLength = 0;
+  obc_gs_error_code_t status;
+
+  // The batch decoder only reads the input
+  frame_batch_t input = {.data = (uint8_t *)frame, .dataLen = frameLen, .offsets = &inOffset, .lengths = &inLength,
+                         .numFrames = 1};
+  frame_batch_t output = {.data = payload, .dataLen = sizeof(payload), .offsets = &outOffset, .lengths = &outLength,
+                          .numFrames = 0};
+  batch_config_t config = {.aesKey = NULL};  // The downlink is not encrypted
+
+  TickType_t now = xTaskGetTickCount();
+  if (batchDecodeFrames(&config, &input, &output, &status) != OBC_GS_ERR_CODE_SUCCESS ||
+      status != OBC_GS_ERR_CODE_SUCCESS) {
+    taskENTER_CRITICAL();
+    stats.framesCorrupted++;
+    taskEXIT_CRITICAL();
+    return;
+  }
+
+  taskENTER_CRITICAL();
+  stats.framesReceived++;
+  if (outLength == 0) {
+    window.uFrames++;
+    stats.uFrames++;
+  } else if (payload[0] == TELEM_COMPRESSED_PACKET_MARKER) {
+    window.telemetryFrames++;
+    window.lastTelemetryTick = now;
+    stats.telemetryFrames++;
+  }
+  taskEXIT_CRITICAL();
+
+  if (outLength > 0 && payload[0] != TELEM_COMPRESSED_PACKET_MARKER) {
+    handleResponses(&payload[outOffset], outLength, now);
+  }
+}
+
+static void gsRxTask(void *pvParameters) {
+  static uint8_t rxBuf[GS_RX_CHUNK_SIZE];
+
+  while (1) {
+    uint32_t len = simCc1120GsReceive(rxBuf, sizeof(rxBuf), portMAX_DELAY);
+    if (len == 0) {
+      continue;
+    }
+
+    taskENTER_CRITICAL();
+    stats.rxBytes += len;
+    taskEXIT_CRITICAL();
+
+    ax25FrameExtractorPush(&extractor, rxBuf, len, handleFrame, NULL);
+  }
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                      Windows                                                     */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static bool waitForListening(bool listening, TickType_t start, TickType_t timeout) {
+  while (simCc1120IsListening() != listening) {
+    if (xTaskGetTickCount() - start >= timeout) {
+      return false;
+    }
+    vTaskDelay(GS_POLL_PERIOD);
+  }
+  return true;
+}
+
+/**
+ * @brief Sends one transmission and waits until the OBC has answered it and is listening again
+ *
+ * @param result Set to what came down in the window
+ */
+static obc_error_code_t runWindow(const uint8_t *data, uint32_t len, TickType_t timeout, gs_window_t *result) {
+  TickType_t start = xTaskGetTickCount();
+
+  taskENTER_CRITICAL();
+  memset(&window, 0, sizeof(window));
+  taskEXIT_CRITICAL();
+
+  stats.uplinks++;
+  if (simCc1120GsTransmit(data, len, timeout) != pdPASS) {
+    stats.unheardUplinks++;
+    return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+  }
+
+  taskENTER_CRITICAL();
+  window.startTick = xTaskGetTickCount();
+  taskEXIT_CRITICAL();
+
+  // The OBC keeps receiving until its RX FIFO has been quiet for a while, then answers and goes back to RX
+  if (!waitForListening(false, start, timeout) || !waitForListening(true, start, timeout)) {
+    stats.lostWindows++;
+    return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+  }
+
+  taskENTER_CRITICAL();
+  *result = window;
+  taskEXIT_CRITICAL();
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t sitlGsConnect(TickType_t timeout) {
+  obc_error_code_t errCode;
+
+  ax25_addr_t destAddress = {0};
+  packed_ax25_u_frame_t frame = {0};
+  if (ax25GetDestAddress(&destAddress, CUBE_SAT_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID, DEFAULT_CONTROL_BIT) !=
+          OBC_GS_ERR_CODE_SUCCESS ||
+      ax25BuildUFrame(&frame, &destAddress, U_FRAME_CMD_CONN, 0) != OBC_GS_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_AX25_ENCODE_FAILURE;
+  }
+
+  gs_window_t result;
+  RETURN_IF_ERROR_CODE(runWindow(frame.data, frame.length, timeout, &result));
+  if (result.uFrames == 0) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  sendSeq = 0;
+  sitlReportRecordLatency(SITL_LATENCY_CONNECT, xTaskGetTickCount() - result.startTick);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t sendCommandFrame(const cmd_msg_t *cmds, uint8_t numCmds, TickType_t timeout,
+                                         gs_window_t *result) {
+  uint8_t payload[RS_DECODED_SIZE] = {0};
+  uint32_t payloadLen = 0;
+
+  for (uint8_t i = 0; i < numCmds; i++) {
+    uint8_t numPacked = 0;
+    // The uplink decoder only unpacks the bytes that are left once the IV is taken out
+    if (payloadLen + MAX_CMD_MSG_SIZE > AES_DECRYPTED_SIZE ||
+        packCmdMsg(payload, &payloadLen, &cmds[i], &numPacked) != OBC_GS_ERR_CODE_SUCCESS) {
+      return OBC_ERR_CODE_INVALID_ARG;
+    }
+  }
+
+  static uint8_t encoded[BATCH_ENCODED_FRAME_MAX_LEN];
+  uint32_t inOffset = 0;
+  uint32_t inLength = payloadLen;
+  uint32_t outOffset = 0;
+  uint32_t outLength = 0;
+  obc_gs_error_code_t status;
+
+  frame_batch_t input = {.data = payload, .dataLen = sizeof(payload), .offsets = &inOffset, .lengths = &inLength,
+                         .numFrames = 1};
+  frame_batch_t output = {.data = encoded, .dataLen = sizeof(encoded), .offsets = &outOffset, .lengths = &outLength,
+                          .numFrames = 0};
+  batch_config_t config = {.aesKey = gsAesKey,
+                           .aesIv = gsAesIv,
+                           .destCallSign = CUBE_SAT_CALLSIGN,
+                           .destCallSignLength = CALLSIGN_LENGTH,
+                           .firstSendSeq = sendSeq};
+
+  if (batchEncodeFrames(&config, &input, &output, &status) != OBC_GS_ERR_CODE_SUCCESS ||
+      status != OBC_GS_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_AX25_ENCODE_FAILURE;
+  }
+  sendSeq = (sendSeq + 1U) % MAX_CONTINUOUS_PACKETS_ALLOWED;
+
+  return runWindow(&encoded[outOffset], outLength, timeout, result);
+}
+
+obc_error_code_t sitlGsSendCommands(const cmd_msg_t *cmds, uint8_t numCmds, TickType_t timeout) {
+  obc_error_code_t errCode;
+
+  if (cmds == NULL || numCmds == 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  gs_window_t result;
+  RETURN_IF_ERROR_CODE(sendCommandFrame(cmds, numCmds, timeout, &result));
+
+  if (result.responses > 0) {
+    sitlReportRecordLatency(SITL_LATENCY_COMMAND, result.firstResponseTick - result.startTick);
+  }
+
+  return (result.responses >= numCmds && result.failedResponses == 0) ? OBC_ERR_CODE_SUCCESS
+                                                                       : OBC_ERR_CODE_CMD_NOT_ALLOWED;
+}
+
+obc_error_code_t sitlGsDownlinkTelemetry(TickType_t timeout, uint32_t *telemetryFrames) {
+  obc_error_code_t errCode;
+  TickType_t start = xTaskGetTickCount();
+  TickType_t lastTelemetryTick = 0;
+  uint32_t frames = 0;
+  uint32_t idleWindows = 0;
+
+  cmd_msg_t request = {.id = CMD_DOWNLINK_TELEM};
+  cmd_msg_t ping = {.id = CMD_PING};
+
+  gs_window_t result;
+  RETURN_IF_ERROR_CODE(sendCommandFrame(&request, 1, timeout, &result));
+
+  // Keep the link turning over until a window after the telemetry brings none
+  while (1) {
+    if (result.telemetryFrames > 0) {
+      frames += result.telemetryFrames;
+      lastTelemetryTick = result.lastTelemetryTick;
+      idleWindows = 0;
+    } else if (frames > 0 || ++idleWindows >= GS_MAX_IDLE_WINDOWS) {
+      break;
+    }
+
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed >= timeout) {
+      break;
+    }
+    RETURN_IF_ERROR_CODE(sendCommandFrame(&ping, 1, timeout - elapsed, &result));
+  }
+
+  if (telemetryFrames != NULL) {
+    *telemetryFrames = frames;
+  }
+
+  if (frames > 0) {
+    sitlReportRecordLatency(SITL_LATENCY_TELEMETRY, lastTelemetryTick - start);
+  }
+
+  return (frames > 0) ? OBC_ERR_CODE_SUCCESS : OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                       Setup                                                      */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+void sitlGsInit(void) {
+  memset(&stats, 0, sizeof(stats));
+  ax25FrameExtractorInit(&extractor);
+
+  xTaskCreateStatic(gsRxTask, GS_RX_TASK_NAME, GS_RX_TASK_STACK_SIZE, NULL, GS_RX_TASK_PRIORITY, gsRxTaskStack,
+                    &gsRxTaskBuffer);
+}
+
+void sitlGsGetStats(sitl_gs_stats_t *out) {
+  taskENTER_CRITICAL();
+  *out = stats;
+  taskEXIT_CRITICAL();
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+/*
+ * Simulated ground station on the other end of the simulated CC1120. It builds frames with the same interface library
+ * the real ground station uses, but only through the functions that leave the AX.25 link state alone, since the OBC
+ * in the same process owns it.
+ *
+ * Every uplink opens a window: the OBC leaves RX to answer and comes back to RX once it has sent END_DOWNLINK. The
+ * calls below return when the window closes, or when the timeout runs out because the OBC never answered.
+ */
+
+#include "obc_errors.h"
+#include "obc_gs_command_data.h"
+
+#include <FreeRTOS.h>
+
+#include <stdint.h>
+
+typedef struct {
+  uint32_t uplinks;          // Transmissions sent
+  uint32_t unheardUplinks;   // Transmissions dropped because the OBC never started listening
+  uint32_t lostWindows;      // Uplinks the OBC never came back to RX after
+  uint32_t framesReceived;   // Frames that decoded
+  uint32_t framesCorrupted;  // Frames that failed the FCS or Reed-Solomon decode
+  uint32_t uFrames;
+  uint32_t telemetryFrames;
+  uint32_t responses;  // Command responses
+  uint32_t failedResponses;
+  uint32_t rxBytes;
+} sitl_gs_stats_t;
+
+/**
+ * @brief Creates the task that decodes everything the OBC sends
+ */
+void sitlGsInit(void);
+
+/**
+ * @brief Sends a connect U frame and waits for the OBC's answer
+ *
+ * @param timeout Time allowed for the whole window
+ * @return OBC_ERR_CODE_SUCCESS if a U frame came back
+ */
+obc_error_code_t sitlGsConnect(TickType_t timeout);
+
+/**
+ * @brief Uplinks commands in one frame and waits for the window to close
+ *
+ * The latency from the end of the uplink to the first response frame is recorded in the report.
+ *
+ * @param cmds Commands to pack, at most as many as fit in one frame
+ * @param numCmds Number of commands
+ * @param timeout Time allowed for the whole window
+ * @return OBC_ERR_CODE_SUCCESS if every command got a response
+ */
+obc_error_code_t sitlGsSendCommands(const cmd_msg_t *cmds, uint8_t numCmds, TickType_t timeout);
+
+/**
+ * @brief Requests the telemetry files and pings until they have all come down
+ *
+ * Telemetry queued after the request goes out in the windows of later uplinks, so the ground station keeps pinging
+ * until a window brings no telemetry. The latency from the request to the last telemetry frame is recorded.
+ *
+ * @param timeout Time allowed for the whole downlink
+ * @param telemetryFrames Set to the number of telemetry frames received, if not NULL
+ * @return OBC_ERR_CODE_SUCCESS if the downlink finished within timeout
+ */
+obc_error_code_t sitlGsDownlinkTelemetry(TickType_t timeout, uint32_t *telemetryFrames);
+
+void sitlGsGetStats(sitl_gs_stats_t *stats);
@@ -0,0 +1,116 @@
+#include "sitl_ground_station.h"
+#include "sitl_report.h"
+#include "sitl_scenario.h"
+#include "sim_cc1120.h"
+#include "sim_hal.h"
+#include "sim_i2c.h"
+#include "sim_sdcard.h"
+
+#include "obc_scheduler_config.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_SD_IMAGE "sitl_sdcard.img"
+#define DEFAULT_UART_LOG "sitl_uart.log"
+#define DEFAULT_OBC_TEMP_CELSIUS 25.0f
+
+static struct timespec wallStart;
+
+static void usage(const char *prog) {
+  fprintf(stderr,
+          "Usage: %s [-s sd_image] [-u uart_log] [-b bit_rate] [-e bit_error_rate] [-t sector_us] scenario\n"
+          "  -s  File backing the SD card (default " DEFAULT_SD_IMAGE ")\n"
+          "  -u  File the OBC's UART output is written to (default " DEFAULT_UART_LOG ")\n"
+          "  -b  Radio bit rate in bits per second (default %u)\n"
+          "  -e  Probability of each bit on the air being flipped (default 0)\n"
+          "  -t  Time one SD card sector takes to transfer, in microseconds (default %u)\n",
+          prog, SIM_CC1120_DEFAULT_BIT_RATE, SIM_SDCARD_DEFAULT_SECTOR_US);
+}
+
+static uint32_t wallMsSinceStart(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((now.tv_sec - wallStart.tv_sec) * 1000 + (now.tv_nsec - wallStart.tv_nsec) / 1000000);
+}
+
+static void scenarioDone(uint32_t failedSteps) {
+  sitlReportPrint(stdout, wallMsSinceStart());
+  printf("\n%lu failed step(s)\n", (unsigned long)failedSteps);
+  fflush(stdout);
+
+  exit(failedSteps == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+  const char *sdImage = DEFAULT_SD_IMAGE;
+  const char *uartLogPath = DEFAULT_UART_LOG;
+  uint32_t sectorUs = SIM_SDCARD_DEFAULT_SECTOR_US;
+  sim_cc1120_link_t link = {.bitRate = SIM_CC1120_DEFAULT_BIT_RATE, .rssiDbm = -80, .lqi = 10, .bitErrorRate = 0.0};
+
+  int opt;
+  while ((opt = getopt(argc, argv, "s:u:b:e:t:h")) != -1) {
+    switch (opt) {
+      case 's':
+        sdImage = optarg;
+        break;
+      case 'u':
+        uartLogPath = optarg;
+        break;
+      case 'b':
+        link.bitRate = (uint32_t)strtoul(optarg, NULL, 10);
+        break;
+      case 'e':
+        link.bitErrorRate = strtod(optarg, NULL);
+        break;
+      case 't':
+        sectorUs = (uint32_t)strtoul(optarg, NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+
+  if (optind != argc - 1 || link.bitRate == 0) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!sitlScenarioLoad(argv[optind])) {
+    return EXIT_FAILURE;
+  }
+
+  FILE *uartLog = fopen(uartLogPath, "w");
+  if (uartLog == NULL) {
+    fprintf(stderr, "Cannot open %s\n", uartLogPath);
+    return EXIT_FAILURE;
+  }
+
+  if (!simSdCardInit(sdImage, SIM_SDCARD_DEFAULT_SECTOR_COUNT, sectorUs)) {
+    fprintf(stderr, "Cannot open %s\n", sdImage);
+    return EXIT_FAILURE;
+  }
+
+  simHalInit(uartLog);
+  simI2cInit((uint32_t)time(NULL), DEFAULT_OBC_TEMP_CELSIUS);
+  simCc1120Init(&link);
+  sitlGsInit();
+
+  // Same start as the firmware: the state_mgr brings up the peripherals and the other tasks
+  obcSchedulerInitTask(OBC_SCHEDULER_CONFIG_ID_STATE_MGR);
+  obcSchedulerCreateTask(OBC_SCHEDULER_CONFIG_ID_STATE_MGR);
+
+  sitlScenarioStart(scenarioDone);
+
+  clock_gettime(CLOCK_MONOTONIC, &wallStart);
+  vTaskStartScheduler();
+
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,107 @@
+#include "sitl_queue_stats.h"
+
+#include <FreeRTOS.h>
+#include <os_queue.h>
+#include <os_task.h>
+
+#include <stddef.h>
+
+typedef struct {
+  QueueHandle_t queue;
+  sitl_queue_stats_t stats;
+} tracked_queue_t;
+
+static tracked_queue_t trackedQueues[SITL_QUEUE_STATS_MAX_QUEUES];
+static uint32_t numTrackedQueues;
+
+/**
+ * @brief Finds the stats of a queue from the slot number the registry hook gave it
+ *
+ * @return The stats, or NULL if the queue is not tracked
+ */
+static sitl_queue_stats_t *getStats(void *queue) {
+  UBaseType_t slot = uxQueueGetQueueNumber((QueueHandle_t)queue);
+
+  // Slot 0 is every queue that was never registered; the handle check guards against other users of the number
+  if (slot == 0 || slot > numTrackedQueues || trackedQueues[slot - 1].queue != (QueueHandle_t)queue) {
+    return NULL;
+  }
+
+  return &trackedQueues[slot - 1].stats;
+}
+
+void sitlQueueStatsRegister(void *queue, const char *name) {
+  if (getStats(queue) != NULL || numTrackedQueues >= SITL_QUEUE_STATS_MAX_QUEUES) {
+    return;
+  }
+
+  tracked_queue_t *tracked = &trackedQueues[numTrackedQueues++];
+  tracked->queue = (QueueHandle_t)queue;
+  tracked->stats.name = name;
+  tracked->stats.length = (uint32_t)(uxQueueMessagesWaitingFromISR(tracked->queue) +
+                                     uxQueueSpacesAvailable(tracked->queue));
+  tracked->stats.highWater = (uint32_t)uxQueueMessagesWaitingFromISR(tracked->queue);
+  vQueueSetQueueNumber(tracked->queue, numTrackedQueues);
+}
+
+void sitlQueueStatsSend(void *queue) {
+  sitl_queue_stats_t *stats = getStats(queue);
+  if (stats == NULL) {
+    return;
+  }
+
+  // The hook runs before the item is copied in
+  uint32_t depth = (uint32_t)uxQueueMessagesWaitingFromISR((QueueHandle_t)queue) + 1U;
+  if (depth > stats->length) {
+    depth = stats->length;  // An overwrite replaces the item instead of adding one
+  }
+
+  stats->sends++;
+  if (depth > stats->highWater) {
+    stats->highWater = depth;
+  }
+}
+
+void sitlQueueStatsSendFailed(void *queue) {
+  sitl_queue_stats_t *stats = getStats(queue);
+  if (stats != NULL) {
+    stats->failedSends++;
+  }
+}
+
+void sitlQueueStatsReceive(void *queue) {
+  sitl_queue_stats_t *stats = getStats(queue);
+  if (stats != NULL) {
+    stats->receives++;
+  }
+}
+
+void sitlQueueStatsBlockingOnSend(void *queue) {
+  sitl_queue_stats_t *stats = getStats(queue);
+  if (stats != NULL) {
+    stats->blockedSends++;
+  }
+}
+
+void sitlQueueStatsBlockingOnReceive(void *queue) {
+  sitl_queue_stats_t *stats = getStats(queue);
+  if (stats != NULL) {
+    stats->blockedReceives++;
+  }
+}
+
+uint32_t sitlQueueStatsGet(sitl_queue_stats_t *stats) {
+  if (stats == NULL) {
+    return 0;
+  }
+
+  taskENTER_CRITICAL();
+  for (uint32_t i = 0; i < numTrackedQueues; i++) {
+    stats[i] = trackedQueues[i].stats;
+    stats[i].depth = (uint32_t)uxQueueMessagesWaitingFromISR(trackedQueues[i].queue);
+  }
+  uint32_t count = numTrackedQueues;
+  taskEXIT_CRITICAL();
+
+  return count;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+/*
+ * FreeRTOS queue trace hooks for the SITL build. FreeRTOSConfig.h includes this header, so it cannot include any
+ * FreeRTOS header itself; the hooks take the queue as a void pointer.
+ *
+ * Only queues added to the queue registry are tracked. The hooks run inside the kernel's critical sections, so they
+ * only read the queue and update counters.
+ */
+
+#include <stdint.h>
+
+#define SITL_QUEUE_STATS_MAX_QUEUES 20U
+
+typedef struct {
+  const char *name;
+  uint32_t length;
+  uint32_t depth;      // Items in the queue when the stats were read
+  uint32_t highWater;  // Most items the queue has held
+  uint32_t sends;
+  uint32_t receives;
+  uint32_t blockedSends;     // Sends that had to wait for space
+  uint32_t failedSends;      // Sends that gave up because the queue stayed full
+  uint32_t blockedReceives;  // Receives that had to wait for an item
+} sitl_queue_stats_t;
+
+void sitlQueueStatsRegister(void *queue, const char *name);
+void sitlQueueStatsSend(void *queue);
+void sitlQueueStatsSendFailed(void *queue);
+void sitlQueueStatsReceive(void *queue);
+void sitlQueueStatsBlockingOnSend(void *queue);
+void sitlQueueStatsBlockingOnReceive(void *queue);
+
+/**
+ * @brief Copies the stats of every tracked queue, in registration order
+ *
+ * @param stats Array of at least SITL_QUEUE_STATS_MAX_QUEUES entries
+ * @return The number of queues copied
+ */
+uint32_t sitlQueueStatsGet(sitl_queue_stats_t *stats);
+
+#define traceQUEUE_REGISTRY_ADD(xQueue, pcQueueName) sitlQueueStatsRegister((void *)(xQueue), (pcQueueName))
+#define traceQUEUE_SEND(pxQueue) sitlQueueStatsSend((void *)(pxQueue))
+#define traceQUEUE_SEND_FROM_ISR(pxQueue) sitlQueueStatsSend((void *)(pxQueue))
+#define traceQUEUE_SEND_FAILED(pxQueue) sitlQueueStatsSendFailed((void *)(pxQueue))
+#define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue) sitlQueueStatsSendFailed((void *)(pxQueue))
+#define traceQUEUE_RECEIVE(pxQueue) sitlQueueStatsReceive((void *)(pxQueue))
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue) sitlQueueStatsReceive((void *)(pxQueue))
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue) sitlQueueStatsBlockingOnSend((void *)(pxQueue))
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) sitlQueueStatsBlockingOnReceive((void *)(pxQueue))
@@ -0,0 +1,205 @@
+#include "sitl_report.h"
+#include "sitl_ground_station.h"
+#include "sitl_queue_stats.h"
+#include "sim_cc1120.h"
+#include "sim_fram.h"
+#include "sim_hal.h"
+#include "sim_i2c.h"
+#include "sim_sdcard.h"
+
+#include "comms_manager.h"
+#include "downlink_stats.h"
+#include "logger.h"
+#include "obc_errors.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REPORT_MAX_TASKS 32U
+#define US_PER_MS 1000U
+
+typedef struct {
+  uint32_t samples[SITL_REPORT_MAX_SAMPLES];
+  uint32_t numSamples;  // Samples recorded, including the ones that did not fit
+  uint64_t totalMs;
+  uint32_t maxMs;
+} latency_record_t;
+
+static const char *const latencyNames[SITL_NUM_LATENCIES] = {
+    [SITL_LATENCY_CONNECT] = "connect",
+    [SITL_LATENCY_COMMAND] = "command",
+    [SITL_LATENCY_TELEMETRY] = "telemetry",
+};
+
+static latency_record_t latencies[SITL_NUM_LATENCIES];
+
+void sitlReportRecordLatency(sitl_latency_id_t id, TickType_t ticks) {
+  if (id >= SITL_NUM_LATENCIES) {
+    return;
+  }
+
+  uint32_t ms = (uint32_t)(((uint64_t)ticks * 1000U) / configTICK_RATE_HZ);
+  latency_record_t *record = &latencies[id];
+
+  taskENTER_CRITICAL();
+  if (record->numSamples < SITL_REPORT_MAX_SAMPLES) {
+    record->samples[record->numSamples] = ms;
+  }
+  record->numSamples++;
+  record->totalMs += ms;
+  if (ms > record->maxMs) {
+    record->maxMs = ms;
+  }
+  taskEXIT_CRITICAL();
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                      Sections                                                    */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static int compareTaskRunTime(const void *a, const void *b) {
+  const TaskStatus_t *taskA = a;
+  const TaskStatus_t *taskB = b;
+  if (taskA->ulRunTimeCounter == taskB->ulRunTimeCounter) {
+    return 0;
+  }
+  return (taskA->ulRunTimeCounter < taskB->ulRunTimeCounter) ? 1 : -1;
+}
+
+static void printTasks(FILE *out) {
+  static TaskStatus_t tasks[REPORT_MAX_TASKS];
+  uint32_t totalRunTime = 0;
+
+  UBaseType_t numTasks = uxTaskGetSystemState(tasks, REPORT_MAX_TASKS, &totalRunTime);
+  qsort(tasks, numTasks, sizeof(tasks[0]), compareTaskRunTime);
+
+  fprintf(out, "\nTasks (CPU time from the process CPU clock)\n");
+  fprintf(out, "  %-24s %4s %10s %7s %11s\n", "name", "prio", "cpu ms", "cpu %", "stack free");
+  for (UBaseType_t i = 0; i < numTasks; i++) {
+    uint32_t runTime = tasks[i].ulRunTimeCounter;
+    double percent = (totalRunTime > 0) ? (100.0 * runTime) / totalRunTime : 0.0;
+    fprintf(out, "  %-24s %4lu %10.1f %6.2f%% %11lu\n", tasks[i].pcTaskName, (unsigned long)tasks[i].uxCurrentPriority,
+            runTime / (double)US_PER_MS, percent, (unsigned long)tasks[i].usStackHighWaterMark);
+  }
+  fprintf(out, "  %-24s %4s %10.1f\n", "total", "", totalRunTime / (double)US_PER_MS);
+}
+
+static void printQueues(FILE *out) {
+  static sitl_queue_stats_t queues[SITL_QUEUE_STATS_MAX_QUEUES];
+  uint32_t numQueues = sitlQueueStatsGet(queues);
+
+  fprintf(out, "\nQueues\n");
+  fprintf(out, "  %-24s %6s %6s %6s %8s %8s %8s %8s %8s\n", "name", "length", "depth", "peak", "sends", "receives",
+          "blk send", "failed", "blk recv");
+  for (uint32_t i = 0; i < numQueues; i++) {
+    fprintf(out, "  %-24s %6lu %6lu %6lu %8lu %8lu %8lu %8lu %8lu\n", queues[i].name, (unsigned long)queues[i].length,
+            (unsigned long)queues[i].depth, (unsigned long)queues[i].highWater, (unsigned long)queues[i].sends,
+            (unsigned long)queues[i].receives, (unsigned long)queues[i].blockedSends,
+            (unsigned long)queues[i].failedSends, (unsigned long)queues[i].blockedReceives);
+  }
+}
+
+static int compareSamples(const void *a, const void *b) {
+  uint32_t sampleA = *(const uint32_t *)a;
+  uint32_t sampleB = *(const uint32_t *)b;
+  return (sampleA > sampleB) - (sampleA < sampleB);
+}
+
+static uint32_t percentile(const uint32_t *sorted, uint32_t count, uint32_t pct) {
+  uint32_t index = (count * pct + 99U) / 100U;
+  return sorted[(index > 0) ? index - 1U : 0];
+}
+
+static void printLatencies(FILE *out) {
+  fprintf(out, "\nEnd-to-end latency (ms)\n");
+  fprintf(out, "  %-12s %7s %7s %9s %7s %7s %7s\n", "", "count", "min", "mean", "p50", "p95", "max");
+
+  for (uint32_t id = 0; id < SITL_NUM_LATENCIES; id++) {
+    latency_record_t *record = &latencies[id];
+    if (record->numSamples == 0) {
+      fprintf(out, "  %-12s %7u\n", latencyNames[id], 0U);
+      continue;
+    }
+
+    uint32_t stored = (record->numSamples < SITL_REPORT_MAX_SAMPLES) ? record->numSamples : SITL_REPORT_MAX_SAMPLES;
+    qsort(record->samples, stored, sizeof(record->samples[0]), compareSamples);
+    fprintf(out, "  %-12s %7lu %7lu %9.1f %7lu %7lu %7lu\n", latencyNames[id], (unsigned long)record->numSamples,
+            (unsigned long)record->samples[0], (double)record->totalMs / record->numSamples,
+            (unsigned long)percentile(record->samples, stored, 50),
+            (unsigned long)percentile(record->samples, stored, 95), (unsigned long)record->maxMs);
+  }
+}
+
+static void printComms(FILE *out) {
+  downlink_stats_t downlink = {0};
+  sim_cc1120_stats_t radio;
+  sitl_gs_stats_t gs;
+
+  simCc1120GetStats(&radio);
+  sitlGsGetStats(&gs);
+
+  fprintf(out, "\nLast downlink\n");
+  if (getLastDownlinkStats(&downlink) == OBC_ERR_CODE_SUCCESS) {
+    fprintf(out, "  frames %lu, bytes %lu, duty cycle %u.%u%%, mean gap %lu ms, max gap %lu ms\n",
+            (unsigned long)downlink.framesSent, (unsigned long)downlink.bytesSent,
+            downlinkStatsDutyCyclePermille(&downlink) / 10U, downlinkStatsDutyCyclePermille(&downlink) % 10U,
+            (unsigned long)downlinkStatsMeanGapTicks(&downlink), (unsigned long)downlink.maxGapTicks);
+  }
+
+  fprintf(out, "\nRadio\n");
+  fprintf(out, "  tx packets %lu, tx bytes %lu, tx underflows %lu, tx overflows %lu, tx FIFO peak %lu\n",
+          (unsigned long)radio.txPackets, (unsigned long)radio.txBytes, (unsigned long)radio.txUnderflows,
+          (unsigned long)radio.txOverflows, (unsigned long)radio.txFifoHighWater);
+  fprintf(out, "  rx packets %lu, rx bytes %lu, rx overflows %lu, rx underflows %lu, rx FIFO peak %lu, missed %lu\n",
+          (unsigned long)radio.rxPackets, (unsigned long)radio.rxBytes, (unsigned long)radio.rxOverflows,
+          (unsigned long)radio.rxUnderflows, (unsigned long)radio.rxFifoHighWater, (unsigned long)radio.rxBytesMissed);
+  fprintf(out, "  air bytes %lu, bit errors %lu\n", (unsigned long)radio.airBytes, (unsigned long)radio.bitErrors);
+
+  fprintf(out, "\nGround station\n");
+  fprintf(out, "  uplinks %lu, unheard %lu, lost windows %lu\n", (unsigned long)gs.uplinks,
+          (unsigned long)gs.unheardUplinks, (unsigned long)gs.lostWindows);
+  fprintf(out, "  frames %lu, corrupted %lu, U frames %lu, telemetry %lu, responses %lu, failed responses %lu\n",
+          (unsigned long)gs.framesReceived, (unsigned long)gs.framesCorrupted, (unsigned long)gs.uFrames,
+          (unsigned long)gs.telemetryFrames, (unsigned long)gs.responses, (unsigned long)gs.failedResponses);
+}
+
+static void printPeripherals(FILE *out) {
+  sim_sdcard_stats_t sd;
+  sim_fram_stats_t fram;
+  sim_i2c_stats_t i2c;
+  uint32_t droppedLogs = 0;
+  uint32_t logHighWater = 0;
+
+  simSdCardGetStats(&sd);
+  simFramGetStats(&fram);
+  simI2cGetStats(&i2c);
+  logGetRingStats(&droppedLogs, &logHighWater);
+
+  fprintf(out, "\nPeripherals\n");
+  fprintf(out, "  SD card: reads %lu (%lu sectors), writes %lu (%lu sectors), syncs %lu, busy %lu ms\n",
+          (unsigned long)sd.reads, (unsigned long)sd.sectorsRead, (unsigned long)sd.writes,
+          (unsigned long)sd.sectorsWritten, (unsigned long)sd.syncs, (unsigned long)sd.busyMs);
+  fprintf(out, "  FRAM: reads %lu (%lu bytes), writes %lu (%lu bytes)\n", (unsigned long)fram.reads,
+          (unsigned long)fram.bytesRead, (unsigned long)fram.writes, (unsigned long)fram.bytesWritten);
+  fprintf(out, "  I2C: transactions %lu, NACKs %lu, bytes %lu\n", (unsigned long)i2c.transactions,
+          (unsigned long)i2c.nacks, (unsigned long)i2c.bytes);
+  fprintf(out, "  Logger: UART bytes %lu, dropped entries %lu, ring peak %lu bytes\n",
+          (unsigned long)simHalGetUartBytes(), (unsigned long)droppedLogs, (unsigned long)logHighWater);
+}
+
+void sitlReportPrint(FILE *out, uint32_t wallMs) {
+  fprintf(out, "\n==== SITL report: %lu ms simulated, %lu ms wall ====\n",
+          (unsigned long)(((uint64_t)xTaskGetTickCount() * 1000U) / configTICK_RATE_HZ), (unsigned long)wallMs);
+
+  printTasks(out);
+  printQueues(out);
+  printLatencies(out);
+  printComms(out);
+  printPeripherals(out);
+
+  fflush(out);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+/*
+ * End of run report: CPU time and stack use of every task, the depth of every registered queue, end-to-end latency
+ * seen by the simulated ground station and the counters of each simulated peripheral.
+ */
+
+#include <FreeRTOS.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define SITL_REPORT_MAX_SAMPLES 1024U  // Per latency; later samples still count towards the mean and max
+
+typedef enum {
+  SITL_LATENCY_CONNECT,    // Connect U frame sent to the OBC's answer
+  SITL_LATENCY_COMMAND,    // Uplink sent to the first command response
+  SITL_LATENCY_TELEMETRY,  // Telemetry request to the last telemetry frame
+  SITL_NUM_LATENCIES,
+} sitl_latency_id_t;
+
+/**
+ * @brief Adds one end-to-end latency sample
+ *
+ * @param id What was measured
+ * @param ticks Latency in RTOS ticks
+ */
+void sitlReportRecordLatency(sitl_latency_id_t id, TickType_t ticks);
+
+/**
+ * @brief Prints the report; only call once the scenario has finished
+ *
+ * @param out Where to print it
+ * @param wallMs Time the run took on the host
+ */
+void sitlReportPrint(FILE *out, uint32_t wallMs);
@@ -0,0 +1,364 @@
+#include "sitl_scenario.h"
+#include "sitl_ground_station.h"
+#include "sim_cc1120.h"
+#include "sim_i2c.h"
+
+#include "obc_errors.h"
+#include "obc_gs_command_id.h"
+#include "obc_logging.h"
+#include "obc_time.h"
+#include "telemetry_manager.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCENARIO_TASK_NAME "sim scenario"
+#define SCENARIO_TASK_PRIORITY 1U
+#define SCENARIO_TASK_STACK_SIZE 4096U
+
+#define LOAD_TASK_NAME "sim load"
+#define LOAD_TASK_PRIORITY 1U
+#define LOAD_TASK_STACK_SIZE 2048U
+
+#define SCENARIO_MAX_STEPS 256U
+#define SCENARIO_MAX_LINE_LEN 128U
+
+#define DEFAULT_CONNECT_TIMEOUT_MS 5000U
+#define DEFAULT_PING_TIMEOUT_MS 5000U
+#define DEFAULT_DOWNLINK_TIMEOUT_MS 120000U
+
+typedef enum {
+  STEP_CONNECT,
+  STEP_PING,
+  STEP_DOWNLINK,
+  STEP_TELEMETRY,
+  STEP_LOG,
+  STEP_WAIT,
+  STEP_LINK_BITRATE,
+  STEP_LINK_RSSI,
+  STEP_LINK_LQI,
+  STEP_LINK_BER,
+  STEP_OBC_TEMP,
+} step_type_t;
+
+typedef struct {
+  step_type_t type;
+  uint32_t line;
+  uint32_t count;
+  uint32_t ms;  // Timeout, period or wait depending on the step
+  double value;
+} scenario_step_t;
+
+// One stream of background load
+typedef struct {
+  uint32_t remaining;
+  TickType_t period;
+  TickType_t nextTick;
+} load_t;
+
+static scenario_step_t steps[SCENARIO_MAX_STEPS];
+static uint32_t numSteps;
+static sitl_scenario_done_t doneCallback;
+
+static load_t telemetryLoad;
+static load_t logLoad;
+
+static StaticTask_t scenarioTaskBuffer;
+static StackType_t scenarioTaskStack[SCENARIO_TASK_STACK_SIZE];
+static TaskHandle_t loadTaskHandle;
+static StaticTask_t loadTaskBuffer;
+static StackType_t loadTaskStack[LOAD_TASK_STACK_SIZE];
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                      Parsing                                                     */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static bool parseStep(char *line, scenario_step_t *step) {
+  char *comment = strchr(line, '#');
+  if (comment != NULL) {
+    *comment = '\0';
+  }
+
+  char name[16] = {0};
+  char arg[16] = {0};
+  unsigned long first = 0;
+  unsigned long second = 0;
+  double value = 0.0;
+
+  int numArgs = sscanf(line, "%15s", name);
+  if (numArgs < 1) {
+    return false;  // Nothing on the line
+  }
+
+  step->count = 1;
+  if (strcmp(name, "connect") == 0) {
+    step->type = STEP_CONNECT;
+    step->ms = (sscanf(line, "%*s %lu", &first) == 1) ? first : DEFAULT_CONNECT_TIMEOUT_MS;
+  } else if (strcmp(name, "ping") == 0) {
+    numArgs = sscanf(line, "%*s %lu %lu", &first, &second);
+    if (numArgs < 1) {
+      return false;
+    }
+    step->type = STEP_PING;
+    step->count = first;
+    step->ms = (numArgs == 2) ? second : DEFAULT_PING_TIMEOUT_MS;
+  } else if (strcmp(name, "downlink") == 0) {
+    step->type = STEP_DOWNLINK;
+    step->ms = (sscanf(line, "%*s %lu", &first) == 1) ? first : DEFAULT_DOWNLINK_TIMEOUT_MS;
+  } else if (strcmp(name, "telemetry") == 0 || strcmp(name, "log") == 0) {
+    if (sscanf(line, "%*s %lu %lu", &first, &second) != 2 || second == 0) {
+      return false;
+    }
+    step->type = (name[0] == 't') ? STEP_TELEMETRY : STEP_LOG;
+    step->count = first;
+    step->ms = second;
+  } else if (strcmp(name, "wait") == 0) {
+    if (sscanf(line, "%*s %lu", &first) != 1) {
+      return false;
+    }
+    step->type = STEP_WAIT;
+    step->ms = first;
+  } else if (strcmp(name, "link") == 0) {
+    if (sscanf(line, "%*s %15s %lf", arg, &value) != 2) {
+      return false;
+    }
+    if (strcmp(arg, "bitrate") == 0 && value > 0) {
+      step->type = STEP_LINK_BITRATE;
+    } else if (strcmp(arg, "rssi") == 0) {
+      step->type = STEP_LINK_RSSI;
+    } else if (strcmp(arg, "lqi") == 0) {
+      step->type = STEP_LINK_LQI;
+    } else if (strcmp(arg, "ber") == 0 && value >= 0 && value <= 1) {
+      step->type = STEP_LINK_BER;
+    } else {
+      return false;
+    }
+    step->value = value;
+  } else if (strcmp(name, "obc_temp") == 0) {
+    if (sscanf(line, "%*s %lf", &value) != 1) {
+      return false;
+    }
+    step->type = STEP_OBC_TEMP;
+    step->value = value;
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
+static bool isBlank(const char *line) {
+  while (*line != '\0' && *line != '#') {
+    if (*line != ' ' && *line != '\t' && *line != '\r' && *line != '\n') {
+      return false;
+    }
+    line++;
+  }
+  return true;
+}
+
+bool sitlScenarioLoad(const char *path) {
+  FILE *file = fopen(path, "r");
+  if (file == NULL) {
+    fprintf(stderr, "Cannot open scenario %s\n", path);
+    return false;
+  }
+
+  char line[SCENARIO_MAX_LINE_LEN];
+  uint32_t lineNum = 0;
+  bool ok = true;
+
+  numSteps = 0;
+  while (ok && fgets(line, sizeof(line), file) != NULL) {
+    lineNum++;
+    if (isBlank(line)) {
+      continue;
+    }
+
+    if (numSteps >= SCENARIO_MAX_STEPS) {
+      fprintf(stderr, "%s:%lu: more than %u steps\n", path, (unsigned long)lineNum, SCENARIO_MAX_STEPS);
+      ok = false;
+    } else if (!parseStep(line, &steps[numSteps])) {
+      fprintf(stderr, "%s:%lu: cannot parse: %s", path, (unsigned long)lineNum, line);
+      ok = false;
+    } else {
+      steps[numSteps++].line = lineNum;
+    }
+  }
+
+  fclose(file);
+  return ok;
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                        Load                                                      */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static void startLoad(load_t *load, uint32_t count, uint32_t periodMs) {
+  taskENTER_CRITICAL();
+  load->remaining = count;
+  load->period = pdMS_TO_TICKS(periodMs);
+  load->nextTick = xTaskGetTickCount();
+  taskEXIT_CRITICAL();
+
+  xTaskNotifyGive(loadTaskHandle);
+}
+
+// Ticks until the load is next due, or portMAX_DELAY if it has finished
+static TickType_t ticksUntilDue(const load_t *load, TickType_t now) {
+  TickType_t ticks = portMAX_DELAY;
+
+  taskENTER_CRITICAL();
+  if (load->remaining > 0) {
+    int32_t until = (int32_t)(load->nextTick - now);
+    ticks = (until > 0) ? (TickType_t)until : 0;
+  }
+  taskEXIT_CRITICAL();
+
+  return ticks;
+}
+
+// Takes one item off the load if one is due
+static bool loadDue(load_t *load, TickType_t now) {
+  bool due = false;
+
+  taskENTER_CRITICAL();
+  if (load->remaining > 0 && (int32_t)(now - load->nextTick) >= 0) {
+    load->remaining--;
+    load->nextTick += load->period;
+    due = true;
+  }
+  taskEXIT_CRITICAL();
+
+  return due;
+}
+
+static void loadTask(void *pvParameters) {
+  obc_error_code_t errCode;
+
+  while (1) {
+    TickType_t now = xTaskGetTickCount();
+
+    if (loadDue(&telemetryLoad, now)) {
+      telemetry_data_t data = {.obcTemp = 25.0f, .id = TELEM_OBC_TEMP, .timestamp = getCurrentUnixTime()};
+      LOG_IF_ERROR_CODE(addTelemetryData(&data));
+    }
+
+    if (loadDue(&logLoad, now)) {
+      LOG_DEBUG("SITL load log message");
+    }
+
+    // Sleep until the next item is due, or until startLoad brings more
+    now = xTaskGetTickCount();
+    TickType_t telemetryTicks = ticksUntilDue(&telemetryLoad, now);
+    TickType_t logTicks = ticksUntilDue(&logLoad, now);
+    TickType_t wait = (telemetryTicks < logTicks) ? telemetryTicks : logTicks;
+    if (wait > 0) {
+      ulTaskNotifyTake(pdTRUE, wait);
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------------------------------------------------- */
+/*                                                        Steps                                                     */
+/* ---------------------------------------------------------------------------------------------------------------- */
+
+static obc_error_code_t runStep(const scenario_step_t *step) {
+  obc_error_code_t errCode;
+  sim_cc1120_link_t link;
+
+  switch (step->type) {
+    case STEP_CONNECT:
+      return sitlGsConnect(pdMS_TO_TICKS(step->ms));
+    case STEP_PING: {
+      // Keep pinging after a lost response; the ground station stats show how many went missing
+      cmd_msg_t ping = {.id = CMD_PING};
+      obc_error_code_t firstErrCode = OBC_ERR_CODE_SUCCESS;
+      for (uint32_t i = 0; i < step->count; i++) {
+        errCode = sitlGsSendCommands(&ping, 1, pdMS_TO_TICKS(step->ms));
+        if (firstErrCode == OBC_ERR_CODE_SUCCESS) {
+          firstErrCode = errCode;
+        }
+      }
+      return firstErrCode;
+    }
+    case STEP_DOWNLINK: {
+      uint32_t frames = 0;
+      errCode = sitlGsDownlinkTelemetry(pdMS_TO_TICKS(step->ms), &frames);
+      printf("  %lu telemetry frames\n", (unsigned long)frames);
+      return errCode;
+    }
+    case STEP_TELEMETRY:
+      startLoad(&telemetryLoad, step->count, step->ms);
+      return OBC_ERR_CODE_SUCCESS;
+    case STEP_LOG:
+      startLoad(&logLoad, step->count, step->ms);
+      return OBC_ERR_CODE_SUCCESS;
+    case STEP_WAIT:
+      vTaskDelay(pdMS_TO_TICKS(step->ms));
+      return OBC_ERR_CODE_SUCCESS;
+    case STEP_OBC_TEMP:
+      simI2cSetObcTemp((float)step->value);
+      return OBC_ERR_CODE_SUCCESS;
+    default:
+      break;
+  }
+
+  simCc1120GetLink(&link);
+  switch (step->type) {
+    case STEP_LINK_BITRATE:
+      link.bitRate = (uint32_t)step->value;
+      break;
+    case STEP_LINK_RSSI:
+      link.rssiDbm = (int8_t)step->value;
+      break;
+    case STEP_LINK_LQI:
+      link.lqi = (uint8_t)step->value;
+      break;
+    case STEP_LINK_BER:
+      link.bitErrorRate = step->value;
+      break;
+    default:
+      return OBC_ERR_CODE_INVALID_ARG;
+  }
+  simCc1120SetLink(&link);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static void scenarioTask(void *pvParameters) {
+  uint32_t failedSteps = 0;
+
+  for (uint32_t i = 0; i < numSteps; i++) {
+    TickType_t start = xTaskGetTickCount();
+    obc_error_code_t errCode = runStep(&steps[i]);
+    TickType_t elapsed = xTaskGetTickCount() - start;
+
+    if (errCode != OBC_ERR_CODE_SUCCESS) {
+      failedSteps++;
+      printf("line %lu: failed with error %d after %lu ms\n", (unsigned long)steps[i].line, (int)errCode,
+             (unsigned long)elapsed);
+    } else {
+      printf("line %lu: done in %lu ms\n", (unsigned long)steps[i].line, (unsigned long)elapsed);
+    }
+    fflush(stdout);
+  }
+
+  doneCallback(failedSteps);
+  vTaskDelete(NULL);
+}
+
+void sitlScenarioStart(sitl_scenario_done_t onDone) {
+  doneCallback = onDone;
+
+  loadTaskHandle = xTaskCreateStatic(loadTask, LOAD_TASK_NAME, LOAD_TASK_STACK_SIZE, NULL, LOAD_TASK_PRIORITY,
+                                     loadTaskStack, &loadTaskBuffer);
+  xTaskCreateStatic(scenarioTask, SCENARIO_TASK_NAME, SCENARIO_TASK_STACK_SIZE, NULL, SCENARIO_TASK_PRIORITY,
+                    scenarioTaskStack, &scenarioTaskBuffer);
+}
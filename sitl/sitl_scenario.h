@@ -0,0 +1,42 @@
+#pragma once
+
+/*
+ * Scripted scenarios for the SITL build. A scenario is a text file with one step per line; blank lines and anything
+ * after a '#' are ignored. Steps run in order on their own task:
+ *
+ *   connect [timeout_ms]             Sends a connect U frame
+ *   ping <count> [timeout_ms]        Uplinks count pings, one per frame
+ *   downlink [timeout_ms]            Requests the telemetry files and pings until they have come down
+ *   telemetry <count> <period_ms>    Starts adding OBC temperature telemetry in the background
+ *   log <count> <period_ms>          Starts logging debug messages in the background
+ *   wait <ms>                        Lets the OBC run
+ *   link <bitrate|rssi|lqi|ber> <value>
+ *   obc_temp <celsius>               Changes what the LM75BD reads
+ *
+ * Background load keeps going while later steps run; wait for it to finish before measuring a quiet OBC.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Called on the scenario task once every step has run
+ *
+ * @param failedSteps Number of steps that did not succeed
+ */
+typedef void (*sitl_scenario_done_t)(uint32_t failedSteps);
+
+/**
+ * @brief Reads and checks a scenario file
+ *
+ * @param path Scenario file
+ * @return false, after printing the offending line, if the file cannot be read or has a step it does not understand
+ */
+bool sitlScenarioLoad(const char *path);
+
+/**
+ * @brief Creates the tasks that run the loaded scenario
+ *
+ * @param onDone Called when the last step has run
+ */
+void sitlScenarioStart(sitl_scenario_done_t onDone);
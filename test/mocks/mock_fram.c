@@ -1,4 +1,5 @@
 #include "fm25v20a.h"
+#include "mock_fram.h"
 
 #include "obc_errors.h"
 #include "obc_assert.h"
@@ -6,8 +7,9 @@
 #include <stdint.h>
 #include <string.h>
 
-#define MOCK_FRAM_MAX_SIZE 1000  // Change as needed
+#define MOCK_FRAM_MAX_SIZE 16384  // Change as needed
 static uint8_t memory[MOCK_FRAM_MAX_SIZE] = {0};
+static uint32_t failReadAddr = MOCK_FRAM_NO_FAULT;
 
 STATIC_ASSERT(MOCK_FRAM_MAX_SIZE <= FRAM_MAX_ADDRESS, "Mock FRAM exceeds available FRAM space");
 
@@ -16,6 +18,8 @@ obc_error_code_t framRead(uint32_t addr, uint8_t *buffer, size_t nBytes) {
 
   if (addr + nBytes > MOCK_FRAM_MAX_SIZE) return OBC_ERR_CODE_BUFF_OVERFLOW;
 
+  if (failReadAddr >= addr && failReadAddr < addr + nBytes) return OBC_ERR_CODE_SPI_FAILURE;
+
   memcpy(buffer, memory + addr, nBytes);
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -28,3 +32,5 @@ obc_error_code_t framWrite(uint32_t addr, const uint8_t *data, size_t nBytes) {
   memcpy(memory + addr, data, nBytes);
   return OBC_ERR_CODE_SUCCESS;
 }
+
+void mockFramFailReadsAt(uint32_t addr) { failReadAddr = addr; }
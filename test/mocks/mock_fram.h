@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MOCK_FRAM_NO_FAULT UINT32_MAX
+
+/**
+ * @brief Make framRead fail with OBC_ERR_CODE_SPI_FAILURE whenever a read covers addr
+ *
+ * @param addr Address to fail on; MOCK_FRAM_NO_FAULT to disable
+ */
+void mockFramFailReadsAt(uint32_t addr);
+
+#ifdef __cplusplus
+}
+#endif
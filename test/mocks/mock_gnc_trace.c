@@ -0,0 +1,125 @@
+#include "mock_gnc_trace.h"
+
+#include <math.h>
+
+#define EARTH_RADIUS_M 6371e3
+#define ORBIT_RADIUS_M (EARTH_RADIUS_M + 408e3)
+#define EARTH_MU_M3_PER_S2 3.986004418e14
+#define ORBIT_INCLINATION_RAD (51.6 * M_PI / 180.0)
+#define EARTH_DIPOLE_GAUSS 0.3
+
+#define GYRO_NOISE_RAD_PER_S 1e-3
+#define SUN_SENSOR_NOISE 5e-3
+#define MAGNETOMETER_NOISE_GAUSS 2e-3
+
+static const double gyroBias[3] = {2e-3, -1e-3, 5e-4};
+
+static uint32_t rngState;
+
+static double uniform(void) {
+  rngState = rngState * 1103515245U + 12345U;
+  return ((rngState >> 8) + 0.5) / 16777216.0;
+}
+
+static double gaussian(double sigma) {
+  // Box-Muller
+  return sigma * sqrt(-2.0 * log(uniform())) * cos(2.0 * M_PI * uniform());
+}
+
+static void normalize(double *v, uint32_t len) {
+  double norm = 0.0;
+  for (uint32_t i = 0; i < len; i++) {
+    norm += v[i] * v[i];
+  }
+  norm = sqrt(norm);
+  for (uint32_t i = 0; i < len; i++) {
+    v[i] /= norm;
+  }
+}
+
+static void rotateToBody(const double q[4], const double in[3], double out[3]) {
+  const double dcm[3][3] = {
+      {1.0 - 2.0 * (q[2] * q[2] + q[3] * q[3]), 2.0 * (q[1] * q[2] + q[0] * q[3]), 2.0 * (q[1] * q[3] - q[0] * q[2])},
+      {2.0 * (q[1] * q[2] - q[0] * q[3]), 1.0 - 2.0 * (q[1] * q[1] + q[3] * q[3]), 2.0 * (q[2] * q[3] + q[0] * q[1])},
+      {2.0 * (q[1] * q[3] + q[0] * q[2]), 2.0 * (q[2] * q[3] - q[0] * q[1]), 1.0 - 2.0 * (q[1] * q[1] + q[2] * q[2])},
+  };
+
+  for (uint32_t i = 0; i < 3; i++) {
+    out[i] = dcm[i][0] * in[0] + dcm[i][1] * in[1] + dcm[i][2] * in[2];
+  }
+}
+
+void mockGncTraceGenerate(mock_gnc_trace_step_t *steps, uint32_t count, uint32_t seed) {
+  rngState = seed;
+
+  const double meanMotion = sqrt(EARTH_MU_M3_PER_S2 / (ORBIT_RADIUS_M * ORBIT_RADIUS_M * ORBIT_RADIUS_M));
+  const double sinInc = sin(ORBIT_INCLINATION_RAD);
+  const double cosInc = cos(ORBIT_INCLINATION_RAD);
+
+  double q[4] = {cos(0.3), sin(0.3) * 0.48, sin(0.3) * 0.6, sin(0.3) * 0.64};
+  normalize(q, 4);
+
+  double sunRef[3] = {0.9, 0.3, 0.3};
+  normalize(sunRef, 3);
+
+  for (uint32_t i = 0; i < count; i++) {
+    mock_gnc_trace_step_t *step = &steps[i];
+    const double t = i * MOCK_GNC_TRACE_STEP_S;
+
+    // Circular orbit, starting partway along so the field is not aligned with an axis
+    const double theta = 0.7 + meanMotion * t;
+    const double rHat[3] = {cos(theta), sin(theta) * cosInc, sin(theta) * sinInc};
+    for (uint32_t k = 0; k < 3; k++) {
+      step->satPos[k] = ORBIT_RADIUS_M * rHat[k];
+      step->sunRef[k] = sunRef[k];
+    }
+    step->satPosAxis[0] = 0.0;
+    step->satPosAxis[1] = -sinInc;
+    step->satPosAxis[2] = cosInc;
+
+    // Dipole field with the dipole along -z
+    const double scale = EARTH_DIPOLE_GAUSS * pow(EARTH_RADIUS_M / ORBIT_RADIUS_M, 3.0);
+    const double mDotR = -rHat[2];
+    step->magRef[0] = scale * (3.0 * mDotR * rHat[0]);
+    step->magRef[1] = scale * (3.0 * mDotR * rHat[1]);
+    step->magRef[2] = scale * (3.0 * mDotR * rHat[2] + 1.0);
+
+    // Slow tumble
+    step->trueAngVel[0] = 0.02 + 0.01 * sin(0.05 * t);
+    step->trueAngVel[1] = -0.015;
+    step->trueAngVel[2] = 0.01 * cos(0.03 * t);
+
+    for (uint32_t k = 0; k < 4; k++) {
+      step->trueQuat[k] = q[k];
+    }
+
+    rotateToBody(q, step->sunRef, step->sunMeas);
+    rotateToBody(q, step->magRef, step->magMeas);
+    for (uint32_t k = 0; k < 3; k++) {
+      step->gyro[k] = step->trueAngVel[k] + gyroBias[k] + gaussian(GYRO_NOISE_RAD_PER_S);
+      step->sunMeas[k] += gaussian(SUN_SENSOR_NOISE);
+      step->magMeas[k] += gaussian(MAGNETOMETER_NOISE_GAUSS);
+    }
+    normalize(step->sunMeas, 3);
+
+    step->sunUvValues[0] = 0.3 * sin(0.02 * t);
+    step->sunUvValues[1] = 0.2 * cos(0.015 * t);
+
+    step->commandedDipole[0] = 0.1 * sin(0.01 * t);
+    step->commandedDipole[1] = -0.05;
+    step->commandedDipole[2] = 0.08 * cos(0.02 * t);
+
+    // Propagate the attitude to the next step: q' = q + dt / 2 * q * [0, w]
+    const double *w = step->trueAngVel;
+    const double qDot[4] = {
+        -0.5 * (q[1] * w[0] + q[2] * w[1] + q[3] * w[2]),
+        0.5 * (q[0] * w[0] + q[2] * w[2] - q[3] * w[1]),
+        0.5 * (q[0] * w[1] + q[3] * w[0] - q[1] * w[2]),
+        0.5 * (q[0] * w[2] + q[1] * w[1] - q[2] * w[0]),
+    };
+    for (uint32_t k = 0; k < 4; k++) {
+      q[k] += qDot[k] * MOCK_GNC_TRACE_STEP_S;
+    }
+    normalize(q, 4);
+  }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MOCK_GNC_TRACE_STEP_S 0.05  // GNC task period
+
+/*
+ * A sensor trace for the GNC models: a satellite in a 408 km circular orbit, tumbling slowly, sampled at the GNC task
+ * rate. Reference vectors are inertial; measurements are the references rotated into the body frame with the same
+ * quaternion convention as the attitude determination model, plus gyro bias and white noise on every sensor. The
+ * trace is the same for the same seed.
+ */
+
+typedef struct {
+  double trueQuat[4];      // Inertial to body
+  double trueAngVel[3];    // Body rates, rad/s
+  double sunRef[3];        // Unit vector, inertial
+  double magRef[3];        // Gauss, inertial
+  double gyro[3];          // Measured body rates, rad/s
+  double sunMeas[3];       // Sun sensor unit vector, body
+  double magMeas[3];       // Magnetometer, Gauss, body
+  double satPos[3];        // m, inertial
+  double satPosAxis[3];    // Unit vector along the orbit normal
+  double sunUvValues[2];   // Sun sensor UV coordinates
+  double commandedDipole[3];
+} mock_gnc_trace_step_t;
+
+/**
+ * @brief Fill steps with count consecutive GNC steps of the trace
+ */
+void mockGncTraceGenerate(mock_gnc_trace_step_t *steps, uint32_t count, uint32_t seed);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,39 @@
+#include "mock_redposix.h"
+
+#include <redposix.h>
+
+#include <stdint.h>
+#include <string.h>
+
+static uint8_t fileData[MOCK_RED_MAX_FILE_SIZE];
+static uint32_t fileLen = 0;
+static uint32_t volumeCapacity = MOCK_RED_MAX_FILE_SIZE;
+
+void mockRedReset(uint32_t capacity) {
+  fileLen = 0;
+  mockRedSetCapacity(capacity);
+}
+
+void mockRedSetCapacity(uint32_t capacity) {
+  volumeCapacity = (capacity > MOCK_RED_MAX_FILE_SIZE) ? MOCK_RED_MAX_FILE_SIZE : capacity;
+}
+
+const uint8_t *mockRedFileData(uint32_t *len) {
+  *len = fileLen;
+  return fileData;
+}
+
+int32_t red_write(int32_t iFildes, const void *pBuffer, uint32_t ulLength) {
+  if (iFildes < 0 || pBuffer == NULL || fileLen >= volumeCapacity) {
+    return -1;
+  }
+
+  uint32_t len = volumeCapacity - fileLen;
+  if (len > ulLength) {
+    len = ulLength;
+  }
+
+  memcpy(fileData + fileLen, pBuffer, len);
+  fileLen += len;
+  return (int32_t)len;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * red_write appending to a single file in memory on a volume with limited room. A write larger than the room left is
+ * cut short, as Reliance Edge does when the volume fills up, and a write with no room left fails.
+ */
+
+#define MOCK_RED_MAX_FILE_SIZE 16384U
+
+/**
+ * @brief Empty the file
+ *
+ * @param capacity Bytes the volume has room for, at most MOCK_RED_MAX_FILE_SIZE
+ */
+void mockRedReset(uint32_t capacity);
+
+/**
+ * @brief Change the room on the volume, e.g. after files were deleted
+ *
+ * @param capacity Bytes the volume has room for, at most MOCK_RED_MAX_FILE_SIZE
+ */
+void mockRedSetCapacity(uint32_t capacity);
+
+/**
+ * @brief Contents of the file
+ *
+ * @param len Set to the number of bytes in the file
+ */
+const uint8_t *mockRedFileData(uint32_t *len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,337 @@
+#include "mock_sd_card.h"
+
+#include "obc_gs_crc.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SECTOR_SIZE 512U
+#define CRC_BYTES 2U
+#define CMD_PACKET_SIZE 6U
+#define CSD_SIZE 16U
+
+#define DATA_TOKEN 0xFEU
+#define MULTI_WRITE_TOKEN 0xFCU
+#define STOP_TRAN_TOKEN 0xFDU
+
+#define R1_READY 0x00U
+#define R1_IDLE 0x01U
+#define R1_ILLEGAL_COMMAND 0x04U
+#define R1_ADDRESS_ERROR 0x20U
+
+#define DATA_RESPONSE_ACCEPTED 0x05U
+#define DATA_RESPONSE_CRC_ERROR 0x0BU
+#define DATA_RESPONSE_WRITE_ERROR 0x0DU
+#define DATA_ERROR_TOKEN_OUT_OF_RANGE 0x08U
+
+typedef enum {
+  OUT_IDLE,
+  OUT_RESPONSE,
+  OUT_READ_ACCESS,
+  OUT_READ_PACKET,
+  OUT_DATA_RESPONSE,
+  OUT_BUSY,
+} out_state_t;
+
+typedef enum {
+  IN_CMD,
+  IN_WRITE_TOKEN,
+  IN_WRITE_PACKET,
+} in_state_t;
+
+static struct {
+  uint8_t *storage;
+  uint32_t numSectors;
+  mock_sd_card_config_t config;
+  mock_sd_card_stats_t stats;
+
+  out_state_t out;
+  out_state_t afterResponse;
+  uint32_t countdown;
+  uint8_t response;
+  uint8_t dataResponse;
+
+  uint8_t packet[1 + SECTOR_SIZE + CRC_BYTES];
+  uint32_t packetLen;
+  uint32_t packetPos;
+  uint32_t readSector;
+  bool multiRead;
+
+  in_state_t in;
+  uint8_t cmd[CMD_PACKET_SIZE];
+  uint32_t cmdLen;
+  bool appCmd;
+  uint32_t writeSector;
+  bool multiWrite;
+  uint8_t writeBuf[SECTOR_SIZE + CRC_BYTES];
+  uint32_t writePos;
+} card;
+
+static void respond(uint8_t r1, out_state_t next, uint32_t extraDelay) {
+  card.response = r1;
+  card.countdown = card.config.ncrBytes + extraDelay;
+  card.afterResponse = next;
+  card.out = OUT_RESPONSE;
+}
+
+static void loadSectorPacket(void) {
+  if (card.readSector >= card.numSectors) {
+    card.packet[0] = DATA_ERROR_TOKEN_OUT_OF_RANGE;
+    card.packetLen = 1;
+    card.multiRead = false;
+    return;
+  }
+
+  const uint8_t *sector = card.storage + (size_t)card.readSector * SECTOR_SIZE;
+  uint16_t crc = crc16CcittUpdate(0, sector, SECTOR_SIZE);
+  if (card.readSector == card.config.corruptReadCrcSector) {
+    crc ^= 1U;
+  }
+
+  card.packet[0] = DATA_TOKEN;
+  memcpy(&card.packet[1], sector, SECTOR_SIZE);
+  card.packet[1 + SECTOR_SIZE] = (uint8_t)(crc >> 8);
+  card.packet[2 + SECTOR_SIZE] = (uint8_t)crc;
+  card.packetLen = 1 + SECTOR_SIZE + CRC_BYTES;
+}
+
+static void loadCsdPacket(void) {
+  // CSD version 2.0: capacity is (C_SIZE + 1) * 512 KiB
+  uint8_t csd[CSD_SIZE] = {0x40};
+  uint32_t cSize = card.numSectors / 1024U - 1U;
+  csd[7] = (uint8_t)((cSize >> 16) & 0x3FU);
+  csd[8] = (uint8_t)(cSize >> 8);
+  csd[9] = (uint8_t)cSize;
+
+  card.packet[0] = DATA_TOKEN;
+  memcpy(&card.packet[1], csd, CSD_SIZE);
+  uint16_t crc = crc16CcittUpdate(0, csd, CSD_SIZE);
+  card.packet[1 + CSD_SIZE] = (uint8_t)(crc >> 8);
+  card.packet[2 + CSD_SIZE] = (uint8_t)crc;
+  card.packetLen = 1 + CSD_SIZE + CRC_BYTES;
+}
+
+static void startRead(void) {
+  card.packetPos = 0;
+  card.countdown = card.config.readAccessBytes;
+  card.out = OUT_READ_ACCESS;
+}
+
+static void handleCommand(void) {
+  uint8_t index = card.cmd[0] & 0x3FU;
+  uint32_t arg = ((uint32_t)card.cmd[1] << 24) | ((uint32_t)card.cmd[2] << 16) | ((uint32_t)card.cmd[3] << 8) |
+                 (uint32_t)card.cmd[4];
+  bool isAppCmd = card.appCmd;
+  card.appCmd = false;
+  card.stats.commands[index]++;
+
+  switch (index) {
+    case 0:
+      respond(R1_IDLE, OUT_IDLE, 0);
+      break;
+    case 9:
+      loadCsdPacket();
+      card.multiRead = false;
+      respond(R1_READY, OUT_READ_ACCESS, 0);
+      break;
+    case 12:
+      // Data stops one byte after the command, then the response follows
+      card.multiRead = false;
+      respond(R1_READY, OUT_IDLE, 1);
+      break;
+    case 17:
+    case 18:
+      if (arg >= card.numSectors) {
+        respond(R1_ADDRESS_ERROR, OUT_IDLE, 0);
+        break;
+      }
+      card.readSector = arg;
+      card.multiRead = index == 18;
+      loadSectorPacket();
+      respond(R1_READY, OUT_READ_ACCESS, 0);
+      break;
+    case 23:
+      if (isAppCmd) {
+        card.stats.preEraseCount = arg;
+      }
+      respond(R1_READY, OUT_IDLE, 0);
+      break;
+    case 24:
+    case 25:
+      if (arg >= card.numSectors) {
+        respond(R1_ADDRESS_ERROR, OUT_IDLE, 0);
+        break;
+      }
+      card.writeSector = arg;
+      card.multiWrite = index == 25;
+      card.in = IN_WRITE_TOKEN;
+      respond(R1_READY, OUT_IDLE, 0);
+      break;
+    case 55:
+      card.appCmd = true;
+      respond(R1_READY, OUT_IDLE, 0);
+      break;
+    default:
+      respond(R1_ILLEGAL_COMMAND, OUT_IDLE, 0);
+      break;
+  }
+}
+
+static void finishWrite(void) {
+  uint16_t crc = (uint16_t)((card.writeBuf[SECTOR_SIZE] << 8) | card.writeBuf[SECTOR_SIZE + 1]);
+
+  if (card.writeSector >= card.numSectors || card.writeSector == card.config.rejectWriteSector) {
+    card.dataResponse = DATA_RESPONSE_WRITE_ERROR;
+  } else if (card.config.checkWriteCrc && crc16CcittUpdate(0, card.writeBuf, SECTOR_SIZE) != crc) {
+    card.dataResponse = DATA_RESPONSE_CRC_ERROR;
+  } else {
+    card.dataResponse = DATA_RESPONSE_ACCEPTED;
+  }
+
+  if (card.dataResponse == DATA_RESPONSE_ACCEPTED) {
+    memcpy(card.storage + (size_t)card.writeSector * SECTOR_SIZE, card.writeBuf, SECTOR_SIZE);
+    card.stats.sectorsWritten++;
+    card.writeSector++;
+  } else {
+    card.stats.rejectedWrites++;
+  }
+
+  // A multiple block write waits for the next token or the stop token, even after an error
+  card.in = card.multiWrite ? IN_WRITE_TOKEN : IN_CMD;
+  card.out = OUT_DATA_RESPONSE;
+}
+
+static uint8_t produce(void) {
+  switch (card.out) {
+    case OUT_RESPONSE:
+      if (card.countdown > 0) {
+        card.countdown--;
+        return 0xFFU;
+      }
+      if (card.afterResponse == OUT_READ_ACCESS) {
+        startRead();
+      } else {
+        card.out = card.afterResponse;
+      }
+      return card.response;
+
+    case OUT_READ_ACCESS:
+      if (card.readSector == card.config.noTokenSector) {
+        return 0xFFU;
+      }
+      if (card.countdown > 0) {
+        card.countdown--;
+        return 0xFFU;
+      }
+      card.out = OUT_READ_PACKET;
+      // fall through
+    case OUT_READ_PACKET: {
+      uint8_t byte = card.packet[card.packetPos++];
+      if (card.packetPos == card.packetLen) {
+        if (card.packetLen == 1 + SECTOR_SIZE + CRC_BYTES) {
+          card.stats.sectorsRead++;
+        }
+        if (card.multiRead) {
+          card.readSector++;
+          loadSectorPacket();
+          startRead();
+        } else {
+          card.out = OUT_IDLE;
+        }
+      }
+      return byte;
+    }
+
+    case OUT_DATA_RESPONSE:
+      card.countdown = card.config.writeBusyBytes;
+      card.out = OUT_BUSY;
+      return card.dataResponse;
+
+    case OUT_BUSY:
+      if (card.countdown > 0) {
+        card.countdown--;
+        return 0x00U;
+      }
+      card.out = OUT_IDLE;
+      return 0xFFU;
+
+    default:
+      return 0xFFU;
+  }
+}
+
+static void consume(uint8_t mosi) {
+  switch (card.in) {
+    case IN_CMD:
+      // A command starts with 0b01 in the top bits; the host holds MOSI high otherwise
+      if (card.cmdLen == 0 && (mosi & 0xC0U) != 0x40U) {
+        return;
+      }
+      card.cmd[card.cmdLen++] = mosi;
+      if (card.cmdLen == CMD_PACKET_SIZE) {
+        card.cmdLen = 0;
+        handleCommand();
+      }
+      return;
+
+    case IN_WRITE_TOKEN:
+      if (card.out == OUT_BUSY || card.out == OUT_DATA_RESPONSE) {
+        return;
+      }
+      if (mosi == (card.multiWrite ? MULTI_WRITE_TOKEN : DATA_TOKEN)) {
+        card.writePos = 0;
+        card.in = IN_WRITE_PACKET;
+      } else if (card.multiWrite && mosi == STOP_TRAN_TOKEN) {
+        card.in = IN_CMD;
+        card.countdown = card.config.writeBusyBytes;
+        card.out = OUT_BUSY;
+      }
+      return;
+
+    case IN_WRITE_PACKET:
+      card.writeBuf[card.writePos++] = mosi;
+      if (card.writePos == sizeof(card.writeBuf)) {
+        finishWrite();
+      }
+      return;
+  }
+}
+
+mock_sd_card_config_t mockSdCardDefaultConfig(void) {
+  return (mock_sd_card_config_t){
+      .ncrBytes = 1,
+      .readAccessBytes = 4,
+      .writeBusyBytes = 16,
+      .checkWriteCrc = true,
+      .corruptReadCrcSector = MOCK_SD_CARD_NO_SECTOR,
+      .rejectWriteSector = MOCK_SD_CARD_NO_SECTOR,
+      .noTokenSector = MOCK_SD_CARD_NO_SECTOR,
+  };
+}
+
+void mockSdCardInit(uint8_t *storage, uint32_t numSectors, const mock_sd_card_config_t *config) {
+  memset(&card, 0, sizeof(card));
+  card.storage = storage;
+  card.numSectors = numSectors;
+  card.config = *config;
+  card.out = OUT_IDLE;
+  card.in = IN_CMD;
+}
+
+uint8_t mockSdCardExchange(uint8_t mosi) {
+  card.stats.bytesClocked++;
+  // Full duplex: what the card drives during this byte does not depend on the byte being received
+  uint8_t miso = produce();
+  consume(mosi);
+  return miso;
+}
+
+void mockSdCardElapse(uint32_t byteTimes) {
+  if (card.out != OUT_BUSY && card.out != OUT_READ_ACCESS) {
+    return;
+  }
+  card.countdown = (byteTimes < card.countdown) ? card.countdown - byteTimes : 0;
+}
+
+const mock_sd_card_stats_t *mockSdCardStats(void) { return &card.stats; }
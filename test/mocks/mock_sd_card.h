@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MOCK_SD_CARD_NO_SECTOR UINT32_MAX
+
+/*
+ * An initialized, block addressed SD card in SPI mode, driven one byte clock at a time. It handles CMD9, CMD12,
+ * CMD17, CMD18, CMD24, CMD25, CMD55 and ACMD23 with the response, read access and write busy timing below.
+ */
+
+typedef struct {
+  uint32_t ncrBytes;         // 0xFF bytes before a command response
+  uint32_t readAccessBytes;  // 0xFF bytes before each sector's data token
+  uint32_t writeBusyBytes;   // Busy bytes after each sector write and after the stop token
+  bool checkWriteCrc;        // Reject sectors whose CRC16 does not match, as a card with CRC checking on does
+
+  // Faults; MOCK_SD_CARD_NO_SECTOR to disable
+  uint32_t corruptReadCrcSector;  // Send a bad CRC16 when this sector is read
+  uint32_t rejectWriteSector;     // Answer a write of this sector with a write error
+  uint32_t noTokenSector;         // Never send the data token for this sector
+} mock_sd_card_config_t;
+
+typedef struct {
+  uint64_t bytesClocked;
+  uint32_t commands[64];  // Commands received, by index
+  uint32_t sectorsRead;
+  uint32_t sectorsWritten;
+  uint32_t preEraseCount;  // Argument of the last ACMD23
+  uint32_t rejectedWrites;
+} mock_sd_card_stats_t;
+
+/**
+ * @brief Default timing with no faults
+ */
+mock_sd_card_config_t mockSdCardDefaultConfig(void);
+
+/**
+ * @brief Reset the card
+ *
+ * @param storage numSectors sectors backing the card
+ * @param numSectors Capacity of the card
+ * @param config Timing and faults
+ */
+void mockSdCardInit(uint8_t *storage, uint32_t numSectors, const mock_sd_card_config_t *config);
+
+/**
+ * @brief Clock one byte: mosi goes to the card and the return value is what the card drove on MISO
+ */
+uint8_t mockSdCardExchange(uint8_t mosi);
+
+/**
+ * @brief Let time pass without clocking the card, as while the host sleeps between polls
+ *
+ * @param byteTimes Elapsed time in byte clocks; shortens a read access or write busy period in progress
+ */
+void mockSdCardElapse(uint32_t byteTimes);
+
+/**
+ * @brief Counters since mockSdCardInit
+ */
+const mock_sd_card_stats_t *mockSdCardStats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,149 @@
+/*
+ * Frames per second through the ground station decode service for 1 to 8 workers, for a stream of telemetry frames
+ * framed like the OBC's downlink encoder:
+ *   clean - no errors, so RS decoding stops at the syndromes
+ *   noisy - 12 byte errors in every codeword, so every frame runs the full RS correction
+ * The whole stream is in memory and pushed in 4 KiB pieces, so the numbers are the decoder's limit rather than the
+ * radio's. Workers cannot beat the number of cores, which is printed first.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_gs/benchmark/decode-service-benchmark
+ */
+#include "gs_decode_service.h"
+#include "gs_errors.h"
+
+#include "obc_gs_ax25.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
+#include "obc_gs_telemetry_pack.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define NUM_FRAMES 4000U
+#define NOISY_BYTE_ERRORS 12U
+#define PUSH_CHUNK_BYTES 4096U
+#define IDLE_FLAGS 2U
+
+static const uint32_t WORKER_COUNTS[] = {1, 2, 4, 8};
+
+static uint64_t clockNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t nextPseudorandom(uint32_t *seed) {
+  // Pseudorandom generation using a simple algorithm
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return *seed >> 16;
+}
+
+// Returns the length of the stream of NUM_FRAMES frames written to stream
+static size_t buildStream(uint8_t *stream, uint32_t byteErrors) {
+  uint32_t seed = 0xC0FFEE;
+  size_t len = 0;
+
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+
+  for (uint32_t i = 0; i < NUM_FRAMES; i++) {
+    uint8_t packet[RS_DECODED_SIZE] = {0};
+    uint32_t offset = 0;
+    for (uint32_t j = 0; j < 20; j++) {
+      telemetry_data_t point = {.obcTemp = 20.0f + (float)j, .id = TELEM_OBC_TEMP, .timestamp = i * 100U + j};
+      uint32_t numPacked = 0;
+      packTelemetry(&point, packet + offset, RS_DECODED_SIZE - offset, &numPacked);
+      offset += numPacked;
+    }
+
+    packed_rs_packet_t fecPkt;
+    rsEncode(packet, &fecPkt);
+
+    unstuffed_ax25_i_frame_t unstuffed;
+    ax25SendIFrame(fecPkt.data, RS_ENCODED_SIZE, &unstuffed);
+    for (uint32_t j = 0; j < byteErrors; j++) {
+      unstuffed.data[AX25_INFO_FIELD_POSITION + nextPseudorandom(&seed) % RS_ENCODED_SIZE] ^= 0xA5;
+    }
+
+    packed_ax25_i_frame_t stuffed;
+    ax25Stuff(unstuffed.data, unstuffed.length, stuffed.data, &stuffed.length);
+
+    memset(stream + len, AX25_FLAG, IDLE_FLAGS);
+    len += IDLE_FLAGS;
+    memcpy(stream + len, stuffed.data, stuffed.length);
+    len += stuffed.length;
+  }
+
+  return len;
+}
+
+static void countFrame(const gs_decoded_frame_t *frame, void *context) { (*(uint32_t *)context)++; }
+
+// Returns frames per second, or 0 if the service could not start or frames went missing
+static double runDecode(const uint8_t *stream, size_t streamLen, uint32_t numWorkers, uint64_t *decoded) {
+  uint32_t delivered = 0;
+  gs_decode_config_t config = {
+      .numWorkers = numWorkers, .unpackTelemetry = true, .callback = countFrame, .context = &delivered};
+
+  gs_decode_service_t *service = NULL;
+  if (gsDecodeServiceCreate(&config, &service) != GS_ERR_CODE_SUCCESS) {
+    return 0.0;
+  }
+
+  uint64_t startNs = clockNs();
+  for (size_t offset = 0; offset < streamLen; offset += PUSH_CHUNK_BYTES) {
+    size_t len = (streamLen - offset < PUSH_CHUNK_BYTES) ? streamLen - offset : PUSH_CHUNK_BYTES;
+    gsDecodeServicePush(service, stream + offset, (uint32_t)len);
+  }
+  gsDecodeServiceFlush(service);
+  uint64_t elapsedNs = clockNs() - startNs;
+
+  gs_decode_stats_t stats;
+  gsDecodeServiceGetStats(service, &stats);
+  gsDecodeServiceDestroy(service);
+
+  *decoded = stats.decoded;
+  return (delivered == NUM_FRAMES) ? NUM_FRAMES / (elapsedNs / 1e9) : 0.0;
+}
+
+int main(void) {
+  uint8_t *clean = malloc((size_t)NUM_FRAMES * (AX25_MAXIMUM_PKT_LEN + IDLE_FLAGS));
+  uint8_t *noisy = malloc((size_t)NUM_FRAMES * (AX25_MAXIMUM_PKT_LEN + IDLE_FLAGS));
+  if (clean == NULL || noisy == NULL) {
+    printf("Out of memory\n");
+    return 1;
+  }
+
+  size_t cleanLen = buildStream(clean, 0);
+  size_t noisyLen = buildStream(noisy, NOISY_BYTE_ERRORS);
+
+  printf("Decode service, %u frames of 20 telemetry points, %ld online cores\n", NUM_FRAMES,
+         sysconf(_SC_NPROCESSORS_ONLN));
+  printf("%-8s %12s %8s %12s %8s %8s\n", "workers", "clean fps", "speedup", "noisy fps", "speedup", "decoded");
+
+  double cleanBase = 0.0;
+  double noisyBase = 0.0;
+  for (uint32_t i = 0; i < sizeof(WORKER_COUNTS) / sizeof(WORKER_COUNTS[0]); i++) {
+    uint64_t cleanDecoded = 0;
+    uint64_t noisyDecoded = 0;
+    double cleanFps = runDecode(clean, cleanLen, WORKER_COUNTS[i], &cleanDecoded);
+    double noisyFps = runDecode(noisy, noisyLen, WORKER_COUNTS[i], &noisyDecoded);
+    if (i == 0) {
+      cleanBase = cleanFps;
+      noisyBase = noisyFps;
+    }
+
+    printf("%-8u %12.0f %8.2f %12.0f %8.2f %8llu\n", WORKER_COUNTS[i], cleanFps,
+           cleanBase > 0 ? cleanFps / cleanBase : 0.0, noisyFps, noisyBase > 0 ? noisyFps / noisyBase : 0.0,
+           (unsigned long long)noisyDecoded);
+  }
+
+  free(clean);
+  free(noisy);
+  return 0;
+}
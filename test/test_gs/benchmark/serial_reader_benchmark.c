@@ -0,0 +1,188 @@
+/*
+ * CPU use and byte-to-callback latency of the CSerialPort read thread, over a pty pair standing in for the radio:
+ *   idle    - CPU time of the receiving side while the port is open and nothing arrives
+ *   load    - CPU time of the receiving side while 64B arrive every 1 ms, about 5.5 times what 115200 baud carries
+ *   latency - time from writing one byte to the master until the callback runs for it
+ * for both ways of receiving: the read event, whose callback drains the buffer with CSerialPortReadData, and the span
+ * event. The receiving side is the whole process less the writing thread, so it includes the kernel's pty work done
+ * on behalf of the read thread.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_gs/benchmark/serial-reader-benchmark
+ */
+#define _XOPEN_SOURCE 600  // posix_openpt, grantpt, unlockpt and ptsname
+
+#include "cserialport.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define IDLE_MS 2000U
+#define LOAD_MS 2000U
+#define LOAD_CHUNK_BYTES 64U
+#define LOAD_PERIOD_US 1000U
+#define LATENCY_SAMPLES 2000U
+#define LATENCY_GAP_US 200U
+
+static pthread_mutex_t receiveMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t receiveCond = PTHREAD_COND_INITIALIZER;
+static uint64_t bytesReceived;
+static uint64_t lastReceiveNs;
+
+static uint64_t clockNs(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void recordReceive(unsigned int size) {
+  uint64_t now = clockNs(CLOCK_MONOTONIC);
+
+  pthread_mutex_lock(&receiveMutex);
+  bytesReceived += size;
+  lastReceiveNs = now;
+  pthread_cond_signal(&receiveCond);
+  pthread_mutex_unlock(&receiveMutex);
+}
+
+static void onReadEvent(void *pSerialPort, const char *portName, unsigned int readBufferLen) {
+  char data[4096];
+  int len = CSerialPortReadData(pSerialPort, data, sizeof(data));
+  if (len > 0) {
+    recordReceive((unsigned int)len);
+  }
+}
+
+static void onReadSpan(void *pSerialPort, const char *portName, const char *data, unsigned int size) {
+  recordReceive(size);
+}
+
+// Returns whether count bytes arrived within a second, and when the last of them did
+static int waitForBytes(uint64_t count, uint64_t *receiveNs) {
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_sec += 1;
+
+  pthread_mutex_lock(&receiveMutex);
+  while (bytesReceived < count) {
+    if (pthread_cond_timedwait(&receiveCond, &receiveMutex, &deadline) != 0) {
+      break;
+    }
+  }
+  int received = bytesReceived >= count;
+  *receiveNs = lastReceiveNs;
+  pthread_mutex_unlock(&receiveMutex);
+
+  return received;
+}
+
+/*
+ * Percent of one core used by the process outside this thread since the given process and thread CPU times. The thread
+ * time is read last at the start and first at the end, so it stays inside the process time.
+ */
+static double receiveCpuPercent(uint64_t processStartNs, uint64_t threadStartNs, uint64_t wallNs) {
+  uint64_t threadNs = clockNs(CLOCK_THREAD_CPUTIME_ID) - threadStartNs;
+  uint64_t processNs = clockNs(CLOCK_PROCESS_CPUTIME_ID) - processStartNs;
+  return 100.0 * (double)(processNs - threadNs) / (double)wallNs;
+}
+
+static int compareU64(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+static void runMode(const char *name, int master, const char *slaveName, int useSpanEvent) {
+  void *pSerialPort = CSerialPortMalloc();
+  CSerialPortInit(pSerialPort, slaveName, 115200, ParityNone, DataBits8, StopOne, FlowNone, 4096);
+  CSerialPortSetOperateMode(pSerialPort, AsynchronousOperate);
+  CSerialPortSetReadIntervalTimeout(pSerialPort, 0);
+  if (useSpanEvent) {
+    CSerialPortConnectReadSpanEvent(pSerialPort, onReadSpan);
+  } else {
+    CSerialPortConnectReadEvent(pSerialPort, onReadEvent);
+  }
+
+  if (!CSerialPortOpen(pSerialPort)) {
+    printf("%-12s failed to open %s\n", name, slaveName);
+    CSerialPortFree(pSerialPort);
+    return;
+  }
+
+  bytesReceived = 0;
+  uint64_t sent = 0;
+  char chunk[LOAD_CHUNK_BYTES];
+  for (uint32_t i = 0; i < LOAD_CHUNK_BYTES; i++) {
+    chunk[i] = 'A' + i % 26;
+  }
+
+  uint64_t processStartNs = clockNs(CLOCK_PROCESS_CPUTIME_ID);
+  uint64_t threadStartNs = clockNs(CLOCK_THREAD_CPUTIME_ID);
+  usleep(IDLE_MS * 1000U);
+  double idlePercent = receiveCpuPercent(processStartNs, threadStartNs, IDLE_MS * 1000000ULL);
+
+  uint64_t wallStartNs = clockNs(CLOCK_MONOTONIC);
+  processStartNs = clockNs(CLOCK_PROCESS_CPUTIME_ID);
+  threadStartNs = clockNs(CLOCK_THREAD_CPUTIME_ID);
+  for (uint32_t i = 0; i < LOAD_MS * 1000U / LOAD_PERIOD_US; i++) {
+    if (write(master, chunk, sizeof(chunk)) == (ssize_t)sizeof(chunk)) {
+      sent += sizeof(chunk);
+    }
+    usleep(LOAD_PERIOD_US);
+  }
+  uint64_t receiveNs = 0;
+  waitForBytes(sent, &receiveNs);
+  double loadPercent = receiveCpuPercent(processStartNs, threadStartNs, clockNs(CLOCK_MONOTONIC) - wallStartNs);
+  pthread_mutex_lock(&receiveMutex);
+  uint64_t loadLost = sent - bytesReceived;
+  pthread_mutex_unlock(&receiveMutex);
+
+  static uint64_t latencyNs[LATENCY_SAMPLES];
+  uint32_t samples = 0;
+  for (uint32_t i = 0; i < LATENCY_SAMPLES; i++) {
+    uint64_t writeNs = clockNs(CLOCK_MONOTONIC);
+    if (write(master, chunk, 1) != 1) {
+      continue;
+    }
+    sent++;
+
+    if (waitForBytes(sent, &receiveNs)) {
+      latencyNs[samples++] = receiveNs - writeNs;
+    }
+    usleep(LATENCY_GAP_US);
+  }
+
+  CSerialPortClose(pSerialPort);
+  CSerialPortFree(pSerialPort);
+
+  if (samples == 0) {
+    printf("%-12s no bytes received\n", name);
+    return;
+  }
+
+  qsort(latencyNs, samples, sizeof(latencyNs[0]), compareU64);
+  printf("%-12s %8.2f %8.2f %8llu %8.1f %8.1f %8.1f\n", name, idlePercent, loadPercent, (unsigned long long)loadLost,
+         latencyNs[samples / 2] / 1e3, latencyNs[samples * 99 / 100] / 1e3, latencyNs[samples - 1] / 1e3);
+}
+
+int main(void) {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+    printf("No pty available\n");
+    return 1;
+  }
+  const char *slaveName = ptsname(master);
+
+  printf("CSerialPort read thread over a pty, CPU in %% of one core, latency in us\n");
+  printf("%-12s %8s %8s %8s %8s %8s %8s\n", "callback", "idle", "load", "lost", "p50", "p99", "max");
+
+  runMode("read event", master, slaveName, 0);
+  runMode("span event", master, slaveName, 1);
+
+  close(master);
+  return 0;
+}
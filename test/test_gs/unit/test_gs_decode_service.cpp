@@ -0,0 +1,302 @@
+#include "gs_decode_service.h"
+#include "gs_errors.h"
+
+#include "obc_gs_aes128.h"
+#include "obc_gs_ax25.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
+#include "obc_gs_telemetry_pack.h"
+
+extern "C" {
+#include <aes.h>
+}
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string.h>
+#include <vector>
+
+#define POINTS_PER_FRAME 3U
+#define IDLE_FLAGS 3U
+
+typedef struct {
+  uint64_t seq;
+  gs_error_code_t status;
+  bool isInfoFrame;
+  uint8_t payloadLen;
+  std::vector<uint32_t> timestamps;
+} received_frame_t;
+
+typedef struct {
+  std::mutex mutex;
+  std::vector<received_frame_t> frames;
+  bool overlapped = false;
+} frame_collector_t;
+
+static void collectFrame(const gs_decoded_frame_t *frame, void *context) {
+  frame_collector_t *collector = (frame_collector_t *)context;
+
+  // Catch two workers delivering at once
+  if (!collector->mutex.try_lock()) {
+    collector->overlapped = true;
+    collector->mutex.lock();
+  }
+
+  received_frame_t received = {frame->seq, frame->status, frame->isInfoFrame, frame->payloadLen, {}};
+  for (uint32_t i = 0; i < frame->numTelemetry; i++) {
+    received.timestamps.push_back(frame->telemetry[i].timestamp);
+  }
+  collector->frames.push_back(received);
+  collector->mutex.unlock();
+}
+
+static uint32_t nextPseudorandom(uint32_t *seed) {
+  // Pseudorandom generation using a simple algorithm
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return *seed >> 16;
+}
+
+static uint32_t pointTimestamp(uint32_t frameIndex, uint32_t point) { return 1000U + frameIndex * 10U + point; }
+
+// An uncompressed telemetry packet, zero padded, as the downlink encoder sends it
+static void packTelemetryPacket(uint32_t frameIndex, uint8_t *packet) {
+  memset(packet, 0, RS_DECODED_SIZE);
+  uint32_t offset = 0;
+  for (uint32_t i = 0; i < POINTS_PER_FRAME; i++) {
+    telemetry_data_t point = {};
+    point.id = TELEM_OBC_TEMP;
+    point.timestamp = pointTimestamp(frameIndex, i);
+    point.obcTemp = 20.5f;
+
+    uint32_t numPacked = 0;
+    ASSERT_EQ(packTelemetry(&point, packet + offset, RS_DECODED_SIZE - offset, &numPacked), OBC_GS_ERR_CODE_SUCCESS);
+    offset += numPacked;
+  }
+}
+
+/**
+ * @brief RS encodes a payload and frames it like the OBC's downlink encoder, preceded by idle flags
+ *
+ * @param codewordErrors number of codeword bytes to corrupt before the frame is stuffed
+ */
+static void appendFrame(const uint8_t *payload, uint32_t codewordErrors, std::vector<uint8_t> &stream) {
+  packed_rs_packet_t fecPkt = {0};
+  ASSERT_EQ(rsEncode((uint8_t *)payload, &fecPkt), OBC_GS_ERR_CODE_SUCCESS);
+
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+  unstuffed_ax25_i_frame_t unstuffed = {0};
+  ASSERT_EQ(ax25SendIFrame(fecPkt.data, RS_ENCODED_SIZE, &unstuffed), OBC_GS_ERR_CODE_SUCCESS);
+
+  // Varying values, since the same value repeated at a period dividing 255 can look like a codeword
+  for (uint32_t i = 0; i < codewordErrors; i++) {
+    unstuffed.data[AX25_INFO_FIELD_POSITION + i * 6U] ^= (uint8_t)(0x80U | i);
+  }
+
+  packed_ax25_i_frame_t stuffed = {0};
+  ASSERT_EQ(ax25Stuff(unstuffed.data, unstuffed.length, stuffed.data, &stuffed.length), OBC_GS_ERR_CODE_SUCCESS);
+
+  stream.insert(stream.end(), IDLE_FLAGS, AX25_FLAG);
+  stream.insert(stream.end(), stuffed.data, stuffed.data + stuffed.length);
+}
+
+// Pushes the stream in pieces of random size so frames straddle pushes
+static void pushInPieces(gs_decode_service_t *service, const std::vector<uint8_t> &stream, uint32_t seed) {
+  size_t offset = 0;
+  while (offset < stream.size()) {
+    size_t len = 1 + nextPseudorandom(&seed) % 700U;
+    if (len > stream.size() - offset) {
+      len = stream.size() - offset;
+    }
+    ASSERT_EQ(gsDecodeServicePush(service, stream.data() + offset, (uint32_t)len), GS_ERR_CODE_SUCCESS);
+    offset += len;
+  }
+}
+
+static gs_decode_config_t collectorConfig(frame_collector_t *collector, uint32_t numWorkers) {
+  gs_decode_config_t config = {};
+  config.numWorkers = numWorkers;
+  config.window = 8;
+  config.unpackTelemetry = true;
+  config.callback = collectFrame;
+  config.context = collector;
+  return config;
+}
+
+TEST(TestGsDecodeService, DeliversInStreamOrder) {
+  const uint32_t numFrames = 200;
+  std::vector<uint8_t> stream;
+  for (uint32_t i = 0; i < numFrames; i++) {
+    uint8_t payload[RS_DECODED_SIZE];
+    packTelemetryPacket(i, payload);
+    appendFrame(payload, 0, stream);
+  }
+
+  frame_collector_t collector;
+  gs_decode_config_t config = collectorConfig(&collector, 4);
+  gs_decode_service_t *service = NULL;
+  ASSERT_EQ(gsDecodeServiceCreate(&config, &service), GS_ERR_CODE_SUCCESS);
+
+  pushInPieces(service, stream, 0x1234);
+  gsDecodeServiceFlush(service);
+
+  gs_decode_stats_t stats;
+  gsDecodeServiceGetStats(service, &stats);
+  gsDecodeServiceDestroy(service);
+
+  EXPECT_EQ(stats.frames, numFrames);
+  EXPECT_EQ(stats.decoded, numFrames);
+  EXPECT_EQ(stats.failed, 0U);
+  EXPECT_FALSE(collector.overlapped);
+
+  ASSERT_EQ(collector.frames.size(), numFrames);
+  for (uint32_t i = 0; i < numFrames; i++) {
+    const received_frame_t &frame = collector.frames[i];
+    EXPECT_EQ(frame.seq, i);
+    EXPECT_EQ(frame.status, GS_ERR_CODE_SUCCESS);
+    EXPECT_TRUE(frame.isInfoFrame);
+    EXPECT_EQ(frame.payloadLen, RS_DECODED_SIZE);
+    ASSERT_EQ(frame.timestamps.size(), POINTS_PER_FRAME);
+    for (uint32_t j = 0; j < POINTS_PER_FRAME; j++) {
+      EXPECT_EQ(frame.timestamps[j], pointTimestamp(i, j));
+    }
+  }
+}
+
+TEST(TestGsDecodeService, FlagsFramesTooCorruptToCorrect) {
+  const uint32_t numFrames = 40;
+  std::vector<uint8_t> stream;
+  for (uint32_t i = 0; i < numFrames; i++) {
+    uint8_t payload[RS_DECODED_SIZE];
+    packTelemetryPacket(i, payload);
+    // Every fifth frame has more byte errors than RS can correct, the one after it a correctable number
+    uint32_t errors = (i % 5 == 0) ? 40U : (i % 5 == 1) ? 10U : 0U;
+    appendFrame(payload, errors, stream);
+  }
+
+  frame_collector_t collector;
+  gs_decode_config_t config = collectorConfig(&collector, 3);
+  gs_decode_service_t *service = NULL;
+  ASSERT_EQ(gsDecodeServiceCreate(&config, &service), GS_ERR_CODE_SUCCESS);
+
+  pushInPieces(service, stream, 0x9876);
+  // Destroying delivers whatever is still in flight
+  gsDecodeServiceDestroy(service);
+
+  ASSERT_EQ(collector.frames.size(), numFrames);
+  for (uint32_t i = 0; i < numFrames; i++) {
+    const received_frame_t &frame = collector.frames[i];
+    EXPECT_EQ(frame.seq, i);
+    if (i % 5 == 0) {
+      EXPECT_EQ(frame.status, GS_ERR_CODE_CORRUPTED_MSG);
+      EXPECT_TRUE(frame.timestamps.empty());
+    } else {
+      EXPECT_EQ(frame.status, GS_ERR_CODE_SUCCESS);
+      ASSERT_EQ(frame.timestamps.size(), POINTS_PER_FRAME);
+      EXPECT_EQ(frame.timestamps[0], pointTimestamp(i, 0));
+    }
+  }
+}
+
+TEST(TestGsDecodeService, DecryptsWithKey) {
+  const uint8_t key[AES_KEY_SIZE] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                     0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+
+  uint8_t iv[AES_IV_SIZE];
+  memset(iv, 1, AES_IV_SIZE);
+
+  // The whole codeword payload is the CTR mode ciphertext of the telemetry packet, as on the uplink
+  uint8_t payload[RS_DECODED_SIZE];
+  packTelemetryPacket(7, payload);
+  struct AES_ctx ctx;
+  AES_init_ctx_iv(&ctx, key, iv);
+  AES_CTR_xcrypt_buffer(&ctx, payload, RS_DECODED_SIZE);
+
+  std::vector<uint8_t> stream;
+  appendFrame(payload, 0, stream);
+  appendFrame(payload, 0, stream);
+
+  frame_collector_t collector;
+  gs_decode_config_t config = collectorConfig(&collector, 2);
+  config.aesKey = key;
+  config.aesIv = iv;
+  gs_decode_service_t *service = NULL;
+  ASSERT_EQ(gsDecodeServiceCreate(&config, &service), GS_ERR_CODE_SUCCESS);
+
+  ASSERT_EQ(gsDecodeServicePush(service, stream.data(), (uint32_t)stream.size()), GS_ERR_CODE_SUCCESS);
+  gsDecodeServiceFlush(service);
+  gsDecodeServiceDestroy(service);
+
+  ASSERT_EQ(collector.frames.size(), 2U);
+  for (const received_frame_t &frame : collector.frames) {
+    EXPECT_EQ(frame.status, GS_ERR_CODE_SUCCESS);
+    EXPECT_EQ(frame.payloadLen, RS_DECODED_SIZE);
+    ASSERT_EQ(frame.timestamps.size(), POINTS_PER_FRAME);
+    EXPECT_EQ(frame.timestamps[2], pointTimestamp(7, 2));
+  }
+}
+
+TEST(TestGsDecodeService, PassesLinkControlFrames) {
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+  packed_ax25_u_frame_t uFrame = {0};
+  ASSERT_EQ(ax25SendUFrame(&uFrame, U_FRAME_CMD_ACK, 1), OBC_GS_ERR_CODE_SUCCESS);
+
+  frame_collector_t collector;
+  gs_decode_config_t config = collectorConfig(&collector, 1);
+  gs_decode_service_t *service = NULL;
+  ASSERT_EQ(gsDecodeServiceCreate(&config, &service), GS_ERR_CODE_SUCCESS);
+
+  ASSERT_EQ(gsDecodeServicePush(service, uFrame.data, uFrame.length), GS_ERR_CODE_SUCCESS);
+  gsDecodeServiceDestroy(service);
+
+  ASSERT_EQ(collector.frames.size(), 1U);
+  EXPECT_EQ(collector.frames[0].status, GS_ERR_CODE_SUCCESS);
+  EXPECT_FALSE(collector.frames[0].isInfoFrame);
+}
+
+TEST(TestGsDecodeService, RejectsFrameLongerThanIFrame) {
+  // 0x55 never holds five 1s in a row, so nothing is unstuffed and the frame stays longer than an I frame
+  std::vector<uint8_t> stream(AX25_MAXIMUM_PKT_LEN, 0x55);
+  stream.front() = AX25_FLAG;
+  stream.back() = AX25_FLAG;
+
+  uint8_t payload[RS_DECODED_SIZE];
+  packTelemetryPacket(0, payload);
+  appendFrame(payload, 0, stream);
+
+  frame_collector_t collector;
+  gs_decode_config_t config = collectorConfig(&collector, 1);
+  gs_decode_service_t *service = NULL;
+  ASSERT_EQ(gsDecodeServiceCreate(&config, &service), GS_ERR_CODE_SUCCESS);
+
+  ASSERT_EQ(gsDecodeServicePush(service, stream.data(), (uint32_t)stream.size()), GS_ERR_CODE_SUCCESS);
+  gsDecodeServiceDestroy(service);
+
+  ASSERT_EQ(collector.frames.size(), 2U);
+  EXPECT_EQ(collector.frames[0].status, GS_ERR_CODE_AX25_DECODE_FAILURE);
+  EXPECT_EQ(collector.frames[1].status, GS_ERR_CODE_SUCCESS);
+}
+
+TEST(TestGsDecodeService, RejectsBadConfig) {
+  frame_collector_t collector;
+  gs_decode_service_t *service = NULL;
+
+  gs_decode_config_t config = collectorConfig(&collector, 0);
+  EXPECT_EQ(gsDecodeServiceCreate(&config, &service), GS_ERR_CODE_INVALID_ARG);
+
+  config = collectorConfig(&collector, GS_DECODE_MAX_WORKERS + 1);
+  EXPECT_EQ(gsDecodeServiceCreate(&config, &service), GS_ERR_CODE_INVALID_ARG);
+
+  config = collectorConfig(&collector, 1);
+  config.callback = NULL;
+  EXPECT_EQ(gsDecodeServiceCreate(&config, &service), GS_ERR_CODE_INVALID_ARG);
+
+  // A key needs an IV
+  const uint8_t key[AES_KEY_SIZE] = {0};
+  config = collectorConfig(&collector, 1);
+  config.aesKey = key;
+  EXPECT_EQ(gsDecodeServiceCreate(&config, &service), GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(service, nullptr);
+}
@@ -0,0 +1,123 @@
+#include "CSerialPort/ibuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+TEST(TestRingBuffer, SizeRoundsUpToPowerOfTwo) {
+  itas109::RingBuffer<char> buffer(100);
+  EXPECT_EQ(buffer.getBufferSize(), 128U);
+  EXPECT_TRUE(buffer.isEmpty());
+  EXPECT_EQ(buffer.getUnusedLen(), 128U);
+}
+
+TEST(TestRingBuffer, WriteReadAcrossEnd) {
+  itas109::RingBuffer<char> buffer(8);
+  char data[8] = {0};
+  char out[8] = {0};
+
+  // Move the indices so the next write wraps
+  EXPECT_EQ(buffer.write(data, 6), 6);
+  EXPECT_EQ(buffer.read(out, 6), 6);
+
+  for (int i = 0; i < 5; i++) {
+    data[i] = 'a' + i;
+  }
+  EXPECT_EQ(buffer.write(data, 5), 5);
+  EXPECT_EQ(buffer.getUsedLen(), 5U);
+
+  EXPECT_EQ(buffer.read(out, 8), 5);
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(out[i], 'a' + i);
+  }
+  EXPECT_TRUE(buffer.isEmpty());
+}
+
+TEST(TestRingBuffer, FullBufferRefusesNewData) {
+  itas109::RingBuffer<char> buffer(4);
+  const char data[6] = {'a', 'b', 'c', 'd', 'e', 'f'};
+  char out[6] = {0};
+
+  EXPECT_EQ(buffer.write(data, 6), 4);
+  EXPECT_TRUE(buffer.isFull());
+  EXPECT_EQ(buffer.write(data, 1), 0);
+
+  // The oldest data is kept
+  EXPECT_EQ(buffer.read(out, 6), 4);
+  EXPECT_EQ(out[0], 'a');
+  EXPECT_EQ(out[3], 'd');
+}
+
+TEST(TestRingBuffer, SpansSplitAtEnd) {
+  itas109::RingBuffer<char> buffer(8);
+  char data[8] = {0};
+  char out[8] = {0};
+  buffer.write(data, 6);
+  buffer.read(out, 6);
+
+  // Free space runs from offset 6 to the end, then wraps
+  char *writeSpan = NULL;
+  EXPECT_EQ(buffer.getWriteSpan(&writeSpan), 2U);
+  writeSpan[0] = 'x';
+  writeSpan[1] = 'y';
+  buffer.commitWrite(2);
+
+  EXPECT_EQ(buffer.getWriteSpan(&writeSpan), 6U);
+  writeSpan[0] = 'z';
+  buffer.commitWrite(1);
+
+  const char *readSpan = NULL;
+  ASSERT_EQ(buffer.getReadSpan(&readSpan), 2U);
+  EXPECT_EQ(readSpan[0], 'x');
+  EXPECT_EQ(readSpan[1], 'y');
+  buffer.consume(2);
+
+  ASSERT_EQ(buffer.getReadSpan(&readSpan), 1U);
+  EXPECT_EQ(readSpan[0], 'z');
+  buffer.consume(1);
+
+  EXPECT_EQ(buffer.getReadSpan(&readSpan), 0U);
+}
+
+TEST(TestRingBuffer, ProducerAndConsumerThreads) {
+  const uint32_t count = 100000;
+  itas109::RingBuffer<uint32_t> buffer(64);
+
+  std::thread producer([&buffer, count]() {
+    uint32_t next = 0;
+    while (next < count) {
+      uint32_t chunk[7];
+      uint32_t chunkLen = 0;
+      while (chunkLen < 7 && next + chunkLen < count) {
+        chunk[chunkLen] = next + chunkLen;
+        chunkLen++;
+      }
+      uint32_t written = buffer.write(chunk, chunkLen);
+      if (written == 0) {
+        std::this_thread::yield();
+      }
+      next += written;
+    }
+  });
+
+  // Every value arrives once, in order
+  uint32_t expected = 0;
+  bool inOrder = true;
+  while (expected < count) {
+    uint32_t chunk[5];
+    int len = buffer.read(chunk, 5);
+    if (len == 0) {
+      std::this_thread::yield();
+    }
+    for (int i = 0; i < len; i++) {
+      inOrder = inOrder && chunk[i] == expected;
+      expected++;
+    }
+  }
+
+  producer.join();
+  EXPECT_TRUE(inOrder);
+  EXPECT_TRUE(buffer.isEmpty());
+}
@@ -0,0 +1,234 @@
+#include "CSerialPort/SerialPort.h"
+#include "CSerialPort/SerialPortListener.h"
+#include "cserialport.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <fcntl.h>
+#include <mutex>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+#define RECEIVE_TIMEOUT_MS 2000
+
+// The test writes to the master side of a pty and the serial port opens the slave side
+class PtyPair {
+ public:
+  PtyPair() {
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master >= 0 && grantpt(master) == 0 && unlockpt(master) == 0) {
+      slaveName = ptsname(master);
+    }
+  }
+
+  ~PtyPair() {
+    if (master >= 0) {
+      close(master);
+    }
+  }
+
+  void write(const std::string &data) {
+    size_t written = 0;
+    while (written < data.size()) {
+      ssize_t len = ::write(master, data.data() + written, data.size() - written);
+      ASSERT_GT(len, 0);
+      written += len;
+    }
+  }
+
+  int master;
+  std::string slaveName;
+};
+
+class SpanCollector : public itas109::CSerialPortSpanListener {
+ public:
+  void onReadSpan(const char *portName, const char *data, unsigned int size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    received.append(data, size);
+    spans++;
+    cond.notify_all();
+  }
+
+  bool waitFor(size_t size) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return cond.wait_for(lock, std::chrono::milliseconds(RECEIVE_TIMEOUT_MS),
+                         [this, size]() { return received.size() >= size; });
+  }
+
+  std::mutex mutex;
+  std::condition_variable cond;
+  std::string received;
+  unsigned int spans = 0;
+};
+
+class ReadEventCounter : public itas109::CSerialPortListener {
+ public:
+  void onReadEvent(const char *portName, unsigned int readBufferLen) {
+    std::lock_guard<std::mutex> lock(mutex);
+    lastLen = readBufferLen;
+    cond.notify_all();
+  }
+
+  bool waitFor(unsigned int len) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return cond.wait_for(lock, std::chrono::milliseconds(RECEIVE_TIMEOUT_MS),
+                         [this, len]() { return lastLen >= len; });
+  }
+
+  std::mutex mutex;
+  std::condition_variable cond;
+  unsigned int lastLen = 0;
+};
+
+// Printable, so the line discipline passes it through unchanged
+static std::string pattern(size_t size) {
+  std::string data(size, '\0');
+  for (size_t i = 0; i < size; i++) {
+    data[i] = 'A' + (i * 7) % 26;
+  }
+  return data;
+}
+
+static void openPort(itas109::CSerialPort &port, const PtyPair &pty, unsigned int readBufferSize,
+                     itas109::OperateMode mode) {
+  port.init(pty.slaveName.c_str(), itas109::BaudRate115200, itas109::ParityNone, itas109::DataBits8,
+            itas109::StopOne, itas109::FlowNone, readBufferSize);
+  port.setOperateMode(mode);
+  port.setReadIntervalTimeout(0);
+  ASSERT_TRUE(port.open());
+}
+
+// Reads until size bytes arrive or the timeout passes
+static std::string readAll(itas109::CSerialPort &port, size_t size) {
+  std::string received;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(RECEIVE_TIMEOUT_MS);
+  while (received.size() < size && std::chrono::steady_clock::now() < deadline) {
+    char chunk[256];
+    int len = port.readData(chunk, sizeof(chunk));
+    if (len > 0) {
+      received.append(chunk, len);
+    } else {
+      usleep(1000);
+    }
+  }
+  return received;
+}
+
+TEST(TestSerialPortUnix, SpanEventReceivesAllBytes) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  itas109::CSerialPort port;
+  SpanCollector collector;
+  port.connectReadSpanEvent(&collector);
+  openPort(port, pty, 256, itas109::AsynchronousOperate);
+
+  // Several times the buffer, so the spans wrap around its end
+  std::string data = pattern(3000);
+  pty.write(data);
+
+  EXPECT_TRUE(collector.waitFor(data.size()));
+  port.close();
+
+  EXPECT_EQ(collector.received, data);
+  EXPECT_EQ(port.getReadBufferUsedLen(), 0U);
+}
+
+TEST(TestSerialPortUnix, ReadEventThenReadData) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  itas109::CSerialPort port;
+  ReadEventCounter counter;
+  port.connectReadEvent(&counter);
+  openPort(port, pty, 4096, itas109::AsynchronousOperate);
+
+  std::string data = pattern(100);
+  pty.write(data);
+
+  EXPECT_TRUE(counter.waitFor(data.size()));
+  EXPECT_EQ(readAll(port, data.size()), data);
+  port.close();
+}
+
+TEST(TestSerialPortUnix, FullBufferKeepsDataInPort) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  itas109::CSerialPort port;
+  openPort(port, pty, 64, itas109::AsynchronousOperate);
+
+  // More than the read buffer holds; the rest waits in the port until there is room
+  std::string data = pattern(1000);
+  pty.write(data);
+  usleep(50000);
+  EXPECT_EQ(port.getReadBufferUsedLen(), 64U);
+
+  EXPECT_EQ(readAll(port, data.size()), data);
+  port.close();
+}
+
+TEST(TestSerialPortUnix, SyncModeReadsFromPort) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  itas109::CSerialPort port;
+  openPort(port, pty, 4096, itas109::SynchronousOperate);
+
+  std::string data = pattern(100);
+  pty.write(data);
+
+  EXPECT_EQ(readAll(port, data.size()), data);
+  port.close();
+}
+
+TEST(TestSerialPortUnix, CloseWhileIdle) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  itas109::CSerialPort port;
+  openPort(port, pty, 4096, itas109::AsynchronousOperate);
+
+  // The read thread sleeps in poll and must wake up to stop
+  auto start = std::chrono::steady_clock::now();
+  port.close();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+  EXPECT_FALSE(port.isOpen());
+}
+
+static SpanCollector cApiCollector;
+static unsigned int staleSpans = 0;
+
+static void onStaleSpan(void *pSerialPort, const char *portName, const char *data, unsigned int size) { staleSpans++; }
+
+static void onCApiSpan(void *pSerialPort, const char *portName, const char *data, unsigned int size) {
+  cApiCollector.onReadSpan(portName, data, size);
+}
+
+TEST(TestSerialPortUnix, CApiReconnectReplacesSpanCallback) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  void *pSerialPort = CSerialPortMalloc();
+  CSerialPortInit(pSerialPort, pty.slaveName.c_str(), 115200, ParityNone, DataBits8, StopOne, FlowNone, 256);
+  CSerialPortSetOperateMode(pSerialPort, AsynchronousOperate);
+  CSerialPortSetReadIntervalTimeout(pSerialPort, 0);
+
+  // The listener is part of the handle, so connecting again only swaps the callback it calls
+  CSerialPortConnectReadSpanEvent(pSerialPort, onStaleSpan);
+  CSerialPortConnectReadSpanEvent(pSerialPort, onCApiSpan);
+  ASSERT_TRUE(CSerialPortOpen(pSerialPort));
+
+  std::string data = pattern(1000);
+  pty.write(data);
+  EXPECT_TRUE(cApiCollector.waitFor(data.size()));
+
+  CSerialPortDisconnectReadSpanEvent(pSerialPort);
+  CSerialPortFree(pSerialPort);
+
+  EXPECT_EQ(cApiCollector.received, data);
+  EXPECT_EQ(staleSpans, 0U);
+}
@@ -0,0 +1,150 @@
+/*
+ * Throughput and CPU use of the HIL LogSink, over a pty pair standing in for the OBC's UART:
+ *   idle  - nothing arrives for IDLE_MS
+ *   paced - 80 byte lines at the rate 115200 baud carries, for PACED_MS
+ *   burst - BURST_LINES lines written to the pty as fast as it takes them
+ * For each: CPU time of the sink's threads in % of one core (the whole process less the writing thread, so it includes
+ * the kernel's pty and file work done on their behalf), lines per second, and the read() and writev() calls made.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_hil/benchmark/logsink-benchmark
+ */
+#include "logsink.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+
+#define OUTPUT_FILE "logsink-benchmark.txt"
+#define LINE_BYTES 80U
+#define UART_BYTES_PER_SEC (115200U / 10U)  // 8N1
+#define IDLE_MS 1000U
+#define PACED_MS 2000U
+#define BURST_LINES 200000U
+#define DRAIN_TIMEOUT_MS 10000U
+
+static uint64_t clockNs(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static std::string makeLine(uint32_t index) {
+  char line[LINE_BYTES + 1];
+  int len = snprintf(line, sizeof(line), "obc/app/drivers/sdcard/sdc_bdev.c:416 - %08u ", (unsigned)index);
+  for (uint32_t i = len; i < LINE_BYTES - 1; i++) {
+    line[i] = 'a' + i % 26;
+  }
+  line[LINE_BYTES - 1] = '\n';
+  return std::string(line, LINE_BYTES);
+}
+
+static bool writeAll(int fd, const std::string &data) {
+  size_t written = 0;
+  while (written < data.size()) {
+    ssize_t len = write(fd, data.data() + written, data.size() - written);
+    if (len <= 0) {
+      return false;
+    }
+    written += len;
+  }
+  return true;
+}
+
+static bool waitForLines(const LogSink &sink, uint64_t lines) {
+  uint64_t deadlineNs = clockNs(CLOCK_MONOTONIC) + DRAIN_TIMEOUT_MS * 1000000ULL;
+  while (sink.getStats().lines < lines) {
+    if (clockNs(CLOCK_MONOTONIC) > deadlineNs) {
+      return false;
+    }
+    usleep(100);
+  }
+  return true;
+}
+
+static void printRow(const char *name, uint64_t processStartNs, uint64_t threadStartNs, uint64_t wallStartNs,
+                     uint64_t lines, const LogSink &sink) {
+  // The thread time is read last at the start and first at the end, so it stays inside the process time
+  uint64_t threadNs = clockNs(CLOCK_THREAD_CPUTIME_ID) - threadStartNs;
+  uint64_t processNs = clockNs(CLOCK_PROCESS_CPUTIME_ID) - processStartNs;
+  uint64_t wallNs = clockNs(CLOCK_MONOTONIC) - wallStartNs;
+
+  LogSinkStats stats = sink.getStats();
+  printf("%-6s %8.2f %10.0f %8llu %8llu %8llu %8llu %10.0f\n", name, 100.0 * (double)(processNs - threadNs) / wallNs,
+         lines * 1e9 / wallNs, (unsigned long long)stats.lines, (unsigned long long)stats.reads,
+         (unsigned long long)stats.writes, (unsigned long long)stats.readWaits,
+         stats.writes ? (double)stats.bytes / stats.writes : 0.0);
+}
+
+int main(void) {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+    printf("No pty available\n");
+    return 1;
+  }
+  std::string slaveName = ptsname(master);
+
+  printf("LogSink over a pty, CPU in %% of one core\n");
+  printf("%-6s %8s %10s %8s %8s %8s %8s %10s\n", "mode", "cpu", "lines/s", "lines", "reads", "writes", "waits",
+         "B/write");
+
+  {
+    LogSink sink(slaveName, 115200, OUTPUT_FILE);
+    if (sink.start() != 0) {
+      return 1;
+    }
+    uint64_t wallStartNs = clockNs(CLOCK_MONOTONIC);
+    uint64_t processStartNs = clockNs(CLOCK_PROCESS_CPUTIME_ID);
+    uint64_t threadStartNs = clockNs(CLOCK_THREAD_CPUTIME_ID);
+    usleep(IDLE_MS * 1000U);
+    printRow("idle", processStartNs, threadStartNs, wallStartNs, 0, sink);
+    sink.stop();
+  }
+
+  {
+    LogSink sink(slaveName, 115200, OUTPUT_FILE);
+    if (sink.start() != 0) {
+      return 1;
+    }
+    const uint32_t periodUs = LINE_BYTES * 1000000U / UART_BYTES_PER_SEC;
+    const uint32_t numLines = PACED_MS * 1000U / periodUs;
+    uint64_t wallStartNs = clockNs(CLOCK_MONOTONIC);
+    uint64_t processStartNs = clockNs(CLOCK_PROCESS_CPUTIME_ID);
+    uint64_t threadStartNs = clockNs(CLOCK_THREAD_CPUTIME_ID);
+    for (uint32_t i = 0; i < numLines; i++) {
+      writeAll(master, makeLine(i));
+      usleep(periodUs);
+    }
+    waitForLines(sink, numLines);
+    printRow("paced", processStartNs, threadStartNs, wallStartNs, numLines, sink);
+    sink.stop();
+  }
+
+  {
+    std::string burst;
+    for (uint32_t i = 0; i < BURST_LINES; i++) {
+      burst += makeLine(i);
+    }
+
+    LogSink sink(slaveName, 115200, OUTPUT_FILE);
+    if (sink.start() != 0) {
+      return 1;
+    }
+    uint64_t wallStartNs = clockNs(CLOCK_MONOTONIC);
+    uint64_t processStartNs = clockNs(CLOCK_PROCESS_CPUTIME_ID);
+    uint64_t threadStartNs = clockNs(CLOCK_THREAD_CPUTIME_ID);
+    writeAll(master, burst);
+    if (!waitForLines(sink, BURST_LINES)) {
+      printf("burst  lost %llu lines\n", (unsigned long long)(BURST_LINES - sink.getStats().lines));
+    }
+    printRow("burst", processStartNs, threadStartNs, wallStartNs, BURST_LINES, sink);
+    sink.stop();
+  }
+
+  unlink(OUTPUT_FILE);
+  close(master);
+  return 0;
+}
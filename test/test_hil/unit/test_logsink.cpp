@@ -0,0 +1,241 @@
+#include "logsink.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fcntl.h>
+#include <fstream>
+#include <regex>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#define RECEIVE_TIMEOUT_MS 5000
+
+// The test writes to the master side of a pty, which stands in for the OBC's end of the UART
+class PtyPair {
+ public:
+  PtyPair() {
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master >= 0 && grantpt(master) == 0 && unlockpt(master) == 0) {
+      slaveName = ptsname(master);
+    }
+  }
+
+  ~PtyPair() {
+    if (master >= 0) {
+      close(master);
+    }
+  }
+
+  void write(const std::string &data) {
+    size_t written = 0;
+    while (written < data.size()) {
+      ssize_t len = ::write(master, data.data() + written, data.size() - written);
+      ASSERT_GT(len, 0);
+      written += len;
+    }
+  }
+
+  int master;
+  std::string slaveName;
+};
+
+static std::string outputPath() { return testing::TempDir() + "logsink_test.txt"; }
+
+static bool waitForLines(const LogSink &sink, uint64_t lines) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(RECEIVE_TIMEOUT_MS);
+  while (sink.getStats().lines < lines) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    usleep(1000);
+  }
+  return true;
+}
+
+static std::vector<std::string> readLines(const std::string &path) {
+  std::ifstream file(path);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+// Strips the "[hh:mm:ss AM] " prefix after checking it
+static std::string payload(const std::string &line) {
+  static const std::regex prefix("^\\[(0[1-9]|1[0-2]):[0-5][0-9]:[0-5][0-9] (AM|PM)\\] ");
+  EXPECT_TRUE(std::regex_search(line, prefix)) << line;
+  return line.substr(LOGSINK_PREFIX_LENGTH);
+}
+
+TEST(TestLogSink, WritesTimestampedLines) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  LogSink sink(pty.slaveName, 115200, outputPath());
+  ASSERT_EQ(sink.start(), 0);
+  pty.write("obc/app/drivers/sdcard/sdc_bdev.c:416 - 108\nsecond line\n");
+  EXPECT_TRUE(waitForLines(sink, 2));
+  EXPECT_EQ(sink.stop(), 0);
+
+  std::vector<std::string> lines = readLines(outputPath());
+  ASSERT_EQ(lines.size(), 2U);
+  EXPECT_EQ(payload(lines[0]), "obc/app/drivers/sdcard/sdc_bdev.c:416 - 108");
+  EXPECT_EQ(payload(lines[1]), "second line");
+}
+
+TEST(TestLogSink, JoinsLineSplitAcrossReads) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  LogSink sink(pty.slaveName, 115200, outputPath());
+  ASSERT_EQ(sink.start(), 0);
+  pty.write("first ha");
+  usleep(20000);
+  pty.write("lf\nnext");
+  usleep(20000);
+  pty.write(" one\n");
+  EXPECT_TRUE(waitForLines(sink, 2));
+  sink.stop();
+
+  EXPECT_GE(sink.getStats().reads, 3U);
+  std::vector<std::string> lines = readLines(outputPath());
+  ASSERT_EQ(lines.size(), 2U);
+  EXPECT_EQ(payload(lines[0]), "first half");
+  EXPECT_EQ(payload(lines[1]), "next one");
+}
+
+TEST(TestLogSink, BurstLargerThanArenaIsLossless) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  LogSink sink(pty.slaveName, 115200, outputPath());
+  ASSERT_EQ(sink.start(), 0);
+
+  // Several arenas worth in one write; the pty holds it back whenever the sink falls behind
+  const uint32_t numLines = 4 * LOGSINK_ARENA_SIZE / 64;
+  std::string burst;
+  for (uint32_t i = 0; i < numLines; i++) {
+    char line[64];
+    snprintf(line, sizeof(line), "log %08u %s\n", (unsigned)i, "abcdefghijklmnopqrstuvwxyz0123456789");
+    burst += line;
+  }
+  pty.write(burst);
+
+  EXPECT_TRUE(waitForLines(sink, numLines));
+  sink.stop();
+
+  std::vector<std::string> lines = readLines(outputPath());
+  ASSERT_EQ(lines.size(), numLines);
+  for (uint32_t i = 0; i < numLines; i++) {
+    char expected[64];
+    snprintf(expected, sizeof(expected), "log %08u %s", (unsigned)i, "abcdefghijklmnopqrstuvwxyz0123456789");
+    ASSERT_EQ(lines[i].substr(LOGSINK_PREFIX_LENGTH), expected) << "line " << i;
+  }
+
+  // Lines are batched rather than written one at a time
+  LogSinkStats stats = sink.getStats();
+  EXPECT_LT(stats.writes, stats.lines);
+  EXPECT_EQ(stats.bytes, numLines * (LOGSINK_PREFIX_LENGTH + 50U));
+}
+
+TEST(TestLogSink, SplitsOverlongLines) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  LogSink sink(pty.slaveName, 115200, outputPath());
+  ASSERT_EQ(sink.start(), 0);
+  std::string longLine(2 * LOGSINK_MAX_LINE_LENGTH + 10, 'x');
+  pty.write(longLine + "\n");
+  EXPECT_TRUE(waitForLines(sink, 3));
+  sink.stop();
+
+  std::vector<std::string> lines = readLines(outputPath());
+  ASSERT_EQ(lines.size(), 3U);
+  EXPECT_EQ(payload(lines[0]).size(), LOGSINK_MAX_LINE_LENGTH);
+  EXPECT_EQ(payload(lines[1]).size(), LOGSINK_MAX_LINE_LENGTH);
+  EXPECT_EQ(payload(lines[2]), std::string(10, 'x'));
+}
+
+TEST(TestLogSink, StopKeepsUnfinishedLine) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  LogSink sink(pty.slaveName, 115200, outputPath());
+  ASSERT_EQ(sink.start(), 0);
+  pty.write("done\ncut off");
+
+  EXPECT_TRUE(waitForLines(sink, 1));
+  usleep(20000);
+
+  // The read thread sleeps in poll and must wake up to stop
+  auto start = std::chrono::steady_clock::now();
+  sink.stop();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+  EXPECT_FALSE(sink.isRunning());
+
+  std::vector<std::string> lines = readLines(outputPath());
+  ASSERT_EQ(lines.size(), 2U);
+  EXPECT_EQ(payload(lines[0]), "done");
+  EXPECT_EQ(payload(lines[1]), "cut off");
+}
+
+TEST(TestLogSink, ReadErrorStopsLog) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  LogSink sink(pty.slaveName, 115200, outputPath());
+  ASSERT_EQ(sink.start(), 0);
+  pty.write("last words\n");
+  EXPECT_TRUE(waitForLines(sink, 1));
+
+  // Reads from the slave fail once the master is gone
+  close(pty.master);
+  pty.master = -1;
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(RECEIVE_TIMEOUT_MS);
+  while (sink.isRunning() && std::chrono::steady_clock::now() < deadline) {
+    usleep(1000);
+  }
+  EXPECT_FALSE(sink.isRunning());
+  EXPECT_EQ(sink.stop(), 0);
+
+  std::vector<std::string> lines = readLines(outputPath());
+  ASSERT_EQ(lines.size(), 1U);
+  EXPECT_EQ(payload(lines[0]), "last words");
+}
+
+TEST(TestLogSink, RestartTruncatesFile) {
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+
+  LogSink sink(pty.slaveName, 115200, outputPath());
+  ASSERT_EQ(sink.start(), 0);
+  pty.write("before\n");
+  EXPECT_TRUE(waitForLines(sink, 1));
+  sink.stop();
+
+  ASSERT_EQ(sink.start(), 0);
+  pty.write("after\n");
+  EXPECT_TRUE(waitForLines(sink, 1));
+  sink.stop();
+
+  std::vector<std::string> lines = readLines(outputPath());
+  ASSERT_EQ(lines.size(), 1U);
+  EXPECT_EQ(payload(lines[0]), "after");
+}
+
+TEST(TestLogSink, StartFailsWithoutPort) {
+  LogSink missingPort("/dev/does-not-exist", 115200, outputPath());
+  EXPECT_EQ(missingPort.start(), -1);
+  EXPECT_FALSE(missingPort.isRunning());
+
+  PtyPair pty;
+  ASSERT_FALSE(pty.slaveName.empty());
+  LogSink badBaud(pty.slaveName, 12345, outputPath());
+  EXPECT_EQ(badBaud.start(), -1);
+}
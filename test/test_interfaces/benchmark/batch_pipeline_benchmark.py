@@ -0,0 +1,97 @@
+"""
+Frames per second through the Python bindings for a recorded pass, one frame per ctypes call against one batch call:
+  per frame FEC   - the FEC binding called frame by frame, with the slicing CommsPipeline.decode_frame does around it
+  CommsPipeline   - CommsPipeline.encode_frame/decode_frame end to end, when pyham_ax25, pyStuffing and tinyaes are
+                    installed
+  batch           - BatchPipeline.encode/decode on one buffer holding every frame
+The per frame FEC row leaves out unstuffing, framing and AES, so it understates the cost of the per frame path.
+
+Build the GS shared library first (cmake -DCMAKE_BUILD_TYPE=GS into build_gs), then from the repository root run
+  PYTHONPATH=. python test/test_interfaces/benchmark/batch_pipeline_benchmark.py
+"""
+
+import random
+import time
+from collections.abc import Callable
+from itertools import accumulate
+
+from interfaces import INFO_FIELD_END_POSITION, INFO_FIELD_START_POSITION, RS_DECODED_DATA_SIZE
+from interfaces.obc_gs_interface.batch import BatchPipeline
+from interfaces.obc_gs_interface.fec import FEC
+
+NUM_FRAMES = 2000
+# CommsPipeline unstuffs bit by bit in Python, so it only gets a sample of the pass
+NUM_COMMS_PIPELINE_FRAMES = 50
+
+
+def frames_per_second(num_frames: int, run: Callable[[], object]) -> float:
+    start = time.perf_counter()
+    run()
+    return num_frames / (time.perf_counter() - start)
+
+
+def main() -> None:
+    rng = random.Random(0xC0FFEE)
+    payloads = [bytes(rng.randrange(256) for _ in range(RS_DECODED_DATA_SIZE)) for _ in range(NUM_FRAMES)]
+
+    batch = BatchPipeline()
+    frames = [frame for frame in batch.encode_frames(payloads) if frame is not None]
+
+    # A recorded pass: every frame in one buffer, located by offset
+    stream = b"".join(frames)
+    lengths = [len(frame) for frame in frames]
+    offsets = [0, *accumulate(lengths[:-1])]
+
+    fec = FEC()
+    codewords = [fec.encode(payload) for payload in payloads]
+    unstuffed = [bytes(INFO_FIELD_START_POSITION) + codeword + bytes(3) for codeword in codewords]
+
+    def decode_per_frame_fec() -> None:
+        for frame in unstuffed:
+            fec_data = fec.decode(frame[INFO_FIELD_START_POSITION : INFO_FIELD_END_POSITION + 1])
+            bytes(frame[:INFO_FIELD_START_POSITION] + fec_data + frame[INFO_FIELD_END_POSITION + 1 :])
+
+    def encode_per_frame_fec() -> None:
+        for payload in payloads:
+            fec.encode(payload)
+
+    rows = [
+        ("per frame FEC", frames_per_second(NUM_FRAMES, encode_per_frame_fec)),
+        ("batch", frames_per_second(NUM_FRAMES, lambda: batch.encode_frames(payloads))),
+    ]
+    decode_rows = [
+        ("per frame FEC", frames_per_second(NUM_FRAMES, decode_per_frame_fec)),
+        ("batch", frames_per_second(NUM_FRAMES, lambda: batch.decode(stream, offsets, lengths))),
+    ]
+
+    try:
+        from gs.backend.obc_utils.encode_decode import CommsPipeline
+    except ImportError as error:
+        print(f"CommsPipeline skipped: {error}")
+    else:
+        comms = CommsPipeline()
+        sample = payloads[:NUM_COMMS_PIPELINE_FRAMES]
+        comms_frames = [comms.encode_frame(payload) for payload in sample]
+        rows.insert(
+            1,
+            (
+                "CommsPipeline",
+                frames_per_second(len(sample), lambda: [comms.encode_frame(payload) for payload in sample]),
+            ),
+        )
+        decode_rows.insert(
+            1,
+            (
+                "CommsPipeline",
+                frames_per_second(len(sample), lambda: [comms.decode_frame(frame) for frame in comms_frames]),
+            ),
+        )
+
+    print(f"{NUM_FRAMES} frames of {RS_DECODED_DATA_SIZE} bytes")
+    print(f"{'':16} {'encode fps':>12} {'decode fps':>12}")
+    for (name, encode_fps), (_, decode_fps) in zip(rows, decode_rows, strict=True):
+        print(f"{name:16} {encode_fps:12.0f} {decode_fps:12.0f}")
+
+
+if __name__ == "__main__":
+    main()
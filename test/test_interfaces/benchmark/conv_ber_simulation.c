@@ -0,0 +1,194 @@
+/*
+ * Bit and frame error rates of the CCSDS k = 7 convolutional code against Eb/N0 on a BPSK AWGN channel, and the
+ * Viterbi decoder's throughput.
+ *
+ * Eb is the energy per information bit, so each scheme pays for its own redundancy: RS(255,223) sends 255/223 symbols
+ * per bit and the concatenated code twice that. The Eb/N0 where a scheme stops losing frames shows how much faster
+ * the CC1120 could run for the same link budget.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_interfaces/benchmark/conv-ber-simulation
+ */
+#include "obc_gs_conv_ccsds.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SIMULATION_FRAMES 200U
+#define THROUGHPUT_ITERATIONS 500U
+
+// Soft symbols are 127.5 + SOFT_SYMBOL_SCALE * received amplitude, clipped to a byte
+#define SOFT_SYMBOL_SCALE 40.0
+
+typedef struct {
+  uint32_t bitErrorsUncoded;
+  uint32_t bitErrorsHard;
+  uint32_t bitErrorsSoft;
+  uint32_t frameErrorsRs;
+  uint32_t frameErrorsConvRs;
+} simulation_result_t;
+
+static conv_ccsds_decoder_t decoder;
+
+static uint32_t seed = 0xEB40;
+
+static uint32_t nextPseudorandom(void) {
+  // xorshift32; the LCG used elsewhere is too short for millions of Gaussian samples
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+static double nextGaussian(void) {
+  // Box-Muller transform
+  double u1 = ((double)nextPseudorandom() + 1.0) / 4294967297.0;
+  double u2 = (double)nextPseudorandom() / 4294967296.0;
+  return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static double secondsNow(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static uint8_t getBit(const uint8_t *data, uint32_t index) { return (data[index / 8] >> (7 - index % 8)) & 1U; }
+
+static uint32_t countBitErrors(const uint8_t *a, const uint8_t *b, uint32_t len) {
+  uint32_t errors = 0;
+  for (uint32_t i = 0; i < len; ++i) {
+    errors += (uint32_t)__builtin_popcount(a[i] ^ b[i]);
+  }
+  return errors;
+}
+
+/**
+ * @brief sends numBits packed bits as BPSK over AWGN
+ *
+ * @param bits the packed bits to send
+ * @param numBits number of bits
+ * @param esN0Db energy per channel symbol over noise density in dB
+ * @param symbols set to one soft symbol per bit
+ */
+static void transmit(const uint8_t *bits, uint32_t numBits, double esN0Db, uint8_t *symbols) {
+  double sigma = sqrt(1.0 / (2.0 * pow(10.0, esN0Db / 10.0)));
+  for (uint32_t i = 0; i < numBits; ++i) {
+    double amplitude = (getBit(bits, i) ? 1.0 : -1.0) + sigma * nextGaussian();
+    double symbol = 127.5 + SOFT_SYMBOL_SCALE * amplitude;
+    symbols[i] = (symbol < 0.0) ? 0U : (symbol > 255.0) ? 255U : (uint8_t)symbol;
+  }
+}
+
+static void hardDecide(const uint8_t *symbols, uint32_t numBits, uint8_t *bits) {
+  memset(bits, 0, (numBits + 7) / 8);
+  for (uint32_t i = 0; i < numBits; ++i) {
+    bits[i / 8] |= (uint8_t)((symbols[i] >= 128U) << (7 - i % 8));
+  }
+}
+
+static bool rsRecovers(packed_rs_packet_t *received, const uint8_t *message) {
+  uint8_t decoded[RS_DECODED_SIZE];
+  return rsDecode(received, decoded, RS_DECODED_SIZE) == OBC_GS_ERR_CODE_SUCCESS &&
+         memcmp(decoded, message, RS_DECODED_SIZE) == 0;
+}
+
+static void simulate(double ebN0Db, simulation_result_t *result) {
+  static uint8_t symbols[CONV_SOFT_SYMBOLS];
+  double rsRateDb = 10.0 * log10((double)RS_DECODED_SIZE / RS_ENCODED_SIZE);
+  double convRateDb = 10.0 * log10(0.5);
+
+  for (uint32_t frame = 0; frame < SIMULATION_FRAMES; ++frame) {
+    uint8_t message[RS_DECODED_SIZE];
+    for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+      message[i] = (uint8_t)nextPseudorandom();
+    }
+
+    packed_rs_packet_t rsData = {0};
+    packed_conv_packet_t convData = {0};
+    if (rsEncode(message, &rsData) != OBC_GS_ERR_CODE_SUCCESS ||
+        convEncode(&rsData, &convData) != OBC_GS_ERR_CODE_SUCCESS) {
+      printf("FAILED: could not encode frame %u\n", (unsigned)frame);
+      exit(1);
+    }
+
+    // Uncoded bits, for the baseline bit error rate
+    packed_rs_packet_t received;
+    transmit(rsData.data, RS_ENCODED_SIZE * 8U, ebN0Db, symbols);
+    hardDecide(symbols, RS_ENCODED_SIZE * 8U, received.data);
+    result->bitErrorsUncoded += countBitErrors(received.data, rsData.data, RS_ENCODED_SIZE);
+
+    // RS alone
+    transmit(rsData.data, RS_ENCODED_SIZE * 8U, ebN0Db + rsRateDb, symbols);
+    hardDecide(symbols, RS_ENCODED_SIZE * 8U, received.data);
+    result->frameErrorsRs += !rsRecovers(&received, message);
+
+    // Convolutional code inside RS; the same channel symbols go through both Viterbi decoders
+    transmit(convData.data, CONV_SOFT_SYMBOLS, ebN0Db + rsRateDb + convRateDb, symbols);
+
+    packed_conv_packet_t hardBits;
+    hardDecide(symbols, CONV_SOFT_SYMBOLS, hardBits.data);
+    convDecode(&decoder, &hardBits, &received);
+    result->bitErrorsHard += countBitErrors(received.data, rsData.data, RS_ENCODED_SIZE);
+
+    convDecodeSoft(&decoder, symbols, &received);
+    result->bitErrorsSoft += countBitErrors(received.data, rsData.data, RS_ENCODED_SIZE);
+    result->frameErrorsConvRs += !rsRecovers(&received, message);
+  }
+}
+
+static void benchmarkThroughput(void) {
+  static uint8_t symbols[CONV_SOFT_SYMBOLS];
+  packed_rs_packet_t rsData = {0};
+  packed_conv_packet_t convData = {0};
+  for (uint16_t i = 0; i < RS_ENCODED_SIZE; ++i) {
+    rsData.data[i] = (uint8_t)nextPseudorandom();
+  }
+  convEncode(&rsData, &convData);
+  transmit(convData.data, CONV_SOFT_SYMBOLS, 3.0, symbols);
+
+  packed_rs_packet_t received;
+  double start = secondsNow();
+  for (uint32_t i = 0; i < THROUGHPUT_ITERATIONS; ++i) {
+    convDecodeSoft(&decoder, symbols, &received);
+  }
+  double softSeconds = secondsNow() - start;
+
+  start = secondsNow();
+  for (uint32_t i = 0; i < THROUGHPUT_ITERATIONS; ++i) {
+    convDecode(&decoder, &convData, &received);
+  }
+  double hardSeconds = secondsNow() - start;
+
+  double bits = (double)THROUGHPUT_ITERATIONS * RS_ENCODED_SIZE * 8U;
+  printf("[ CONV     ] viterbi soft %6.2f Mbit/s, hard %6.2f Mbit/s, %7.1f us per codeword\n",
+         bits / softSeconds / 1e6, bits / hardSeconds / 1e6, softSeconds * 1e6 / THROUGHPUT_ITERATIONS);
+}
+
+int main(void) {
+  initRs();
+
+  printf("%u frames of %u bytes per point\n", (unsigned)SIMULATION_FRAMES, (unsigned)RS_ENCODED_SIZE);
+  printf("[ CONV     ] Eb/N0   BER uncoded   BER hard   BER soft   FER rs   FER conv+rs\n");
+
+  for (int32_t tenthsDb = 0; tenthsDb <= 80; tenthsDb += 10) {
+    simulation_result_t result = {0};
+    simulate(tenthsDb / 10.0, &result);
+
+    double bits = (double)SIMULATION_FRAMES * RS_ENCODED_SIZE * 8U;
+    printf("[ CONV     ] %4.1f dB  %10.2e  %9.2e  %9.2e  %7.3f  %11.3f\n", tenthsDb / 10.0,
+           result.bitErrorsUncoded / bits, result.bitErrorsHard / bits, result.bitErrorsSoft / bits,
+           (double)result.frameErrorsRs / SIMULATION_FRAMES, (double)result.frameErrorsConvRs / SIMULATION_FRAMES);
+  }
+
+  benchmarkThroughput();
+
+  destroyRs();
+  return 0;
+}
@@ -0,0 +1,209 @@
+/*
+ * Simulates the uplink receive path over a bursty channel and reports how many frames are recovered by errors-only
+ * Reed-Solomon decoding and by erasure decoding driven by link quality and AX.25 framing hints.
+ *
+ * Stuffed I frames are sent back to back and received in TXRX_INTERRUPT_THRESHOLD sized chunks. A burst hits a chunk
+ * with the given probability and XORs random values into a run of bytes. The radio flags a chunk as having poor link
+ * quality when a burst hits it, with some misses and false alarms, the same way cc1120_txrx.c samples RSSI and LQI
+ * once per chunk. Frame boundaries are taken from the sender, so only decoding is measured, not resynchronization.
+ *
+ * Two channels are simulated:
+ *   - stuffed: bursts hit the stuffed bits on the air. A burst that breaks a stuffing bit shifts the rest of the
+ *     frame, which no decoder can undo, so long bursts mostly end up as slips.
+ *   - symbol: bursts hit the unstuffed frame, so every burst is a run of byte errors. This is the upper bound on what
+ *     the hints can add once slips are out of the picture.
+ *
+ * "no slip" is the share of frames that unstuff to the right length. A few frames are lost even on a clean channel:
+ * ax25Unstuff trims trailing zero bytes as stuffing padding, which also removes an FCS that ends in 0x00.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_interfaces/benchmark/rs-erasure-simulation
+ */
+#include "obc_gs_ax25.h"
+#include "obc_gs_erasure_hints.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIMULATION_FRAMES 2000U
+
+// Matches TXRX_INTERRUPT_THRESHOLD in cc1120.h
+#define SIMULATION_CHUNK_SIZE 100U
+
+#define BURST_MIN_LEN 4U
+#define BURST_MAX_LEN 28U
+
+// Percent chance that the radio misses a burst, or flags a clean chunk
+#define LINK_QUALITY_MISS_PERCENT 10U
+#define LINK_QUALITY_FALSE_ALARM_PERCENT 5U
+
+#define MAX_POOR_RANGES 8U
+
+typedef enum {
+  CHANNEL_STUFFED,
+  CHANNEL_SYMBOL,
+} channel_t;
+
+typedef struct {
+  uint32_t recoveredErrorsOnly;
+  uint32_t recoveredFramingHints;
+  uint32_t recoveredAllHints;
+  uint32_t lengthIntact;
+} simulation_result_t;
+
+static uint32_t seed = 0xB0257;
+
+static uint32_t nextPseudorandom(void) {
+  // Pseudorandom generation using a simple algorithm
+  seed = (seed * 1103515245 + 12345) % (1U << 31);
+  return seed >> 16;
+}
+
+static bool chance(uint32_t percent) { return nextPseudorandom() % 100U < percent; }
+
+static bool decodedMatches(packed_rs_packet_t rsData, const rs_erasure_hints_t *hints, const uint8_t *message) {
+  uint8_t decoded[RS_DECODED_SIZE];
+  obc_gs_error_code_t errCode = (hints == NULL) ? rsDecode(&rsData, decoded, RS_DECODED_SIZE)
+                                                : rsDecodeWithErasureHints(&rsData, hints, decoded, RS_DECODED_SIZE,
+                                                                           NULL);
+  return errCode == OBC_GS_ERR_CODE_SUCCESS && memcmp(decoded, message, RS_DECODED_SIZE) == 0;
+}
+
+/**
+ * @brief corrupts a frame chunk by chunk and records the chunks the radio would flag
+ *
+ * @param data the frame including both flags, which are never corrupted
+ * @param dataLen number of bytes in data
+ * @param burstPercent chance that a burst hits a chunk
+ * @param poorRanges stores the flagged ranges of data
+ *
+ * @return uint8_t - the number of ranges stored
+ */
+static uint8_t corruptFrame(uint8_t *data, uint16_t dataLen, uint32_t burstPercent, ax25_byte_range_t *poorRanges) {
+  // Frames are sent back to back, so a frame starts anywhere within a chunk
+  uint32_t chunkPhase = nextPseudorandom() % SIMULATION_CHUNK_SIZE;
+  uint8_t numPoorRanges = 0;
+
+  for (int32_t chunkStart = -(int32_t)chunkPhase; chunkStart < (int32_t)dataLen; chunkStart += SIMULATION_CHUNK_SIZE) {
+    int32_t chunkEnd = chunkStart + SIMULATION_CHUNK_SIZE;
+    bool burstHit = chance(burstPercent);
+
+    if (burstHit) {
+      uint32_t burstLen = BURST_MIN_LEN + nextPseudorandom() % (BURST_MAX_LEN - BURST_MIN_LEN + 1);
+      int32_t burstStart = chunkStart + (int32_t)(nextPseudorandom() % SIMULATION_CHUNK_SIZE);
+      for (int32_t i = burstStart; i < burstStart + (int32_t)burstLen && i < chunkEnd; ++i) {
+        // Flags are left alone; frame sync is not what is being measured
+        if (i > 0 && i < (int32_t)dataLen - 1) {
+          data[i] ^= (uint8_t)(nextPseudorandom() | 1U);
+        }
+      }
+    }
+
+    bool flagged = burstHit ? !chance(LINK_QUALITY_MISS_PERCENT) : chance(LINK_QUALITY_FALSE_ALARM_PERCENT);
+    if (flagged && numPoorRanges < MAX_POOR_RANGES) {
+      int32_t start = (chunkStart < 0) ? 0 : chunkStart;
+      int32_t end = (chunkEnd > (int32_t)dataLen) ? (int32_t)dataLen : chunkEnd;
+      poorRanges[numPoorRanges].start = (uint16_t)start;
+      poorRanges[numPoorRanges].length = (uint16_t)(end - start);
+      numPoorRanges++;
+    }
+  }
+
+  return numPoorRanges;
+}
+
+static void simulateFrame(channel_t channel, uint32_t burstPercent, simulation_result_t *result) {
+  uint8_t message[RS_DECODED_SIZE];
+  for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+    message[i] = (uint8_t)nextPseudorandom();
+  }
+
+  packed_rs_packet_t sent = {0};
+  unstuffed_ax25_i_frame_t unstuffed = {0};
+  packed_ax25_i_frame_t stuffed = {0};
+  if (rsEncode(message, &sent) != OBC_GS_ERR_CODE_SUCCESS ||
+      ax25SendIFrame(sent.data, RS_ENCODED_SIZE, &unstuffed) != OBC_GS_ERR_CODE_SUCCESS ||
+      ax25Stuff(unstuffed.data, unstuffed.length, stuffed.data, &stuffed.length) != OBC_GS_ERR_CODE_SUCCESS) {
+    printf("FAILED: could not build a frame\n");
+    exit(1);
+  }
+
+  ax25_byte_range_t poorRanges[MAX_POOR_RANGES];
+  uint8_t numPoorRanges;
+
+  if (channel == CHANNEL_STUFFED) {
+    numPoorRanges = corruptFrame(stuffed.data, stuffed.length, burstPercent, poorRanges);
+  } else {
+    unstuffed_ax25_i_frame_t corrupted = unstuffed;
+    numPoorRanges = corruptFrame(corrupted.data, corrupted.length, burstPercent, poorRanges);
+
+    memset(&stuffed, 0, sizeof(stuffed));
+    if (ax25Stuff(corrupted.data, corrupted.length, stuffed.data, &stuffed.length) != OBC_GS_ERR_CODE_SUCCESS) {
+      return;
+    }
+    // The radio sees stuffed bytes, so move the flagged ranges there
+    for (uint8_t i = 0; i < numPoorRanges; ++i) {
+      uint32_t end = (uint32_t)poorRanges[i].start + poorRanges[i].length;
+      poorRanges[i].start = (uint16_t)((uint32_t)poorRanges[i].start * stuffed.length / corrupted.length);
+      poorRanges[i].length = (uint16_t)(end * stuffed.length / corrupted.length - poorRanges[i].start);
+    }
+  }
+
+  unstuffed_ax25_i_frame_t received = {0};
+  rs_erasure_hints_t allHints;
+  rs_erasure_hints_t framingHints;
+  if (ax25UnstuffWithErasureHints(stuffed.data, stuffed.length, poorRanges, numPoorRanges, &received, &allHints) !=
+          OBC_GS_ERR_CODE_SUCCESS ||
+      ax25UnstuffWithErasureHints(stuffed.data, stuffed.length, NULL, 0, &received, &framingHints) !=
+          OBC_GS_ERR_CODE_SUCCESS) {
+    return;
+  }
+
+  // A corrupted stuffing bit shifts the rest of the frame, which no decoder can undo
+  if (received.length != unstuffed.length) {
+    return;
+  }
+  result->lengthIntact++;
+
+  packed_rs_packet_t rsData;
+  memcpy(rsData.data, received.data + AX25_INFO_FIELD_POSITION, RS_ENCODED_SIZE);
+
+  result->recoveredErrorsOnly += decodedMatches(rsData, NULL, message);
+  result->recoveredFramingHints += decodedMatches(rsData, &framingHints, message);
+  result->recoveredAllHints += decodedMatches(rsData, &allHints, message);
+}
+
+int main(void) {
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+  initRs();
+
+  printf("%u frames per rate, %u byte chunks, bursts of %u-%u bytes\n", (unsigned)SIMULATION_FRAMES,
+         (unsigned)SIMULATION_CHUNK_SIZE, (unsigned)BURST_MIN_LEN, (unsigned)BURST_MAX_LEN);
+  printf("[ ERASURE  ] channel  burst/chunk  no slip  errors-only  +framing  +link quality\n");
+
+  const channel_t channels[] = {CHANNEL_STUFFED, CHANNEL_SYMBOL};
+  const char *channelNames[] = {"stuffed", "symbol"};
+  const uint32_t burstPercents[] = {0, 5, 10, 20, 30, 50, 75};
+
+  for (uint32_t c = 0; c < sizeof(channels) / sizeof(channels[0]); ++c) {
+    for (uint32_t i = 0; i < sizeof(burstPercents) / sizeof(burstPercents[0]); ++i) {
+      simulation_result_t result = {0};
+      for (uint32_t frame = 0; frame < SIMULATION_FRAMES; ++frame) {
+        simulateFrame(channels[c], burstPercents[i], &result);
+      }
+
+      printf("[ ERASURE  ] %-7s  %10u%%  %6.1f%%  %10.1f%%  %7.1f%%  %12.1f%%\n", channelNames[c],
+             (unsigned)burstPercents[i], 100.0 * result.lengthIntact / SIMULATION_FRAMES,
+             100.0 * result.recoveredErrorsOnly / SIMULATION_FRAMES,
+             100.0 * result.recoveredFramingHints / SIMULATION_FRAMES,
+             100.0 * result.recoveredAllHints / SIMULATION_FRAMES);
+    }
+  }
+
+  destroyRs();
+  return 0;
+}
@@ -0,0 +1,210 @@
+/*
+ * Telemetry points per downlink packet with the plain and the compressed packet layouts. Every compressed packet is
+ * unpacked and checked against the original points before anything is reported.
+ *
+ * Two days are modelled on what the OBC records:
+ *   health collector - an LM75BD OBC temperature (0.125 C steps) every 60 s following a 95 minute orbital thermal
+ *                      cycle, an OBC state every 10 minutes and an hourly pong
+ *   dense            - the same temperature every 10 s with more noise, and the OBC state every minute
+ * A pass downlinks a fixed number of frames, so points per pass grow by the same factor as points per packet.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_interfaces/benchmark/telemetry-compression-benchmark
+ */
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_pack.h"
+#include "obc_gs_telemetry_unpack.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SECONDS_PER_DAY 86400U
+#define ORBIT_PERIOD_S 5700.0
+#define LM75BD_RESOLUTION 0.125f
+#define START_TIME 1700000000U
+
+// Telemetry packets in a nominal pass, to put the per packet numbers in context
+#define PASS_TELEMETRY_PACKETS 100U
+
+typedef struct {
+  const char *name;
+  uint32_t tempPeriod;
+  uint32_t statePeriod;
+  double tempNoise;
+} telemetry_profile_t;
+
+static uint32_t seed = 0x10C;
+
+static uint32_t nextPseudorandom(void) {
+  // Pseudorandom generation using a simple algorithm
+  seed = (seed * 1103515245 + 12345) % (1U << 31);
+  return seed >> 16;
+}
+
+static double secondsNow(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void fail(const char *reason, uint32_t index) {
+  printf("FAILED: %s (point %u)\n", reason, (unsigned)index);
+  exit(1);
+}
+
+static uint32_t generateDay(const telemetry_profile_t *profile, telemetry_data_t *points) {
+  uint32_t numPoints = 0;
+  uint8_t state = 1;
+
+  for (uint32_t t = 0; t < SECONDS_PER_DAY; ++t) {
+    if (t % profile->tempPeriod == 0) {
+      double noise = profile->tempNoise * (((double)(nextPseudorandom() % 1001) - 500.0) / 500.0);
+      double temp = 15.0 + 12.0 * sin(2.0 * M_PI * (double)t / ORBIT_PERIOD_S) + noise;
+      points[numPoints++] = (telemetry_data_t){.obcTemp = roundf((float)temp / LM75BD_RESOLUTION) * LM75BD_RESOLUTION,
+                                               .id = TELEM_OBC_TEMP,
+                                               .timestamp = START_TIME + t};
+    }
+    if (t % profile->statePeriod == 0) {
+      if (nextPseudorandom() % 50 == 0) {
+        state = (uint8_t)(nextPseudorandom() % 8);
+      }
+      points[numPoints++] = (telemetry_data_t){.obcState = state, .id = TELEM_OBC_STATE, .timestamp = START_TIME + t};
+    }
+    if (t % 3600U == 0) {
+      points[numPoints++] = (telemetry_data_t){.id = TELEM_PONG, .timestamp = START_TIME + t};
+    }
+  }
+
+  return numPoints;
+}
+
+static uint32_t countPlainPackets(const telemetry_data_t *points, uint32_t numPoints) {
+  uint32_t numPackets = 0;
+  uint32_t offset = PACKED_TELEM_PACKET_SIZE;
+  uint8_t packed[MAX_TELEMETRY_DATA_SIZE];
+  uint32_t packedLen = 0;
+
+  // Same packing as the OBC used before compression
+  for (uint32_t i = 0; i < numPoints; ++i) {
+    if (packTelemetry(&points[i], packed, sizeof(packed), &packedLen) != OBC_GS_ERR_CODE_SUCCESS) {
+      fail("pack", i);
+    }
+    if (offset + packedLen > PACKED_TELEM_PACKET_SIZE) {
+      numPackets++;
+      offset = 0;
+    }
+    offset += packedLen;
+  }
+
+  return numPackets;
+}
+
+static uint32_t compressDay(const telemetry_data_t *points, uint32_t numPoints,
+                            uint8_t (*packets)[PACKED_TELEM_PACKET_SIZE]) {
+  uint32_t numPackets = 0;
+  telemetry_compressor_t compressor;
+  uint8_t packed[MAX_TELEMETRY_DATA_SIZE];
+  uint32_t packedLen = 0;
+
+  memset(packets[0], 0, PACKED_TELEM_PACKET_SIZE);
+  telemCompressorInit(&compressor, packets[0], PACKED_TELEM_PACKET_SIZE);
+
+  // Same loop as sendOrCompressPackedTelemetry in the downlink encoder
+  for (uint32_t i = 0; i < numPoints; ++i) {
+    packTelemetry(&points[i], packed, sizeof(packed), &packedLen);
+    obc_gs_error_code_t errCode = telemCompressorAdd(&compressor, packed, packedLen);
+    if (errCode == OBC_GS_ERR_CODE_BUFF_TOO_SMALL) {
+      numPackets++;
+      memset(packets[numPackets], 0, PACKED_TELEM_PACKET_SIZE);
+      telemCompressorInit(&compressor, packets[numPackets], PACKED_TELEM_PACKET_SIZE);
+      errCode = telemCompressorAdd(&compressor, packed, packedLen);
+    }
+    if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+      fail("compress", i);
+    }
+  }
+
+  return compressor.offset > 0 ? numPackets + 1 : numPackets;
+}
+
+static void checkRoundTrip(const telemetry_data_t *points, uint32_t numPoints,
+                           uint8_t (*packets)[PACKED_TELEM_PACKET_SIZE], uint32_t numPackets) {
+  telemetry_data_t unpacked[PACKED_TELEM_PACKET_SIZE];
+  uint32_t pointIndex = 0;
+
+  for (uint32_t p = 0; p < numPackets; ++p) {
+    uint32_t numUnpacked = 0;
+    if (unpackTelemetryPacket(packets[p], PACKED_TELEM_PACKET_SIZE, unpacked, PACKED_TELEM_PACKET_SIZE,
+                              &numUnpacked) != OBC_GS_ERR_CODE_SUCCESS) {
+      fail("unpack", pointIndex);
+    }
+    for (uint32_t i = 0; i < numUnpacked; ++i, ++pointIndex) {
+      if (pointIndex >= numPoints || memcmp(&unpacked[i], &points[pointIndex], sizeof(telemetry_data_t)) != 0) {
+        fail("points differ", pointIndex);
+      }
+    }
+  }
+
+  if (pointIndex != numPoints) {
+    fail("points missing", pointIndex);
+  }
+}
+
+static void runProfile(const telemetry_profile_t *profile) {
+  uint32_t maxPoints = SECONDS_PER_DAY / profile->tempPeriod + SECONDS_PER_DAY / profile->statePeriod + 24U;
+  // calloc so the union bytes past a uint8_t value compare equal after unpacking
+  telemetry_data_t *points = calloc(maxPoints, sizeof(telemetry_data_t));
+  uint8_t(*packets)[PACKED_TELEM_PACKET_SIZE] = malloc((size_t)maxPoints * PACKED_TELEM_PACKET_SIZE);
+  if (points == NULL || packets == NULL) {
+    fail("out of memory", 0);
+  }
+
+  uint32_t numPoints = generateDay(profile, points);
+  uint32_t plainPackets = countPlainPackets(points, numPoints);
+  uint32_t compressedPackets = compressDay(points, numPoints, packets);
+  checkRoundTrip(points, numPoints, packets, compressedPackets);
+
+  double start = secondsNow();
+  compressDay(points, numPoints, packets);
+  double compressSeconds = secondsNow() - start;
+
+  telemetry_data_t unpacked[PACKED_TELEM_PACKET_SIZE];
+  uint32_t numUnpacked = 0;
+  start = secondsNow();
+  for (uint32_t p = 0; p < compressedPackets; ++p) {
+    unpackTelemetryPacket(packets[p], PACKED_TELEM_PACKET_SIZE, unpacked, PACKED_TELEM_PACKET_SIZE, &numUnpacked);
+  }
+  double unpackSeconds = secondsNow() - start;
+
+  double plainPerPacket = (double)numPoints / plainPackets;
+  double compressedPerPacket = (double)numPoints / compressedPackets;
+  printf("[ %-16s] %6u points: plain %5u packets (%5.1f points each), compressed %5u packets (%5.1f points each)\n",
+         profile->name, (unsigned)numPoints, (unsigned)plainPackets, plainPerPacket, (unsigned)compressedPackets,
+         compressedPerPacket);
+  printf("[ %-16s] a %u packet pass carries %5.0f points instead of %5.0f, %.2fx\n", profile->name,
+         PASS_TELEMETRY_PACKETS, compressedPerPacket * PASS_TELEMETRY_PACKETS, plainPerPacket * PASS_TELEMETRY_PACKETS,
+         compressedPerPacket / plainPerPacket);
+  printf("[ %-16s] compress %6.1f ns/point, unpack %6.1f ns/point\n", profile->name, compressSeconds * 1e9 / numPoints,
+         unpackSeconds * 1e9 / numPoints);
+
+  free(points);
+  free(packets);
+}
+
+int main(void) {
+  const telemetry_profile_t profiles[] = {
+      {.name = "health collector", .tempPeriod = 60U, .statePeriod = 600U, .tempNoise = 0.1},
+      {.name = "dense", .tempPeriod = 10U, .statePeriod = 60U, .tempNoise = 0.5},
+  };
+
+  for (uint32_t i = 0; i < sizeof(profiles) / sizeof(profiles[0]); ++i) {
+    runProfile(&profiles[i]);
+  }
+
+  return 0;
+}
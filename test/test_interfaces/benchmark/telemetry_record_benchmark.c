@@ -0,0 +1,256 @@
+/*
+ * Size and read throughput of a synthetic day of telemetry stored as raw telemetry_data_t structs (one per sample)
+ * and as blocks of packed records. Reading a file ends with the same 223B downlink packets either way, and the two
+ * packet streams are checked against each other before anything is timed.
+ *
+ * POSIX file calls stand in for Reliance Edge: each call has a fixed cost on the OBC as well, which is what the
+ * record blocks save on.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_interfaces/benchmark/telemetry-record-benchmark
+ */
+#include "obc_gs_errors.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_pack.h"
+#include "obc_gs_telemetry_record.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SECONDS_PER_DAY 86400U
+#define OBC_TEMP_PERIOD_S 10U
+#define OBC_STATE_PERIOD_S 60U
+#define PONG_PERIOD_S 3600U
+
+#define READ_ITERATIONS 50U
+
+// Same size as packed_telem_packet_t in the OBC's downlink encoder
+#define TELEM_PACKET_SIZE 223U
+
+typedef struct {
+  uint8_t data[TELEM_PACKET_SIZE];
+  uint32_t offset;
+  uint32_t numPackets;
+  uint32_t checksum;
+} packet_sink_t;
+
+static uint32_t seed = 0x7E1E;
+
+static uint32_t nextPseudorandom(void) {
+  // Pseudorandom generation using a simple algorithm
+  seed = (seed * 1103515245 + 12345) % (1U << 31);
+  return seed >> 16;
+}
+
+static double secondsNow(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void fail(const char *reason) {
+  printf("FAILED: %s\n", reason);
+  exit(1);
+}
+
+static void sendPacket(packet_sink_t *sink) {
+  // Fold the packet into a checksum so the two formats can be compared without storing every packet
+  for (uint32_t i = 0; i < TELEM_PACKET_SIZE; ++i) {
+    sink->checksum = sink->checksum * 31U + sink->data[i];
+  }
+  sink->numPackets++;
+  memset(sink->data, 0, sizeof(sink->data));
+  sink->offset = 0;
+}
+
+static void addPacked(packet_sink_t *sink, const uint8_t *packed, uint32_t packedLen) {
+  if (sink->offset + packedLen > TELEM_PACKET_SIZE) {
+    sendPacket(sink);
+  }
+  memcpy(&sink->data[sink->offset], packed, packedLen);
+  sink->offset += packedLen;
+}
+
+static void finishPackets(packet_sink_t *sink) {
+  if (sink->offset > 0) {
+    sendPacket(sink);
+  }
+}
+
+static uint32_t generateDay(telemetry_data_t *points) {
+  uint32_t numPoints = 0;
+  float temp = 20.0f;
+  uint8_t state = 1;
+
+  for (uint32_t t = 0; t < SECONDS_PER_DAY; ++t) {
+    if (t % OBC_TEMP_PERIOD_S == 0) {
+      temp += ((float)(nextPseudorandom() % 101) - 50.0f) / 100.0f;
+      points[numPoints] = (telemetry_data_t){.obcTemp = temp, .id = TELEM_OBC_TEMP, .timestamp = t};
+      numPoints++;
+    }
+    if (t % OBC_STATE_PERIOD_S == 0) {
+      if (nextPseudorandom() % 20 == 0) {
+        state = (uint8_t)(nextPseudorandom() % 8);
+      }
+      points[numPoints] = (telemetry_data_t){.obcState = state, .id = TELEM_OBC_STATE, .timestamp = t};
+      numPoints++;
+    }
+    if (t % PONG_PERIOD_S == 0) {
+      points[numPoints] = (telemetry_data_t){.id = TELEM_PONG, .timestamp = t};
+      numPoints++;
+    }
+  }
+
+  return numPoints;
+}
+
+static int createTempFile(char *path) {
+  int fd = mkstemp(path);
+  if (fd < 0) {
+    fail("could not create a temporary file");
+  }
+  return fd;
+}
+
+static uint32_t writeRawFile(int fd, const telemetry_data_t *points, uint32_t numPoints) {
+  uint32_t numWrites = 0;
+  for (uint32_t i = 0; i < numPoints; ++i) {
+    if (write(fd, &points[i], sizeof(telemetry_data_t)) != (ssize_t)sizeof(telemetry_data_t)) {
+      fail("raw write");
+    }
+    numWrites++;
+  }
+  return numWrites;
+}
+
+static uint32_t writeBlockFile(int fd, const telemetry_data_t *points, uint32_t numPoints) {
+  static telemetry_record_block_t block;
+  uint32_t numWrites = 0;
+  uint16_t blockLen = 0;
+  telemRecordBlockInit(&block);
+
+  for (uint32_t i = 0; i < numPoints; ++i) {
+    obc_gs_error_code_t errCode = telemRecordBlockAppend(&block, &points[i]);
+    if (errCode == OBC_GS_ERR_CODE_BUFF_TOO_SMALL) {
+      telemRecordBlockFinish(&block, &blockLen);
+      if (write(fd, block.data, blockLen) != (ssize_t)blockLen) {
+        fail("block write");
+      }
+      numWrites++;
+      telemRecordBlockInit(&block);
+      errCode = telemRecordBlockAppend(&block, &points[i]);
+    }
+    if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+      fail("append");
+    }
+  }
+
+  if (block.numRecords > 0) {
+    telemRecordBlockFinish(&block, &blockLen);
+    if (write(fd, block.data, blockLen) != (ssize_t)blockLen) {
+      fail("block write");
+    }
+    numWrites++;
+  }
+
+  return numWrites;
+}
+
+// The old downlink path: read one struct at a time and pack it
+static void readRawFile(int fd, packet_sink_t *sink) {
+  telemetry_data_t point;
+  uint8_t packed[MAX_TELEMETRY_DATA_SIZE];
+  uint32_t packedLen = 0;
+
+  lseek(fd, 0, SEEK_SET);
+  while (read(fd, &point, sizeof(point)) == (ssize_t)sizeof(point)) {
+    if (packTelemetry(&point, packed, sizeof(packed), &packedLen) != OBC_GS_ERR_CODE_SUCCESS) {
+      fail("pack");
+    }
+    addPacked(sink, packed, packedLen);
+  }
+  finishPackets(sink);
+}
+
+// The new downlink path: read a block at a time and copy its records
+static void readBlockFile(int fd, packet_sink_t *sink) {
+  static telemetry_record_block_t block;
+  uint16_t payloadLen = 0;
+
+  lseek(fd, 0, SEEK_SET);
+  while (read(fd, block.data, TELEM_RECORD_BLOCK_HEADER_SIZE) == TELEM_RECORD_BLOCK_HEADER_SIZE) {
+    if (telemRecordParseHeader(block.data, &payloadLen) != OBC_GS_ERR_CODE_SUCCESS ||
+        read(fd, block.data + TELEM_RECORD_BLOCK_HEADER_SIZE, payloadLen) != (ssize_t)payloadLen ||
+        telemRecordBlockLoad(&block) != OBC_GS_ERR_CODE_SUCCESS) {
+      fail("bad block");
+    }
+
+    uint16_t offset = 0;
+    const uint8_t *record = NULL;
+    uint8_t recordLen = 0;
+    while (telemRecordBlockNext(&block, &offset, &record, &recordLen)) {
+      addPacked(sink, record, recordLen);
+    }
+  }
+  finishPackets(sink);
+}
+
+static double timeReads(int fd, void (*readFile)(int, packet_sink_t *)) {
+  double start = secondsNow();
+  for (uint32_t n = 0; n < READ_ITERATIONS; ++n) {
+    packet_sink_t sink = {0};
+    readFile(fd, &sink);
+  }
+  return (secondsNow() - start) / READ_ITERATIONS;
+}
+
+int main(void) {
+  uint32_t maxPoints = SECONDS_PER_DAY / OBC_TEMP_PERIOD_S + SECONDS_PER_DAY / OBC_STATE_PERIOD_S +
+                       SECONDS_PER_DAY / PONG_PERIOD_S;
+  telemetry_data_t *points = malloc(maxPoints * sizeof(telemetry_data_t));
+  if (points == NULL) {
+    fail("out of memory");
+  }
+  uint32_t numPoints = generateDay(points);
+
+  char rawPath[] = "/tmp/telemetry_rawXXXXXX";
+  char blockPath[] = "/tmp/telemetry_blockXXXXXX";
+  int rawFd = createTempFile(rawPath);
+  int blockFd = createTempFile(blockPath);
+
+  uint32_t rawWrites = writeRawFile(rawFd, points, numPoints);
+  uint32_t blockWrites = writeBlockFile(blockFd, points, numPoints);
+  off_t rawSize = lseek(rawFd, 0, SEEK_END);
+  off_t blockSize = lseek(blockFd, 0, SEEK_END);
+
+  packet_sink_t rawSink = {0};
+  packet_sink_t blockSink = {0};
+  readRawFile(rawFd, &rawSink);
+  readBlockFile(blockFd, &blockSink);
+  if (rawSink.numPackets != blockSink.numPackets || rawSink.checksum != blockSink.checksum) {
+    fail("downlink packets differ");
+  }
+
+  double rawSeconds = timeReads(rawFd, readRawFile);
+  double blockSeconds = timeReads(blockFd, readBlockFile);
+
+  printf("[ TELEMETRY ] %u points in a day, %u downlink packets\n", (unsigned)numPoints,
+         (unsigned)rawSink.numPackets);
+  printf("[ TELEMETRY ] raw structs   %8ld B, %6u writes, read %8.2f ms, %6.2f M points/s\n", (long)rawSize,
+         (unsigned)rawWrites, rawSeconds * 1e3, (double)numPoints / rawSeconds / 1e6);
+  printf("[ TELEMETRY ] record blocks %8ld B, %6u writes, read %8.2f ms, %6.2f M points/s\n", (long)blockSize,
+         (unsigned)blockWrites, blockSeconds * 1e3, (double)numPoints / blockSeconds / 1e6);
+  printf("[ TELEMETRY ] record blocks are %.1f%% of the raw size and read %.1fx faster\n",
+         100.0 * (double)blockSize / (double)rawSize, rawSeconds / blockSeconds);
+
+  close(rawFd);
+  close(blockFd);
+  unlink(rawPath);
+  unlink(blockPath);
+  free(points);
+  return 0;
+}
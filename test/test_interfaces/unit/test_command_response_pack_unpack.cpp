@@ -65,3 +65,81 @@ TEST(pack_unpack_command_responses, unpackInvalidCommand) {
   obc_gs_error_code_t errCode = unpackCmdResponse(buffer, &deserializedResponse, responseData);
   EXPECT_EQ(errCode, OBC_GS_ERR_CODE_UNSUPPORTED_CMD);
 }
+
+TEST(pack_unpack_command_responses, coalescedResponsesRoundTrip) {
+  uint8_t block[RS_DECODED_SIZE] = {0};
+  uint32_t offset = 0;
+
+  const uint8_t rtcData[] = {0x78, 0x56, 0x34, 0x12};
+  cmd_response_header_t first = {.cmdId = CMD_RTC_SYNC, .errCode = CMD_RESPONSE_SUCCESS, .dataLen = sizeof(rtcData)};
+  cmd_response_header_t second = {.cmdId = CMD_PING, .errCode = CMD_RESPONSE_ERROR, .dataLen = 0};
+  ASSERT_EQ(appendCmdResponse(&first, rtcData, block, sizeof(block), &offset), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(appendCmdResponse(&second, NULL, block, sizeof(block), &offset), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(offset, 2U * CMD_RESPONSE_HEADER_SIZE + sizeof(rtcData));
+
+  uint32_t readOffset = 0;
+  cmd_response_header_t unpacked;
+  uint8_t responseData[CMD_RESPONSE_DATA_MAX_SIZE];
+
+  ASSERT_EQ(unpackNextCmdResponse(block, sizeof(block), &readOffset, &unpacked, responseData), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(unpacked.cmdId, CMD_RTC_SYNC);
+  EXPECT_EQ(unpacked.errCode, CMD_RESPONSE_SUCCESS);
+  EXPECT_EQ(unpacked.dataLen, sizeof(rtcData));
+  EXPECT_EQ(memcmp(responseData, rtcData, sizeof(rtcData)), 0);
+  EXPECT_EQ(responseData[sizeof(rtcData)], 0);
+
+  ASSERT_EQ(unpackNextCmdResponse(block, sizeof(block), &readOffset, &unpacked, responseData), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(unpacked.cmdId, CMD_PING);
+  EXPECT_EQ(unpacked.errCode, CMD_RESPONSE_ERROR);
+  EXPECT_EQ(unpacked.dataLen, 0);
+
+  // The zeroed tail ends the block
+  ASSERT_EQ(unpackNextCmdResponse(block, sizeof(block), &readOffset, &unpacked, responseData), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(unpacked.cmdId, CMD_END_OF_FRAME);
+  EXPECT_EQ(readOffset, offset);
+}
+
+TEST(pack_unpack_command_responses, singleCoalescedResponseMatchesPackCmdResponse) {
+  uint8_t responseData[CMD_RESPONSE_DATA_MAX_SIZE] = {0xAA, 0xBB};
+  cmd_response_header_t cmdResponse = {.cmdId = CMD_RTC_SYNC, .errCode = CMD_RESPONSE_SUCCESS, .dataLen = 2};
+
+  uint8_t packed[RS_DECODED_SIZE] = {0};
+  ASSERT_EQ(packCmdResponse(&cmdResponse, packed, responseData), OBC_GS_ERR_CODE_SUCCESS);
+
+  uint8_t appended[RS_DECODED_SIZE] = {0};
+  uint32_t offset = 0;
+  ASSERT_EQ(appendCmdResponse(&cmdResponse, responseData, appended, sizeof(appended), &offset),
+            OBC_GS_ERR_CODE_SUCCESS);
+
+  // Ground stations that only read the first response still parse the block
+  EXPECT_EQ(memcmp(packed, appended, sizeof(packed)), 0);
+}
+
+TEST(pack_unpack_command_responses, appendResponseThatDoesNotFit) {
+  uint8_t responseData[CMD_RESPONSE_DATA_MAX_SIZE] = {0};
+  cmd_response_header_t full = {
+      .cmdId = CMD_PING, .errCode = CMD_RESPONSE_SUCCESS, .dataLen = CMD_RESPONSE_DATA_MAX_SIZE};
+  cmd_response_header_t small = {.cmdId = CMD_PING, .errCode = CMD_RESPONSE_SUCCESS, .dataLen = 0};
+
+  uint8_t block[RS_DECODED_SIZE] = {0};
+  uint32_t offset = 0;
+  ASSERT_EQ(appendCmdResponse(&full, responseData, block, sizeof(block), &offset), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(offset, (uint32_t)RS_DECODED_SIZE);
+
+  EXPECT_EQ(appendCmdResponse(&small, responseData, block, sizeof(block), &offset), OBC_GS_ERR_CODE_BUFF_TOO_SMALL);
+  EXPECT_EQ(offset, (uint32_t)RS_DECODED_SIZE);
+}
+
+TEST(pack_unpack_command_responses, unpackTruncatedResponse) {
+  uint8_t block[RS_DECODED_SIZE] = {0};
+  block[RS_DECODED_SIZE - 4] = CMD_PING;
+  block[RS_DECODED_SIZE - 3] = CMD_RESPONSE_SUCCESS;
+  block[RS_DECODED_SIZE - 2] = 5;
+
+  uint32_t offset = RS_DECODED_SIZE - 4;
+  cmd_response_header_t unpacked;
+  uint8_t responseData[CMD_RESPONSE_DATA_MAX_SIZE];
+  EXPECT_EQ(unpackNextCmdResponse(block, sizeof(block), &offset, &unpacked, responseData),
+            OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(offset, (uint32_t)RS_DECODED_SIZE - 4);
+}
@@ -2,9 +2,116 @@
 #include "obc_gs_fec.h"
 #include "obc_gs_errors.h"
 
+#include <stdio.h>
 #include <string.h>
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+
+#define AX25_FUZZ_ITERATIONS 2000U
+#define AX25_FUZZ_MAX_RAW_LEN 300U
+#define AX25_FUZZ_BUFFER_SIZE 512U
+#define AX25_BENCHMARK_ITERATIONS 20000U
+
+typedef obc_gs_error_code_t (*ax25_stuff_fn_t)(uint8_t *, uint16_t, uint8_t *, uint16_t *);
+typedef obc_gs_error_code_t (*ax25_unstuff_fn_t)(const uint8_t *, uint16_t, uint8_t *, uint16_t *);
+
+static uint32_t nextPseudorandom(uint32_t *seed) {
+  // Pseudorandom generation using a simple algorithm
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return *seed >> 16;
+}
+
+// Random bytes mixed with long runs of 1s so every stuffing state is hit
+static void fillStuffingPattern(uint8_t *data, uint16_t len, uint32_t *seed) {
+  for (uint16_t i = 0; i < len; ++i) {
+    uint32_t r = nextPseudorandom(seed);
+    data[i] = ((r & 0x300) == 0) ? 0xFF : (uint8_t)r;
+  }
+}
+
+/*
+ * Bit-at-a-time reference implementations of ax25Stuff and ax25Unstuff. Unlike the table-driven versions these OR
+ * bits into the output, so the output buffer must be zeroed first.
+ */
+static obc_gs_error_code_t ax25StuffBitwise(uint8_t *rawData, uint16_t rawDataLen, uint8_t *stuffedData,
+                                            uint16_t *stuffedDataLen) {
+  if (rawData == NULL || stuffedData == NULL || stuffedDataLen == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint16_t rawOffset = 0, stuffedOffset = 8, oneCount = 0;
+  uint8_t currentBit;
+
+  // Cycle through raw data to find 1s
+  for (rawOffset = 8; rawOffset < (rawDataLen - 1) * 8; ++rawOffset) {
+    currentBit = (rawData[rawOffset / 8] >> (7 - (rawOffset % 8))) & 1;
+    stuffedData[stuffedOffset / 8] |= (currentBit << (7 - (stuffedOffset % 8)));
+    stuffedOffset++;
+
+    if (currentBit == 1) {
+      oneCount++;
+      if (oneCount == 5) {
+        oneCount = 0;
+        stuffedData[stuffedOffset / 8] |= 0;
+        stuffedOffset++;
+      }
+    } else {
+      oneCount = 0;
+    }
+  }
+
+  *stuffedDataLen = ((stuffedOffset + 7) / 8) + 1;
+  stuffedData[0] = AX25_FLAG;
+  stuffedData[*stuffedDataLen - 1] = AX25_FLAG;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+static obc_gs_error_code_t ax25UnstuffBitwise(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+                                              uint16_t *unstuffedPacketLen) {
+  uint8_t bitCount = 0;
+  uint8_t stuffingFlag = 0;
+  uint16_t unstuffedBitLength = 0;  // count as bits
+
+  // Set the first flag
+  unstuffedPacket[0] = AX25_FLAG;
+  unstuffedBitLength += 8;
+
+  // loop from second byte to second last byte since first and last are the
+  // flags
+  for (uint16_t stuffedPacketIndex = 1; stuffedPacketIndex < packetLen - 1; ++stuffedPacketIndex) {
+    uint8_t current_byte = packet[stuffedPacketIndex];
+
+    for (uint8_t offset = 0; offset < 8; ++offset) {
+      uint8_t bit = (current_byte >> (7 - offset)) & 0x01;
+
+      if (stuffingFlag) {
+        bitCount = 0;
+        stuffingFlag = 0;
+        continue;  // Skip adding the stuffed bit
+      }
+
+      if (bit == 1) {
+        bitCount++;
+        if (bitCount == 5) {
+          bitCount = 0;
+          stuffingFlag = 1;
+        }
+      } else {
+        bitCount = 0;
+      }
+      unstuffedPacket[unstuffedBitLength / 8] |= bit << (7 - (unstuffedBitLength % 8));
+      unstuffedBitLength++;
+    }
+  }
+
+  // Drop the partial last byte, which is the stuffer's zero padding, and add the last flag
+  unstuffedPacket[unstuffedBitLength / 8] = AX25_FLAG;
+  *unstuffedPacketLen = unstuffedBitLength / 8 + AX25_END_FLAG_BYTES;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
 
 // NOTE: AKITO is the groundStationCallsign
 // NOTE: ATLAS is the cubeSatCallSign
@@ -228,6 +335,34 @@ TEST(TestAx25SendRecv, uFrameSendRecvAck) {
   EXPECT_EQ(command, U_FRAME_CMD_ACK);
 }
 
+TEST(TestAx25SendRecv, checkFrameRejectsCorruption) {
+  uint8_t telemData[RS_ENCODED_SIZE] = {0};
+  for (uint16_t i = 0; i < RS_ENCODED_SIZE; ++i) {
+    telemData[i] = (uint8_t)(i * 13);
+  }
+
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+  unstuffed_ax25_i_frame_t frame = {0};
+  ASSERT_EQ(ax25SendIFrame(telemData, RS_ENCODED_SIZE, &frame), OBC_GS_ERR_CODE_SUCCESS);
+
+  // Checking the same frame again gives the same answer since nothing is counted
+  EXPECT_EQ(ax25CheckFrame(&frame), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(ax25CheckFrame(&frame), OBC_GS_ERR_CODE_SUCCESS);
+
+  unstuffed_ax25_i_frame_t corrupted = frame;
+  corrupted.data[AX25_INFO_FIELD_POSITION + 100] ^= 0x01;
+  EXPECT_NE(ax25CheckFrame(&corrupted), OBC_GS_ERR_CODE_SUCCESS);
+
+  corrupted = frame;
+  corrupted.data[AX25_DEST_ADDR_POSITION] ^= 0x02;
+  EXPECT_NE(ax25CheckFrame(&corrupted), OBC_GS_ERR_CODE_SUCCESS);
+
+  corrupted = frame;
+  corrupted.length = AX25_MINIMUM_U_FRAME_CMD_LENGTH - 1;
+  EXPECT_EQ(ax25CheckFrame(&corrupted), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(ax25CheckFrame(NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+}
+
 TEST(TestAx25SendRecV, Ax25SourceAddressGenerator) {
   ax25_addr_t sourceAddress;
   memset(sourceAddress.data, 0, 7);
@@ -257,3 +392,127 @@ TEST(TestAx25SendRecV, Ax25DestAddressGenerator) {
   ax25GetDestAddress(&sourceAddress, callSign, 4, 0, 1);
   ASSERT_EQ(memcmp(&sourceAddress, &expectedAddress, 7), 0);
 }
+
+TEST(TestAx25Stuffing, StuffMatchesBitwise) {
+  uint32_t seed = 0xA5A5;
+
+  for (uint32_t i = 0; i < AX25_FUZZ_ITERATIONS; ++i) {
+    uint8_t raw[AX25_FUZZ_MAX_RAW_LEN];
+    uint16_t rawLen = nextPseudorandom(&seed) % (AX25_FUZZ_MAX_RAW_LEN + 1);
+    fillStuffingPattern(raw, rawLen, &seed);
+
+    uint8_t expected[AX25_FUZZ_BUFFER_SIZE] = {0};
+    uint16_t expectedLen = 0;
+    ASSERT_EQ(ax25StuffBitwise(raw, rawLen, expected, &expectedLen), OBC_GS_ERR_CODE_SUCCESS);
+
+    // The table-driven version must not rely on a zeroed output buffer
+    uint8_t actual[AX25_FUZZ_BUFFER_SIZE];
+    memset(actual, 0xA5, sizeof(actual));
+    uint16_t actualLen = 0;
+    ASSERT_EQ(ax25Stuff(raw, rawLen, actual, &actualLen), OBC_GS_ERR_CODE_SUCCESS);
+
+    ASSERT_EQ(actualLen, expectedLen) << "raw length " << rawLen;
+    ASSERT_EQ(memcmp(actual, expected, expectedLen), 0) << "raw length " << rawLen;
+  }
+}
+
+TEST(TestAx25Stuffing, UnstuffMatchesBitwise) {
+  uint32_t seed = 0x5A5A;
+
+  for (uint32_t i = 0; i < AX25_FUZZ_ITERATIONS; ++i) {
+    // Arbitrary input, including sequences that are not valid stuffed data
+    uint8_t stuffed[AX25_FUZZ_MAX_RAW_LEN];
+    uint16_t stuffedLen = nextPseudorandom(&seed) % (AX25_FUZZ_MAX_RAW_LEN + 1);
+    fillStuffingPattern(stuffed, stuffedLen, &seed);
+    if (stuffedLen > 0) {
+      stuffed[0] = AX25_FLAG;
+    }
+
+    uint8_t expected[AX25_FUZZ_BUFFER_SIZE] = {0};
+    uint16_t expectedLen = 0;
+    ASSERT_EQ(ax25UnstuffBitwise(stuffed, stuffedLen, expected, &expectedLen), OBC_GS_ERR_CODE_SUCCESS);
+
+    uint8_t actual[AX25_FUZZ_BUFFER_SIZE];
+    memset(actual, 0xA5, sizeof(actual));
+    uint16_t actualLen = 0;
+    ASSERT_EQ(ax25Unstuff(stuffed, stuffedLen, actual, &actualLen), OBC_GS_ERR_CODE_SUCCESS);
+
+    ASSERT_EQ(actualLen, expectedLen) << "stuffed length " << stuffedLen;
+    ASSERT_EQ(memcmp(actual, expected, expectedLen), 0) << "stuffed length " << stuffedLen;
+  }
+}
+
+TEST(TestAx25Stuffing, RoundTrip) {
+  uint32_t seed = 0x1234;
+
+  for (uint32_t i = 0; i < AX25_FUZZ_ITERATIONS; ++i) {
+    uint8_t raw[AX25_FUZZ_MAX_RAW_LEN];
+    uint16_t rawLen = (nextPseudorandom(&seed) % (AX25_FUZZ_MAX_RAW_LEN - 2)) + 3;
+    fillStuffingPattern(raw, rawLen, &seed);
+    raw[0] = AX25_FLAG;
+    raw[rawLen - 1] = AX25_FLAG;
+    // Trailing zero bytes are content, not padding
+    if (i % 4 == 0) {
+      raw[rawLen - 2] = 0x00;
+    }
+
+    uint8_t stuffed[AX25_FUZZ_BUFFER_SIZE];
+    uint16_t stuffedLen = 0;
+    ASSERT_EQ(ax25Stuff(raw, rawLen, stuffed, &stuffedLen), OBC_GS_ERR_CODE_SUCCESS);
+
+    uint8_t unstuffed[AX25_FUZZ_BUFFER_SIZE];
+    uint16_t unstuffedLen = 0;
+    ASSERT_EQ(ax25Unstuff(stuffed, stuffedLen, unstuffed, &unstuffedLen), OBC_GS_ERR_CODE_SUCCESS);
+
+    ASSERT_EQ(unstuffedLen, rawLen);
+    ASSERT_EQ(memcmp(unstuffed, raw, rawLen), 0);
+  }
+}
+
+TEST(TestAx25Stuffing, Benchmark) {
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+
+  uint8_t telemData[RS_ENCODED_SIZE];
+  uint32_t seed = 0xBEEF;
+  fillStuffingPattern(telemData, RS_ENCODED_SIZE, &seed);
+
+  unstuffed_ax25_i_frame_t frame = {0};
+  ASSERT_EQ(ax25SendIFrame(telemData, RS_ENCODED_SIZE, &frame), OBC_GS_ERR_CODE_SUCCESS);
+
+  packed_ax25_i_frame_t packed = {0};
+  ASSERT_EQ(ax25Stuff(frame.data, frame.length, packed.data, &packed.length), OBC_GS_ERR_CODE_SUCCESS);
+
+  const double totalMegabytes = (double)frame.length * AX25_BENCHMARK_ITERATIONS / (1024.0 * 1024.0);
+
+  const struct {
+    const char *name;
+    ax25_stuff_fn_t stuff;
+    ax25_unstuff_fn_t unstuff;
+  } variants[] = {
+      {"bitwise", ax25StuffBitwise, ax25UnstuffBitwise},
+      {"table", ax25Stuff, ax25Unstuff},
+  };
+
+  for (const auto &variant : variants) {
+    std::vector<uint8_t> out(AX25_FUZZ_BUFFER_SIZE);
+    uint16_t outLen = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < AX25_BENCHMARK_ITERATIONS; ++i) {
+      // The bitwise versions need a zeroed buffer, so clear it for both to keep the comparison fair
+      memset(out.data(), 0, out.size());
+      variant.stuff(frame.data, frame.length, out.data(), &outLen);
+    }
+    double stuffSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < AX25_BENCHMARK_ITERATIONS; ++i) {
+      memset(out.data(), 0, out.size());
+      variant.unstuff(packed.data, packed.length, out.data(), &outLen);
+    }
+    double unstuffSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("[ AX25     ] %-10s stuff %8.1f MB/s, unstuff %8.1f MB/s\n", variant.name, totalMegabytes / stuffSeconds,
+           totalMegabytes / unstuffSeconds);
+  }
+}
@@ -0,0 +1,183 @@
+#include "obc_gs_ax25.h"
+#include "obc_gs_ax25_frame_extractor.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef std::vector<uint8_t> frame_t;
+
+typedef struct {
+  std::vector<frame_t> frames;
+  std::vector<const uint8_t *> frameStarts;
+} collected_frames_t;
+
+static void collectFrame(const uint8_t *frame, uint16_t frameLen, void *context) {
+  collected_frames_t *collected = (collected_frames_t *)context;
+  collected->frames.emplace_back(frame, frame + frameLen);
+  collected->frameStarts.push_back(frame);
+}
+
+static uint32_t nextPseudorandom(uint32_t *seed) {
+  // Pseudorandom generation using a simple algorithm
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return *seed >> 16;
+}
+
+/**
+ * @brief byte at a time reference for the extractor, matching the loop the uplink decoder used before
+ */
+static std::vector<frame_t> extractFramesBytewise(const std::vector<uint8_t> &stream) {
+  std::vector<frame_t> frames;
+  packed_ax25_i_frame_t axData = {0};
+  uint16_t axDataIndex = 0;
+  bool startFlagReceived = false;
+
+  for (uint8_t byte : stream) {
+    if (axDataIndex >= sizeof(axData.data)) {
+      axDataIndex = 0;
+      startFlagReceived = false;
+    }
+
+    if (byte == AX25_FLAG) {
+      axData.data[axDataIndex++] = byte;
+      if (axDataIndex > 2) {
+        frames.emplace_back(axData.data, axData.data + axDataIndex);
+        axDataIndex = 0;
+        axData.data[axDataIndex++] = AX25_FLAG;
+      } else {
+        startFlagReceived = true;
+        axDataIndex = 1;
+      }
+      continue;
+    }
+    if (startFlagReceived) {
+      axData.data[axDataIndex++] = byte;
+    }
+  }
+
+  return frames;
+}
+
+static void appendStuffedFrame(std::vector<uint8_t> *stream, uint32_t *seed) {
+  uint8_t telemData[RS_ENCODED_SIZE];
+  for (uint16_t i = 0; i < RS_ENCODED_SIZE; ++i) {
+    telemData[i] = (uint8_t)nextPseudorandom(seed);
+  }
+
+  unstuffed_ax25_i_frame_t unstuffed = {0};
+  ASSERT_EQ(ax25SendIFrame(telemData, RS_ENCODED_SIZE, &unstuffed), OBC_GS_ERR_CODE_SUCCESS);
+
+  packed_ax25_i_frame_t packed = {0};
+  ASSERT_EQ(ax25Stuff(unstuffed.data, unstuffed.length, packed.data, &packed.length), OBC_GS_ERR_CODE_SUCCESS);
+
+  stream->insert(stream->end(), packed.data, packed.data + packed.length);
+}
+
+TEST(TestAx25FrameExtractor, InvalidArgs) {
+  ax25_frame_extractor_t extractor;
+  ax25FrameExtractorInit(&extractor);
+  uint8_t data[1] = {AX25_FLAG};
+  collected_frames_t collected;
+
+  EXPECT_EQ(ax25FrameExtractorPush(nullptr, data, sizeof(data), collectFrame, &collected), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(ax25FrameExtractorPush(&extractor, nullptr, sizeof(data), collectFrame, &collected),
+            OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(ax25FrameExtractorPush(&extractor, data, sizeof(data), nullptr, &collected), OBC_GS_ERR_CODE_INVALID_ARG);
+}
+
+TEST(TestAx25FrameExtractor, FrameInsideSpanIsNotCopied) {
+  const uint8_t data[] = {0x12, AX25_FLAG, AX25_FLAG, 0x01, 0x02, 0x03, AX25_FLAG, 0x04, AX25_FLAG, 0x05};
+
+  ax25_frame_extractor_t extractor;
+  ax25FrameExtractorInit(&extractor);
+  collected_frames_t collected;
+  ASSERT_EQ(ax25FrameExtractorPush(&extractor, data, sizeof(data), collectFrame, &collected), OBC_GS_ERR_CODE_SUCCESS);
+
+  // Leading noise and idle flags are skipped and the shared flag starts the second frame
+  ASSERT_EQ(collected.frames.size(), 2U);
+  EXPECT_EQ(collected.frames[0], frame_t({AX25_FLAG, 0x01, 0x02, 0x03, AX25_FLAG}));
+  EXPECT_EQ(collected.frameStarts[0], data + 2);
+  EXPECT_EQ(collected.frames[1], frame_t({AX25_FLAG, 0x04, AX25_FLAG}));
+  EXPECT_EQ(collected.frameStarts[1], data + 6);
+
+  // The trailing byte is kept as the start of the next frame
+  EXPECT_TRUE(extractor.inFrame);
+  EXPECT_EQ(extractor.frameLen, 2U);
+}
+
+TEST(TestAx25FrameExtractor, MatchesBytewiseForAnyChunking) {
+  uint32_t seed = 0xF1A6;
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+
+  std::vector<uint8_t> stream;
+  for (uint32_t i = 0; i < 40; ++i) {
+    switch (nextPseudorandom(&seed) % 4) {
+      case 0:
+        // Idle fill
+        stream.insert(stream.end(), nextPseudorandom(&seed) % 5, AX25_FLAG);
+        break;
+      case 1:
+        // Line noise
+        for (uint32_t j = nextPseudorandom(&seed) % 20; j > 0; --j) {
+          stream.push_back((uint8_t)nextPseudorandom(&seed));
+        }
+        break;
+      case 2:
+        // Too long to be a frame
+        stream.push_back(AX25_FLAG);
+        stream.insert(stream.end(), AX25_MAXIMUM_PKT_LEN + (nextPseudorandom(&seed) % 50), 0x55);
+        break;
+      default:
+        appendStuffedFrame(&stream, &seed);
+        break;
+    }
+  }
+
+  std::vector<frame_t> expected = extractFramesBytewise(stream);
+  ASSERT_GT(expected.size(), 5U);
+
+  const uint32_t chunkSizes[] = {1, 2, 7, 64, 100, 333, 4096};
+  for (uint32_t chunkSize : chunkSizes) {
+    ax25_frame_extractor_t extractor;
+    ax25FrameExtractorInit(&extractor);
+    collected_frames_t collected;
+
+    for (size_t offset = 0; offset < stream.size(); offset += chunkSize) {
+      uint32_t len = (stream.size() - offset < chunkSize) ? (stream.size() - offset) : chunkSize;
+      ASSERT_EQ(ax25FrameExtractorPush(&extractor, stream.data() + offset, len, collectFrame, &collected),
+                OBC_GS_ERR_CODE_SUCCESS);
+    }
+
+    EXPECT_EQ(collected.frames, expected) << "chunk " << chunkSize;
+  }
+}
+
+TEST(TestAx25FrameExtractor, OverlongFrameIsDropped) {
+  std::vector<uint8_t> stream;
+  stream.push_back(AX25_FLAG);
+  stream.insert(stream.end(), AX25_MAXIMUM_PKT_LEN, 0xAA);
+  stream.push_back(AX25_FLAG);
+  stream.push_back(0x01);
+  stream.push_back(AX25_FLAG);
+
+  const uint32_t chunkSizes[] = {10, (uint32_t)stream.size()};
+  for (uint32_t chunkSize : chunkSizes) {
+    ax25_frame_extractor_t extractor;
+    ax25FrameExtractorInit(&extractor);
+    collected_frames_t collected;
+
+    for (size_t offset = 0; offset < stream.size(); offset += chunkSize) {
+      uint32_t len = (stream.size() - offset < chunkSize) ? (stream.size() - offset) : chunkSize;
+      ASSERT_EQ(ax25FrameExtractorPush(&extractor, stream.data() + offset, len, collectFrame, &collected),
+                OBC_GS_ERR_CODE_SUCCESS);
+    }
+
+    EXPECT_EQ(extractor.overflows, 1U) << "chunk " << chunkSize;
+    ASSERT_EQ(collected.frames.size(), 1U) << "chunk " << chunkSize;
+    EXPECT_EQ(collected.frames[0], frame_t({AX25_FLAG, 0x01, AX25_FLAG}));
+  }
+}
@@ -0,0 +1,238 @@
+#include "obc_gs_ax25.h"
+#include "obc_gs_batch.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <string.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define NUM_FRAMES 8U
+
+static const uint8_t TEST_KEY[16] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                     0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+static const uint8_t TEST_IV[16] = {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+                                    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01};
+
+/**
+ * @brief a batch that owns its buffers
+ */
+struct TestBatch {
+  std::vector<uint8_t> data;
+  std::vector<uint32_t> offsets;
+  std::vector<uint32_t> lengths;
+  std::vector<obc_gs_error_code_t> statuses;
+
+  TestBatch(uint32_t numFrames, uint32_t dataLen)
+      : data(dataLen), offsets(numFrames), lengths(numFrames), statuses(numFrames) {}
+
+  void append(const uint8_t *frame, uint32_t frameLen) {
+    offsets.push_back(data.size());
+    lengths.push_back(frameLen);
+    data.insert(data.end(), frame, frame + frameLen);
+  }
+
+  frame_batch_t view() {
+    return {data.data(), (uint32_t)data.size(), offsets.data(), lengths.data(), (uint32_t)offsets.size()};
+  }
+};
+
+static batch_config_t makeConfig(bool encrypt) {
+  batch_config_t config = {};
+  config.aesKey = encrypt ? TEST_KEY : NULL;
+  config.aesIv = encrypt ? TEST_IV : NULL;
+  config.destCallSign = GROUND_STATION_CALLSIGN;
+  config.destCallSignLength = CALLSIGN_LENGTH;
+  return config;
+}
+
+/**
+ * @brief builds NUM_FRAMES payloads of different lengths, up to a full 223 bytes
+ */
+static TestBatch makePayloads(void) {
+  TestBatch payloads(0, 0);
+  for (uint32_t i = 0; i < NUM_FRAMES; ++i) {
+    uint8_t payload[RS_DECODED_SIZE];
+    uint32_t payloadLen = (i == NUM_FRAMES - 1) ? RS_DECODED_SIZE : i * 30;
+    for (uint32_t j = 0; j < payloadLen; ++j) {
+      payload[j] = (uint8_t)(i * 7 + j);
+    }
+    payloads.append(payload, payloadLen);
+  }
+  return payloads;
+}
+
+static void encodeBatch(const batch_config_t &config, TestBatch &payloads, TestBatch &encoded) {
+  frame_batch_t input = payloads.view();
+  frame_batch_t output = encoded.view();
+  ASSERT_EQ(batchEncodeFrames(&config, &input, &output, encoded.statuses.data()), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(output.numFrames, input.numFrames);
+}
+
+static void decodeBatch(const batch_config_t &config, TestBatch &encoded, TestBatch &decoded) {
+  frame_batch_t input = encoded.view();
+  frame_batch_t output = decoded.view();
+  ASSERT_EQ(batchDecodeFrames(&config, &input, &output, decoded.statuses.data()), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(output.numFrames, input.numFrames);
+}
+
+static void expectPayload(const TestBatch &decoded, uint32_t index, const TestBatch &payloads) {
+  ASSERT_EQ(decoded.lengths[index], RS_DECODED_SIZE);
+
+  uint8_t expected[RS_DECODED_SIZE] = {0};
+  memcpy(expected, payloads.data.data() + payloads.offsets[index], payloads.lengths[index]);
+  EXPECT_EQ(memcmp(decoded.data.data() + decoded.offsets[index], expected, RS_DECODED_SIZE), 0);
+}
+
+TEST(TestBatch, RoundTrip) {
+  for (bool encrypt : {false, true}) {
+    batch_config_t config = makeConfig(encrypt);
+    TestBatch payloads = makePayloads();
+    TestBatch encoded(NUM_FRAMES, NUM_FRAMES * BATCH_ENCODED_FRAME_MAX_LEN);
+    encodeBatch(config, payloads, encoded);
+
+    // Frames are packed back to back, so the output can be handed to the decoder as is
+    uint32_t expectedOffset = 0;
+    for (uint32_t i = 0; i < NUM_FRAMES; ++i) {
+      ASSERT_EQ(encoded.statuses[i], OBC_GS_ERR_CODE_SUCCESS);
+      EXPECT_EQ(encoded.offsets[i], expectedOffset);
+      EXPECT_GE(encoded.lengths[i], AX25_MINIMUM_I_FRAME_LEN);
+      expectedOffset += encoded.lengths[i];
+    }
+    encoded.data.resize(expectedOffset);
+
+    TestBatch decoded(NUM_FRAMES, NUM_FRAMES * BATCH_DECODED_FRAME_LEN);
+    decodeBatch(config, encoded, decoded);
+    for (uint32_t i = 0; i < NUM_FRAMES; ++i) {
+      ASSERT_EQ(decoded.statuses[i], OBC_GS_ERR_CODE_SUCCESS);
+      expectPayload(decoded, i, payloads);
+    }
+  }
+}
+
+TEST(TestBatch, EncodeMatchesSingleFramePipeline) {
+  batch_config_t config = makeConfig(false);
+  config.firstSendSeq = 3;
+  TestBatch payloads = makePayloads();
+  TestBatch encoded(NUM_FRAMES, NUM_FRAMES * BATCH_ENCODED_FRAME_MAX_LEN);
+  encodeBatch(config, payloads, encoded);
+
+  ax25_addr_t destAddress = {0};
+  ax25GetDestAddress(&destAddress, GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID, DEFAULT_CONTROL_BIT);
+  for (uint32_t i = 0; i < NUM_FRAMES; ++i) {
+    uint8_t payload[RS_DECODED_SIZE] = {0};
+    memcpy(payload, payloads.data.data() + payloads.offsets[i], payloads.lengths[i]);
+
+    packed_rs_packet_t rsData;
+    ASSERT_EQ(rsEncode(payload, &rsData), OBC_GS_ERR_CODE_SUCCESS);
+    unstuffed_ax25_i_frame_t unstuffed;
+    ASSERT_EQ(ax25BuildIFrame(rsData.data, RS_ENCODED_SIZE, &destAddress, (3 + i) % MAX_CONTINUOUS_PACKETS_ALLOWED, 0,
+                              &unstuffed),
+              OBC_GS_ERR_CODE_SUCCESS);
+    packed_ax25_i_frame_t stuffed;
+    ASSERT_EQ(ax25Stuff(unstuffed.data, unstuffed.length, stuffed.data, &stuffed.length), OBC_GS_ERR_CODE_SUCCESS);
+
+    ASSERT_EQ(encoded.lengths[i], stuffed.length);
+    EXPECT_EQ(memcmp(encoded.data.data() + encoded.offsets[i], stuffed.data, stuffed.length), 0);
+  }
+}
+
+TEST(TestBatch, BadFramesDoNotStopTheBatch) {
+  batch_config_t config = makeConfig(true);
+  TestBatch payloads = makePayloads();
+  TestBatch encoded(NUM_FRAMES, NUM_FRAMES * BATCH_ENCODED_FRAME_MAX_LEN);
+  encodeBatch(config, payloads, encoded);
+
+  // Frame 1: more errors than the RS code corrects
+  for (uint32_t j = 0; j < 40; ++j) {
+    encoded.data[encoded.offsets[1] + 20 + j * 6] ^= 0x80 | j;
+  }
+  // Frame 5: runs past the end of the buffer
+  encoded.lengths[5] = encoded.data.size();
+  // Frame 6: no stuffing at all and longer than any I frame once unstuffed
+  std::vector<uint8_t> noise(AX25_MAXIMUM_PKT_LEN, 0x55);
+  noise.front() = AX25_FLAG;
+  noise.back() = AX25_FLAG;
+  encoded.offsets[6] = encoded.data.size();
+  encoded.lengths[6] = noise.size();
+  encoded.data.insert(encoded.data.end(), noise.begin(), noise.end());
+
+  TestBatch decoded(NUM_FRAMES, NUM_FRAMES * BATCH_DECODED_FRAME_LEN);
+  decodeBatch(config, encoded, decoded);
+
+  EXPECT_NE(decoded.statuses[1], OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(decoded.statuses[5], OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(decoded.statuses[6], OBC_GS_ERR_CODE_INVALID_AX25_PACKET);
+  for (uint32_t i : {1U, 5U, 6U}) {
+    EXPECT_EQ(decoded.lengths[i], 0U);
+  }
+  for (uint32_t i : {0U, 2U, 3U, 4U, 7U}) {
+    ASSERT_EQ(decoded.statuses[i], OBC_GS_ERR_CODE_SUCCESS);
+    expectPayload(decoded, i, payloads);
+  }
+}
+
+TEST(TestBatch, ControlFrameDecodesToNothing) {
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+  packed_ax25_u_frame_t uFrame;
+  ASSERT_EQ(ax25SendUFrame(&uFrame, U_FRAME_CMD_ACK, 1), OBC_GS_ERR_CODE_SUCCESS);
+
+  TestBatch encoded(0, 0);
+  encoded.append(uFrame.data, uFrame.length);
+
+  batch_config_t config = makeConfig(false);
+  TestBatch decoded(1, BATCH_DECODED_FRAME_LEN);
+  decodeBatch(config, encoded, decoded);
+
+  EXPECT_EQ(decoded.statuses[0], OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(decoded.lengths[0], 0U);
+}
+
+TEST(TestBatch, OutputTooSmall) {
+  batch_config_t config = makeConfig(false);
+  TestBatch payloads = makePayloads();
+  TestBatch encoded(NUM_FRAMES, 3 * BATCH_ENCODED_FRAME_MAX_LEN);
+  encodeBatch(config, payloads, encoded);
+
+  // Every frame is shorter than the worst case, so at least three fit
+  uint32_t numEncoded = 0;
+  for (uint32_t i = 0; i < NUM_FRAMES; ++i) {
+    if (encoded.statuses[i] == OBC_GS_ERR_CODE_SUCCESS) {
+      numEncoded++;
+    } else {
+      EXPECT_EQ(encoded.statuses[i], OBC_GS_ERR_CODE_BUFF_TOO_SMALL);
+      EXPECT_EQ(encoded.lengths[i], 0U);
+    }
+  }
+  EXPECT_GE(numEncoded, 3U);
+  EXPECT_LT(numEncoded, NUM_FRAMES);
+}
+
+TEST(TestBatch, InvalidArguments) {
+  batch_config_t config = makeConfig(false);
+  TestBatch payloads = makePayloads();
+  TestBatch encoded(NUM_FRAMES, NUM_FRAMES * BATCH_ENCODED_FRAME_MAX_LEN);
+  frame_batch_t input = payloads.view();
+  frame_batch_t output = encoded.view();
+
+  EXPECT_EQ(batchEncodeFrames(NULL, &input, &output, encoded.statuses.data()), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(batchEncodeFrames(&config, &input, &output, NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(batchDecodeFrames(&config, NULL, &output, encoded.statuses.data()), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  config.aesKey = TEST_KEY;
+  EXPECT_EQ(batchEncodeFrames(&config, &input, &output, encoded.statuses.data()), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  config = makeConfig(false);
+  config.firstSendSeq = MAX_CONTINUOUS_PACKETS_ALLOWED;
+  EXPECT_EQ(batchEncodeFrames(&config, &input, &output, encoded.statuses.data()), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  // A payload longer than 223 bytes fails alone
+  config = makeConfig(false);
+  payloads.lengths[2] = RS_DECODED_SIZE + 1;
+  input = payloads.view();
+  ASSERT_EQ(batchEncodeFrames(&config, &input, &output, encoded.statuses.data()), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(encoded.statuses[2], OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(encoded.statuses[3], OBC_GS_ERR_CODE_SUCCESS);
+}
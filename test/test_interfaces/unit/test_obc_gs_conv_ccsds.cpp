@@ -0,0 +1,179 @@
+#include "obc_gs_conv_ccsds.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+static uint32_t nextPseudorandom(uint32_t *seed) {
+  // Pseudorandom generation using a simple algorithm
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return *seed >> 16;
+}
+
+static void fillPseudorandom(uint8_t *data, uint32_t len, uint32_t *seed) {
+  for (uint32_t i = 0; i < len; ++i) {
+    data[i] = (uint8_t)nextPseudorandom(seed);
+  }
+}
+
+static uint8_t getBit(const uint8_t *data, uint32_t index) { return (data[index / 8] >> (7 - index % 8)) & 1U; }
+
+/**
+ * @brief bit-at-a-time encoder written straight from the CCSDS polynomials, with tap d meaning a delay of d bits
+ */
+static std::vector<uint8_t> referenceEncode(const uint8_t *data, uint16_t dataLen) {
+  const uint8_t polynomials[2] = {0171, 0133};
+  uint8_t history[CONV_CCSDS_CONSTRAINT_LENGTH] = {0};
+  std::vector<uint8_t> bits;
+
+  for (uint32_t step = 0; step < CONV_CCSDS_NUM_STEPS(dataLen); ++step) {
+    memmove(history + 1, history, CONV_CCSDS_CONSTRAINT_LENGTH - 1);
+    history[0] = (step < dataLen * 8U) ? getBit(data, step) : 0;
+
+    for (uint8_t p = 0; p < 2; ++p) {
+      uint8_t output = 0;
+      for (uint8_t delay = 0; delay < CONV_CCSDS_CONSTRAINT_LENGTH; ++delay) {
+        if ((polynomials[p] >> (CONV_CCSDS_CONSTRAINT_LENGTH - 1 - delay)) & 1U) {
+          output ^= history[delay];
+        }
+      }
+      // CCSDS inverts the second output
+      bits.push_back(p == 1 ? output ^ 1U : output);
+    }
+  }
+
+  return bits;
+}
+
+class TestConvCcsds : public ::testing::Test {
+ protected:
+  // Too large for the test's stack
+  static conv_ccsds_decoder_t decoder;
+};
+
+conv_ccsds_decoder_t TestConvCcsds::decoder;
+
+TEST_F(TestConvCcsds, InvalidArgs) {
+  uint8_t data[4] = {0};
+  uint8_t encoded[CONV_CCSDS_ENCODED_SIZE(4)] = {0};
+
+  EXPECT_EQ(convCcsdsEncode(nullptr, 4, encoded, sizeof(encoded)), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(convCcsdsEncode(data, 4, nullptr, sizeof(encoded)), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(convCcsdsEncode(data, 4, encoded, sizeof(encoded) - 1), OBC_GS_ERR_CODE_BUFF_TOO_SMALL);
+  EXPECT_EQ(convCcsdsDecodeHard(nullptr, encoded, 4, data), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(convCcsdsDecodeHard(&decoder, encoded, CONV_CCSDS_MAX_DATA_SIZE + 1, data), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(convCcsdsDecodeSoft(&decoder, nullptr, 4, data), OBC_GS_ERR_CODE_INVALID_ARG);
+}
+
+TEST_F(TestConvCcsds, ZeroBlockAlternates) {
+  // All-zero data leaves the first output at 0 and the inverted second output at 1
+  uint8_t data[8] = {0};
+  uint8_t encoded[CONV_CCSDS_ENCODED_SIZE(8)];
+  ASSERT_EQ(convCcsdsEncode(data, sizeof(data), encoded, sizeof(encoded)), OBC_GS_ERR_CODE_SUCCESS);
+
+  for (uint16_t i = 0; i < 2 * sizeof(data); ++i) {
+    EXPECT_EQ(encoded[i], 0x55U);
+  }
+  EXPECT_EQ(encoded[2 * sizeof(data)], 0x55U);
+  EXPECT_EQ(encoded[2 * sizeof(data) + 1], 0x50U);
+}
+
+TEST_F(TestConvCcsds, EncodeMatchesReference) {
+  uint32_t seed = 0xC0DE;
+  uint8_t data[CONV_CCSDS_MAX_DATA_SIZE];
+  uint8_t encoded[CONV_CCSDS_ENCODED_SIZE(CONV_CCSDS_MAX_DATA_SIZE)];
+
+  for (uint16_t dataLen : {1, 2, 17, 223, 255}) {
+    fillPseudorandom(data, dataLen, &seed);
+    ASSERT_EQ(convCcsdsEncode(data, dataLen, encoded, sizeof(encoded)), OBC_GS_ERR_CODE_SUCCESS);
+
+    std::vector<uint8_t> expected = referenceEncode(data, dataLen);
+    ASSERT_EQ(expected.size(), CONV_CCSDS_ENCODED_BITS(dataLen));
+    for (uint32_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(getBit(encoded, i), expected[i]) << "length " << dataLen << ", bit " << i;
+    }
+  }
+}
+
+TEST_F(TestConvCcsds, DecodesCleanBlock) {
+  uint32_t seed = 0xC1EA;
+  uint8_t data[CONV_CCSDS_MAX_DATA_SIZE];
+  uint8_t encoded[CONV_CCSDS_ENCODED_SIZE(CONV_CCSDS_MAX_DATA_SIZE)];
+  uint8_t decoded[CONV_CCSDS_MAX_DATA_SIZE];
+
+  fillPseudorandom(data, sizeof(data), &seed);
+  ASSERT_EQ(convCcsdsEncode(data, sizeof(data), encoded, sizeof(encoded)), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(convCcsdsDecodeHard(&decoder, encoded, sizeof(data), decoded), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(decoded, data, sizeof(data)), 0);
+}
+
+TEST_F(TestConvCcsds, CorrectsScatteredBitErrors) {
+  uint32_t seed = 0xB17;
+  uint8_t data[CONV_CCSDS_MAX_DATA_SIZE];
+  uint8_t encoded[CONV_CCSDS_ENCODED_SIZE(CONV_CCSDS_MAX_DATA_SIZE)];
+  uint8_t decoded[CONV_CCSDS_MAX_DATA_SIZE];
+
+  for (uint32_t trial = 0; trial < 10; ++trial) {
+    fillPseudorandom(data, sizeof(data), &seed);
+    ASSERT_EQ(convCcsdsEncode(data, sizeof(data), encoded, sizeof(encoded)), OBC_GS_ERR_CODE_SUCCESS);
+
+    // The free distance is 10, so up to 4 bit errors within a few constraint lengths are always corrected
+    for (uint32_t bit = nextPseudorandom(&seed) % 40; bit < CONV_CCSDS_ENCODED_BITS(sizeof(data)); bit += 40) {
+      encoded[bit / 8] ^= (uint8_t)(0x80U >> (bit % 8));
+    }
+
+    ASSERT_EQ(convCcsdsDecodeHard(&decoder, encoded, sizeof(data), decoded), OBC_GS_ERR_CODE_SUCCESS);
+    ASSERT_EQ(memcmp(decoded, data, sizeof(data)), 0) << "trial " << trial;
+  }
+}
+
+TEST_F(TestConvCcsds, SoftSymbolsOutvoteWeakErrors) {
+  uint32_t seed = 0x50F7;
+  uint8_t data[64];
+  uint8_t encoded[CONV_CCSDS_ENCODED_SIZE(64)];
+  uint8_t symbols[CONV_CCSDS_ENCODED_BITS(64)];
+  uint8_t decoded[64];
+
+  fillPseudorandom(data, sizeof(data), &seed);
+  ASSERT_EQ(convCcsdsEncode(data, sizeof(data), encoded, sizeof(encoded)), OBC_GS_ERR_CODE_SUCCESS);
+
+  // Every third symbol is an erasure and every seventh is barely on the wrong side; confident symbols outweigh both
+  for (uint32_t i = 0; i < sizeof(symbols); ++i) {
+    uint8_t bit = getBit(encoded, i);
+    symbols[i] = bit ? 200U : 55U;
+    if (i % 3 == 0) {
+      symbols[i] = 128U;
+    } else if (i % 7 == 0) {
+      symbols[i] = bit ? 120U : 135U;
+    }
+  }
+
+  ASSERT_EQ(convCcsdsDecodeSoft(&decoder, symbols, sizeof(data), decoded), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(decoded, data, sizeof(data)), 0);
+}
+
+TEST_F(TestConvCcsds, WrapsRsCodeword) {
+  uint32_t seed = 0x2545;
+  uint8_t message[RS_DECODED_SIZE];
+  fillPseudorandom(message, sizeof(message), &seed);
+
+  packed_rs_packet_t rsData = {0};
+  ASSERT_EQ(rsEncode(message, &rsData), OBC_GS_ERR_CODE_SUCCESS);
+
+  packed_conv_packet_t convData = {0};
+  ASSERT_EQ(convEncode(&rsData, &convData), OBC_GS_ERR_CODE_SUCCESS);
+  for (uint32_t bit = 5; bit < CONV_SOFT_SYMBOLS; bit += 50) {
+    convData.data[bit / 8] ^= (uint8_t)(0x80U >> (bit % 8));
+  }
+
+  packed_rs_packet_t received = {0};
+  ASSERT_EQ(convDecode(&decoder, &convData, &received), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(received.data, rsData.data, RS_ENCODED_SIZE), 0);
+
+  uint8_t decoded[RS_DECODED_SIZE];
+  ASSERT_EQ(rsDecode(&received, decoded, RS_DECODED_SIZE), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(decoded, message, RS_DECODED_SIZE), 0);
+}
@@ -0,0 +1,120 @@
+#include "obc_gs_crc.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+
+#define CRC_BENCHMARK_BUFFER_SIZE (256U * 1024U)
+#define CRC_BENCHMARK_ITERATIONS 8U
+
+typedef uint16_t (*crc16_fn_t)(uint16_t, const uint8_t *, uint32_t);
+typedef uint32_t (*crc32_fn_t)(uint32_t, const uint8_t *, uint32_t);
+
+typedef struct {
+  const char *name;
+  crc16_fn_t crc16;
+  crc32_fn_t crc32;
+} crc_variant_t;
+
+static const crc_variant_t crcVariants[] = {
+    {"bitwise", crc16CcittUpdateBitwise, crc32Bitwise},
+#if OBC_GS_CRC_ALGORITHM >= OBC_GS_CRC_SARWATE
+    {"sarwate", crc16CcittUpdateSarwate, crc32Sarwate},
+#endif
+#if OBC_GS_CRC_ALGORITHM >= OBC_GS_CRC_SLICE_BY_4
+    {"slice-by-4", crc16CcittUpdateSliceBy4, crc32SliceBy4},
+#endif
+#if OBC_GS_CRC_ALGORITHM >= OBC_GS_CRC_SLICE_BY_8
+    {"slice-by-8", crc16CcittUpdateSliceBy8, crc32SliceBy8},
+#endif
+};
+
+static void fillPseudorandom(uint8_t *data, size_t len, uint32_t seed) {
+  for (size_t i = 0; i < len; ++i) {
+    // Pseudorandom generation using a simple algorithm
+    seed = (seed * 1103515245 + 12345) % (1 << 31);
+    data[i] = (uint8_t)(seed >> 16);
+  }
+}
+
+TEST(TestCrc, KnownCheckValues) {
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+  for (const crc_variant_t &variant : crcVariants) {
+    // CRC-16/XMODEM and CRC-32/ISO-HDLC check values
+    EXPECT_EQ(variant.crc16(0, check, sizeof(check)), 0x31C3) << variant.name;
+    EXPECT_EQ(variant.crc32(0, check, sizeof(check)), 0xCBF43926U) << variant.name;
+  }
+
+  EXPECT_EQ(calculateCrc16Ccitt(check, sizeof(check)), 0x31C3);
+  EXPECT_EQ(crc32(0, check, sizeof(check)), 0xCBF43926U);
+}
+
+TEST(TestCrc, VariantsMatchBitwiseForAllLengthsAndOffsets) {
+  uint8_t data[300];
+  fillPseudorandom(data, sizeof(data), 0x5EED1234);
+
+  // Cover every tail length and misalignment of the slicing loops
+  for (uint32_t offset = 0; offset < 8; ++offset) {
+    for (uint32_t len = 0; len + offset <= sizeof(data); ++len) {
+      uint16_t expected16 = crc16CcittUpdateBitwise(0, data + offset, len);
+      uint32_t expected32 = crc32Bitwise(0, data + offset, len);
+
+      for (const crc_variant_t &variant : crcVariants) {
+        ASSERT_EQ(variant.crc16(0, data + offset, len), expected16) << variant.name << " len " << len;
+        ASSERT_EQ(variant.crc32(0, data + offset, len), expected32) << variant.name << " len " << len;
+      }
+    }
+  }
+}
+
+TEST(TestCrc, StreamingMatchesOneShot) {
+  uint8_t data[1000];
+  fillPseudorandom(data, sizeof(data), 0xC0FFEE);
+
+  uint16_t oneShot16 = calculateCrc16Ccitt(data, sizeof(data));
+  uint32_t oneShot32 = crc32(0, data, sizeof(data));
+
+  const uint32_t chunkSizes[] = {1, 3, 7, 8, 13, 64, 255};
+  for (uint32_t chunkSize : chunkSizes) {
+    uint16_t crc16 = 0;
+    uint32_t crc = 0;
+    for (uint32_t i = 0; i < sizeof(data); i += chunkSize) {
+      uint32_t len = (sizeof(data) - i < chunkSize) ? (sizeof(data) - i) : chunkSize;
+      crc16 = crc16CcittUpdate(crc16, data + i, len);
+      crc = crc32(crc, data + i, len);
+    }
+    EXPECT_EQ(crc16, oneShot16) << "chunk " << chunkSize;
+    EXPECT_EQ(crc, oneShot32) << "chunk " << chunkSize;
+  }
+}
+
+TEST(TestCrc, Benchmark) {
+  std::vector<uint8_t> data(CRC_BENCHMARK_BUFFER_SIZE);
+  fillPseudorandom(data.data(), data.size(), 0xBEEF);
+
+  const double totalMegabytes = (double)CRC_BENCHMARK_BUFFER_SIZE * CRC_BENCHMARK_ITERATIONS / (1024.0 * 1024.0);
+
+  for (const crc_variant_t &variant : crcVariants) {
+    volatile uint32_t sink = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < CRC_BENCHMARK_ITERATIONS; ++i) {
+      sink = sink + variant.crc16(0, data.data(), data.size());
+    }
+    double crc16Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < CRC_BENCHMARK_ITERATIONS; ++i) {
+      sink = sink + variant.crc32(0, data.data(), data.size());
+    }
+    double crc32Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("[ CRC      ] %-10s crc16-ccitt %8.1f MB/s, crc32 %8.1f MB/s\n", variant.name,
+           totalMegabytes / crc16Seconds, totalMegabytes / crc32Seconds);
+  }
+}
@@ -0,0 +1,211 @@
+#include "obc_gs_ax25.h"
+#include "obc_gs_erasure_hints.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+// Stuffed bytes that can never form a run of five 1s, so writing them over a quiet part of a frame corrupts the
+// data without adding or removing stuffing bits
+#define NO_STUFFING_PATTERN 0x55U
+
+static uint32_t nextPseudorandom(uint32_t *seed) {
+  // Pseudorandom generation using a simple algorithm
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return *seed >> 16;
+}
+
+/**
+ * @brief builds a stuffed I frame carrying the RS codeword of message
+ */
+static void buildFrame(const uint8_t *message, packed_ax25_i_frame_t *stuffed, unstuffed_ax25_i_frame_t *unstuffed) {
+  packed_rs_packet_t rsData = {0};
+  ASSERT_EQ(rsEncode((uint8_t *)message, &rsData), OBC_GS_ERR_CODE_SUCCESS);
+
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+  memset(unstuffed, 0, sizeof(*unstuffed));
+  ASSERT_EQ(ax25SendIFrame(rsData.data, RS_ENCODED_SIZE, unstuffed), OBC_GS_ERR_CODE_SUCCESS);
+
+  memset(stuffed, 0, sizeof(*stuffed));
+  ASSERT_EQ(ax25Stuff(unstuffed->data, unstuffed->length, stuffed->data, &stuffed->length), OBC_GS_ERR_CODE_SUCCESS);
+}
+
+TEST(TestErasureHints, MarkClipsToCodeword) {
+  rs_erasure_hints_t hints;
+  rsErasureHintsInit(&hints);
+
+  rsErasureHintsMark(&hints, -3, 5, RS_ERASURE_HINT_LINK_QUALITY);
+  rsErasureHintsMark(&hints, RS_ENCODED_SIZE - 1, 10, RS_ERASURE_HINT_LINK_QUALITY);
+  EXPECT_EQ(hints.numHinted, 3U);
+  EXPECT_EQ(hints.hint[0], RS_ERASURE_HINT_LINK_QUALITY);
+  EXPECT_EQ(hints.hint[1], RS_ERASURE_HINT_LINK_QUALITY);
+  EXPECT_EQ(hints.hint[2], RS_ERASURE_HINT_NONE);
+  EXPECT_EQ(hints.hint[RS_ENCODED_SIZE - 1], RS_ERASURE_HINT_LINK_QUALITY);
+
+  // A byte keeps the stronger hint and is only counted once
+  rsErasureHintsMark(&hints, 1, 2, RS_ERASURE_HINT_FRAMING);
+  rsErasureHintsMark(&hints, 1, 2, RS_ERASURE_HINT_LINK_QUALITY);
+  EXPECT_EQ(hints.numHinted, 4U);
+  EXPECT_EQ(hints.hint[1], RS_ERASURE_HINT_FRAMING);
+  EXPECT_EQ(hints.hint[2], RS_ERASURE_HINT_FRAMING);
+}
+
+TEST(TestErasureHints, CleanFrameHasNoAnomalies) {
+  uint8_t message[RS_DECODED_SIZE];
+  uint32_t seed = 0xC1EA4;
+  for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+    message[i] = (uint8_t)nextPseudorandom(&seed);
+  }
+
+  packed_ax25_i_frame_t stuffed;
+  unstuffed_ax25_i_frame_t expected;
+  buildFrame(message, &stuffed, &expected);
+
+  unstuffed_ax25_i_frame_t unstuffed = {0};
+  uint16_t anomalies[4];
+  uint8_t numAnomalies = 0xFF;
+  ASSERT_EQ(ax25UnstuffWithAnomalies(stuffed.data, stuffed.length, unstuffed.data, &unstuffed.length, anomalies, 4,
+                                     &numAnomalies),
+            OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(numAnomalies, 0U);
+  ASSERT_EQ(unstuffed.length, expected.length);
+  EXPECT_EQ(memcmp(unstuffed.data, expected.data, expected.length), 0);
+}
+
+TEST(TestErasureHints, StuffingViolationIsLocated) {
+  uint8_t message[RS_DECODED_SIZE] = {0};
+  packed_ax25_i_frame_t stuffed;
+  unstuffed_ax25_i_frame_t expected;
+  buildFrame(message, &stuffed, &expected);
+
+  // An all-zero message has almost no stuffing, so stuffed and unstuffed offsets nearly line up
+  const uint16_t corruptAt = 1 + AX25_INFO_FIELD_POSITION + 100;
+  stuffed.data[corruptAt] = 0xFF;
+
+  unstuffed_ax25_i_frame_t unstuffed = {0};
+  rs_erasure_hints_t hints;
+  ASSERT_EQ(ax25UnstuffWithErasureHints(stuffed.data, stuffed.length, NULL, 0, &unstuffed, &hints),
+            OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_GT(hints.numHinted, 0U);
+
+  bool nearCorruption = false;
+  for (int32_t i = 100 - 4; i <= 100 + 4; ++i) {
+    nearCorruption |= hints.hint[i] == RS_ERASURE_HINT_FRAMING;
+  }
+  EXPECT_TRUE(nearCorruption);
+}
+
+TEST(TestErasureHints, HintsRecoverBurstBeyondErrorCapacity) {
+  uint8_t message[RS_DECODED_SIZE];
+  uint32_t seed = 0xB0257;
+  for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+    message[i] = (uint8_t)nextPseudorandom(&seed);
+  }
+
+  packed_rs_packet_t original = {0};
+  ASSERT_EQ(rsEncode(message, &original), OBC_GS_ERR_CODE_SUCCESS);
+
+  const uint8_t burstStart = 60;
+  const uint8_t burstLen = 24;
+  packed_rs_packet_t received = original;
+  for (uint8_t i = 0; i < burstLen; ++i) {
+    received.data[burstStart + i] ^= (uint8_t)(nextPseudorandom(&seed) | 1U);
+  }
+
+  uint8_t decoded[RS_DECODED_SIZE];
+  packed_rs_packet_t errorsOnly = received;
+  EXPECT_EQ(rsDecode(&errorsOnly, decoded, RS_DECODED_SIZE), OBC_GS_ERR_CODE_REED_SOL_DEC_ERR);
+
+  rs_erasure_hints_t hints;
+  rsErasureHintsInit(&hints);
+  rsErasureHintsMark(&hints, burstStart - 2, burstLen + 4, RS_ERASURE_HINT_LINK_QUALITY);
+
+  rs_erasure_hint_t usedHint = RS_ERASURE_HINT_NONE;
+  ASSERT_EQ(rsDecodeWithErasureHints(&received, &hints, decoded, RS_DECODED_SIZE, &usedHint), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(usedHint, RS_ERASURE_HINT_LINK_QUALITY);
+  EXPECT_EQ(memcmp(decoded, message, RS_DECODED_SIZE), 0);
+  EXPECT_EQ(memcmp(received.data, original.data, RS_ENCODED_SIZE), 0);
+}
+
+TEST(TestErasureHints, WideHintFindsBurstInside) {
+  uint8_t message[RS_DECODED_SIZE];
+  uint32_t seed = 0x91DE;
+  for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+    message[i] = (uint8_t)nextPseudorandom(&seed);
+  }
+
+  packed_rs_packet_t received = {0};
+  ASSERT_EQ(rsEncode(message, &received), OBC_GS_ERR_CODE_SUCCESS);
+
+  // A whole receive chunk is flagged, far more than can be erased at once, but the burst is only part of it
+  const uint8_t chunkStart = 100;
+  const uint8_t chunkLen = 100;
+  const uint8_t burstStart = chunkStart + 57;
+  const uint8_t burstLen = 20;
+  for (uint8_t i = 0; i < burstLen; ++i) {
+    received.data[burstStart + i] ^= (uint8_t)(nextPseudorandom(&seed) | 1U);
+  }
+
+  rs_erasure_hints_t hints;
+  rsErasureHintsInit(&hints);
+  rsErasureHintsMark(&hints, chunkStart, chunkLen, RS_ERASURE_HINT_LINK_QUALITY);
+
+  uint8_t decoded[RS_DECODED_SIZE];
+  rs_erasure_hint_t usedHint = RS_ERASURE_HINT_NONE;
+  ASSERT_EQ(rsDecodeWithErasureHints(&received, &hints, decoded, RS_DECODED_SIZE, &usedHint), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(usedHint, RS_ERASURE_HINT_LINK_QUALITY);
+  EXPECT_EQ(memcmp(decoded, message, RS_DECODED_SIZE), 0);
+}
+
+TEST(TestErasureHints, WrongHintsDoNotLoseFrames) {
+  uint8_t message[RS_DECODED_SIZE];
+  uint32_t seed = 0x3A1E;
+  for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+    message[i] = (uint8_t)nextPseudorandom(&seed);
+  }
+
+  packed_rs_packet_t received = {0};
+  ASSERT_EQ(rsEncode(message, &received), OBC_GS_ERR_CODE_SUCCESS);
+  for (uint8_t i = 0; i < (RS_MAX_ERASURES / 2); ++i) {
+    received.data[i * 7] ^= 0x5A;
+  }
+
+  // Every hint points away from the errors, but errors-only decoding is tried first
+  rs_erasure_hints_t hints;
+  rsErasureHintsInit(&hints);
+  rsErasureHintsMark(&hints, 200, RS_MAX_ERASURES, RS_ERASURE_HINT_FRAMING);
+
+  uint8_t decoded[RS_DECODED_SIZE];
+  rs_erasure_hint_t usedHint = RS_ERASURE_HINT_FRAMING;
+  ASSERT_EQ(rsDecodeWithErasureHints(&received, &hints, decoded, RS_DECODED_SIZE, &usedHint), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(usedHint, RS_ERASURE_HINT_NONE);
+  EXPECT_EQ(memcmp(decoded, message, RS_DECODED_SIZE), 0);
+}
+
+TEST(TestErasureHints, PoorLinkRangeRecoversFrame) {
+  uint8_t message[RS_DECODED_SIZE] = {0};
+  packed_ax25_i_frame_t stuffed;
+  unstuffed_ax25_i_frame_t expected;
+  buildFrame(message, &stuffed, &expected);
+
+  // 24 corrupted bytes is past the 16 that errors-only decoding can fix
+  const ax25_byte_range_t poorRange = {.start = 1 + AX25_INFO_FIELD_POSITION + 40, .length = 24};
+  memset(stuffed.data + poorRange.start, NO_STUFFING_PATTERN, poorRange.length);
+
+  unstuffed_ax25_i_frame_t unstuffed = {0};
+  rs_erasure_hints_t hints;
+  ASSERT_EQ(ax25UnstuffWithErasureHints(stuffed.data, stuffed.length, &poorRange, 1, &unstuffed, &hints),
+            OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(unstuffed.length, expected.length);
+  EXPECT_LE(hints.numHinted, RS_MAX_ERASURES);
+
+  packed_rs_packet_t rsData = {0};
+  memcpy(rsData.data, unstuffed.data + AX25_INFO_FIELD_POSITION, RS_ENCODED_SIZE);
+
+  uint8_t decoded[RS_DECODED_SIZE];
+  ASSERT_EQ(rsDecodeWithErasureHints(&rsData, &hints, decoded, RS_DECODED_SIZE, NULL), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(decoded, message, RS_DECODED_SIZE), 0);
+  EXPECT_EQ(memcmp(rsData.data, expected.data + AX25_INFO_FIELD_POSITION, RS_ENCODED_SIZE), 0);
+}
@@ -0,0 +1,237 @@
+#include "obc_gs_errors.h"
+#include "obc_gs_rs_ccsds.h"
+
+// correct.h has no C++ linkage guards
+extern "C" {
+#include <correct.h>
+}
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+static uint32_t nextPseudorandom(uint32_t *seed) {
+  // Pseudorandom generation using a simple algorithm
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return *seed >> 16;
+}
+
+static void fillPseudorandom(uint8_t *data, uint32_t len, uint32_t *seed) {
+  for (uint32_t i = 0; i < len; ++i) {
+    data[i] = (uint8_t)nextPseudorandom(seed);
+  }
+}
+
+/**
+ * @brief flips numErrors distinct bytes of the codeword to random non-zero error values
+ */
+static void corruptCodeword(uint8_t *codeword, uint8_t numErrors, uint32_t *seed) {
+  bool corrupted[RS_CCSDS_BLOCK_SIZE] = {false};
+  for (uint8_t i = 0; i < numErrors;) {
+    uint32_t position = nextPseudorandom(seed) % RS_CCSDS_BLOCK_SIZE;
+    uint8_t error = (uint8_t)nextPseudorandom(seed);
+    if (corrupted[position] || error == 0) {
+      continue;
+    }
+    corrupted[position] = true;
+    codeword[position] ^= error;
+    ++i;
+  }
+}
+
+class TestRsCcsds : public ::testing::Test {
+ protected:
+  void SetUp() override { rs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32); }
+  void TearDown() override { correct_reed_solomon_destroy(rs); }
+
+  correct_reed_solomon *rs;
+};
+
+TEST_F(TestRsCcsds, InvalidArgs) {
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE] = {0};
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE] = {0};
+
+  EXPECT_EQ(rsCcsdsEncode(nullptr, codeword), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsCcsdsEncode(message, nullptr), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsCcsdsDecode(nullptr, message, nullptr), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsCcsdsDecode(codeword, nullptr, nullptr), OBC_GS_ERR_CODE_INVALID_ARG);
+}
+
+TEST_F(TestRsCcsds, EncodeMatchesLibcorrect) {
+  uint32_t seed = 0x5EED;
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE];
+  uint8_t expected[RS_CCSDS_BLOCK_SIZE];
+
+  for (uint32_t trial = 0; trial < 100; ++trial) {
+    fillPseudorandom(message, sizeof(message), &seed);
+    ASSERT_EQ(rsCcsdsEncode(message, codeword), OBC_GS_ERR_CODE_SUCCESS);
+    ASSERT_EQ(correct_reed_solomon_encode(rs, message, RS_CCSDS_MESSAGE_SIZE, expected), RS_CCSDS_BLOCK_SIZE);
+    ASSERT_EQ(memcmp(codeword, expected, RS_CCSDS_BLOCK_SIZE), 0) << "trial " << trial;
+  }
+}
+
+TEST_F(TestRsCcsds, CleanCodewordTakesShortcut) {
+  uint32_t seed = 0xC1EA;
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE];
+  uint8_t decoded[RS_CCSDS_MESSAGE_SIZE];
+
+  fillPseudorandom(message, sizeof(message), &seed);
+  ASSERT_EQ(rsCcsdsEncode(message, codeword), OBC_GS_ERR_CODE_SUCCESS);
+
+  uint8_t numCorrected = 0xFF;
+  ASSERT_EQ(rsCcsdsDecode(codeword, decoded, &numCorrected), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(numCorrected, 0U);
+  EXPECT_EQ(memcmp(decoded, message, RS_CCSDS_MESSAGE_SIZE), 0);
+}
+
+TEST_F(TestRsCcsds, CorrectsUpToSixteenErrors) {
+  uint32_t seed = 0xDECAF;
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE];
+  uint8_t decoded[RS_CCSDS_MESSAGE_SIZE];
+
+  for (uint8_t numErrors = 1; numErrors <= RS_CCSDS_MAX_CORRECTABLE; ++numErrors) {
+    for (uint32_t trial = 0; trial < 20; ++trial) {
+      fillPseudorandom(message, sizeof(message), &seed);
+      ASSERT_EQ(rsCcsdsEncode(message, codeword), OBC_GS_ERR_CODE_SUCCESS);
+      corruptCodeword(codeword, numErrors, &seed);
+
+      uint8_t numCorrected = 0;
+      ASSERT_EQ(rsCcsdsDecode(codeword, decoded, &numCorrected), OBC_GS_ERR_CODE_SUCCESS)
+          << (int)numErrors << " errors, trial " << trial;
+      EXPECT_EQ(numCorrected, numErrors);
+      ASSERT_EQ(memcmp(decoded, message, RS_CCSDS_MESSAGE_SIZE), 0) << (int)numErrors << " errors, trial " << trial;
+    }
+  }
+}
+
+TEST_F(TestRsCcsds, DecodesInPlace) {
+  uint32_t seed = 0x1234;
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE];
+
+  fillPseudorandom(message, sizeof(message), &seed);
+  ASSERT_EQ(rsCcsdsEncode(message, codeword), OBC_GS_ERR_CODE_SUCCESS);
+  corruptCodeword(codeword, 8, &seed);
+
+  ASSERT_EQ(rsCcsdsDecode(codeword, codeword, nullptr), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(codeword, message, RS_CCSDS_MESSAGE_SIZE), 0);
+}
+
+TEST_F(TestRsCcsds, AgreesWithLibcorrectBeyondCapacity) {
+  uint32_t seed = 0xBAD;
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE];
+  uint8_t decoded[RS_CCSDS_MESSAGE_SIZE];
+
+  for (uint8_t numErrors = RS_CCSDS_MAX_CORRECTABLE + 1; numErrors <= 40; ++numErrors) {
+    for (uint32_t trial = 0; trial < 10; ++trial) {
+      fillPseudorandom(message, sizeof(message), &seed);
+      ASSERT_EQ(rsCcsdsEncode(message, codeword), OBC_GS_ERR_CODE_SUCCESS);
+      corruptCodeword(codeword, numErrors, &seed);
+
+      // Past the correction limit a word is either rejected or decoded to a different codeword; it must never
+      // come back as the original message
+      obc_gs_error_code_t errCode = rsCcsdsDecode(codeword, decoded, nullptr);
+      if (errCode == OBC_GS_ERR_CODE_SUCCESS) {
+        EXPECT_NE(memcmp(decoded, message, RS_CCSDS_MESSAGE_SIZE), 0);
+      } else {
+        EXPECT_EQ(errCode, OBC_GS_ERR_CODE_REED_SOL_DEC_ERR);
+      }
+
+      uint8_t expected[RS_CCSDS_MESSAGE_SIZE];
+      bool libcorrectDecoded =
+          correct_reed_solomon_decode(rs, codeword, RS_CCSDS_BLOCK_SIZE, expected) == (ssize_t)RS_CCSDS_MESSAGE_SIZE;
+      EXPECT_EQ(errCode == OBC_GS_ERR_CODE_SUCCESS, libcorrectDecoded) << (int)numErrors << " errors, trial " << trial;
+      if (errCode == OBC_GS_ERR_CODE_SUCCESS && libcorrectDecoded) {
+        EXPECT_EQ(memcmp(decoded, expected, RS_CCSDS_MESSAGE_SIZE), 0);
+      }
+    }
+  }
+}
+
+TEST_F(TestRsCcsds, ErasureInvalidArgs) {
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE] = {0};
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE] = {0};
+  uint8_t erasures[RS_CCSDS_MAX_CORRECTABLE * 2 + 1] = {0};
+
+  EXPECT_EQ(rsCcsdsDecodeWithErasures(codeword, nullptr, 1, message, nullptr), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsCcsdsDecodeWithErasures(codeword, erasures, sizeof(erasures), message, nullptr),
+            OBC_GS_ERR_CODE_INVALID_ARG);
+
+  erasures[0] = RS_CCSDS_BLOCK_SIZE;
+  EXPECT_EQ(rsCcsdsDecodeWithErasures(codeword, erasures, 1, message, nullptr), OBC_GS_ERR_CODE_INVALID_ARG);
+}
+
+TEST_F(TestRsCcsds, CorrectsErasuresAndErrorsTogether) {
+  uint32_t seed = 0xE4A5E;
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE];
+  uint8_t decoded[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t erasures[2 * RS_CCSDS_MAX_CORRECTABLE];
+
+  // Every split of the 32 parity symbols between erasures and errors, with 2 * errors + erasures <= 32
+  for (uint8_t numErasures = 0; numErasures <= 2 * RS_CCSDS_MAX_CORRECTABLE; numErasures += 4) {
+    uint8_t numErrors = (2 * RS_CCSDS_MAX_CORRECTABLE - numErasures) / 2;
+    for (uint32_t trial = 0; trial < 10; ++trial) {
+      fillPseudorandom(message, sizeof(message), &seed);
+      ASSERT_EQ(rsCcsdsEncode(message, codeword), OBC_GS_ERR_CODE_SUCCESS);
+
+      // Erase a contiguous burst, then add errors elsewhere; an erased byte may or may not be wrong
+      uint8_t burstStart = (uint8_t)(nextPseudorandom(&seed) % (RS_CCSDS_BLOCK_SIZE - numErasures));
+      uint8_t saved[2 * RS_CCSDS_MAX_CORRECTABLE];
+      for (uint8_t i = 0; i < numErasures; ++i) {
+        erasures[i] = burstStart + i;
+        saved[i] = codeword[burstStart + i];
+      }
+      corruptCodeword(codeword, numErrors, &seed);
+      for (uint8_t i = 0; i < numErasures; ++i) {
+        codeword[burstStart + i] = saved[i] ^ (uint8_t)nextPseudorandom(&seed);
+      }
+
+      ASSERT_EQ(rsCcsdsDecodeWithErasures(codeword, erasures, numErasures, decoded, nullptr), OBC_GS_ERR_CODE_SUCCESS)
+          << (int)numErasures << " erasures, trial " << trial;
+      ASSERT_EQ(memcmp(decoded, message, RS_CCSDS_MESSAGE_SIZE), 0)
+          << (int)numErasures << " erasures, trial " << trial;
+    }
+  }
+}
+
+TEST_F(TestRsCcsds, ErasuresAgreeWithLibcorrect) {
+  uint32_t seed = 0xA9EE;
+  uint8_t message[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t codeword[RS_CCSDS_BLOCK_SIZE];
+  uint8_t decoded[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t expected[RS_CCSDS_MESSAGE_SIZE];
+  uint8_t erasures[2 * RS_CCSDS_MAX_CORRECTABLE];
+
+  for (uint32_t trial = 0; trial < 200; ++trial) {
+    fillPseudorandom(message, sizeof(message), &seed);
+    ASSERT_EQ(rsCcsdsEncode(message, codeword), OBC_GS_ERR_CODE_SUCCESS);
+
+    // Some trials are past the correction limit on purpose
+    uint8_t numErasures = (uint8_t)(nextPseudorandom(&seed) % (2 * RS_CCSDS_MAX_CORRECTABLE + 1));
+    uint8_t numErrors = (uint8_t)(nextPseudorandom(&seed) % (RS_CCSDS_MAX_CORRECTABLE + 4));
+    uint8_t burstStart = (uint8_t)(nextPseudorandom(&seed) % (RS_CCSDS_BLOCK_SIZE - numErasures));
+    for (uint8_t i = 0; i < numErasures; ++i) {
+      erasures[i] = burstStart + i;
+      codeword[burstStart + i] ^= (uint8_t)nextPseudorandom(&seed);
+    }
+    corruptCodeword(codeword, numErrors, &seed);
+
+    obc_gs_error_code_t errCode = rsCcsdsDecodeWithErasures(codeword, erasures, numErasures, decoded, nullptr);
+    bool libcorrectDecoded = correct_reed_solomon_decode_with_erasures(rs, codeword, RS_CCSDS_BLOCK_SIZE, erasures,
+                                                                       numErasures,
+                                                                       expected) == (ssize_t)RS_CCSDS_MESSAGE_SIZE;
+
+    if (2 * numErrors + numErasures <= 2 * RS_CCSDS_MAX_CORRECTABLE) {
+      ASSERT_EQ(errCode, OBC_GS_ERR_CODE_SUCCESS) << "trial " << trial;
+      EXPECT_EQ(memcmp(decoded, message, RS_CCSDS_MESSAGE_SIZE), 0) << "trial " << trial;
+    }
+    if (errCode == OBC_GS_ERR_CODE_SUCCESS && libcorrectDecoded) {
+      EXPECT_EQ(memcmp(decoded, expected, RS_CCSDS_MESSAGE_SIZE), 0) << "trial " << trial;
+    }
+  }
+}
@@ -0,0 +1,182 @@
+#include "obc_gs_telemetry_record.h"
+#include "obc_gs_telemetry_pack.h"
+#include "obc_gs_telemetry_unpack.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_errors.h"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+static telemetry_data_t makeObcTemp(uint32_t timestamp, float temp) {
+  telemetry_data_t data = {0};
+  data.id = TELEM_OBC_TEMP;
+  data.timestamp = timestamp;
+  data.obcTemp = temp;
+  return data;
+}
+
+static telemetry_data_t makeObcState(uint32_t timestamp, uint8_t state) {
+  telemetry_data_t data = {0};
+  data.id = TELEM_OBC_STATE;
+  data.timestamp = timestamp;
+  data.obcState = state;
+  return data;
+}
+
+// Copies a finished block the way it would be read back from a file
+static void storeAndReload(telemetry_record_block_t *block, telemetry_record_block_t *reloaded) {
+  uint16_t blockLen = 0;
+  ASSERT_EQ(telemRecordBlockFinish(block, &blockLen), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(blockLen, TELEM_RECORD_BLOCK_HEADER_SIZE + block->payloadLen);
+
+  memset(reloaded, 0xAA, sizeof(*reloaded));
+  memcpy(reloaded->data, block->data, blockLen);
+}
+
+TEST(TestObcGsTelemetryRecord, RecordsMatchPackTelemetry) {
+  telemetry_record_block_t block;
+  telemRecordBlockInit(&block);
+
+  telemetry_data_t points[] = {makeObcTemp(0x12345678, 21.5f), makeObcState(0x12345679, 3),
+                               makeObcTemp(0x1234567A, -4.25f)};
+  for (const telemetry_data_t &point : points) {
+    ASSERT_EQ(telemRecordBlockAppend(&block, &point), OBC_GS_ERR_CODE_SUCCESS);
+  }
+  EXPECT_EQ(block.numRecords, 3);
+
+  telemetry_record_block_t reloaded;
+  storeAndReload(&block, &reloaded);
+  ASSERT_EQ(telemRecordBlockLoad(&reloaded), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(reloaded.numRecords, 3);
+
+  uint16_t offset = 0;
+  const uint8_t *record = NULL;
+  uint8_t recordLen = 0;
+  for (const telemetry_data_t &point : points) {
+    ASSERT_TRUE(telemRecordBlockNext(&reloaded, &offset, &record, &recordLen));
+
+    uint8_t expected[MAX_TELEMETRY_DATA_SIZE];
+    uint32_t expectedLen = 0;
+    ASSERT_EQ(packTelemetry(&point, expected, sizeof(expected), &expectedLen), OBC_GS_ERR_CODE_SUCCESS);
+    ASSERT_EQ(recordLen, expectedLen);
+    EXPECT_EQ(memcmp(record, expected, expectedLen), 0);
+
+    telemetry_data_t unpacked = {0};
+    uint32_t unpackedLen = 0;
+    ASSERT_EQ(unpackTelemetry(record, &unpackedLen, &unpacked), OBC_GS_ERR_CODE_SUCCESS);
+    EXPECT_EQ(unpackedLen, recordLen);
+    EXPECT_EQ(unpacked.id, point.id);
+    EXPECT_EQ(unpacked.timestamp, point.timestamp);
+  }
+
+  EXPECT_FALSE(telemRecordBlockNext(&reloaded, &offset, &record, &recordLen));
+}
+
+TEST(TestObcGsTelemetryRecord, FullBlockRejectsRecordUnchanged) {
+  telemetry_record_block_t block;
+  telemRecordBlockInit(&block);
+
+  telemetry_data_t point = makeObcTemp(1000, 30.0f);
+  uint32_t numAppended = 0;
+  while (telemRecordBlockAppend(&block, &point) == OBC_GS_ERR_CODE_SUCCESS) {
+    numAppended++;
+    point.timestamp++;
+  }
+
+  // Each temperature record is a length byte, the ID, the timestamp and the float
+  const uint32_t recordSize = TELEM_RECORD_LENGTH_SIZE + 1 + 4 + 4;
+  EXPECT_EQ(numAppended, TELEM_RECORD_BLOCK_MAX_PAYLOAD_SIZE / recordSize);
+  EXPECT_EQ(block.numRecords, numAppended);
+  EXPECT_EQ(block.payloadLen, numAppended * recordSize);
+
+  uint16_t blockLen = 0;
+  ASSERT_EQ(telemRecordBlockFinish(&block, &blockLen), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_LE(blockLen, TELEM_RECORD_BLOCK_SIZE);
+}
+
+TEST(TestObcGsTelemetryRecord, EmptyBlock) {
+  telemetry_record_block_t block;
+  telemRecordBlockInit(&block);
+
+  telemetry_record_block_t reloaded;
+  storeAndReload(&block, &reloaded);
+  ASSERT_EQ(telemRecordBlockLoad(&reloaded), OBC_GS_ERR_CODE_SUCCESS);
+
+  uint16_t offset = 0;
+  const uint8_t *record = NULL;
+  uint8_t recordLen = 0;
+  EXPECT_FALSE(telemRecordBlockNext(&reloaded, &offset, &record, &recordLen));
+}
+
+TEST(TestObcGsTelemetryRecord, ParseHeader) {
+  telemetry_record_block_t block;
+  telemRecordBlockInit(&block);
+  telemetry_data_t point = makeObcState(5, 1);
+  ASSERT_EQ(telemRecordBlockAppend(&block, &point), OBC_GS_ERR_CODE_SUCCESS);
+
+  uint16_t blockLen = 0;
+  ASSERT_EQ(telemRecordBlockFinish(&block, &blockLen), OBC_GS_ERR_CODE_SUCCESS);
+
+  uint16_t payloadLen = 0;
+  ASSERT_EQ(telemRecordParseHeader(block.data, &payloadLen), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(payloadLen, block.payloadLen);
+
+  uint8_t header[TELEM_RECORD_BLOCK_HEADER_SIZE];
+  memcpy(header, block.data, sizeof(header));
+  header[0] ^= 0xFF;
+  EXPECT_EQ(telemRecordParseHeader(header, &payloadLen), OBC_GS_ERR_CODE_INVALID_TELEM_RECORD);
+
+  memcpy(header, block.data, sizeof(header));
+  header[1] = TELEM_RECORD_FORMAT_VERSION + 1;
+  EXPECT_EQ(telemRecordParseHeader(header, &payloadLen), OBC_GS_ERR_CODE_INVALID_TELEM_RECORD);
+
+  // Payload length larger than a block
+  memcpy(header, block.data, sizeof(header));
+  header[3] = 0xFF;
+  EXPECT_EQ(telemRecordParseHeader(header, &payloadLen), OBC_GS_ERR_CODE_INVALID_TELEM_RECORD);
+}
+
+TEST(TestObcGsTelemetryRecord, CorruptedBlocksAreRejected) {
+  telemetry_record_block_t block;
+  telemRecordBlockInit(&block);
+  for (uint32_t i = 0; i < 10; ++i) {
+    telemetry_data_t point = makeObcTemp(i, (float)i);
+    ASSERT_EQ(telemRecordBlockAppend(&block, &point), OBC_GS_ERR_CODE_SUCCESS);
+  }
+
+  telemetry_record_block_t reloaded;
+
+  // Flipped payload bit
+  storeAndReload(&block, &reloaded);
+  reloaded.data[TELEM_RECORD_BLOCK_HEADER_SIZE + 20] ^= 0x10;
+  EXPECT_EQ(telemRecordBlockLoad(&reloaded), OBC_GS_ERR_CODE_INVALID_TELEM_RECORD);
+
+  // Wrong record count
+  storeAndReload(&block, &reloaded);
+  reloaded.data[2]++;
+  EXPECT_EQ(telemRecordBlockLoad(&reloaded), OBC_GS_ERR_CODE_INVALID_TELEM_RECORD);
+}
+
+TEST(TestObcGsTelemetryRecord, InvalidArgs) {
+  telemetry_record_block_t block;
+  telemRecordBlockInit(&block);
+  telemetry_data_t point = makeObcTemp(0, 0.0f);
+  uint16_t length = 0;
+  uint16_t offset = 0;
+  const uint8_t *record = NULL;
+  uint8_t recordLen = 0;
+
+  EXPECT_EQ(telemRecordBlockAppend(NULL, &point), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(telemRecordBlockAppend(&block, NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(telemRecordBlockFinish(NULL, &length), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(telemRecordBlockFinish(&block, NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(telemRecordParseHeader(NULL, &length), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(telemRecordParseHeader(block.data, NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(telemRecordBlockLoad(NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_FALSE(telemRecordBlockNext(NULL, &offset, &record, &recordLen));
+
+  // Telemetry without a pack function is not stored
+  point.id = TELEM_NONE;
+  EXPECT_EQ(telemRecordBlockAppend(&block, &point), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(block.numRecords, 0);
+}
@@ -107,3 +107,43 @@ TEST(TestPackAndUnpack, ValidFloatPackUnpack) {
   EXPECT_EQ(len, sizeof(float));
   EXPECT_EQ(val, unpackedVal);
 }
+
+TEST(TestPackAndUnpack, ValidVarintPackUnpack) {
+  const uint64_t vals[] = {0, 1, 127, 128, 300, UINT32_MAX, UINT64_MAX};
+  const uint32_t sizes[] = {1, 1, 1, 2, 2, 5, VARINT_MAX_SIZE};
+
+  for (uint32_t i = 0; i < sizeof(vals) / sizeof(vals[0]); ++i) {
+    uint8_t buf[VARINT_MAX_SIZE];
+    uint32_t len = 0;
+    packVarUint64(vals[i], buf, &len);
+    EXPECT_EQ(len, sizes[i]);
+
+    uint32_t offset = 0;
+    uint64_t unpackedVal = 0;
+    ASSERT_TRUE(unpackVarUint64(buf, len, &offset, &unpackedVal));
+    EXPECT_EQ(offset, len);
+    EXPECT_EQ(vals[i], unpackedVal);
+
+    // A varint cut off by the end of the buffer is rejected
+    offset = 0;
+    EXPECT_FALSE(unpackVarUint64(buf, len - 1, &offset, &unpackedVal));
+  }
+}
+
+TEST(TestPackAndUnpack, ValidZigzagVarintPackUnpack) {
+  const int64_t vals[] = {0, -1, 1, -64, 63, -65, INT32_MIN, INT64_MIN, INT64_MAX};
+  const uint32_t sizes[] = {1, 1, 1, 1, 1, 2, 5, VARINT_MAX_SIZE, VARINT_MAX_SIZE};
+
+  for (uint32_t i = 0; i < sizeof(vals) / sizeof(vals[0]); ++i) {
+    uint8_t buf[VARINT_MAX_SIZE];
+    uint32_t len = 0;
+    packVarInt64(vals[i], buf, &len);
+    EXPECT_EQ(len, sizes[i]);
+
+    uint32_t offset = 0;
+    int64_t unpackedVal = 0;
+    ASSERT_TRUE(unpackVarInt64(buf, len, &offset, &unpackedVal));
+    EXPECT_EQ(offset, len);
+    EXPECT_EQ(vals[i], unpackedVal);
+  }
+}
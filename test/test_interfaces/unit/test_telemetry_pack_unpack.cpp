@@ -3,8 +3,10 @@
 #include "obc_gs_telemetry_id.h"
 #include "obc_gs_telemetry_data.h"
 #include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
 
 #include <gtest/gtest.h>
+#include <string.h>
 
 TEST(TestTelemetryPackUnpack, ValidTelemObcTempPackUnpack) {
   obc_gs_error_code_t err;
@@ -78,3 +80,199 @@ TEST(TestTelemetryPackUnpack, ValidTelemPongPackUnpack) {
   EXPECT_EQ(data.id, unpackedData.id);
   EXPECT_EQ(data.timestamp, unpackedData.timestamp);
 }
+
+TEST(TestTelemetryPackUnpack, ValidTelemGncTimingPackUnpack) {
+  // A histogram bin fits in the union without widening it
+  EXPECT_LE(sizeof(telem_gnc_hist_bin_t), sizeof(float));
+
+  telemetry_data_t points[3] = {};
+  points[0].id = TELEM_GNC_START_LATENCY_HIST;
+  points[0].gncStartLatencyBin.bin = 3;
+  points[0].gncStartLatencyBin.cycles = 600;
+  points[1].id = TELEM_GNC_EXEC_TIME_HIST;
+  points[1].gncExecTimeBin.bin = TELEM_GNC_HIST_NUM_BINS - 1;
+  points[1].gncExecTimeBin.cycles = 0xFFFF;
+  points[2].id = TELEM_GNC_DEADLINE_MISSES;
+  points[2].gncDeadlineMisses = 0x12345678;
+
+  for (const telemetry_data_t &data : points) {
+    uint8_t buffer[MAX_TELEMETRY_DATA_SIZE] = {0};
+    uint32_t numPacked = 0;
+    ASSERT_EQ(packTelemetry(&data, buffer, MAX_TELEMETRY_DATA_SIZE, &numPacked), OBC_GS_ERR_CODE_SUCCESS);
+
+    telemetry_data_t unpackedData = {};
+    uint32_t numUnpacked = 0;
+    ASSERT_EQ(unpackTelemetry(buffer, &numUnpacked, &unpackedData), OBC_GS_ERR_CODE_SUCCESS);
+
+    EXPECT_EQ(numPacked, numUnpacked);
+    EXPECT_EQ(data.id, unpackedData.id);
+    EXPECT_EQ(memcmp(&data, &unpackedData, sizeof(data)), 0);
+  }
+}
+
+static void compressPoint(telemetry_compressor_t *compressor, const telemetry_data_t &data,
+                          obc_gs_error_code_t expected = OBC_GS_ERR_CODE_SUCCESS) {
+  uint8_t packed[MAX_TELEMETRY_DATA_SIZE] = {0};
+  uint32_t packedLen = 0;
+  ASSERT_EQ(packTelemetry(&data, packed, sizeof(packed), &packedLen), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(telemCompressorAdd(compressor, packed, packedLen), expected);
+}
+
+TEST(TestTelemetryPackUnpack, CompressedPacketPackUnpack) {
+  telemetry_data_t points[6] = {};
+  points[0].id = TELEM_OBC_TEMP;
+  points[0].timestamp = 1700000000;
+  points[0].obcTemp = 21.5f;
+  points[1].id = TELEM_OBC_STATE;
+  points[1].timestamp = 1700000000;
+  points[1].obcState = 3;
+  points[2].id = TELEM_OBC_TEMP;
+  points[2].timestamp = 1700000060;
+  points[2].obcTemp = 21.625f;
+  points[3].id = TELEM_PONG;
+  points[3].timestamp = 1700000030;  // Out of order timestamps give negative deltas
+  points[4].id = TELEM_OBC_TEMP;
+  points[4].timestamp = 1700000120;
+  points[4].obcTemp = 21.625f;
+  points[5].id = TELEM_OBC_TEMP;
+  points[5].timestamp = 1700000180;
+  points[5].obcTemp = -40.0f;
+
+  uint8_t packet[PACKED_TELEM_PACKET_SIZE] = {0};
+  telemetry_compressor_t compressor;
+  ASSERT_EQ(telemCompressorInit(&compressor, packet, sizeof(packet)), OBC_GS_ERR_CODE_SUCCESS);
+
+  uint32_t plainLen = 0;
+  for (const telemetry_data_t &point : points) {
+    compressPoint(&compressor, point);
+    uint8_t packed[MAX_TELEMETRY_DATA_SIZE];
+    uint32_t packedLen = 0;
+    packTelemetry(&point, packed, sizeof(packed), &packedLen);
+    plainLen += packedLen;
+  }
+
+  EXPECT_EQ(packet[0], TELEM_COMPRESSED_PACKET_MARKER);
+  EXPECT_LT(compressor.offset, plainLen);
+
+  telemetry_data_t unpacked[8] = {};
+  uint32_t numUnpacked = 0;
+  ASSERT_EQ(unpackTelemetryPacket(packet, sizeof(packet), unpacked, 8, &numUnpacked), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(numUnpacked, 6);
+
+  for (uint32_t i = 0; i < 6; ++i) {
+    EXPECT_EQ(unpacked[i].id, points[i].id);
+    EXPECT_EQ(unpacked[i].timestamp, points[i].timestamp);
+  }
+  EXPECT_EQ(unpacked[0].obcTemp, 21.5f);
+  EXPECT_EQ(unpacked[1].obcState, 3);
+  EXPECT_EQ(unpacked[2].obcTemp, 21.625f);
+  EXPECT_EQ(unpacked[4].obcTemp, 21.625f);
+  EXPECT_EQ(unpacked[5].obcTemp, -40.0f);
+}
+
+TEST(TestTelemetryPackUnpack, CompressedPacketFillsUp) {
+  uint8_t packet[PACKED_TELEM_PACKET_SIZE] = {0};
+  telemetry_compressor_t compressor;
+  telemCompressorInit(&compressor, packet, sizeof(packet));
+
+  telemetry_data_t point = {};
+  point.id = TELEM_OBC_TEMP;
+  point.timestamp = 1700000000;
+  point.obcTemp = 20.0f;
+
+  uint32_t numAdded = 0;
+  uint8_t packed[MAX_TELEMETRY_DATA_SIZE];
+  uint32_t packedLen = 0;
+  while (true) {
+    packTelemetry(&point, packed, sizeof(packed), &packedLen);
+    uint32_t offsetBefore = compressor.offset;
+    obc_gs_error_code_t err = telemCompressorAdd(&compressor, packed, packedLen);
+    if (err == OBC_GS_ERR_CODE_BUFF_TOO_SMALL) {
+      EXPECT_EQ(compressor.offset, offsetBefore);
+      break;
+    }
+    ASSERT_EQ(err, OBC_GS_ERR_CODE_SUCCESS);
+    numAdded++;
+    point.timestamp += 60;
+    point.obcTemp += (numAdded % 2) ? 0.125f : -0.25f;
+  }
+
+  // Plain packets fit 223 / 9 = 24 temperatures
+  EXPECT_GT(numAdded, 2 * (PACKED_TELEM_PACKET_SIZE / packedLen));
+
+  telemetry_data_t unpacked[PACKED_TELEM_PACKET_SIZE];
+  uint32_t numUnpacked = 0;
+  ASSERT_EQ(unpackTelemetryPacket(packet, sizeof(packet), unpacked, PACKED_TELEM_PACKET_SIZE, &numUnpacked),
+            OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(numUnpacked, numAdded);
+  EXPECT_EQ(unpacked[numAdded - 1].timestamp, 1700000000 + 60 * (numAdded - 1));
+}
+
+TEST(TestTelemetryPackUnpack, PlainPacketUnpack) {
+  telemetry_data_t points[3] = {};
+  points[0].id = TELEM_OBC_TEMP;
+  points[0].timestamp = 0x12345678;
+  points[0].obcTemp = 102.310f;
+  points[1].id = TELEM_PONG;
+  points[1].timestamp = 0x12345679;
+  points[2].id = TELEM_OBC_STATE;
+  points[2].timestamp = 0x1234567A;
+  points[2].obcState = 0x12;
+
+  // End the packet right after the last item so the unpacker has to stop at the buffer end
+  uint8_t packet[PACKED_TELEM_PACKET_SIZE] = {0};
+  uint32_t offset = 0;
+  for (const telemetry_data_t &point : points) {
+    uint8_t packed[MAX_TELEMETRY_DATA_SIZE];
+    uint32_t packedLen = 0;
+    packTelemetry(&point, packed, sizeof(packed), &packedLen);
+    memcpy(&packet[offset], packed, packedLen);
+    offset += packedLen;
+  }
+
+  telemetry_data_t unpacked[4] = {};
+  uint32_t numUnpacked = 0;
+  ASSERT_EQ(unpackTelemetryPacket(packet, offset, unpacked, 4, &numUnpacked), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(numUnpacked, 3);
+  EXPECT_EQ(unpacked[0].obcTemp, 102.310f);
+  EXPECT_EQ(unpacked[1].id, TELEM_PONG);
+  EXPECT_EQ(unpacked[2].obcState, 0x12);
+  EXPECT_EQ(unpacked[2].timestamp, 0x1234567A);
+
+  // A truncated last item and a full output array are reported
+  EXPECT_EQ(unpackTelemetryPacket(packet, offset - 1, unpacked, 4, &numUnpacked), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(unpackTelemetryPacket(packet, offset, unpacked, 2, &numUnpacked), OBC_GS_ERR_CODE_BUFF_TOO_SMALL);
+}
+
+TEST(TestTelemetryPackUnpack, CompressedPacketMalformed) {
+  uint8_t packet[PACKED_TELEM_PACKET_SIZE] = {0};
+  telemetry_compressor_t compressor;
+  telemCompressorInit(&compressor, packet, sizeof(packet));
+
+  telemetry_data_t point = {};
+  point.id = TELEM_OBC_TEMP;
+  point.timestamp = 1700000000;
+  point.obcTemp = 20.0f;
+  compressPoint(&compressor, point);
+
+  telemetry_data_t unpacked[4] = {};
+  uint32_t numUnpacked = 0;
+
+  // Cut off inside the value varint
+  EXPECT_EQ(unpackTelemetryPacket(packet, compressor.offset - 1, unpacked, 4, &numUnpacked),
+            OBC_GS_ERR_CODE_INVALID_ARG);
+
+  // Cut off inside the header
+  EXPECT_EQ(unpackTelemetryPacket(packet, 3, unpacked, 4, &numUnpacked), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  // Unknown telemetry ID
+  packet[TELEM_COMPRESSED_HEADER_SIZE] = NUM_TELEMETRY_DATA_IDS;
+  EXPECT_EQ(unpackTelemetryPacket(packet, sizeof(packet), unpacked, 4, &numUnpacked), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  // Points the compressor cannot take
+  uint8_t packed[MAX_TELEMETRY_DATA_SIZE] = {0};
+  EXPECT_EQ(telemCompressorAdd(&compressor, packed, 3), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(telemCompressorAdd(&compressor, packed, 5), OBC_GS_ERR_CODE_INVALID_ARG);  // TELEM_NONE
+  EXPECT_EQ(telemCompressorAdd(NULL, packed, 5), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(unpackTelemetryPacket(NULL, 0, unpacked, 4, &numUnpacked), OBC_GS_ERR_CODE_INVALID_ARG);
+}
@@ -0,0 +1,157 @@
+/*
+ * Cost of preloading time-tagged commands into the alarm handler and draining them as they come due:
+ *   sorted - the original alarm queue, an array kept sorted by shifting whole alarms on every insert and pop
+ *   heap   - alarmQueuePush/alarmQueuePop, a min-heap of small nodes over a pool of alarm slots
+ * Commands are uplinked in random time order, as a pass's worth of time tags usually is not sorted. Persistence is
+ * off so only the queue itself is timed.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_obc/benchmark/alarm-queue-benchmark
+ */
+#include "alarm_queue.h"
+#include "alarm_handler.h"
+#include "obc_errors.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define MAX_QUEUED_ALARMS 8192U
+
+typedef struct {
+  alarm_handler_alarm_info_t *alarms;
+  uint32_t numAlarms;
+  uint64_t alarmCopies;
+} sorted_queue_t;
+
+static uint32_t seed = 0x1337;
+
+static uint32_t nextPseudorandom(void) {
+  // Pseudorandom generation using a simple algorithm
+  seed = (seed * 1103515245 + 12345) % (1U << 31);
+  return seed >> 16;
+}
+
+static double secondsNow(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void fail(const char *reason) {
+  printf("FAILED: %s\n", reason);
+  exit(1);
+}
+
+// Same algorithm as the original enqueueAlarm
+static void sortedPush(sorted_queue_t *queue, const alarm_handler_alarm_info_t *alarm) {
+  uint32_t i = 0;
+  while (i < queue->numAlarms && queue->alarms[i].unixTime < alarm->unixTime) {
+    i++;
+  }
+  for (uint32_t j = queue->numAlarms; j > i; j--) {
+    queue->alarms[j] = queue->alarms[j - 1];
+  }
+  queue->alarms[i] = *alarm;
+  queue->alarmCopies += queue->numAlarms - i + 1;
+  queue->numAlarms++;
+}
+
+// Same algorithm as the original dequeueAlarm
+static void sortedPop(sorted_queue_t *queue, alarm_handler_alarm_info_t *alarm) {
+  *alarm = queue->alarms[0];
+  for (uint32_t j = 0; j + 1 < queue->numAlarms; j++) {
+    queue->alarms[j] = queue->alarms[j + 1];
+  }
+  queue->alarmCopies += queue->numAlarms;
+  queue->numAlarms--;
+}
+
+static void generateAlarms(alarm_handler_alarm_info_t *alarms, uint32_t numAlarms) {
+  for (uint32_t i = 0; i < numAlarms; ++i) {
+    // Spread over a week out of contact
+    alarms[i] = (alarm_handler_alarm_info_t){.unixTime = 1700000000U + (nextPseudorandom() << 4) % 604800U,
+                                             .type = ALARM_TYPE_TIME_TAGGED_CMD};
+    alarms[i].cmdMsg.id = CMD_PING;
+    alarms[i].cmdMsg.isTimeTagged = true;
+    alarms[i].cmdMsg.timestamp = alarms[i].unixTime;
+  }
+}
+
+static double runSorted(const alarm_handler_alarm_info_t *alarms, uint32_t numAlarms, uint64_t *alarmCopies) {
+  static alarm_handler_alarm_info_t storage[MAX_QUEUED_ALARMS];
+  sorted_queue_t queue = {.alarms = storage};
+
+  double start = secondsNow();
+  for (uint32_t i = 0; i < numAlarms; ++i) {
+    sortedPush(&queue, &alarms[i]);
+  }
+  uint32_t lastTime = 0;
+  for (uint32_t i = 0; i < numAlarms; ++i) {
+    alarm_handler_alarm_info_t alarm;
+    sortedPop(&queue, &alarm);
+    if (alarm.unixTime < lastTime) {
+      fail("sorted queue out of order");
+    }
+    lastTime = alarm.unixTime;
+  }
+  double seconds = secondsNow() - start;
+
+  *alarmCopies = queue.alarmCopies;
+  return seconds;
+}
+
+static double runHeap(const alarm_handler_alarm_info_t *alarms, uint32_t numAlarms, uint64_t *alarmCopies) {
+  static alarm_handler_alarm_info_t slots[MAX_QUEUED_ALARMS];
+  static alarm_queue_node_t heap[MAX_QUEUED_ALARMS];
+  static uint16_t freeSlots[MAX_QUEUED_ALARMS];
+  alarm_queue_t queue;
+  if (alarmQueueInit(&queue, slots, heap, freeSlots, (uint16_t)numAlarms, false) != OBC_ERR_CODE_SUCCESS) {
+    fail("heap init");
+  }
+
+  double start = secondsNow();
+  for (uint32_t i = 0; i < numAlarms; ++i) {
+    bool isEarliest = false;
+    if (alarmQueuePush(&queue, &alarms[i], &isEarliest) != OBC_ERR_CODE_SUCCESS) {
+      fail("heap push");
+    }
+  }
+  uint32_t lastTime = 0;
+  for (uint32_t i = 0; i < numAlarms; ++i) {
+    alarm_handler_alarm_info_t alarm;
+    if (alarmQueuePop(&queue, &alarm) != OBC_ERR_CODE_SUCCESS || alarm.unixTime < lastTime) {
+      fail("heap queue out of order");
+    }
+    lastTime = alarm.unixTime;
+  }
+  double seconds = secondsNow() - start;
+
+  // One copy into a slot per push and one out of it per pop
+  *alarmCopies = 2ULL * numAlarms;
+  return seconds;
+}
+
+int main(void) {
+  static const uint32_t QUEUE_SIZES[] = {24, 256, 1024, 4096, MAX_QUEUED_ALARMS};
+  static alarm_handler_alarm_info_t alarms[MAX_QUEUED_ALARMS];
+
+  printf("[ ALARM QUEUE ] %u byte alarms, preload N in random order then drain\n",
+         (unsigned)sizeof(alarm_handler_alarm_info_t));
+  for (uint32_t i = 0; i < sizeof(QUEUE_SIZES) / sizeof(QUEUE_SIZES[0]); ++i) {
+    uint32_t numAlarms = QUEUE_SIZES[i];
+    generateAlarms(alarms, numAlarms);
+
+    uint64_t sortedCopies = 0;
+    uint64_t heapCopies = 0;
+    double sortedSeconds = runSorted(alarms, numAlarms, &sortedCopies);
+    double heapSeconds = runHeap(alarms, numAlarms, &heapCopies);
+
+    printf("[ ALARM QUEUE ] N=%5u sorted %9.1f ns/alarm %10llu copies | heap %6.1f ns/alarm %6llu copies | %6.1fx\n",
+           (unsigned)numAlarms, sortedSeconds * 1e9 / numAlarms, (unsigned long long)sortedCopies,
+           heapSeconds * 1e9 / numAlarms, (unsigned long long)heapCopies, sortedSeconds / heapSeconds);
+  }
+
+  return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * Host time of one step of each GNC model as the GNC manager runs it (inputs set, model stepped, outputs read):
+ *   rtOnboardModelStep, rtAttitudeDeterminationModelStep and rtAttitudeControlModelStep
+ * reported as the mean over a batch of back to back steps and the slowest of individually timed steps.
+ *
+ * Two binaries are built from the same file: gnc-model-benchmark runs the single-precision models the flight build
+ * uses, gnc-model-benchmark-double the double-precision reference models. The host does both precisions in hardware,
+ * so the gap here understates the one on the RM46, where the firmware is built soft-float and each double operation is
+ * a longer library call than the single one.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_obc/benchmark/gnc-model-benchmark and
+ * ./test/test_obc/benchmark/gnc-model-benchmark-double
+ */
+#include "gnc_models.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/*
+ * The placeholder inputs the GNC manager sets drive the attitude filter to NaN after about 35 steps, and the host is
+ * far slower at NaN arithmetic, so the models are restarted between runs of RUN_STEPS steps, outside the timing.
+ */
+#define RUN_STEPS 20U
+#define BATCH_RUNS 10000U
+#define TIMED_RUNS 1000U
+
+static double elapsedNs(const struct timespec *start, const struct timespec *end) {
+  return (double)(end->tv_sec - start->tv_sec) * 1e9 + (double)(end->tv_nsec - start->tv_nsec);
+}
+
+static void runStep(const char *name, void (*step)(void)) {
+  struct timespec start;
+  struct timespec end;
+
+  double totalNs = 0.0;
+  for (uint32_t run = 0; run < BATCH_RUNS; run++) {
+    gncModelsInitialize();
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < RUN_STEPS; i++) {
+      step();
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    totalNs += elapsedNs(&start, &end);
+  }
+  double meanNs = totalNs / ((double)BATCH_RUNS * RUN_STEPS);
+
+  // Includes the overhead of reading the clock around each step
+  double maxNs = 0.0;
+  for (uint32_t run = 0; run < TIMED_RUNS; run++) {
+    gncModelsInitialize();
+
+    for (uint32_t i = 0; i < RUN_STEPS; i++) {
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      step();
+      clock_gettime(CLOCK_MONOTONIC, &end);
+
+      double ns = elapsedNs(&start, &end);
+      if (ns > maxNs) {
+        maxNs = ns;
+      }
+    }
+  }
+
+  printf("%-34s %10.1f %10.1f\n", name, meanNs, maxNs);
+}
+
+int main(void) {
+  printf("GNC models, %s precision, host\n", GNC_SINGLE_PRECISION == 1 ? "single" : "double");
+  printf("%-34s %10s %10s\n", "step", "mean ns", "max ns");
+
+  runStep("rtOnboardModelStep", rtOnboardModelStep);
+  runStep("rtAttitudeDeterminationModelStep", rtAttitudeDeterminationModelStep);
+  runStep("rtAttitudeControlModelStep", rtAttitudeControlModelStep);
+
+  return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * Cost of a log call on the producer side on the POSIX FreeRTOS port:
+ *   queue - xQueueSend of the logger event into a 10 deep queue (the original logger)
+ *   ring  - mpscRingPush of the event, plus the message text for message logs, into the lock-free log ring
+ * Logs are sent in bursts of 10 and drained between bursts so the queue never fills; only the sends are timed.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_obc/benchmark/log-ring-benchmark
+ */
+#include "obc_mpsc_ring.h"
+#include "obc_errors.h"
+
+#include <FreeRTOS.h>
+#include <os_queue.h>
+#include <os_task.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCHMARK_BURSTS 200000U
+#define BENCHMARK_BURST_LEN 10U
+#define BENCHMARK_RING_SIZE 4096U
+#define BENCHMARK_MAX_MSG_SIZE 128U
+#define BENCHMARK_TASK_STACK_SIZE 4096U
+
+// Same layout as logger_event_t with a date time timestamp
+typedef struct {
+  uint32_t logEntry;
+  const char *file;
+  uint32_t line;
+  uint8_t timestamp[8];
+  union {
+    uint32_t errCode;
+    const char *msg;
+  };
+} bench_event_t;
+
+typedef struct {
+  bench_event_t event;
+  char msg[BENCHMARK_MAX_MSG_SIZE];
+} bench_ring_entry_t;
+
+static QueueHandle_t eventQueue;
+static StaticQueue_t eventQueueBuffer;
+static uint8_t eventQueueStorage[BENCHMARK_BURST_LEN * sizeof(bench_event_t)];
+
+static obc_mpsc_ring_t ring;
+static uint32_t ringBuffer[BENCHMARK_RING_SIZE / sizeof(uint32_t)];
+
+static StackType_t benchmarkTaskStack[BENCHMARK_TASK_STACK_SIZE];
+static StaticTask_t benchmarkTaskBuffer;
+
+static const char *MSG = "Reached end of telemetry file";
+
+static double secondsNow(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void fail(const char *reason) {
+  printf("FAILED: %s\n", reason);
+  exit(1);
+}
+
+static bench_event_t makeEvent(uint32_t i) {
+  bench_event_t event = {.logEntry = (i % 4 == 0) ? 1U : 0U,
+                         .file = "obc/app/modules/comms_link_mgr/comms_manager.c",
+                         .line = 100 + i % 50};
+  if (event.logEntry == 1U) {
+    event.msg = MSG;
+  } else {
+    event.errCode = 500 + i % 10;
+  }
+  return event;
+}
+
+static double runQueue(void) {
+  double sendSeconds = 0;
+  for (uint32_t burst = 0; burst < BENCHMARK_BURSTS; ++burst) {
+    double start = secondsNow();
+    for (uint32_t i = 0; i < BENCHMARK_BURST_LEN; ++i) {
+      bench_event_t event = makeEvent(i);
+      if (xQueueSend(eventQueue, &event, 0) != pdPASS) {
+        fail("queue send");
+      }
+    }
+    sendSeconds += secondsNow() - start;
+
+    bench_event_t event;
+    while (xQueueReceive(eventQueue, &event, 0) == pdPASS) {
+    }
+  }
+  return sendSeconds;
+}
+
+static double runRing(void) {
+  double sendSeconds = 0;
+  uint32_t popped = 0;
+  for (uint32_t burst = 0; burst < BENCHMARK_BURSTS; ++burst) {
+    double start = secondsNow();
+    for (uint32_t i = 0; i < BENCHMARK_BURST_LEN; ++i) {
+      bench_event_t event = makeEvent(i);
+      obc_error_code_t errCode =
+          (event.logEntry == 1U)
+              ? mpscRingPush(&ring, &event, sizeof(event), event.msg, strnlen(event.msg, BENCHMARK_MAX_MSG_SIZE - 1))
+              : mpscRingPush(&ring, &event, sizeof(event), NULL, 0);
+      if (errCode != OBC_ERR_CODE_SUCCESS) {
+        fail("ring push");
+      }
+    }
+    sendSeconds += secondsNow() - start;
+
+    bench_ring_entry_t entry;
+    uint32_t entryLen = 0;
+    while (mpscRingPop(&ring, &entry, sizeof(entry), &entryLen) == OBC_ERR_CODE_SUCCESS) {
+      popped++;
+    }
+  }
+
+  if (popped != BENCHMARK_BURSTS * BENCHMARK_BURST_LEN || mpscRingDropped(&ring) != 0) {
+    fail("ring lost logs");
+  }
+  return sendSeconds;
+}
+
+static void benchmarkTask(void *pvParameters) {
+  (void)pvParameters;
+  const double numLogs = (double)BENCHMARK_BURSTS * BENCHMARK_BURST_LEN;
+
+  double queueSeconds = runQueue();
+  double ringSeconds = runRing();
+
+  printf("[ LOG RING ] %u logs, a quarter of them messages\n", (unsigned)(BENCHMARK_BURSTS * BENCHMARK_BURST_LEN));
+  printf("[ LOG RING ] queue %7.1f ns/log\n", queueSeconds * 1e9 / numLogs);
+  printf("[ LOG RING ] ring  %7.1f ns/log, high-water %u of %u bytes\n", ringSeconds * 1e9 / numLogs,
+         (unsigned)mpscRingHighWater(&ring), (unsigned)BENCHMARK_RING_SIZE);
+  printf("[ LOG RING ] ring logs are %.1fx cheaper for the caller\n", queueSeconds / ringSeconds);
+
+  exit(0);
+}
+
+int main(void) {
+  eventQueue = xQueueCreateStatic(BENCHMARK_BURST_LEN, sizeof(bench_event_t), eventQueueStorage, &eventQueueBuffer);
+  if (mpscRingInit(&ring, (uint8_t *)ringBuffer, BENCHMARK_RING_SIZE) != OBC_ERR_CODE_SUCCESS) {
+    fail("ring init");
+  }
+
+  xTaskCreateStatic(benchmarkTask, "benchmark", BENCHMARK_TASK_STACK_SIZE, NULL, 1, benchmarkTaskStack,
+                    &benchmarkTaskBuffer);
+  vTaskStartScheduler();
+
+  return 1;
+}
@@ -0,0 +1,228 @@
+/*
+ * Log entries per second and file system calls of the two SD card log paths of the logger task:
+ *   text   - two snprintf calls per entry, then open, append and close the log file (a Reliance Edge transaction per
+ *            entry since closing a file commits one)
+ *   binary - a 16B record per entry in a RAM ring, written to a file kept open one 512B block at a time and synced
+ *            every 8 blocks
+ * POSIX file calls stand in for Reliance Edge, so the times are host times; the call counts carry over to the OBC.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_obc/benchmark/logger-benchmark
+ */
+#include "log_record.h"
+#include "obc_byte_ring.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define NUM_ENTRIES 100000U
+
+// Same sizes as the logger task
+#define MAX_FNAME_LINENUM_SIZE 150U
+#define MAX_LOG_SIZE (128U + MAX_FNAME_LINENUM_SIZE + 10U)
+#define LOG_FLUSH_BLOCK_SIZE 512U
+#define LOG_RING_SIZE (4U * LOG_FLUSH_BLOCK_SIZE)
+#define LOG_SYNC_BLOCK_COUNT 8U
+
+typedef struct {
+  uint8_t logType;
+  uint8_t logLevel;
+  const char *file;
+  uint32_t line;
+  uint32_t errCode;
+  const char *msg;
+  uint32_t timestamp;
+} bench_entry_t;
+
+typedef struct {
+  uint32_t opens;
+  uint32_t writes;
+  uint32_t closes;
+  uint32_t transactions;
+  uint64_t bytes;
+} fs_calls_t;
+
+static const char *FILES[] = {
+    "obc/app/modules/comms_link_mgr/comms_manager.c", "obc/app/modules/telemetry_mgr/telemetry_manager.c",
+    "obc/app/modules/health_collector/health_collector.c", "obc/app/drivers/cc1120/cc1120.c",
+    "obc/app/sys/obc_sci_io.c"};
+static const char *MSGS[] = {"Sending telemetry file", "Reached end of telemetry file", "Executing OBC reset command"};
+static const char *LEVEL_STRINGS[] = {"TRACE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL"};
+
+static uint32_t seed = 0x106;
+
+static uint32_t nextPseudorandom(void) {
+  // Pseudorandom generation using a simple algorithm
+  seed = (seed * 1103515245 + 12345) % (1U << 31);
+  return seed >> 16;
+}
+
+static double secondsNow(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void fail(const char *reason) {
+  printf("FAILED: %s\n", reason);
+  exit(1);
+}
+
+static void generateEntries(bench_entry_t *entries) {
+  for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+    bool isMsg = nextPseudorandom() % 10 < 3;
+    entries[i] = (bench_entry_t){.logType = isMsg ? LOG_TYPE_MSG : LOG_TYPE_ERROR_CODE,
+                                 .logLevel = isMsg ? LOG_INFO : LOG_ERROR,
+                                 .file = FILES[nextPseudorandom() % (sizeof(FILES) / sizeof(FILES[0]))],
+                                 .line = 20 + nextPseudorandom() % 500,
+                                 .errCode = 100 + nextPseudorandom() % 600,
+                                 .msg = MSGS[nextPseudorandom() % (sizeof(MSGS) / sizeof(MSGS[0]))],
+                                 .timestamp = 1700000000 + i};
+  }
+}
+
+static void logText(const char *path, const bench_entry_t *entry, fs_calls_t *calls) {
+  char infobuf[MAX_FNAME_LINENUM_SIZE];
+  char logBuf[MAX_LOG_SIZE];
+
+  snprintf(infobuf, sizeof(infobuf), "%u %-5s -> %s:%u", (unsigned)entry->timestamp, LEVEL_STRINGS[entry->logLevel],
+           entry->file, (unsigned)entry->line);
+  int logBufLen = entry->logType == LOG_TYPE_ERROR_CODE
+                      ? snprintf(logBuf, sizeof(logBuf), "%s - %u\r\n", infobuf, (unsigned)entry->errCode)
+                      : snprintf(logBuf, sizeof(logBuf), "%s - %s\r\n", infobuf, entry->msg);
+
+  int fd = open(path, O_WRONLY | O_APPEND | O_CREAT, 0600);
+  if (fd < 0 || write(fd, logBuf, (size_t)logBufLen) != logBufLen) {
+    fail("text write");
+  }
+  close(fd);
+
+  calls->opens++;
+  calls->writes++;
+  calls->closes++;
+  calls->transactions++;
+  calls->bytes += (uint64_t)logBufLen;
+}
+
+static void flushRing(int fd, obc_byte_ring_t *ring, bool flushAll, uint32_t *blocksSinceSync, fs_calls_t *calls) {
+  uint32_t minFlushSize = flushAll ? 1U : LOG_FLUSH_BLOCK_SIZE;
+  while (byteRingBytesUsed(ring) >= minFlushSize) {
+    const uint8_t *data = NULL;
+    uint32_t len = byteRingPeekContiguous(ring, &data);
+    if (len > LOG_FLUSH_BLOCK_SIZE) {
+      len = LOG_FLUSH_BLOCK_SIZE;
+    }
+    if (write(fd, data, len) != (ssize_t)len) {
+      fail("binary write");
+    }
+    byteRingConsume(ring, len);
+    calls->writes++;
+    calls->bytes += len;
+    (*blocksSinceSync)++;
+  }
+
+  if (flushAll || *blocksSinceSync >= LOG_SYNC_BLOCK_COUNT) {
+    // A sync on the OBC; not run here so the host disk does not dominate the time
+    calls->transactions++;
+    *blocksSinceSync = 0;
+  }
+}
+
+static void logBinary(int fd, obc_byte_ring_t *ring, const bench_entry_t *entry, uint32_t *blocksSinceSync,
+                      fs_calls_t *calls) {
+  log_record_t record = {.logType = entry->logType,
+                         .logLevel = entry->logLevel,
+                         .line = (uint16_t)entry->line,
+                         .fileId = logHashString(entry->file),
+                         .arg = entry->logType == LOG_TYPE_ERROR_CODE ? entry->errCode : logHashString(entry->msg),
+                         .timestamp = entry->timestamp};
+
+  uint8_t packed[LOG_RECORD_SIZE];
+  if (logRecordPack(&record, packed) != OBC_ERR_CODE_SUCCESS ||
+      byteRingWrite(ring, packed, LOG_RECORD_SIZE) != LOG_RECORD_SIZE) {
+    fail("record");
+  }
+
+  if (byteRingBytesUsed(ring) >= LOG_FLUSH_BLOCK_SIZE) {
+    flushRing(fd, ring, false, blocksSinceSync, calls);
+  }
+}
+
+static int createTempFile(char *path) {
+  int fd = mkstemp(path);
+  if (fd < 0) {
+    fail("could not create a temporary file");
+  }
+  return fd;
+}
+
+static void report(const char *name, double seconds, const fs_calls_t *calls) {
+  printf("[ LOGGER ] %-6s %8.0f entries/s, %6u opens, %6u writes, %6u closes, %6u transactions, %8llu B\n", name,
+         NUM_ENTRIES / seconds, (unsigned)calls->opens, (unsigned)calls->writes, (unsigned)calls->closes,
+         (unsigned)calls->transactions, (unsigned long long)calls->bytes);
+}
+
+int main(void) {
+  bench_entry_t *entries = malloc(NUM_ENTRIES * sizeof(bench_entry_t));
+  if (entries == NULL) {
+    fail("out of memory");
+  }
+  generateEntries(entries);
+
+  char textPath[] = "/tmp/logger_textXXXXXX";
+  close(createTempFile(textPath));
+  fs_calls_t textCalls = {0};
+  double start = secondsNow();
+  for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+    logText(textPath, &entries[i], &textCalls);
+  }
+  double textSeconds = secondsNow() - start;
+
+  char binaryPath[] = "/tmp/logger_binaryXXXXXX";
+  int binaryFd = createTempFile(binaryPath);
+  static uint8_t ringBuffer[LOG_RING_SIZE];
+  obc_byte_ring_t ring;
+  byteRingInit(&ring, ringBuffer, LOG_RING_SIZE);
+  uint32_t blocksSinceSync = 0;
+  fs_calls_t binaryCalls = {.opens = 1, .closes = 1};
+  start = secondsNow();
+  for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+    logBinary(binaryFd, &ring, &entries[i], &blocksSinceSync, &binaryCalls);
+  }
+  flushRing(binaryFd, &ring, true, &blocksSinceSync, &binaryCalls);
+  double binarySeconds = secondsNow() - start;
+
+  // Every record must be in the file and decode back to its entry
+  if (lseek(binaryFd, 0, SEEK_END) != (off_t)NUM_ENTRIES * LOG_RECORD_SIZE) {
+    fail("binary log size");
+  }
+  lseek(binaryFd, 0, SEEK_SET);
+  for (uint32_t i = 0; i < NUM_ENTRIES; ++i) {
+    uint8_t packed[LOG_RECORD_SIZE];
+    log_record_t record;
+    if (read(binaryFd, packed, sizeof(packed)) != (ssize_t)sizeof(packed) ||
+        logRecordUnpack(packed, &record) != OBC_ERR_CODE_SUCCESS || record.line != entries[i].line ||
+        record.fileId != logHashString(entries[i].file) || record.timestamp != entries[i].timestamp) {
+      fail("binary records differ");
+    }
+  }
+
+  printf("[ LOGGER ] %u entries\n", (unsigned)NUM_ENTRIES);
+  report("text", textSeconds, &textCalls);
+  report("binary", binarySeconds, &binaryCalls);
+  printf("[ LOGGER ] binary logs %.1fx more entries/s with %.0fx fewer writes and %.0fx fewer transactions\n",
+         textSeconds / binarySeconds, (double)textCalls.writes / binaryCalls.writes,
+         (double)textCalls.transactions / binaryCalls.transactions);
+
+  close(binaryFd);
+  unlink(textPath);
+  unlink(binaryPath);
+  free(entries);
+  return 0;
+}
@@ -0,0 +1,91 @@
+/** @file
+    @brief Host block device backed by a temporary file, which counts the calls
+           made to it.
+*/
+#include "file_bdev.h"
+
+#include <redfs.h>
+#include <redvolume.h>
+#include <redbdev.h>
+
+#include <stdio.h>
+
+static FILE *gapDisk[REDCONF_VOLUME_COUNT];
+static file_bdev_stats_t stats;
+
+const file_bdev_stats_t *fileBdevStats(void) { return &stats; }
+
+void fileBdevResetStats(void) { stats = (file_bdev_stats_t){0}; }
+
+REDSTATUS RedOsBDevConfig(uint8_t bVolNum, REDBDEVCTX context) {
+  (void)context;
+  return (bVolNum >= REDCONF_VOLUME_COUNT) ? -RED_EINVAL : 0;
+}
+
+REDSTATUS RedOsBDevOpen(uint8_t bVolNum, BDEVOPENMODE mode) {
+  (void)mode;
+
+  if (bVolNum >= REDCONF_VOLUME_COUNT) {
+    return -RED_EINVAL;
+  }
+
+  // The disk outlives a close so that a volume can be formatted, then mounted
+  if (gapDisk[bVolNum] == NULL) {
+    gapDisk[bVolNum] = tmpfile();
+  }
+
+  return (gapDisk[bVolNum] == NULL) ? -RED_EIO : 0;
+}
+
+REDSTATUS RedOsBDevClose(uint8_t bVolNum) { return (bVolNum >= REDCONF_VOLUME_COUNT) ? -RED_EINVAL : 0; }
+
+REDSTATUS RedOsBDevGetGeometry(uint8_t bVolNum, BDEVINFO *pInfo) {
+  if ((bVolNum >= REDCONF_VOLUME_COUNT) || (pInfo == NULL)) {
+    return -RED_EINVAL;
+  }
+
+  pInfo->ulSectorSize = gaRedVolConf[bVolNum].ulSectorSize;
+  pInfo->ullSectorCount = gaRedVolConf[bVolNum].ullSectorCount;
+  return 0;
+}
+
+REDSTATUS RedOsBDevRead(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount, void *pBuffer) {
+  uint32_t ulSectorSize = gaRedVolConf[bVolNum].ulSectorSize;
+  FILE *pDisk = gapDisk[bVolNum];
+
+  stats.reads++;
+  stats.sectorsRead += ulSectorCount;
+
+  if (fseek(pDisk, (long)(ullSectorStart * ulSectorSize), SEEK_SET) != 0) {
+    return -RED_EIO;
+  }
+
+  // Sectors past the end of the file have never been written; they read back as zeros
+  size_t bytesRead = fread(pBuffer, 1, (size_t)ulSectorCount * ulSectorSize, pDisk);
+  RedMemSet((uint8_t *)pBuffer + bytesRead, 0U, (uint32_t)(((size_t)ulSectorCount * ulSectorSize) - bytesRead));
+  clearerr(pDisk);
+  return 0;
+}
+
+REDSTATUS RedOsBDevWrite(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount, const void *pBuffer) {
+  uint32_t ulSectorSize = gaRedVolConf[bVolNum].ulSectorSize;
+  FILE *pDisk = gapDisk[bVolNum];
+
+  stats.writes++;
+  stats.sectorsWritten += ulSectorCount;
+
+  if (fseek(pDisk, (long)(ullSectorStart * ulSectorSize), SEEK_SET) != 0) {
+    return -RED_EIO;
+  }
+
+  if (fwrite(pBuffer, ulSectorSize, ulSectorCount, pDisk) != ulSectorCount) {
+    return -RED_EIO;
+  }
+
+  return 0;
+}
+
+REDSTATUS RedOsBDevFlush(uint8_t bVolNum) {
+  stats.flushes++;
+  return (fflush(gapDisk[bVolNum]) == 0) ? 0 : -RED_EIO;
+}
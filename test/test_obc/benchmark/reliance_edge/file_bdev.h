@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Block device calls made by the file system, counted by the file-backed block device
+ */
+typedef struct {
+  uint32_t reads;
+  uint32_t sectorsRead;
+  uint32_t writes;
+  uint32_t sectorsWritten;
+  uint32_t flushes;
+} file_bdev_stats_t;
+
+/**
+ * @brief Get the counts since the last reset
+ *
+ * @return const file_bdev_stats_t* Counts for the volume
+ */
+const file_bdev_stats_t *fileBdevStats(void);
+
+/**
+ * @brief Reset the counts to zero
+ */
+void fileBdevResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,44 @@
+/** @file
+    @brief Single-threaded host implementations of the Reliance Edge OS
+           services other than the block device.
+*/
+#include <redfs.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+REDSTATUS RedOsMutexInit(void) { return 0; }
+
+REDSTATUS RedOsMutexUninit(void) { return 0; }
+
+void RedOsMutexAcquire(void) {}
+
+void RedOsMutexRelease(void) {}
+
+uint32_t RedOsTaskId(void) { return 1U; }
+
+REDSTATUS RedOsClockInit(void) { return 0; }
+
+REDSTATUS RedOsClockUninit(void) { return 0; }
+
+uint32_t RedOsClockGetTime(void) { return (uint32_t)time(NULL); }
+
+REDSTATUS RedOsTimestampInit(void) { return 0; }
+
+REDSTATUS RedOsTimestampUninit(void) { return 0; }
+
+REDTIMESTAMP RedOsTimestamp(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (REDTIMESTAMP)((uint64_t)now.tv_sec * 1000000U + (uint64_t)now.tv_nsec / 1000U);
+}
+
+uint64_t RedOsTimePassed(REDTIMESTAMP tsSince) { return (uint32_t)(RedOsTimestamp() - tsSince); }
+
+void RedOsOutputString(const char *pszString) { fputs(pszString, stdout); }
+
+void RedOsAssertFail(const char *pszFileName, uint32_t ulLineNum) {
+  fprintf(stderr, "Reliance Edge assert failed at %s:%u\n", pszFileName, (unsigned)ulLineNum);
+  abort();
+}
@@ -0,0 +1,12 @@
+/*  Volume configuration for the host file system benchmark.  The volume is
+    larger than the flight one, so that the workloads do not run out of space,
+    but still small enough for the inline imap.
+*/
+/** @file
+ */
+#include <redconf.h>
+#include <redtypes.h>
+#include <redmacs.h>
+#include <redvolume.h>
+
+const VOLCONF gaRedVolConf[REDCONF_VOLUME_COUNT] = {{512U, 3584U, 0U, false, 256U, 0U, ""}};
@@ -0,0 +1,136 @@
+/*  Reliance Edge configuration for the host file system benchmark.
+
+    This mirrors obc/app/reliance_edge/projects/freertos_rm46/host/redconf.h,
+    except that it turns on output, asserts, rename and the working directory,
+    which the fsstress harness needs.  The buffer count and write-gather size
+    can be overridden on the command line to build a baseline for comparison.
+*/
+/** @file
+ */
+#ifndef REDCONF_H
+#define REDCONF_H
+
+#include <string.h>
+
+#define REDCONF_READ_ONLY 0
+
+#define REDCONF_API_POSIX 1
+
+#define REDCONF_API_FSE 0
+
+#define REDCONF_API_POSIX_FORMAT 1
+
+#define REDCONF_API_POSIX_SYMLINK 0
+
+#define REDCONF_API_POSIX_LINK 1
+
+#define REDCONF_API_POSIX_UNLINK 1
+
+#define REDCONF_DELETE_OPEN 0
+
+#define REDCONF_API_POSIX_MKDIR 1
+
+#define REDCONF_API_POSIX_RMDIR 1
+
+#define REDCONF_API_POSIX_RENAME 1
+
+#define REDCONF_RENAME_ATOMIC 0
+
+#define REDCONF_API_POSIX_FTRUNCATE 1
+
+#define REDCONF_API_POSIX_FRESERVE 0
+
+#define REDCONF_API_POSIX_READDIR 1
+
+#define REDCONF_API_POSIX_CWD 1
+
+#define REDCONF_API_POSIX_FSTRIM 0
+
+#define REDCONF_POSIX_OWNER_PERM 0
+
+#define REDCONF_NAME_MAX 12U
+
+#define REDCONF_PATH_SEPARATOR '/'
+
+#define REDCONF_TASK_COUNT 10U
+
+#define REDCONF_HANDLE_COUNT 10U
+
+#define REDCONF_API_FSE_FORMAT 0
+
+#define REDCONF_API_FSE_TRUNCATE 0
+
+#define REDCONF_API_FSE_TRANSMASKGET 0
+
+#define REDCONF_API_FSE_TRANSMASKSET 0
+
+#define REDCONF_OUTPUT 1
+
+#define REDCONF_ASSERTS 1
+
+#define REDCONF_BLOCK_SIZE 512U
+
+#define REDCONF_VOLUME_COUNT 1U
+
+#define REDCONF_ENDIAN_BIG 0
+
+#define REDCONF_ALIGNMENT_SIZE 4U
+
+#define REDCONF_CRC_ALGORITHM CRC_SLICEBY8
+
+#define REDCONF_INODE_BLOCKS 1
+
+#define REDCONF_INODE_TIMESTAMPS 1
+
+#define REDCONF_ATIME 0
+
+#define REDCONF_DIRECT_POINTERS 4U
+
+#define REDCONF_INDIRECT_POINTERS 32U
+
+#ifndef REDCONF_BUFFER_COUNT
+#define REDCONF_BUFFER_COUNT 20U
+#endif
+
+#define REDCONF_BUFFER_ALIGNMENT 8U
+
+#ifndef REDCONF_BUFFER_WRITE_GATHER_SIZE_KB
+#define REDCONF_BUFFER_WRITE_GATHER_SIZE_KB 4U
+#endif
+
+#define RedMemCpyUnchecked memcpy
+
+#define RedMemMoveUnchecked memmove
+
+#define RedMemSetUnchecked memset
+
+#define RedMemCmpUnchecked memcmp
+
+#define RedStrLenUnchecked strlen
+
+#define RedStrCmpUnchecked strcmp
+
+#define RedStrNCmpUnchecked strncmp
+
+#define RedStrNCpyUnchecked strncpy
+
+#define REDCONF_TRANSACT_DEFAULT                                                                             \
+  ((RED_TRANSACT_CREAT | RED_TRANSACT_MKDIR | RED_TRANSACT_LINK | RED_TRANSACT_UNLINK | RED_TRANSACT_FSYNC | \
+    RED_TRANSACT_CLOSE | RED_TRANSACT_VOLFULL | RED_TRANSACT_UMOUNT | RED_TRANSACT_SYNC) &                   \
+   RED_TRANSACT_MASK)
+
+#define REDCONF_IMAP_INLINE 1
+
+#define REDCONF_IMAP_EXTERNAL 0
+
+#define REDCONF_DISCARDS 0
+
+#define REDCONF_IMAGE_BUILDER 0
+
+#define REDCONF_CHECKER 0
+
+#define RED_CONFIG_UTILITY_VERSION 0x2060000U
+
+#define RED_CONFIG_MINCOMPAT_VER 0x2060000U
+
+#endif
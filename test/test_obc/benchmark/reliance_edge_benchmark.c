@@ -0,0 +1,202 @@
+/*
+ * Block device traffic generated by Reliance Edge for the OBC's file workloads, with a file-backed block device:
+ *   telemetry - record blocks of 380 to 505 bytes appended to a telemetry batch file, closed every 256 blocks for
+ *               downlink, as the telemetry manager does
+ *   logs      - 512 byte binary log writes with an fsync every 8 writes, as the logger does
+ *   mixed     - both of the above interleaved, as the two tasks run in flight
+ *   fsstress  - the Reliance Edge port of SGI fsstress (fixed seed), for a general mix of operations
+ *
+ * Two binaries are built from the same file: reliance-edge-benchmark uses the flight buffer count and write-gather
+ * size, reliance-edge-benchmark-baseline the 12 buffers and no write gathering the flight build used to have.
+ *
+ * The SD card time is modelled from the counts, since the host cannot time the card: every command costs
+ * SD_WRITE_CMD_US or SD_READ_CMD_US (command, card access or programming, stop and busy), and every sector costs its
+ * 518 bytes on the wire at the SPI clock.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_obc/benchmark/reliance-edge-benchmark and
+ * ./test/test_obc/benchmark/reliance-edge-benchmark-baseline
+ */
+#include "file_bdev.h"
+
+#include <redfs.h>
+#include <redposix.h>
+#include <redtests.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define VOLUME_PATH ""
+
+#define TELEMETRY_DIR "/telemetry"
+#define TELEMETRY_BLOCKS_PER_BATCH 256U
+#define TELEMETRY_MIN_BLOCK_SIZE 380U
+#define TELEMETRY_MAX_BLOCK_SIZE 505U
+#define TELEMETRY_BATCHES 2U
+
+#define LOG_FILE_NAME "/logs.bin"
+#define LOG_WRITE_SIZE 512U
+#define LOG_SYNC_WRITE_COUNT 8U
+#define LOG_WRITES 1024U
+
+#define FSSTRESS_OPS 2000U
+#define FSSTRESS_SEED 1U
+
+#define SD_SECTOR_WIRE_BYTES 518U  // Token, data, CRC and data response
+#define SD_WRITE_CMD_US 1000.0
+#define SD_READ_CMD_US 150.0
+
+static const double SPI_CLOCKS_HZ[] = {300e3, 18.33e6};
+
+static uint8_t payload[LOG_WRITE_SIZE];
+static uint32_t rngState = 1U;
+
+static uint32_t nextRandom(void) {
+  rngState = rngState * 1103515245U + 12345U;
+  return rngState >> 8;
+}
+
+static void check(int32_t ret, const char *what) {
+  if (ret < 0) {
+    fprintf(stderr, "%s failed: errno %d\n", what, (int)red_errno);
+    exit(1);
+  }
+}
+
+typedef struct {
+  int32_t fd;
+  uint32_t batch;
+  uint32_t blocks;
+} telemetry_writer_t;
+
+static void telemetryOpen(telemetry_writer_t *writer) {
+  char path[32];
+  snprintf(path, sizeof(path), TELEMETRY_DIR "/t_%lu.tlm", (unsigned long)writer->batch);
+  writer->fd = red_open(path, RED_O_RDWR | RED_O_CREAT | RED_O_APPEND);
+  check(writer->fd, "open telemetry file");
+  writer->blocks = 0;
+}
+
+static void telemetryAppend(telemetry_writer_t *writer) {
+  uint32_t len = TELEMETRY_MIN_BLOCK_SIZE + nextRandom() % (TELEMETRY_MAX_BLOCK_SIZE - TELEMETRY_MIN_BLOCK_SIZE + 1U);
+  check(red_write(writer->fd, payload, len), "write telemetry");
+
+  if (++writer->blocks == TELEMETRY_BLOCKS_PER_BATCH) {
+    // Closed for downlink, then the next batch starts
+    check(red_close(writer->fd), "close telemetry file");
+    writer->batch++;
+    telemetryOpen(writer);
+  }
+}
+
+typedef struct {
+  int32_t fd;
+  uint32_t writesSinceSync;
+} log_writer_t;
+
+static void logOpen(log_writer_t *writer) {
+  writer->fd = red_open(LOG_FILE_NAME, RED_O_WRONLY | RED_O_CREAT | RED_O_APPEND);
+  check(writer->fd, "open log file");
+  writer->writesSinceSync = 0;
+}
+
+static void logAppend(log_writer_t *writer) {
+  check(red_write(writer->fd, payload, LOG_WRITE_SIZE), "write log");
+
+  if (++writer->writesSinceSync == LOG_SYNC_WRITE_COUNT) {
+    check(red_fsync(writer->fd), "fsync log");
+    writer->writesSinceSync = 0;
+  }
+}
+
+static void runTelemetry(void) {
+  telemetry_writer_t telemetry = {.batch = 0};
+  telemetryOpen(&telemetry);
+  for (uint32_t i = 0; i < TELEMETRY_BATCHES * TELEMETRY_BLOCKS_PER_BATCH; i++) {
+    telemetryAppend(&telemetry);
+  }
+  check(red_close(telemetry.fd), "close telemetry file");
+}
+
+static void runLogs(void) {
+  log_writer_t log;
+  logOpen(&log);
+  for (uint32_t i = 0; i < LOG_WRITES; i++) {
+    logAppend(&log);
+  }
+  check(red_close(log.fd), "close log file");
+}
+
+static void runMixed(void) {
+  telemetry_writer_t telemetry = {.batch = 100};
+  log_writer_t log;
+  telemetryOpen(&telemetry);
+  logOpen(&log);
+
+  // Both tasks write at about the same rate
+  for (uint32_t i = 0; i < LOG_WRITES; i++) {
+    telemetryAppend(&telemetry);
+    logAppend(&log);
+  }
+
+  check(red_close(telemetry.fd), "close telemetry file");
+  check(red_close(log.fd), "close log file");
+}
+
+static void runFsstress(void) {
+  FSSTRESSPARAM param;
+  FsstressDefaultParams(&param);
+  param.ulNops = FSSTRESS_OPS;
+  param.ulSeed = FSSTRESS_SEED;
+  if (FsstressStart(&param) != 0) {
+    fprintf(stderr, "fsstress failed\n");
+    exit(1);
+  }
+}
+
+static void runWorkload(const char *name, void (*workload)(void)) {
+  check(red_format(VOLUME_PATH), "format");
+  check(red_mount(VOLUME_PATH), "mount");
+  check(red_mkdir(TELEMETRY_DIR), "mkdir");
+  check(red_transact(VOLUME_PATH), "transact");
+  fileBdevResetStats();
+
+  workload();
+  check(red_transact(VOLUME_PATH), "transact");
+
+  const file_bdev_stats_t *stats = fileBdevStats();
+  printf("%-10s %7lu %8lu %7.2f %7lu %7lu", name, (unsigned long)stats->writes, (unsigned long)stats->sectorsWritten,
+         (double)stats->sectorsWritten / (double)stats->writes, (unsigned long)stats->reads,
+         (unsigned long)stats->flushes);
+
+  for (size_t i = 0; i < sizeof(SPI_CLOCKS_HZ) / sizeof(SPI_CLOCKS_HZ[0]); i++) {
+    double sectorUs = SD_SECTOR_WIRE_BYTES * 8.0 * 1e6 / SPI_CLOCKS_HZ[i];
+    double cardUs = stats->writes * SD_WRITE_CMD_US + stats->reads * SD_READ_CMD_US +
+                    (double)(stats->sectorsWritten + stats->sectorsRead) * sectorUs;
+    printf(" %11.2f", cardUs / 1e6);
+  }
+  printf("\n");
+
+  check(red_umount(VOLUME_PATH), "unmount");
+}
+
+int main(void) {
+  for (uint32_t i = 0; i < LOG_WRITE_SIZE; i++) {
+    payload[i] = (uint8_t)nextRandom();
+  }
+
+  check(red_init(), "init");
+
+  printf("Reliance Edge: %u buffers, %u KB write gathering\n", (unsigned)REDCONF_BUFFER_COUNT,
+         (unsigned)REDCONF_BUFFER_WRITE_GATHER_SIZE_KB);
+  printf("%-10s %7s %8s %7s %7s %7s %11s %11s\n", "workload", "writes", "sectors", "sec/wr", "reads", "flushes",
+         "sd s@0.3MHz", "sd s@18MHz");
+
+  runWorkload("telemetry", runTelemetry);
+  runWorkload("logs", runLogs);
+  runWorkload("mixed", runMixed);
+  runWorkload("fsstress", runFsstress);
+
+  check(red_uninit(), "uninit");
+  return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ * Cost of reading the time from the DS3232 and of a local time query:
+ *   bus   - I2C traffic of one RTC date time read, field by field with the single register getters (as
+ *           getCurrentDateTimeRTC used to read it) and with the burst read getCurrentDateTimeRTC now does, against a
+ *           simulated DS3232 on a 100 kHz bus
+ *   torn  - reads started at every 10 us over the 2 s around a year rollover, and how many of them return a date
+ *           time that was never on the RTC
+ *   query - host time of a local time query: the tick extrapolation every getCurrentUnixTimeMs does, and the date
+ *           time conversion getCurrentDateTime adds to it
+ *
+ * The simulated DS3232 copies its time registers into its read buffer on every START condition, as the real one does.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_obc/benchmark/rtc-time-benchmark
+ */
+#include "ds3232_mz.h"
+#include "obc_i2c_io.h"
+#include "obc_time_base.h"
+#include "obc_time_utils.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <gio.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define I2C_BIT_US 10U  // 100 kHz
+#define I2C_BYTE_BITS 9U  // 8 data bits and the acknowledge
+#define I2C_START_STOP_BITS 2U
+
+#define DS3232_REG_COUNT 0x14U
+#define DS3232_DATE_TIME_REG_COUNT 7U
+
+#define US_PER_SECOND 1000000ULL
+
+#define TORN_WINDOW_US 2000000ULL
+#define TORN_STEP_US 10ULL
+#define ROLLOVER_UNIX_TIME 1704067200U  // 2024-01-01 00:00:00
+
+#define QUERY_ITERATIONS 10000000U
+
+typedef struct {
+  uint32_t transactions;
+  uint32_t mutexTakes;
+  uint32_t bytes;
+  uint64_t busUs;
+} bus_stats_t;
+
+static bus_stats_t busStats;
+
+// Microseconds since the Unix epoch on the simulated RTC, advanced by the bus time of every transaction
+static uint64_t rtcTimeUs;
+static uint8_t rtcRegs[DS3232_REG_COUNT];
+
+static uint8_t toBCD(uint8_t value) { return (uint8_t)(((value / 10U) << 4) | (value % 10U)); }
+
+static void latchTime(void) {
+  rtc_date_time_t dateTime = {0};
+  unixToDatetime((uint32_t)(rtcTimeUs / US_PER_SECOND), &dateTime);
+
+  rtcRegs[0] = toBCD(dateTime.time.seconds);
+  rtcRegs[1] = toBCD(dateTime.time.minutes);
+  rtcRegs[2] = toBCD(dateTime.time.hours);
+  rtcRegs[3] = 1;
+  rtcRegs[4] = toBCD(dateTime.date.date);
+  rtcRegs[5] = toBCD(dateTime.date.month);
+  rtcRegs[6] = toBCD(dateTime.date.year);
+}
+
+static void busTransaction(uint32_t bytes) {
+  uint64_t us = (I2C_START_STOP_BITS + (1U + bytes) * I2C_BYTE_BITS) * I2C_BIT_US;  // The address byte leads
+
+  busStats.transactions++;
+  busStats.mutexTakes++;  // i2cSendTo and i2cReceiveFrom each take the bus mutex
+  busStats.bytes += 1U + bytes;
+  busStats.busUs += us;
+  rtcTimeUs += us;
+}
+
+obc_error_code_t i2cReadReg(uint8_t sAddr, uint8_t reg, uint8_t *data, uint16_t numBytes,
+                            TickType_t transferTimeoutTicks) {
+  if (data == NULL || numBytes < 1 || reg + numBytes > DS3232_REG_COUNT) return OBC_ERR_CODE_INVALID_ARG;
+
+  // Register pointer write, then a read that starts with the time latched
+  busTransaction(1);
+  latchTime();
+  memcpy(data, &rtcRegs[reg], numBytes);
+  busTransaction(numBytes);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t i2cWriteReg(uint8_t sAddr, uint8_t reg, uint8_t *data, uint8_t numBytes) {
+  busTransaction(1U + numBytes);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+void gioSetBit(gioPORT_t *port, uint32 bit, uint32 value) {}
+
+uint32 gioGetBit(gioPORT_t *port, uint32 bit) { return 0; }
+
+// The field by field read getCurrentDateTimeRTC used to do
+static obc_error_code_t readDateTimeByField(rtc_date_time_t *dateTime) {
+  obc_error_code_t errCode;
+
+  RETURN_IF_ERROR_CODE(getDateRTC(&dateTime->date.date));
+  RETURN_IF_ERROR_CODE(getMonthRTC(&dateTime->date.month));
+  RETURN_IF_ERROR_CODE(getYearRTC(&dateTime->date.year));
+  RETURN_IF_ERROR_CODE(getHoursRTC(&dateTime->time.hours));
+  RETURN_IF_ERROR_CODE(getMinutesRTC(&dateTime->time.minutes));
+  RETURN_IF_ERROR_CODE(getSecondsRTC(&dateTime->time.seconds));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static void runReader(const char *name, obc_error_code_t (*reader)(rtc_date_time_t *)) {
+  rtc_date_time_t dateTime = {0};
+
+  memset(&busStats, 0, sizeof(busStats));
+  rtcTimeUs = (uint64_t)ROLLOVER_UNIX_TIME * US_PER_SECOND;
+  if (reader(&dateTime) != OBC_ERR_CODE_SUCCESS) {
+    fprintf(stderr, "%s read failed\n", name);
+    return;
+  }
+  bus_stats_t perRead = busStats;
+
+  // A read is torn if it returns neither the time when it started nor the time when it ended
+  uint32_t reads = 0;
+  uint32_t torn = 0;
+  for (uint64_t startUs = 0; startUs < TORN_WINDOW_US; startUs += TORN_STEP_US) {
+    rtcTimeUs = (uint64_t)ROLLOVER_UNIX_TIME * US_PER_SECOND - TORN_WINDOW_US / 2U + startUs;
+    uint32_t before = (uint32_t)(rtcTimeUs / US_PER_SECOND);
+    reader(&dateTime);
+    uint32_t after = (uint32_t)(rtcTimeUs / US_PER_SECOND);
+
+    uint32_t unixTime = 0;
+    reads++;
+    if (datetimeToUnix(&dateTime, &unixTime) != OBC_ERR_CODE_SUCCESS || unixTime < before || unixTime > after) {
+      torn++;
+    }
+  }
+
+  printf("%-9s %12lu %11lu %5lu %9lu %6lu/%lu\n", name, (unsigned long)perRead.transactions,
+         (unsigned long)perRead.mutexTakes, (unsigned long)perRead.bytes, (unsigned long)perRead.busUs,
+         (unsigned long)torn, (unsigned long)reads);
+}
+
+static double elapsedNs(const struct timespec *start, const struct timespec *end) {
+  return (double)(end->tv_sec - start->tv_sec) * 1e9 + (double)(end->tv_nsec - start->tv_nsec);
+}
+
+static void runQueries(void) {
+  obc_time_base_t base;
+  timeBaseSet(&base, ROLLOVER_UNIX_TIME, 0);
+
+  struct timespec start;
+  struct timespec end;
+  volatile uint32_t sink = 0;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t tick = 0; tick < QUERY_ITERATIONS; tick++) {
+    unix_time_ms_t now = timeBaseNow(&base, tick);
+    sink += now.milliseconds;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  printf("%-24s %8.1f ns\n", "getCurrentUnixTimeMs", elapsedNs(&start, &end) / QUERY_ITERATIONS);
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t tick = 0; tick < QUERY_ITERATIONS; tick++) {
+    rtc_date_time_t dateTime;
+    unixToDatetime(timeBaseNow(&base, tick * 1000U).seconds, &dateTime);
+    sink += dateTime.time.seconds;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  printf("%-24s %8.1f ns\n", "getCurrentDateTime", elapsedNs(&start, &end) / QUERY_ITERATIONS);
+
+  (void)sink;
+}
+
+int main(void) {
+  printf("RTC date time read, 100 kHz I2C\n");
+  printf("%-9s %12s %11s %5s %9s %13s\n", "read", "transactions", "mutex takes", "bytes", "bus us", "torn");
+  runReader("by field", readDateTimeByField);
+  runReader("burst", getCurrentDateTimeRTC);
+
+  printf("\nLocal time query, host\n");
+  runQueries();
+
+  return 0;
+}
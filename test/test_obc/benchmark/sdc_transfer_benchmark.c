@@ -0,0 +1,261 @@
+/*
+ * SD card sector throughput, modelled on the simulated card in test/mocks/mock_sd_card.c:
+ *   original - the per byte driver that sdc_bdev.c used before sdc_transfer.c, sleeping 1 ms after any poll that
+ *              did not succeed straight away
+ *   bytes    - sdcReadSectors/sdcWriteSectors moving data packets a byte at a time
+ *   dma      - sdcReadSectors/sdcWriteSectors moving each data packet in one DMA transfer
+ * Each run writes and reads back BENCHMARK_SECTORS sectors in transfers of N sectors. The simulated card counts the
+ * bytes clocked; elapsed time is modelled from those counts with the costs below, since the host cannot time the
+ * RM46's SPI bus.
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_obc/benchmark/sdc-transfer-benchmark
+ */
+#include "sdc_transfer.h"
+#include "mock_sd_card.h"
+#include "obc_errors.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCHMARK_SECTORS 256U
+#define BENCHMARK_CARD_SECTORS 4096U
+
+// Cost model. Per call overhead of spiTransmitAndReceiveByte (bus owner check, HALCoGen polling loop, error
+// logging branch) and of starting and finishing a DMA transfer (privileged channel setup, semaphore wait and
+// context switch) on the 220 MHz RM46. vTaskDelay(1) sleeps a whole tick.
+#define BYTE_CALL_OVERHEAD_US 1.5
+#define DMA_TRANSFER_OVERHEAD_US 15.0
+#define DELAY_US 1000.0
+
+// Card timing: time to fetch a sector and to program one during a pre-erased multiple sector write
+#define CARD_READ_ACCESS_US 100.0
+#define CARD_WRITE_BUSY_US 250.0
+
+typedef struct {
+  uint64_t byteCalls;
+  uint64_t dmaTransfers;
+  uint64_t dmaFrames;
+  uint64_t delays;
+} bus_counters_t;
+
+static bus_counters_t counters;
+static uint32_t bytesPerMs;
+static uint16_t *dmaTx;
+static uint16_t *dmaRx;
+static size_t dmaNumFrames;
+
+static void fail(const char *reason) {
+  printf("FAILED: %s\n", reason);
+  exit(1);
+}
+
+static obc_error_code_t benchExchangeByte(uint8_t tx, uint8_t *rx) {
+  counters.byteCalls++;
+  *rx = mockSdCardExchange(tx);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t benchStartDma(uint16_t *tx, uint16_t *rx, size_t numFrames) {
+  dmaTx = tx;
+  dmaRx = rx;
+  dmaNumFrames = numFrames;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t benchWaitDma(void) {
+  for (size_t i = 0; i < dmaNumFrames; i++) {
+    dmaRx[i] = mockSdCardExchange((uint8_t)dmaTx[i]);
+  }
+  counters.dmaTransfers++;
+  counters.dmaFrames += dmaNumFrames;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static void benchDelayMs(uint32_t ms) {
+  counters.delays++;
+  mockSdCardElapse(ms * bytesPerMs);
+}
+
+static sdc_spi_ops_t byteOps = {benchExchangeByte, NULL, NULL, benchDelayMs, 0};
+static sdc_spi_ops_t dmaOps = {benchExchangeByte, benchStartDma, benchWaitDma, benchDelayMs, 0};
+
+/* Same algorithms as the original sdc_bdev.c data path */
+
+static uint8_t xchg(uint8_t tx) {
+  uint8_t rx;
+  benchExchangeByte(tx, &rx);
+  return rx;
+}
+
+static bool origIsCardReady(void) {
+  for (uint8_t i = 0; i < 50; i++) {
+    if (xchg(0xFF) == 0xFF) return true;
+    benchDelayMs(1);
+  }
+  return false;
+}
+
+static uint8_t origSendCmd(uint8_t cmd, uint32_t arg) {
+  if (!origIsCardReady()) return 0xFF;
+  xchg(cmd);
+  xchg((uint8_t)(arg >> 24));
+  xchg((uint8_t)(arg >> 16));
+  xchg((uint8_t)(arg >> 8));
+  xchg((uint8_t)arg);
+  xchg(0xFF);
+  uint8_t res = 0xFF;
+  for (uint8_t i = 0; i < 50; i++) {
+    res = xchg(0xFF);
+    if (!(res & 0x80)) break;
+    benchDelayMs(1);
+  }
+  return res;
+}
+
+static bool origRcvDataBlock(uint8_t *buff) {
+  uint8_t token = 0xFF;
+  for (uint8_t i = 0; i < 50; i++) {
+    token = xchg(0xFF);
+    if (token != 0xFF) break;
+    benchDelayMs(1);
+  }
+  if (token != 0xFE) return false;
+  for (uint32_t i = 0; i < SD_SECTOR_SIZE; i++) buff[i] = xchg(0xFF);
+  xchg(0xFF);
+  xchg(0xFF);
+  return true;
+}
+
+static bool origSendDataBlock(const uint8_t *buff, uint8_t token) {
+  if (!origIsCardReady()) return false;
+  xchg(token);
+  if (token != SD_STOP_TRANSMISSION) {
+    for (uint32_t i = 0; i < SD_SECTOR_SIZE; i++) xchg(buff[i]);
+    xchg(0xFF);
+    xchg(0xFF);
+    if ((xchg(0xFF) & SD_DATA_RESPONSE_MASK) != SD_DATA_RESPONSE_ACCEPTED) return false;
+  }
+  return true;
+}
+
+static void origStopTransmission(void) {
+  xchg(SDC_CMD12);
+  for (uint8_t i = 0; i < 5; i++) xchg(0);
+  for (uint8_t i = 0; i < 2 + 8; i++) xchg(0xFF);
+}
+
+static bool origRead(uint32_t sector, uint8_t *buff, uint32_t count) {
+  if (count == 1) return origSendCmd(SDC_CMD17, sector) == 0 && origRcvDataBlock(buff);
+  if (origSendCmd(SDC_CMD18, sector) != 0) return false;
+  do {
+    if (!origRcvDataBlock(buff)) break;
+    buff += SD_SECTOR_SIZE;
+  } while (--count);
+  origStopTransmission();
+  return count == 0;
+}
+
+static bool origWrite(uint32_t sector, const uint8_t *buff, uint32_t count) {
+  if (count == 1) return origSendCmd(SDC_CMD24, sector) == 0 && origSendDataBlock(buff, SDC_CMD24_DATA_TOKEN);
+  origSendCmd(SDC_CMD55, 0);
+  origSendCmd(SDC_CMD23, count);
+  if (origSendCmd(SDC_CMD25, sector) != 0) return false;
+  do {
+    if (!origSendDataBlock(buff, SDC_CMD25_DATA_TOKEN)) break;
+    buff += SD_SECTOR_SIZE;
+  } while (--count);
+  return origSendDataBlock(NULL, SD_STOP_TRANSMISSION) && count == 0;
+}
+
+typedef enum {
+  PATH_ORIGINAL,
+  PATH_BYTES,
+  PATH_DMA,
+} transfer_path_t;
+
+typedef struct {
+  double sectorsPerSec;
+  double cpuBusy;
+} bench_result_t;
+
+static bench_result_t runPath(transfer_path_t path, double spiHz, uint32_t sectorsPerTransfer, uint8_t *storage,
+                              uint8_t *data, uint8_t *readBack) {
+  double byteUs = 8e6 / spiHz;
+  bytesPerMs = (uint32_t)(spiHz / 8000.0);
+  byteOps.pollSpinBytes = bytesPerMs;
+  dmaOps.pollSpinBytes = bytesPerMs;
+
+  mock_sd_card_config_t config = mockSdCardDefaultConfig();
+  config.readAccessBytes = (uint32_t)(CARD_READ_ACCESS_US / byteUs);
+  config.writeBusyBytes = (uint32_t)(CARD_WRITE_BUSY_US / byteUs);
+  // The original driver sends a dummy CRC
+  config.checkWriteCrc = false;
+  mockSdCardInit(storage, BENCHMARK_CARD_SECTORS, &config);
+  memset(&counters, 0, sizeof(counters));
+  memset(readBack, 0, BENCHMARK_SECTORS * SD_SECTOR_SIZE);
+
+  for (uint32_t i = 0; i < BENCHMARK_SECTORS; i += sectorsPerTransfer) {
+    const uint8_t *src = data + i * SD_SECTOR_SIZE;
+    bool ok = (path == PATH_ORIGINAL)
+                  ? origWrite(i, src, sectorsPerTransfer)
+                  : sdcWriteSectors(path == PATH_DMA ? &dmaOps : &byteOps, i, src, sectorsPerTransfer, true) ==
+                        OBC_ERR_CODE_SUCCESS;
+    if (!ok) fail("write");
+  }
+  for (uint32_t i = 0; i < BENCHMARK_SECTORS; i += sectorsPerTransfer) {
+    uint8_t *dst = readBack + i * SD_SECTOR_SIZE;
+    bool ok = (path == PATH_ORIGINAL)
+                  ? origRead(i, dst, sectorsPerTransfer)
+                  : sdcReadSectors(path == PATH_DMA ? &dmaOps : &byteOps, i, dst, sectorsPerTransfer) ==
+                        OBC_ERR_CODE_SUCCESS;
+    if (!ok) fail("read");
+  }
+  if (memcmp(data, readBack, BENCHMARK_SECTORS * SD_SECTOR_SIZE) != 0) fail("data mismatch");
+
+  double cpuUs = counters.byteCalls * (byteUs + BYTE_CALL_OVERHEAD_US) +
+                 counters.dmaTransfers * DMA_TRANSFER_OVERHEAD_US;
+  double elapsedUs = cpuUs + counters.dmaFrames * byteUs + counters.delays * DELAY_US;
+
+  return (bench_result_t){.sectorsPerSec = 2.0 * BENCHMARK_SECTORS / (elapsedUs / 1e6), .cpuBusy = cpuUs / elapsedUs};
+}
+
+int main(void) {
+  // The SD card's SPI format as configured in HALCoGen (VCLK1 / 244), and with the prescaler at its minimum of 3
+  static const double SPI_CLOCKS_HZ[] = {300546.0, 18333333.0};
+  static const uint32_t SECTORS_PER_TRANSFER[] = {1, 8, 64};
+
+  uint8_t *storage = malloc((size_t)BENCHMARK_CARD_SECTORS * SD_SECTOR_SIZE);
+  uint8_t *data = malloc(BENCHMARK_SECTORS * SD_SECTOR_SIZE);
+  uint8_t *readBack = malloc(BENCHMARK_SECTORS * SD_SECTOR_SIZE);
+  if (storage == NULL || data == NULL || readBack == NULL) fail("malloc");
+
+  uint32_t seed = 0x5D;
+  for (uint32_t i = 0; i < BENCHMARK_SECTORS * SD_SECTOR_SIZE; i++) {
+    seed = seed * 1103515245U + 12345U;
+    data[i] = (uint8_t)(seed >> 16);
+  }
+
+  printf("[ SD TRANSFER ] %u sectors written then read; sectors/s with CPU busy %% (modelled)\n",
+         (unsigned)BENCHMARK_SECTORS);
+  for (uint32_t c = 0; c < sizeof(SPI_CLOCKS_HZ) / sizeof(SPI_CLOCKS_HZ[0]); c++) {
+    for (uint32_t n = 0; n < sizeof(SECTORS_PER_TRANSFER) / sizeof(SECTORS_PER_TRANSFER[0]); n++) {
+      uint32_t sectors = SECTORS_PER_TRANSFER[n];
+      bench_result_t orig = runPath(PATH_ORIGINAL, SPI_CLOCKS_HZ[c], sectors, storage, data, readBack);
+      bench_result_t bytes = runPath(PATH_BYTES, SPI_CLOCKS_HZ[c], sectors, storage, data, readBack);
+      bench_result_t dma = runPath(PATH_DMA, SPI_CLOCKS_HZ[c], sectors, storage, data, readBack);
+
+      printf("[ SD TRANSFER ] %8.3f MHz N=%2u original %7.1f (%3.0f%%) | bytes %7.1f (%3.0f%%) | dma %7.1f (%3.0f%%) "
+             "| %5.1fx\n",
+             SPI_CLOCKS_HZ[c] / 1e6, (unsigned)sectors, orig.sectorsPerSec, orig.cpuBusy * 100.0, bytes.sectorsPerSec,
+             bytes.cpuBusy * 100.0, dma.sectorsPerSec, dma.cpuBusy * 100.0, dma.sectorsPerSec / orig.sectorsPerSec);
+    }
+  }
+
+  free(storage);
+  free(data);
+  free(readBack);
+  return 0;
+}
@@ -0,0 +1,285 @@
+/*
+ * Host benchmark for the uplink receive path on the POSIX FreeRTOS port.
+ *
+ * A producer task plays the role of cc1120ReceiveToDecodeTask and hands a stream of stuffed AX.25 frames to a
+ * decoder task in TXRX_INTERRUPT_THRESHOLD sized chunks. Two transports are compared:
+ *   - queue: one xQueueSend/xQueueReceive per byte and a per-byte flag search (the original uplink decoder)
+ *   - stream: a byte ring plus a binary semaphore per chunk, with frames found by ax25FrameExtractorPush
+ *
+ * Build with CMAKE_BUILD_TYPE=Test and run ./test/test_obc/benchmark/uplink-transport-benchmark
+ */
+#include "obc_byte_ring.h"
+#include "obc_gs_ax25.h"
+#include "obc_gs_ax25_frame_extractor.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <FreeRTOS.h>
+#include <os_queue.h>
+#include <os_semphr.h>
+#include <os_task.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCHMARK_FRAME_COUNT 2000U
+#define BENCHMARK_UNIQUE_FRAMES 16U
+
+// Matches TXRX_INTERRUPT_THRESHOLD in cc1120.h
+#define BENCHMARK_CHUNK_SIZE 100U
+
+// Same sizes as the uplink decoder
+#define BENCHMARK_QUEUE_LENGTH (2U * BENCHMARK_CHUNK_SIZE)
+#define BENCHMARK_STREAM_SIZE 1024U
+
+#define BENCHMARK_TASK_STACK_SIZE 8192U
+#define BENCHMARK_CONTROL_PRIORITY 3U
+#define BENCHMARK_COMMS_PRIORITY 2U  // Comms tasks share a priority on the OBC
+
+typedef enum {
+  TRANSPORT_QUEUE,
+  TRANSPORT_STREAM,
+} transport_t;
+
+static uint8_t *stream;
+static uint32_t streamLen;
+
+static transport_t activeTransport;
+static volatile uint32_t framesDecoded;
+
+static QueueHandle_t byteQueue;
+static StaticQueue_t byteQueueBuffer;
+static uint8_t byteQueueStorage[BENCHMARK_QUEUE_LENGTH];
+
+static obc_byte_ring_t ring;
+static uint8_t ringBuffer[BENCHMARK_STREAM_SIZE];
+static SemaphoreHandle_t dataAvailableSemaphore;
+static StaticSemaphore_t dataAvailableSemaphoreBuffer;
+static SemaphoreHandle_t spaceSemaphore;
+static StaticSemaphore_t spaceSemaphoreBuffer;
+
+static SemaphoreHandle_t startSemaphore;
+static StaticSemaphore_t startSemaphoreBuffer;
+static SemaphoreHandle_t decoderStartSemaphore;
+static StaticSemaphore_t decoderStartSemaphoreBuffer;
+static SemaphoreHandle_t doneSemaphore;
+static StaticSemaphore_t doneSemaphoreBuffer;
+
+static StaticTask_t producerTaskBuffer;
+static StackType_t producerTaskStack[BENCHMARK_TASK_STACK_SIZE];
+static StaticTask_t decoderTaskBuffer;
+static StackType_t decoderTaskStack[BENCHMARK_TASK_STACK_SIZE];
+static StaticTask_t controlTaskBuffer;
+static StackType_t controlTaskStack[BENCHMARK_TASK_STACK_SIZE];
+
+static void buildStream(void) {
+  packed_ax25_i_frame_t frames[BENCHMARK_UNIQUE_FRAMES];
+  uint32_t seed = 0xBEEF;
+
+  setCurrentLinkDestCallSign(GROUND_STATION_CALLSIGN, CALLSIGN_LENGTH, DEFAULT_SSID);
+
+  for (uint32_t i = 0; i < BENCHMARK_UNIQUE_FRAMES; ++i) {
+    uint8_t telemData[RS_ENCODED_SIZE];
+    for (uint16_t j = 0; j < RS_ENCODED_SIZE; ++j) {
+      // Pseudorandom generation using a simple algorithm
+      seed = (seed * 1103515245 + 12345) % (1U << 31);
+      telemData[j] = (uint8_t)(seed >> 16);
+    }
+
+    unstuffed_ax25_i_frame_t unstuffed = {0};
+    memset(&frames[i], 0, sizeof(frames[i]));
+    if (ax25SendIFrame(telemData, RS_ENCODED_SIZE, &unstuffed) != OBC_GS_ERR_CODE_SUCCESS ||
+        ax25Stuff(unstuffed.data, unstuffed.length, frames[i].data, &frames[i].length) != OBC_GS_ERR_CODE_SUCCESS) {
+      printf("Failed to build frame %u\n", (unsigned)i);
+      exit(1);
+    }
+  }
+
+  streamLen = 0;
+  for (uint32_t i = 0; i < BENCHMARK_FRAME_COUNT; ++i) {
+    streamLen += frames[i % BENCHMARK_UNIQUE_FRAMES].length;
+  }
+
+  stream = malloc(streamLen);
+  if (stream == NULL) {
+    printf("Failed to allocate the stream\n");
+    exit(1);
+  }
+
+  uint32_t offset = 0;
+  for (uint32_t i = 0; i < BENCHMARK_FRAME_COUNT; ++i) {
+    const packed_ax25_i_frame_t *frame = &frames[i % BENCHMARK_UNIQUE_FRAMES];
+    memcpy(stream + offset, frame->data, frame->length);
+    offset += frame->length;
+  }
+}
+
+static void countFrame(const uint8_t *frame, uint16_t frameLen, void *context) {
+  (void)frame;
+  (void)frameLen;
+  (void)context;
+  framesDecoded++;
+}
+
+static void producerTask(void *pvParameters) {
+  (void)pvParameters;
+
+  while (1) {
+    xSemaphoreTake(startSemaphore, portMAX_DELAY);
+
+    for (uint32_t offset = 0; offset < streamLen; offset += BENCHMARK_CHUNK_SIZE) {
+      uint32_t chunkLen = (streamLen - offset < BENCHMARK_CHUNK_SIZE) ? (streamLen - offset) : BENCHMARK_CHUNK_SIZE;
+      const uint8_t *chunk = stream + offset;
+
+      if (activeTransport == TRANSPORT_QUEUE) {
+        for (uint32_t i = 0; i < chunkLen; ++i) {
+          xQueueSend(byteQueue, &chunk[i], portMAX_DELAY);
+        }
+        continue;
+      }
+
+      while (chunkLen > 0) {
+        uint32_t bytesWritten = byteRingWrite(&ring, chunk, chunkLen);
+        if (bytesWritten > 0) {
+          chunk += bytesWritten;
+          chunkLen -= bytesWritten;
+          xSemaphoreGive(dataAvailableSemaphore);
+          continue;
+        }
+        xSemaphoreTake(spaceSemaphore, portMAX_DELAY);
+      }
+    }
+  }
+}
+
+static void decodeQueue(void) {
+  static packed_ax25_i_frame_t axData;
+  uint16_t axDataIndex = 0;
+  bool startFlagReceived = false;
+  uint8_t byte;
+
+  while (framesDecoded < BENCHMARK_FRAME_COUNT) {
+    if (xQueueReceive(byteQueue, &byte, portMAX_DELAY) != pdPASS) {
+      continue;
+    }
+
+    if (axDataIndex >= sizeof(axData.data)) {
+      axDataIndex = 0;
+      startFlagReceived = false;
+    }
+
+    if (byte == AX25_FLAG) {
+      axData.data[axDataIndex++] = byte;
+      if (axDataIndex > 2) {
+        countFrame(axData.data, axDataIndex, NULL);
+        axDataIndex = 0;
+        axData.data[axDataIndex++] = AX25_FLAG;
+      } else {
+        startFlagReceived = true;
+        axDataIndex = 1;
+      }
+      continue;
+    }
+    if (startFlagReceived) {
+      axData.data[axDataIndex++] = byte;
+    }
+  }
+}
+
+static void decodeStream(void) {
+  static ax25_frame_extractor_t extractor;
+  ax25FrameExtractorInit(&extractor);
+
+  while (framesDecoded < BENCHMARK_FRAME_COUNT) {
+    if (xSemaphoreTake(dataAvailableSemaphore, portMAX_DELAY) != pdPASS) {
+      continue;
+    }
+
+    const uint8_t *span = NULL;
+    uint32_t spanLen;
+    while ((spanLen = byteRingPeekContiguous(&ring, &span)) > 0) {
+      ax25FrameExtractorPush(&extractor, span, spanLen, countFrame, NULL);
+      byteRingConsume(&ring, spanLen);
+      xSemaphoreGive(spaceSemaphore);
+    }
+  }
+}
+
+static void decoderTask(void *pvParameters) {
+  (void)pvParameters;
+
+  while (1) {
+    xSemaphoreTake(decoderStartSemaphore, portMAX_DELAY);
+
+    if (activeTransport == TRANSPORT_QUEUE) {
+      decodeQueue();
+    } else {
+      decodeStream();
+    }
+    xSemaphoreGive(doneSemaphore);
+  }
+}
+
+static double secondsOf(clockid_t clock) {
+  struct timespec now;
+  clock_gettime(clock, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void runTransport(transport_t transport, const char *name) {
+  activeTransport = transport;
+  framesDecoded = 0;
+  xQueueReset(byteQueue);
+  byteRingInit(&ring, ringBuffer, sizeof(ringBuffer));
+
+  double wallStart = secondsOf(CLOCK_MONOTONIC);
+  double cpuStart = secondsOf(CLOCK_PROCESS_CPUTIME_ID);
+
+  xSemaphoreGive(decoderStartSemaphore);
+  xSemaphoreGive(startSemaphore);
+  xSemaphoreTake(doneSemaphore, portMAX_DELAY);
+
+  double wallSeconds = secondsOf(CLOCK_MONOTONIC) - wallStart;
+  double cpuSeconds = secondsOf(CLOCK_PROCESS_CPUTIME_ID) - cpuStart;
+
+  printf("[ UPLINK   ] %-8s %6u frames %10.0f frames/s %8.2f us CPU/frame\n", name, (unsigned)framesDecoded,
+         framesDecoded / wallSeconds, cpuSeconds * 1e6 / framesDecoded);
+}
+
+static void controlTask(void *pvParameters) {
+  (void)pvParameters;
+
+  printf("%u frames, %u bytes, %u byte chunks\n", (unsigned)BENCHMARK_FRAME_COUNT, (unsigned)streamLen,
+         (unsigned)BENCHMARK_CHUNK_SIZE);
+
+  runTransport(TRANSPORT_QUEUE, "queue");
+  runTransport(TRANSPORT_STREAM, "stream");
+
+  exit(0);
+}
+
+int main(void) {
+  buildStream();
+
+  byteQueue = xQueueCreateStatic(BENCHMARK_QUEUE_LENGTH, sizeof(uint8_t), byteQueueStorage, &byteQueueBuffer);
+  dataAvailableSemaphore = xSemaphoreCreateBinaryStatic(&dataAvailableSemaphoreBuffer);
+  spaceSemaphore = xSemaphoreCreateBinaryStatic(&spaceSemaphoreBuffer);
+  startSemaphore = xSemaphoreCreateBinaryStatic(&startSemaphoreBuffer);
+  decoderStartSemaphore = xSemaphoreCreateBinaryStatic(&decoderStartSemaphoreBuffer);
+  doneSemaphore = xSemaphoreCreateBinaryStatic(&doneSemaphoreBuffer);
+
+  xTaskCreateStatic(producerTask, "producer", BENCHMARK_TASK_STACK_SIZE, NULL, BENCHMARK_COMMS_PRIORITY,
+                    producerTaskStack, &producerTaskBuffer);
+  xTaskCreateStatic(decoderTask, "decoder", BENCHMARK_TASK_STACK_SIZE, NULL, BENCHMARK_COMMS_PRIORITY,
+                    decoderTaskStack, &decoderTaskBuffer);
+  xTaskCreateStatic(controlTask, "control", BENCHMARK_TASK_STACK_SIZE, NULL, BENCHMARK_CONTROL_PRIORITY,
+                    controlTaskStack, &controlTaskBuffer);
+
+  vTaskStartScheduler();
+
+  return 1;
+}
@@ -0,0 +1,298 @@
+#include "alarm_queue.h"
+#include "alarm_handler.h"
+#include "obc_persistent.h"
+#include "obc_errors.h"
+#include "fm25v20a.h"
+#include "mock_fram.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+#define TEST_QUEUE_CAPACITY 64U
+
+static obc_error_code_t defaultCallback(void) { return OBC_ERR_CODE_SUCCESS; }
+
+static obc_error_code_t cmdCallback(cmd_msg_t *cmd, uint8_t *responseData, uint8_t *responseDataLen) {
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static alarm_handler_alarm_info_t makeCmdAlarm(uint32_t unixTime, uint32_t rtcSyncTime) {
+  alarm_handler_alarm_info_t alarm = {};
+  alarm.unixTime = unixTime;
+  alarm.type = ALARM_TYPE_TIME_TAGGED_CMD;
+  alarm.callbackDef.cmdCallback = cmdCallback;
+  alarm.cmdMsg.id = CMD_RTC_SYNC;
+  alarm.cmdMsg.isTimeTagged = true;
+  alarm.cmdMsg.timestamp = unixTime;
+  alarm.cmdMsg.rtcSync.unixTime = rtcSyncTime;
+  return alarm;
+}
+
+// Zeroes the alarm sections so every slot fails its CRC check, as on a fresh FRAM
+static void wipeAlarmSections() {
+  static const uint8_t zeros[sizeof(alarm_mgr_persist_t)] = {0};
+  for (uint32_t i = 0; i < OBC_PERSISTENT_MAX_SUBINDEX_ALARM; ++i) {
+    ASSERT_EQ(framWrite(OBC_PERSIST_ADDR_OF(alarmMgr) + i * sizeof(alarm_mgr_persist_t), zeros, sizeof(zeros)),
+              OBC_ERR_CODE_SUCCESS);
+  }
+}
+
+class TestAlarmQueue : public ::testing::Test {
+ protected:
+  void SetUp() override { wipeAlarmSections(); }
+
+  void init(uint16_t capacity, bool persistent) {
+    ASSERT_EQ(alarmQueueInit(&queue, slots, heap, freeSlots, capacity, persistent), OBC_ERR_CODE_SUCCESS);
+  }
+
+  alarm_queue_t queue;
+  alarm_handler_alarm_info_t slots[TEST_QUEUE_CAPACITY];
+  alarm_queue_node_t heap[TEST_QUEUE_CAPACITY];
+  uint16_t freeSlots[TEST_QUEUE_CAPACITY];
+};
+
+TEST_F(TestAlarmQueue, InitRejectsInvalidArgs) {
+  EXPECT_EQ(alarmQueueInit(nullptr, slots, heap, freeSlots, TEST_QUEUE_CAPACITY, false), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(alarmQueueInit(&queue, nullptr, heap, freeSlots, TEST_QUEUE_CAPACITY, false), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(alarmQueueInit(&queue, slots, nullptr, freeSlots, TEST_QUEUE_CAPACITY, false), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(alarmQueueInit(&queue, slots, heap, nullptr, TEST_QUEUE_CAPACITY, false), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(alarmQueueInit(&queue, slots, heap, freeSlots, 0, false), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(alarmQueueInit(&queue, slots, heap, freeSlots, OBC_PERSISTENT_MAX_SUBINDEX_ALARM + 1, true),
+            OBC_ERR_CODE_INVALID_ARG);
+
+  init(TEST_QUEUE_CAPACITY, false);
+  uint16_t numRestored = 0;
+  EXPECT_EQ(alarmQueueRestore(&queue, &numRestored), OBC_ERR_CODE_INVALID_STATE);
+}
+
+TEST_F(TestAlarmQueue, EmptyQueue) {
+  init(TEST_QUEUE_CAPACITY, false);
+
+  const alarm_handler_alarm_info_t *earliest = nullptr;
+  alarm_handler_alarm_info_t alarm;
+  EXPECT_EQ(alarmQueueCount(&queue), 0U);
+  EXPECT_EQ(alarmQueuePeek(&queue, &earliest), OBC_ERR_CODE_QUEUE_EMPTY);
+  EXPECT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_QUEUE_EMPTY);
+}
+
+TEST_F(TestAlarmQueue, PopsInTimeOrderThenQueueOrder) {
+  init(TEST_QUEUE_CAPACITY, false);
+
+  // Times repeat so ties are exercised; rtcSync.unixTime records the order each alarm was pushed in
+  std::vector<std::pair<uint32_t, uint32_t>> expected;
+  uint32_t seed = 0x2024;
+  for (uint32_t i = 0; i < TEST_QUEUE_CAPACITY; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    uint32_t unixTime = 1700000000U + (seed >> 16) % 20U;
+    alarm_handler_alarm_info_t alarm = makeCmdAlarm(unixTime, i);
+    bool isEarliest = false;
+    ASSERT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+
+    bool wasEarliest = expected.empty() || std::all_of(expected.begin(), expected.end(), [unixTime](const auto &e) {
+                         return unixTime < e.first;
+                       });
+    EXPECT_EQ(isEarliest, wasEarliest);
+    expected.emplace_back(unixTime, i);
+  }
+  std::stable_sort(expected.begin(), expected.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+  bool isEarliest = false;
+  alarm_handler_alarm_info_t extra = makeCmdAlarm(0, 0);
+  EXPECT_EQ(alarmQueuePush(&queue, &extra, &isEarliest), OBC_ERR_CODE_QUEUE_FULL);
+  EXPECT_EQ(alarmQueueCount(&queue), TEST_QUEUE_CAPACITY);
+
+  for (const auto &e : expected) {
+    const alarm_handler_alarm_info_t *earliest = nullptr;
+    ASSERT_EQ(alarmQueuePeek(&queue, &earliest), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(earliest->unixTime, e.first);
+
+    alarm_handler_alarm_info_t alarm;
+    ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(alarm.unixTime, e.first);
+    EXPECT_EQ(alarm.cmdMsg.rtcSync.unixTime, e.second);
+    EXPECT_EQ(alarm.callbackDef.cmdCallback, cmdCallback);
+  }
+  EXPECT_EQ(alarmQueueCount(&queue), 0U);
+}
+
+TEST_F(TestAlarmQueue, SlotsAreReused) {
+  init(4, false);
+
+  // Many more alarms than slots go through the queue while it stays partly full
+  uint32_t nextTime = 100;
+  for (uint32_t i = 0; i < 3; ++i) {
+    alarm_handler_alarm_info_t alarm = makeCmdAlarm(nextTime++, 0);
+    bool isEarliest = false;
+    ASSERT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+  }
+
+  for (uint32_t i = 0; i < 100; ++i) {
+    alarm_handler_alarm_info_t alarm;
+    ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(alarm.unixTime, 100 + i);
+
+    alarm = makeCmdAlarm(nextTime++, 0);
+    bool isEarliest = true;
+    ASSERT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+    EXPECT_FALSE(isEarliest);
+  }
+  EXPECT_EQ(alarmQueueCount(&queue), 3U);
+}
+
+TEST_F(TestAlarmQueue, RestoresQueuedCommandsFromFram) {
+  init(TEST_QUEUE_CAPACITY, true);
+
+  for (uint32_t i = 0; i < 6; ++i) {
+    alarm_handler_alarm_info_t alarm = makeCmdAlarm(2000 - i * 100, i);
+    bool isEarliest = false;
+    ASSERT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+  }
+
+  // Alarms that already ran must not come back
+  alarm_handler_alarm_info_t alarm;
+  ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(alarm.unixTime, 1500U);
+  ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(alarm.unixTime, 1600U);
+
+  // Default alarms are not saved
+  alarm_handler_alarm_info_t defaultAlarm = {};
+  defaultAlarm.unixTime = 1;
+  defaultAlarm.type = ALARM_TYPE_DEFAULT;
+  defaultAlarm.callbackDef.defaultCallback = defaultCallback;
+  bool isEarliest = false;
+  ASSERT_EQ(alarmQueuePush(&queue, &defaultAlarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+  EXPECT_TRUE(isEarliest);
+
+  // Reset
+  memset(slots, 0xA5, sizeof(slots));
+  init(TEST_QUEUE_CAPACITY, true);
+  uint16_t numRestored = 0;
+  ASSERT_EQ(alarmQueueRestore(&queue, &numRestored), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(numRestored, 4U);
+  EXPECT_EQ(alarmQueueCount(&queue), 4U);
+
+  // A new alarm due at the same time as a restored one is queued behind it
+  alarm_handler_alarm_info_t late = makeCmdAlarm(1700, 99);
+  ASSERT_EQ(alarmQueuePush(&queue, &late, &isEarliest), OBC_ERR_CODE_SUCCESS);
+  EXPECT_FALSE(isEarliest);
+
+  const uint32_t expectedTimes[] = {1700, 1700, 1800, 1900, 2000};
+  const uint32_t expectedOrder[] = {3, 99, 2, 1, 0};
+  for (uint32_t i = 0; i < 5; ++i) {
+    ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(alarm.unixTime, expectedTimes[i]);
+    EXPECT_EQ(alarm.type, ALARM_TYPE_TIME_TAGGED_CMD);
+    EXPECT_EQ(alarm.cmdMsg.id, CMD_RTC_SYNC);
+    EXPECT_TRUE(alarm.cmdMsg.isTimeTagged);
+    EXPECT_EQ(alarm.cmdMsg.timestamp, expectedTimes[i]);
+    EXPECT_EQ(alarm.cmdMsg.rtcSync.unixTime, expectedOrder[i]);
+    if (expectedOrder[i] == 99) {
+      EXPECT_EQ(alarm.callbackDef.cmdCallback, cmdCallback);
+    } else {
+      EXPECT_EQ(alarm.callbackDef.cmdCallback, nullptr);
+    }
+  }
+
+  // Everything ran, so nothing is restored after another reset
+  init(TEST_QUEUE_CAPACITY, true);
+  ASSERT_EQ(alarmQueueRestore(&queue, &numRestored), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(numRestored, 0U);
+}
+
+TEST_F(TestAlarmQueue, RestoredSlotsAreNotReused) {
+  init(8, true);
+  for (uint32_t i = 0; i < 8; ++i) {
+    alarm_handler_alarm_info_t alarm = makeCmdAlarm(100 + i, i);
+    bool isEarliest = false;
+    ASSERT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+  }
+
+  // Free two slots in the middle of the pool
+  alarm_handler_alarm_info_t alarm;
+  ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+
+  init(8, true);
+  uint16_t numRestored = 0;
+  ASSERT_EQ(alarmQueueRestore(&queue, &numRestored), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(numRestored, 6U);
+
+  // Only the two freed slots are available, and filling them leaves the restored alarms intact
+  bool isEarliest = false;
+  for (uint32_t i = 0; i < 2; ++i) {
+    alarm = makeCmdAlarm(50 + i, 50 + i);
+    ASSERT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+  }
+  EXPECT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_QUEUE_FULL);
+
+  init(8, true);
+  ASSERT_EQ(alarmQueueRestore(&queue, &numRestored), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(numRestored, 8U);
+  const uint32_t expectedTimes[] = {50, 51, 102, 103, 104, 105, 106, 107};
+  for (uint32_t expectedTime : expectedTimes) {
+    ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(alarm.unixTime, expectedTime);
+  }
+}
+
+TEST_F(TestAlarmQueue, CorruptSectionIsSkipped) {
+  init(TEST_QUEUE_CAPACITY, true);
+  for (uint32_t i = 0; i < 3; ++i) {
+    alarm_handler_alarm_info_t alarm = makeCmdAlarm(100 + i, i);
+    bool isEarliest = false;
+    ASSERT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+  }
+
+  // Corrupt the time of the alarm in slot 1
+  uint32_t corrupt = 0xFFFF;
+  ASSERT_EQ(framWrite(OBC_PERSIST_ADDR_OF(alarmMgr[1].data), (uint8_t *)&corrupt, sizeof(corrupt)),
+            OBC_ERR_CODE_SUCCESS);
+
+  init(TEST_QUEUE_CAPACITY, true);
+  uint16_t numRestored = 0;
+  ASSERT_EQ(alarmQueueRestore(&queue, &numRestored), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(numRestored, 2U);
+
+  alarm_handler_alarm_info_t alarm;
+  ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(alarm.unixTime, 100U);
+  ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(alarm.unixTime, 102U);
+}
+
+TEST_F(TestAlarmQueue, FailedRestoreLeavesQueueEmpty) {
+  init(8, true);
+  for (uint32_t i = 0; i < 8; ++i) {
+    alarm_handler_alarm_info_t alarm = makeCmdAlarm(100 + i, i);
+    bool isEarliest = false;
+    ASSERT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+  }
+
+  // Slots are read from the highest down, so the upper ones are already queued when slot 2 cannot be read
+  init(8, true);
+  mockFramFailReadsAt(OBC_PERSIST_ADDR_OF(alarmMgr[2]));
+  uint16_t numRestored = 0;
+  EXPECT_EQ(alarmQueueRestore(&queue, &numRestored), OBC_ERR_CODE_SPI_FAILURE);
+  mockFramFailReadsAt(MOCK_FRAM_NO_FAULT);
+
+  // Every slot is free again rather than handed out while still in the heap
+  EXPECT_EQ(alarmQueueCount(&queue), 0U);
+  alarm_handler_alarm_info_t alarm;
+  EXPECT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_QUEUE_EMPTY);
+
+  bool isEarliest = false;
+  for (uint32_t i = 0; i < 8; ++i) {
+    alarm = makeCmdAlarm(200 + i, i);
+    ASSERT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_SUCCESS);
+  }
+  EXPECT_EQ(alarmQueuePush(&queue, &alarm, &isEarliest), OBC_ERR_CODE_QUEUE_FULL);
+  for (uint32_t i = 0; i < 8; ++i) {
+    ASSERT_EQ(alarmQueuePop(&queue, &alarm), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(alarm.unixTime, 200 + i);
+  }
+}
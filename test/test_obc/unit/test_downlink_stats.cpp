@@ -0,0 +1,56 @@
+#include "downlink_stats.h"
+
+#include <stdint.h>
+
+#include <gtest/gtest.h>
+
+TEST(TestDownlinkStats, NoFrames) {
+  downlink_stats_t stats;
+  downlinkStatsStart(&stats, 100);
+
+  EXPECT_EQ(stats.framesSent, 0U);
+  EXPECT_EQ(downlinkStatsDutyCyclePermille(&stats), 0U);
+  EXPECT_EQ(downlinkStatsMeanGapTicks(&stats), 0U);
+}
+
+TEST(TestDownlinkStats, BackToBackFramesAreFullDutyCycle) {
+  downlink_stats_t stats;
+  downlinkStatsStart(&stats, 0);
+
+  // The wait for the first frame is not counted
+  downlinkStatsAddFrame(&stats, 50, 80, 300);
+  downlinkStatsAddFrame(&stats, 80, 110, 300);
+  downlinkStatsAddFrame(&stats, 110, 140, 300);
+
+  EXPECT_EQ(stats.framesSent, 3U);
+  EXPECT_EQ(stats.bytesSent, 900U);
+  EXPECT_EQ(stats.busyTicks, 90U);
+  EXPECT_EQ(stats.gapTicks, 0U);
+  EXPECT_EQ(downlinkStatsDutyCyclePermille(&stats), 1000U);
+}
+
+TEST(TestDownlinkStats, GapsLowerDutyCycle) {
+  downlink_stats_t stats;
+  downlinkStatsStart(&stats, 0);
+
+  downlinkStatsAddFrame(&stats, 0, 30, 300);
+  downlinkStatsAddFrame(&stats, 40, 70, 300);   // 10 tick gap
+  downlinkStatsAddFrame(&stats, 100, 130, 300);  // 30 tick gap
+
+  EXPECT_EQ(stats.gapTicks, 40U);
+  EXPECT_EQ(stats.maxGapTicks, 30U);
+  EXPECT_EQ(downlinkStatsMeanGapTicks(&stats), 20U);
+  EXPECT_EQ(downlinkStatsDutyCyclePermille(&stats), 692U);  // 90 of 130 ticks
+}
+
+TEST(TestDownlinkStats, TickCounterWrap) {
+  downlink_stats_t stats;
+  downlinkStatsStart(&stats, UINT32_MAX - 20);
+
+  downlinkStatsAddFrame(&stats, UINT32_MAX - 10, 5, 300);
+  downlinkStatsAddFrame(&stats, 10, 26, 300);
+
+  EXPECT_EQ(stats.busyTicks, 32U);
+  EXPECT_EQ(stats.gapTicks, 5U);
+  EXPECT_EQ(downlinkStatsDutyCyclePermille(&stats), 864U);  // 32 of 37 ticks
+}
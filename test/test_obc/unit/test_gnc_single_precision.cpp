@@ -0,0 +1,190 @@
+// The generated model headers have no C++ guards
+extern "C" {
+#include "attitude_control.h"
+#include "attitude_control_single.h"
+#include "attitude_determination_and_vehi.h"
+#include "attitude_determination_and_vehi_single.h"
+#include "onboard_env_modelling.h"
+#include "onboard_env_modelling_single.h"
+}
+
+#include "mock_gnc_trace.h"
+
+#include <gtest/gtest.h>
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+#define TRACE_STEPS 6000U     // 5 minutes at 20 Hz
+#define FREE_RUN_STEPS 1200U  // 1 minute at 20 Hz
+#define ORBIT_RADIUS_M 6779e3
+
+static const uint32_t traceSeeds[] = {1, 2, 3};
+
+// Angle of the rotation between two quaternions, insensitive to their norms and signs
+static double quaternionAngle(const real_T a[4], const real32_T b[4]) {
+  double w = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+  double x = a[0] * b[1] - a[1] * b[0] - a[2] * b[3] + a[3] * b[2];
+  double y = a[0] * b[2] + a[1] * b[3] - a[2] * b[0] - a[3] * b[1];
+  double z = a[0] * b[3] - a[1] * b[2] + a[2] * b[1] - a[3] * b[0];
+  return 2.0 * atan2(sqrt(x * x + y * y + z * z), fabs(w));
+}
+
+static std::vector<mock_gnc_trace_step_t> generateTrace(uint32_t seed, uint32_t count) {
+  std::vector<mock_gnc_trace_step_t> trace(count);
+  mockGncTraceGenerate(trace.data(), count, seed);
+  return trace;
+}
+
+static void setDeterminationInputs(const mock_gnc_trace_step_t &step) {
+  for (uint32_t k = 0; k < 3; k++) {
+    attitude_determination_model_ext_inputs.earth_mag_field_ref[k] = step.magRef[k];
+    attitude_determination_model_ext_inputs.sat_to_sun_unit_ref[k] = step.sunRef[k];
+    attitude_determination_model_ext_inputs.omega[k] = step.gyro[k];
+    attitude_determination_model_ext_inputs.mes_ss[k] = step.sunMeas[k];
+    attitude_determination_model_ext_inputs.mes_mag[k] = step.magMeas[k];
+
+    attitude_determination_single_model_ext_inputs.earth_mag_field_ref[k] = step.magRef[k];
+    attitude_determination_single_model_ext_inputs.sat_to_sun_unit_ref[k] = step.sunRef[k];
+    attitude_determination_single_model_ext_inputs.omega[k] = step.gyro[k];
+    attitude_determination_single_model_ext_inputs.mes_ss[k] = step.sunMeas[k];
+    attitude_determination_single_model_ext_inputs.mes_mag[k] = step.magMeas[k];
+  }
+}
+
+TEST(TestGncSinglePrecision, OnboardEnvMatchesReference) {
+  for (uint32_t seed : traceSeeds) {
+    std::vector<mock_gnc_trace_step_t> trace = generateTrace(seed, TRACE_STEPS);
+    onboard_env_modelling_initialize();
+    onboard_env_modelling_single_initialize();
+
+    for (const mock_gnc_trace_step_t &step : trace) {
+      for (uint32_t k = 0; k < 3; k++) {
+        onboard_env_model_ext_intputs.commanded_mag_dipole_body[k] = step.commandedDipole[k];
+        onboard_env_model_ext_intputs.r_sat_com[k] = step.satPos[k];
+        onboard_env_model_ext_intputs.r_sat_com_ax1[k] = step.satPosAxis[k];
+        onboard_env_single_model_ext_inputs.commanded_mag_dipole_body[k] = step.commandedDipole[k];
+        onboard_env_single_model_ext_inputs.r_sat_com[k] = step.satPos[k];
+        onboard_env_single_model_ext_inputs.r_sat_com_ax1[k] = step.satPosAxis[k];
+      }
+      for (uint32_t k = 0; k < 2; k++) {
+        onboard_env_model_ext_intputs.steve_values[k] = step.sunUvValues[k];
+        onboard_env_single_model_ext_inputs.steve_values[k] = step.sunUvValues[k];
+      }
+
+      onboard_env_modelling_step();
+      onboard_env_modelling_single_step();
+
+      for (uint32_t k = 0; k < 3; k++) {
+        // A few single-precision roundings of the orbit radius, about 0.4 m each
+        EXPECT_NEAR(onboard_env_single_model_ext_outputs.r_ref_com_est[k],
+                    onboard_env_model_ext_outputs.r_ref_com_est[k], 1e-6 * ORBIT_RADIUS_M);
+        EXPECT_EQ(onboard_env_single_model_ext_outputs.estimated_expect_ang_acc_body[k],
+                  (real32_T)onboard_env_model_ext_outputs.estimated_expect_ang_acc_body[k]);
+      }
+    }
+  }
+}
+
+TEST(TestGncSinglePrecision, AttitudeControlMatchesReference) {
+  // 45 degrees about x
+  const double target[4] = {0.92387953, 0.38268343, 0.0, 0.0};
+
+  for (uint32_t seed : traceSeeds) {
+    std::vector<mock_gnc_trace_step_t> trace = generateTrace(seed, TRACE_STEPS);
+    attitude_control_initialize();
+    attitude_control_single_initialize();
+
+    for (const mock_gnc_trace_step_t &step : trace) {
+      for (uint32_t k = 0; k < 4; k++) {
+        attitude_control_model_ext_inputs.com_quat_body[k] = target[k];
+        attitude_control_model_ext_inputs.est_curr_quat_body[k] = step.trueQuat[k];
+        attitude_control_single_model_ext_inputs.com_quat_body[k] = target[k];
+        attitude_control_single_model_ext_inputs.est_curr_quat_body[k] = step.trueQuat[k];
+      }
+      for (uint32_t k = 0; k < 3; k++) {
+        attitude_control_model_ext_inputs.est_curr_ang_vel_body[k] = step.trueAngVel[k];
+        attitude_control_model_ext_inputs.mag_field_body[k] = step.magMeas[k];
+        attitude_control_single_model_ext_inputs.est_curr_ang_vel_body[k] = step.trueAngVel[k];
+        attitude_control_single_model_ext_inputs.mag_field_body[k] = step.magMeas[k];
+      }
+
+      attitude_control_step();
+      attitude_control_single_step();
+
+      for (uint32_t k = 0; k < 3; k++) {
+        // Torques are up to about 0.2 N m
+        EXPECT_NEAR(attitude_control_single_model_ext_outputs.comm_wheel_torque_body[k],
+                    attitude_control_model_ext_outputs.comm_wheel_torque_body[k], 1e-6);
+      }
+    }
+  }
+}
+
+TEST(TestGncSinglePrecision, AttitudeDeterminationStepMatchesReference) {
+  // Start every single-precision step from the reference state, so only the error of one step is measured
+  for (uint32_t seed : traceSeeds) {
+    std::vector<mock_gnc_trace_step_t> trace = generateTrace(seed, TRACE_STEPS);
+    attitude_determination_and_vehi_initialize();
+    attitude_determination_and_vehi_single_initialize();
+
+    for (const mock_gnc_trace_step_t &step : trace) {
+      for (uint32_t k = 0; k < 36; k++) {
+        rtDWSingle.P_o[k] = rtDW.P_o[k];
+      }
+      for (uint32_t k = 0; k < 4; k++) {
+        rtDWSingle.q_n2m[k] = rtDW.q_n2m[k];
+      }
+      for (uint32_t k = 0; k < 3; k++) {
+        rtDWSingle.beta[k] = rtDW.beta[k];
+      }
+
+      setDeterminationInputs(step);
+      attitude_determination_and_vehi_step();
+      attitude_determination_and_vehi_single_step();
+
+      EXPECT_LT(quaternionAngle(attitude_determination_model_ext_outputs.meas_quat_body,
+                                attitude_determination_single_model_ext_outputs.meas_quat_body),
+                1e-5);
+
+      double covarianceMax = 0.0;
+      double covarianceError = 0.0;
+      for (uint32_t k = 0; k < 36; k++) {
+        covarianceMax = fmax(covarianceMax, fabs(rtDW.P_o[k]));
+        covarianceError = fmax(covarianceError, fabs(rtDW.P_o[k] - rtDWSingle.P_o[k]));
+      }
+      EXPECT_LT(covarianceError, 1e-5 * covarianceMax);
+
+      for (uint32_t k = 0; k < 3; k++) {
+        EXPECT_NEAR(attitude_determination_single_model_ext_outputs.meas_ang_vel_body[k],
+                    attitude_determination_model_ext_outputs.meas_ang_vel_body[k], 1e-6);
+      }
+    }
+  }
+}
+
+TEST(TestGncSinglePrecision, AttitudeDeterminationFreeRunTracksReference) {
+  /*
+   * The filter amplifies any perturbation of its state: the reference itself, fed the same trace rounded to single
+   * precision, drifts by radians within ten minutes. A minute of free running is where the two must still agree.
+   */
+  for (uint32_t seed : traceSeeds) {
+    std::vector<mock_gnc_trace_step_t> trace = generateTrace(seed, FREE_RUN_STEPS);
+    attitude_determination_and_vehi_initialize();
+    attitude_determination_and_vehi_single_initialize();
+
+    double maxAngle = 0.0;
+    for (const mock_gnc_trace_step_t &step : trace) {
+      setDeterminationInputs(step);
+      attitude_determination_and_vehi_step();
+      attitude_determination_and_vehi_single_step();
+
+      maxAngle = fmax(maxAngle, quaternionAngle(attitude_determination_model_ext_outputs.meas_quat_body,
+                                                attitude_determination_single_model_ext_outputs.meas_quat_body));
+    }
+
+    // 0.3 degrees
+    EXPECT_LT(maxAngle, 5e-3) << "seed " << seed;
+  }
+}
@@ -0,0 +1,92 @@
+#include "gnc_timing_stats.h"
+
+#include <stdint.h>
+
+#include <gtest/gtest.h>
+
+#define PERIOD_COUNTS 2500U
+
+TEST(TestGncTimingStats, OnTimeWakeUps) {
+  gnc_timing_schedule_t schedule;
+  gncTimingScheduleInit(&schedule, PERIOD_COUNTS);
+
+  EXPECT_EQ(gncTimingScheduleWake(&schedule, 1000), 0U);
+  EXPECT_EQ(gncTimingScheduleWake(&schedule, 3500), 0U);
+  EXPECT_EQ(gncTimingScheduleWake(&schedule, 6000), 0U);
+}
+
+TEST(TestGncTimingStats, LateWakeUpDoesNotShiftSchedule) {
+  gnc_timing_schedule_t schedule;
+  gncTimingScheduleInit(&schedule, PERIOD_COUNTS);
+
+  gncTimingScheduleWake(&schedule, 0);
+  EXPECT_EQ(gncTimingScheduleWake(&schedule, 2600), 100U);
+  EXPECT_EQ(gncTimingScheduleWake(&schedule, 5000), 0U);
+
+  // Preempted for longer than a period; the delayed wake-ups then come back to back
+  EXPECT_EQ(gncTimingScheduleWake(&schedule, 10200), 2700U);
+  EXPECT_EQ(gncTimingScheduleWake(&schedule, 10300), 300U);
+  EXPECT_EQ(gncTimingScheduleWake(&schedule, 12500), 0U);
+}
+
+TEST(TestGncTimingStats, SlowCounterKeepsLatencyBounded) {
+  gnc_timing_schedule_t schedule;
+  gncTimingScheduleInit(&schedule, PERIOD_COUNTS);
+
+  // The counter advances 2499.4 counts per period
+  for (uint32_t i = 0; i < 100000; i++) {
+    EXPECT_LE(gncTimingScheduleWake(&schedule, (uint32_t)(i * 2499.4)), 1U);
+  }
+}
+
+TEST(TestGncTimingStats, CounterWrap) {
+  gnc_timing_schedule_t schedule;
+  gncTimingScheduleInit(&schedule, PERIOD_COUNTS);
+
+  gncTimingScheduleWake(&schedule, UINT32_MAX - 1000);
+  EXPECT_EQ(gncTimingScheduleWake(&schedule, 1549), 50U);
+  EXPECT_FALSE(gncTimingScheduleMissed(&schedule, 3999));
+  EXPECT_TRUE(gncTimingScheduleMissed(&schedule, 4000));
+}
+
+TEST(TestGncTimingStats, DeadlineIsTheNextPeriod) {
+  gnc_timing_schedule_t schedule;
+  gncTimingScheduleInit(&schedule, PERIOD_COUNTS);
+
+  gncTimingScheduleWake(&schedule, 0);
+  gncTimingScheduleWake(&schedule, 2700);
+
+  EXPECT_FALSE(gncTimingScheduleMissed(&schedule, 5000));
+  EXPECT_TRUE(gncTimingScheduleMissed(&schedule, 5001));
+}
+
+TEST(TestGncTimingStats, HistogramBins) {
+  // 20 us per count; bins end at 100 us, 200 us, 500 us, 1 ms, 2 ms, 5 ms and 10 ms
+  EXPECT_EQ(gncTimingHistBin(0), 0U);
+  EXPECT_EQ(gncTimingHistBin(4), 0U);
+  EXPECT_EQ(gncTimingHistBin(5), 1U);
+  EXPECT_EQ(gncTimingHistBin(24), 2U);
+  EXPECT_EQ(gncTimingHistBin(50), 4U);
+  EXPECT_EQ(gncTimingHistBin(499), 6U);
+  EXPECT_EQ(gncTimingHistBin(500), 7U);
+  EXPECT_EQ(gncTimingHistBin(UINT32_MAX), GNC_TIMING_HIST_NUM_BINS - 1);
+}
+
+TEST(TestGncTimingStats, AddCycles) {
+  gnc_timing_stats_t stats = {0};
+
+  gncTimingStatsAddCycle(&stats, 1, 60, false);
+  gncTimingStatsAddCycle(&stats, 30, 80, false);
+  gncTimingStatsAddCycle(&stats, 2500, 120, true);
+
+  EXPECT_EQ(stats.cycles, 3U);
+  EXPECT_EQ(stats.deadlineMisses, 1U);
+  EXPECT_EQ(stats.maxStartLatency, 2500U);
+  EXPECT_EQ(stats.maxExecTime, 120U);
+
+  EXPECT_EQ(stats.startLatencyHist[0], 1U);
+  EXPECT_EQ(stats.startLatencyHist[3], 1U);
+  EXPECT_EQ(stats.startLatencyHist[7], 1U);
+  EXPECT_EQ(stats.execTimeHist[4], 2U);
+  EXPECT_EQ(stats.execTimeHist[5], 1U);
+}
@@ -0,0 +1,203 @@
+#include "jpeg_stream.h"
+#include "obc_errors.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+#define TEST_BLOCK_SIZE 512U
+
+// Stands in for the camera's SPI bus: each transfer clocks the next bytes of a recorded FIFO into 16 bit DMA frames
+class MockCamSpi {
+ public:
+  explicit MockCamSpi(const std::vector<uint8_t> &fifo) : fifo(fifo) {}
+
+  size_t transfer(uint16_t *rx, size_t numFrames) {
+    size_t n = std::min(numFrames, fifo.size() - pos);
+    for (size_t i = 0; i < n; ++i) {
+      // The upper half of a frame is not part of the data
+      rx[i] = (uint16_t)(0xA500U | fifo[pos++]);
+    }
+    return n;
+  }
+
+  size_t framesRead() const { return pos; }
+
+ private:
+  std::vector<uint8_t> fifo;
+  size_t pos = 0;
+};
+
+struct CapturedFile {
+  std::vector<uint8_t> data;
+  std::vector<size_t> writes;
+  obc_error_code_t failWith = OBC_ERR_CODE_SUCCESS;
+};
+
+static obc_error_code_t captureWrite(const uint8_t *data, size_t len, void *ctx) {
+  CapturedFile *file = (CapturedFile *)ctx;
+  if (file->failWith != OBC_ERR_CODE_SUCCESS) {
+    return file->failWith;
+  }
+  file->data.insert(file->data.end(), data, data + len);
+  file->writes.push_back(len);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+// A JPEG laid out like the OV5642's output: JFIF header, byte stuffed entropy data and an end of image marker
+static std::vector<uint8_t> makeJpeg(size_t scanLen) {
+  std::vector<uint8_t> jpeg = {0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 'J',  'F',  'I',  'F', 0x00,
+                               0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xDA};
+  uint32_t seed = 0x5EED;
+  for (size_t i = 0; i < scanLen; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    uint8_t byte = (uint8_t)(seed >> 16);
+    jpeg.push_back(byte);
+    if (byte == 0xFF) {
+      jpeg.push_back(0x00);
+    }
+  }
+  jpeg.push_back(0xFF);
+  jpeg.push_back(0xD9);
+  return jpeg;
+}
+
+// A FIFO dump: a dummy byte and idle bytes before the image, then padding and a stale marker after it
+static std::vector<uint8_t> makeFifo(const std::vector<uint8_t> &jpeg, size_t leading) {
+  std::vector<uint8_t> fifo(leading, 0xFF);
+  fifo[0] = 0x00;
+  fifo.insert(fifo.end(), jpeg.begin(), jpeg.end());
+  fifo.insert(fifo.end(), {0x00, 0x00, 0xFF, 0xD8, 0x12, 0x34});
+  fifo.resize(fifo.size() + 300, 0x00);
+  return fifo;
+}
+
+// Reads the FIFO in chunks the way readFifoBurst does, stopping at the end of image
+static obc_error_code_t readOut(MockCamSpi &spi, size_t fifoLen, size_t chunkFrames, CapturedFile &file) {
+  obc_error_code_t errCode;
+  uint8_t block[TEST_BLOCK_SIZE];
+  jpeg_stream_t stream;
+  errCode = jpegStreamInit(&stream, block, sizeof(block), captureWrite, &file);
+  if (errCode != OBC_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  std::vector<uint16_t> chunk(chunkFrames);
+  size_t remaining = fifoLen;
+  bool done = false;
+  while (remaining > 0 && !done) {
+    size_t n = spi.transfer(chunk.data(), std::min(remaining, chunkFrames));
+    remaining -= n;
+    errCode = jpegStreamFeed(&stream, chunk.data(), n, &done);
+    if (errCode != OBC_ERR_CODE_SUCCESS) {
+      return errCode;
+    }
+  }
+
+  return jpegStreamFinish(&stream);
+}
+
+static void expectAlignedWrites(const CapturedFile &file) {
+  ASSERT_FALSE(file.writes.empty());
+  for (size_t i = 0; i + 1 < file.writes.size(); ++i) {
+    EXPECT_EQ(file.writes[i], TEST_BLOCK_SIZE);
+  }
+  EXPECT_GT(file.writes.back(), 0U);
+  EXPECT_LE(file.writes.back(), TEST_BLOCK_SIZE);
+}
+
+TEST(TestJpegStream, InitRejectsInvalidArgs) {
+  jpeg_stream_t stream;
+  uint8_t block[TEST_BLOCK_SIZE];
+  CapturedFile file;
+  bool done = false;
+
+  EXPECT_EQ(jpegStreamInit(nullptr, block, sizeof(block), captureWrite, &file), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(jpegStreamInit(&stream, nullptr, sizeof(block), captureWrite, &file), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(jpegStreamInit(&stream, block, 0, captureWrite, &file), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(jpegStreamInit(&stream, block, sizeof(block), nullptr, &file), OBC_ERR_CODE_INVALID_ARG);
+  ASSERT_EQ(jpegStreamInit(&stream, block, sizeof(block), captureWrite, &file), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(jpegStreamFeed(&stream, nullptr, 1, &done), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(jpegStreamFeed(&stream, nullptr, 0, nullptr), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(jpegStreamFinish(nullptr), OBC_ERR_CODE_INVALID_ARG);
+}
+
+TEST(TestJpegStream, ExtractsImageForAnyChunkSize) {
+  const std::vector<uint8_t> jpeg = makeJpeg(20000);
+  const std::vector<uint8_t> fifo = makeFifo(jpeg, 9);
+
+  for (size_t chunkFrames : {1U, 7U, 64U, 511U, 512U, 513U, 4096U, 100000U}) {
+    SCOPED_TRACE(chunkFrames);
+    MockCamSpi spi(fifo);
+    CapturedFile file;
+
+    ASSERT_EQ(readOut(spi, fifo.size(), chunkFrames, file), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(file.data, jpeg);
+    EXPECT_EQ(file.writes.size(), (jpeg.size() + TEST_BLOCK_SIZE - 1) / TEST_BLOCK_SIZE);
+    expectAlignedWrites(file);
+
+    // Reading stops with the chunk holding the end of image, not at the end of the FIFO
+    size_t eoiEnd = 9 + jpeg.size();
+    EXPECT_LT(spi.framesRead() - eoiEnd, chunkFrames);
+  }
+}
+
+TEST(TestJpegStream, MarkersSplitAcrossChunks) {
+  const std::vector<uint8_t> jpeg = makeJpeg(3000);
+  // With 4 leading bytes and 5 frame chunks the start of image marker straddles the first two chunks
+  const std::vector<uint8_t> fifo = makeFifo(jpeg, 4);
+  ASSERT_EQ(fifo[4], 0xFF);
+  ASSERT_EQ(fifo[5], 0xD8);
+
+  for (size_t chunkFrames = 2; chunkFrames < 12; ++chunkFrames) {
+    SCOPED_TRACE(chunkFrames);
+    MockCamSpi spi(fifo);
+    CapturedFile file;
+    ASSERT_EQ(readOut(spi, fifo.size(), chunkFrames, file), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(file.data, jpeg);
+  }
+}
+
+TEST(TestJpegStream, ImageExactlyFillsBlocks) {
+  // 22 header bytes + 2 end bytes + scan data without any 0xFF stuffing bytes added
+  std::vector<uint8_t> jpeg = makeJpeg(0);
+  jpeg.insert(jpeg.end() - 2, 2 * TEST_BLOCK_SIZE - jpeg.size(), 0x11);
+  const std::vector<uint8_t> fifo = makeFifo(jpeg, 1);
+
+  MockCamSpi spi(fifo);
+  CapturedFile file;
+  ASSERT_EQ(readOut(spi, fifo.size(), TEST_BLOCK_SIZE, file), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(file.data, jpeg);
+  EXPECT_EQ(file.writes, std::vector<size_t>({TEST_BLOCK_SIZE, TEST_BLOCK_SIZE}));
+}
+
+TEST(TestJpegStream, IncompleteImages) {
+  // No end of image: what was found is still written, but the readout fails
+  std::vector<uint8_t> truncated = makeJpeg(2000);
+  truncated.resize(truncated.size() - 1);
+  MockCamSpi truncatedSpi(truncated);
+  CapturedFile truncatedFile;
+  EXPECT_EQ(readOut(truncatedSpi, truncated.size(), 256, truncatedFile), OBC_ERR_CODE_JPEG_INCOMPLETE);
+  EXPECT_EQ(truncatedFile.data, truncated);
+
+  // No start of image: nothing is written
+  std::vector<uint8_t> noise(5000, 0xFF);
+  noise.back() = 0xD9;
+  MockCamSpi noiseSpi(noise);
+  CapturedFile noiseFile;
+  EXPECT_EQ(readOut(noiseSpi, noise.size(), 512, noiseFile), OBC_ERR_CODE_JPEG_INCOMPLETE);
+  EXPECT_TRUE(noiseFile.writes.empty());
+}
+
+TEST(TestJpegStream, WriteErrorStopsReadout) {
+  const std::vector<uint8_t> jpeg = makeJpeg(5000);
+  const std::vector<uint8_t> fifo = makeFifo(jpeg, 3);
+  MockCamSpi spi(fifo);
+  CapturedFile file;
+  file.failWith = OBC_ERR_CODE_RED_ENOSPC;
+
+  EXPECT_EQ(readOut(spi, fifo.size(), 512, file), OBC_ERR_CODE_RED_ENOSPC);
+  EXPECT_LE(spi.framesRead(), 2U * TEST_BLOCK_SIZE);
+}
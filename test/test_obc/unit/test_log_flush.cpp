@@ -0,0 +1,110 @@
+#include "log_flush.h"
+#include "log_record.h"
+#include "obc_byte_ring.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include "mock_redposix.h"
+
+#include <gtest/gtest.h>
+
+#define TEST_RING_SIZE 256U
+#define TEST_BLOCK_SIZE 64U
+#define TEST_FD 3
+
+static void bufferRecord(obc_byte_ring_t *ring, uint32_t index) {
+  log_record_t record = {.logType = LOG_TYPE_ERROR_CODE,
+                         .logLevel = LOG_ERROR,
+                         .line = (uint16_t)index,
+                         .fileId = logHashString("obc/app/modules/logger/logger.c"),
+                         .arg = index,
+                         .timestamp = 1700000000 + index};
+  uint8_t packed[LOG_RECORD_SIZE];
+  ASSERT_EQ(logRecordPack(&record, packed), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(byteRingWrite(ring, packed, LOG_RECORD_SIZE), LOG_RECORD_SIZE);
+}
+
+TEST(TestLogFlush, WritesWholeBlocks) {
+  uint8_t buffer[TEST_RING_SIZE];
+  obc_byte_ring_t ring;
+  ASSERT_EQ(byteRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+  mockRedReset(MOCK_RED_MAX_FILE_SIZE);
+
+  for (uint32_t i = 0; i < 10; i++) {
+    bufferRecord(&ring, i);
+  }
+
+  // 160 bytes: two blocks go out and the rest waits for a full block
+  uint32_t numWrites = 0;
+  EXPECT_EQ(logFlushRing(&ring, TEST_FD, TEST_BLOCK_SIZE, TEST_BLOCK_SIZE, &numWrites), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(numWrites, 2U);
+  EXPECT_EQ(byteRingBytesUsed(&ring), 32U);
+
+  EXPECT_EQ(logFlushRing(&ring, TEST_FD, 1, TEST_BLOCK_SIZE, &numWrites), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(numWrites, 3U);
+  EXPECT_EQ(byteRingBytesUsed(&ring), 0U);
+
+  uint32_t fileLen = 0;
+  mockRedFileData(&fileLen);
+  EXPECT_EQ(fileLen, 10U * LOG_RECORD_SIZE);
+}
+
+TEST(TestLogFlush, ShortWriteKeepsRecordsAligned) {
+  uint8_t buffer[TEST_RING_SIZE];
+  obc_byte_ring_t ring;
+  ASSERT_EQ(byteRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+
+  // Room for a block and a half, so the second write is cut off in the middle of a record
+  mockRedReset(TEST_BLOCK_SIZE + TEST_BLOCK_SIZE / 2 + 4);
+
+  const uint32_t numRecords = 40;
+  uint32_t buffered = 0;
+  uint32_t numWrites = 0;
+  for (; buffered < 12; buffered++) {
+    bufferRecord(&ring, buffered);
+  }
+  EXPECT_EQ(logFlushRing(&ring, TEST_FD, TEST_BLOCK_SIZE, TEST_BLOCK_SIZE, &numWrites), OBC_ERR_CODE_FAILED_FILE_WRITE);
+  EXPECT_EQ(numWrites, 1U);
+
+  // The bytes the short write took are gone from the ring
+  uint32_t fileLen = 0;
+  mockRedFileData(&fileLen);
+  EXPECT_EQ(fileLen, TEST_BLOCK_SIZE + TEST_BLOCK_SIZE / 2 + 4);
+  EXPECT_EQ(byteRingBytesUsed(&ring), 12U * LOG_RECORD_SIZE - fileLen);
+
+  // With the volume full, writes fail without taking anything
+  EXPECT_EQ(logFlushRing(&ring, TEST_FD, TEST_BLOCK_SIZE, TEST_BLOCK_SIZE, &numWrites), OBC_ERR_CODE_FAILED_FILE_WRITE);
+  EXPECT_EQ(byteRingBytesUsed(&ring), 12U * LOG_RECORD_SIZE - fileLen);
+
+  // Room again; the ring wraps while the rest of the records go out
+  mockRedSetCapacity(MOCK_RED_MAX_FILE_SIZE);
+  for (; buffered < numRecords; buffered++) {
+    if (TEST_RING_SIZE - byteRingBytesUsed(&ring) < LOG_RECORD_SIZE) {
+      ASSERT_EQ(logFlushRing(&ring, TEST_FD, TEST_BLOCK_SIZE, TEST_BLOCK_SIZE, &numWrites), OBC_ERR_CODE_SUCCESS);
+    }
+    bufferRecord(&ring, buffered);
+  }
+  ASSERT_EQ(logFlushRing(&ring, TEST_FD, 1, TEST_BLOCK_SIZE, &numWrites), OBC_ERR_CODE_SUCCESS);
+
+  // Every record is in the file once, in order, on a record boundary
+  const uint8_t *file = mockRedFileData(&fileLen);
+  ASSERT_EQ(fileLen, numRecords * LOG_RECORD_SIZE);
+  for (uint32_t i = 0; i < numRecords; i++) {
+    log_record_t record = {0};
+    ASSERT_EQ(logRecordUnpack(file + i * LOG_RECORD_SIZE, &record), OBC_ERR_CODE_SUCCESS) << "record " << i;
+    EXPECT_EQ(record.arg, i);
+    EXPECT_EQ(record.timestamp, 1700000000U + i);
+  }
+}
+
+TEST(TestLogFlush, RejectsBadArgs) {
+  uint8_t buffer[TEST_RING_SIZE];
+  obc_byte_ring_t ring;
+  ASSERT_EQ(byteRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+  uint32_t numWrites = 0;
+
+  EXPECT_EQ(logFlushRing(NULL, TEST_FD, 1, TEST_BLOCK_SIZE, &numWrites), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(logFlushRing(&ring, TEST_FD, 1, TEST_BLOCK_SIZE, NULL), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(logFlushRing(&ring, TEST_FD, 0, TEST_BLOCK_SIZE, &numWrites), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(logFlushRing(&ring, TEST_FD, 1, 0, &numWrites), OBC_ERR_CODE_INVALID_ARG);
+}
@@ -0,0 +1,91 @@
+#include "log_record.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+TEST(TestLogRecord, HashString) {
+  // Reference values of 32-bit FNV-1a
+  EXPECT_EQ(logHashString(""), 0x811C9DC5U);
+  EXPECT_EQ(logHashString("a"), 0xE40C292CU);
+  EXPECT_EQ(logHashString("foobar"), 0xBF9CF968U);
+  EXPECT_EQ(logHashString(NULL), 0U);
+}
+
+TEST(TestLogRecord, PackUnpack) {
+  log_record_t record = {.logType = LOG_TYPE_MSG,
+                         .logLevel = LOG_WARN,
+                         .line = 1234,
+                         .fileId = logHashString("obc/app/modules/logger/logger.c"),
+                         .arg = logHashString("Hello"),
+                         .timestamp = 1700000000};
+
+  uint8_t packed[LOG_RECORD_SIZE];
+  ASSERT_EQ(logRecordPack(&record, packed), OBC_ERR_CODE_SUCCESS);
+
+  const uint8_t expectedHeader[] = {LOG_RECORD_SYNC, (LOG_TYPE_MSG << 3) | LOG_WARN, 0x04, 0xD2};
+  EXPECT_EQ(memcmp(packed, expectedHeader, sizeof(expectedHeader)), 0);
+  const uint8_t expectedTimestamp[] = {0x65, 0x53, 0xF1, 0x00};
+  EXPECT_EQ(memcmp(&packed[12], expectedTimestamp, sizeof(expectedTimestamp)), 0);
+
+  log_record_t unpacked = {0};
+  ASSERT_EQ(logRecordUnpack(packed, &unpacked), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(unpacked.logType, record.logType);
+  EXPECT_EQ(unpacked.logLevel, record.logLevel);
+  EXPECT_EQ(unpacked.line, record.line);
+  EXPECT_EQ(unpacked.fileId, record.fileId);
+  EXPECT_EQ(unpacked.arg, record.arg);
+  EXPECT_EQ(unpacked.timestamp, record.timestamp);
+}
+
+TEST(TestLogRecord, UnpackRejectsBadRecords) {
+  log_record_t record = {.logType = LOG_TYPE_ERROR_CODE, .logLevel = LOG_ERROR, .line = 1, .arg = 5};
+  uint8_t packed[LOG_RECORD_SIZE];
+  ASSERT_EQ(logRecordPack(&record, packed), OBC_ERR_CODE_SUCCESS);
+
+  log_record_t unpacked = {0};
+  uint8_t corrupted[LOG_RECORD_SIZE];
+
+  memcpy(corrupted, packed, sizeof(corrupted));
+  corrupted[0] ^= 0xFF;
+  EXPECT_EQ(logRecordUnpack(corrupted, &unpacked), OBC_ERR_CODE_FAILED_UNPACK);
+
+  // Level past LOG_FATAL
+  memcpy(corrupted, packed, sizeof(corrupted));
+  corrupted[1] = LOG_OFF;
+  EXPECT_EQ(logRecordUnpack(corrupted, &unpacked), OBC_ERR_CODE_FAILED_UNPACK);
+
+  // Unknown log type
+  memcpy(corrupted, packed, sizeof(corrupted));
+  corrupted[1] = 0x10;
+  EXPECT_EQ(logRecordUnpack(corrupted, &unpacked), OBC_ERR_CODE_FAILED_UNPACK);
+
+  record.logLevel = LOG_OFF;
+  EXPECT_EQ(logRecordPack(&record, packed), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(logRecordPack(NULL, packed), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(logRecordUnpack(NULL, &unpacked), OBC_ERR_CODE_INVALID_ARG);
+}
+
+TEST(TestLogRecord, Format) {
+  log_record_t record = {.logType = LOG_TYPE_ERROR_CODE,
+                         .logLevel = LOG_ERROR,
+                         .line = 42,
+                         .fileId = 0xDEADBEEF,
+                         .arg = OBC_ERR_CODE_FAILED_FILE_WRITE,
+                         .timestamp = 10};
+
+  char line[96];
+  uint32_t lineLen = 0;
+  ASSERT_EQ(logRecordFormat(&record, line, sizeof(line), &lineLen), OBC_ERR_CODE_SUCCESS);
+  EXPECT_STREQ(line, "10 ERROR -> file#deadbeef:42 - 703\r\n");
+  EXPECT_EQ(lineLen, strlen(line));
+
+  record.logType = LOG_TYPE_MSG;
+  record.logLevel = LOG_INFO;
+  record.arg = 0x1234;
+  ASSERT_EQ(logRecordFormat(&record, line, sizeof(line), &lineLen), OBC_ERR_CODE_SUCCESS);
+  EXPECT_STREQ(line, "10 INFO  -> file#deadbeef:42 - msg#00001234\r\n");
+
+  EXPECT_EQ(logRecordFormat(&record, line, 8, &lineLen), OBC_ERR_CODE_BUFF_TOO_SMALL);
+}
@@ -0,0 +1,103 @@
+#include "obc_byte_ring.h"
+#include "obc_errors.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#define TEST_RING_SIZE 16U
+
+TEST(TestObcByteRing, InitRejectsInvalidSize) {
+  obc_byte_ring_t ring;
+  uint8_t buffer[TEST_RING_SIZE];
+
+  EXPECT_EQ(byteRingInit(nullptr, buffer, sizeof(buffer)), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(byteRingInit(&ring, nullptr, sizeof(buffer)), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(byteRingInit(&ring, buffer, 0), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(byteRingInit(&ring, buffer, 12), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(byteRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(byteRingBytesUsed(&ring), 0U);
+}
+
+TEST(TestObcByteRing, WriteStopsWhenFull) {
+  obc_byte_ring_t ring;
+  uint8_t buffer[TEST_RING_SIZE];
+  ASSERT_EQ(byteRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+
+  uint8_t data[TEST_RING_SIZE + 4];
+  for (uint32_t i = 0; i < sizeof(data); ++i) {
+    data[i] = (uint8_t)i;
+  }
+
+  EXPECT_EQ(byteRingWrite(&ring, data, sizeof(data)), TEST_RING_SIZE);
+  EXPECT_EQ(byteRingBytesUsed(&ring), TEST_RING_SIZE);
+  EXPECT_EQ(byteRingWrite(&ring, data, 1), 0U);
+
+  const uint8_t *span = nullptr;
+  ASSERT_EQ(byteRingPeekContiguous(&ring, &span), TEST_RING_SIZE);
+  EXPECT_EQ(memcmp(span, data, TEST_RING_SIZE), 0);
+
+  byteRingConsume(&ring, 4);
+  EXPECT_EQ(byteRingWrite(&ring, data, sizeof(data)), 4U);
+}
+
+TEST(TestObcByteRing, PeekSplitsAtWrap) {
+  obc_byte_ring_t ring;
+  uint8_t buffer[TEST_RING_SIZE];
+  ASSERT_EQ(byteRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+
+  // Move the indices near the end of the buffer
+  uint8_t filler[12] = {0};
+  ASSERT_EQ(byteRingWrite(&ring, filler, sizeof(filler)), sizeof(filler));
+  byteRingConsume(&ring, sizeof(filler));
+
+  const uint8_t data[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  ASSERT_EQ(byteRingWrite(&ring, data, sizeof(data)), sizeof(data));
+
+  const uint8_t *span = nullptr;
+  ASSERT_EQ(byteRingPeekContiguous(&ring, &span), 4U);
+  EXPECT_EQ(span, buffer + 12);
+  EXPECT_EQ(memcmp(span, data, 4), 0);
+  byteRingConsume(&ring, 4);
+
+  ASSERT_EQ(byteRingPeekContiguous(&ring, &span), 6U);
+  EXPECT_EQ(span, buffer);
+  EXPECT_EQ(memcmp(span, data + 4, 6), 0);
+  byteRingConsume(&ring, 6);
+
+  EXPECT_EQ(byteRingPeekContiguous(&ring, &span), 0U);
+}
+
+TEST(TestObcByteRing, StreamsDataInOrder) {
+  obc_byte_ring_t ring;
+  uint8_t buffer[TEST_RING_SIZE];
+  ASSERT_EQ(byteRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+
+  std::vector<uint8_t> input(1000);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = (uint8_t)(i * 7);
+  }
+
+  std::vector<uint8_t> output;
+  size_t written = 0;
+  uint32_t step = 0;
+  while (output.size() < input.size()) {
+    // Vary the chunk sizes so writes and reads land at every offset
+    uint32_t writeLen = (step % 7) + 1;
+    if (writeLen > input.size() - written) {
+      writeLen = input.size() - written;
+    }
+    written += byteRingWrite(&ring, input.data() + written, writeLen);
+
+    const uint8_t *span = nullptr;
+    uint32_t spanLen = byteRingPeekContiguous(&ring, &span);
+    uint32_t readLen = (spanLen < (step % 5) + 1) ? spanLen : (step % 5) + 1;
+    output.insert(output.end(), span, span + readLen);
+    byteRingConsume(&ring, readLen);
+    ++step;
+  }
+
+  EXPECT_EQ(output, input);
+}
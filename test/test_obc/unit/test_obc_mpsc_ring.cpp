@@ -0,0 +1,168 @@
+#include "obc_mpsc_ring.h"
+#include "obc_errors.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#define TEST_RING_SIZE 64U
+
+TEST(TestObcMpscRing, InitRejectsInvalidArgs) {
+  obc_mpsc_ring_t ring;
+  alignas(4) uint8_t buffer[TEST_RING_SIZE + 4];
+
+  EXPECT_EQ(mpscRingInit(nullptr, buffer, TEST_RING_SIZE), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(mpscRingInit(&ring, nullptr, TEST_RING_SIZE), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(mpscRingInit(&ring, buffer + 1, TEST_RING_SIZE), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(mpscRingInit(&ring, buffer, 8), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(mpscRingInit(&ring, buffer, 48), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(mpscRingInit(&ring, buffer, TEST_RING_SIZE), OBC_ERR_CODE_SUCCESS);
+}
+
+TEST(TestObcMpscRing, PushPopTwoParts) {
+  obc_mpsc_ring_t ring;
+  alignas(4) uint8_t buffer[TEST_RING_SIZE];
+  ASSERT_EQ(mpscRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+
+  const uint32_t fixed = 0x11223344;
+  const char text[] = "hello";
+  ASSERT_EQ(mpscRingPush(&ring, &fixed, sizeof(fixed), text, 5), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(mpscRingPush(&ring, &fixed, sizeof(fixed), nullptr, 0), OBC_ERR_CODE_SUCCESS);
+
+  uint8_t entry[16];
+  uint32_t entryLen = 0;
+  ASSERT_EQ(mpscRingPop(&ring, entry, sizeof(entry), &entryLen), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(entryLen, 9U);
+  EXPECT_EQ(memcmp(entry, &fixed, sizeof(fixed)), 0);
+  EXPECT_EQ(memcmp(entry + 4, text, 5), 0);
+
+  ASSERT_EQ(mpscRingPop(&ring, entry, sizeof(entry), &entryLen), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(entryLen, 4U);
+
+  EXPECT_EQ(mpscRingPop(&ring, entry, sizeof(entry), &entryLen), OBC_ERR_CODE_QUEUE_EMPTY);
+}
+
+TEST(TestObcMpscRing, FullRingDropsAndCounts) {
+  obc_mpsc_ring_t ring;
+  alignas(4) uint8_t buffer[TEST_RING_SIZE];
+  ASSERT_EQ(mpscRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+
+  // 12 byte entries take 16 bytes with their header
+  const uint8_t data[12] = {0};
+  for (uint32_t i = 0; i < TEST_RING_SIZE / 16; ++i) {
+    ASSERT_EQ(mpscRingPush(&ring, data, sizeof(data), nullptr, 0), OBC_ERR_CODE_SUCCESS);
+  }
+  EXPECT_EQ(mpscRingPush(&ring, data, sizeof(data), nullptr, 0), OBC_ERR_CODE_QUEUE_FULL);
+  EXPECT_EQ(mpscRingPush(&ring, data, 4, nullptr, 0), OBC_ERR_CODE_QUEUE_FULL);
+  EXPECT_EQ(mpscRingDropped(&ring), 2U);
+  EXPECT_EQ(mpscRingHighWater(&ring), TEST_RING_SIZE);
+
+  uint8_t entry[16];
+  uint32_t entryLen = 0;
+  ASSERT_EQ(mpscRingPop(&ring, entry, sizeof(entry), &entryLen), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(mpscRingPush(&ring, data, sizeof(data), nullptr, 0), OBC_ERR_CODE_SUCCESS);
+
+  // Entries over a quarter of the ring are never accepted
+  uint8_t large[TEST_RING_SIZE / 4] = {0};
+  EXPECT_EQ(mpscRingPush(&ring, large, sizeof(large), nullptr, 0), OBC_ERR_CODE_INVALID_ARG);
+}
+
+TEST(TestObcMpscRing, EntriesWrapBehindPadding) {
+  obc_mpsc_ring_t ring;
+  alignas(4) uint8_t buffer[TEST_RING_SIZE];
+  ASSERT_EQ(mpscRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+
+  uint8_t entry[16];
+  uint32_t entryLen = 0;
+  uint8_t data[12];
+
+  // Entries of 8 bytes move the reservation 12 bytes at a time, so 12 byte entries hit the end of the buffer
+  for (uint32_t round = 0; round < 50; ++round) {
+    uint32_t len = (round % 2 == 0) ? 8U : 12U;
+    memset(data, (int)round, sizeof(data));
+    ASSERT_EQ(mpscRingPush(&ring, data, len, nullptr, 0), OBC_ERR_CODE_SUCCESS);
+    ASSERT_EQ(mpscRingPop(&ring, entry, sizeof(entry), &entryLen), OBC_ERR_CODE_SUCCESS);
+    ASSERT_EQ(entryLen, len);
+    EXPECT_EQ(memcmp(entry, data, len), 0);
+  }
+
+  EXPECT_EQ(mpscRingPop(&ring, entry, sizeof(entry), &entryLen), OBC_ERR_CODE_QUEUE_EMPTY);
+  EXPECT_EQ(mpscRingDropped(&ring), 0U);
+}
+
+TEST(TestObcMpscRing, PopIntoSmallBufferDiscardsEntry) {
+  obc_mpsc_ring_t ring;
+  alignas(4) uint8_t buffer[TEST_RING_SIZE];
+  ASSERT_EQ(mpscRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+
+  const uint8_t data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  ASSERT_EQ(mpscRingPush(&ring, data, sizeof(data), nullptr, 0), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(mpscRingPush(&ring, data, 2, nullptr, 0), OBC_ERR_CODE_SUCCESS);
+
+  uint8_t entry[4];
+  uint32_t entryLen = 0;
+  EXPECT_EQ(mpscRingPop(&ring, entry, sizeof(entry), &entryLen), OBC_ERR_CODE_BUFF_TOO_SMALL);
+  ASSERT_EQ(mpscRingPop(&ring, entry, sizeof(entry), &entryLen), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(entryLen, 2U);
+}
+
+TEST(TestObcMpscRing, ConcurrentProducersKeepTheirOrder) {
+  const uint32_t numProducers = 4;
+  const uint32_t entriesPerProducer = 20000;
+
+  obc_mpsc_ring_t ring;
+  alignas(4) static uint8_t buffer[1024];
+  ASSERT_EQ(mpscRingInit(&ring, buffer, sizeof(buffer)), OBC_ERR_CODE_SUCCESS);
+
+  std::vector<std::thread> producers;
+  for (uint32_t p = 0; p < numProducers; ++p) {
+    producers.emplace_back([&ring, p, entriesPerProducer]() {
+      for (uint32_t seq = 0; seq < entriesPerProducer; ++seq) {
+        // Variable length entries, with the length recoverable from the sequence number
+        uint32_t fixed[2] = {p, seq};
+        uint8_t payload[20];
+        memset(payload, (int)(seq & 0xFF), sizeof(payload));
+        while (mpscRingPush(&ring, fixed, sizeof(fixed), payload, seq % sizeof(payload)) != OBC_ERR_CODE_SUCCESS) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::vector<uint32_t> nextSeq(numProducers, 0);
+  uint32_t received = 0;
+  while (received < numProducers * entriesPerProducer) {
+    uint8_t entry[32];
+    uint32_t entryLen = 0;
+    obc_error_code_t errCode = mpscRingPop(&ring, entry, sizeof(entry), &entryLen);
+    if (errCode == OBC_ERR_CODE_QUEUE_EMPTY) {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(errCode, OBC_ERR_CODE_SUCCESS);
+
+    uint32_t fixed[2];
+    memcpy(fixed, entry, sizeof(fixed));
+    ASSERT_LT(fixed[0], numProducers);
+    ASSERT_EQ(fixed[1], nextSeq[fixed[0]]);
+    ASSERT_EQ(entryLen, sizeof(fixed) + fixed[1] % 20);
+    for (uint32_t i = sizeof(fixed); i < entryLen; ++i) {
+      ASSERT_EQ(entry[i], (uint8_t)(fixed[1] & 0xFF));
+    }
+
+    nextSeq[fixed[0]]++;
+    received++;
+  }
+
+  for (std::thread &producer : producers) {
+    producer.join();
+  }
+
+  uint8_t entry[32];
+  uint32_t entryLen = 0;
+  EXPECT_EQ(mpscRingPop(&ring, entry, sizeof(entry), &entryLen), OBC_ERR_CODE_QUEUE_EMPTY);
+  EXPECT_LE(mpscRingHighWater(&ring), sizeof(buffer));
+}
@@ -0,0 +1,97 @@
+#include "obc_seqlock.h"
+
+#include <stdint.h>
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+
+typedef struct {
+  uint32_t value;
+  uint32_t complement;
+  uint32_t padding[14];
+} test_guarded_t;
+
+TEST(TestObcSeqlock, WriteThenRead) {
+  obc_seqlock_t lock;
+  test_guarded_t guarded = {0};
+  seqlockInit(&lock);
+
+  test_guarded_t update = {.value = 5, .complement = ~5U};
+  seqlockWrite(&lock, &guarded, &update, sizeof(update));
+
+  test_guarded_t copy = {0};
+  ASSERT_TRUE(seqlockTryRead(&lock, &guarded, &copy, sizeof(copy)));
+  EXPECT_EQ(copy.value, 5U);
+  EXPECT_EQ(copy.complement, ~5U);
+  EXPECT_EQ(lock.sequence, 2U);
+}
+
+TEST(TestObcSeqlock, ReadFailsWhileWriteInProgress) {
+  obc_seqlock_t lock;
+  test_guarded_t guarded = {0};
+  seqlockInit(&lock);
+
+  // An odd sequence means a writer stopped partway through
+  lock.sequence = 1;
+
+  test_guarded_t copy;
+  EXPECT_FALSE(seqlockTryRead(&lock, &guarded, &copy, sizeof(copy)));
+}
+
+TEST(TestObcSeqlock, InvalidArgs) {
+  obc_seqlock_t lock;
+  test_guarded_t guarded = {0};
+  test_guarded_t copy;
+  seqlockInit(&lock);
+
+  EXPECT_FALSE(seqlockTryRead(NULL, &guarded, &copy, sizeof(copy)));
+  EXPECT_FALSE(seqlockTryRead(&lock, NULL, &copy, sizeof(copy)));
+  EXPECT_FALSE(seqlockTryRead(&lock, &guarded, NULL, sizeof(copy)));
+
+  seqlockWrite(&lock, &guarded, NULL, sizeof(guarded));
+  EXPECT_EQ(lock.sequence, 0U);
+}
+
+TEST(TestObcSeqlock, ReaderNeverSeesTornValue) {
+  const uint32_t numWrites = 200000;
+
+  obc_seqlock_t lock;
+  static test_guarded_t guarded;
+  guarded = {.value = 0, .complement = ~0U};
+  seqlockInit(&lock);
+  std::atomic<bool> done(false);
+
+  std::thread writer([&lock, &done, numWrites]() {
+    for (uint32_t i = 1; i <= numWrites; i++) {
+      test_guarded_t update;
+      update.value = i;
+      update.complement = ~i;
+      for (uint32_t &word : update.padding) {
+        word = i;
+      }
+      seqlockWrite(&lock, &guarded, &update, sizeof(update));
+    }
+    done = true;
+  });
+
+  uint32_t consistentReads = 0;
+  uint32_t lastValue = 0;
+  while (!done) {
+    test_guarded_t copy;
+    if (!seqlockTryRead(&lock, &guarded, &copy, sizeof(copy))) {
+      continue;
+    }
+
+    consistentReads++;
+    ASSERT_EQ(copy.complement, ~copy.value);
+    for (uint32_t word : copy.padding) {
+      ASSERT_EQ(word, copy.value);
+    }
+    ASSERT_GE(copy.value, lastValue);
+    lastValue = copy.value;
+  }
+
+  writer.join();
+  EXPECT_GT(consistentReads, 0U);
+}
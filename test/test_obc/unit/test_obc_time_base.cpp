@@ -0,0 +1,223 @@
+#include "obc_time_base.h"
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+
+TEST(TestObcTimeBase, ExtrapolatesFromTick) {
+  obc_time_base_t base;
+  timeBaseSet(&base, 1676006459, 5000);
+
+  unix_time_ms_t now = timeBaseNow(&base, 5000);
+  EXPECT_EQ(now.seconds, 1676006459U);
+  EXPECT_EQ(now.milliseconds, 0U);
+
+  now = timeBaseNow(&base, 5999);
+  EXPECT_EQ(now.seconds, 1676006459U);
+  EXPECT_EQ(now.milliseconds, 999U);
+
+  now = timeBaseNow(&base, 6000);
+  EXPECT_EQ(now.seconds, 1676006460U);
+  EXPECT_EQ(now.milliseconds, 0U);
+
+  now = timeBaseNow(&base, 5000 + 3600 * 1000 + 250);
+  EXPECT_EQ(now.seconds, 1676006459U + 3600U);
+  EXPECT_EQ(now.milliseconds, 250U);
+}
+
+TEST(TestObcTimeBase, TickWraps) {
+  obc_time_base_t base;
+  timeBaseSet(&base, 1000, UINT32_MAX - 499);
+
+  unix_time_ms_t now = timeBaseNow(&base, 700);
+  EXPECT_EQ(now.seconds, 1001U);
+  EXPECT_EQ(now.milliseconds, 200U);
+}
+
+TEST(TestObcTimeBase, LongestElapsedTime) {
+  obc_time_base_t base;
+  timeBaseSet(&base, 1000, 0);
+  base.time.milliseconds = 999;
+
+  // 2^32 - 1 ms is 4294967 s and 295 ms
+  unix_time_ms_t now = timeBaseNow(&base, UINT32_MAX);
+  EXPECT_EQ(now.seconds, 1000U + 4294967U + 1U);
+  EXPECT_EQ(now.milliseconds, 294U);
+}
+
+TEST(TestObcTimeBase, FoldKeepsTime) {
+  obc_time_base_t base;
+  timeBaseSet(&base, 1000, 0);
+
+  timeBaseFold(&base, 12345);
+  EXPECT_EQ(base.tickMs, 12345U);
+  EXPECT_EQ(base.time.seconds, 1012U);
+  EXPECT_EQ(base.time.milliseconds, 345U);
+
+  unix_time_ms_t now = timeBaseNow(&base, 12345 + 700);
+  EXPECT_EQ(now.seconds, 1013U);
+  EXPECT_EQ(now.milliseconds, 45U);
+}
+
+TEST(TestObcTimeBase, FoldingKeepsTimePastTickWrap) {
+  const uint32_t startTime = 1672531200;
+  const uint32_t periodMs = 1000;
+  const uint32_t numPeriods = 50U * 24U * 3600U;  // 50 days, past the 49.7 day wrap of the ms tick
+
+  obc_time_base_t base;
+  timeBaseSet(&base, startTime, 0);
+  obc_time_base_t unfolded = base;
+
+  // As the timekeeper does once a second, without an RTC to sync to
+  uint32_t tickMs = 0;
+  unix_time_ms_t previous = timeBaseNow(&base, tickMs);
+  for (uint32_t i = 1; i <= numPeriods; i++) {
+    tickMs += periodMs;
+    timeBaseFold(&base, tickMs);
+
+    unix_time_ms_t now = timeBaseNow(&base, tickMs);
+    ASSERT_EQ(now.seconds, previous.seconds + 1U) << "period " << i;
+    previous = now;
+  }
+  EXPECT_LT(tickMs, periodMs * 3600U * 24U);  // The tick has wrapped
+  EXPECT_EQ(previous.seconds, startTime + numPeriods);
+  EXPECT_EQ(previous.milliseconds, 0U);
+
+  // Without the folds the time since the base wraps with the tick
+  EXPECT_LT(timeBaseNow(&unfolded, tickMs).seconds, startTime + numPeriods);
+}
+
+TEST(TestObcTimeBase, ResyncKeepsPhaseWithinRtcSecond) {
+  obc_time_base_t base;
+  timeBaseSet(&base, 1000, 0);
+
+  EXPECT_EQ(timeBaseResync(&base, 60400, 1060, 60400), 0);
+
+  unix_time_ms_t now = timeBaseNow(&base, 60400);
+  EXPECT_EQ(now.seconds, 1060U);
+  EXPECT_EQ(now.milliseconds, 400U);
+}
+
+TEST(TestObcTimeBase, ResyncLocalBehind) {
+  obc_time_base_t base;
+  timeBaseSet(&base, 1000, 0);
+
+  // Local time is 1059.980 while the RTC has reached 1060
+  EXPECT_EQ(timeBaseResync(&base, 59980, 1060, 59980), 20);
+
+  unix_time_ms_t now = timeBaseNow(&base, 59980);
+  EXPECT_EQ(now.seconds, 1060U);
+  EXPECT_EQ(now.milliseconds, 0U);
+}
+
+TEST(TestObcTimeBase, ResyncSlewsLocalAhead) {
+  obc_time_base_t base;
+  timeBaseSet(&base, 1000, 0);
+
+  // Local time is 1061.030 while the RTC still reads 1060, so 31 ms have to come out
+  EXPECT_EQ(timeBaseResync(&base, 61030, 1060, 61030), -31);
+
+  unix_time_ms_t now = timeBaseNow(&base, 61030);
+  EXPECT_EQ(now.seconds, 1061U);
+  EXPECT_EQ(now.milliseconds, 30U);
+
+  // 1 ms in OBC_TIME_BASE_SLEW_DIVISOR is taken out until the slew is done
+  now = timeBaseNow(&base, 61030 + 100);
+  EXPECT_EQ(now.seconds, 1061U);
+  EXPECT_EQ(now.milliseconds, 30U + 100U - 100U / OBC_TIME_BASE_SLEW_DIVISOR);
+
+  now = timeBaseNow(&base, 61030 + 31 * OBC_TIME_BASE_SLEW_DIVISOR + 1000);
+  EXPECT_EQ(now.seconds, 1061U + 31U * OBC_TIME_BASE_SLEW_DIVISOR / 1000U + 1U);
+  EXPECT_EQ(now.milliseconds, (30U + 31U * OBC_TIME_BASE_SLEW_DIVISOR - 31U) % 1000U);
+
+  // Folding part way through keeps the rest of the slew
+  timeBaseFold(&base, 61030 + 100);
+  EXPECT_EQ(base.slewMs, 31U - 100U / OBC_TIME_BASE_SLEW_DIVISOR);
+  now = timeBaseNow(&base, 61030 + 31 * OBC_TIME_BASE_SLEW_DIVISOR + 1000);
+  EXPECT_EQ(now.seconds, 1061U + 31U * OBC_TIME_BASE_SLEW_DIVISOR / 1000U + 1U);
+  EXPECT_EQ(now.milliseconds, (30U + 31U * OBC_TIME_BASE_SLEW_DIVISOR - 31U) % 1000U);
+}
+
+TEST(TestObcTimeBase, ResyncStepsForwardOnly) {
+  obc_time_base_t base;
+  timeBaseSet(&base, 0, 0);
+
+  // At boot the local time starts from zero; the correction is too large to return
+  EXPECT_EQ(timeBaseResync(&base, 1500, 1672531200, 1500), INT32_MAX);
+  unix_time_ms_t now = timeBaseNow(&base, 1500);
+  EXPECT_EQ(now.seconds, 1672531200U);
+  EXPECT_EQ(now.milliseconds, 0U);
+
+  // An RTC an hour behind is slewed towards, not stepped to
+  EXPECT_EQ(timeBaseResync(&base, 2500, 1672531201 - 3600, 2500), -3600 * 1000 + 999);
+  now = timeBaseNow(&base, 2500);
+  EXPECT_EQ(now.seconds, 1672531201U);
+  EXPECT_EQ(now.milliseconds, 0U);
+  EXPECT_EQ(base.slewMs, 3600U * 1000U - 999U);
+
+  // Only setting the base moves the time back
+  timeBaseSet(&base, 1672531201 - 3600, 2500);
+  now = timeBaseNow(&base, 2500);
+  EXPECT_EQ(now.seconds, 1672531201U - 3600U);
+  EXPECT_EQ(base.slewMs, 0U);
+}
+
+TEST(TestObcTimeBase, ResyncStartsFromCurrentTick) {
+  obc_time_base_t base;
+  timeBaseSet(&base, 1000, 0);
+
+  // The RTC was read at 59.980 s and said 1060 (local 1059.980); 50 ms passed before the resync
+  EXPECT_EQ(timeBaseResync(&base, 59980, 1060, 60030), 20);
+  unix_time_ms_t now = timeBaseNow(&base, 60030);
+  EXPECT_EQ(now.seconds, 1060U);
+  EXPECT_EQ(now.milliseconds, 50U);
+
+  // Ahead by 31 ms at the read; the 1061.080 given out at the resync tick is not taken back
+  timeBaseSet(&base, 1000, 0);
+  EXPECT_EQ(timeBaseResync(&base, 61030, 1060, 61080), -31);
+  now = timeBaseNow(&base, 61080);
+  EXPECT_EQ(now.seconds, 1061U);
+  EXPECT_EQ(now.milliseconds, 80U);
+}
+
+TEST(TestObcTimeBase, TimeNeverGoesBackAcrossResyncs) {
+  // A local clock 2% fast against the RTC, read every 10 ms and resynced every second of RTC time, with the RTC set
+  // wrong by a few seconds now and then
+  const uint32_t startTime = 1672531200;
+  obc_time_base_t base;
+  timeBaseSet(&base, startTime, 0);
+
+  unix_time_ms_t previous = timeBaseNow(&base, 0);
+  int32_t rtcErrorS = 0;
+  uint32_t rtcTime = startTime;
+  for (uint32_t tickMs = 10; tickMs < 600000; tickMs += 10) {
+    if (tickMs % 1000 == 0) {
+      if (tickMs % 60000 == 0) {
+        rtcErrorS = (rtcErrorS == 0) ? -3 : 0;
+      }
+      rtcTime = startTime + (uint32_t)((uint64_t)tickMs * 100 / 102 / 1000) + rtcErrorS;
+      timeBaseResync(&base, tickMs - 5, rtcTime, tickMs);
+    }
+
+    unix_time_ms_t now = timeBaseNow(&base, tickMs);
+    ASSERT_TRUE(now.seconds > previous.seconds ||
+                (now.seconds == previous.seconds && now.milliseconds >= previous.milliseconds))
+        << "went back at tick " << tickMs << " from " << previous.seconds << "." << previous.milliseconds << " to "
+        << now.seconds << "." << now.milliseconds;
+    previous = now;
+  }
+
+  // The slews kept the local time with the RTC rather than running 2% fast
+  EXPECT_GE(previous.seconds, rtcTime);
+  EXPECT_LE(previous.seconds, rtcTime + 1U);
+}
+
+TEST(TestObcTimeBase, NullBase) {
+  timeBaseSet(NULL, 0, 0);
+  timeBaseFold(NULL, 0);
+  EXPECT_EQ(timeBaseResync(NULL, 0, 0, 0), 0);
+
+  unix_time_ms_t now = timeBaseNow(NULL, 0);
+  EXPECT_EQ(now.seconds, 0U);
+  EXPECT_EQ(now.milliseconds, 0U);
+}
@@ -34,3 +34,26 @@ TEST(TestObcTimeUtils, ValidUnixToDatetime) {
   EXPECT_EQ(datetime.time.minutes, 20);
   EXPECT_EQ(datetime.time.seconds, 59);
 }
+
+TEST(TestObcTimeUtils, UnixToDatetimeDecember) {
+  // 2023-12-31 23:59:59
+  const uint32_t unixTime = 1704067199;
+
+  rtc_date_time_t datetime = {0};
+  ASSERT_EQ(unixToDatetime(unixTime, &datetime), OBC_ERR_CODE_SUCCESS);
+
+  EXPECT_EQ(datetime.date.date, 31);
+  EXPECT_EQ(datetime.date.month, 12);
+  EXPECT_EQ(datetime.date.year, 23);
+
+  EXPECT_EQ(datetime.time.hours, 23);
+  EXPECT_EQ(datetime.time.minutes, 59);
+  EXPECT_EQ(datetime.time.seconds, 59);
+
+  // One second later is the new year
+  ASSERT_EQ(unixToDatetime(unixTime + 1, &datetime), OBC_ERR_CODE_SUCCESS);
+
+  EXPECT_EQ(datetime.date.date, 1);
+  EXPECT_EQ(datetime.date.month, 1);
+  EXPECT_EQ(datetime.date.year, 24);
+}
@@ -0,0 +1,188 @@
+/*
+ * Reliance Edge on the file-backed block device from the benchmarks, built once with the flight buffer count and
+ * write gathering and once without (obc-reliance-edge-tests-no-gather), so the two have to agree on every byte.
+ */
+#include "file_bdev.h"
+
+#include <redposix.h>
+extern "C" {
+#include <redfs.h>
+#include <redbdev.h>
+}
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#define VOLUME_PATH ""
+#define VOLUME_NUM 0U
+#define SECTOR_SIZE 512U
+
+#define NUM_FILES 4U
+#define MAX_FILE_SIZE (96U * 1024U)
+#define MAX_WRITE_SIZE 3000U
+#define NUM_OPS 3000U
+
+class RelianceEdgeTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(red_init(), 0);
+    ASSERT_EQ(red_format(VOLUME_PATH), 0);
+    ASSERT_EQ(red_mount(VOLUME_PATH), 0);
+  }
+
+  void TearDown() override {
+    red_umount(VOLUME_PATH);
+    red_uninit();
+  }
+};
+
+static void fileName(uint32_t index, char *name, size_t len) { snprintf(name, len, "/f%lu.bin", (unsigned long)index); }
+
+static void verifyFile(int32_t fd, const std::vector<uint8_t> &expected, uint32_t index) {
+  std::vector<uint8_t> actual(expected.size() + 1U);
+  ASSERT_EQ(red_pread(fd, actual.data(), (uint32_t)actual.size(), 0), (int32_t)expected.size()) << "file " << index;
+  actual.resize(expected.size());
+  ASSERT_TRUE(actual == expected) << "file " << index;
+}
+
+static void openFiles(int32_t *fds) {
+  for (uint32_t i = 0; i < NUM_FILES; i++) {
+    char name[16];
+    fileName(i, name, sizeof(name));
+    fds[i] = red_open(name, RED_O_RDWR | RED_O_CREAT);
+    ASSERT_GE(fds[i], 0) << "errno " << red_errno;
+  }
+}
+
+static void closeFiles(int32_t *fds) {
+  for (uint32_t i = 0; i < NUM_FILES; i++) {
+    ASSERT_EQ(red_close(fds[i]), 0);
+  }
+}
+
+TEST_F(RelianceEdgeTest, RandomAppendsAndOverwritesSurviveRemounts) {
+  std::mt19937 rng(1);
+  std::vector<uint8_t> files[NUM_FILES];
+  std::vector<uint8_t> data(MAX_WRITE_SIZE);
+  int32_t fds[NUM_FILES];
+  uint32_t numRemounts = 0;
+
+  openFiles(fds);
+  for (uint32_t op = 0; op < NUM_OPS; op++) {
+    uint32_t index = rng() % NUM_FILES;
+    std::vector<uint8_t> &file = files[index];
+    uint32_t choice = rng() % 100U;
+    uint32_t len = 1U + rng() % MAX_WRITE_SIZE;
+    for (uint32_t i = 0; i < len; i++) {
+      data[i] = (uint8_t)rng();
+    }
+
+    if (choice < 45U) {
+      // Append, or start over once the file is full
+      if (file.size() + len > MAX_FILE_SIZE) {
+        ASSERT_EQ(red_ftruncate(fds[index], 0), 0);
+        file.clear();
+      }
+      ASSERT_EQ(red_pwrite(fds[index], data.data(), len, file.size()), (int32_t)len);
+      file.insert(file.end(), data.begin(), data.begin() + len);
+    } else if (choice < 85U) {
+      // Overwrite anywhere in the file, possibly running past the end
+      uint32_t offset = file.empty() ? 0U : rng() % (uint32_t)file.size();
+      len = std::min(len, MAX_FILE_SIZE - offset);
+      ASSERT_EQ(red_pwrite(fds[index], data.data(), len, offset), (int32_t)len);
+      if (offset + len > file.size()) {
+        file.resize(offset + len);
+      }
+      memcpy(&file[offset], data.data(), len);
+    } else if (choice < 90U) {
+      uint32_t size = file.empty() ? 0U : rng() % (uint32_t)file.size();
+      ASSERT_EQ(red_ftruncate(fds[index], size), 0);
+      file.resize(size);
+    } else if (choice < 96U) {
+      verifyFile(fds[index], file, index);
+    } else if (choice < 98U) {
+      ASSERT_EQ(red_fsync(fds[index]), 0);
+    } else {
+      closeFiles(fds);
+      ASSERT_EQ(red_umount(VOLUME_PATH), 0);
+      ASSERT_EQ(red_mount(VOLUME_PATH), 0);
+      openFiles(fds);
+      numRemounts++;
+      for (uint32_t i = 0; i < NUM_FILES; i++) {
+        verifyFile(fds[i], files[i], i);
+      }
+    }
+    ASSERT_FALSE(HasFatalFailure()) << "op " << op;
+  }
+  EXPECT_GT(numRemounts, 0U);
+
+  closeFiles(fds);
+  ASSERT_EQ(red_umount(VOLUME_PATH), 0);
+  ASSERT_EQ(red_mount(VOLUME_PATH), 0);
+  openFiles(fds);
+  for (uint32_t i = 0; i < NUM_FILES; i++) {
+    verifyFile(fds[i], files[i], i);
+  }
+  closeFiles(fds);
+}
+
+static void fillSector(uint8_t *sector, uint8_t seed) {
+  for (uint32_t i = 0; i < SECTOR_SIZE; i++) {
+    sector[i] = (uint8_t)(seed + i * 7U);
+  }
+}
+
+TEST_F(RelianceEdgeTest, ReadSeesSectorsStillBeingGathered) {
+  // Sectors past the end of the file system's data, driven directly through the block device layer
+  const uint64_t first = 3000U;
+  uint8_t onDisk[2][SECTOR_SIZE];
+  uint8_t gathered[3][SECTOR_SIZE];
+  uint8_t readBack[4 * SECTOR_SIZE];
+
+  ASSERT_EQ(red_umount(VOLUME_PATH), 0);
+  ASSERT_EQ(RedBDevOpen(VOLUME_NUM, BDEV_O_RDWR), 0);
+
+  fillSector(onDisk[0], 1);
+  fillSector(onDisk[1], 2);
+  ASSERT_EQ(RedBDevWrite(VOLUME_NUM, first, 1, onDisk[0]), 0);
+  ASSERT_EQ(RedBDevWrite(VOLUME_NUM, first + 3U, 1, onDisk[1]), 0);
+  ASSERT_EQ(RedBDevFlush(VOLUME_NUM), 0);
+  fileBdevResetStats();
+
+  // A run of two sectors after the first, then the second one overwritten while it is held
+  fillSector(gathered[0], 10);
+  fillSector(gathered[1], 11);
+  fillSector(gathered[2], 12);
+  ASSERT_EQ(RedBDevWrite(VOLUME_NUM, first + 1U, 1, gathered[0]), 0);
+  ASSERT_EQ(RedBDevWrite(VOLUME_NUM, first + 2U, 1, gathered[1]), 0);
+  ASSERT_EQ(RedBDevWrite(VOLUME_NUM, first + 2U, 1, gathered[2]), 0);
+#if REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U
+  EXPECT_EQ(fileBdevStats()->writes, 0U);
+#endif
+
+  // One read across disk, gathered and disk sectors
+  ASSERT_EQ(RedBDevRead(VOLUME_NUM, first, 4, readBack), 0);
+  EXPECT_EQ(memcmp(&readBack[0], onDisk[0], SECTOR_SIZE), 0);
+  EXPECT_EQ(memcmp(&readBack[SECTOR_SIZE], gathered[0], SECTOR_SIZE), 0);
+  EXPECT_EQ(memcmp(&readBack[2 * SECTOR_SIZE], gathered[2], SECTOR_SIZE), 0);
+  EXPECT_EQ(memcmp(&readBack[3 * SECTOR_SIZE], onDisk[1], SECTOR_SIZE), 0);
+
+  // A read of the gathered sector alone
+  ASSERT_EQ(RedBDevRead(VOLUME_NUM, first + 2U, 1, readBack), 0);
+  EXPECT_EQ(memcmp(readBack, gathered[2], SECTOR_SIZE), 0);
+
+  ASSERT_EQ(RedBDevFlush(VOLUME_NUM), 0);
+#if REDCONF_BUFFER_WRITE_GATHER_SIZE_KB > 0U
+  EXPECT_EQ(fileBdevStats()->writes, 1U);
+#endif
+  ASSERT_EQ(RedBDevRead(VOLUME_NUM, first + 1U, 2, readBack), 0);
+  EXPECT_EQ(memcmp(&readBack[0], gathered[0], SECTOR_SIZE), 0);
+  EXPECT_EQ(memcmp(&readBack[SECTOR_SIZE], gathered[2], SECTOR_SIZE), 0);
+
+  ASSERT_EQ(RedBDevClose(VOLUME_NUM), 0);
+  ASSERT_EQ(red_mount(VOLUME_PATH), 0);
+}
@@ -0,0 +1,269 @@
+#include "sdc_transfer.h"
+#include "mock_sd_card.h"
+#include "obc_errors.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+#define TEST_NUM_SECTORS 2048U
+// Byte clocks per millisecond at the SD card's 300 kHz SPI clock
+#define TEST_BYTES_PER_MS 37U
+
+// SPI access backed by the simulated card. A DMA transfer is only clocked when it is waited for, so reading the
+// received frames early or touching the transmitted frames while the transfer is in flight shows up in the results.
+static struct {
+  bool inFlight;
+  uint16_t *tx;
+  uint16_t *rx;
+  std::vector<uint16_t> txSnapshot;
+  uint32_t byteCalls;
+  uint32_t dmaTransfers;
+  uint32_t delays;
+  uint32_t misuse;
+} bus;
+
+static obc_error_code_t simExchangeByte(uint8_t tx, uint8_t *rx) {
+  if (bus.inFlight) {
+    bus.misuse++;
+  }
+  bus.byteCalls++;
+  *rx = mockSdCardExchange(tx);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t simStartDma(uint16_t *tx, uint16_t *rx, size_t numFrames) {
+  if (bus.inFlight) {
+    bus.misuse++;
+  }
+  bus.inFlight = true;
+  bus.tx = tx;
+  bus.rx = rx;
+  bus.txSnapshot.assign(tx, tx + numFrames);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t simWaitDma(void) {
+  if (!bus.inFlight) {
+    bus.misuse++;
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+  for (size_t i = 0; i < bus.txSnapshot.size(); i++) {
+    if (bus.tx[i] != bus.txSnapshot[i]) {
+      bus.misuse++;
+      break;
+    }
+  }
+  for (size_t i = 0; i < bus.txSnapshot.size(); i++) {
+    // The upper half of a received frame is not data
+    bus.rx[i] = (uint16_t)(0x5A00U | mockSdCardExchange((uint8_t)bus.txSnapshot[i]));
+  }
+  bus.inFlight = false;
+  bus.dmaTransfers++;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static void simDelayMs(uint32_t ms) {
+  bus.delays++;
+  mockSdCardElapse(ms * TEST_BYTES_PER_MS);
+}
+
+static const sdc_spi_ops_t dmaOps = {simExchangeByte, simStartDma, simWaitDma, simDelayMs, TEST_BYTES_PER_MS};
+static const sdc_spi_ops_t byteOps = {simExchangeByte, NULL, NULL, simDelayMs, TEST_BYTES_PER_MS};
+
+class TestSdcTransfer : public ::testing::Test {
+ protected:
+  void SetUp() override { reset(mockSdCardDefaultConfig()); }
+
+  void reset(const mock_sd_card_config_t &config) {
+    storage.assign(TEST_NUM_SECTORS * SD_SECTOR_SIZE, 0);
+    mockSdCardInit(storage.data(), TEST_NUM_SECTORS, &config);
+    bus.inFlight = false;
+    bus.byteCalls = 0;
+    bus.dmaTransfers = 0;
+    bus.delays = 0;
+    bus.misuse = 0;
+  }
+
+  static std::vector<uint8_t> pattern(uint32_t numSectors, uint32_t seed) {
+    std::vector<uint8_t> data(numSectors * SD_SECTOR_SIZE);
+    for (uint8_t &byte : data) {
+      seed = seed * 1103515245U + 12345U;
+      byte = (uint8_t)(seed >> 16);
+    }
+    return data;
+  }
+
+  std::vector<uint8_t> sectors(uint32_t first, uint32_t count) const {
+    return std::vector<uint8_t>(storage.begin() + first * SD_SECTOR_SIZE,
+                                storage.begin() + (first + count) * SD_SECTOR_SIZE);
+  }
+
+  std::vector<uint8_t> storage;
+};
+
+TEST_F(TestSdcTransfer, InvalidArgs) {
+  uint8_t buff[SD_SECTOR_SIZE];
+  EXPECT_EQ(sdcReadSectors(NULL, 0, buff, 1), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(sdcReadSectors(&dmaOps, 0, NULL, 1), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(sdcReadSectors(&dmaOps, 0, buff, 0), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(sdcWriteSectors(NULL, 0, buff, 1, false), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(sdcWriteSectors(&dmaOps, 0, NULL, 1, false), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(sdcWriteSectors(&dmaOps, 0, buff, 0, false), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(sdcReadRegister(&dmaOps, SDC_CMD9, NULL, 16), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(sdcWaitReady(NULL), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(mockSdCardStats()->bytesClocked, 0U);
+}
+
+TEST_F(TestSdcTransfer, SingleSectorRoundTrip) {
+  std::vector<uint8_t> data = pattern(1, 1);
+  ASSERT_EQ(sdcWriteSectors(&dmaOps, 7, data.data(), 1, true), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(sectors(7, 1), data);
+
+  std::vector<uint8_t> readBack(SD_SECTOR_SIZE);
+  ASSERT_EQ(sdcReadSectors(&dmaOps, 7, readBack.data(), 1), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(readBack, data);
+
+  const mock_sd_card_stats_t *stats = mockSdCardStats();
+  EXPECT_EQ(stats->commands[24], 1U);
+  EXPECT_EQ(stats->commands[17], 1U);
+  // Single sector transfers need neither a pre-erase nor a stop
+  EXPECT_EQ(stats->commands[55], 0U);
+  EXPECT_EQ(stats->commands[12], 0U);
+  EXPECT_EQ(bus.dmaTransfers, 2U);
+  EXPECT_EQ(bus.misuse, 0U);
+}
+
+TEST_F(TestSdcTransfer, MultiSectorRoundTrip) {
+  const uint32_t count = 37;
+  std::vector<uint8_t> data = pattern(count, 2);
+  ASSERT_EQ(sdcWriteSectors(&dmaOps, 100, data.data(), count, true), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(sectors(100, count), data);
+
+  std::vector<uint8_t> readBack(count * SD_SECTOR_SIZE);
+  ASSERT_EQ(sdcReadSectors(&dmaOps, 100, readBack.data(), count), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(readBack, data);
+
+  const mock_sd_card_stats_t *stats = mockSdCardStats();
+  EXPECT_EQ(stats->commands[55], 1U);
+  EXPECT_EQ(stats->commands[23], 1U);
+  EXPECT_EQ(stats->preEraseCount, count);
+  EXPECT_EQ(stats->commands[25], 1U);
+  EXPECT_EQ(stats->commands[18], 1U);
+  EXPECT_EQ(stats->commands[12], 1U);
+  EXPECT_EQ(stats->sectorsWritten, count);
+  EXPECT_EQ(stats->rejectedWrites, 0U);
+  // One transfer per sector in each direction
+  EXPECT_EQ(bus.dmaTransfers, 2 * count);
+  EXPECT_EQ(bus.misuse, 0U);
+  EXPECT_EQ(bus.delays, 0U);
+
+  // The card is back to accepting commands after the stop token and CMD12
+  std::vector<uint8_t> single(SD_SECTOR_SIZE);
+  ASSERT_EQ(sdcReadSectors(&dmaOps, 100 + count - 1, single.data(), 1), OBC_ERR_CODE_SUCCESS);
+  EXPECT_TRUE(std::equal(single.begin(), single.end(), data.end() - SD_SECTOR_SIZE));
+}
+
+TEST_F(TestSdcTransfer, PreEraseIsOptional) {
+  std::vector<uint8_t> data = pattern(4, 3);
+  ASSERT_EQ(sdcWriteSectors(&dmaOps, 0, data.data(), 4, false), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(sectors(0, 4), data);
+  EXPECT_EQ(mockSdCardStats()->commands[23], 0U);
+}
+
+TEST_F(TestSdcTransfer, BytePathMatchesDmaPath) {
+  const uint32_t count = 9;
+  std::vector<uint8_t> data = pattern(count, 4);
+  std::vector<uint8_t> readBack(count * SD_SECTOR_SIZE);
+
+  ASSERT_EQ(sdcWriteSectors(&dmaOps, 40, data.data(), count, true), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(sdcReadSectors(&dmaOps, 40, readBack.data(), count), OBC_ERR_CODE_SUCCESS);
+  uint64_t dmaBytes = mockSdCardStats()->bytesClocked;
+  uint32_t dmaByteCalls = bus.byteCalls;
+
+  reset(mockSdCardDefaultConfig());
+  std::fill(readBack.begin(), readBack.end(), 0);
+  ASSERT_EQ(sdcWriteSectors(&byteOps, 40, data.data(), count, true), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(sdcReadSectors(&byteOps, 40, readBack.data(), count), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(readBack, data);
+  EXPECT_EQ(sectors(40, count), data);
+
+  // Same bytes on the bus either way, but the DMA path makes a fraction of the driver calls
+  EXPECT_EQ(mockSdCardStats()->bytesClocked, dmaBytes);
+  EXPECT_GT(bus.byteCalls, 10 * dmaByteCalls);
+}
+
+TEST_F(TestSdcTransfer, ReadCrcMismatch) {
+  mock_sd_card_config_t config = mockSdCardDefaultConfig();
+  config.corruptReadCrcSector = 5;
+  reset(config);
+
+  std::vector<uint8_t> readBack(6 * SD_SECTOR_SIZE);
+  EXPECT_EQ(sdcReadSectors(&dmaOps, 3, readBack.data(), 6), OBC_ERR_CODE_SD_CARD_CRC_MISMATCH);
+  EXPECT_EQ(mockSdCardStats()->commands[12], 1U);
+  EXPECT_EQ(bus.misuse, 0U);
+
+  EXPECT_EQ(sdcReadSectors(&dmaOps, 5, readBack.data(), 1), OBC_ERR_CODE_SD_CARD_CRC_MISMATCH);
+  EXPECT_EQ(sdcReadSectors(&dmaOps, 0, readBack.data(), 5), OBC_ERR_CODE_SUCCESS);
+}
+
+TEST_F(TestSdcTransfer, WriteRejected) {
+  mock_sd_card_config_t config = mockSdCardDefaultConfig();
+  config.rejectWriteSector = 12;
+  reset(config);
+
+  std::vector<uint8_t> data = pattern(6, 5);
+  EXPECT_EQ(sdcWriteSectors(&dmaOps, 10, data.data(), 6, true), OBC_ERR_CODE_SD_CARD_WRITE_REJECTED);
+  EXPECT_EQ(mockSdCardStats()->sectorsWritten, 2U);
+  EXPECT_EQ(sectors(10, 2), std::vector<uint8_t>(data.begin(), data.begin() + 2 * SD_SECTOR_SIZE));
+  EXPECT_EQ(bus.misuse, 0U);
+
+  // The stop token was still sent, so the card takes the next write
+  ASSERT_EQ(sdcWriteSectors(&dmaOps, 20, data.data(), 6, true), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(sectors(20, 6), data);
+}
+
+TEST_F(TestSdcTransfer, MissingDataTokenTimesOut) {
+  mock_sd_card_config_t config = mockSdCardDefaultConfig();
+  config.noTokenSector = 3;
+  reset(config);
+
+  std::vector<uint8_t> readBack(4 * SD_SECTOR_SIZE);
+  EXPECT_EQ(sdcReadSectors(&dmaOps, 2, readBack.data(), 2), OBC_ERR_CODE_SD_CARD_TIMEOUT);
+  EXPECT_GT(bus.delays, 0U);
+  EXPECT_EQ(bus.misuse, 0U);
+}
+
+TEST_F(TestSdcTransfer, SlowCardSleepsBetweenPolls) {
+  mock_sd_card_config_t config = mockSdCardDefaultConfig();
+  // About 10 ms to program each sector and 2 ms to fetch one
+  config.writeBusyBytes = 10 * TEST_BYTES_PER_MS;
+  config.readAccessBytes = 2 * TEST_BYTES_PER_MS;
+  reset(config);
+
+  std::vector<uint8_t> data = pattern(3, 6);
+  ASSERT_EQ(sdcWriteSectors(&dmaOps, 0, data.data(), 3, true), OBC_ERR_CODE_SUCCESS);
+  std::vector<uint8_t> readBack(3 * SD_SECTOR_SIZE);
+  ASSERT_EQ(sdcReadSectors(&dmaOps, 0, readBack.data(), 3), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(readBack, data);
+  EXPECT_GT(bus.delays, 0U);
+  ASSERT_EQ(sdcWaitReady(&dmaOps), OBC_ERR_CODE_SUCCESS);
+}
+
+TEST_F(TestSdcTransfer, AddressOutOfRange) {
+  std::vector<uint8_t> buff(2 * SD_SECTOR_SIZE);
+  EXPECT_EQ(sdcReadSectors(&dmaOps, TEST_NUM_SECTORS, buff.data(), 1), OBC_ERR_CODE_SD_CARD_CMD_REJECTED);
+  EXPECT_EQ(sdcWriteSectors(&dmaOps, TEST_NUM_SECTORS, buff.data(), 2, true), OBC_ERR_CODE_SD_CARD_CMD_REJECTED);
+}
+
+TEST_F(TestSdcTransfer, ReadCsd) {
+  uint8_t csd[16];
+  ASSERT_EQ(sdcReadRegister(&dmaOps, SDC_CMD9, csd, sizeof(csd)), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(csd[0] >> 6, 1);
+  uint32_t cSize = ((uint32_t)(csd[7] & 0x3F) << 16) | ((uint32_t)csd[8] << 8) | csd[9];
+  EXPECT_EQ((cSize + 1) << 10, TEST_NUM_SECTORS);
+
+  EXPECT_EQ(sdcReadRegister(&dmaOps, SDC_CMD10, csd, sizeof(csd)), OBC_ERR_CODE_SD_CARD_CMD_REJECTED);
+}
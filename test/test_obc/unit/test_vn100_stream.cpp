@@ -0,0 +1,221 @@
+#include "vn100_stream.h"
+#include "vn100_binary_parsing.h"
+#include "obc_gs_crc.h"
+#include "obc_errors.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#define TEST_FLOATS_PER_PACKET (VN100_BINARY_PAYLOAD_SIZE / sizeof(float))
+
+static std::vector<uint8_t> makePacket(const vn100_binary_packet_t &values) {
+  const uint8_t header[VN100_BINARY_HEADER_SIZE] = {0xFA, 0x01, 0x28, 0x05};
+  std::vector<uint8_t> packet(header, header + sizeof(header));
+
+  // The packet struct is laid out in output order; the VN100 sends little endian floats
+  uint8_t payload[VN100_BINARY_PAYLOAD_SIZE];
+  memcpy(payload, &values, sizeof(payload));
+  packet.insert(packet.end(), payload, payload + sizeof(payload));
+
+  // The CRC covers everything after the sync byte and is sent most significant byte first
+  uint16_t crc = calculateCrc16Ccitt(&packet[1], (uint16_t)(packet.size() - 1));
+  packet.push_back((uint8_t)(crc >> 8));
+  packet.push_back((uint8_t)(crc & 0xFF));
+  return packet;
+}
+
+static vn100_binary_packet_t makeValues(uint32_t seed) {
+  vn100_binary_packet_t values;
+  float fields[TEST_FLOATS_PER_PACKET];
+  for (uint32_t i = 0; i < TEST_FLOATS_PER_PACKET; i++) {
+    fields[i] = (float)seed + (float)i * 0.25f;
+  }
+  memcpy(&values, fields, sizeof(values));
+  return values;
+}
+
+static void collectPacket(const vn100_binary_packet_t *packet, void *context) {
+  static_cast<std::vector<vn100_binary_packet_t> *>(context)->push_back(*packet);
+}
+
+static void expectSameValues(const vn100_binary_packet_t &actual, const vn100_binary_packet_t &expected) {
+  EXPECT_EQ(memcmp(&actual, &expected, sizeof(actual)), 0);
+}
+
+class TestVn100Stream : public ::testing::Test {
+ protected:
+  void SetUp() override { vn100StreamParserInit(&parser); }
+
+  void push(const std::vector<uint8_t> &bytes) {
+    ASSERT_EQ(vn100StreamParserPush(&parser, bytes.data(), bytes.size(), collectPacket, &received),
+              OBC_ERR_CODE_SUCCESS);
+  }
+
+  vn100_stream_parser_t parser;
+  std::vector<vn100_binary_packet_t> received;
+};
+
+TEST_F(TestVn100Stream, RejectsInvalidArgs) {
+  uint8_t byte = 0;
+  EXPECT_EQ(vn100StreamParserPush(NULL, &byte, 1, collectPacket, &received), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(vn100StreamParserPush(&parser, NULL, 1, collectPacket, &received), OBC_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(vn100StreamParserPush(&parser, &byte, 1, NULL, &received), OBC_ERR_CODE_INVALID_ARG);
+}
+
+TEST_F(TestVn100Stream, BackToBackPackets) {
+  std::vector<uint8_t> stream;
+  for (uint32_t i = 0; i < 3; i++) {
+    std::vector<uint8_t> packet = makePacket(makeValues(i));
+    stream.insert(stream.end(), packet.begin(), packet.end());
+  }
+
+  push(stream);
+
+  ASSERT_EQ(received.size(), 3U);
+  for (uint32_t i = 0; i < 3; i++) {
+    expectSameValues(received[i], makeValues(i));
+  }
+  EXPECT_EQ(parser.packets, 3U);
+  EXPECT_EQ(parser.crcErrors, 0U);
+  EXPECT_EQ(parser.bytesDiscarded, 0U);
+}
+
+TEST_F(TestVn100Stream, PacketSplitAcrossPushes) {
+  std::vector<uint8_t> packet = makePacket(makeValues(7));
+
+  for (uint8_t byte : packet) {
+    EXPECT_TRUE(received.empty());
+    push({byte});
+  }
+
+  ASSERT_EQ(received.size(), 1U);
+  expectSameValues(received[0], makeValues(7));
+}
+
+TEST_F(TestVn100Stream, BytesNeeded) {
+  std::vector<uint8_t> packet = makePacket(makeValues(1));
+
+  EXPECT_EQ(vn100StreamParserBytesNeeded(&parser), VN100_BINARY_PACKET_SIZE);
+
+  push(std::vector<uint8_t>(packet.begin(), packet.begin() + 10));
+  EXPECT_EQ(vn100StreamParserBytesNeeded(&parser), VN100_BINARY_PACKET_SIZE - 10U);
+
+  push(std::vector<uint8_t>(packet.begin() + 10, packet.end()));
+  EXPECT_EQ(vn100StreamParserBytesNeeded(&parser), VN100_BINARY_PACKET_SIZE);
+  EXPECT_EQ(received.size(), 1U);
+}
+
+TEST_F(TestVn100Stream, SkipsLeadingGarbageAndFalseSyncBytes) {
+  // Command replies, a sync byte with the wrong group and headers cut short by another sync byte
+  std::vector<uint8_t> stream = {'$', 'V', 'N', 'A', 'S', 'Y', '\r', '\n', 0xFA, 0x02, 0x00, 0xFA, 0x01, 0xFA};
+  std::vector<uint8_t> packet = makePacket(makeValues(3));
+  stream.insert(stream.end(), packet.begin(), packet.end());
+
+  push(stream);
+
+  ASSERT_EQ(received.size(), 1U);
+  expectSameValues(received[0], makeValues(3));
+  EXPECT_EQ(parser.bytesDiscarded, 14U);
+}
+
+TEST_F(TestVn100Stream, DroppedByteCostsOnePacket) {
+  std::vector<uint8_t> first = makePacket(makeValues(1));
+  std::vector<uint8_t> second = makePacket(makeValues(2));
+  std::vector<uint8_t> third = makePacket(makeValues(3));
+
+  // The first packet loses a payload byte, so its candidate runs into the second packet's header
+  first.erase(first.begin() + 20);
+
+  std::vector<uint8_t> stream = first;
+  stream.insert(stream.end(), second.begin(), second.end());
+  stream.insert(stream.end(), third.begin(), third.end());
+  push(stream);
+
+  ASSERT_EQ(received.size(), 2U);
+  expectSameValues(received[0], makeValues(2));
+  expectSameValues(received[1], makeValues(3));
+  EXPECT_EQ(parser.crcErrors, 1U);
+}
+
+TEST_F(TestVn100Stream, CorruptedByteCostsOnePacket) {
+  std::vector<uint8_t> first = makePacket(makeValues(1));
+  std::vector<uint8_t> second = makePacket(makeValues(2));
+
+  first[30] ^= 0x10;
+
+  std::vector<uint8_t> stream = first;
+  stream.insert(stream.end(), second.begin(), second.end());
+  push(stream);
+
+  ASSERT_EQ(received.size(), 1U);
+  expectSameValues(received[0], makeValues(2));
+  EXPECT_EQ(parser.crcErrors, 1U);
+}
+
+TEST_F(TestVn100Stream, CorruptedSyncByteSkipsPacket) {
+  std::vector<uint8_t> first = makePacket(makeValues(1));
+  std::vector<uint8_t> second = makePacket(makeValues(2));
+
+  first[0] = 0x00;
+
+  std::vector<uint8_t> stream = first;
+  stream.insert(stream.end(), second.begin(), second.end());
+  push(stream);
+
+  ASSERT_EQ(received.size(), 1U);
+  expectSameValues(received[0], makeValues(2));
+}
+
+TEST_F(TestVn100Stream, RecoversEveryUndamagedPacket) {
+  const uint32_t numPackets = 2000;
+  std::mt19937 rng(1234);
+
+  std::vector<uint8_t> stream;
+  std::vector<bool> damaged(numPackets, false);
+  for (uint32_t i = 0; i < numPackets; i++) {
+    std::vector<uint8_t> packet = makePacket(makeValues(i));
+
+    // One packet in five loses or corrupts a byte
+    if (rng() % 5 == 0) {
+      damaged[i] = true;
+      uint32_t at = rng() % packet.size();
+      if (rng() % 2 == 0) {
+        packet.erase(packet.begin() + at);
+      } else {
+        packet[at] ^= (uint8_t)(1U << (rng() % 8));
+      }
+    }
+    stream.insert(stream.end(), packet.begin(), packet.end());
+  }
+
+  // Pushed in random sized spans, as the receive ring hands them over
+  for (size_t offset = 0; offset < stream.size();) {
+    size_t len = 1 + rng() % 100;
+    if (len > stream.size() - offset) {
+      len = stream.size() - offset;
+    }
+    ASSERT_EQ(vn100StreamParserPush(&parser, &stream[offset], len, collectPacket, &received), OBC_ERR_CODE_SUCCESS);
+    offset += len;
+  }
+
+  // Every packet that came out was sent, in order, and every undamaged packet came out
+  uint32_t next = 0;
+  for (const vn100_binary_packet_t &packet : received) {
+    float yaw = packet.yaw;
+    uint32_t index = (uint32_t)yaw;
+    ASSERT_LT(index, numPackets);
+    ASSERT_GE(index, next);
+    expectSameValues(packet, makeValues(index));
+    for (; next < index; next++) {
+      EXPECT_TRUE(damaged[next]) << "packet " << next << " was not recovered";
+    }
+    next = index + 1;
+  }
+  for (; next < numPackets; next++) {
+    EXPECT_TRUE(damaged[next]) << "packet " << next << " was not recovered";
+  }
+}